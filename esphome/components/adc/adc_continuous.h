@@ -0,0 +1,62 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_ESP32
+
+#include "esphome/core/component.h"
+
+#include <memory>
+#include <vector>
+
+#include "esp_adc/adc_continuous.h"
+#include "soc/soc_caps.h"
+
+namespace esphome {
+namespace adc {
+
+class ADCSensor;
+
+/** Samples the channels of all continuous mode ADC sensors in the background with the ADC DMA.
+ *
+ * The channels are converted one after the other at a fixed rate into a DMA buffer, independent of how fast the main
+ * loop runs. loop() drains that buffer without waiting and hands each sensor the raw readings of its channel as one
+ * block, so consumers like ct_clamp see evenly spaced samples. ADC1 only: the unit can't do oneshot reads while the
+ * engine owns it, and on the ESP32 the DMA only works with ADC1.
+ */
+class ADCContinuous : public Component {
+ public:
+  explicit ADCContinuous(uint32_t sample_rate) : sample_rate_(sample_rate) {}
+
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  /// After the sensors, so their calibration is ready for the first block
+  float get_setup_priority() const override { return setup_priority::DATA - 1.0f; }
+
+  void add_sensor(ADCSensor *sensor) { this->sensors_.push_back(sensor); }
+  /// The rate every channel is sampled at, in Hz.
+  uint32_t get_sample_rate() const { return this->sample_rate_; }
+
+ protected:
+  static bool on_pool_overflow_(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata,
+                                void *user_data);
+
+  adc_continuous_handle_t handle_{nullptr};
+  std::vector<ADCSensor *> sensors_;
+  /// Index into sensors_ for every channel, -1 for channels without a sensor
+  int8_t channel_sensor_[SOC_ADC_MAX_CHANNEL_NUM];
+  /// One conversion frame as read from the driver
+  std::unique_ptr<uint8_t[]> frame_;
+  /// The raw readings of the current frame, split up per sensor
+  std::vector<std::vector<uint16_t>> blocks_;
+  uint32_t sample_rate_;
+  /// Incremented from the ISR when the driver had to drop a frame because loop() didn't read it in time
+  volatile uint32_t overflows_{0};
+  uint32_t reported_overflows_{0};
+};
+
+}  // namespace adc
+}  // namespace esphome
+
+#endif  // USE_ESP32
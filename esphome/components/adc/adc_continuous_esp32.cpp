@@ -0,0 +1,160 @@
+#ifdef USE_ESP32
+
+#include "adc_continuous.h"
+#include "adc_sensor.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "esp_attr.h"
+
+namespace esphome {
+namespace adc {
+
+static const char *const TAG = "adc.continuous";
+
+/// Conversions per DMA frame, the unit loop() hands to the sensors
+static const uint32_t FRAME_CONVERSIONS = 256;
+static const uint32_t FRAME_SIZE = FRAME_CONVERSIONS * SOC_ADC_DIGI_RESULT_BYTES;
+/// How long the DMA pool can hold on without loop() reading it, before frames are dropped
+static const uint32_t POOL_DURATION_MS = 100;
+static const uint32_t POOL_MAX_FRAMES = 32;
+
+void ADCContinuous::setup() {
+  std::fill(std::begin(this->channel_sensor_), std::end(this->channel_sensor_), -1);
+  if (this->sensors_.size() > SOC_ADC_PATT_LEN_MAX) {
+    ESP_LOGE(TAG, "At most %d channels can be sampled in continuous mode", SOC_ADC_PATT_LEN_MAX);
+    this->mark_failed();
+    return;
+  }
+
+  // The driver's rate is for all conversions, the channels take turns
+  const uint32_t conversion_rate = this->sample_rate_ * this->sensors_.size();
+  if (conversion_rate < SOC_ADC_SAMPLE_FREQ_THRES_LOW || conversion_rate > SOC_ADC_SAMPLE_FREQ_THRES_HIGH) {
+    ESP_LOGE(TAG, "Conversion rate %" PRIu32 " Hz is outside of %d-%d Hz", conversion_rate,
+             SOC_ADC_SAMPLE_FREQ_THRES_LOW, SOC_ADC_SAMPLE_FREQ_THRES_HIGH);
+    this->mark_failed();
+    return;
+  }
+
+  const uint32_t pool_frames = std::min<uint32_t>(
+      POOL_MAX_FRAMES, std::max<uint32_t>(2, conversion_rate * POOL_DURATION_MS / 1000 / FRAME_CONVERSIONS + 1));
+  adc_continuous_handle_cfg_t handle_config = {};
+  handle_config.max_store_buf_size = pool_frames * FRAME_SIZE;
+  handle_config.conv_frame_size = FRAME_SIZE;
+  // Drop the oldest samples when the pool is full, the newest ones are the interesting ones
+  handle_config.flags.flush_pool = 1;
+  esp_err_t err = adc_continuous_new_handle(&handle_config, &this->handle_);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Error creating handle: %d", err);
+    this->mark_failed();
+    return;
+  }
+
+  adc_digi_pattern_config_t pattern[SOC_ADC_PATT_LEN_MAX] = {};
+  for (size_t i = 0; i < this->sensors_.size(); i++) {
+    ADCSensor *sensor = this->sensors_[i];
+    pattern[i].atten = sensor->get_attenuation();
+    pattern[i].channel = sensor->get_channel();
+    pattern[i].unit = sensor->get_adc_unit();
+    pattern[i].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+    this->channel_sensor_[sensor->get_channel()] = i;
+  }
+  adc_continuous_config_t config = {};
+  config.pattern_num = this->sensors_.size();
+  config.adc_pattern = pattern;
+  config.sample_freq_hz = conversion_rate;
+  config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+#if USE_ESP32_VARIANT_ESP32 || USE_ESP32_VARIANT_ESP32S2
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+#else
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+#endif  // USE_ESP32_VARIANT_ESP32 || USE_ESP32_VARIANT_ESP32S2
+  err = adc_continuous_config(this->handle_, &config);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Error configuring channels: %d", err);
+    this->mark_failed();
+    return;
+  }
+
+  adc_continuous_evt_cbs_t callbacks = {};
+  callbacks.on_pool_ovf = ADCContinuous::on_pool_overflow_;
+  err = adc_continuous_register_event_callbacks(this->handle_, &callbacks, this);
+  if (err != ESP_OK) {
+    ESP_LOGW(TAG, "Error registering overflow callback: %d", err);
+  }
+
+  this->frame_ = std::unique_ptr<uint8_t[]>(new uint8_t[FRAME_SIZE]);  // NOLINT(cppcoreguidelines-owning-memory)
+  this->blocks_.resize(this->sensors_.size());
+  for (auto &block : this->blocks_) {
+    block.reserve(FRAME_CONVERSIONS / this->sensors_.size() + 1);
+  }
+
+  err = adc_continuous_start(this->handle_);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Error starting conversions: %d", err);
+    this->mark_failed();
+    return;
+  }
+}
+
+void ADCContinuous::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "ADC Continuous:\n"
+                "  Sample rate: %" PRIu32 " Hz per channel\n"
+                "  Channels:    %u",
+                this->sample_rate_, static_cast<unsigned>(this->sensors_.size()));
+  if (this->is_failed()) {
+    ESP_LOGE(TAG, "  Setup failed");
+  }
+}
+
+bool IRAM_ATTR ADCContinuous::on_pool_overflow_(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata,
+                                                void *user_data) {
+  auto *engine = static_cast<ADCContinuous *>(user_data);
+  engine->overflows_ = engine->overflows_ + 1;
+  // No higher priority task was woken
+  return false;
+}
+
+void ADCContinuous::loop() {
+  const uint32_t overflows = this->overflows_;
+  if (overflows != this->reported_overflows_) {
+    ESP_LOGW(TAG, "Dropped %" PRIu32 " frames of samples, the main loop was blocked for too long",
+             overflows - this->reported_overflows_);
+    this->reported_overflows_ = overflows;
+  }
+
+  // Drain what the DMA collected since the last loop without waiting for more
+  uint32_t length = 0;
+  while (adc_continuous_read(this->handle_, this->frame_.get(), FRAME_SIZE, &length, 0) == ESP_OK) {
+    for (auto &block : this->blocks_) {
+      block.clear();
+    }
+    for (uint32_t offset = 0; offset + SOC_ADC_DIGI_RESULT_BYTES <= length; offset += SOC_ADC_DIGI_RESULT_BYTES) {
+      const auto *result = reinterpret_cast<const adc_digi_output_data_t *>(&this->frame_[offset]);
+#if USE_ESP32_VARIANT_ESP32 || USE_ESP32_VARIANT_ESP32S2
+      const uint32_t channel = result->type1.channel;
+      const uint32_t raw = result->type1.data;
+#else
+      const uint32_t channel = result->type2.channel;
+      const uint32_t raw = result->type2.data;
+#endif  // USE_ESP32_VARIANT_ESP32 || USE_ESP32_VARIANT_ESP32S2
+      if (channel >= SOC_ADC_MAX_CHANNEL_NUM || this->channel_sensor_[channel] < 0) {
+        continue;
+      }
+      this->blocks_[this->channel_sensor_[channel]].push_back(raw);
+    }
+    for (size_t i = 0; i < this->sensors_.size(); i++) {
+      if (!this->blocks_[i].empty()) {
+        this->sensors_[i]->process_raw_block(this->blocks_[i].data(), this->blocks_[i].size());
+      }
+    }
+  }
+}
+
+}  // namespace adc
+}  // namespace esphome
+
+#endif  // USE_ESP32
@@ -5,6 +5,9 @@
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+
+#include <vector>
 
 #ifdef USE_ESP32
 #include "esp_adc/adc_cali.h"
@@ -38,14 +41,20 @@ enum class SamplingMode : uint8_t {
 
 const LogString *sampling_mode_to_str(SamplingMode mode);
 
+#ifdef USE_ESP32
+class ADCContinuous;
+#endif  // USE_ESP32
+
 class Aggregator {
  public:
   Aggregator(SamplingMode mode);
   void add_sample(uint32_t value);
   uint32_t aggregate();
+  uint32_t get_sample_count() const { return this->samples_; }
 
  protected:
-  uint32_t aggr_{0};
+  // 64 bits so the sum of a continuous mode update interval can't overflow
+  uint64_t aggr_{0};
   uint32_t samples_{0};
   SamplingMode mode_{SamplingMode::AVG};
 };
@@ -117,6 +126,24 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   /// Autoranging automatically adjusts the attenuation level to handle a wide range of input voltages.
   /// @param autorange Boolean indicating whether to enable autoranging.
   void set_autorange(bool autorange) { this->autorange_ = autorange; }
+
+  /// Sample in the background with the shared continuous mode (DMA) engine instead of doing oneshot reads.
+  /// update() then aggregates all samples taken since the previous update with the sampling mode.
+  /// @param continuous The engine that owns the ADC unit.
+  void set_continuous(ADCContinuous *continuous) { this->continuous_ = continuous; }
+
+  adc_unit_t get_adc_unit() const { return this->adc_unit_; }
+  adc_channel_t get_channel() const { return this->channel_; }
+  adc_atten_t get_attenuation() const { return this->attenuation_; }
+
+  /// The per channel sample rate of the continuous engine, or 0 when doing oneshot reads.
+  uint32_t get_sample_rate() const override;
+  void add_on_samples_callback(std::function<void(const float *, size_t)> &&callback) override {
+    this->samples_callback_.add(std::move(callback));
+  }
+
+  /// Called by the continuous engine from the main loop with the new raw readings of this channel.
+  void process_raw_block(const uint16_t *raw, size_t count);
 #endif  // USE_ESP32
 
 #ifdef USE_RP2040
@@ -132,6 +159,10 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
 #ifdef USE_ESP32
   float sample_autorange_();
   float sample_fixed_attenuation_();
+  float sample_continuous_();
+  bool setup_oneshot_();
+  /// Apply raw output or calibration to a raw reading.
+  float raw_to_voltage_(uint32_t raw);
   bool autorange_{false};
   adc_oneshot_unit_handle_t adc_handle_{nullptr};
   adc_cali_handle_t calibration_handle_{nullptr};
@@ -146,6 +177,13 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
     uint8_t reserved : 4;
   } setup_flags_{};
   static adc_oneshot_unit_handle_t shared_adc_handles[2];
+
+  ADCContinuous *continuous_{nullptr};
+  /// Samples from the continuous engine since the last update
+  Aggregator continuous_aggr_{SamplingMode::AVG};
+  CallbackManager<void(const float *, size_t)> samples_callback_;
+  /// The last raw block converted to V for the samples callbacks, kept to reuse its allocation
+  std::vector<float> block_;
 #endif  // USE_ESP32
 
 #ifdef USE_RP2040
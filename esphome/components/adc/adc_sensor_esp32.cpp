@@ -1,8 +1,11 @@
 #ifdef USE_ESP32
 
 #include "adc_sensor.h"
+#include "adc_continuous.h"
 #include "esphome/core/log.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace adc {
 
@@ -36,8 +39,7 @@ const LogString *adc_unit_to_str(adc_unit_t unit) {
   }
 }
 
-void ADCSensor::setup() {
-  ESP_LOGCONFIG(TAG, "Running setup for '%s'", this->get_name().c_str());
+bool ADCSensor::setup_oneshot_() {
   // Check if another sensor already initialized this ADC unit
   if (ADCSensor::shared_adc_handles[this->adc_unit_] == nullptr) {
     adc_oneshot_unit_init_cfg_t init_config = {};  // Zero initialize
@@ -50,8 +52,7 @@ void ADCSensor::setup() {
     esp_err_t err = adc_oneshot_new_unit(&init_config, &ADCSensor::shared_adc_handles[this->adc_unit_]);
     if (err != ESP_OK) {
       ESP_LOGE(TAG, "Error initializing %s: %d", LOG_STR_ARG(adc_unit_to_str(this->adc_unit_)), err);
-      this->mark_failed();
-      return;
+      return false;
     }
   }
   this->adc_handle_ = ADCSensor::shared_adc_handles[this->adc_unit_];
@@ -65,10 +66,23 @@ void ADCSensor::setup() {
   esp_err_t err = adc_oneshot_config_channel(this->adc_handle_, this->channel_, &config);
   if (err != ESP_OK) {
     ESP_LOGE(TAG, "Error configuring channel: %d", err);
+    return false;
+  }
+  this->setup_flags_.config_complete = true;
+  return true;
+}
+
+void ADCSensor::setup() {
+  ESP_LOGCONFIG(TAG, "Running setup for '%s'", this->get_name().c_str());
+  if (this->continuous_ != nullptr) {
+    // The continuous engine owns the ADC unit and configures the channel, only the calibration is set up here
+    this->continuous_aggr_ = Aggregator(this->sampling_mode_);
+    this->setup_flags_.handle_init_complete = true;
+    this->setup_flags_.config_complete = true;
+  } else if (!this->setup_oneshot_()) {
     this->mark_failed();
     return;
   }
-  this->setup_flags_.config_complete = true;
 
   // Initialize ADC calibration
   if (this->calibration_handle_ == nullptr) {
@@ -142,11 +156,17 @@ void ADCSensor::dump_config() {
       this->setup_flags_.handle_init_complete ? "OK" : "FAILED", this->setup_flags_.config_complete ? "OK" : "FAILED",
       this->setup_flags_.calibration_complete ? "OK" : "FAILED", this->setup_flags_.init_complete ? "OK" : "FAILED");
 
+  if (this->continuous_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Continuous:    %" PRIu32 " Hz", this->continuous_->get_sample_rate());
+  }
+
   LOG_UPDATE_INTERVAL(this);
 }
 
 float ADCSensor::sample() {
-  if (this->autorange_) {
+  if (this->continuous_ != nullptr) {
+    return this->sample_continuous_();
+  } else if (this->autorange_) {
     return this->sample_autorange_();
   } else {
     return this->sample_fixed_attenuation_();
@@ -173,15 +193,17 @@ float ADCSensor::sample_fixed_attenuation_() {
     aggr.add_sample(raw);
   }
 
-  uint32_t final_value = aggr.aggregate();
+  return this->raw_to_voltage_(aggr.aggregate());
+}
 
+float ADCSensor::raw_to_voltage_(uint32_t raw) {
   if (this->output_raw_) {
-    return final_value;
+    return raw;
   }
 
   if (this->calibration_handle_ != nullptr) {
     int voltage_mv;
-    esp_err_t err = adc_cali_raw_to_voltage(this->calibration_handle_, final_value, &voltage_mv);
+    esp_err_t err = adc_cali_raw_to_voltage(this->calibration_handle_, raw, &voltage_mv);
     if (err == ESP_OK) {
       return voltage_mv / 1000.0f;
     } else {
@@ -198,7 +220,35 @@ float ADCSensor::sample_fixed_attenuation_() {
     }
   }
 
-  return final_value * 3.3f / 4095.0f;
+  return raw * 3.3f / 4095.0f;
+}
+
+float ADCSensor::sample_continuous_() {
+  if (this->continuous_aggr_.get_sample_count() == 0) {
+    // The engine failed or hasn't delivered a block yet
+    return NAN;
+  }
+  uint32_t raw = this->continuous_aggr_.aggregate();
+  this->continuous_aggr_ = Aggregator(this->sampling_mode_);
+  return this->raw_to_voltage_(raw);
+}
+
+uint32_t ADCSensor::get_sample_rate() const {
+  return this->continuous_ != nullptr ? this->continuous_->get_sample_rate() : 0;
+}
+
+void ADCSensor::process_raw_block(const uint16_t *raw, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    this->continuous_aggr_.add_sample(raw[i]);
+  }
+  if (this->samples_callback_.size() == 0) {
+    return;
+  }
+  this->block_.resize(count);
+  for (size_t i = 0; i < count; i++) {
+    this->block_[i] = this->raw_to_voltage_(raw[i]);
+  }
+  this->samples_callback_.call(this->block_.data(), count);
 }
 
 float ADCSensor::sample_autorange_() {
@@ -3,18 +3,23 @@ import logging
 import esphome.codegen as cg
 from esphome.components import sensor, voltage_sampler
 from esphome.components.esp32 import get_esp32_variant
+from esphome.components.esp32.const import VARIANT_ESP32
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_ATTENUATION,
+    CONF_CONTINUOUS,
     CONF_ID,
     CONF_NUMBER,
     CONF_PIN,
+    CONF_PLATFORM,
     CONF_RAW,
+    CONF_SAMPLE_RATE,
     DEVICE_CLASS_VOLTAGE,
     STATE_CLASS_MEASUREMENT,
     UNIT_VOLT,
 )
-from esphome.core import CORE
+from esphome.core import CORE, ID
+import esphome.final_validate as fv
 
 from . import (
     ATTENUATION_MODES,
@@ -53,12 +58,118 @@ def validate_config(config):
         # Alter value here so `config` command prints the recommended change
         config[CONF_ATTENUATION] = _attenuation("12db")
 
+    if CONF_CONTINUOUS in config:
+        if config.get(CONF_ATTENUATION) == "auto":
+            raise cv.Invalid("Automatic attenuation cannot be used in continuous mode")
+        if config[CONF_SAMPLES] > 1:
+            raise cv.Invalid(
+                "samples cannot be used in continuous mode, every update aggregates "
+                "all samples taken since the previous one"
+            )
+
+    return config
+
+
+def _adc_unit_and_channel(pin_num):
+    variant = get_esp32_variant()
+    if pin_num in ESP32_VARIANT_ADC1_PIN_TO_CHANNEL.get(variant, {}):
+        chan = ESP32_VARIANT_ADC1_PIN_TO_CHANNEL[variant][pin_num]
+        return adc_unit_t.ADC_UNIT_1, chan
+    if pin_num in ESP32_VARIANT_ADC2_PIN_TO_CHANNEL.get(variant, {}):
+        chan = ESP32_VARIANT_ADC2_PIN_TO_CHANNEL[variant][pin_num]
+        return adc_unit_t.ADC_UNIT_2, chan
+    return None, None
+
+
+def _final_validate(config):
+    if CONF_CONTINUOUS not in config:
+        return config
+    full_config = fv.full_config.get()
+    adc_sensors = [
+        conf
+        for conf in full_config.get("sensor", [])
+        if conf[CONF_PLATFORM] == "adc" and isinstance(conf[CONF_PIN], dict)
+    ]
+    continuous = [conf for conf in adc_sensors if CONF_CONTINUOUS in conf]
+    pin_num = config[CONF_PIN][CONF_NUMBER]
+
+    # The classic ESP32 samples continuously through I2S0, which i2s_audio hands out
+    # to its first instance
+    if get_esp32_variant() == VARIANT_ESP32 and full_config.get("i2s_audio"):
+        raise cv.Invalid(
+            "Continuous mode on the ESP32 uses the I2S0 peripheral, it cannot be "
+            "used together with i2s_audio",
+            path=[CONF_CONTINUOUS],
+        )
+    if _adc_unit_and_channel(pin_num)[0] != adc_unit_t.ADC_UNIT_1:
+        raise cv.Invalid(
+            "Continuous mode is only supported on ADC1 pins", path=[CONF_PIN]
+        )
+    for conf in adc_sensors:
+        if CONF_CONTINUOUS not in conf and (
+            _adc_unit_and_channel(conf[CONF_PIN][CONF_NUMBER])[0]
+            == adc_unit_t.ADC_UNIT_1
+        ):
+            raise cv.Invalid(
+                "ADC1 is sampled in continuous mode, so all ADC1 sensors must use "
+                "continuous mode"
+            )
+    if len({conf[CONF_CONTINUOUS][CONF_SAMPLE_RATE] for conf in continuous}) > 1:
+        raise cv.Invalid(
+            "All continuous mode sensors share one ADC and must use the same "
+            "sample_rate",
+            path=[CONF_CONTINUOUS, CONF_SAMPLE_RATE],
+        )
+    pins = [conf[CONF_PIN][CONF_NUMBER] for conf in continuous]
+    if pins.count(pin_num) > 1:
+        raise cv.Invalid(
+            "Only one continuous mode sensor can use a pin", path=[CONF_PIN]
+        )
+
+    # The channels take turns, the ADC converts at the sum of their rates
+    rate = config[CONF_CONTINUOUS][CONF_SAMPLE_RATE] * len(continuous)
+    if get_esp32_variant() == VARIANT_ESP32:
+        low, high = 20000, 2000000
+    else:
+        low, high = 611, 83333
+    if not low <= rate <= high:
+        raise cv.Invalid(
+            f"The ADC converts {len(continuous)} channel(s) at {rate} Hz in total, "
+            f"it supports {low}-{high} Hz",
+            path=[CONF_CONTINUOUS, CONF_SAMPLE_RATE],
+        )
     return config
 
 
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
 ADCSensor = adc_ns.class_(
     "ADCSensor", sensor.Sensor, cg.PollingComponent, voltage_sampler.VoltageSampler
 )
+ADCContinuous = adc_ns.class_("ADCContinuous", cg.Component)
+
+KEY_ADC_CONTINUOUS = "adc_continuous"
+
+CONTINUOUS_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_SAMPLE_RATE, default="20kHz"): cv.All(
+            cv.frequency, cv.int_range(min=1, max=2000000)
+        ),
+    }
+)
+
+
+async def get_continuous_engine(sample_rate):
+    """Return the engine that samples all continuous mode sensors."""
+    if (engine := CORE.data.get(KEY_ADC_CONTINUOUS)) is None:
+        engine = cg.new_Pvariable(
+            ID(KEY_ADC_CONTINUOUS, is_declaration=True, type=ADCContinuous),
+            sample_rate,
+        )
+        CORE.data[KEY_ADC_CONTINUOUS] = engine
+        await cg.register_component(engine, {})
+    return engine
 
 CONFIG_SCHEMA = cv.All(
     sensor.sensor_schema(
@@ -77,6 +188,7 @@ CONFIG_SCHEMA = cv.All(
             ),
             cv.Optional(CONF_SAMPLES, default=1): cv.int_range(min=1, max=255),
             cv.Optional(CONF_SAMPLING_MODE, default="avg"): _sampling_mode,
+            cv.Optional(CONF_CONTINUOUS): cv.All(cv.only_on_esp32, CONTINUOUS_SCHEMA),
         }
     )
     .extend(cv.polling_component_schema("60s")),
@@ -108,17 +220,11 @@ async def to_code(config):
             else:
                 cg.add(var.set_attenuation(attenuation))
 
-        variant = get_esp32_variant()
-        pin_num = config[CONF_PIN][CONF_NUMBER]
-        if (
-            variant in ESP32_VARIANT_ADC1_PIN_TO_CHANNEL
-            and pin_num in ESP32_VARIANT_ADC1_PIN_TO_CHANNEL[variant]
-        ):
-            chan = ESP32_VARIANT_ADC1_PIN_TO_CHANNEL[variant][pin_num]
-            cg.add(var.set_channel(adc_unit_t.ADC_UNIT_1, chan))
-        elif (
-            variant in ESP32_VARIANT_ADC2_PIN_TO_CHANNEL
-            and pin_num in ESP32_VARIANT_ADC2_PIN_TO_CHANNEL[variant]
-        ):
-            chan = ESP32_VARIANT_ADC2_PIN_TO_CHANNEL[variant][pin_num]
-            cg.add(var.set_channel(adc_unit_t.ADC_UNIT_2, chan))
+        unit, chan = _adc_unit_and_channel(config[CONF_PIN][CONF_NUMBER])
+        if unit is not None:
+            cg.add(var.set_channel(unit, chan))
+
+        if continuous := config.get(CONF_CONTINUOUS):
+            engine = await get_continuous_engine(continuous[CONF_SAMPLE_RATE])
+            cg.add(engine.add_sensor(var))
+            cg.add(var.set_continuous(engine))
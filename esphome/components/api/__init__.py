@@ -25,6 +25,7 @@ from esphome.const import (
     CONF_VARIABLES,
 )
 from esphome.core import CORE, coroutine_with_priority
+import esphome.final_validate as fv
 
 DOMAIN = "api"
 DEPENDENCIES = ["network"]
@@ -52,7 +53,11 @@ SERVICE_ARG_NATIVE_TYPES = {
 }
 CONF_ENCRYPTION = "encryption"
 CONF_BATCH_DELAY = "batch_delay"
+CONF_ADAPTIVE_BATCH_DELAY = "adaptive_batch_delay"
+CONF_MIN_DELAY = "min_delay"
+CONF_MAX_DELAY = "max_delay"
 CONF_CUSTOM_SERVICES = "custom_services"
+CONF_DEFERRED_LOG_FORMATTING = "deferred_log_formatting"
 
 
 def validate_encryption_key(value):
@@ -93,6 +98,28 @@ ENCRYPTION_SCHEMA = cv.Schema(
 )
 
 
+def _validate_adaptive_batch_delay(config):
+    if config[CONF_MIN_DELAY] > config[CONF_MAX_DELAY]:
+        raise cv.Invalid(f"{CONF_MIN_DELAY} must not be larger than {CONF_MAX_DELAY}")
+    return config
+
+
+BATCH_DELAY_RANGE = cv.All(
+    cv.positive_time_period_milliseconds,
+    cv.Range(max=cv.TimePeriod(milliseconds=65535)),
+)
+
+ADAPTIVE_BATCH_DELAY_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_MIN_DELAY, default="0ms"): BATCH_DELAY_RANGE,
+            cv.Optional(CONF_MAX_DELAY, default="500ms"): BATCH_DELAY_RANGE,
+        }
+    ),
+    _validate_adaptive_batch_delay,
+)
+
+
 def _encryption_schema(config):
     if config is None:
         config = {}
@@ -113,11 +140,10 @@ CONFIG_SCHEMA = cv.All(
             ): ACTIONS_SCHEMA,
             cv.Exclusive(CONF_ACTIONS, group_of_exclusion=CONF_ACTIONS): ACTIONS_SCHEMA,
             cv.Optional(CONF_ENCRYPTION): _encryption_schema,
-            cv.Optional(CONF_BATCH_DELAY, default="100ms"): cv.All(
-                cv.positive_time_period_milliseconds,
-                cv.Range(max=cv.TimePeriod(milliseconds=65535)),
-            ),
+            cv.Optional(CONF_BATCH_DELAY, default="100ms"): BATCH_DELAY_RANGE,
+            cv.Optional(CONF_ADAPTIVE_BATCH_DELAY): ADAPTIVE_BATCH_DELAY_SCHEMA,
             cv.Optional(CONF_CUSTOM_SERVICES, default=False): cv.boolean,
+            cv.Optional(CONF_DEFERRED_LOG_FORMATTING, default=False): cv.boolean,
             cv.Optional(CONF_ON_CLIENT_CONNECTED): automation.validate_automation(
                 single=True
             ),
@@ -130,6 +156,18 @@ CONFIG_SCHEMA = cv.All(
 )
 
 
+def _final_validate(config):
+    if config[CONF_DEFERRED_LOG_FORMATTING] and "logger" not in fv.full_config.get():
+        raise cv.Invalid(
+            f"'{CONF_DEFERRED_LOG_FORMATTING}' requires the logger component",
+            path=[CONF_DEFERRED_LOG_FORMATTING],
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
 @coroutine_with_priority(40.0)
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
@@ -141,6 +179,17 @@ async def to_code(config):
         cg.add(var.set_password(config[CONF_PASSWORD]))
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
     cg.add(var.set_batch_delay(config[CONF_BATCH_DELAY]))
+    if adaptive_config := config.get(CONF_ADAPTIVE_BATCH_DELAY):
+        cg.add_define("USE_API_ADAPTIVE_BATCH_DELAY")
+        cg.add(
+            var.set_adaptive_batch_delay(
+                adaptive_config[CONF_MIN_DELAY], adaptive_config[CONF_MAX_DELAY]
+            )
+        )
+
+    if config[CONF_DEFERRED_LOG_FORMATTING]:
+        cg.add_define("USE_API_BINARY_LOGS")
+        cg.add_define("USE_LOGGER_RAW_LOGS")
 
     # Set USE_API_SERVICES if any services are enabled
     if config.get(CONF_ACTIONS) or config[CONF_CUSTOM_SERVICES]:
@@ -17,6 +17,9 @@
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 #include "esphome/core/version.h"
+#ifdef USE_RUNTIME_STATS_TRACE
+#include "esphome/components/runtime_stats/trace_buffer.h"
+#endif
 
 #ifdef USE_DEEP_SLEEP
 #include "esphome/components/deep_sleep/deep_sleep_component.h"
@@ -30,6 +33,9 @@
 #ifdef USE_VOICE_ASSISTANT
 #include "esphome/components/voice_assistant/voice_assistant.h"
 #endif
+#if defined(USE_API_BINARY_LOGS) || defined(USE_LOGGER_PERSISTENT_LOG)
+#include "esphome/components/logger/logger.h"
+#endif
 
 namespace esphome {
 namespace api {
@@ -42,6 +48,10 @@ static constexpr uint8_t MAX_MESSAGES_PER_LOOP = 5;
 static constexpr uint8_t MAX_PING_RETRIES = 60;
 static constexpr uint16_t PING_RETRY_INTERVAL = 1000;
 static constexpr uint32_t KEEPALIVE_DISCONNECT_TIMEOUT = (KEEPALIVE_TIMEOUT_MS * 5) / 2;
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+// Smallest delay the adaptive batch delay grows to from zero when the link backs up
+static constexpr uint16_t ADAPTIVE_BATCH_DELAY_STEP_MS = 10;
+#endif
 
 static const char *const TAG = "api.connection";
 #ifdef USE_CAMERA
@@ -103,9 +113,97 @@ APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *pa
     this->image_reader_ = std::unique_ptr<camera::CameraImageReader>{camera::Camera::instance()->create_image_reader()};
   }
 #endif
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  this->batch_delay_ = clamp(parent->get_batch_delay(), parent->get_batch_delay_min(), parent->get_batch_delay_max());
+#endif
 }
 
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+uint32_t APIConnection::get_batch_delay_ms_() const {
+  // The server drops its batch delay to flush quickly on shutdown
+  if (this->parent_->is_shutting_down())
+    return this->parent_->get_batch_delay();
+  return this->batch_delay_;
+}
+
+void APIConnection::update_batch_delay_() {
+  uint16_t delay_ms = this->batch_delay_;
+  if (!this->helper_->can_write_without_blocking()) {
+    // The socket is backed up, wait longer so the next batch packs more messages into fewer frames
+    delay_ms = std::min<uint32_t>(this->parent_->get_batch_delay_max(),
+                                   std::max<uint32_t>(delay_ms * 2u, ADAPTIVE_BATCH_DELAY_STEP_MS));
+  } else {
+    // The link kept up, back off towards the minimum for lower latency
+    delay_ms = std::max<uint16_t>(this->parent_->get_batch_delay_min(), delay_ms / 2);
+  }
+  if (delay_ms != this->batch_delay_) {
+    ESP_LOGV(TAG, "%s: Batch delay %u -> %u ms", this->get_client_combined_info().c_str(), this->batch_delay_,
+             delay_ms);
+    this->batch_delay_ = delay_ms;
+  }
+}
+#else
 uint32_t APIConnection::get_batch_delay_ms_() const { return this->parent_->get_batch_delay(); }
+#endif
+
+void APIConnection::set_state_filter_(const std::vector<uint32_t> &keys, uint32_t min_interval) {
+  this->state_filter_.clear();
+  this->state_filter_.reserve(keys.size());
+  // Backdate so the first update of every entity goes out right away
+  const uint32_t last_sent = App.get_loop_component_start_time() - min_interval;
+  for (uint32_t key : keys)
+    this->state_filter_.push_back({key, last_sent, nullptr, nullptr, 0, 0});
+  // Throttling needs a key to track, without an allowlist every update is sent
+  this->state_min_interval_ = keys.empty() ? 0 : min_interval;
+  if (!keys.empty()) {
+    ESP_LOGD(TAG, "%s: Subscribed to %u entities, min interval %" PRIu32 " ms",
+             this->get_client_combined_info().c_str(), static_cast<unsigned>(keys.size()), this->state_min_interval_);
+  }
+}
+
+APIConnection::StateFilterEntry *APIConnection::find_state_filter_(EntityBase *entity) {
+  const uint32_t key = entity->get_object_id_hash();
+  for (auto &entry : this->state_filter_) {
+    if (entry.key == key)
+      return &entry;
+  }
+  return nullptr;
+}
+
+bool APIConnection::filter_state_(EntityBase *entity, MessageCreatorPtr creator, uint8_t message_type,
+                                  uint8_t estimated_size) {
+  StateFilterEntry *entry = this->find_state_filter_(entity);
+  if (entry == nullptr)
+    return false;
+  if (this->state_min_interval_ == 0)
+    return true;
+
+  const uint32_t now = App.get_loop_component_start_time();
+  if (now - entry->last_sent >= this->state_min_interval_) {
+    entry->last_sent = now;
+    entry->pending_creator = nullptr;
+    return true;
+  }
+  // Too soon, keep only the latest update. The creator reads the entity state when encoding,
+  // so the value sent later is the current one.
+  entry->pending_entity = entity;
+  entry->pending_creator = creator;
+  entry->pending_message_type = message_type;
+  entry->pending_estimated_size = estimated_size;
+  return false;
+}
+
+void APIConnection::send_pending_states_(uint32_t now) {
+  for (auto &entry : this->state_filter_) {
+    if (entry.pending_creator == nullptr || now - entry.last_sent < this->state_min_interval_)
+      continue;
+    if (!this->schedule_message_(entry.pending_entity, entry.pending_creator, entry.pending_message_type,
+                                 entry.pending_estimated_size, state_message_lane_(entry.pending_message_type)))
+      return;
+    entry.last_sent = now;
+    entry.pending_creator = nullptr;
+  }
+}
 
 void APIConnection::start() {
   this->last_traffic_ = App.get_loop_component_start_time();
@@ -122,6 +220,10 @@ void APIConnection::start() {
 }
 
 APIConnection::~APIConnection() {
+#ifdef USE_API_BINARY_LOGS
+  if (this->flags_.formatted_logs_requested)
+    logger::global_logger->release_formatted_logs();
+#endif
 #ifdef USE_BLUETOOTH_PROXY
   if (bluetooth_proxy::global_bluetooth_proxy->get_api_connection() == this) {
     bluetooth_proxy::global_bluetooth_proxy->unsubscribe_api_connection(this);
@@ -179,6 +281,14 @@ void APIConnection::loop() {
     }
   }
 
+  if (this->state_min_interval_ != 0)
+    this->send_pending_states_(now);
+
+#ifdef USE_LOGGER_PERSISTENT_LOG
+  if (this->previous_log_pos_ != nullptr)
+    this->send_previous_log_();
+#endif
+
   // Process deferred batch if scheduled and timer has expired
   if (this->flags_.batch_scheduled && now - this->deferred_batch_.batch_start_time >= this->get_batch_delay_ms_()) {
     this->process_batch_();
@@ -222,25 +332,8 @@ void APIConnection::loop() {
   }
 
 #ifdef USE_CAMERA
-  if (this->image_reader_ && this->image_reader_->available() && this->helper_->can_write_without_blocking()) {
-    uint32_t to_send = std::min((size_t) MAX_BATCH_PACKET_SIZE, this->image_reader_->available());
-    bool done = this->image_reader_->available() == to_send;
-
-    CameraImageResponse msg;
-    msg.key = camera::Camera::instance()->get_object_id_hash();
-    msg.set_data(this->image_reader_->peek_data_buffer(), to_send);
-    msg.done = done;
-#ifdef USE_DEVICES
-    msg.device_id = camera::Camera::instance()->get_device_id();
-#endif
-
-    if (this->send_message_(msg, CameraImageResponse::MESSAGE_TYPE)) {
-      this->image_reader_->consume_data(to_send);
-      if (done) {
-        this->image_reader_->return_image();
-      }
-    }
-  }
+  if (this->image_reader_ && this->image_reader_->available() && this->helper_->can_write_without_blocking())
+    this->send_camera_chunk_();
 #endif
 
   if (state_subs_at_ >= 0) {
@@ -249,9 +342,8 @@ void APIConnection::loop() {
       auto &it = subs[state_subs_at_];
       SubscribeHomeAssistantStateResponse resp;
       resp.set_entity_id(StringRef(it.entity_id));
-      // attribute.value() returns temporary - must store it
-      std::string attribute_value = it.attribute.value();
-      resp.set_attribute(StringRef(attribute_value));
+      // An unset attribute holds an empty string
+      resp.set_attribute(StringRef(it.attribute.value()));
       resp.once = it.once;
       if (this->send_message(resp, SubscribeHomeAssistantStateResponse::MESSAGE_TYPE)) {
         state_subs_at_++;
@@ -326,6 +418,42 @@ uint16_t APIConnection::encode_message_to_buffer(ProtoMessage &msg, uint8_t mess
   return static_cast<uint16_t>(actual_total_size);
 }
 
+uint16_t APIConnection::encode_state_to_buffer(EntityBase *entity, ProtoMessage &msg, uint8_t message_type,
+                                               APIConnection *conn, uint32_t remaining_size, bool is_single) {
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  if (conn->flags_.log_only_mode)
+    return encode_message_to_buffer(msg, message_type, conn, remaining_size, is_single);
+#endif
+  std::vector<uint8_t> *cached = conn->parent_->get_state_encode_cache().find(entity);
+  if (cached == nullptr)
+    return encode_message_to_buffer(msg, message_type, conn, remaining_size, is_single);
+
+  std::vector<uint8_t> &shared_buf = conn->parent_->get_shared_buffer_ref();
+  const uint8_t header_padding = conn->helper_->frame_header_padding();
+  const uint8_t footer_size = conn->helper_->frame_footer_size();
+
+  if (cached->empty()) {
+    // First connection to send this state, keep the payload for the others
+    uint16_t total_size = encode_message_to_buffer(msg, message_type, conn, remaining_size, is_single);
+    if (total_size != 0) {
+      size_t payload_size = total_size - header_padding - footer_size;
+      cached->assign(shared_buf.end() - payload_size, shared_buf.end());
+    }
+    return total_size;
+  }
+
+  size_t total_size = cached->size() + header_padding + footer_size;
+  if (total_size > remaining_size)
+    return 0;  // Doesn't fit
+  if (is_single) {
+    conn->allocate_single_message_buffer(cached->size());
+  } else {
+    conn->allocate_batch_message_buffer(cached->size());
+  }
+  shared_buf.insert(shared_buf.end(), cached->begin(), cached->end());
+  return static_cast<uint16_t>(total_size);
+}
+
 #ifdef USE_BINARY_SENSOR
 bool APIConnection::send_binary_sensor_state(binary_sensor::BinarySensor *binary_sensor) {
   return this->send_message_smart_(binary_sensor, &APIConnection::try_send_binary_sensor_state,
@@ -684,12 +812,10 @@ uint16_t APIConnection::try_send_climate_info(EntityBase *entity, APIConnection
   msg.supports_action = traits.get_supports_action();
   for (auto fan_mode : traits.get_supported_fan_modes())
     msg.supported_fan_modes.push_back(static_cast<enums::ClimateFanMode>(fan_mode));
-  for (auto const &custom_fan_mode : traits.get_supported_custom_fan_modes())
-    msg.supported_custom_fan_modes.push_back(custom_fan_mode);
+  msg.supported_custom_fan_modes = &traits.get_supported_custom_fan_modes();
   for (auto preset : traits.get_supported_presets())
     msg.supported_presets.push_back(static_cast<enums::ClimatePreset>(preset));
-  for (auto const &custom_preset : traits.get_supported_custom_presets())
-    msg.supported_custom_presets.push_back(custom_preset);
+  msg.supported_custom_presets = &traits.get_supported_custom_presets();
   for (auto swing_mode : traits.get_supported_swing_modes())
     msg.supported_swing_modes.push_back(static_cast<enums::ClimateSwingMode>(swing_mode));
   return fill_and_encode_entity_info(climate, msg, ListEntitiesClimateResponse::MESSAGE_TYPE, conn, remaining_size,
@@ -897,8 +1023,7 @@ uint16_t APIConnection::try_send_select_info(EntityBase *entity, APIConnection *
                                              bool is_single) {
   auto *select = static_cast<select::Select *>(entity);
   ListEntitiesSelectResponse msg;
-  for (const auto &option : select->traits.get_options())
-    msg.options.push_back(option);
+  msg.options = &select->traits.get_options();
   return fill_and_encode_entity_info(select, msg, ListEntitiesSelectResponse::MESSAGE_TYPE, conn, remaining_size,
                                      is_single);
 }
@@ -1060,10 +1185,57 @@ void APIConnection::set_camera_state(std::shared_ptr<camera::CameraImage> image)
     return;
   if (!this->image_reader_)
     return;
-  if (this->image_reader_->available())
+  if (!image->was_requested_by(esphome::camera::API_REQUESTER) && !image->was_requested_by(esphome::camera::IDLE))
+    return;
+  // One frame in flight: while the previous frame is still being sent or the socket has a backlog, skip this frame
+  // as a whole instead of queueing it behind the slow link
+  if (this->image_reader_->available() || !this->helper_->can_write_without_blocking()) {
+    this->camera_stats_.frames_dropped++;
+    return;
+  }
+  this->image_reader_->set_image(std::move(image));
+  this->camera_stats_.frame_start = millis();
+  this->camera_stats_.frame_bytes = 0;
+}
+void APIConnection::send_camera_chunk_() {
+  auto *camera = camera::Camera::instance();
+  uint16_t to_send = std::min((size_t) MAX_BATCH_PACKET_SIZE, this->image_reader_->available());
+  bool done = this->image_reader_->available() == to_send;
+
+  // Encode the CameraImageResponse fields by hand with the data field last, field order doesn't matter to the
+  // decoder. The frame helper then sends the data from the frame buffer without copying it.
+  ProtoWriteBuffer buffer = this->create_buffer(16 + to_send);
+  buffer.encode_fixed32(1, camera->get_object_id_hash());
+  buffer.encode_bool(3, done);
+#ifdef USE_DEVICES
+  buffer.encode_uint32(4, camera->get_device_id());
+#endif
+  buffer.encode_field_raw(2, 2);  // type 2 = length-delimited
+  buffer.encode_varint_raw(to_send);
+
+  APIError err = this->helper_->write_protobuf_packet_with_data(CameraImageResponse::MESSAGE_TYPE, buffer,
+                                                                this->image_reader_->peek_data_buffer(), to_send);
+  if (err == APIError::WOULD_BLOCK)
+    return;
+  if (err != APIError::OK) {
+    on_fatal_error();
+    ESP_LOGW(TAG, "%s: Packet write failed %s errno=%d", this->get_client_combined_info().c_str(),
+             api_error_to_str(err), errno);
+    return;
+  }
+
+  this->image_reader_->consume_data(to_send);
+  this->camera_stats_.frame_bytes += to_send;
+  if (!done)
     return;
-  if (image->was_requested_by(esphome::camera::API_REQUESTER) || image->was_requested_by(esphome::camera::IDLE))
-    this->image_reader_->set_image(std::move(image));
+  this->image_reader_->return_image();
+  auto &stats = this->camera_stats_;
+  stats.frames_sent++;
+  const uint32_t elapsed = millis() - stats.frame_start;
+  ESP_LOGV(TAG, "%s: Camera frame of %" PRIu32 " B sent in %" PRIu32 " ms (%" PRIu32 " kB/s), %" PRIu32
+           " sent, %" PRIu32 " dropped",
+           this->get_client_combined_info().c_str(), stats.frame_bytes, elapsed,
+           elapsed == 0 ? 0 : stats.frame_bytes / elapsed, stats.frames_sent, stats.frames_dropped);
 }
 uint16_t APIConnection::try_send_camera_info(EntityBase *entity, APIConnection *conn, uint32_t remaining_size,
                                              bool is_single) {
@@ -1166,12 +1338,12 @@ void APIConnection::on_voice_assistant_response(const VoiceAssistantResponse &ms
   }
   if (msg.port == 0) {
     // Use API Audio
-    voice_assistant::global_voice_assistant->start_streaming();
+    voice_assistant::global_voice_assistant->start_streaming(msg.audio_codec);
   } else {
     struct sockaddr_storage storage;
     socklen_t len = sizeof(storage);
     this->helper_->getpeername((struct sockaddr *) &storage, &len);
-    voice_assistant::global_voice_assistant->start_streaming(&storage, msg.port);
+    voice_assistant::global_voice_assistant->start_streaming(&storage, msg.port, msg.audio_codec);
   }
 };
 void APIConnection::on_voice_assistant_event_response(const VoiceAssistantEventResponse &msg) {
@@ -1283,8 +1455,10 @@ void APIConnection::alarm_control_panel_command(const AlarmControlPanelCommandRe
 
 #ifdef USE_EVENT
 void APIConnection::send_event(event::Event *event, const std::string &event_type) {
+  if (!this->state_filter_.empty() && this->find_state_filter_(event) == nullptr)
+    return;
   this->schedule_message_(event, MessageCreator(event_type), EventResponse::MESSAGE_TYPE,
-                          EventResponse::ESTIMATED_SIZE);
+                          EventResponse::ESTIMATED_SIZE, BATCH_LANE_CONTROL);
 }
 uint16_t APIConnection::try_send_event_response(event::Event *event, const std::string &event_type, APIConnection *conn,
                                                 uint32_t remaining_size, bool is_single) {
@@ -1298,8 +1472,7 @@ uint16_t APIConnection::try_send_event_info(EntityBase *entity, APIConnection *c
   auto *event = static_cast<event::Event *>(entity);
   ListEntitiesEventResponse msg;
   msg.set_device_class(event->get_device_class_ref());
-  for (const auto &event_type : event->get_event_types())
-    msg.event_types.push_back(event_type);
+  msg.event_types = &event->get_event_types();
   return fill_and_encode_entity_info(event, msg, ListEntitiesEventResponse::MESSAGE_TYPE, conn, remaining_size,
                                      is_single);
 }
@@ -1364,6 +1537,57 @@ bool APIConnection::try_send_log_message(int level, const char *tag, const char
   return this->send_message_(msg, SubscribeLogsResponse::MESSAGE_TYPE);
 }
 
+#ifdef USE_LOGGER_PERSISTENT_LOG
+void APIConnection::begin_previous_log_() {
+  this->previous_log_pos_ = logger::global_logger->get_persistent_log().get_previous_log();
+}
+
+void APIConnection::send_previous_log_() {
+  // Send line by line and continue in the next loop when the socket buffer is full
+  const char *pos = this->previous_log_pos_;
+  while (*pos != '\0') {
+    const char *end = strchr(pos, '\n');
+    size_t len = end != nullptr ? end - pos : strlen(pos);
+    if (len > 0 && !this->try_send_log_message(ESPHOME_LOG_LEVEL_CONFIG, "logger", pos, len)) {
+      this->previous_log_pos_ = pos;
+      return;
+    }
+    pos += len;
+    if (*pos == '\n')
+      pos++;
+  }
+  this->previous_log_pos_ = nullptr;
+}
+
+#endif
+
+#ifdef USE_API_BINARY_LOGS
+bool APIConnection::try_send_raw_log_message(int level, const char *tag, int line, const char *format,
+                                             const std::vector<uint8_t> &args) {
+  SubscribeLogsResponse msg;
+  msg.level = static_cast<enums::LogLevel>(level);
+  msg.format_address = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(format));
+  msg.tag_address = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(tag));
+  msg.line = line;
+  msg.set_args(args.data(), args.size());
+  return this->send_message_(msg, SubscribeLogsResponse::MESSAGE_TYPE);
+}
+
+void APIConnection::update_log_format_(bool binary) {
+  this->flags_.binary_log_subscription = binary;
+  // Text subscribers need the logger to keep formatting messages
+  const bool wants_text = this->flags_.log_subscription != 0 && !binary;
+  if (wants_text == this->flags_.formatted_logs_requested)
+    return;
+  this->flags_.formatted_logs_requested = wants_text;
+  if (wants_text) {
+    logger::global_logger->request_formatted_logs();
+  } else {
+    logger::global_logger->release_formatted_logs();
+  }
+}
+#endif
+
 void APIConnection::complete_authentication_() {
   // Early return if already authenticated
   if (this->flags_.connection_state == static_cast<uint8_t>(ConnectionState::AUTHENTICATED)) {
@@ -1514,11 +1738,7 @@ bool APIConnection::send_device_info_response(const DeviceInfoRequest &msg) {
 }
 
 void APIConnection::on_home_assistant_state_response(const HomeAssistantStateResponse &msg) {
-  for (auto &it : this->parent_->get_state_subs()) {
-    if (it.entity_id == msg.entity_id && it.attribute.value() == msg.attribute) {
-      it.callback(msg.state);
-    }
-  }
+  this->parent_->on_home_assistant_state(msg.entity_id, msg.attribute, msg.state);
 }
 #ifdef USE_API_SERVICES
 void APIConnection::execute_service(const ExecuteServiceRequest &msg) {
@@ -1604,11 +1824,33 @@ void APIConnection::on_fatal_error() {
   this->flags_.remove = true;
 }
 
+APIConnection::BatchLane APIConnection::state_message_lane_(uint8_t message_type) {
+  switch (message_type) {
+#ifdef USE_BINARY_SENSOR
+    case BinarySensorStateResponse::MESSAGE_TYPE:
+#endif
+#ifdef USE_SENSOR
+    case SensorStateResponse::MESSAGE_TYPE:
+#endif
+#ifdef USE_TEXT_SENSOR
+    case TextSensorStateResponse::MESSAGE_TYPE:
+#endif
+#ifdef USE_UPDATE
+    case UpdateStateResponse::MESSAGE_TYPE:
+#endif
+      return BATCH_LANE_STATE;
+    default:
+      return BATCH_LANE_CONTROL;
+  }
+}
+
 void APIConnection::DeferredBatch::add_item(EntityBase *entity, MessageCreator creator, uint8_t message_type,
-                                            uint8_t estimated_size) {
+                                            uint8_t estimated_size, BatchLane lane) {
   // Check if we already have a message of this type for this entity
   // This provides deduplication per entity/message_type combination
+  // A message type always uses the same lane, so only that lane is searched
   // O(n) but optimized for RAM and not performance.
+  auto &items = lanes[lane];
   for (auto &item : items) {
     if (item.entity == entity && item.message_type == message_type) {
       // Clean up old creator before replacing
@@ -1629,6 +1871,7 @@ void APIConnection::DeferredBatch::add_item_front(EntityBase *entity, MessageCre
   // This avoids expensive vector::insert which shifts all elements
   // Note: We only ever have one high-priority message at a time (ping OR disconnect)
   // If we're disconnecting, pings are blocked, so this simple swap is sufficient
+  auto &items = lanes[BATCH_LANE_CONTROL];
   items.emplace_back(entity, std::move(creator), message_type, estimated_size);
   if (items.size() > 1) {
     // Swap the new high-priority item to the front
@@ -1652,7 +1895,34 @@ ProtoWriteBuffer APIConnection::allocate_batch_message_buffer(uint16_t size) {
   return result;
 }
 
+// Share of each lane in a batch once the initial states are sent. While all lanes have items,
+// 4 of every 7 messages come from the control lane, 2 from the state lane and 1 from the bulk lane.
+static constexpr uint8_t BATCH_LANE_WEIGHTS[] = {4, 2, 1};
+
+// Pick the lane of the next message in a batch. Weighted round robin over the lanes that still
+// have items; a lane out of credits waits until every other lane with items used up theirs.
+uint8_t APIConnection::next_batch_lane_(const std::vector<DeferredBatch::BatchItem> *lanes, const size_t *processed,
+                                       bool weighted, uint8_t *credits) {
+  while (true) {
+    for (uint8_t lane = 0; lane < BATCH_LANE_COUNT; lane++) {
+      if (processed[lane] >= lanes[lane].size())
+        continue;
+      if (!weighted)
+        return lane;
+      if (credits[lane] > 0) {
+        credits[lane]--;
+        return lane;
+      }
+    }
+    for (uint8_t lane = 0; lane < BATCH_LANE_COUNT; lane++)
+      credits[lane] = BATCH_LANE_WEIGHTS[lane];
+  }
+}
+
 void APIConnection::process_batch_() {
+#ifdef USE_RUNTIME_STATS_TRACE
+  runtime_stats::TraceScope trace_scope("api.batch", runtime_stats::TraceCategory::API);
+#endif
   // Ensure PacketInfo remains trivially destructible for our placement new approach
   static_assert(std::is_trivially_destructible<PacketInfo>::value,
                 "PacketInfo must remain trivially destructible with this placement-new approach");
@@ -1665,14 +1935,21 @@ void APIConnection::process_batch_() {
   // Try to clear buffer first
   if (!this->try_to_clear_buffer(true)) {
     // Can't write now, we'll try again later
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+    this->update_batch_delay_();
+#endif
     return;
   }
 
+  auto &lanes = this->deferred_batch_.lanes;
   size_t num_items = this->deferred_batch_.size();
 
   // Fast path for single message - allocate exact size needed
   if (num_items == 1) {
-    const auto &item = this->deferred_batch_[0];
+    uint8_t lane = 0;
+    while (lanes[lane].empty())
+      lane++;
+    const auto &item = lanes[lane][0];
 
     // Let the creator calculate size and encode if it fits
     uint16_t payload_size =
@@ -1691,6 +1968,9 @@ void APIConnection::process_batch_() {
       ESP_LOGW(TAG, "Message too large to send: type=%u", item.message_type);
       this->clear_batch_();
     }
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+    this->update_batch_delay_();
+#endif
     return;
   }
 
@@ -1710,9 +1990,9 @@ void APIConnection::process_batch_() {
 
   // Pre-calculate exact buffer size needed based on message types
   uint32_t total_estimated_size = 0;
-  for (size_t i = 0; i < this->deferred_batch_.size(); i++) {
-    const auto &item = this->deferred_batch_[i];
-    total_estimated_size += item.estimated_size;
+  for (const auto &items : lanes) {
+    for (const auto &item : items)
+      total_estimated_size += item.estimated_size;
   }
 
   // Calculate total overhead for all messages
@@ -1731,9 +2011,20 @@ void APIConnection::process_batch_() {
   // The actual message data follows after the header padding
   uint32_t current_offset = 0;
 
+  // Items taken from the front of each lane, and the lane each packet came from
+  size_t lane_processed[BATCH_LANE_COUNT] = {};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  uint8_t packet_lanes[MAX_PACKETS_PER_BATCH];
+#endif
+  // Until the initial states are sent the lanes are drained strictly in order, so nothing
+  // (like the state epoch marker) overtakes an initial state queued in a higher priority lane
+  const bool weighted = this->flags_.should_try_send_immediately;
+  uint8_t credits[BATCH_LANE_COUNT] = {};
+
   // Process items and encode directly to buffer (up to our limit)
   for (size_t i = 0; i < packets_to_process; i++) {
-    const auto &item = this->deferred_batch_[i];
+    uint8_t lane = next_batch_lane_(lanes, lane_processed, weighted, credits);
+    const auto &item = lanes[lane][lane_processed[lane]];
     // Try to encode message
     // The creator will calculate overhead to determine if the message fits
     uint16_t payload_size = item.creator(item.entity, this, remaining_size, false, item.message_type);
@@ -1751,8 +2042,12 @@ void APIConnection::process_batch_() {
     // Explicit destruction is not needed because PacketInfo is trivially destructible,
     // as ensured by the static_assert in its definition.
     new (&packet_info[packet_count++]) PacketInfo(item.message_type, current_offset, proto_payload_size);
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    packet_lanes[items_processed] = lane;
+#endif
 
     // Update tracking variables
+    lane_processed[lane]++;
     items_processed++;
     // After first message, set remaining size to MAX_BATCH_PACKET_SIZE to avoid fragmentation
     if (items_processed == 1) {
@@ -1783,20 +2078,27 @@ void APIConnection::process_batch_() {
     ESP_LOGW(TAG, "%s: Batch write failed %s errno=%d", this->get_client_combined_info().c_str(), api_error_to_str(err),
              errno);
   }
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  this->update_batch_delay_();
+#endif
 
 #ifdef HAS_PROTO_MESSAGE_DUMP
   // Log messages after send attempt for VV debugging
   // It's safe to use the buffer for logging at this point regardless of send result
+  size_t lane_logged[BATCH_LANE_COUNT] = {};
   for (size_t i = 0; i < items_processed; i++) {
-    const auto &item = this->deferred_batch_[i];
-    this->log_batch_item_(item);
+    const uint8_t lane = packet_lanes[i];
+    this->log_batch_item_(lanes[lane][lane_logged[lane]++]);
   }
 #endif
 
   // Handle remaining items more efficiently
-  if (items_processed < this->deferred_batch_.size()) {
-    // Remove processed items from the beginning with proper cleanup
-    this->deferred_batch_.remove_front(items_processed);
+  if (items_processed < num_items) {
+    // Remove processed items from the beginning of each lane with proper cleanup
+    for (uint8_t lane = 0; lane < BATCH_LANE_COUNT; lane++) {
+      if (lane_processed[lane] > 0)
+        this->deferred_batch_.remove_front(lane, lane_processed[lane]);
+    }
     // Reschedule for remaining items
     this->schedule_batch_();
   } else {
@@ -1825,6 +2127,13 @@ uint16_t APIConnection::try_send_list_info_done(EntityBase *entity, APIConnectio
   return encode_message_to_buffer(resp, ListEntitiesDoneResponse::MESSAGE_TYPE, conn, remaining_size, is_single);
 }
 
+uint16_t APIConnection::try_send_subscribe_states_response(EntityBase *entity, APIConnection *conn,
+                                                           uint32_t remaining_size, bool is_single) {
+  SubscribeStatesResponse resp;
+  resp.state_epoch = conn->initial_state_iterator_.get_snapshot_epoch();
+  return encode_message_to_buffer(resp, SubscribeStatesResponse::MESSAGE_TYPE, conn, remaining_size, is_single);
+}
+
 uint16_t APIConnection::try_send_disconnect_request(EntityBase *entity, APIConnection *conn, uint32_t remaining_size,
                                                     bool is_single) {
   DisconnectRequest req;
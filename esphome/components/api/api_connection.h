@@ -57,7 +57,12 @@ class APIConnection : public APIServerConnection {
 
   bool send_list_info_done() {
     return this->schedule_message_(nullptr, &APIConnection::try_send_list_info_done,
-                                   ListEntitiesDoneResponse::MESSAGE_TYPE, ListEntitiesDoneResponse::ESTIMATED_SIZE);
+                                   ListEntitiesDoneResponse::MESSAGE_TYPE, ListEntitiesDoneResponse::ESTIMATED_SIZE,
+                                   BATCH_LANE_BULK);
+  }
+  bool send_subscribe_states_response() {
+    return this->schedule_message_(nullptr, &APIConnection::try_send_subscribe_states_response,
+                                   SubscribeStatesResponse::MESSAGE_TYPE, SubscribeStatesResponse::ESTIMATED_SIZE);
   }
 #ifdef USE_BINARY_SENSOR
   bool send_binary_sensor_state(binary_sensor::BinarySensor *binary_sensor);
@@ -132,6 +137,11 @@ class APIConnection : public APIServerConnection {
   void media_player_command(const MediaPlayerCommandRequest &msg) override;
 #endif
   bool try_send_log_message(int level, const char *tag, const char *line, size_t message_len);
+#ifdef USE_API_BINARY_LOGS
+  bool try_send_raw_log_message(int level, const char *tag, int line, const char *format,
+                                const std::vector<uint8_t> &args);
+  bool is_binary_log_subscription() const { return this->flags_.binary_log_subscription; }
+#endif
   void send_homeassistant_service_call(const HomeassistantServiceResponse &call) {
     if (!this->flags_.service_call_subscription)
       return;
@@ -201,12 +211,27 @@ class APIConnection : public APIServerConnection {
   void list_entities(const ListEntitiesRequest &msg) override { this->list_entities_iterator_.begin(); }
   void subscribe_states(const SubscribeStatesRequest &msg) override {
     this->flags_.state_subscription = true;
+    this->initial_state_iterator_.set_state_epoch(this->parent_->get_state_epoch(), msg.state_epoch,
+                                                  msg.request_state_epoch);
+    this->set_state_filter_(msg.entity_keys, msg.min_interval);
     this->initial_state_iterator_.begin();
   }
   void subscribe_logs(const SubscribeLogsRequest &msg) override {
     this->flags_.log_subscription = msg.level;
-    if (msg.dump_config)
+#ifdef USE_API_BINARY_LOGS
+    this->update_log_format_(msg.deferred_formatting);
+#endif
+#ifdef USE_LOGGER
+    this->parent_->update_log_sink_level();
+#endif
+    if (msg.dump_config) {
       App.schedule_dump_config();
+#ifdef USE_LOGGER_PERSISTENT_LOG
+      // Replay what the device logged before its last reset along with the config dump
+      if (msg.level >= enums::LOG_LEVEL_CONFIG)
+        this->begin_previous_log_();
+#endif
+    }
   }
   void subscribe_homeassistant_services(const SubscribeHomeassistantServicesRequest &msg) override {
     this->flags_.service_call_subscription = true;
@@ -280,6 +305,9 @@ class APIConnection : public APIServerConnection {
   bool send_buffer(ProtoWriteBuffer buffer, uint8_t message_type) override;
 
   std::string get_client_combined_info() const { return this->client_info_.get_combined_info(); }
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  uint16_t get_effective_batch_delay() const { return this->batch_delay_; }
+#endif
 
   // Buffer allocator methods for batch processing
   ProtoWriteBuffer allocate_single_message_buffer(uint16_t size);
@@ -300,17 +328,23 @@ class APIConnection : public APIServerConnection {
 #ifdef USE_DEVICES
     msg.device_id = entity->get_device_id();
 #endif
-    return encode_message_to_buffer(msg, message_type, conn, remaining_size, is_single);
+    uint16_t size = encode_state_to_buffer(entity, msg, message_type, conn, remaining_size, is_single);
+#ifdef USE_ENTITY_STATS
+    entity->get_stats().api_bytes += size;
+#endif
+    return size;
   }
 
+  // Encode a state message, reusing the payload another connection already encoded for this state change
+  static uint16_t encode_state_to_buffer(EntityBase *entity, ProtoMessage &msg, uint8_t message_type,
+                                         APIConnection *conn, uint32_t remaining_size, bool is_single);
+
   // Helper to fill entity info base and encode message
   static uint16_t fill_and_encode_entity_info(EntityBase *entity, InfoResponseProtoMessage &msg, uint8_t message_type,
                                               APIConnection *conn, uint32_t remaining_size, bool is_single) {
     // Set common fields that are shared by all entity types
     msg.key = entity->get_object_id_hash();
-    // IMPORTANT: get_object_id() may return a temporary std::string
-    std::string object_id = entity->get_object_id();
-    msg.set_object_id(StringRef(object_id));
+    msg.set_object_id(entity->get_object_id_ref());
 
     if (entity->has_own_name()) {
       msg.set_name(entity->get_name());
@@ -458,6 +492,8 @@ class APIConnection : public APIServerConnection {
                                        bool is_single);
 #endif
 #ifdef USE_CAMERA
+  // Sends the next chunk of the camera frame straight from the frame buffer
+  void send_camera_chunk_();
   static uint16_t try_send_camera_info(EntityBase *entity, APIConnection *conn, uint32_t remaining_size,
                                        bool is_single);
 #endif
@@ -466,6 +502,10 @@ class APIConnection : public APIServerConnection {
   static uint16_t try_send_list_info_done(EntityBase *entity, APIConnection *conn, uint32_t remaining_size,
                                           bool is_single);
 
+  // Method for SubscribeStatesResponse batching
+  static uint16_t try_send_subscribe_states_response(EntityBase *entity, APIConnection *conn,
+                                                     uint32_t remaining_size, bool is_single);
+
   // Method for DisconnectRequest batching
   static uint16_t try_send_disconnect_request(EntityBase *entity, APIConnection *conn, uint32_t remaining_size,
                                               bool is_single);
@@ -494,6 +534,15 @@ class APIConnection : public APIServerConnection {
   // Group 4: 4-byte types
   uint32_t last_traffic_;
   int state_subs_at_ = -1;
+#ifdef USE_CAMERA
+  // Progress of the camera frame being sent and the totals of the connection
+  struct CameraStreamStats {
+    uint32_t frame_start{0};
+    uint32_t frame_bytes{0};
+    uint32_t frames_sent{0};
+    uint32_t frames_dropped{0};
+  } camera_stats_;
+#endif
 
   // Function pointer type for message encoding
   using MessageCreatorPtr = uint16_t (*)(EntityBase *, APIConnection *, uint32_t remaining_size, bool is_single);
@@ -547,7 +596,21 @@ class APIConnection : public APIServerConnection {
     } data_;  // 4 bytes on 32-bit, 8 bytes on 64-bit - same as before
   };
 
+  // Priority lanes of the DeferredBatch, lower values are sent first
+  enum BatchLane : uint8_t {
+    // Ping/disconnect, events and states of entities a user controls (switches, locks, lights, ...)
+    BATCH_LANE_CONTROL = 0,
+    // Sensor readings and the state epoch marker
+    BATCH_LANE_STATE = 1,
+    // Entity info sent while listing entities
+    BATCH_LANE_BULK = 2,
+    BATCH_LANE_COUNT = 3,
+  };
+  // Lane for a state message, readings of passive entities queue behind states that react to user commands
+  static BatchLane state_message_lane_(uint8_t message_type);
+
   // Generic batching mechanism for both state updates and entity info
+  // Every lane is a FIFO queue, process_batch_ picks from them by weight (see BATCH_LANE_WEIGHTS)
   struct DeferredBatch {
     struct BatchItem {
       EntityBase *entity;      // Entity pointer
@@ -560,12 +623,12 @@ class APIConnection : public APIServerConnection {
           : entity(entity), creator(std::move(creator)), message_type(message_type), estimated_size(estimated_size) {}
     };
 
-    std::vector<BatchItem> items;
+    std::vector<BatchItem> lanes[BATCH_LANE_COUNT];
     uint32_t batch_start_time{0};
 
    private:
-    // Helper to cleanup items from the beginning
-    void cleanup_items_(size_t count) {
+    // Helper to cleanup items from the beginning of a lane
+    static void cleanup_items_(std::vector<BatchItem> &items, size_t count) {
       for (size_t i = 0; i < count; i++) {
         items[i].creator.cleanup(items[i].message_type);
       }
@@ -574,7 +637,7 @@ class APIConnection : public APIServerConnection {
    public:
     DeferredBatch() {
       // Pre-allocate capacity for typical batch sizes to avoid reallocation
-      items.reserve(8);
+      lanes[BATCH_LANE_STATE].reserve(8);
     }
 
     ~DeferredBatch() {
@@ -582,32 +645,66 @@ class APIConnection : public APIServerConnection {
       clear();
     }
 
-    // Add item to the batch
-    void add_item(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size);
-    // Add item to the front of the batch (for high priority messages like ping)
+    // Add item to the back of a lane
+    void add_item(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size,
+                  BatchLane lane);
+    // Add item to the front of the control lane (for high priority messages like ping)
     void add_item_front(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size);
 
     // Clear all items with proper cleanup
     void clear() {
-      cleanup_items_(items.size());
-      items.clear();
+      for (auto &items : lanes) {
+        cleanup_items_(items, items.size());
+        items.clear();
+      }
       batch_start_time = 0;
     }
 
-    // Remove processed items from the front with proper cleanup
-    void remove_front(size_t count) {
-      cleanup_items_(count);
+    // Remove processed items from the front of a lane with proper cleanup
+    void remove_front(uint8_t lane, size_t count) {
+      auto &items = lanes[lane];
+      cleanup_items_(items, count);
       items.erase(items.begin(), items.begin() + count);
     }
 
-    bool empty() const { return items.empty(); }
-    size_t size() const { return items.size(); }
-    const BatchItem &operator[](size_t index) const { return items[index]; }
+    bool empty() const { return size() == 0; }
+    size_t size() const {
+      size_t total = 0;
+      for (const auto &items : lanes)
+        total += items.size();
+      return total;
+    }
   };
 
-  // DeferredBatch here (16 bytes, 4-byte aligned)
+  // DeferredBatch here (40 bytes, 4-byte aligned)
   DeferredBatch deferred_batch_;
 
+  // Entities the client subscribed to with SubscribeStatesRequest.entity_keys, empty for all entities
+  struct StateFilterEntry {
+    uint32_t key;
+    uint32_t last_sent;
+    // State update held back by min_interval, sent from loop() once the interval has passed
+    EntityBase *pending_entity;
+    MessageCreatorPtr pending_creator;
+    uint8_t pending_message_type;
+    uint8_t pending_estimated_size;
+  };
+  std::vector<StateFilterEntry> state_filter_;
+  uint32_t state_min_interval_{0};
+
+#ifdef USE_LOGGER_PERSISTENT_LOG
+  // Next line of the previous boot's log to send, nullptr when done
+  const char *previous_log_pos_{nullptr};
+  void begin_previous_log_();
+  void send_previous_log_();
+#endif
+
+  void set_state_filter_(const std::vector<uint32_t> &keys, uint32_t min_interval);
+  StateFilterEntry *find_state_filter_(EntityBase *entity);
+  // Returns false if the state message must not be sent (yet) to this client
+  bool filter_state_(EntityBase *entity, MessageCreatorPtr creator, uint8_t message_type, uint8_t estimated_size);
+  void send_pending_states_(uint32_t now);
+
   // ConnectionState enum for type safety
   enum class ConnectionState : uint8_t {
     WAITING_FOR_HELLO = 0,
@@ -634,15 +731,29 @@ class APIConnection : public APIServerConnection {
     uint8_t should_try_send_immediately : 1;  // True after initial states are sent
 #ifdef HAS_PROTO_MESSAGE_DUMP
     uint8_t log_only_mode : 1;
+#endif
+#ifdef USE_API_BINARY_LOGS
+    uint8_t binary_log_subscription : 1;  // Client formats log messages itself
+    uint8_t formatted_logs_requested : 1;  // Holds a Logger::request_formatted_logs()
 #endif
   } flags_{};  // 2 bytes total
 
   // 2-byte types immediately after flags_ (no padding between them)
   uint16_t client_api_version_major_{0};
   uint16_t client_api_version_minor_{0};
-  // Total: 2 (flags) + 2 + 2 = 6 bytes, then 2 bytes padding to next 4-byte boundary
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  // Effective batch delay for this connection, adapted to how well the link keeps up
+  uint16_t batch_delay_{0};
+#endif
+  // Total: 2 (flags) + 2 + 2 (+ 2) = 6 (8) bytes, padded to the next 4-byte boundary
 
   uint32_t get_batch_delay_ms_() const;
+#ifdef USE_API_BINARY_LOGS
+  void update_log_format_(bool binary);
+#endif
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  void update_batch_delay_();
+#endif
   // Message will use 8 more bytes than the minimum size, and typical
   // MTU is 1500. Sometimes users will see as low as 1460 MTU.
   // If its IPv6 the header is 40 bytes, and if its IPv4
@@ -658,6 +769,8 @@ class APIConnection : public APIServerConnection {
 
   bool schedule_batch_();
   void process_batch_();
+  static uint8_t next_batch_lane_(const std::vector<DeferredBatch::BatchItem> *lanes, const size_t *processed,
+                                  bool weighted, uint8_t *credits);
   void clear_batch_() {
     this->deferred_batch_.clear();
     this->flags_.batch_scheduled = false;
@@ -680,6 +793,11 @@ class APIConnection : public APIServerConnection {
   // Helper method to send a message either immediately or via batching
   bool send_message_smart_(EntityBase *entity, MessageCreatorPtr creator, uint8_t message_type,
                            uint8_t estimated_size) {
+    // Drop states the client did not subscribe to before they take any batch or buffer space
+    if (!this->state_filter_.empty() && !this->filter_state_(entity, creator, message_type, estimated_size))
+      return true;
+    const BatchLane lane = state_message_lane_(message_type);
+
     // Try to send immediately if:
     // 1. We should try to send immediately (should_try_send_immediately = true)
     // 2. Batch delay is 0 (user has opted in to immediate sending)
@@ -700,19 +818,20 @@ class APIConnection : public APIServerConnection {
     }
 
     // Fall back to scheduled batching
-    return this->schedule_message_(entity, creator, message_type, estimated_size);
+    return this->schedule_message_(entity, creator, message_type, estimated_size, lane);
   }
 
   // Helper function to schedule a deferred message with known message type
-  bool schedule_message_(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size) {
-    this->deferred_batch_.add_item(entity, std::move(creator), message_type, estimated_size);
+  bool schedule_message_(EntityBase *entity, MessageCreator creator, uint8_t message_type, uint8_t estimated_size,
+                         BatchLane lane = BATCH_LANE_STATE) {
+    this->deferred_batch_.add_item(entity, std::move(creator), message_type, estimated_size, lane);
     return this->schedule_batch_();
   }
 
   // Overload for function pointers (for info messages and current state reads)
   bool schedule_message_(EntityBase *entity, MessageCreatorPtr function_ptr, uint8_t message_type,
-                         uint8_t estimated_size) {
-    return schedule_message_(entity, MessageCreator(function_ptr), message_type, estimated_size);
+                         uint8_t estimated_size, BatchLane lane = BATCH_LANE_STATE) {
+    return schedule_message_(entity, MessageCreator(function_ptr), message_type, estimated_size, lane);
   }
 
   // Helper function to schedule a high priority message at the front of the batch
@@ -102,10 +102,21 @@ APIError APIFrameHelper::handle_socket_write_error_() {
 
 // Helper method to buffer data from IOVs
 void APIFrameHelper::buffer_data_from_iov_(const struct iovec *iov, int iovcnt, uint16_t total_write_len,
-                                           uint16_t offset) {
+                                           uint16_t offset, std::vector<uint8_t> *storage) {
   SendBuffer buffer;
+  if (storage != nullptr) {
+    // Take over the caller's buffer, the unsent bytes stay where they are
+    const uint8_t *start = reinterpret_cast<const uint8_t *>(iov[0].iov_base);
+    buffer.offset = static_cast<uint16_t>(start - storage->data()) + offset;
+    buffer.size = buffer.offset + total_write_len - offset;
+    buffer.data.swap(*storage);
+    // The caller is left with an empty vector, give it the same room again so the next batch doesn't regrow it
+    storage->reserve(buffer.data.capacity());
+    this->tx_buf_.push_back(std::move(buffer));
+    return;
+  }
   buffer.size = total_write_len - offset;
-  buffer.data = std::make_unique<uint8_t[]>(buffer.size);
+  buffer.data.resize(buffer.size);
 
   uint16_t to_skip = offset;
   uint16_t write_pos = 0;
@@ -118,7 +129,7 @@ void APIFrameHelper::buffer_data_from_iov_(const struct iovec *iov, int iovcnt,
       // Include this segment (partially or fully)
       const uint8_t *src = reinterpret_cast<uint8_t *>(iov[i].iov_base) + to_skip;
       uint16_t len = static_cast<uint16_t>(iov[i].iov_len) - to_skip;
-      std::memcpy(buffer.data.get() + write_pos, src, len);
+      std::memcpy(buffer.data.data() + write_pos, src, len);
       write_pos += len;
       to_skip = 0;
     }
@@ -126,8 +137,15 @@ void APIFrameHelper::buffer_data_from_iov_(const struct iovec *iov, int iovcnt,
   this->tx_buf_.push_back(std::move(buffer));
 }
 
+APIError APIFrameHelper::write_protobuf_packet_with_data(uint8_t type, ProtoWriteBuffer buffer, const uint8_t *data,
+                                                         uint16_t len) {
+  buffer.get_buffer()->insert(buffer.get_buffer()->end(), data, data + len);
+  return this->write_protobuf_packet(type, buffer);
+}
+
 // This method writes data to socket or buffers it
-APIError APIFrameHelper::write_raw_(const struct iovec *iov, int iovcnt, uint16_t total_write_len) {
+APIError APIFrameHelper::write_raw_(const struct iovec *iov, int iovcnt, uint16_t total_write_len,
+                                    std::vector<uint8_t> *storage) {
   // Returns APIError::OK if successful (or would block, but data has been buffered)
   // Returns APIError::SOCKET_WRITE_FAILED if socket write failed, and sets state to FAILED
 
@@ -151,7 +169,7 @@ APIError APIFrameHelper::write_raw_(const struct iovec *iov, int iovcnt, uint16_
     // If there is still data in the buffer, we can't send, buffer
     // the new data and return
     if (!this->tx_buf_.empty()) {
-      this->buffer_data_from_iov_(iov, iovcnt, total_write_len, 0);
+      this->buffer_data_from_iov_(iov, iovcnt, total_write_len, 0, storage);
       return APIError::OK;  // Success, data buffered
     }
   }
@@ -163,13 +181,13 @@ APIError APIFrameHelper::write_raw_(const struct iovec *iov, int iovcnt, uint16_
     APIError err = this->handle_socket_write_error_();
     if (err == APIError::WOULD_BLOCK) {
       // Socket would block, buffer the data
-      this->buffer_data_from_iov_(iov, iovcnt, total_write_len, 0);
+      this->buffer_data_from_iov_(iov, iovcnt, total_write_len, 0, storage);
       return APIError::OK;  // Success, data buffered
     }
     return err;  // Socket write failed
   } else if (static_cast<uint16_t>(sent) < total_write_len) {
     // Partially sent, buffer the remaining data
-    this->buffer_data_from_iov_(iov, iovcnt, total_write_len, static_cast<uint16_t>(sent));
+    this->buffer_data_from_iov_(iov, iovcnt, total_write_len, static_cast<uint16_t>(sent), storage);
   }
 
   return APIError::OK;  // Success, all data sent or buffered
@@ -104,6 +104,11 @@ class APIFrameHelper {
   // packets contains (message_type, offset, length) for each message in the buffer
   // The buffer contains all messages with appropriate padding before each
   virtual APIError write_protobuf_packets(ProtoWriteBuffer buffer, std::span<const PacketInfo> packets) = 0;
+  // Write one packet whose payload is the message in buffer followed by len bytes of data, so large fields don't
+  // have to be copied into the buffer first. Protocols that can send data from where it is do so, the others append
+  // it to the buffer. Bytes the socket doesn't take are copied, data only has to stay valid during the call.
+  virtual APIError write_protobuf_packet_with_data(uint8_t type, ProtoWriteBuffer buffer, const uint8_t *data,
+                                                   uint16_t len);
   // Get the frame header padding required by this protocol
   virtual uint8_t frame_header_padding() = 0;
   // Get the frame footer size required by this protocol
@@ -114,23 +119,28 @@ class APIFrameHelper {
  protected:
   // Buffer containing data to be sent
   struct SendBuffer {
-    std::unique_ptr<uint8_t[]> data;
-    uint16_t size{0};    // Total size of the buffer
+    // Either a copy of the unsent bytes or a buffer handed over by the caller (see write_raw_)
+    std::vector<uint8_t> data;
+    uint16_t size{0};    // End of the data to send within the buffer
     uint16_t offset{0};  // Current offset within the buffer
 
     // Using uint16_t reduces memory usage since ESPHome API messages are limited to UINT16_MAX (65535) bytes
     uint16_t remaining() const { return size - offset; }
-    const uint8_t *current_data() const { return data.get() + offset; }
+    const uint8_t *current_data() const { return data.data() + offset; }
   };
 
   // Common implementation for writing raw data to socket
-  APIError write_raw_(const struct iovec *iov, int iovcnt, uint16_t total_write_len);
+  // If storage is given, iov must be a single segment inside it, and storage is moved into tx_buf_
+  // instead of copying whatever the socket did not accept
+  APIError write_raw_(const struct iovec *iov, int iovcnt, uint16_t total_write_len,
+                      std::vector<uint8_t> *storage = nullptr);
 
   // Try to send data from the tx buffer
   APIError try_send_tx_buf_();
 
   // Helper method to buffer data from IOVs
-  void buffer_data_from_iov_(const struct iovec *iov, int iovcnt, uint16_t total_write_len, uint16_t offset);
+  void buffer_data_from_iov_(const struct iovec *iov, int iovcnt, uint16_t total_write_len, uint16_t offset,
+                             std::vector<uint8_t> *storage);
 
   // Common socket write error handling
   APIError handle_socket_write_error_();
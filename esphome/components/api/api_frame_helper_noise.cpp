@@ -420,14 +420,17 @@ APIError APINoiseFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, st
   std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
   uint8_t *buffer_data = raw_buffer->data();  // Cache buffer pointer
 
-  this->reusable_iovs_.clear();
-  this->reusable_iovs_.reserve(packets.size());
+  // The header padding (indicator + size + type + length) and footer (MAC) reserved around each
+  // message are exactly the frame overhead, so once every packet is encrypted in place the frames
+  // sit back to back and the whole batch goes out as a single segment of the buffer
+  uint8_t *write_start = buffer_data + packets[0].offset;
   uint16_t total_write_len = 0;
 
   // We need to encrypt each packet in place
   for (const auto &packet : packets) {
     // The buffer already has padding at offset
     uint8_t *buf_start = buffer_data + packet.offset;
+    assert(buf_start == write_start + total_write_len);
 
     // Write noise header
     buf_start[0] = 0x01;  // indicator
@@ -459,14 +462,13 @@ APIError APINoiseFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, st
     buf_start[1] = static_cast<uint8_t>(mbuf.size >> 8);
     buf_start[2] = static_cast<uint8_t>(mbuf.size);
 
-    // Add iovec for this encrypted packet
-    size_t packet_len = static_cast<size_t>(3 + mbuf.size);  // indicator + size + encrypted data
-    this->reusable_iovs_.push_back({buf_start, packet_len});
-    total_write_len += packet_len;
+    total_write_len += static_cast<uint16_t>(3 + mbuf.size);  // indicator + size + encrypted data
   }
 
-  // Send all encrypted packets in one writev call
-  return this->write_raw_(this->reusable_iovs_.data(), this->reusable_iovs_.size(), total_write_len);
+  // Send all encrypted packets in one write; if the socket can't take it all, the buffer itself is
+  // queued rather than copied
+  struct iovec iov = {write_start, total_write_len};
+  return this->write_raw_(&iov, 1, total_write_len, raw_buffer);
 }
 
 APIError APINoiseFrameHelper::write_frame_(const uint8_t *data, uint16_t len) {
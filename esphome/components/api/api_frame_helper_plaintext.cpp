@@ -52,12 +52,39 @@ APIError APIPlaintextFrameHelper::loop() {
  *
  * error API_ERROR_BAD_INDICATOR: Bad indicator byte at start of frame.
  */
+void APIPlaintextFrameHelper::parse_header_in_place_() {
+  // Sockets that can show their receive buffer let the whole header be parsed in one go, instead of reading it a
+  // byte at a time so as not to take bytes of the next message. Anything unusual is left to the byte-wise path.
+  size_t len = 0;
+  const uint8_t *data = this->socket_->peek(&len);
+  if (data == nullptr || len < 3 || data[0] != 0x00)
+    return;
+  uint32_t size_len = 0;
+  auto msg_size_varint = ProtoVarInt::parse(&data[1], len - 1, &size_len);
+  if (!msg_size_varint.has_value() || msg_size_varint->as_uint32() > std::numeric_limits<uint16_t>::max())
+    return;
+  uint32_t type_len = 0;
+  auto msg_type_varint = ProtoVarInt::parse(&data[1 + size_len], len - 1 - size_len, &type_len);
+  if (!msg_type_varint.has_value() || msg_type_varint->as_uint32() > std::numeric_limits<uint16_t>::max())
+    return;
+  size_t header_len = 1 + size_len + type_len;
+  if (header_len >= sizeof(rx_header_buf_))
+    return;
+  this->socket_->consume(header_len);
+  rx_header_parsed_len_ = msg_size_varint->as_uint16();
+  rx_header_parsed_type_ = msg_type_varint->as_uint16();
+  rx_header_parsed_ = true;
+}
+
 APIError APIPlaintextFrameHelper::try_read_frame_(std::vector<uint8_t> *frame) {
   if (frame == nullptr) {
     HELPER_LOG("Bad argument for try_read_frame_");
     return APIError::BAD_ARG;
   }
 
+  if (!rx_header_parsed_ && rx_header_buf_pos_ == 0)
+    this->parse_header_in_place_();
+
   // read header
   while (!rx_header_parsed_) {
     // Now that we know when the socket is ready, we can read up to 3 bytes
@@ -235,50 +262,12 @@ APIError APIPlaintextFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer
   uint16_t total_write_len = 0;
 
   for (const auto &packet : packets) {
-    // Calculate varint sizes for header layout
-    uint8_t size_varint_len = api::ProtoSize::varint(static_cast<uint32_t>(packet.payload_size));
-    uint8_t type_varint_len = api::ProtoSize::varint(static_cast<uint32_t>(packet.message_type));
-    uint8_t total_header_len = 1 + size_varint_len + type_varint_len;
-
-    // Calculate where to start writing the header
-    // The header starts at the latest possible position to minimize unused padding
-    //
-    // Example 1 (small values): total_header_len = 3, header_offset = 6 - 3 = 3
-    // [0-2]  - Unused padding
-    // [3]    - 0x00 indicator byte
-    // [4]    - Payload size varint (1 byte, for sizes 0-127)
-    // [5]    - Message type varint (1 byte, for types 0-127)
-    // [6...] - Actual payload data
-    //
-    // Example 2 (medium values): total_header_len = 4, header_offset = 6 - 4 = 2
-    // [0-1]  - Unused padding
-    // [2]    - 0x00 indicator byte
-    // [3-4]  - Payload size varint (2 bytes, for sizes 128-16383)
-    // [5]    - Message type varint (1 byte, for types 0-127)
-    // [6...] - Actual payload data
-    //
-    // Example 3 (large values): total_header_len = 6, header_offset = 6 - 6 = 0
-    // [0]    - 0x00 indicator byte
-    // [1-3]  - Payload size varint (3 bytes, for sizes 16384-2097151)
-    // [4-5]  - Message type varint (2 bytes, for types 128-32767)
-    // [6...] - Actual payload data
-    //
-    // The message starts at offset + frame_header_padding_
-    // So we write the header starting at offset + frame_header_padding_ - total_header_len
     uint8_t *buf_start = buffer_data + packet.offset;
-    uint32_t header_offset = frame_header_padding_ - total_header_len;
-
-    // Write the plaintext header
-    buf_start[header_offset] = 0x00;  // indicator
-
-    // Encode varints directly into buffer
-    ProtoVarInt(packet.payload_size).encode_to_buffer_unchecked(buf_start + header_offset + 1, size_varint_len);
-    ProtoVarInt(packet.message_type)
-        .encode_to_buffer_unchecked(buf_start + header_offset + 1 + size_varint_len, type_varint_len);
+    uint8_t total_header_len = this->write_header_(buf_start, packet.message_type, packet.payload_size);
 
     // Add iovec for this packet (header + payload)
     size_t packet_len = static_cast<size_t>(total_header_len + packet.payload_size);
-    this->reusable_iovs_.push_back({buf_start + header_offset, packet_len});
+    this->reusable_iovs_.push_back({buf_start + frame_header_padding_ - total_header_len, packet_len});
     total_write_len += packet_len;
   }
 
@@ -286,6 +275,65 @@ APIError APIPlaintextFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer
   return write_raw_(this->reusable_iovs_.data(), this->reusable_iovs_.size(), total_write_len);
 }
 
+APIError APIPlaintextFrameHelper::write_protobuf_packet_with_data(uint8_t type, ProtoWriteBuffer buffer,
+                                                                  const uint8_t *data, uint16_t len) {
+  if (state_ != State::DATA) {
+    return APIError::BAD_STATE;
+  }
+
+  // The data goes out as a second segment of the same writev, straight from where it is
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
+  uint16_t message_len = static_cast<uint16_t>(raw_buffer->size() - frame_header_padding_);
+  uint8_t total_header_len = this->write_header_(raw_buffer->data(), type, message_len + len);
+  struct iovec iov[2] = {{raw_buffer->data() + frame_header_padding_ - total_header_len,
+                          static_cast<size_t>(total_header_len + message_len)},
+                         {const_cast<uint8_t *>(data), len}};
+  return write_raw_(iov, 2, total_header_len + message_len + len);
+}
+
+uint8_t APIPlaintextFrameHelper::write_header_(uint8_t *buf_start, uint16_t message_type, uint16_t payload_size) {
+  // Calculate varint sizes for header layout
+  uint8_t size_varint_len = api::ProtoSize::varint(static_cast<uint32_t>(payload_size));
+  uint8_t type_varint_len = api::ProtoSize::varint(static_cast<uint32_t>(message_type));
+  uint8_t total_header_len = 1 + size_varint_len + type_varint_len;
+
+  // Calculate where to start writing the header
+  // The header starts at the latest possible position to minimize unused padding
+  //
+  // Example 1 (small values): total_header_len = 3, header_offset = 6 - 3 = 3
+  // [0-2]  - Unused padding
+  // [3]    - 0x00 indicator byte
+  // [4]    - Payload size varint (1 byte, for sizes 0-127)
+  // [5]    - Message type varint (1 byte, for types 0-127)
+  // [6...] - Actual payload data
+  //
+  // Example 2 (medium values): total_header_len = 4, header_offset = 6 - 4 = 2
+  // [0-1]  - Unused padding
+  // [2]    - 0x00 indicator byte
+  // [3-4]  - Payload size varint (2 bytes, for sizes 128-16383)
+  // [5]    - Message type varint (1 byte, for types 0-127)
+  // [6...] - Actual payload data
+  //
+  // Example 3 (large values): total_header_len = 6, header_offset = 6 - 6 = 0
+  // [0]    - 0x00 indicator byte
+  // [1-3]  - Payload size varint (3 bytes, for sizes 16384-2097151)
+  // [4-5]  - Message type varint (2 bytes, for types 128-32767)
+  // [6...] - Actual payload data
+  //
+  // The message starts at offset + frame_header_padding_
+  // So we write the header starting at offset + frame_header_padding_ - total_header_len
+  uint32_t header_offset = frame_header_padding_ - total_header_len;
+
+  // Write the plaintext header
+  buf_start[header_offset] = 0x00;  // indicator
+
+  // Encode varints directly into buffer
+  ProtoVarInt(payload_size).encode_to_buffer_unchecked(buf_start + header_offset + 1, size_varint_len);
+  ProtoVarInt(message_type)
+      .encode_to_buffer_unchecked(buf_start + header_offset + 1 + size_varint_len, type_varint_len);
+  return total_header_len;
+}
+
 }  // namespace api
 }  // namespace esphome
 #endif  // USE_API_PLAINTEXT
@@ -23,12 +23,17 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   APIError read_packet(ReadPacketBuffer *buffer) override;
   APIError write_protobuf_packet(uint8_t type, ProtoWriteBuffer buffer) override;
   APIError write_protobuf_packets(ProtoWriteBuffer buffer, std::span<const PacketInfo> packets) override;
+  APIError write_protobuf_packet_with_data(uint8_t type, ProtoWriteBuffer buffer, const uint8_t *data,
+                                           uint16_t len) override;
   uint8_t frame_header_padding() override { return frame_header_padding_; }
   // Get the frame footer size required by this protocol
   uint8_t frame_footer_size() override { return frame_footer_size_; }
 
  protected:
   APIError try_read_frame_(std::vector<uint8_t> *frame);
+  void parse_header_in_place_();
+  // Writes the header into the padding before the packet at buf_start, returns the header length
+  uint8_t write_header_(uint8_t *buf_start, uint16_t message_type, uint16_t payload_size);
 
   // Group 2-byte aligned types
   uint16_t rx_header_parsed_type_ = 0;
@@ -179,6 +179,36 @@ void DeviceInfoResponse::calculate_size(uint32_t &total_size) const {
   ProtoSize::add_message_object(total_size, 2, this->area);
 #endif
 }
+bool SubscribeStatesRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 1:
+      this->state_epoch = value.as_uint32();
+      break;
+    case 2:
+      this->request_state_epoch = value.as_bool();
+      break;
+    case 4:
+      this->min_interval = value.as_uint32();
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
+bool SubscribeStatesRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
+  switch (field_id) {
+    case 3:
+      this->entity_keys.push_back(value.as_fixed32());
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
+void SubscribeStatesResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_uint32(1, this->state_epoch); }
+void SubscribeStatesResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint32_field(total_size, 1, this->state_epoch);
+}
 #ifdef USE_BINARY_SENSOR
 void ListEntitiesBinarySensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->object_id_ref_);
@@ -211,12 +241,14 @@ void ListEntitiesBinarySensorResponse::calculate_size(uint32_t &total_size) cons
 #endif
 }
 void BinarySensorStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_bool(2, this->state);
-  buffer.encode_bool(3, this->missing_state);
+  uint8_t *pos = buffer.begin_unchecked(MAX_ENCODED_SIZE);
+  pos = ProtoWriteBuffer::encode_fixed32_unchecked<1>(pos, this->key);
+  pos = ProtoWriteBuffer::encode_bool_unchecked<2>(pos, this->state);
+  pos = ProtoWriteBuffer::encode_bool_unchecked<3>(pos, this->missing_state);
 #ifdef USE_DEVICES
-  buffer.encode_uint32(4, this->device_id);
+  pos = ProtoWriteBuffer::encode_uint32_unchecked<4>(pos, this->device_id);
 #endif
+  buffer.end_unchecked(pos);
 }
 void BinarySensorStateResponse::calculate_size(uint32_t &total_size) const {
   ProtoSize::add_fixed32_field(total_size, 1, this->key);
@@ -674,12 +706,14 @@ void ListEntitiesSensorResponse::calculate_size(uint32_t &total_size) const {
 #endif
 }
 void SensorStateResponse::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_fixed32(1, this->key);
-  buffer.encode_float(2, this->state);
-  buffer.encode_bool(3, this->missing_state);
+  uint8_t *pos = buffer.begin_unchecked(MAX_ENCODED_SIZE);
+  pos = ProtoWriteBuffer::encode_fixed32_unchecked<1>(pos, this->key);
+  pos = ProtoWriteBuffer::encode_float_unchecked<2>(pos, this->state);
+  pos = ProtoWriteBuffer::encode_bool_unchecked<3>(pos, this->missing_state);
 #ifdef USE_DEVICES
-  buffer.encode_uint32(4, this->device_id);
+  pos = ProtoWriteBuffer::encode_uint32_unchecked<4>(pos, this->device_id);
 #endif
+  buffer.end_unchecked(pos);
 }
 void SensorStateResponse::calculate_size(uint32_t &total_size) const {
   ProtoSize::add_fixed32_field(total_size, 1, this->key);
@@ -815,6 +849,11 @@ bool SubscribeLogsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
     case 2:
       this->dump_config = value.as_bool();
       break;
+#ifdef USE_API_BINARY_LOGS
+    case 3:
+      this->deferred_formatting = value.as_bool();
+      break;
+#endif
     default:
       return false;
   }
@@ -823,10 +862,34 @@ bool SubscribeLogsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
 void SubscribeLogsResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(1, static_cast<uint32_t>(this->level));
   buffer.encode_bytes(3, this->message_ptr_, this->message_len_);
+#ifdef USE_API_BINARY_LOGS
+  buffer.encode_fixed32(4, this->format_address);
+#endif
+#ifdef USE_API_BINARY_LOGS
+  buffer.encode_fixed32(5, this->tag_address);
+#endif
+#ifdef USE_API_BINARY_LOGS
+  buffer.encode_uint32(6, this->line);
+#endif
+#ifdef USE_API_BINARY_LOGS
+  buffer.encode_bytes(7, this->args_ptr_, this->args_len_);
+#endif
 }
 void SubscribeLogsResponse::calculate_size(uint32_t &total_size) const {
   ProtoSize::add_enum_field(total_size, 1, static_cast<uint32_t>(this->level));
   ProtoSize::add_bytes_field(total_size, 1, this->message_len_);
+#ifdef USE_API_BINARY_LOGS
+  ProtoSize::add_fixed32_field(total_size, 1, this->format_address);
+#endif
+#ifdef USE_API_BINARY_LOGS
+  ProtoSize::add_fixed32_field(total_size, 1, this->tag_address);
+#endif
+#ifdef USE_API_BINARY_LOGS
+  ProtoSize::add_uint32_field(total_size, 1, this->line);
+#endif
+#ifdef USE_API_BINARY_LOGS
+  ProtoSize::add_bytes_field(total_size, 1, this->args_len_);
+#endif
 }
 #ifdef USE_API_NOISE
 bool NoiseEncryptionSetKeyRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
@@ -1080,13 +1143,13 @@ void ListEntitiesClimateResponse::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->supported_swing_modes) {
     buffer.encode_uint32(14, static_cast<uint32_t>(it), true);
   }
-  for (auto &it : this->supported_custom_fan_modes) {
+  for (auto &it : *this->supported_custom_fan_modes) {
     buffer.encode_string(15, it, true);
   }
   for (auto &it : this->supported_presets) {
     buffer.encode_uint32(16, static_cast<uint32_t>(it), true);
   }
-  for (auto &it : this->supported_custom_presets) {
+  for (auto &it : *this->supported_custom_presets) {
     buffer.encode_string(17, it, true);
   }
   buffer.encode_bool(18, this->disabled_by_default);
@@ -1128,8 +1191,8 @@ void ListEntitiesClimateResponse::calculate_size(uint32_t &total_size) const {
       ProtoSize::add_enum_field_repeated(total_size, 1, static_cast<uint32_t>(it));
     }
   }
-  if (!this->supported_custom_fan_modes.empty()) {
-    for (const auto &it : this->supported_custom_fan_modes) {
+  if (!this->supported_custom_fan_modes->empty()) {
+    for (const auto &it : *this->supported_custom_fan_modes) {
       ProtoSize::add_string_field_repeated(total_size, 1, it);
     }
   }
@@ -1138,8 +1201,8 @@ void ListEntitiesClimateResponse::calculate_size(uint32_t &total_size) const {
       ProtoSize::add_enum_field_repeated(total_size, 2, static_cast<uint32_t>(it));
     }
   }
-  if (!this->supported_custom_presets.empty()) {
-    for (const auto &it : this->supported_custom_presets) {
+  if (!this->supported_custom_presets->empty()) {
+    for (const auto &it : *this->supported_custom_presets) {
       ProtoSize::add_string_field_repeated(total_size, 2, it);
     }
   }
@@ -1374,7 +1437,7 @@ void ListEntitiesSelectResponse::encode(ProtoWriteBuffer buffer) const {
 #ifdef USE_ENTITY_ICON
   buffer.encode_string(5, this->icon_ref_);
 #endif
-  for (auto &it : this->options) {
+  for (auto &it : *this->options) {
     buffer.encode_string(6, it, true);
   }
   buffer.encode_bool(7, this->disabled_by_default);
@@ -1390,8 +1453,8 @@ void ListEntitiesSelectResponse::calculate_size(uint32_t &total_size) const {
 #ifdef USE_ENTITY_ICON
   ProtoSize::add_string_field(total_size, 1, this->icon_ref_.size());
 #endif
-  if (!this->options.empty()) {
-    for (const auto &it : this->options) {
+  if (!this->options->empty()) {
+    for (const auto &it : *this->options) {
       ProtoSize::add_string_field_repeated(total_size, 1, it);
     }
   }
@@ -1828,10 +1891,12 @@ bool SubscribeBluetoothLEAdvertisementsRequest::decode_varint(uint32_t field_id,
   return true;
 }
 void BluetoothLERawAdvertisement::encode(ProtoWriteBuffer buffer) const {
-  buffer.encode_uint64(1, this->address);
-  buffer.encode_sint32(2, this->rssi);
-  buffer.encode_uint32(3, this->address_type);
-  buffer.encode_bytes(4, this->data, this->data_len);
+  uint8_t *pos = buffer.begin_unchecked(MAX_ENCODED_SIZE);
+  pos = ProtoWriteBuffer::encode_uint64_unchecked<1>(pos, this->address);
+  pos = ProtoWriteBuffer::encode_sint32_unchecked<2>(pos, this->rssi);
+  pos = ProtoWriteBuffer::encode_uint32_unchecked<3>(pos, this->address_type);
+  pos = ProtoWriteBuffer::encode_bytes_unchecked<4>(pos, this->data, this->data_len);
+  buffer.end_unchecked(pos);
 }
 void BluetoothLERawAdvertisement::calculate_size(uint32_t &total_size) const {
   ProtoSize::add_uint64_field(total_size, 1, this->address);
@@ -1843,7 +1908,7 @@ void BluetoothLERawAdvertisement::calculate_size(uint32_t &total_size) const {
 }
 void BluetoothLERawAdvertisementsResponse::encode(ProtoWriteBuffer buffer) const {
   for (auto &it : this->advertisements) {
-    buffer.encode_message(1, it, true);
+    buffer.encode_fixed_layout_message(1, it);
   }
 }
 void BluetoothLERawAdvertisementsResponse::calculate_size(uint32_t &total_size) const {
@@ -2164,11 +2229,15 @@ void VoiceAssistantAudioSettings::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(1, this->noise_suppression_level);
   buffer.encode_uint32(2, this->auto_gain);
   buffer.encode_float(3, this->volume_multiplier);
+  buffer.encode_uint32(4, static_cast<uint32_t>(this->codec));
+  buffer.encode_uint32(5, this->bitrate);
 }
 void VoiceAssistantAudioSettings::calculate_size(uint32_t &total_size) const {
   ProtoSize::add_uint32_field(total_size, 1, this->noise_suppression_level);
   ProtoSize::add_uint32_field(total_size, 1, this->auto_gain);
   ProtoSize::add_float_field(total_size, 1, this->volume_multiplier);
+  ProtoSize::add_enum_field(total_size, 1, static_cast<uint32_t>(this->codec));
+  ProtoSize::add_uint32_field(total_size, 1, this->bitrate);
 }
 void VoiceAssistantRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(1, this->start);
@@ -2192,6 +2261,9 @@ bool VoiceAssistantResponse::decode_varint(uint32_t field_id, ProtoVarInt value)
     case 2:
       this->error = value.as_bool();
       break;
+    case 3:
+      this->audio_codec = static_cast<enums::VoiceAssistantAudioCodec>(value.as_uint32());
+      break;
     default:
       return false;
   }
@@ -2702,7 +2774,7 @@ void ListEntitiesEventResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(6, this->disabled_by_default);
   buffer.encode_uint32(7, static_cast<uint32_t>(this->entity_category));
   buffer.encode_string(8, this->device_class_ref_);
-  for (auto &it : this->event_types) {
+  for (auto &it : *this->event_types) {
     buffer.encode_string(9, it, true);
   }
 #ifdef USE_DEVICES
@@ -2719,8 +2791,8 @@ void ListEntitiesEventResponse::calculate_size(uint32_t &total_size) const {
   ProtoSize::add_bool_field(total_size, 1, this->disabled_by_default);
   ProtoSize::add_enum_field(total_size, 1, static_cast<uint32_t>(this->entity_category));
   ProtoSize::add_string_field(total_size, 1, this->device_class_ref_.size());
-  if (!this->event_types.empty()) {
-    for (const auto &it : this->event_types) {
+  if (!this->event_types->empty()) {
+    for (const auto &it : *this->event_types) {
       ProtoSize::add_string_field_repeated(total_size, 1, it);
     }
   }
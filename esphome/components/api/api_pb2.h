@@ -7,6 +7,8 @@
 
 #include "proto.h"
 
+#include <set>
+
 namespace esphome {
 namespace api {
 
@@ -196,6 +198,10 @@ enum VoiceAssistantRequestFlag : uint32_t {
   VOICE_ASSISTANT_REQUEST_USE_WAKE_WORD = 2,
 };
 #ifdef USE_VOICE_ASSISTANT
+enum VoiceAssistantAudioCodec : uint32_t {
+  VOICE_ASSISTANT_AUDIO_CODEC_PCM = 0,
+  VOICE_ASSISTANT_AUDIO_CODEC_OPUS = 1,
+};
 enum VoiceAssistantEvent : uint32_t {
   VOICE_ASSISTANT_ERROR = 0,
   VOICE_ASSISTANT_RUN_START = 1,
@@ -576,10 +582,32 @@ class ListEntitiesDoneResponse : public ProtoMessage {
 class SubscribeStatesRequest : public ProtoDecodableMessage {
  public:
   static constexpr uint8_t MESSAGE_TYPE = 20;
-  static constexpr uint8_t ESTIMATED_SIZE = 0;
+  static constexpr uint8_t ESTIMATED_SIZE = 20;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   const char *message_name() const override { return "subscribe_states_request"; }
 #endif
+  uint32_t state_epoch{0};
+  bool request_state_epoch{false};
+  std::vector<uint32_t> entity_keys{};
+  uint32_t min_interval{0};
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override;
+#endif
+
+ protected:
+  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+};
+class SubscribeStatesResponse : public ProtoMessage {
+ public:
+  static constexpr uint8_t MESSAGE_TYPE = 128;
+  static constexpr uint8_t ESTIMATED_SIZE = 4;
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  const char *message_name() const override { return "subscribe_states_response"; }
+#endif
+  uint32_t state_epoch{0};
+  void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -614,6 +642,7 @@ class BinarySensorStateResponse : public StateResponseProtoMessage {
 #endif
   bool state{false};
   bool missing_state{false};
+  static constexpr uint8_t MAX_ENCODED_SIZE = 15;
   void encode(ProtoWriteBuffer buffer) const override;
   void calculate_size(uint32_t &total_size) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -876,6 +905,7 @@ class SensorStateResponse : public StateResponseProtoMessage {
 #endif
   float state{0.0f};
   bool missing_state{false};
+  static constexpr uint8_t MAX_ENCODED_SIZE = 18;
   void encode(ProtoWriteBuffer buffer) const override;
   void calculate_size(uint32_t &total_size) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -977,12 +1007,15 @@ class TextSensorStateResponse : public StateResponseProtoMessage {
 class SubscribeLogsRequest : public ProtoDecodableMessage {
  public:
   static constexpr uint8_t MESSAGE_TYPE = 28;
-  static constexpr uint8_t ESTIMATED_SIZE = 4;
+  static constexpr uint8_t ESTIMATED_SIZE = 6;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   const char *message_name() const override { return "subscribe_logs_request"; }
 #endif
   enums::LogLevel level{};
   bool dump_config{false};
+#ifdef USE_API_BINARY_LOGS
+  bool deferred_formatting{false};
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -993,7 +1026,7 @@ class SubscribeLogsRequest : public ProtoDecodableMessage {
 class SubscribeLogsResponse : public ProtoMessage {
  public:
   static constexpr uint8_t MESSAGE_TYPE = 29;
-  static constexpr uint8_t ESTIMATED_SIZE = 11;
+  static constexpr uint8_t ESTIMATED_SIZE = 34;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   const char *message_name() const override { return "subscribe_logs_response"; }
 #endif
@@ -1004,6 +1037,23 @@ class SubscribeLogsResponse : public ProtoMessage {
     this->message_ptr_ = data;
     this->message_len_ = len;
   }
+#ifdef USE_API_BINARY_LOGS
+  uint32_t format_address{0};
+#endif
+#ifdef USE_API_BINARY_LOGS
+  uint32_t tag_address{0};
+#endif
+#ifdef USE_API_BINARY_LOGS
+  uint32_t line{0};
+#endif
+#ifdef USE_API_BINARY_LOGS
+  const uint8_t *args_ptr_{nullptr};
+  size_t args_len_{0};
+  void set_args(const uint8_t *data, size_t len) {
+    this->args_ptr_ = data;
+    this->args_len_ = len;
+  }
+#endif
   void encode(ProtoWriteBuffer buffer) const override;
   void calculate_size(uint32_t &total_size) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -1316,9 +1366,9 @@ class ListEntitiesClimateResponse : public InfoResponseProtoMessage {
   bool supports_action{false};
   std::vector<enums::ClimateFanMode> supported_fan_modes{};
   std::vector<enums::ClimateSwingMode> supported_swing_modes{};
-  std::vector<std::string> supported_custom_fan_modes{};
+  const std::set<std::string> *supported_custom_fan_modes{};
   std::vector<enums::ClimatePreset> supported_presets{};
-  std::vector<std::string> supported_custom_presets{};
+  const std::set<std::string> *supported_custom_presets{};
   float visual_current_temperature_step{0.0f};
   bool supports_current_humidity{false};
   bool supports_target_humidity{false};
@@ -1465,7 +1515,7 @@ class ListEntitiesSelectResponse : public InfoResponseProtoMessage {
 #ifdef HAS_PROTO_MESSAGE_DUMP
   const char *message_name() const override { return "list_entities_select_response"; }
 #endif
-  std::vector<std::string> options{};
+  const std::vector<std::string> *options{};
   void encode(ProtoWriteBuffer buffer) const override;
   void calculate_size(uint32_t &total_size) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -1761,6 +1811,7 @@ class BluetoothLERawAdvertisement : public ProtoMessage {
   uint32_t address_type{0};
   uint8_t data[62]{};
   uint8_t data_len{0};
+  static constexpr uint8_t MAX_ENCODED_SIZE = 87;
   void encode(ProtoWriteBuffer buffer) const override;
   void calculate_size(uint32_t &total_size) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -2246,6 +2297,8 @@ class VoiceAssistantAudioSettings : public ProtoMessage {
   uint32_t noise_suppression_level{0};
   uint32_t auto_gain{0};
   float volume_multiplier{0.0f};
+  enums::VoiceAssistantAudioCodec codec{};
+  uint32_t bitrate{0};
   void encode(ProtoWriteBuffer buffer) const override;
   void calculate_size(uint32_t &total_size) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -2279,12 +2332,13 @@ class VoiceAssistantRequest : public ProtoMessage {
 class VoiceAssistantResponse : public ProtoDecodableMessage {
  public:
   static constexpr uint8_t MESSAGE_TYPE = 91;
-  static constexpr uint8_t ESTIMATED_SIZE = 6;
+  static constexpr uint8_t ESTIMATED_SIZE = 8;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   const char *message_name() const override { return "voice_assistant_response"; }
 #endif
   uint32_t port{0};
   bool error{false};
+  enums::VoiceAssistantAudioCodec audio_codec{};
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -2692,7 +2746,7 @@ class ListEntitiesEventResponse : public InfoResponseProtoMessage {
 #endif
   StringRef device_class_ref_{};
   void set_device_class(const StringRef &ref) { this->device_class_ref_ = ref; }
-  std::vector<std::string> event_types{};
+  const std::set<std::string> *event_types{};
   void encode(ProtoWriteBuffer buffer) const override;
   void calculate_size(uint32_t &total_size) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
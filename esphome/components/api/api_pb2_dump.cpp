@@ -414,6 +414,16 @@ template<> const char *proto_enum_to_string<enums::VoiceAssistantRequestFlag>(en
   }
 }
 #ifdef USE_VOICE_ASSISTANT
+template<> const char *proto_enum_to_string<enums::VoiceAssistantAudioCodec>(enums::VoiceAssistantAudioCodec value) {
+  switch (value) {
+    case enums::VOICE_ASSISTANT_AUDIO_CODEC_PCM:
+      return "VOICE_ASSISTANT_AUDIO_CODEC_PCM";
+    case enums::VOICE_ASSISTANT_AUDIO_CODEC_OPUS:
+      return "VOICE_ASSISTANT_AUDIO_CODEC_OPUS";
+    default:
+      return "UNKNOWN";
+  }
+}
 template<> const char *proto_enum_to_string<enums::VoiceAssistantEvent>(enums::VoiceAssistantEvent value) {
   switch (value) {
     case enums::VOICE_ASSISTANT_ERROR:
@@ -773,7 +783,40 @@ void DeviceInfoResponse::dump_to(std::string &out) const {
 }
 void ListEntitiesRequest::dump_to(std::string &out) const { out.append("ListEntitiesRequest {}"); }
 void ListEntitiesDoneResponse::dump_to(std::string &out) const { out.append("ListEntitiesDoneResponse {}"); }
-void SubscribeStatesRequest::dump_to(std::string &out) const { out.append("SubscribeStatesRequest {}"); }
+void SubscribeStatesRequest::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("SubscribeStatesRequest {\n");
+  out.append("  state_epoch: ");
+  snprintf(buffer, sizeof(buffer), "%" PRIu32, this->state_epoch);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  request_state_epoch: ");
+  out.append(YESNO(this->request_state_epoch));
+  out.append("\n");
+
+  for (const auto &it : this->entity_keys) {
+    out.append("  entity_keys: ");
+    snprintf(buffer, sizeof(buffer), "%" PRIu32, it);
+    out.append(buffer);
+    out.append("\n");
+  }
+
+  out.append("  min_interval: ");
+  snprintf(buffer, sizeof(buffer), "%" PRIu32, this->min_interval);
+  out.append(buffer);
+  out.append("\n");
+  out.append("}");
+}
+void SubscribeStatesResponse::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("SubscribeStatesResponse {\n");
+  out.append("  state_epoch: ");
+  snprintf(buffer, sizeof(buffer), "%" PRIu32, this->state_epoch);
+  out.append(buffer);
+  out.append("\n");
+  out.append("}");
+}
 #ifdef USE_BINARY_SENSOR
 void ListEntitiesBinarySensorResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1667,6 +1710,13 @@ void SubscribeLogsRequest::dump_to(std::string &out) const {
   out.append("  dump_config: ");
   out.append(YESNO(this->dump_config));
   out.append("\n");
+
+#ifdef USE_API_BINARY_LOGS
+  out.append("  deferred_formatting: ");
+  out.append(YESNO(this->deferred_formatting));
+  out.append("\n");
+
+#endif
   out.append("}");
 }
 void SubscribeLogsResponse::dump_to(std::string &out) const {
@@ -1679,6 +1729,34 @@ void SubscribeLogsResponse::dump_to(std::string &out) const {
   out.append("  message: ");
   out.append(format_hex_pretty(this->message_ptr_, this->message_len_));
   out.append("\n");
+
+#ifdef USE_API_BINARY_LOGS
+  out.append("  format_address: ");
+  snprintf(buffer, sizeof(buffer), "%" PRIu32, this->format_address);
+  out.append(buffer);
+  out.append("\n");
+
+#endif
+#ifdef USE_API_BINARY_LOGS
+  out.append("  tag_address: ");
+  snprintf(buffer, sizeof(buffer), "%" PRIu32, this->tag_address);
+  out.append(buffer);
+  out.append("\n");
+
+#endif
+#ifdef USE_API_BINARY_LOGS
+  out.append("  line: ");
+  snprintf(buffer, sizeof(buffer), "%" PRIu32, this->line);
+  out.append(buffer);
+  out.append("\n");
+
+#endif
+#ifdef USE_API_BINARY_LOGS
+  out.append("  args: ");
+  out.append(format_hex_pretty(this->args_ptr_, this->args_len_));
+  out.append("\n");
+
+#endif
   out.append("}");
 }
 #ifdef USE_API_NOISE
@@ -2030,7 +2108,7 @@ void ListEntitiesClimateResponse::dump_to(std::string &out) const {
     out.append("\n");
   }
 
-  for (const auto &it : this->supported_custom_fan_modes) {
+  for (const auto &it : *this->supported_custom_fan_modes) {
     out.append("  supported_custom_fan_modes: ");
     append_quoted_string(out, StringRef(it));
     out.append("\n");
@@ -2042,7 +2120,7 @@ void ListEntitiesClimateResponse::dump_to(std::string &out) const {
     out.append("\n");
   }
 
-  for (const auto &it : this->supported_custom_presets) {
+  for (const auto &it : *this->supported_custom_presets) {
     out.append("  supported_custom_presets: ");
     append_quoted_string(out, StringRef(it));
     out.append("\n");
@@ -2410,7 +2488,7 @@ void ListEntitiesSelectResponse::dump_to(std::string &out) const {
   out.append("\n");
 
 #endif
-  for (const auto &it : this->options) {
+  for (const auto &it : *this->options) {
     out.append("  options: ");
     append_quoted_string(out, StringRef(it));
     out.append("\n");
@@ -3422,6 +3500,15 @@ void VoiceAssistantAudioSettings::dump_to(std::string &out) const {
   snprintf(buffer, sizeof(buffer), "%g", this->volume_multiplier);
   out.append(buffer);
   out.append("\n");
+
+  out.append("  codec: ");
+  out.append(proto_enum_to_string<enums::VoiceAssistantAudioCodec>(this->codec));
+  out.append("\n");
+
+  out.append("  bitrate: ");
+  snprintf(buffer, sizeof(buffer), "%" PRIu32, this->bitrate);
+  out.append(buffer);
+  out.append("\n");
   out.append("}");
 }
 void VoiceAssistantRequest::dump_to(std::string &out) const {
@@ -3460,6 +3547,10 @@ void VoiceAssistantResponse::dump_to(std::string &out) const {
   out.append("  error: ");
   out.append(YESNO(this->error));
   out.append("\n");
+
+  out.append("  audio_codec: ");
+  out.append(proto_enum_to_string<enums::VoiceAssistantAudioCodec>(this->audio_codec));
+  out.append("\n");
   out.append("}");
 }
 void VoiceAssistantEventData::dump_to(std::string &out) const {
@@ -4073,7 +4164,7 @@ void ListEntitiesEventResponse::dump_to(std::string &out) const {
   append_quoted_string(out, this->device_class_ref_);
   out.append("\n");
 
-  for (const auto &it : this->event_types) {
+  for (const auto &it : *this->event_types) {
     out.append("  event_types: ");
     append_quoted_string(out, StringRef(it));
     out.append("\n");
@@ -1,6 +1,7 @@
 #include "api_server.h"
 #ifdef USE_API
 #include <cerrno>
+#include <cstring>
 #include "api_connection.h"
 #include "esphome/components/network/util.h"
 #include "esphome/core/application.h"
@@ -21,6 +22,135 @@ namespace api {
 
 static const char *const TAG = "api";
 
+#ifdef USE_API_BINARY_LOGS
+static void append_log_varint(std::vector<uint8_t> &out, uint64_t value) {
+  while (value > 0x7F) {
+    out.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+static void append_log_signed(std::vector<uint8_t> &out, int64_t value) {
+  // Zigzag encode so small negative numbers stay short
+  append_log_varint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+/// Serialize the arguments of a printf style log call in the layout of SubscribeLogsResponse.args.
+/// Walks the conversions of the format string to know the type of every argument, which is much
+/// cheaper than formatting them. Stops at a conversion it does not know, the size of the argument
+/// is unknown from there on.
+static void encode_log_args(const char *format, va_list args, std::vector<uint8_t> &out) {
+  out.clear();
+  va_list ap;
+  va_copy(ap, args);
+  const char *p = format;
+  while ((p = strchr(p, '%')) != nullptr) {
+    p++;
+    if (*p == '%') {
+      p++;
+      continue;
+    }
+    while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0')
+      p++;
+    if (*p == '*') {
+      append_log_signed(out, va_arg(ap, int));
+      p++;
+    }
+    while (*p >= '0' && *p <= '9')
+      p++;
+    int precision = -1;
+    if (*p == '.') {
+      p++;
+      if (*p == '*') {
+        precision = va_arg(ap, int);
+        append_log_signed(out, precision);
+        p++;
+      } else {
+        precision = 0;
+        while (*p >= '0' && *p <= '9')
+          precision = precision * 10 + (*p++ - '0');
+      }
+    }
+    // Length modifier, h and hh arguments are promoted to int
+    uint8_t longs = 0;
+    bool size_arg = false;
+    while (*p == 'h' || *p == 'l' || *p == 'z' || *p == 'j' || *p == 't' || *p == 'L') {
+      if (*p == 'l') {
+        longs++;
+      } else if (*p == 'z' || *p == 't') {
+        size_arg = true;
+      } else if (*p == 'j' || *p == 'L') {
+        longs = 2;
+      }
+      p++;
+    }
+    switch (*p) {
+      case 'd':
+      case 'i':
+        if (longs >= 2) {
+          append_log_signed(out, va_arg(ap, long long));
+        } else if (longs == 1) {
+          append_log_signed(out, va_arg(ap, long));
+        } else if (size_arg) {
+          append_log_signed(out, va_arg(ap, ptrdiff_t));
+        } else {
+          append_log_signed(out, va_arg(ap, int));
+        }
+        break;
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'o':
+        if (longs >= 2) {
+          append_log_varint(out, va_arg(ap, unsigned long long));
+        } else if (longs == 1) {
+          append_log_varint(out, va_arg(ap, unsigned long));
+        } else if (size_arg) {
+          append_log_varint(out, va_arg(ap, size_t));
+        } else {
+          append_log_varint(out, va_arg(ap, unsigned int));
+        }
+        break;
+      case 'c':
+        append_log_signed(out, va_arg(ap, int));
+        break;
+      case 'p':
+        append_log_varint(out, reinterpret_cast<uintptr_t>(va_arg(ap, void *)));
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A': {
+        double value = *(p - 1) == 'L' ? static_cast<double>(va_arg(ap, long double)) : va_arg(ap, double);
+        uint8_t bytes[sizeof(double)];
+        memcpy(bytes, &value, sizeof(double));
+        out.insert(out.end(), bytes, bytes + sizeof(double));
+        break;
+      }
+      case 's': {
+        const char *str = va_arg(ap, const char *);
+        if (str == nullptr)
+          str = "(null)";
+        size_t len = precision >= 0 ? strnlen(str, precision) : strlen(str);
+        append_log_varint(out, len);
+        out.insert(out.end(), str, str + len);
+        break;
+      }
+      default:
+        va_end(ap);
+        return;
+    }
+    p++;
+  }
+  va_end(ap);
+}
+#endif
+
 // APIServer
 APIServer *global_api_server = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
@@ -32,6 +162,8 @@ APIServer::APIServer() {
 
 void APIServer::setup() {
   this->setup_controller();
+  // Start from a random epoch so a client's epoch from before a reboot is not mistaken for a recent one
+  this->state_epoch_ = random_uint32();
 
 #ifdef USE_API_NOISE
   uint32_t hash = 88491486UL;
@@ -95,19 +227,46 @@ void APIServer::setup() {
 
 #ifdef USE_LOGGER
   if (logger::global_logger != nullptr) {
-    logger::global_logger->add_on_log_callback(
-        [this](int level, const char *tag, const char *message, size_t message_len) {
-          if (this->shutting_down_) {
-            // Don't try to send logs during shutdown
-            // as it could result in a recursion and
-            // we would be filling a buffer we are trying to clear
+    auto log_callback = [this](int level, const char *tag, const char *message, size_t message_len) {
+      if (this->shutting_down_) {
+        // Don't try to send logs during shutdown
+        // as it could result in a recursion and
+        // we would be filling a buffer we are trying to clear
+        return;
+      }
+      for (auto &c : this->clients_) {
+        if (c->flags_.remove || c->get_log_subscription_level() < level)
+          continue;
+#ifdef USE_API_BINARY_LOGS
+        // Already sent unformatted by the raw callback
+        if (c->is_binary_log_subscription() && logger::global_logger->is_raw_log_sent())
+          continue;
+#endif
+        c->try_send_log_message(level, tag, message, message_len);
+      }
+    };
+#ifdef USE_API_BINARY_LOGS
+    // Only formatted while a client without deferred formatting is subscribed
+    logger::global_logger->add_on_requested_log_callback(std::move(log_callback));
+    logger::global_logger->add_on_raw_log_callback(
+        [this](uint8_t level, const char *tag, int line, const char *format, va_list args) {
+          if (this->shutting_down_)
             return;
-          }
+          bool encoded = false;
           for (auto &c : this->clients_) {
-            if (!c->flags_.remove && c->get_log_subscription_level() >= level)
-              c->try_send_log_message(level, tag, message, message_len);
+            if (c->flags_.remove || !c->is_binary_log_subscription() || c->get_log_subscription_level() < level)
+              continue;
+            if (!encoded) {
+              encode_log_args(format, args, this->log_args_buffer_);
+              encoded = true;
+            }
+            c->try_send_raw_log_message(level, tag, line, format, this->log_args_buffer_);
           }
         });
+#else
+    // Wants nothing until a client subscribes, see update_log_sink_level()
+    logger::global_logger->add_on_log_callback(std::move(log_callback), ESPHOME_LOG_LEVEL_NONE);
+#endif
   }
 #endif
 
@@ -193,6 +352,9 @@ void APIServer::loop() {
       std::swap(this->clients_[client_index], this->clients_.back());
     }
     this->clients_.pop_back();
+#ifdef USE_LOGGER
+    this->update_log_sink_level();
+#endif
 
     // Schedule reboot when last client disconnects
     if (this->clients_.empty() && this->reboot_timeout_ != 0) {
@@ -202,6 +364,18 @@ void APIServer::loop() {
   }
 }
 
+#ifdef USE_LOGGER
+void APIServer::update_log_sink_level() {
+  if (logger::global_logger == nullptr)
+    return;
+  // Let the logger skip formatting messages no client subscribed to
+  uint8_t level = ESPHOME_LOG_LEVEL_NONE;
+  for (auto &c : this->clients_)
+    level = std::max(level, c->get_log_subscription_level());
+  logger::global_logger->set_log_sink_level(this, level);
+}
+#endif
+
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG,
                 "Server:\n"
@@ -255,6 +429,7 @@ void APIServer::handle_disconnect(APIConnection *conn) {}
   void APIServer::on_##entity_name##_update(entity_type *obj) { /* NOLINT(bugprone-macro-parentheses) */ \
     if (obj->is_internal()) \
       return; \
+    this->on_entity_state_change(obj); \
     for (auto &c : this->clients_) \
       c->send_##entity_name##_state(obj); \
   }
@@ -264,6 +439,7 @@ void APIServer::handle_disconnect(APIConnection *conn) {}
   void APIServer::on_##entity_name##_update(entity_type *obj, __VA_ARGS__) { /* NOLINT(bugprone-macro-parentheses) */ \
     if (obj->is_internal()) \
       return; \
+    this->on_entity_state_change(obj); \
     for (auto &c : this->clients_) \
       c->send_##entity_name##_state(obj); \
   }
@@ -351,6 +527,7 @@ void APIServer::on_event(event::Event *obj, const std::string &event_type) {
 void APIServer::on_update(update::UpdateEntity *obj) {
   if (obj->is_internal())
     return;
+  this->on_entity_state_change(obj);
   for (auto &c : this->clients_)
     c->send_update_state(obj);
 }
@@ -376,23 +553,31 @@ void APIServer::send_homeassistant_service_call(const HomeassistantServiceRespon
   }
 }
 
+uint32_t APIServer::state_sub_hash(const std::string &entity_id, const std::string &attribute) {
+  return fnv1_hash(entity_id) ^ (fnv1_hash(attribute) * 31);
+}
+
 void APIServer::subscribe_home_assistant_state(std::string entity_id, optional<std::string> attribute,
-                                               std::function<void(std::string)> f) {
+                                               std::function<void(const std::string &)> f) {
+  uint32_t hash = state_sub_hash(entity_id, attribute.value_or(""));
   this->state_subs_.push_back(HomeAssistantStateSubscription{
       .entity_id = std::move(entity_id),
       .attribute = std::move(attribute),
       .callback = std::move(f),
       .once = false,
+      .hash = hash,
   });
 }
 
 void APIServer::get_home_assistant_state(std::string entity_id, optional<std::string> attribute,
-                                         std::function<void(std::string)> f) {
+                                         std::function<void(const std::string &)> f) {
+  uint32_t hash = state_sub_hash(entity_id, attribute.value_or(""));
   this->state_subs_.push_back(HomeAssistantStateSubscription{
       .entity_id = std::move(entity_id),
       .attribute = std::move(attribute),
       .callback = std::move(f),
       .once = true,
+      .hash = hash,
   });
 };
 
@@ -400,6 +585,20 @@ const std::vector<APIServer::HomeAssistantStateSubscription> &APIServer::get_sta
   return this->state_subs_;
 }
 
+void APIServer::on_home_assistant_state(const std::string &entity_id, const std::string &attribute,
+                                        const std::string &state) {
+  // Hashing the incoming ids once leaves one integer compare per subscription, the strings are only compared on a
+  // hash match to rule out collisions
+  uint32_t hash = state_sub_hash(entity_id, attribute);
+  for (auto &it : this->state_subs_) {
+    if (it.hash != hash || it.entity_id != entity_id)
+      continue;
+    if (it.attribute.has_value() ? *it.attribute != attribute : !attribute.empty())
+      continue;
+    it.callback(state);
+  }
+}
+
 uint16_t APIServer::get_port() const { return this->port_; }
 
 void APIServer::set_reboot_timeout(uint32_t reboot_timeout) { this->reboot_timeout_ = reboot_timeout; }
@@ -11,6 +11,7 @@
 #include "esphome/core/controller.h"
 #include "esphome/core/log.h"
 #include "list_entities.h"
+#include "state_encode_cache.h"
 #include "subscribe_state.h"
 #ifdef USE_API_SERVICES
 #include "user_services.h"
@@ -45,9 +46,26 @@ class APIServer : public Component, public Controller {
   void set_reboot_timeout(uint32_t reboot_timeout);
   void set_batch_delay(uint16_t batch_delay);
   uint16_t get_batch_delay() const { return batch_delay_; }
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  void set_adaptive_batch_delay(uint16_t min_delay, uint16_t max_delay) {
+    this->batch_delay_min_ = min_delay;
+    this->batch_delay_max_ = max_delay;
+  }
+  uint16_t get_batch_delay_min() const { return batch_delay_min_; }
+  uint16_t get_batch_delay_max() const { return batch_delay_max_; }
+#endif
+  bool is_shutting_down() const { return shutting_down_; }
+#ifdef USE_LOGGER
+  /// Report the highest log level any client subscribed to, call when a log subscription changes
+  void update_log_sink_level();
+#endif
 
   // Get reference to shared buffer for API connections
   std::vector<uint8_t> &get_shared_buffer_ref() { return shared_write_buffer_; }
+  // Get the encoded state messages shared between API connections
+  StateEncodeCache &get_state_encode_cache() { return state_encode_cache_; }
+  // Counter bumped on every entity state change, see SubscribeStatesRequest.state_epoch
+  uint32_t get_state_epoch() const { return state_epoch_; }
 
 #ifdef USE_API_NOISE
   bool save_noise_psk(psk_t psk, bool make_active = true);
@@ -56,6 +74,11 @@ class APIServer : public Component, public Controller {
 #endif  // USE_API_NOISE
 
   void handle_disconnect(APIConnection *conn);
+  // Record a state change of the entity before it is sent to the clients
+  void on_entity_state_change(EntityBase *obj) {
+    obj->set_state_generation(static_cast<uint16_t>(++this->state_epoch_));
+    this->state_encode_cache_.on_state_change(obj, this->clients_.size() > 1);
+  }
 #ifdef USE_BINARY_SENSOR
   void on_binary_sensor_update(binary_sensor::BinarySensor *obj) override;
 #endif
@@ -130,15 +153,20 @@ class APIServer : public Component, public Controller {
   struct HomeAssistantStateSubscription {
     std::string entity_id;
     optional<std::string> attribute;
-    std::function<void(std::string)> callback;
+    std::function<void(const std::string &)> callback;
     bool once;
+    /// state_sub_hash() of the entity and attribute, compared before the strings when a state comes in
+    uint32_t hash;
   };
 
   void subscribe_home_assistant_state(std::string entity_id, optional<std::string> attribute,
-                                      std::function<void(std::string)> f);
+                                      std::function<void(const std::string &)> f);
   void get_home_assistant_state(std::string entity_id, optional<std::string> attribute,
-                                std::function<void(std::string)> f);
+                                std::function<void(const std::string &)> f);
   const std::vector<HomeAssistantStateSubscription> &get_state_subs() const;
+  /// Pass a Home Assistant state to the subscriptions of its entity and attribute.
+  void on_home_assistant_state(const std::string &entity_id, const std::string &attribute, const std::string &state);
+  static uint32_t state_sub_hash(const std::string &entity_id, const std::string &attribute);
 #ifdef USE_API_SERVICES
   const std::vector<UserServiceDescriptor *> &get_user_services() const { return this->user_services_; }
 #endif
@@ -165,6 +193,7 @@ class APIServer : public Component, public Controller {
 
   // 4-byte aligned types
   uint32_t reboot_timeout_{300000};
+  uint32_t state_epoch_{0};
 
   // Vectors and strings (12 bytes each on 32-bit)
   std::vector<std::unique_ptr<APIConnection>> clients_;
@@ -172,7 +201,11 @@ class APIServer : public Component, public Controller {
   std::string password_;
 #endif
   std::vector<uint8_t> shared_write_buffer_;  // Shared proto write buffer for all connections
+#ifdef USE_API_BINARY_LOGS
+  std::vector<uint8_t> log_args_buffer_;  // Arguments of the current log message, encoded once for all clients
+#endif
   std::vector<HomeAssistantStateSubscription> state_subs_;
+  StateEncodeCache state_encode_cache_;
 #ifdef USE_API_SERVICES
   std::vector<UserServiceDescriptor *> user_services_;
 #endif
@@ -180,6 +213,10 @@ class APIServer : public Component, public Controller {
   // Group smaller types together
   uint16_t port_{6053};
   uint16_t batch_delay_{100};
+#ifdef USE_API_ADAPTIVE_BATCH_DELAY
+  uint16_t batch_delay_min_{0};
+  uint16_t batch_delay_max_{100};
+#endif
   bool shutting_down_ = false;
   // 5 bytes used, 3 bytes padding
 
@@ -14,7 +14,8 @@ class APIConnection;
 #define LIST_ENTITIES_HANDLER(entity_type, EntityClass, ResponseType) \
   bool ListEntitiesIterator::on_##entity_type(EntityClass *entity) { /* NOLINT(bugprone-macro-parentheses) */ \
     return this->client_->schedule_message_(entity, &APIConnection::try_send_##entity_type##_info, \
-                                            ResponseType::MESSAGE_TYPE, ResponseType::ESTIMATED_SIZE); \
+                                            ResponseType::MESSAGE_TYPE, ResponseType::ESTIMATED_SIZE, \
+                                            APIConnection::BATCH_LANE_BULK); \
   }
 
 class ListEntitiesIterator : public ComponentIterator {
@@ -329,6 +329,95 @@ class ProtoWriteBuffer {
     this->encode_uint64(field_id, uvalue, force);
   }
   void encode_message(uint32_t field_id, const ProtoMessage &value, bool force = false);
+  /**
+   * Encode a nested message generated with the fixed_layout option in a single pass.
+   *
+   * MAX_ENCODED_SIZE is known at compile time to fit a one-byte length, so the length is
+   * backfilled after encoding instead of running calculate_size() on the message first.
+   */
+  template<typename T> void encode_fixed_layout_message(uint32_t field_id, const T &value) {
+    static_assert(T::MAX_ENCODED_SIZE < 128, "fixed_layout message length must fit in one byte");
+    this->encode_field_raw(field_id, 2);  // type 2: Length-delimited message
+    size_t length_pos = this->buffer_->size();
+    this->write(0);
+    value.T::encode(*this);
+    (*this->buffer_)[length_pos] = static_cast<uint8_t>(this->buffer_->size() - length_pos - 1);
+  }
+
+  /**
+   * Fixed-layout encoding: grow the buffer once by the message's worst-case size and return a raw
+   * write cursor. The *_unchecked encoders below advance the cursor without any capacity checks,
+   * and end_unchecked() trims the buffer back to what was actually written.
+   */
+  uint8_t *begin_unchecked(size_t max_size) {
+    size_t old_size = this->buffer_->size();
+    this->buffer_->resize(old_size + max_size);
+    return this->buffer_->data() + old_size;
+  }
+  void end_unchecked(const uint8_t *pos) { this->buffer_->resize(pos - this->buffer_->data()); }
+
+  static uint8_t *encode_varint_unchecked(uint8_t *pos, uint64_t value) {
+    while (value > 0x7F) {
+      *pos++ = static_cast<uint8_t>(value | 0x80);
+      value >>= 7;
+    }
+    *pos++ = static_cast<uint8_t>(value);
+    return pos;
+  }
+  template<uint32_t FieldId, uint32_t WireType> static uint8_t *encode_tag_unchecked(uint8_t *pos) {
+    constexpr uint32_t TAG = (FieldId << 3) | WireType;
+    static_assert(TAG < 128, "fixed_layout fields must have a single-byte tag");
+    *pos++ = TAG;
+    return pos;
+  }
+  template<uint32_t FieldId> static uint8_t *encode_uint32_unchecked(uint8_t *pos, uint32_t value) {
+    if (value == 0)
+      return pos;
+    pos = encode_tag_unchecked<FieldId, 0>(pos);
+    return encode_varint_unchecked(pos, value);
+  }
+  template<uint32_t FieldId> static uint8_t *encode_uint64_unchecked(uint8_t *pos, uint64_t value) {
+    if (value == 0)
+      return pos;
+    pos = encode_tag_unchecked<FieldId, 0>(pos);
+    return encode_varint_unchecked(pos, value);
+  }
+  template<uint32_t FieldId> static uint8_t *encode_sint32_unchecked(uint8_t *pos, int32_t value) {
+    uint32_t uvalue = value < 0 ? ~(static_cast<uint32_t>(value) << 1) : static_cast<uint32_t>(value) << 1;
+    return encode_uint32_unchecked<FieldId>(pos, uvalue);
+  }
+  template<uint32_t FieldId> static uint8_t *encode_bool_unchecked(uint8_t *pos, bool value) {
+    if (!value)
+      return pos;
+    pos = encode_tag_unchecked<FieldId, 0>(pos);
+    *pos++ = 0x01;
+    return pos;
+  }
+  template<uint32_t FieldId> static uint8_t *encode_fixed32_unchecked(uint8_t *pos, uint32_t value) {
+    if (value == 0)
+      return pos;
+    pos = encode_tag_unchecked<FieldId, 5>(pos);
+    pos[0] = (value >> 0) & 0xFF;
+    pos[1] = (value >> 8) & 0xFF;
+    pos[2] = (value >> 16) & 0xFF;
+    pos[3] = (value >> 24) & 0xFF;
+    return pos + 4;
+  }
+  template<uint32_t FieldId> static uint8_t *encode_float_unchecked(uint8_t *pos, float value) {
+    if (value == 0.0f)
+      return pos;
+    uint32_t raw;
+    std::memcpy(&raw, &value, sizeof(raw));
+    return encode_fixed32_unchecked<FieldId>(pos, raw);
+  }
+  template<uint32_t FieldId> static uint8_t *encode_bytes_unchecked(uint8_t *pos, const uint8_t *data, size_t len) {
+    if (len == 0)
+      return pos;
+    pos = encode_tag_unchecked<FieldId, 2>(pos);
+    pos = encode_varint_unchecked(pos, len);
+    std::memcpy(pos, data, len);
+    return pos + len;
+  }
   std::vector<uint8_t> *get_buffer() const { return buffer_; }
 
  protected:
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#ifdef USE_API
+#include <cstdint>
+#include <vector>
+#include "esphome/core/entity_base.h"
+namespace esphome {
+namespace api {
+
+/** Encoded state messages shared by all API connections.
+ *
+ * When an entity changes state while more than one client is connected, the server reserves an entry for it.
+ * The first connection that encodes the state stores the protobuf payload, the other connections copy it
+ * instead of encoding the message again. Framing and encryption still happen per connection.
+ *
+ * Entries are reused round-robin. If an entry is evicted before every connection sent it, those connections
+ * just encode the message themselves.
+ */
+class StateEncodeCache {
+ public:
+  static constexpr uint8_t SIZE = 16;
+
+  /// Called on every state change, drops the stale payload and reserves an entry if it will be shared.
+  void on_state_change(EntityBase *entity, bool shared) {
+    Entry *entry = this->find_entry_(entity);
+    if (entry == nullptr) {
+      if (!shared)
+        return;
+      entry = &this->entries_[this->next_];
+      this->next_ = (this->next_ + 1) % SIZE;
+      entry->entity = entity;
+    } else if (!shared) {
+      entry->entity = nullptr;
+    }
+    entry->payload.clear();
+  }
+
+  /// Payload buffer for the entity, empty until the first connection encoded it. nullptr if not shared.
+  std::vector<uint8_t> *find(EntityBase *entity) {
+    Entry *entry = this->find_entry_(entity);
+    return entry == nullptr ? nullptr : &entry->payload;
+  }
+
+ protected:
+  struct Entry {
+    EntityBase *entity{nullptr};
+    std::vector<uint8_t> payload;  // Keeps its capacity when the entry is reused
+  };
+
+  Entry *find_entry_(EntityBase *entity) {
+    for (auto &entry : this->entries_) {
+      if (entry.entity == entity)
+        return &entry;
+    }
+    return nullptr;
+  }
+
+  Entry entries_[SIZE];
+  uint8_t next_{0};
+};
+
+}  // namespace api
+}  // namespace esphome
+#endif
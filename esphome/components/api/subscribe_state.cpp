@@ -69,6 +69,20 @@ INITIAL_STATE_HANDLER(update, update::UpdateEntity)
 
 InitialStateIterator::InitialStateIterator(APIConnection *client) : client_(client) {}
 
+void InitialStateIterator::set_state_epoch(uint32_t current_epoch, uint32_t client_epoch, bool send_epoch) {
+  this->snapshot_epoch_ = current_epoch;
+  this->client_epoch_ = client_epoch;
+  // An epoch from before a reboot or too far back can't be compared, send everything in that case
+  this->delta_ = client_epoch != 0 && current_epoch - client_epoch < MAX_DELTA_EPOCH_AGE;
+  this->send_epoch_ = send_epoch;
+}
+
+bool InitialStateIterator::on_end() {
+  if (!this->send_epoch_)
+    return true;
+  return this->client_->send_subscribe_states_response();
+}
+
 }  // namespace api
 }  // namespace esphome
 #endif
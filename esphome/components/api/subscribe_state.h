@@ -11,9 +11,11 @@ namespace api {
 class APIConnection;
 
 // Macro for generating InitialStateIterator handlers
-// Calls send_*_state
+// Calls send_*_state, skipping entities that did not change since the client's state epoch
 #define INITIAL_STATE_HANDLER(entity_type, EntityClass) \
   bool InitialStateIterator::on_##entity_type(EntityClass *entity) { /* NOLINT(bugprone-macro-parentheses) */ \
+    if (!this->changed_since_epoch_(entity)) \
+      return true; \
     return this->client_->send_##entity_type##_state(entity); \
   }
 
@@ -83,10 +85,34 @@ class InitialStateIterator : public ComponentIterator {
 #ifdef USE_UPDATE
   bool on_update(update::UpdateEntity *entity) override;
 #endif
+  bool on_end() override;
   bool completed() { return this->state_ == IteratorState::NONE; }
 
+  /** Configure the next iteration from the client's SubscribeStatesRequest.
+   *
+   * @param current_epoch The server's state epoch now, reported back to the client once all states are sent.
+   * @param client_epoch The epoch the client last received, 0 if it has none.
+   * @param send_epoch Whether to send a SubscribeStatesResponse at the end.
+   */
+  void set_state_epoch(uint32_t current_epoch, uint32_t client_epoch, bool send_epoch);
+  uint32_t get_snapshot_epoch() const { return this->snapshot_epoch_; }
+
+  /// Oldest client epoch that is still answered with a delta, older ones get all states again.
+  static constexpr uint32_t MAX_DELTA_EPOCH_AGE = 0x8000;
+
  protected:
+  bool changed_since_epoch_(EntityBase *entity) const {
+    // Only the low 16 bits are stored per entity, MAX_DELTA_EPOCH_AGE keeps the comparison unambiguous.
+    // Entities that never changed since boot may compare as changed, which only costs an extra message.
+    return !this->delta_ ||
+           static_cast<int16_t>(entity->get_state_generation() - static_cast<uint16_t>(this->client_epoch_)) > 0;
+  }
+
   APIConnection *client_;
+  uint32_t snapshot_epoch_{0};
+  uint32_t client_epoch_{0};
+  bool delta_{false};
+  bool send_epoch_{false};
 };
 
 }  // namespace api
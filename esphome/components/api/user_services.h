@@ -56,7 +56,8 @@ template<typename... Ts> class UserServiceBase : public UserServiceDescriptor {
 
  protected:
   virtual void execute(Ts... x) = 0;
-  template<int... S> void execute_(std::vector<ExecuteServiceArgument> args, seq<S...> type) {
+  // The arguments are only read, copying them would duplicate every string and array of the call
+  template<int... S> void execute_(const std::vector<ExecuteServiceArgument> &args, seq<S...> type) {
     this->execute((get_execute_arg_value<Ts>(args[S]))...);
   }
 
@@ -71,7 +72,7 @@ template<typename... Ts> class UserServiceTrigger : public UserServiceBase<Ts...
       : UserServiceBase<Ts...>(name, arg_names) {}
 
  protected:
-  void execute(Ts... x) override { this->trigger(x...); }  // NOLINT
+  void execute(Ts... x) override { this->trigger(std::move(x)...); }  // NOLINT
 };
 
 }  // namespace api
@@ -1,6 +1,7 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.const import CONF_BITS_PER_SAMPLE, CONF_NUM_CHANNELS, CONF_SAMPLE_RATE
+from esphome.core import CORE
 import esphome.final_validate as fv
 
 CODEOWNERS = ["@kahrendt"]
@@ -164,5 +165,14 @@ def final_validate_audio_schema(
     )
 
 
+def add_audio_stats_stage(var, name: str):
+    """Names the audio stage ``var`` records statistics for, if the audio_stats component is configured
+
+    The name is what the audio_stats sensors use to select the stage, so components pass their own ID.
+    """
+    if "audio_stats" in CORE.loaded_integrations:
+        cg.add(var.set_audio_stats_name(name))
+
+
 async def to_code(config):
     cg.add_library("esphome/esp-audio-libs", "1.1.4")
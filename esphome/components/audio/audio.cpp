@@ -54,14 +54,62 @@ const char *audio_file_type_to_string(AudioFileType file_type) {
   }
 }
 
+// The kernels below work on flat int16 runs without any per-sample channel mapping, so the compiler can keep the loops
+// tight (and vectorize them where the target has a SIMD unit the compiler can use). They can be profiled on the host
+// with script/audio_kernels_benchmark.
+
+static inline int16_t clamp_int16_(int32_t value) {
+  return static_cast<int16_t>(value < INT16_MIN ? INT16_MIN : (value > INT16_MAX ? INT16_MAX : value));
+}
+
 void scale_audio_samples(const int16_t *audio_samples, int16_t *output_buffer, int16_t scale_factor,
                          size_t samples_to_scale) {
   // Note the assembly dsps_mulc function has audio glitches if the input and output buffers are the same.
-  for (int i = 0; i < samples_to_scale; i++) {
+  for (size_t i = 0; i < samples_to_scale; i++) {
     int32_t acc = (int32_t) audio_samples[i] * (int32_t) scale_factor;
     output_buffer[i] = (int16_t) (acc >> 15);
   }
 }
 
+void add_audio_samples(const int16_t *first_samples, const int16_t *second_samples, int16_t *output_buffer,
+                       size_t samples) {
+  for (size_t i = 0; i < samples; i++) {
+    output_buffer[i] = clamp_int16_(static_cast<int32_t>(first_samples[i]) + second_samples[i]);
+  }
+}
+
+void mono_to_stereo_samples(const int16_t *mono_samples, int16_t *stereo_buffer, size_t frames) {
+  for (size_t i = 0; i < frames; i++) {
+    const int16_t sample = mono_samples[i];
+    stereo_buffer[2 * i] = sample;
+    stereo_buffer[2 * i + 1] = sample;
+  }
+}
+
+void stereo_to_mono_samples(const int16_t *stereo_samples, int16_t *mono_buffer, size_t frames) {
+  for (size_t i = 0; i < frames; i++) {
+    mono_buffer[i] = stereo_samples[2 * i];
+  }
+}
+
+void q31_to_q15_audio_samples(const uint8_t *q31_samples, int16_t *output_buffer, int32_t gain_factor,
+                              size_t samples) {
+  if (gain_factor == 1) {
+    // Without gain the conversion is only a truncation to the upper 16 bits
+    for (size_t i = 0; i < samples; i++) {
+      output_buffer[i] = static_cast<int16_t>(q31_samples[4 * i + 2] | (q31_samples[4 * i + 3] << 8));
+    }
+    return;
+  }
+  // Q25 leaves room for gains up to 64 without overflowing, and clamping there keeps the result identical to the
+  // generic conversion
+  static const int32_t Q25_MAX = (1 << 25) - 1;
+  for (size_t i = 0; i < samples; i++) {
+    int32_t sample = (unpack_audio_sample_to_q31(&q31_samples[4 * i], 4) >> 6) * gain_factor;  // Q25
+    sample = sample < ~Q25_MAX ? ~Q25_MAX : (sample > Q25_MAX ? Q25_MAX : sample);
+    output_buffer[i] = static_cast<int16_t>(sample >> 10);  // Q25 -> Q15
+  }
+}
+
 }  // namespace audio
 }  // namespace esphome
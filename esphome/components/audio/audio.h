@@ -135,6 +135,29 @@ const char *audio_file_type_to_string(AudioFileType file_type);
 void scale_audio_samples(const int16_t *audio_samples, int16_t *output_buffer, int16_t scale_factor,
                          size_t samples_to_scale);
 
+/// @brief Adds two buffers of int16 audio samples, saturating instead of wrapping around. The output buffer may be
+/// one of the inputs.
+/// @param samples Number of samples in each buffer
+void add_audio_samples(const int16_t *first_samples, const int16_t *second_samples, int16_t *output_buffer,
+                       size_t samples);
+
+/// @brief Duplicates mono int16 samples into interleaved stereo frames.
+/// @param frames Number of mono samples in the input and stereo frames in the output
+void mono_to_stereo_samples(const int16_t *mono_samples, int16_t *stereo_buffer, size_t frames);
+
+/// @brief Keeps the left channel of interleaved stereo int16 frames. Converts in place if both buffers are the same.
+/// @param frames Number of stereo frames in the input and mono samples in the output
+void stereo_to_mono_samples(const int16_t *stereo_samples, int16_t *mono_buffer, size_t frames);
+
+/// @brief Converts little endian Q31 samples to int16 while applying an integer gain, clipping like
+/// microphone::MicrophoneSource. The input may be unaligned.
+/// @param q31_samples Input with 4 bytes per sample
+/// @param output_buffer Buffer to store the int16 samples
+/// @param gain_factor Integer gain, from 1 to 64
+/// @param samples Number of samples to convert
+void q31_to_q15_audio_samples(const uint8_t *q31_samples, int16_t *output_buffer, int32_t gain_factor,
+                              size_t samples);
+
 /// @brief Unpacks a quantized audio sample into a Q31 fixed-point number.
 /// @param data Pointer to uint8_t array containing the audio sample
 /// @param bytes_per_sample The number of bytes per sample
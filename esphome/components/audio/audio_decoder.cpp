@@ -184,7 +184,17 @@ AudioDecoderState AudioDecoder::decode(bool stop_gracefully) {
     } else if (this->input_transfer_buffer_->available() == 0) {
       // No data to decode, attempt to get more data next time
       state = FileDecoderState::IDLE;
+#ifdef USE_AUDIO_STATS
+      if ((this->stats_ != nullptr) && !this->input_starved_ && !this->end_of_file_ && !stop_gracefully) {
+        this->stats_->record_underrun();
+      }
+      this->input_starved_ = true;
+#endif
     } else {
+#ifdef USE_AUDIO_STATS
+      this->input_starved_ = false;
+      AudioStageTimer timer(this->stats_);
+#endif
       switch (this->audio_file_type_) {
 #ifdef USE_AUDIO_FLAC_SUPPORT
         case AudioFileType::FLAC:
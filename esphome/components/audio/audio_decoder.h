@@ -3,6 +3,7 @@
 #ifdef USE_ESP32
 
 #include "audio.h"
+#include "audio_stats.h"
 #include "audio_transfer_buffer.h"
 
 #include "esphome/core/defines.h"
@@ -99,6 +100,11 @@ class AudioDecoder {
   /// @param pause_state If true, audio data is not sent to the sink.
   void set_pause_output_state(bool pause_state) { this->pause_output_ = pause_state; }
 
+#ifdef USE_AUDIO_STATS
+  /// @brief Records the time spent decoding and how often the input ran dry into `stats`
+  void set_stats(AudioStageStats *stats) { this->stats_ = stats; }
+#endif
+
  protected:
   std::unique_ptr<esp_audio_libs::wav_decoder::WAVDecoder> wav_decoder_;
 #ifdef USE_AUDIO_FLAC_SUPPORT
@@ -128,6 +134,11 @@ class AudioDecoder {
 
   uint32_t accumulated_frames_written_{0};
   uint32_t playback_ms_{0};
+
+#ifdef USE_AUDIO_STATS
+  AudioStageStats *stats_{nullptr};
+  bool input_starved_{true};  // Starts starved so waiting for the first data isn't an underrun
+#endif
 };
 }  // namespace audio
 }  // namespace esphome
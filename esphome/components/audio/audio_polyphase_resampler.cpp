@@ -0,0 +1,169 @@
+#include "audio_polyphase_resampler.h"
+
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace esphome {
+namespace audio {
+
+static const uint16_t MAX_PHASES = 160;           // Enough for 44.1 kHz <-> 48 kHz
+static const size_t MAX_COEFFICIENTS = 8 * 1024;  // 16 kB table
+static const double CUTOFF_ROLLOFF = 0.92;        // Passband edge relative to the lower Nyquist frequency
+static const double KAISER_BETA = 7.0;            // About 72 dB stopband attenuation
+static const double STOPBAND_ATTENUATION_DB = 72.0;
+
+static uint32_t gcd(uint32_t a, uint32_t b) {
+  while (b != 0) {
+    uint32_t t = b;
+    b = a % b;
+    a = t;
+  }
+  return a;
+}
+
+// Zeroth order modified Bessel function of the first kind, for the Kaiser window
+static double bessel_i0(double x) {
+  double sum = 1.0;
+  double term = 1.0;
+  for (int k = 1; k < 32; ++k) {
+    term *= (x / (2.0 * k)) * (x / (2.0 * k));
+    sum += term;
+  }
+  return sum;
+}
+
+static uint32_t taps_for_ratio(uint32_t up, uint32_t down, uint16_t number_of_taps) {
+  if (down <= up)
+    return number_of_taps;
+  // Downsampling narrows the passband, so longer filters keep the same transition width in output terms
+  const uint32_t scaled = (static_cast<uint32_t>(number_of_taps) * down + up - 1) / up;
+  // The transition band is centered on the target Nyquist frequency and reaches from the passband edge to its mirror
+  // image, so whatever still folds back lands above the passband. Kaiser's estimate gives the length this needs,
+  // which grows quickly for ratios close to 1 like 48 kHz -> 44.1 kHz.
+  const double transition = 2.0 * (1.0 - CUTOFF_ROLLOFF) * M_PI * up / down;  // In radians per input frame
+  const auto needed = static_cast<uint32_t>(std::ceil((STOPBAND_ATTENUATION_DB - 8.0) / (2.285 * transition))) + 1;
+  return std::max(scaled, needed);
+}
+
+PolyphaseResampler::~PolyphaseResampler() {
+  if (this->coefficients_ != nullptr) {
+    RAMAllocator<int16_t> allocator;
+    allocator.deallocate(this->coefficients_, this->coefficients_count_);
+  }
+}
+
+bool PolyphaseResampler::is_supported(uint32_t source_sample_rate, uint32_t target_sample_rate,
+                                      uint16_t number_of_taps) {
+  if (source_sample_rate == 0 || target_sample_rate == 0 || number_of_taps == 0)
+    return false;
+  const uint32_t divisor = gcd(source_sample_rate, target_sample_rate);
+  const uint32_t up = target_sample_rate / divisor;
+  const uint32_t down = source_sample_rate / divisor;
+  if (up > MAX_PHASES || down > MAX_PHASES)
+    return false;
+  // Ratios that need a longer filter than the table allows are left to esp-audio-libs
+  return static_cast<size_t>(up) * taps_for_ratio(up, down, number_of_taps) <= MAX_COEFFICIENTS;
+}
+
+bool PolyphaseResampler::initialize(uint32_t source_sample_rate, uint32_t target_sample_rate, uint8_t channels,
+                                    uint16_t number_of_taps, float gain_db) {
+  if (!is_supported(source_sample_rate, target_sample_rate, number_of_taps) || channels == 0)
+    return false;
+
+  const uint32_t divisor = gcd(source_sample_rate, target_sample_rate);
+  this->up_ = target_sample_rate / divisor;
+  this->down_ = source_sample_rate / divisor;
+  this->taps_ = static_cast<uint16_t>(taps_for_ratio(this->up_, this->down_, number_of_taps));
+  this->channels_ = channels;
+  this->phase_ = 0;
+
+  RAMAllocator<int16_t> allocator;
+  if (this->coefficients_ != nullptr)
+    allocator.deallocate(this->coefficients_, this->coefficients_count_);
+  this->coefficients_count_ = static_cast<size_t>(this->up_) * this->taps_;
+  this->coefficients_ = allocator.allocate(this->coefficients_count_);
+  if (this->coefficients_ == nullptr)
+    return false;
+
+  // Windowed sinc sampled at the input frames around each phase's output position, in input frame units. Downsampling
+  // cuts off at the target Nyquist frequency, see taps_for_ratio(). Upsampling keeps the source passband up to the
+  // rolloff.
+  const double cutoff = this->down_ > this->up_ ? static_cast<double>(this->up_) / this->down_ : CUTOFF_ROLLOFF;
+  const double half_width = this->taps_ / 2.0;
+  const double center = (this->taps_ - 1) / 2.0;
+  const double gain = std::pow(10.0, gain_db / 20.0);
+  const double window_scale = 1.0 / bessel_i0(KAISER_BETA);
+
+  std::vector<double> phase_coefficients(this->taps_);
+  for (uint16_t phase = 0; phase < this->up_; ++phase) {
+    double sum = 0.0;
+    for (uint16_t tap = 0; tap < this->taps_; ++tap) {
+      const double x = tap - center - static_cast<double>(phase) / this->up_;
+      const double arg = M_PI * cutoff * x;
+      const double sinc = (std::fabs(arg) < 1e-9) ? 1.0 : std::sin(arg) / arg;
+      const double ratio = std::min(1.0, std::fabs(x) / half_width);
+      const double window = bessel_i0(KAISER_BETA * std::sqrt(1.0 - ratio * ratio)) * window_scale;
+      phase_coefficients[tap] = sinc * window;
+      sum += phase_coefficients[tap];
+    }
+    // Normalize every phase to the same DC gain, otherwise the phases' ripple adds a tone at the up rate
+    int16_t *coefficients = this->coefficients_ + static_cast<size_t>(phase) * this->taps_;
+    for (uint16_t tap = 0; tap < this->taps_; ++tap) {
+      const double q15 = std::round(phase_coefficients[tap] / sum * gain * 32768.0);
+      coefficients[tap] = static_cast<int16_t>(clamp<double>(q15, INT16_MIN, INT16_MAX));
+    }
+  }
+  return true;
+}
+
+PolyphaseResamplerResults PolyphaseResampler::resample(const int16_t *input, uint32_t input_frames, int16_t *output,
+                                                       uint32_t output_frames) {
+  const uint8_t channels = this->channels_;
+  const uint16_t taps = this->taps_;
+
+  uint32_t frame = 0;  // First input frame of the current output frame's filter
+  uint32_t generated = 0;
+  while ((generated < output_frames) && (frame + taps <= input_frames)) {
+    const int16_t *coefficients = this->coefficients_ + static_cast<size_t>(this->phase_) * taps;
+    const int16_t *samples = input + static_cast<size_t>(frame) * channels;
+
+    if (channels == 1) {
+      int32_t acc = 1 << 14;  // Rounds the Q15 result
+      for (uint16_t tap = 0; tap < taps; ++tap) {
+        acc += static_cast<int32_t>(samples[tap]) * coefficients[tap];
+      }
+      output[generated] = static_cast<int16_t>(clamp<int32_t>(acc >> 15, INT16_MIN, INT16_MAX));
+    } else if (channels == 2) {
+      int32_t left = 1 << 14;
+      int32_t right = 1 << 14;
+      for (uint16_t tap = 0; tap < taps; ++tap) {
+        left += static_cast<int32_t>(samples[2 * tap]) * coefficients[tap];
+        right += static_cast<int32_t>(samples[2 * tap + 1]) * coefficients[tap];
+      }
+      output[2 * generated] = static_cast<int16_t>(clamp<int32_t>(left >> 15, INT16_MIN, INT16_MAX));
+      output[2 * generated + 1] = static_cast<int16_t>(clamp<int32_t>(right >> 15, INT16_MIN, INT16_MAX));
+    } else {
+      for (uint8_t channel = 0; channel < channels; ++channel) {
+        int32_t acc = 1 << 14;
+        for (uint16_t tap = 0; tap < taps; ++tap) {
+          acc += static_cast<int32_t>(samples[tap * channels + channel]) * coefficients[tap];
+        }
+        output[generated * channels + channel] = static_cast<int16_t>(clamp<int32_t>(acc >> 15, INT16_MIN, INT16_MAX));
+      }
+    }
+    ++generated;
+
+    this->phase_ += this->down_;
+    frame += this->phase_ / this->up_;
+    this->phase_ %= this->up_;
+  }
+
+  // Frames past the needed history can be dropped by the caller
+  return {std::min(frame, input_frames), generated};
+}
+
+}  // namespace audio
+}  // namespace esphome
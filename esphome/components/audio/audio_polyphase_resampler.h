@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace audio {
+
+struct PolyphaseResamplerResults {
+  uint32_t frames_used;
+  uint32_t frames_generated;
+};
+
+class PolyphaseResampler {
+  /*
+   * @brief Fixed-ratio polyphase resampler for interleaved int16 audio.
+   * Converts between sample rates whose ratio reduces to up/down with a small up factor, like 48 kHz -> 16 kHz
+   * (1/3) or 44.1 kHz -> 48 kHz (160/147). Every output sample is a single dot product of Q15 coefficients with the
+   * input, so no prefilter or interpolation pass is needed.
+   *
+   * The resampler keeps no copy of the input. The last frames of each call are still needed for the next output
+   * samples, so they are not reported as used and must be passed in again at the start of the next call.
+   */
+ public:
+  ~PolyphaseResampler();
+
+  /// @brief Tests if the ratio between the sample rates is small enough for a coefficient table.
+  /// @param number_of_taps Taps per phase when upsampling. Downsampling scales it up by the ratio and uses at least
+  /// as many as alias-free decimation needs, which rules out ratios close to 1 like 48 kHz -> 44.1 kHz.
+  static bool is_supported(uint32_t source_sample_rate, uint32_t target_sample_rate, uint16_t number_of_taps);
+
+  /// @brief Computes the coefficient table, with the gain folded in.
+  /// @return true if successful, false if the ratio isn't supported or the table couldn't be allocated
+  bool initialize(uint32_t source_sample_rate, uint32_t target_sample_rate, uint8_t channels, uint16_t number_of_taps,
+                  float gain_db);
+
+  /// @brief Resamples as many frames as fit in the output.
+  /// @param input Interleaved int16 input frames
+  /// @param input_frames Number of frames at input
+  /// @param output Buffer for the interleaved int16 output frames
+  /// @param output_frames Number of frames that fit in output
+  PolyphaseResamplerResults resample(const int16_t *input, uint32_t input_frames, int16_t *output,
+                                     uint32_t output_frames);
+
+  /// @brief Number of input frames needed to generate one output frame. Fewer leftover frames can't be used.
+  uint16_t get_taps() const { return this->taps_; }
+
+ protected:
+  /// Coefficients for every phase, each phase's taps stored contiguously
+  int16_t *coefficients_{nullptr};
+  size_t coefficients_count_{0};
+
+  uint16_t up_{1};
+  uint16_t down_{1};
+  uint16_t taps_{0};
+  uint8_t channels_{1};
+
+  /// Position of the next output frame between the first two input frames, in 1/up_ steps
+  uint32_t phase_{0};
+};
+
+}  // namespace audio
+}  // namespace esphome
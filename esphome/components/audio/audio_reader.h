@@ -54,6 +54,11 @@ class AudioReader {
   /// @return AudioReaderState
   AudioReaderState read();
 
+  /// @brief Bytes read from an http source that are waiting in the transfer buffer for the sink.
+  size_t get_buffered_bytes() const {
+    return this->output_transfer_buffer_ != nullptr ? this->output_transfer_buffer_->available() : 0;
+  }
+
  protected:
   /// @brief Monitors the http client events to attempt determining the file type from the Content-Type header
   static esp_err_t http_event_handler(esp_http_client_event_t *evt);
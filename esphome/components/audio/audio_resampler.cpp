@@ -11,6 +11,9 @@ namespace audio {
 
 static const uint32_t READ_WRITE_TIMEOUT_MS = 20;
 
+// Adjust gain by -3 dB to avoid clipping due to the resampling process
+static const int8_t RESAMPLING_GAIN_DB = -3;
+
 AudioResampler::AudioResampler(size_t input_buffer_size, size_t output_buffer_size)
     : input_buffer_size_(input_buffer_size), output_buffer_size_(output_buffer_size) {
   this->input_transfer_buffer_ = AudioSourceTransferBuffer::create(input_buffer_size);
@@ -57,8 +60,21 @@ esp_err_t AudioResampler::start(AudioStreamInfo &input_stream_info, AudioStreamI
     return ESP_ERR_NOT_SUPPORTED;
   }
 
-  if ((input_stream_info.get_sample_rate() != output_stream_info.get_sample_rate()) ||
-      (input_stream_info.get_bits_per_sample() != output_stream_info.get_bits_per_sample())) {
+  this->resampler_.reset();
+  this->polyphase_resampler_.reset();
+
+  if ((input_stream_info.get_sample_rate() != output_stream_info.get_sample_rate()) &&
+      (input_stream_info.get_bits_per_sample() == 16) && (output_stream_info.get_bits_per_sample() == 16) &&
+      PolyphaseResampler::is_supported(input_stream_info.get_sample_rate(), output_stream_info.get_sample_rate(),
+                                       number_of_taps)) {
+    this->polyphase_resampler_ = make_unique<PolyphaseResampler>();
+    if (!this->polyphase_resampler_->initialize(input_stream_info.get_sample_rate(),
+                                                output_stream_info.get_sample_rate(), input_stream_info.get_channels(),
+                                                number_of_taps, RESAMPLING_GAIN_DB)) {
+      return ESP_ERR_NO_MEM;
+    }
+  } else if ((input_stream_info.get_sample_rate() != output_stream_info.get_sample_rate()) ||
+             (input_stream_info.get_bits_per_sample() != output_stream_info.get_bits_per_sample())) {
     this->resampler_ = make_unique<esp_audio_libs::resampler::Resampler>(
         input_stream_info.bytes_to_samples(this->input_buffer_size_),
         output_stream_info.bytes_to_samples(this->output_buffer_size_));
@@ -116,22 +132,39 @@ AudioResamplerState AudioResampler::resample(bool stop_gracefully, int32_t *ms_d
   const size_t bytes_available = this->input_transfer_buffer_->available();
   const uint32_t frames_available = this->input_stream_info_.bytes_to_frames(bytes_available);
 
-  if ((this->input_stream_info_.get_sample_rate() != this->output_stream_info_.get_sample_rate()) ||
-      (this->input_stream_info_.get_bits_per_sample() != this->output_stream_info_.get_bits_per_sample())) {
-    // Adjust gain by -3 dB to avoid clipping due to the resampling process
-    esp_audio_libs::resampler::ResamplerResults results =
-        this->resampler_->resample(this->input_transfer_buffer_->get_buffer_start(),
-                                   this->output_transfer_buffer_->get_buffer_end(), frames_available, frames_free, -3);
+#ifdef USE_AUDIO_STATS
+  AudioStageTimer timer(this->stats_);
+#endif
+
+  if ((this->polyphase_resampler_ != nullptr) || (this->resampler_ != nullptr)) {
+    uint32_t frames_used;
+    uint32_t frames_generated;
+    if (this->polyphase_resampler_ != nullptr) {
+      PolyphaseResamplerResults results = this->polyphase_resampler_->resample(
+          reinterpret_cast<const int16_t *>(this->input_transfer_buffer_->get_buffer_start()), frames_available,
+          reinterpret_cast<int16_t *>(this->output_transfer_buffer_->get_buffer_end()), frames_free);
+      frames_used = results.frames_used;
+      frames_generated = results.frames_generated;
+      if (stop_gracefully && (frames_available < this->polyphase_resampler_->get_taps())) {
+        // The source is drained and the last few frames are too short for a full filter, drop them so it can finish
+        frames_used = frames_available;
+      }
+    } else {
+      esp_audio_libs::resampler::ResamplerResults results = this->resampler_->resample(
+          this->input_transfer_buffer_->get_buffer_start(), this->output_transfer_buffer_->get_buffer_end(),
+          frames_available, frames_free, RESAMPLING_GAIN_DB);
+      frames_used = results.frames_used;
+      frames_generated = results.frames_generated;
+    }
 
-    this->input_transfer_buffer_->decrease_buffer_length(this->input_stream_info_.frames_to_bytes(results.frames_used));
-    this->output_transfer_buffer_->increase_buffer_length(
-        this->output_stream_info_.frames_to_bytes(results.frames_generated));
+    this->input_transfer_buffer_->decrease_buffer_length(this->input_stream_info_.frames_to_bytes(frames_used));
+    this->output_transfer_buffer_->increase_buffer_length(this->output_stream_info_.frames_to_bytes(frames_generated));
 
     // Resampling causes slight differences in the durations used versus generated. Computes the difference in
     // millisconds. The callback function passing the played audio duration uses the difference to convert from output
     // duration to input duration.
-    this->accumulated_frames_used_ += results.frames_used;
-    this->accumulated_frames_generated_ += results.frames_generated;
+    this->accumulated_frames_used_ += frames_used;
+    this->accumulated_frames_generated_ += frames_generated;
 
     const int32_t used_ms =
         this->input_stream_info_.frames_to_milliseconds_with_remainder(&this->accumulated_frames_used_);
@@ -3,6 +3,8 @@
 #ifdef USE_ESP32
 
 #include "audio.h"
+#include "audio_polyphase_resampler.h"
+#include "audio_stats.h"
 #include "audio_transfer_buffer.h"
 
 #include "esphome/core/defines.h"
@@ -55,7 +57,8 @@ class AudioResampler {
   esp_err_t add_sink(speaker::Speaker *speaker);
 #endif
 
-  /// @brief Sets up the class to resample.
+  /// @brief Sets up the class to resample. 16 bit audio whose sample rates have a small integer ratio, like 48 kHz to
+  /// 16 kHz or 44.1 kHz to 48 kHz, uses a PolyphaseResampler. Everything else uses esp-audio-libs' resampler.
   /// @param input_stream_info The incoming sample rate, bits per sample, and number of channels
   /// @param output_stream_info The desired outgoing sample rate, bits per sample, and number of channels
   /// @param number_of_taps Number of taps per FIR filter
@@ -78,6 +81,11 @@ class AudioResampler {
   /// @param pause_state If true, audio data is not sent to the sink.
   void set_pause_output_state(bool pause_state) { this->pause_output_ = pause_state; }
 
+#ifdef USE_AUDIO_STATS
+  /// @brief Records the time spent resampling into `stats`
+  void set_stats(AudioStageStats *stats) { this->stats_ = stats; }
+#endif
+
  protected:
   std::unique_ptr<AudioSourceTransferBuffer> input_transfer_buffer_;
   std::unique_ptr<AudioSinkTransferBuffer> output_transfer_buffer_;
@@ -94,6 +102,11 @@ class AudioResampler {
   AudioStreamInfo output_stream_info_;
 
   std::unique_ptr<esp_audio_libs::resampler::Resampler> resampler_;
+  std::unique_ptr<PolyphaseResampler> polyphase_resampler_;
+
+#ifdef USE_AUDIO_STATS
+  AudioStageStats *stats_{nullptr};
+#endif
 };
 
 }  // namespace audio
@@ -0,0 +1,73 @@
+#include "audio_stats.h"
+
+#ifdef USE_AUDIO_STATS
+
+#include <utility>
+
+namespace esphome {
+namespace audio {
+
+AudioStageStats *AudioStageStats::first_stage = nullptr;
+
+AudioStageStats::AudioStageStats(std::string name) : name_(std::move(name)), last_snapshot_us_(micros()) {
+  // Append so the summary lists the stages in the order they were configured
+  AudioStageStats **tail = &first_stage;
+  while (*tail != nullptr) {
+    tail = &(*tail)->next_;
+  }
+  *tail = this;
+}
+
+AudioStageStats *AudioStageStats::find(const std::string &name) {
+  for (AudioStageStats *stage = first_stage; stage != nullptr; stage = stage->next_) {
+    if (stage->name_ == name)
+      return stage;
+  }
+  return nullptr;
+}
+
+void AudioStageStats::record_fill(size_t bytes_available, size_t bytes_free) {
+  const size_t size = bytes_available + bytes_free;
+  if (size == 0)
+    return;
+
+  const uint32_t fill = static_cast<uint32_t>((static_cast<uint64_t>(bytes_available) * 1000) / size);
+  this->fill_sum_.fetch_add(fill, std::memory_order_relaxed);
+  this->fill_samples_.fetch_add(1, std::memory_order_relaxed);
+
+  // Only the stage's own task lowers the minimum, so a plain compare and store is enough
+  if (fill < this->fill_minimum_.load(std::memory_order_relaxed)) {
+    this->fill_minimum_.store(fill, std::memory_order_relaxed);
+  }
+}
+
+AudioStageSnapshot AudioStageStats::take_snapshot() {
+  AudioStageSnapshot snapshot;
+
+  const uint32_t now = micros();
+  const uint32_t interval_us = now - this->last_snapshot_us_;
+  this->last_snapshot_us_ = now;
+
+  const uint32_t fill_samples = this->fill_samples_.exchange(0, std::memory_order_relaxed);
+  const uint32_t fill_sum = this->fill_sum_.exchange(0, std::memory_order_relaxed);
+  const uint32_t fill_minimum = this->fill_minimum_.exchange(UINT32_MAX, std::memory_order_relaxed);
+  if (fill_samples > 0) {
+    snapshot.buffer_fill = fill_sum / (fill_samples * 10.0f);
+    snapshot.minimum_buffer_fill = fill_minimum / 10.0f;
+  }
+
+  const uint32_t busy_us = this->busy_us_.exchange(0, std::memory_order_relaxed);
+  if (interval_us > 0) {
+    snapshot.busy = 100.0f * busy_us / interval_us;
+  }
+
+  snapshot.underruns = this->underruns_.load(std::memory_order_relaxed);
+  snapshot.buffered_ms = this->buffered_ms_.load(std::memory_order_relaxed);
+
+  return snapshot;
+}
+
+}  // namespace audio
+}  // namespace esphome
+
+#endif
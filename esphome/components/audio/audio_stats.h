@@ -0,0 +1,95 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_AUDIO_STATS
+
+#include "esphome/core/hal.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace esphome {
+namespace audio {
+
+/// Statistics of one audio stage over one reporting interval
+struct AudioStageSnapshot {
+  float buffer_fill{NAN};          // Average percentage of the stage's buffer holding audio, NAN if never sampled
+  float minimum_buffer_fill{NAN};  // Lowest sampled percentage, NAN if never sampled
+  uint32_t underruns{0};           // Total since boot
+  float busy{0.0f};                // Percentage of the interval the stage's task spent processing audio
+  uint32_t buffered_ms{0};         // Audio held by the stage when last sampled
+};
+
+class AudioStageStats {
+  /*
+   * @brief Counters for one stage of the audio path, like a reader, decoder, resampler, mixer or speaker task.
+   * The stage's task records into them and the audio_stats component takes snapshots from the main loop, so every
+   * counter is atomic. Stages link themselves into a global list when constructed during setup and are never
+   * destroyed, so walking the list needs no locking.
+   */
+ public:
+  explicit AudioStageStats(std::string name);
+
+  /// @brief Samples how full the stage's buffer is. Call once per task loop iteration.
+  void record_fill(size_t bytes_available, size_t bytes_free);
+
+  /// @brief Counts a time the stage ran out of input while it was expected to produce audio
+  void record_underrun() { this->underruns_.fetch_add(1, std::memory_order_relaxed); }
+
+  void add_busy_us(uint32_t busy_us) { this->busy_us_.fetch_add(busy_us, std::memory_order_relaxed); }
+
+  /// @brief Sets how much audio the stage currently holds, its share of the end-to-end latency
+  void set_buffered_ms(uint32_t buffered_ms) { this->buffered_ms_.store(buffered_ms, std::memory_order_relaxed); }
+
+  /// @brief Returns the statistics since the previous snapshot and starts a new interval. Only call from the main loop.
+  AudioStageSnapshot take_snapshot();
+
+  const std::string &get_name() const { return this->name_; }
+  AudioStageStats *get_next() const { return this->next_; }
+
+  static AudioStageStats *get_first() { return first_stage; }
+  static AudioStageStats *find(const std::string &name);
+
+ protected:
+  static AudioStageStats *first_stage;
+
+  std::string name_;
+  AudioStageStats *next_{nullptr};
+
+  // Fill levels are in 0.1 % steps
+  std::atomic<uint32_t> fill_sum_{0};
+  std::atomic<uint32_t> fill_samples_{0};
+  std::atomic<uint32_t> fill_minimum_{UINT32_MAX};
+
+  std::atomic<uint32_t> underruns_{0};
+  std::atomic<uint32_t> busy_us_{0};
+  std::atomic<uint32_t> buffered_ms_{0};
+
+  uint32_t last_snapshot_us_{0};
+};
+
+class AudioStageTimer {
+  /*
+   * @brief Adds the time until it goes out of scope to a stage's busy time. Does nothing without a stage.
+   */
+ public:
+  explicit AudioStageTimer(AudioStageStats *stats) : stats_(stats), start_us_(stats != nullptr ? micros() : 0) {}
+  ~AudioStageTimer() {
+    if (this->stats_ != nullptr) {
+      this->stats_->add_busy_us(micros() - this->start_us_);
+    }
+  }
+
+ protected:
+  AudioStageStats *stats_;
+  uint32_t start_us_;
+};
+
+}  // namespace audio
+}  // namespace esphome
+
+#endif
@@ -58,6 +58,9 @@ class AudioTransferBuffer {
 
   bool reallocate(size_t new_buffer_size);
 
+  /// @brief Returns the ring buffer used as the source/sink, or nullptr if there is none
+  RingBuffer *get_ring_buffer() const { return this->ring_buffer_.get(); }
+
  protected:
   /// @brief Allocates the transfer buffer in external memory, if available.
   /// @param buffer_size The number of bytes to allocate
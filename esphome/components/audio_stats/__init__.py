@@ -0,0 +1,29 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+
+AUTO_LOAD = ["audio"]
+
+CONF_AUDIO_STATS_ID = "audio_stats_id"
+CONF_LOG_SUMMARY = "log_summary"
+
+audio_stats_ns = cg.esphome_ns.namespace("audio_stats")
+AudioStatsComponent = audio_stats_ns.class_("AudioStatsComponent", cg.PollingComponent)
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(AudioStatsComponent),
+            cv.Optional(CONF_LOG_SUMMARY, default=True): cv.boolean,
+        }
+    ).extend(cv.polling_component_schema("60s")),
+    cv.only_on_esp32,
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    cg.add_define("USE_AUDIO_STATS")
+    cg.add(var.set_log_summary(config[CONF_LOG_SUMMARY]))
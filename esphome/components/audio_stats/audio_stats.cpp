@@ -0,0 +1,107 @@
+#include "audio_stats.h"
+
+#ifdef USE_ESP32
+
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cmath>
+
+namespace esphome {
+namespace audio_stats {
+
+static const char *const TAG = "audio_stats";
+
+#ifdef USE_SENSOR
+void AudioStageSensors::publish(const audio::AudioStageSnapshot &snapshot) {
+  if ((this->buffer_fill_sensor_ != nullptr) && !std::isnan(snapshot.buffer_fill)) {
+    this->buffer_fill_sensor_->publish_state(snapshot.buffer_fill);
+  }
+  if ((this->minimum_buffer_fill_sensor_ != nullptr) && !std::isnan(snapshot.minimum_buffer_fill)) {
+    this->minimum_buffer_fill_sensor_->publish_state(snapshot.minimum_buffer_fill);
+  }
+  if (this->underruns_sensor_ != nullptr) {
+    this->underruns_sensor_->publish_state(snapshot.underruns);
+  }
+  if (this->busy_sensor_ != nullptr) {
+    this->busy_sensor_->publish_state(snapshot.busy);
+  }
+  if (this->latency_sensor_ != nullptr) {
+    this->latency_sensor_->publish_state(snapshot.buffered_ms);
+  }
+}
+#endif
+
+void AudioStatsComponent::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Audio Stats:\n"
+                "  Log Summary: %s",
+                YESNO(this->log_summary_));
+  LOG_UPDATE_INTERVAL(this);
+  for (audio::AudioStageStats *stage = audio::AudioStageStats::get_first(); stage != nullptr;
+       stage = stage->get_next()) {
+    ESP_LOGCONFIG(TAG, "  Stage: %s", stage->get_name().c_str());
+  }
+#ifdef USE_SENSOR
+  for (auto *sensors : this->stage_sensors_) {
+    if (!sensors->get_stage().empty() && (audio::AudioStageStats::find(sensors->get_stage()) == nullptr)) {
+      ESP_LOGW(TAG, "  No audio stage named '%s' for sensors", sensors->get_stage().c_str());
+    }
+  }
+#endif
+}
+
+void AudioStatsComponent::update() {
+  audio::AudioStageSnapshot total;
+
+  if (this->log_summary_) {
+    ESP_LOGD(TAG, "Audio stages over the last %" PRIu32 " ms:", this->get_update_interval());
+  }
+
+  for (audio::AudioStageStats *stage = audio::AudioStageStats::get_first(); stage != nullptr;
+       stage = stage->get_next()) {
+    const audio::AudioStageSnapshot snapshot = stage->take_snapshot();
+
+    total.underruns += snapshot.underruns;
+    total.busy += snapshot.busy;
+    total.buffered_ms += snapshot.buffered_ms;
+
+    if (this->log_summary_) {
+      if (std::isnan(snapshot.buffer_fill)) {
+        ESP_LOGD(TAG, "  %s: underruns %" PRIu32 ", busy %.1f%%, buffered %" PRIu32 " ms", stage->get_name().c_str(),
+                 snapshot.underruns, snapshot.busy, snapshot.buffered_ms);
+      } else {
+        ESP_LOGD(TAG,
+                 "  %s: fill %.1f%% (min %.1f%%), underruns %" PRIu32 ", busy %.1f%%, buffered %" PRIu32 " ms",
+                 stage->get_name().c_str(), snapshot.buffer_fill, snapshot.minimum_buffer_fill, snapshot.underruns,
+                 snapshot.busy, snapshot.buffered_ms);
+      }
+    }
+
+#ifdef USE_SENSOR
+    for (auto *sensors : this->stage_sensors_) {
+      if (sensors->get_stage() == stage->get_name()) {
+        sensors->publish(snapshot);
+      }
+    }
+#endif
+  }
+
+  if (this->log_summary_) {
+    ESP_LOGD(TAG, "  total: underruns %" PRIu32 ", busy %.1f%%, latency %" PRIu32 " ms", total.underruns, total.busy,
+             total.buffered_ms);
+  }
+
+#ifdef USE_SENSOR
+  for (auto *sensors : this->stage_sensors_) {
+    if (sensors->get_stage().empty()) {
+      sensors->publish(total);
+    }
+  }
+#endif
+}
+
+}  // namespace audio_stats
+}  // namespace esphome
+
+#endif
@@ -0,0 +1,79 @@
+#pragma once
+
+#ifdef USE_ESP32
+
+#include "esphome/components/audio/audio_stats.h"
+
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace esphome {
+namespace audio_stats {
+
+#ifdef USE_SENSOR
+class AudioStageSensors {
+  /*
+   * @brief Sensors for one audio stage, or for all stages combined if the stage name is empty.
+   * Stages are matched by name on every update, as media player pipelines only register their stages during setup.
+   */
+ public:
+  explicit AudioStageSensors(std::string stage) : stage_(std::move(stage)) {}
+
+  void set_buffer_fill_sensor(sensor::Sensor *sensor) { this->buffer_fill_sensor_ = sensor; }
+  void set_minimum_buffer_fill_sensor(sensor::Sensor *sensor) { this->minimum_buffer_fill_sensor_ = sensor; }
+  void set_underruns_sensor(sensor::Sensor *sensor) { this->underruns_sensor_ = sensor; }
+  void set_busy_sensor(sensor::Sensor *sensor) { this->busy_sensor_ = sensor; }
+  void set_latency_sensor(sensor::Sensor *sensor) { this->latency_sensor_ = sensor; }
+
+  const std::string &get_stage() const { return this->stage_; }
+
+  void publish(const audio::AudioStageSnapshot &snapshot);
+
+ protected:
+  std::string stage_;
+
+  sensor::Sensor *buffer_fill_sensor_{nullptr};
+  sensor::Sensor *minimum_buffer_fill_sensor_{nullptr};
+  sensor::Sensor *underruns_sensor_{nullptr};
+  sensor::Sensor *busy_sensor_{nullptr};
+  sensor::Sensor *latency_sensor_{nullptr};
+};
+#endif
+
+class AudioStatsComponent : public PollingComponent {
+  /*
+   * @brief Takes a snapshot of every audio stage's statistics each update interval. Logs a summary and publishes the
+   * values to the configured sensors. The combined latency adds up the audio buffered by every stage, so it is the
+   * end-to-end latency when the stages form a single path from the reader to the I2S speaker.
+   */
+ public:
+  void dump_config() override;
+  void update() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void set_log_summary(bool log_summary) { this->log_summary_ = log_summary; }
+
+#ifdef USE_SENSOR
+  void add_stage_sensors(AudioStageSensors *sensors) { this->stage_sensors_.push_back(sensors); }
+#endif
+
+ protected:
+  bool log_summary_{true};
+
+#ifdef USE_SENSOR
+  std::vector<AudioStageSensors *> stage_sensors_;
+#endif
+};
+
+}  // namespace audio_stats
+}  // namespace esphome
+
+#endif
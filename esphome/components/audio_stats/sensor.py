@@ -0,0 +1,94 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_ID,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_COUNTER,
+    ICON_TIMER,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+    UNIT_MILLISECOND,
+    UNIT_PERCENT,
+)
+
+from . import CONF_AUDIO_STATS_ID, AudioStatsComponent, audio_stats_ns
+
+DEPENDENCIES = ["audio_stats"]
+
+CONF_BUFFER_FILL = "buffer_fill"
+CONF_BUSY = "busy"
+CONF_LATENCY = "latency"
+CONF_MINIMUM_BUFFER_FILL = "minimum_buffer_fill"
+CONF_STAGE = "stage"
+CONF_UNDERRUNS = "underruns"
+
+AudioStageSensors = audio_stats_ns.class_("AudioStageSensors")
+
+_BUFFER_FILL_SCHEMA = sensor.sensor_schema(
+    unit_of_measurement=UNIT_PERCENT,
+    icon="mdi:tray-full",
+    accuracy_decimals=1,
+    state_class=STATE_CLASS_MEASUREMENT,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+)
+
+
+def _validate_stage(config):
+    if CONF_STAGE not in config:
+        # The combined statistics have no single buffer to report on
+        for key in (CONF_BUFFER_FILL, CONF_MINIMUM_BUFFER_FILL):
+            if key in config:
+                raise cv.Invalid(f"{key} requires a {CONF_STAGE}")
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(AudioStageSensors),
+            cv.GenerateID(CONF_AUDIO_STATS_ID): cv.use_id(AudioStatsComponent),
+            cv.Optional(CONF_STAGE): cv.string_strict,
+            cv.Optional(CONF_BUFFER_FILL): _BUFFER_FILL_SCHEMA,
+            cv.Optional(CONF_MINIMUM_BUFFER_FILL): _BUFFER_FILL_SCHEMA,
+            cv.Optional(CONF_UNDERRUNS): sensor.sensor_schema(
+                icon=ICON_COUNTER,
+                accuracy_decimals=0,
+                state_class=STATE_CLASS_TOTAL_INCREASING,
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+            cv.Optional(CONF_BUSY): sensor.sensor_schema(
+                unit_of_measurement=UNIT_PERCENT,
+                icon="mdi:cpu-32-bit",
+                accuracy_decimals=1,
+                state_class=STATE_CLASS_MEASUREMENT,
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+            cv.Optional(CONF_LATENCY): sensor.sensor_schema(
+                unit_of_measurement=UNIT_MILLISECOND,
+                icon=ICON_TIMER,
+                accuracy_decimals=0,
+                state_class=STATE_CLASS_MEASUREMENT,
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+        }
+    ),
+    _validate_stage,
+)
+
+
+async def to_code(config):
+    parent = await cg.get_variable(config[CONF_AUDIO_STATS_ID])
+    var = cg.new_Pvariable(config[CONF_ID], config.get(CONF_STAGE, ""))
+    cg.add(parent.add_stage_sensors(var))
+
+    for key in (
+        CONF_BUFFER_FILL,
+        CONF_MINIMUM_BUFFER_FILL,
+        CONF_UNDERRUNS,
+        CONF_BUSY,
+        CONF_LATENCY,
+    ):
+        if sensor_config := config.get(key):
+            sens = await sensor.new_sensor(sensor_config)
+            cg.add(getattr(var, f"set_{key}_sensor")(sens))
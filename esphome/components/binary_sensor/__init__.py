@@ -148,14 +148,16 @@ BinarySensorCondition = binary_sensor_ns.class_("BinarySensorCondition", Conditi
 
 # Filters
 Filter = binary_sensor_ns.class_("Filter")
-TimeoutFilter = binary_sensor_ns.class_("TimeoutFilter", Filter, cg.Component)
-DelayedOnOffFilter = binary_sensor_ns.class_("DelayedOnOffFilter", Filter, cg.Component)
-DelayedOnFilter = binary_sensor_ns.class_("DelayedOnFilter", Filter, cg.Component)
-DelayedOffFilter = binary_sensor_ns.class_("DelayedOffFilter", Filter, cg.Component)
+TimedFilter = binary_sensor_ns.class_("TimedFilter", Filter)
+FilterTimers = binary_sensor_ns.class_("FilterTimers", cg.Component)
+TimeoutFilter = binary_sensor_ns.class_("TimeoutFilter", TimedFilter)
+DelayedOnOffFilter = binary_sensor_ns.class_("DelayedOnOffFilter", TimedFilter)
+DelayedOnFilter = binary_sensor_ns.class_("DelayedOnFilter", TimedFilter)
+DelayedOffFilter = binary_sensor_ns.class_("DelayedOffFilter", TimedFilter)
 InvertFilter = binary_sensor_ns.class_("InvertFilter", Filter)
-AutorepeatFilter = binary_sensor_ns.class_("AutorepeatFilter", Filter, cg.Component)
+AutorepeatFilter = binary_sensor_ns.class_("AutorepeatFilter", TimedFilter)
 LambdaFilter = binary_sensor_ns.class_("LambdaFilter", Filter)
-SettleFilter = binary_sensor_ns.class_("SettleFilter", Filter, cg.Component)
+SettleFilter = binary_sensor_ns.class_("SettleFilter", TimedFilter)
 
 _LOGGER = getLogger(__name__)
 
@@ -167,6 +169,20 @@ def register_filter(name, filter_type, schema):
     return FILTER_REGISTRY.register(name, filter_type, schema)
 
 
+KEY_FILTER_TIMERS = "binary_sensor_filter_timers"
+
+
+async def get_filter_timers():
+    """Return the component that runs the timers of all timed filters."""
+    if (timers := CORE.data.get(KEY_FILTER_TIMERS)) is None:
+        timers = cg.new_Pvariable(
+            core.ID(KEY_FILTER_TIMERS, is_declaration=True, type=FilterTimers)
+        )
+        CORE.data[KEY_FILTER_TIMERS] = timers
+        await cg.register_component(timers, {})
+    return timers
+
+
 @register_filter("invert", InvertFilter, {})
 async def invert_filter_to_code(config, filter_id):
     return cg.new_Pvariable(filter_id)
@@ -178,8 +194,7 @@ async def invert_filter_to_code(config, filter_id):
     cv.templatable(cv.positive_time_period_milliseconds),
 )
 async def timeout_filter_to_code(config, filter_id):
-    var = cg.new_Pvariable(filter_id)
-    await cg.register_component(var, {})
+    var = cg.new_Pvariable(filter_id, await get_filter_timers())
     template_ = await cg.templatable(config, [], cg.uint32)
     cg.add(var.set_timeout_value(template_))
     return var
@@ -206,8 +221,7 @@ async def timeout_filter_to_code(config, filter_id):
     ),
 )
 async def delayed_on_off_filter_to_code(config, filter_id):
-    var = cg.new_Pvariable(filter_id)
-    await cg.register_component(var, {})
+    var = cg.new_Pvariable(filter_id, await get_filter_timers())
     if isinstance(config, dict):
         template_ = await cg.templatable(config[CONF_TIME_ON], [], cg.uint32)
         cg.add(var.set_on_delay(template_))
@@ -224,8 +238,7 @@ async def delayed_on_off_filter_to_code(config, filter_id):
     "delayed_on", DelayedOnFilter, cv.templatable(cv.positive_time_period_milliseconds)
 )
 async def delayed_on_filter_to_code(config, filter_id):
-    var = cg.new_Pvariable(filter_id)
-    await cg.register_component(var, {})
+    var = cg.new_Pvariable(filter_id, await get_filter_timers())
     template_ = await cg.templatable(config, [], cg.uint32)
     cg.add(var.set_delay(template_))
     return var
@@ -237,8 +250,7 @@ async def delayed_on_filter_to_code(config, filter_id):
     cv.templatable(cv.positive_time_period_milliseconds),
 )
 async def delayed_off_filter_to_code(config, filter_id):
-    var = cg.new_Pvariable(filter_id)
-    await cg.register_component(var, {})
+    var = cg.new_Pvariable(filter_id, await get_filter_timers())
     template_ = await cg.templatable(config, [], cg.uint32)
     cg.add(var.set_delay(template_))
     return var
@@ -276,9 +288,7 @@ async def autorepeat_filter_to_code(config, filter_id):
                 cv.time_period_str_unit(DEFAULT_TIME_ON).total_milliseconds,
             )
         )
-    var = cg.new_Pvariable(filter_id, timings)
-    await cg.register_component(var, {})
-    return var
+    return cg.new_Pvariable(filter_id, await get_filter_timers(), timings)
 
 
 @register_filter("lambda", LambdaFilter, cv.returning_lambda)
@@ -295,8 +305,7 @@ async def lambda_filter_to_code(config, filter_id):
     cv.templatable(cv.positive_time_period_milliseconds),
 )
 async def settle_filter_to_code(config, filter_id):
-    var = cg.new_Pvariable(filter_id)
-    await cg.register_component(var, {})
+    var = cg.new_Pvariable(filter_id, await get_filter_timers())
     template_ = await cg.templatable(config, [], cg.uint32)
     cg.add(var.set_delay(template_))
     return var
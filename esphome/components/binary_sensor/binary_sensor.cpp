@@ -11,6 +11,9 @@ void BinarySensor::publish_state(bool new_state) {
   if (this->filter_list_ == nullptr) {
     this->send_state_internal(new_state);
   } else {
+#ifdef USE_ENTITY_STATS
+    this->stats_.raw_inputs++;
+#endif
     this->filter_list_->input(new_state);
   }
 }
@@ -1,6 +1,10 @@
 #include "filter.h"
 
 #include "binary_sensor.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+
+#include <algorithm>
 #include <utility>
 
 namespace esphome {
@@ -25,50 +29,126 @@ void Filter::input(bool value) {
   }
 }
 
+void TimedFilter::start_timer_(uint8_t timer, uint32_t delay) {
+  this->timer_start_[timer] = millis();
+  this->timer_delay_[timer] = delay;
+  this->timers_pending_ |= 1 << timer;
+  if (!this->queued_)
+    this->timers_->add_(this);
+}
+
+bool TimedFilter::run_timers_(uint32_t now) {
+  for (uint8_t timer = 0; timer < MAX_TIMERS; timer++) {
+    uint8_t bit = 1 << timer;
+    // Signed, so a timer restarted after now was read isn't taken as elapsed
+    if ((this->timers_pending_ & bit) == 0 ||
+        static_cast<int32_t>(now - this->timer_start_[timer]) < static_cast<int32_t>(this->timer_delay_[timer]))
+      continue;
+    this->timers_pending_ &= ~bit;
+    this->on_timer_(timer);
+  }
+  return this->timers_pending_ != 0;
+}
+
+void FilterTimers::setup() {
+  if (this->active_.empty())
+    this->disable_loop();
+}
+
+void FilterTimers::loop() {
+  const uint32_t now = millis();
+  // Callbacks may start timers of filters further down the chain, which appends them to active_
+  for (size_t i = 0; i < this->active_.size();) {
+    TimedFilter *filter = this->active_[i];
+    if (filter->run_timers_(now)) {
+      i++;
+      continue;
+    }
+    filter->queued_ = false;
+    this->active_[i] = this->active_.back();
+    this->active_.pop_back();
+  }
+  if (this->active_.empty()) {
+    this->disable_loop();
+    return;
+  }
+#ifdef USE_EVENT_DRIVEN_LOOP
+  // The event-driven loop only wakes up for scheduler deadlines, keep one armed for the next timer
+  uint32_t next = UINT32_MAX;
+  for (auto *filter : this->active_) {
+    for (uint8_t timer = 0; timer < TimedFilter::MAX_TIMERS; timer++) {
+      if ((filter->timers_pending_ & (1 << timer)) == 0)
+        continue;
+      int32_t remaining = static_cast<int32_t>(filter->timer_start_[timer] + filter->timer_delay_[timer] - now);
+      next = std::min<uint32_t>(next, std::max<int32_t>(remaining, 0));
+    }
+  }
+  // Only touch the scheduler when the earliest deadline moved
+  uint32_t deadline = now + next;
+  if (!this->wake_armed_ || deadline != this->wake_deadline_) {
+    this->wake_armed_ = true;
+    this->wake_deadline_ = deadline;
+    this->set_timeout("wake", next, [this]() { this->wake_armed_ = false; });
+  }
+#endif
+}
+
+float FilterTimers::get_setup_priority() const { return setup_priority::HARDWARE; }
+
+void FilterTimers::add_(TimedFilter *filter) {
+  filter->queued_ = true;
+  this->active_.push_back(filter);
+  this->enable_loop();
+#ifdef USE_EVENT_DRIVEN_LOOP
+  // Don't sleep before loop() had a chance to arm the wake timeout
+  App.wake_loop_threadsafe();
+#endif
+}
+
 void TimeoutFilter::input(bool value) {
-  this->set_timeout("timeout", this->timeout_delay_.value(), [this]() { this->parent_->invalidate_state(); });
+  this->start_timer_(0, this->timeout_delay_.value());
   // we do not de-dup here otherwise changes from invalid to valid state will not be output
   this->output(value);
 }
 
+void TimeoutFilter::on_timer_(uint8_t timer) { this->parent_->invalidate_state(); }
+
 optional<bool> DelayedOnOffFilter::new_value(bool value) {
-  if (value) {
-    this->set_timeout("ON_OFF", this->on_delay_.value(), [this]() { this->output(true); });
-  } else {
-    this->set_timeout("ON_OFF", this->off_delay_.value(), [this]() { this->output(false); });
-  }
+  this->pending_value_ = value;
+  this->start_timer_(0, value ? this->on_delay_.value() : this->off_delay_.value());
   return {};
 }
 
-float DelayedOnOffFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
+void DelayedOnOffFilter::on_timer_(uint8_t timer) { this->output(this->pending_value_); }
 
 optional<bool> DelayedOnFilter::new_value(bool value) {
   if (value) {
-    this->set_timeout("ON", this->delay_.value(), [this]() { this->output(true); });
+    this->start_timer_(0, this->delay_.value());
     return {};
   } else {
-    this->cancel_timeout("ON");
+    this->cancel_timer_(0);
     return false;
   }
 }
 
-float DelayedOnFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
+void DelayedOnFilter::on_timer_(uint8_t timer) { this->output(true); }
 
 optional<bool> DelayedOffFilter::new_value(bool value) {
   if (!value) {
-    this->set_timeout("OFF", this->delay_.value(), [this]() { this->output(false); });
+    this->start_timer_(0, this->delay_.value());
     return {};
   } else {
-    this->cancel_timeout("OFF");
+    this->cancel_timer_(0);
     return true;
   }
 }
 
-float DelayedOffFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
+void DelayedOffFilter::on_timer_(uint8_t timer) { this->output(false); }
 
 optional<bool> InvertFilter::new_value(bool value) { return !value; }
 
-AutorepeatFilter::AutorepeatFilter(std::vector<AutorepeatFilterTiming> timings) : timings_(std::move(timings)) {}
+AutorepeatFilter::AutorepeatFilter(FilterTimers *timers, std::vector<AutorepeatFilterTiming> timings)
+    : TimedFilter(timers), timings_(std::move(timings)) {}
 
 optional<bool> AutorepeatFilter::new_value(bool value) {
   if (value) {
@@ -79,20 +159,28 @@ optional<bool> AutorepeatFilter::new_value(bool value) {
     this->next_timing_();
     return true;
   } else {
-    this->cancel_timeout("TIMING");
-    this->cancel_timeout("ON_OFF");
+    this->cancel_timer_(TIMER_TIMING);
+    this->cancel_timer_(TIMER_ON_OFF);
     this->active_timing_ = 0;
     return false;
   }
 }
 
+void AutorepeatFilter::on_timer_(uint8_t timer) {
+  if (timer == TIMER_TIMING) {
+    this->next_timing_();
+  } else {
+    this->next_value_(this->next_value_state_);
+  }
+}
+
 void AutorepeatFilter::next_timing_() {
   // Entering this method
   // 1st time: starts waiting the first delay
   // 2nd time: starts waiting the second delay and starts toggling with the first time_off / _on
   // last time: no delay to start but have to bump the index to reflect the last
   if (this->active_timing_ < this->timings_.size())
-    this->set_timeout("TIMING", this->timings_[this->active_timing_].delay, [this]() { this->next_timing_(); });
+    this->start_timer_(TIMER_TIMING, this->timings_[this->active_timing_].delay);
 
   if (this->active_timing_ <= this->timings_.size()) {
     this->active_timing_++;
@@ -107,31 +195,35 @@ void AutorepeatFilter::next_timing_() {
 void AutorepeatFilter::next_value_(bool val) {
   const AutorepeatFilterTiming &timing = this->timings_[this->active_timing_ - 2];
   this->output(val);  // This is at least the second one so not initial
-  this->set_timeout("ON_OFF", val ? timing.time_on : timing.time_off, [this, val]() { this->next_value_(!val); });
+  this->next_value_state_ = !val;
+  this->start_timer_(TIMER_ON_OFF, val ? timing.time_on : timing.time_off);
 }
 
-float AutorepeatFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
-
 LambdaFilter::LambdaFilter(std::function<optional<bool>(bool)> f) : f_(std::move(f)) {}
 
 optional<bool> LambdaFilter::new_value(bool value) { return this->f_(value); }
 
 optional<bool> SettleFilter::new_value(bool value) {
   if (!this->steady_) {
-    this->set_timeout("SETTLE", this->delay_.value(), [this, value]() {
-      this->steady_ = true;
-      this->output(value);
-    });
+    this->pending_value_ = value;
+    this->start_timer_(0, this->delay_.value());
     return {};
   } else {
     this->steady_ = false;
     this->output(value);
-    this->set_timeout("SETTLE", this->delay_.value(), [this]() { this->steady_ = true; });
+    this->pending_value_.reset();
+    this->start_timer_(0, this->delay_.value());
     return value;
   }
 }
 
-float SettleFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
+void SettleFilter::on_timer_(uint8_t timer) {
+  this->steady_ = true;
+  if (this->pending_value_.has_value()) {
+    this->output(*this->pending_value_);
+    this->pending_value_.reset();
+  }
+}
 
 }  // namespace binary_sensor
 
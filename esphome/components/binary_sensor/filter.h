@@ -11,6 +11,7 @@ namespace esphome {
 namespace binary_sensor {
 
 class BinarySensor;
+class FilterTimers;
 
 class Filter {
  public:
@@ -28,51 +29,110 @@ class Filter {
   Deduplicator<bool> dedup_;
 };
 
-class TimeoutFilter : public Filter, public Component {
+/** Base for filters that act after a delay.
+ *
+ * Instead of each filter scheduling named timeouts, the timers are plain timestamps checked by a shared
+ * FilterTimers component, so a bouncing input costs no scheduler allocations.
+ */
+class TimedFilter : public Filter {
  public:
+  explicit TimedFilter(FilterTimers *timers) : timers_(timers) {}
+
+ protected:
+  friend FilterTimers;
+
+  static const uint8_t MAX_TIMERS = 2;
+
+  /// (Re)start timer \p timer, on_timer_() is called once \p delay ms have passed.
+  void start_timer_(uint8_t timer, uint32_t delay);
+  void cancel_timer_(uint8_t timer) { this->timers_pending_ &= ~(1 << timer); }
+  virtual void on_timer_(uint8_t timer) = 0;
+  /// Fire the elapsed timers, returns true if any timer is still running.
+  bool run_timers_(uint32_t now);
+
+  FilterTimers *timers_;
+  uint32_t timer_start_[MAX_TIMERS]{};
+  uint32_t timer_delay_[MAX_TIMERS]{};
+  uint8_t timers_pending_{0};
+  /// Whether this filter is in the active list of timers_.
+  bool queued_{false};
+};
+
+/// Runs the timers of all binary sensor TimedFilters in one pass per loop, the loop is off while none are running.
+class FilterTimers : public Component {
+ public:
+  void setup() override;
+  void loop() override;
+  float get_setup_priority() const override;
+
+ protected:
+  friend TimedFilter;
+
+  void add_(TimedFilter *filter);
+
+  std::vector<TimedFilter *> active_;
+#ifdef USE_EVENT_DRIVEN_LOOP
+  uint32_t wake_deadline_{0};
+  bool wake_armed_{false};
+#endif
+};
+
+class TimeoutFilter : public TimedFilter {
+ public:
+  using TimedFilter::TimedFilter;
+
   optional<bool> new_value(bool value) override { return value; }
   void input(bool value) override;
   template<typename T> void set_timeout_value(T timeout) { this->timeout_delay_ = timeout; }
 
  protected:
+  void on_timer_(uint8_t timer) override;
+
   TemplatableValue<uint32_t> timeout_delay_{};
 };
 
-class DelayedOnOffFilter : public Filter, public Component {
+class DelayedOnOffFilter : public TimedFilter {
  public:
-  optional<bool> new_value(bool value) override;
+  using TimedFilter::TimedFilter;
 
-  float get_setup_priority() const override;
+  optional<bool> new_value(bool value) override;
 
   template<typename T> void set_on_delay(T delay) { this->on_delay_ = delay; }
   template<typename T> void set_off_delay(T delay) { this->off_delay_ = delay; }
 
  protected:
+  void on_timer_(uint8_t timer) override;
+
+  bool pending_value_{false};
   TemplatableValue<uint32_t> on_delay_{};
   TemplatableValue<uint32_t> off_delay_{};
 };
 
-class DelayedOnFilter : public Filter, public Component {
+class DelayedOnFilter : public TimedFilter {
  public:
-  optional<bool> new_value(bool value) override;
+  using TimedFilter::TimedFilter;
 
-  float get_setup_priority() const override;
+  optional<bool> new_value(bool value) override;
 
   template<typename T> void set_delay(T delay) { this->delay_ = delay; }
 
  protected:
+  void on_timer_(uint8_t timer) override;
+
   TemplatableValue<uint32_t> delay_{};
 };
 
-class DelayedOffFilter : public Filter, public Component {
+class DelayedOffFilter : public TimedFilter {
  public:
-  optional<bool> new_value(bool value) override;
+  using TimedFilter::TimedFilter;
 
-  float get_setup_priority() const override;
+  optional<bool> new_value(bool value) override;
 
   template<typename T> void set_delay(T delay) { this->delay_ = delay; }
 
  protected:
+  void on_timer_(uint8_t timer) override;
+
   TemplatableValue<uint32_t> delay_{};
 };
 
@@ -92,20 +152,22 @@ struct AutorepeatFilterTiming {
   uint32_t time_on;
 };
 
-class AutorepeatFilter : public Filter, public Component {
+class AutorepeatFilter : public TimedFilter {
  public:
-  explicit AutorepeatFilter(std::vector<AutorepeatFilterTiming> timings);
+  AutorepeatFilter(FilterTimers *timers, std::vector<AutorepeatFilterTiming> timings);
 
   optional<bool> new_value(bool value) override;
 
-  float get_setup_priority() const override;
-
  protected:
+  enum : uint8_t { TIMER_TIMING = 0, TIMER_ON_OFF = 1 };
+
+  void on_timer_(uint8_t timer) override;
   void next_timing_();
   void next_value_(bool val);
 
   std::vector<AutorepeatFilterTiming> timings_;
   uint8_t active_timing_{0};
+  bool next_value_state_{false};
 };
 
 class LambdaFilter : public Filter {
@@ -118,17 +180,21 @@ class LambdaFilter : public Filter {
   std::function<optional<bool>(bool)> f_;
 };
 
-class SettleFilter : public Filter, public Component {
+class SettleFilter : public TimedFilter {
  public:
-  optional<bool> new_value(bool value) override;
+  using TimedFilter::TimedFilter;
 
-  float get_setup_priority() const override;
+  optional<bool> new_value(bool value) override;
 
   template<typename T> void set_delay(T delay) { this->delay_ = delay; }
 
  protected:
+  void on_timer_(uint8_t timer) override;
+
   TemplatableValue<uint32_t> delay_{};
   bool steady_{true};
+  /// Value to output when the settle timer fires, if there is one.
+  optional<bool> pending_value_{};
 };
 
 }  // namespace binary_sensor
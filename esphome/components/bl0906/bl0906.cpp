@@ -67,6 +67,9 @@ void BL0906::loop() {
     return;
   }
   this->current_channel_++;
+  // Publish the whole reading at once after the last register
+  if (this->current_channel_ == UINT8_MAX)
+    this->publish_group_.commit();
   this->handle_actions_();
 }
 
@@ -178,7 +181,7 @@ void BL0906::read_data_(const uint8_t address, const float reference, sensor::Se
     value = (float) to_int32_t(data_s24);
     value = (value - 64) * 12.5 / 59 - 40;
   }
-  sensor->publish_state(value);
+  this->publish_group_.stage(sensor, value);
 }
 
 // RMS offset correction
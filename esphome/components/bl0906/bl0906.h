@@ -80,6 +80,7 @@ class BL0906 : public PollingComponent, public uart::UARTDevice {
   void bias_correction_(uint8_t address, float measurements, float correction);
 
   uint8_t current_channel_{0};
+  sensor::PublishGroup publish_group_;
   size_t enqueue_action_(ActionCallbackFuncPtr function);
   void handle_actions_();
 
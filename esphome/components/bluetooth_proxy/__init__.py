@@ -12,6 +12,9 @@ CODEOWNERS = ["@jesserockz"]
 CONF_CONNECTION_SLOTS = "connection_slots"
 CONF_CACHE_SERVICES = "cache_services"
 CONF_CONNECTIONS = "connections"
+CONF_ADVERTISEMENT_DEDUP = "advertisement_dedup"
+CONF_RSSI_THRESHOLD = "rssi_threshold"
+CONF_WINDOW = "window"
 DEFAULT_CONNECTION_SLOTS = 3
 
 bluetooth_proxy_ns = cg.esphome_ns.namespace("bluetooth_proxy")
@@ -68,6 +71,19 @@ CONFIG_SCHEMA = cv.All(
                     cv.ensure_list(CONNECTION_SCHEMA),
                     cv.Length(min=1, max=esp32_ble_tracker.max_connections()),
                 ),
+                cv.Optional(CONF_ADVERTISEMENT_DEDUP): cv.Schema(
+                    {
+                        # Home Assistant marks devices unavailable when it doesn't
+                        # hear from them for a few minutes
+                        cv.Optional(CONF_WINDOW, default="10s"): cv.All(
+                            cv.positive_time_period_milliseconds,
+                            cv.Range(max=cv.TimePeriod(seconds=60)),
+                        ),
+                        cv.Optional(CONF_RSSI_THRESHOLD, default=5): cv.int_range(
+                            min=0, max=100
+                        ),
+                    }
+                ),
             }
         )
         .extend(esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA)
@@ -85,6 +101,10 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     cg.add(var.set_active(config[CONF_ACTIVE]))
+    if (dedup := config.get(CONF_ADVERTISEMENT_DEDUP)) is not None:
+        cg.add(
+            var.set_advertisement_dedup(dedup[CONF_WINDOW], dedup[CONF_RSSI_THRESHOLD])
+        )
     await esp32_ble_tracker.register_raw_ble_device(var, config)
 
     for connection_conf in config.get(CONF_CONNECTIONS, []):
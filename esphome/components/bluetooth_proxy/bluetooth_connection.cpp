@@ -1,9 +1,13 @@
 #include "bluetooth_connection.h"
 
 #include "esphome/components/api/api_pb2.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+#include <cinttypes>
+
 #ifdef USE_ESP32
 
 #include "bluetooth_proxy.h"
@@ -13,6 +17,13 @@ namespace bluetooth_proxy {
 
 static const char *const TAG = "bluetooth_proxy.connection";
 
+// Operations queued per connection on top of the one in flight
+static constexpr size_t MAX_QUEUED_OPS = 16;
+// Longer than the 30s ATT transaction timeout, only hit if the stack never reports back
+static constexpr uint32_t GATT_OP_TIMEOUT_MS = 35000;
+// Timed out operations whose late responses are still recognized, older ones are forgotten
+static constexpr size_t MAX_AWAITED_RESPONSES = 4;
+
 static void fill_128bit_uuid_array(std::array<uint64_t, 2> &out, esp_bt_uuid_t uuid_source) {
   esp_bt_uuid_t uuid = espbt::ESPBTUUID::from_uuid(uuid_source).as_128bit().get_uuid();
   out[0] = ((uint64_t) uuid.uuid.uuid128[15] << 56) | ((uint64_t) uuid.uuid.uuid128[14] << 48) |
@@ -28,11 +39,19 @@ static void fill_128bit_uuid_array(std::array<uint64_t, 2> &out, esp_bt_uuid_t u
 void BluetoothConnection::dump_config() {
   ESP_LOGCONFIG(TAG, "BLE Connection:");
   BLEClientBase::dump_config();
+  ESP_LOGCONFIG(TAG, "  GATT Queue Limit: %u", (unsigned) MAX_QUEUED_OPS);
 }
 
 void BluetoothConnection::loop() {
   BLEClientBase::loop();
 
+  if (this->op_in_flight_ && millis() - this->op_start_ > GATT_OP_TIMEOUT_MS) {
+    ESP_LOGW(TAG, "[%d] [%s] No response for GATT operation on handle 0x%2X", this->connection_index_,
+             this->address_str_.c_str(), this->in_flight_handle_);
+    this->op_in_flight_ = false;
+    this->process_queue_();
+  }
+
   // Early return if no active connection or not in service discovery phase
   if (this->address_ == 0 || this->send_service_ < 0 || this->send_service_ > this->service_count_) {
     return;
@@ -43,6 +62,8 @@ void BluetoothConnection::loop() {
 }
 
 void BluetoothConnection::reset_connection_(esp_err_t reason) {
+  this->clear_queue_();
+
   // Send disconnection notification
   this->proxy_->send_device_connection(this->address_, false, 0, reason);
 
@@ -224,6 +245,7 @@ bool BluetoothConnection::gattc_event_handler(esp_gattc_cb_event_t event, esp_ga
     }
     case ESP_GATTC_READ_DESCR_EVT:
     case ESP_GATTC_READ_CHAR_EVT: {
+      this->complete_op_(param->read.handle, true);
       if (param->read.status != ESP_GATT_OK) {
         ESP_LOGW(TAG, "[%d] [%s] Error reading char/descriptor at handle 0x%2X, status=%d", this->connection_index_,
                  this->address_str_.c_str(), param->read.handle, param->read.status);
@@ -239,6 +261,7 @@ bool BluetoothConnection::gattc_event_handler(esp_gattc_cb_event_t event, esp_ga
     }
     case ESP_GATTC_WRITE_CHAR_EVT:
     case ESP_GATTC_WRITE_DESCR_EVT: {
+      this->complete_op_(param->write.handle, false);
       if (param->write.status != ESP_GATT_OK) {
         ESP_LOGW(TAG, "[%d] [%s] Error writing char/descriptor at handle 0x%2X, status=%d", this->connection_index_,
                  this->address_str_.c_str(), param->write.handle, param->write.status);
@@ -313,80 +336,151 @@ void BluetoothConnection::gap_event_handler(esp_gap_ble_cb_event_t event, esp_bl
 }
 
 esp_err_t BluetoothConnection::read_characteristic(uint16_t handle) {
-  if (!this->connected()) {
-    ESP_LOGW(TAG, "[%d] [%s] Cannot read GATT characteristic, not connected.", this->connection_index_,
-             this->address_str_.c_str());
-    return ESP_GATT_NOT_CONNECTED;
-  }
+  return this->enqueue_op_(GattOpType::READ_CHAR, handle, {}, true);
+}
 
-  ESP_LOGV(TAG, "[%d] [%s] Reading GATT characteristic handle %d", this->connection_index_, this->address_str_.c_str(),
-           handle);
+esp_err_t BluetoothConnection::write_characteristic(uint16_t handle, const std::string &data, bool response) {
+  return this->enqueue_op_(GattOpType::WRITE_CHAR, handle, data, response);
+}
 
-  esp_err_t err = esp_ble_gattc_read_char(this->gattc_if_, this->conn_id_, handle, ESP_GATT_AUTH_REQ_NONE);
-  if (err != ERR_OK) {
-    ESP_LOGW(TAG, "[%d] [%s] esp_ble_gattc_read_char error, err=%d", this->connection_index_,
-             this->address_str_.c_str(), err);
-    return err;
-  }
-  return ESP_OK;
+esp_err_t BluetoothConnection::read_descriptor(uint16_t handle) {
+  return this->enqueue_op_(GattOpType::READ_DESCR, handle, {}, true);
 }
 
-esp_err_t BluetoothConnection::write_characteristic(uint16_t handle, const std::string &data, bool response) {
+esp_err_t BluetoothConnection::write_descriptor(uint16_t handle, const std::string &data, bool response) {
+  return this->enqueue_op_(GattOpType::WRITE_DESCR, handle, data, response);
+}
+
+esp_err_t BluetoothConnection::enqueue_op_(GattOpType type, uint16_t handle, const std::string &data, bool response) {
   if (!this->connected()) {
-    ESP_LOGW(TAG, "[%d] [%s] Cannot write GATT characteristic, not connected.", this->connection_index_,
-             this->address_str_.c_str());
+    ESP_LOGW(TAG, "[%d] [%s] Cannot access GATT handle %d, not connected.", this->connection_index_,
+             this->address_str_.c_str(), handle);
     return ESP_GATT_NOT_CONNECTED;
   }
-  ESP_LOGV(TAG, "[%d] [%s] Writing GATT characteristic handle %d", this->connection_index_, this->address_str_.c_str(),
-           handle);
-
-  esp_err_t err =
-      esp_ble_gattc_write_char(this->gattc_if_, this->conn_id_, handle, data.size(), (uint8_t *) data.data(),
-                               response ? ESP_GATT_WRITE_TYPE_RSP : ESP_GATT_WRITE_TYPE_NO_RSP, ESP_GATT_AUTH_REQ_NONE);
-  if (err != ERR_OK) {
-    ESP_LOGW(TAG, "[%d] [%s] esp_ble_gattc_write_char error, err=%d", this->connection_index_,
-             this->address_str_.c_str(), err);
-    return err;
+  if (this->gatt_queue_.size() >= MAX_QUEUED_OPS) {
+    ESP_LOGW(TAG, "[%d] [%s] GATT queue full, dropping operation on handle %d", this->connection_index_,
+             this->address_str_.c_str(), handle);
+    return ESP_GATT_BUSY;
   }
+
+  this->gatt_queue_.push_back(GattOp{data, handle, type, response});
+  if (this->gatt_queue_.size() > this->max_queue_depth_)
+    this->max_queue_depth_ = this->gatt_queue_.size();
+  this->process_queue_();
   return ESP_OK;
 }
 
-esp_err_t BluetoothConnection::read_descriptor(uint16_t handle) {
-  if (!this->connected()) {
-    ESP_LOGW(TAG, "[%d] [%s] Cannot read GATT descriptor, not connected.", this->connection_index_,
-             this->address_str_.c_str());
-    return ESP_GATT_NOT_CONNECTED;
+void BluetoothConnection::process_queue_() {
+  // The GATT client only has one ATT request outstanding per connection, so instead of letting Bluedroid
+  // reject or park requests, keep them here and issue the next one as soon as the previous response arrives.
+  while (!this->op_in_flight_ && !this->gatt_queue_.empty()) {
+    GattOp op = std::move(this->gatt_queue_.front());
+    this->gatt_queue_.erase(this->gatt_queue_.begin());
+
+    esp_err_t err = this->issue_op_(op);
+    if (err != ESP_OK) {
+      this->proxy_->send_gatt_error(this->address_, op.handle, err);
+      continue;
+    }
+    // Writes without response get no answer from the peer, the next operation can go out right away
+    if (!op.response)
+      continue;
+    this->op_in_flight_ = true;
+    this->in_flight_handle_ = op.handle;
+    this->in_flight_generation_ = ++this->op_generation_;
+    this->op_start_ = millis();
+    if (this->awaited_responses_.size() >= MAX_AWAITED_RESPONSES)
+      this->awaited_responses_.erase(this->awaited_responses_.begin());
+    bool read = op.type == GattOpType::READ_CHAR || op.type == GattOpType::READ_DESCR;
+    this->awaited_responses_.push_back(AwaitedResponse{op.handle, this->in_flight_generation_, read});
   }
-  ESP_LOGV(TAG, "[%d] [%s] Reading GATT descriptor handle %d", this->connection_index_, this->address_str_.c_str(),
-           handle);
+}
 
-  esp_err_t err = esp_ble_gattc_read_char_descr(this->gattc_if_, this->conn_id_, handle, ESP_GATT_AUTH_REQ_NONE);
+esp_err_t BluetoothConnection::issue_op_(const GattOp &op) {
+  esp_gatt_write_type_t write_type = op.response ? ESP_GATT_WRITE_TYPE_RSP : ESP_GATT_WRITE_TYPE_NO_RSP;
+  esp_err_t err;
+  const char *name;
+  switch (op.type) {
+    case GattOpType::READ_CHAR:
+      ESP_LOGV(TAG, "[%d] [%s] Reading GATT characteristic handle %d", this->connection_index_,
+               this->address_str_.c_str(), op.handle);
+      name = "esp_ble_gattc_read_char";
+      err = esp_ble_gattc_read_char(this->gattc_if_, this->conn_id_, op.handle, ESP_GATT_AUTH_REQ_NONE);
+      break;
+    case GattOpType::WRITE_CHAR:
+      ESP_LOGV(TAG, "[%d] [%s] Writing GATT characteristic handle %d", this->connection_index_,
+               this->address_str_.c_str(), op.handle);
+      name = "esp_ble_gattc_write_char";
+      err = esp_ble_gattc_write_char(this->gattc_if_, this->conn_id_, op.handle, op.data.size(),
+                                     (uint8_t *) op.data.data(), write_type, ESP_GATT_AUTH_REQ_NONE);
+      break;
+    case GattOpType::READ_DESCR:
+      ESP_LOGV(TAG, "[%d] [%s] Reading GATT descriptor handle %d", this->connection_index_,
+               this->address_str_.c_str(), op.handle);
+      name = "esp_ble_gattc_read_char_descr";
+      err = esp_ble_gattc_read_char_descr(this->gattc_if_, this->conn_id_, op.handle, ESP_GATT_AUTH_REQ_NONE);
+      break;
+    case GattOpType::WRITE_DESCR:
+    default:
+      ESP_LOGV(TAG, "[%d] [%s] Writing GATT descriptor handle %d", this->connection_index_,
+               this->address_str_.c_str(), op.handle);
+      name = "esp_ble_gattc_write_char_descr";
+      err = esp_ble_gattc_write_char_descr(this->gattc_if_, this->conn_id_, op.handle, op.data.size(),
+                                           (uint8_t *) op.data.data(), write_type, ESP_GATT_AUTH_REQ_NONE);
+      break;
+  }
   if (err != ERR_OK) {
-    ESP_LOGW(TAG, "[%d] [%s] esp_ble_gattc_read_char_descr error, err=%d", this->connection_index_,
-             this->address_str_.c_str(), err);
-    return err;
+    ESP_LOGW(TAG, "[%d] [%s] %s error, err=%d", this->connection_index_, this->address_str_.c_str(), name, err);
   }
-  return ESP_OK;
+  return err;
 }
 
-esp_err_t BluetoothConnection::write_descriptor(uint16_t handle, const std::string &data, bool response) {
-  if (!this->connected()) {
-    ESP_LOGW(TAG, "[%d] [%s] Cannot write GATT descriptor, not connected.", this->connection_index_,
-             this->address_str_.c_str());
-    return ESP_GATT_NOT_CONNECTED;
+void BluetoothConnection::complete_op_(uint16_t handle, bool read) {
+  // Responses arrive in request order, so the oldest awaited one with this handle and kind is the one answered.
+  // Completions of writes without response match none of them.
+  auto it = std::find_if(this->awaited_responses_.begin(), this->awaited_responses_.end(),
+                         [handle, read](const AwaitedResponse &r) { return r.handle == handle && r.read == read; });
+  if (it == this->awaited_responses_.end())
+    return;
+  const uint16_t generation = it->generation;
+  this->awaited_responses_.erase(it);
+  if (!this->op_in_flight_ || generation != this->in_flight_generation_) {
+    // Late response of an operation that timed out, even if the handle was reused since
+    ESP_LOGV(TAG, "[%d] [%s] Late GATT response on handle 0x%2X", this->connection_index_, this->address_str_.c_str(),
+             handle);
+    return;
   }
-  ESP_LOGV(TAG, "[%d] [%s] Writing GATT descriptor handle %d", this->connection_index_, this->address_str_.c_str(),
-           handle);
+  this->op_in_flight_ = false;
+
+  uint32_t latency = millis() - this->op_start_;
+  this->op_latency_last_ = latency;
+  this->op_latency_total_ += latency;
+  this->op_count_++;
+  if (latency > this->op_latency_max_)
+    this->op_latency_max_ = latency;
+  ESP_LOGV(TAG, "[%d] [%s] GATT operation on handle 0x%2X took %" PRIu32 "ms, %u queued", this->connection_index_,
+           this->address_str_.c_str(), handle, latency, (unsigned) this->gatt_queue_.size());
+
+  this->process_queue_();
+}
 
-  esp_err_t err = esp_ble_gattc_write_char_descr(
-      this->gattc_if_, this->conn_id_, handle, data.size(), (uint8_t *) data.data(),
-      response ? ESP_GATT_WRITE_TYPE_RSP : ESP_GATT_WRITE_TYPE_NO_RSP, ESP_GATT_AUTH_REQ_NONE);
-  if (err != ERR_OK) {
-    ESP_LOGW(TAG, "[%d] [%s] esp_ble_gattc_write_char_descr error, err=%d", this->connection_index_,
-             this->address_str_.c_str(), err);
-    return err;
+void BluetoothConnection::clear_queue_() {
+  if (this->op_count_ != 0) {
+    ESP_LOGD(TAG,
+             "[%d] [%s] GATT operations: %" PRIu32 ", latency avg %" PRIu32 "ms, max %" PRIu32
+             "ms, max queue depth %u",
+             this->connection_index_, this->address_str_.c_str(), this->op_count_,
+             this->op_latency_total_ / this->op_count_, this->op_latency_max_, this->max_queue_depth_);
   }
-  return ESP_OK;
+  // The client gets the disconnect and fails its pending requests itself
+  this->gatt_queue_.clear();
+  this->awaited_responses_.clear();
+  this->op_in_flight_ = false;
+  this->op_count_ = 0;
+  this->op_latency_total_ = 0;
+  this->op_latency_last_ = 0;
+  this->op_latency_max_ = 0;
+  this->max_queue_depth_ = 0;
 }
 
 esp_err_t BluetoothConnection::notify_characteristic(uint16_t handle, bool enable) {
@@ -4,6 +4,9 @@
 
 #include "esphome/components/esp32_ble_client/ble_client_base.h"
 
+#include <string>
+#include <vector>
+
 namespace esphome {
 namespace bluetooth_proxy {
 
@@ -25,9 +28,39 @@ class BluetoothConnection : public esp32_ble_client::BLEClientBase {
 
   esp_err_t notify_characteristic(uint16_t handle, bool enable);
 
+  /// Number of GATT operations waiting behind the one in flight.
+  size_t get_queue_depth() const { return this->gatt_queue_.size(); }
+  /// Time between issuing the last completed GATT operation and its response, in ms.
+  uint32_t get_last_op_latency() const { return this->op_latency_last_; }
+  uint32_t get_max_op_latency() const { return this->op_latency_max_; }
+
  protected:
   friend class BluetoothProxy;
 
+  enum class GattOpType : uint8_t { READ_CHAR, WRITE_CHAR, READ_DESCR, WRITE_DESCR };
+
+  struct GattOp {
+    std::string data;
+    uint16_t handle;
+    GattOpType type;
+    bool response;
+  };
+
+  /// A response Bluedroid still owes for an operation that was issued with one.
+  struct AwaitedResponse {
+    uint16_t handle;
+    uint16_t generation;
+    bool read;
+  };
+
+  /// Queue a read/write and issue it right away if nothing is in flight on this connection.
+  esp_err_t enqueue_op_(GattOpType type, uint16_t handle, const std::string &data, bool response);
+  /// Issue queued operations until one is waiting for a response.
+  void process_queue_();
+  esp_err_t issue_op_(const GattOp &op);
+  void complete_op_(uint16_t handle, bool read);
+  void clear_queue_();
+
   void send_service_for_discovery_();
   void reset_connection_(esp_err_t reason);
 
@@ -35,12 +68,27 @@ class BluetoothConnection : public esp32_ble_client::BLEClientBase {
   // Group 1: Pointers (4 bytes each, naturally aligned)
   BluetoothProxy *proxy_;
 
-  // Group 2: 2-byte types
+  // Group 2: Containers and 4-byte types
+  std::vector<GattOp> gatt_queue_;
+  /// Oldest first. Operations that timed out stay here until their late response arrives.
+  std::vector<AwaitedResponse> awaited_responses_;
+  uint32_t op_start_{0};
+  uint32_t op_count_{0};
+  uint32_t op_latency_total_{0};
+  uint32_t op_latency_last_{0};
+  uint32_t op_latency_max_{0};
+
+  // Group 3: 2-byte types
   int16_t send_service_{-2};  // Needs to handle negative values and service count
+  uint16_t in_flight_handle_{0};
+  uint16_t in_flight_generation_{0};
+  uint16_t op_generation_{0};  // Incremented for every operation that expects a response
 
-  // Group 3: 1-byte types
+  // Group 4: 1-byte types
   bool seen_mtu_or_services_{false};
-  // 1 byte used, 1 byte padding
+  bool op_in_flight_{false};
+  uint8_t max_queue_depth_{0};
+  // 3 bytes used, 1 byte padding
 };
 
 }  // namespace bluetooth_proxy
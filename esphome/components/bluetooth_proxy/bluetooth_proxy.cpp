@@ -3,6 +3,9 @@
 #include "esphome/core/log.h"
 #include "esphome/core/macros.h"
 #include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include <cinttypes>
+#include <cstdlib>
 #include <cstring>
 
 #ifdef USE_ESP32
@@ -36,6 +39,13 @@ void BluetoothProxy::setup() {
   // Don't pre-allocate pool - let it grow only if needed in busy environments
   // Many devices in quiet areas will never need the overflow pool
 
+  if (this->dedup_ != nullptr) {
+    this->set_interval("dedup_stats", 60000, [this]() {
+      ESP_LOGD(TAG, "Advertisements forwarded: %" PRIu32 ", suppressed: %" PRIu32, this->advertisements_forwarded_,
+               this->advertisements_suppressed_);
+    });
+  }
+
   this->parent_->add_scanner_state_callback([this](esp32_ble_tracker::ScannerState state) {
     if (this->api_connection_ != nullptr) {
       this->send_bluetooth_scanner_state_(state);
@@ -59,16 +69,60 @@ bool BluetoothProxy::parse_device(const esp32_ble_tracker::ESPBTDevice &device)
 }
 #endif
 
+bool AdvertisementDedup::check(const esp32_ble::BLEScanResult &result, uint32_t now) {
+  const uint64_t address = esp32_ble::ble_addr_to_uint64(result.bda);
+  // FNV-1a over the address type and payload, the address is compared separately
+  uint32_t hash = 2166136261UL ^ result.ble_addr_type;
+  const uint8_t length = result.adv_data_len + result.scan_rsp_len;
+  for (uint8_t i = 0; i < length; i++) {
+    hash ^= result.ble_adv[i];
+    hash *= 16777619UL;
+  }
+
+  size_t index = static_cast<size_t>((address * 0x9E3779B97F4A7C15ULL) >> 32) & (SIZE - 1);
+  Entry *victim = nullptr;
+  for (size_t i = 0; i < PROBE_LIMIT; i++, index = (index + 1) & (SIZE - 1)) {
+    Entry &entry = this->entries_[index];
+    if (entry.used && entry.address == address) {
+      int rssi_delta = std::abs(int(result.rssi) - int(entry.rssi));
+      if (entry.payload_hash == hash && now - entry.forwarded_at < this->window_ &&
+          (this->rssi_threshold_ == 0 || rssi_delta < this->rssi_threshold_))
+        return false;
+      victim = &entry;
+      break;
+    }
+    if (victim == nullptr || !entry.used ||
+        (victim->used && now - entry.forwarded_at > now - victim->forwarded_at))
+      victim = &entry;
+  }
+
+  victim->address = address;
+  victim->payload_hash = hash;
+  victim->forwarded_at = now;
+  victim->rssi = result.rssi;
+  victim->used = true;
+  return true;
+}
+
 bool BluetoothProxy::parse_devices(const esp32_ble::BLEScanResult *scan_results, size_t count) {
   if (!api::global_api_server->is_connected() || this->api_connection_ == nullptr)
     return false;
 
   auto &advertisements = this->response_->advertisements;
+  const uint32_t now = millis();
 
   for (size_t i = 0; i < count; i++) {
     auto &result = scan_results[i];
     uint8_t length = result.adv_data_len + result.scan_rsp_len;
 
+    if (this->dedup_ != nullptr) {
+      if (!this->dedup_->check(result, now)) {
+        this->advertisements_suppressed_++;
+        continue;
+      }
+      this->advertisements_forwarded_++;
+    }
+
     // Check if we need to expand the vector
     if (this->advertisement_count_ >= advertisements.size()) {
       if (this->advertisement_pool_.empty()) {
@@ -120,8 +174,9 @@ void BluetoothProxy::flush_pending_advertisements() {
     advertisements.resize(this->advertisement_count_);
   }
 
-  // Send the message
-  this->api_connection_->send_message(*this->response_, api::BluetoothLERawAdvertisementsResponse::MESSAGE_TYPE);
+  // Send the message, a full socket tells the scanner to back off
+  if (!this->api_connection_->send_message(*this->response_, api::BluetoothLERawAdvertisementsResponse::MESSAGE_TYPE))
+    this->parent_->report_backpressure();
 
   // Reset count - existing items will be overwritten in next batch
   this->advertisement_count_ = 0;
@@ -133,6 +188,13 @@ void BluetoothProxy::dump_config() {
                 "  Active: %s\n"
                 "  Connections: %d",
                 YESNO(this->active_), this->connections_.size());
+  if (this->dedup_ != nullptr) {
+    ESP_LOGCONFIG(TAG,
+                  "  Advertisement Dedup:\n"
+                  "    Window: %" PRIu32 " ms\n"
+                  "    RSSI Threshold: %u dB",
+                  this->dedup_->get_window(), this->dedup_->get_rssi_threshold());
+  }
 }
 
 int BluetoothProxy::get_bluetooth_connections_free() {
@@ -416,6 +478,9 @@ void BluetoothProxy::subscribe_api_connection(api::APIConnection *api_connection
   }
   this->api_connection_ = api_connection;
   this->parent_->recalculate_advertisement_parser_types();
+  // A new subscriber has seen nothing yet
+  if (this->dedup_ != nullptr)
+    this->dedup_->clear();
 
   this->send_bluetooth_scanner_state_(this->parent_->get_scanner_state());
 }
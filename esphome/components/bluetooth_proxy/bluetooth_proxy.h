@@ -2,7 +2,9 @@
 
 #ifdef USE_ESP32
 
+#include <array>
 #include <map>
+#include <memory>
 #include <vector>
 
 #include "esphome/components/api/api_connection.h"
@@ -49,6 +51,39 @@ enum BluetoothProxySubscriptionFlag : uint32_t {
   SUBSCRIPTION_RAW_ADVERTISEMENTS = 1 << 0,
 };
 
+/** Remembers the last forwarded advertisement of recently seen addresses, to drop unchanged rebroadcasts.
+ *
+ * Fixed-size table with a short probe window; when it is full the entry forwarded longest ago is replaced, which at
+ * worst forwards an advertisement that could have been suppressed.
+ */
+class AdvertisementDedup {
+ public:
+  AdvertisementDedup(uint32_t window, uint8_t rssi_threshold) : window_(window), rssi_threshold_(rssi_threshold) {}
+
+  /// Returns true if the advertisement has to be forwarded, false if it repeats the last forwarded one.
+  bool check(const esp32_ble::BLEScanResult &result, uint32_t now);
+  void clear() { this->entries_.fill(Entry{}); }
+
+  uint32_t get_window() const { return this->window_; }
+  uint8_t get_rssi_threshold() const { return this->rssi_threshold_; }
+
+ protected:
+  static constexpr size_t SIZE = 64;
+  static constexpr size_t PROBE_LIMIT = 4;
+
+  struct Entry {
+    uint64_t address;
+    uint32_t payload_hash;
+    uint32_t forwarded_at;
+    int8_t rssi;
+    bool used;
+  };
+
+  std::array<Entry, SIZE> entries_{};
+  uint32_t window_;
+  uint8_t rssi_threshold_;
+};
+
 class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Component {
  public:
   BluetoothProxy();
@@ -102,6 +137,13 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   }
 
   void set_active(bool active) { this->active_ = active; }
+  /// Drop advertisements repeating the last forwarded payload of an address for up to \p window ms, unless the RSSI
+  /// changed by \p rssi_threshold dB or more (0 to ignore RSSI changes).
+  void set_advertisement_dedup(uint32_t window, uint8_t rssi_threshold) {
+    this->dedup_ = make_unique<AdvertisementDedup>(window, rssi_threshold);
+  }
+  uint32_t get_advertisements_forwarded() const { return this->advertisements_forwarded_; }
+  uint32_t get_advertisements_suppressed() const { return this->advertisements_suppressed_; }
   bool has_active() { return this->active_; }
 
   uint32_t get_legacy_version() const {
@@ -146,9 +188,12 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   // BLE advertisement batching
   std::vector<api::BluetoothLERawAdvertisement> advertisement_pool_;
   std::unique_ptr<api::BluetoothLERawAdvertisementsResponse> response_;
+  std::unique_ptr<AdvertisementDedup> dedup_;
 
   // Group 3: 4-byte types
   uint32_t last_advertisement_flush_time_{0};
+  uint32_t advertisements_forwarded_{0};
+  uint32_t advertisements_suppressed_{0};
 
   // Group 4: 1-byte types grouped together
   bool active_;
@@ -0,0 +1,27 @@
+"""
+Boot profiler component for ESPHome.
+"""
+
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+
+CODEOWNERS = ["@esphome/core"]
+
+boot_profiler_ns = cg.esphome_ns.namespace("boot_profiler")
+BootProfiler = boot_profiler_ns.class_("BootProfiler", cg.Component)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(BootProfiler),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    """Generate code for the boot profiler component."""
+    cg.add_define("USE_BOOT_PROFILER")
+
+    # The constructor sets global_boot_profiler so Application::setup() can report to it
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
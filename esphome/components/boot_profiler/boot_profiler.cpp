@@ -0,0 +1,113 @@
+#include "boot_profiler.h"
+
+#ifdef USE_BOOT_PROFILER
+
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include <algorithm>
+
+#ifdef USE_API
+#include "esphome/components/api/api_server.h"
+#endif
+
+namespace esphome {
+
+namespace boot_profiler {
+
+static const char *const TAG = "boot_profiler";
+
+// Number of components listed in the critical path summary
+static const size_t TOP_COMPONENTS = 5;
+
+BootProfiler::BootProfiler() { global_boot_profiler = this; }
+
+void BootProfiler::record_setup(Component *component, uint32_t start_ms, uint32_t setup_us) {
+  if (this->records_.empty())
+    this->records_.reserve(App.get_component_count());
+  this->records_.push_back({component, start_ms, setup_us, 0, false});
+}
+
+void BootProfiler::record_wait(Component *component, uint32_t wait_ms) {
+  // The blocking component is almost always the one that was set up last
+  for (auto it = this->records_.rbegin(); it != this->records_.rend(); ++it) {
+    if (it->component == component) {
+      it->wait_ms += wait_ms;
+      return;
+    }
+  }
+}
+
+void BootProfiler::loop() {
+  // loop() also runs while Application::setup() waits for a blocking component
+  if (!App.is_setup_complete())
+    return;
+#ifdef USE_API
+  if (api::global_api_server != nullptr && !api::global_api_server->is_connected())
+    return;
+#endif
+  this->log_report_(millis());
+  // The records are only needed once, give the memory back
+  this->records_.clear();
+  this->records_.shrink_to_fit();
+  this->disable_loop();
+}
+
+void BootProfiler::log_report_(uint32_t ready_ms) {
+  ESP_LOGI(TAG, "Boot profile: setup() finished after %" PRIu32 "ms, ready after %" PRIu32 "ms",
+           this->setup_complete_ms_, ready_ms);
+
+  ESP_LOGD(TAG, "  Setup timeline (start, setup, wait):");
+  for (auto &record : this->records_) {
+#ifdef USE_SETUP_ASYNC
+    // Async components that were set up during another component's can_proceed() wait ran in parallel with it
+    for (const auto &other : this->records_) {
+      uint32_t wait_start = other.start_ms + other.setup_us / 1000;
+      if (other.wait_ms > 0 && record.start_ms >= wait_start && record.start_ms < wait_start + other.wait_ms) {
+        record.overlapped = true;
+        break;
+      }
+    }
+    const char *suffix = record.overlapped ? " (async)" : "";
+#else
+    const char *suffix = "";
+#endif
+    ESP_LOGD(TAG, "    %6" PRIu32 "ms %6.1fms %6" PRIu32 "ms  %s%s", record.start_ms, record.setup_us / 1000.0f,
+             record.wait_ms, record.component->get_component_source(), suffix);
+  }
+
+  // Setup runs one component at a time, so every setup() and can_proceed() wait adds directly to the time
+  // until the node is usable. Rank the components by how much of that time they account for.
+  auto cost_ms = [](const BootSetupRecord &record) -> uint32_t {
+    return record.overlapped ? 0 : record.setup_us / 1000 + record.wait_ms;
+  };
+  std::sort(this->records_.begin(), this->records_.end(),
+            [&cost_ms](const BootSetupRecord &a, const BootSetupRecord &b) { return cost_ms(a) > cost_ms(b); });
+
+  ESP_LOGI(TAG, "  Critical path:");
+  uint32_t accounted_ms = 0;
+  for (size_t i = 0; i < this->records_.size() && i < TOP_COMPONENTS; i++) {
+    const auto &record = this->records_[i];
+    uint32_t cost = cost_ms(record);
+    if (cost == 0)
+      break;
+    accounted_ms += cost;
+    ESP_LOGI(TAG, "    %s: %" PRIu32 "ms (setup %.1fms, wait %" PRIu32 "ms, %.1f%%)",
+             record.component->get_component_source(), cost, record.setup_us / 1000.0f, record.wait_ms,
+             ready_ms > 0 ? cost * 100.0f / ready_ms : 0.0f);
+  }
+  if (ready_ms > this->setup_complete_ms_) {
+    ESP_LOGI(TAG, "    Waiting for the first client after setup: %" PRIu32 "ms", ready_ms - this->setup_complete_ms_);
+  }
+  ESP_LOGI(TAG, "  Top %u components account for %" PRIu32 "ms", static_cast<unsigned>(TOP_COMPONENTS),
+           accounted_ms);
+}
+
+}  // namespace boot_profiler
+
+boot_profiler::BootProfiler *global_boot_profiler =
+    nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
+
+#endif  // USE_BOOT_PROFILER
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_BOOT_PROFILER
+
+#include <cstdint>
+#include <vector>
+#include "esphome/core/component.h"
+
+namespace esphome {
+
+namespace boot_profiler {
+
+/// Timing of a single component during Application::setup().
+struct BootSetupRecord {
+  Component *component;
+  uint32_t start_ms;  ///< millis() when setup() was called
+  uint32_t setup_us;  ///< Time spent inside setup()
+  uint32_t wait_ms;   ///< Time spent waiting for can_proceed() after setup()
+  bool overlapped;    ///< Set up while another component was waiting, so not on the critical path
+};
+
+/** Records when every component was set up and how long setup() and the can_proceed() wait took.
+ *
+ * The report is logged once the first API client connects (or after setup when the API is not used),
+ * as that is the point where the node becomes usable. Components are listed by their share of the
+ * time to that point so the ones that delay the boot stand out.
+ */
+class BootProfiler : public Component {
+ public:
+  BootProfiler();
+
+  void record_setup(Component *component, uint32_t start_ms, uint32_t setup_us);
+  void record_wait(Component *component, uint32_t wait_ms);
+  void record_setup_complete(uint32_t now) { this->setup_complete_ms_ = now; }
+
+  void loop() override;
+
+ protected:
+  void log_report_(uint32_t ready_ms);
+
+  std::vector<BootSetupRecord> records_;
+  uint32_t setup_complete_ms_{0};
+};
+
+}  // namespace boot_profiler
+
+extern boot_profiler::BootProfiler *global_boot_profiler;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
+
+#endif  // USE_BOOT_PROFILER
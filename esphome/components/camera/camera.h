@@ -67,6 +67,8 @@ class Camera : public EntityBase, public Component {
   virtual void start_stream(CameraRequester requester) = 0;
   // Connection or web server stops the previously started stream.
   virtual void stop_stream(CameraRequester requester) = 0;
+  /// Limits how often a streaming requester gets a new image, 0 means every captured image.
+  virtual void set_requester_update_interval(CameraRequester requester, uint32_t interval) {}
   virtual ~Camera() {}
   /// The singleton instance of the camera implementation.
   static Camera *instance();
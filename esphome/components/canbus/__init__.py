@@ -16,6 +16,7 @@ CONF_REMOTE_TRANSMISSION_REQUEST = "remote_transmission_request"
 CONF_CANBUS_ID = "canbus_id"
 CONF_BIT_RATE = "bit_rate"
 CONF_ON_FRAME = "on_frame"
+CONF_HARDWARE_FILTER = "hardware_filter"
 
 
 def validate_id(config):
@@ -86,6 +87,7 @@ CANBUS_SCHEMA = cv.Schema(
         cv.Required(CONF_CAN_ID): cv.int_range(min=0, max=0x1FFFFFFF),
         cv.Optional(CONF_BIT_RATE, default="125KBPS"): cv.enum(CAN_SPEEDS, upper=True),
         cv.Optional(CONF_USE_EXTENDED_ID, default=False): cv.boolean,
+        cv.Optional(CONF_HARDWARE_FILTER, default=False): cv.boolean,
         cv.Optional(CONF_ON_FRAME): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(CanbusTrigger),
@@ -104,11 +106,24 @@ CANBUS_SCHEMA = cv.Schema(
 CANBUS_SCHEMA.add_extra(validate_id)
 
 
+def validate_hardware_filter(config):
+    if config[CONF_HARDWARE_FILTER] and not config.get(CONF_ON_FRAME):
+        raise cv.Invalid(
+            f"'{CONF_HARDWARE_FILTER}' needs '{CONF_ON_FRAME}' triggers to receive"
+        )
+    return config
+
+
+CANBUS_SCHEMA.add_extra(validate_hardware_filter)
+
+
 async def setup_canbus_core_(var, config):
     await cg.register_component(var, config)
     cg.add(var.set_can_id([config[CONF_CAN_ID]]))
     cg.add(var.set_use_extended_id([config[CONF_USE_EXTENDED_ID]]))
     cg.add(var.set_bitrate(CAN_SPEEDS[config[CONF_BIT_RATE]]))
+    if config[CONF_HARDWARE_FILTER]:
+        cg.add(var.set_hardware_filter(True))
 
     for conf in config.get(CONF_ON_FRAME, []):
         can_id = conf[CONF_CAN_ID]
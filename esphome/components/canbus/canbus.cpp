@@ -1,10 +1,15 @@
 #include "canbus.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace canbus {
 
 static const char *const TAG = "canbus";
+// lost frames are reported at most this often, a bus that's too busy would flood the log otherwise
+static const uint32_t RX_OVERFLOW_LOG_INTERVAL = 10000;
 
 void Canbus::setup() {
   ESP_LOGCONFIG(TAG, "Running setup");
@@ -20,6 +25,7 @@ void Canbus::dump_config() {
   } else {
     ESP_LOGCONFIG(TAG, "config standard id=0x%03" PRIx32, this->can_id_);
   }
+  ESP_LOGCONFIG(TAG, "  Hardware filter: %s", YESNO(this->hardware_filter_));
 }
 
 void Canbus::send_data(uint32_t can_id, bool use_extended_id, bool remote_transmission_request,
@@ -61,9 +67,55 @@ void Canbus::add_trigger(CanbusTrigger *trigger) {
   } else {
     ESP_LOGVV(TAG, "add trigger for std canid=0x%03" PRIx32, trigger->can_id_);
   }
-  this->triggers_.push_back(trigger);
+  if (!trigger->is_exact_()) {
+    this->masked_triggers_.push_back(trigger);
+    return;
+  }
+  // Sorted, so received frames find their triggers with a binary search. upper_bound keeps the configured order of
+  // triggers for the same identifier.
+  const uint32_t key = CanbusTrigger::dispatch_key(trigger->can_id_, trigger->use_extended_id_);
+  auto pos = std::upper_bound(this->triggers_.begin(), this->triggers_.end(), key,
+                              [](uint32_t key, const CanbusTrigger *other) {
+                                return key < CanbusTrigger::dispatch_key(other->can_id_, other->use_extended_id_);
+                              });
+  this->triggers_.insert(pos, trigger);
 };
 
+std::vector<CanFilter> Canbus::get_rx_filters_() const {
+  std::vector<CanFilter> filters;
+  if (!this->hardware_filter_)
+    return filters;
+  filters.reserve(this->triggers_.size() + this->masked_triggers_.size());
+  for (const auto &triggers : {&this->triggers_, &this->masked_triggers_}) {
+    for (auto *trigger : *triggers) {
+      const uint32_t id_bits = CanbusTrigger::id_bits(trigger->use_extended_id_);
+      filters.push_back({trigger->can_id_ & id_bits, trigger->can_id_mask_ & id_bits, trigger->use_extended_id_});
+    }
+  }
+  return filters;
+}
+
+void Canbus::dispatch_(const struct CanFrame &frame) {
+  std::vector<uint8_t> data(frame.data, frame.data + frame.can_data_length_code);
+
+  this->callback_manager_(frame.can_id, frame.use_extended_id, frame.remote_transmission_request, data);
+
+  const uint32_t key = CanbusTrigger::dispatch_key(frame.can_id, frame.use_extended_id);
+  auto it = std::lower_bound(
+      this->triggers_.begin(), this->triggers_.end(), key, [](const CanbusTrigger *trigger, uint32_t key) {
+        return CanbusTrigger::dispatch_key(trigger->can_id_, trigger->use_extended_id_) < key;
+      });
+  for (; it != this->triggers_.end() && CanbusTrigger::dispatch_key((*it)->can_id_, (*it)->use_extended_id_) == key;
+       ++it) {
+    if ((*it)->matches_(frame))
+      (*it)->trigger(data, frame.can_id, frame.remote_transmission_request);
+  }
+  for (auto *trigger : this->masked_triggers_) {
+    if (trigger->matches_(frame))
+      trigger->trigger(data, frame.can_id, frame.remote_transmission_request);
+  }
+}
+
 void Canbus::loop() {
   struct CanFrame can_message;
   // read all messages until queue is empty
@@ -78,25 +130,21 @@ void Canbus::loop() {
                can_message.can_data_length_code);
     }
 
-    std::vector<uint8_t> data;
-
     // show data received
     for (int i = 0; i < can_message.can_data_length_code; i++) {
       ESP_LOGV(TAG, "  can_message.data[%d]=%02x", i, can_message.data[i]);
-      data.push_back(can_message.data[i]);
     }
 
-    this->callback_manager_(can_message.can_id, can_message.use_extended_id, can_message.remote_transmission_request,
-                            data);
-
-    // fire all triggers
-    for (auto *trigger : this->triggers_) {
-      if ((trigger->can_id_ == (can_message.can_id & trigger->can_id_mask_)) &&
-          (trigger->use_extended_id_ == can_message.use_extended_id) &&
-          (!trigger->remote_transmission_request_.has_value() ||
-           trigger->remote_transmission_request_.value() == can_message.remote_transmission_request)) {
-        trigger->trigger(data, can_message.can_id, can_message.remote_transmission_request);
-      }
+    this->dispatch_(can_message);
+  }
+
+  if (this->rx_overflow_count_ != this->rx_overflow_logged_) {
+    const uint32_t now = millis();
+    if (now - this->rx_overflow_log_time_ >= RX_OVERFLOW_LOG_INTERVAL || this->rx_overflow_logged_ == 0) {
+      ESP_LOGW(TAG, "%" PRIu32 " received frames lost, %" PRIu32 " in total",
+               this->rx_overflow_count_ - this->rx_overflow_logged_, this->rx_overflow_count_);
+      this->rx_overflow_logged_ = this->rx_overflow_count_;
+      this->rx_overflow_log_time_ = now;
     }
   }
 }
@@ -62,6 +62,13 @@ struct CanFrame {
   uint8_t data[CAN_MAX_DATA_LENGTH] __attribute__((aligned(8)));
 };
 
+/// An identifier and mask of frames to receive, like one of an on_frame trigger
+struct CanFilter {
+  uint32_t can_id;
+  uint32_t can_id_mask;
+  bool use_extended_id;
+};
+
 class Canbus : public Component {
  public:
   Canbus(){};
@@ -79,6 +86,11 @@ class Canbus : public Component {
   void set_can_id(uint32_t can_id) { this->can_id_ = can_id; }
   void set_use_extended_id(bool use_extended_id) { this->use_extended_id_ = use_extended_id; }
   void set_bitrate(CanSpeed bit_rate) { this->bit_rate_ = bit_rate; }
+  /// Let the controller drop frames no on_frame trigger accepts. Callbacks then only see those frames too.
+  void set_hardware_filter(bool hardware_filter) { this->hardware_filter_ = hardware_filter; }
+
+  /// Number of received frames lost because they weren't read in time
+  uint32_t get_rx_overflow_count() const { return this->rx_overflow_count_; }
 
   void add_trigger(CanbusTrigger *trigger);
   /**
@@ -98,16 +110,28 @@ class Canbus : public Component {
 
  protected:
   template<typename... Ts> friend class CanbusSendAction;
+  // Triggers matching a single identifier, sorted by dispatch_key(), and triggers with a mask
   std::vector<CanbusTrigger *> triggers_{};
+  std::vector<CanbusTrigger *> masked_triggers_{};
   uint32_t can_id_;
   bool use_extended_id_;
   CanSpeed bit_rate_;
+  bool hardware_filter_{false};
+  uint32_t rx_overflow_count_{0};
+  uint32_t rx_overflow_logged_{0};
+  uint32_t rx_overflow_log_time_{0};
   CallbackManager<void(uint32_t can_id, bool extended_id, bool rtr, const std::vector<uint8_t> &data)>
       callback_manager_{};
 
   virtual bool setup_internal();
   virtual Error send_message(struct CanFrame *frame);
   virtual Error read_message(struct CanFrame *frame);
+
+  /// Frames the controller has to receive. Empty if all frames are needed.
+  std::vector<CanFilter> get_rx_filters_() const;
+  /// Called by controllers when they find received frames were lost
+  void add_rx_overflows_(uint32_t count) { this->rx_overflow_count_ += count; }
+  void dispatch_(const struct CanFrame &frame);
 };
 
 template<typename... Ts> class CanbusSendAction : public Action<Ts...>, public Parented<Canbus> {
@@ -156,20 +180,34 @@ class CanbusTrigger : public Trigger<std::vector<uint8_t>, uint32_t, bool>, publ
  public:
   explicit CanbusTrigger(Canbus *parent, const std::uint32_t can_id, const std::uint32_t can_id_mask,
                          const bool use_extended_id)
-      : parent_(parent), can_id_(can_id), can_id_mask_(can_id_mask), use_extended_id_(use_extended_id){};
+      : parent_(parent), can_id_(can_id), can_id_mask_(can_id_mask), use_extended_id_(use_extended_id) {
+    // Registered right away, so the controller knows the frames to receive when it sets up its filters
+    parent->add_trigger(this);
+  }
 
   void set_remote_transmission_request(bool remote_transmission_request) {
     this->remote_transmission_request_ = remote_transmission_request;
   }
 
-  void setup() override { this->parent_->add_trigger(this); }
-
  protected:
   Canbus *parent_;
   uint32_t can_id_;
   uint32_t can_id_mask_;
   bool use_extended_id_;
   optional<bool> remote_transmission_request_{};
+
+  /// Whether the trigger matches just one identifier
+  bool is_exact_() const { return (this->can_id_mask_ | ~id_bits(this->use_extended_id_)) == UINT32_MAX; }
+  bool matches_(const struct CanFrame &frame) const {
+    return this->can_id_ == (frame.can_id & this->can_id_mask_) && this->use_extended_id_ == frame.use_extended_id &&
+           (!this->remote_transmission_request_.has_value() ||
+            *this->remote_transmission_request_ == frame.remote_transmission_request);
+  }
+  static uint32_t id_bits(bool use_extended_id) { return use_extended_id ? 0x1FFFFFFF : 0x7FF; }
+  /// Identifier with the frame format in the top bit, the order of Canbus::triggers_
+  static uint32_t dispatch_key(uint32_t can_id, bool use_extended_id) {
+    return use_extended_id ? (can_id | 0x80000000) : can_id;
+  }
 };
 
 }  // namespace canbus
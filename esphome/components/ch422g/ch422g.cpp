@@ -1,5 +1,6 @@
 #include "ch422g.h"
 #include "esphome/core/log.h"
+#include "esphome/core/loop_arena.h"
 
 namespace esphome {
 namespace ch422g {
@@ -94,7 +95,7 @@ bool CH422GComponent::read_inputs_() {
 bool CH422GComponent::write_reg_(uint8_t reg, uint8_t value) {
   auto err = this->bus_->write(reg, &value, 1);
   if (err != i2c::ERROR_OK) {
-    this->status_set_warning(str_sprintf("write failed for register 0x%X, error %d", reg, err).c_str());
+    this->status_set_warning(arena_sprintf("write failed for register 0x%X, error %d", reg, err).c_str());
     return false;
   }
   this->status_clear_warning();
@@ -105,7 +106,7 @@ uint8_t CH422GComponent::read_reg_(uint8_t reg) {
   uint8_t value;
   auto err = this->bus_->read(reg, &value, 1);
   if (err != i2c::ERROR_OK) {
-    this->status_set_warning(str_sprintf("read failed for register 0x%X, error %d", reg, err).c_str());
+    this->status_set_warning(arena_sprintf("read failed for register 0x%X, error %d", reg, err).c_str());
     return 0;
   }
   this->status_clear_warning();
@@ -9,17 +9,34 @@ namespace ct_clamp {
 
 static const char *const TAG = "ct_clamp";
 
+void CTClampSensor::setup() {
+  if (this->source_->get_sample_rate() == 0)
+    return;
+  this->use_blocks_ = true;
+  this->source_->add_on_samples_callback([this](const float *samples, size_t count) {
+    if (!this->is_sampling_)
+      return;
+    for (size_t i = 0; i < count; i++) {
+      if (!std::isnan(samples[i]))
+        this->add_sample_(samples[i]);
+    }
+  });
+}
+
 void CTClampSensor::dump_config() {
   LOG_SENSOR("", "CT Clamp Sensor", this);
   ESP_LOGCONFIG(TAG, "  Sample Duration: %.2fs", this->sample_duration_ / 1e3f);
+  if (this->use_blocks_)
+    ESP_LOGCONFIG(TAG, "  Sample Rate: %" PRIu32 " Hz (continuous)", this->source_->get_sample_rate());
   LOG_UPDATE_INTERVAL(this);
 }
 
 void CTClampSensor::update() {
-  // Update only starts the sampling phase, in loop() the actual sampling is happening.
+  // Update only starts the sampling phase, in loop() or the samples callback the actual sampling is happening.
 
-  // Request a high loop() execution interval during sampling phase.
-  this->high_freq_.start();
+  // Request a high loop() execution interval during sampling phase, unless the source samples on its own.
+  if (!this->use_blocks_)
+    this->high_freq_.start();
 
   // Set timeout for ending sampling phase
   this->set_timeout("read", this->sample_duration_, [this]() {
@@ -52,7 +69,7 @@ void CTClampSensor::update() {
 }
 
 void CTClampSensor::loop() {
-  if (!this->is_sampling_)
+  if (!this->is_sampling_ || this->use_blocks_)
     return;
 
   // Perform a single sample
@@ -64,7 +81,10 @@ void CTClampSensor::loop() {
   if (this->last_value_ == value)
     return;
   this->last_value_ = value;
+  this->add_sample_(value);
+}
 
+void CTClampSensor::add_sample_(float value) {
   this->num_samples_++;
   this->sample_sum_ += value;
   this->sample_squared_sum_ += value * value;
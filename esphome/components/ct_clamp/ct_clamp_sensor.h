@@ -10,6 +10,7 @@ namespace ct_clamp {
 
 class CTClampSensor : public sensor::Sensor, public PollingComponent {
  public:
+  void setup() override;
   void update() override;
   void loop() override;
   void dump_config() override;
@@ -43,11 +44,16 @@ class CTClampSensor : public sensor::Sensor, public PollingComponent {
    * https://en.wikipedia.org/wiki/Root_mean_square
    */
 
+  /// Add one sample to the sums of the sampling phase.
+  void add_sample_(float value);
+
   float last_value_ = 0.0f;
   float sample_sum_ = 0.0f;
   float sample_squared_sum_ = 0.0f;
   uint32_t num_samples_ = 0;
   bool is_sampling_ = false;
+  /// The source samples at a fixed rate in the background and passes blocks, no need to poll it in loop()
+  bool use_blocks_ = false;
 };
 
 }  // namespace ct_clamp
@@ -42,9 +42,16 @@ void DallasTemperatureSensor::update() {
 
   this->status_clear_warning();
 
-  this->send_command_(DALLAS_COMMAND_START_CONVERSION);
+  // All sensors on the bus share one conversion, so a bus of many sensors isn't converted one by one
+  auto wait = this->bus_->start_conversion(DALLAS_COMMAND_START_CONVERSION, this->millis_to_wait_for_conversion_());
+  if (!wait.has_value()) {
+    ESP_LOGW(TAG, "'%s' - starting conversion failed bus reset", this->get_name().c_str());
+    this->status_set_warning("bus reset failed");
+    this->publish_state(NAN);
+    return;
+  }
 
-  this->set_timeout(this->get_address_name(), this->millis_to_wait_for_conversion_(), [this] {
+  this->set_timeout(this->get_address_name(), *wait, [this] {
     if (!this->read_scratch_pad_() || !this->check_scratch_pad_()) {
       this->publish_state(NAN);
       return;
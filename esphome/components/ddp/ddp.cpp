@@ -0,0 +1,129 @@
+#include "ddp.h"
+#ifdef USE_NETWORK
+#include "ddp_addressable_light_effect.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace ddp {
+
+static const char *const TAG = "ddp";
+static const int PORT = 4048;
+static const int MAX_PACKETS_PER_LOOP = 32;
+
+static const size_t HEADER_SIZE = 10;
+static const size_t TIMECODE_SIZE = 4;
+
+static const uint8_t FLAG_VERSION_MASK = 0xC0;
+static const uint8_t FLAG_VERSION_1 = 0x40;
+static const uint8_t FLAG_TIMECODE = 0x10;
+static const uint8_t FLAG_STORAGE = 0x08;
+static const uint8_t FLAG_REPLY = 0x04;
+static const uint8_t FLAG_QUERY = 0x02;
+static const uint8_t FLAG_PUSH = 0x01;
+
+static const uint8_t ID_DISPLAY = 1;
+
+void DDPComponent::setup() {
+  this->socket_ = socket::socket_ip(SOCK_DGRAM, IPPROTO_IP);
+
+  int enable = 1;
+  int err = this->socket_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to set reuseaddr: errno %d", err);
+    // we can still continue
+  }
+  err = this->socket_->setblocking(false);
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to set nonblocking mode: errno %d", err);
+    this->mark_failed();
+    return;
+  }
+
+  struct sockaddr_storage server;
+
+  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server), PORT);
+  if (sl == 0) {
+    ESP_LOGW(TAG, "Socket unable to set sockaddr: errno %d", errno);
+    this->mark_failed();
+    return;
+  }
+
+  err = this->socket_->bind((struct sockaddr *) &server, sizeof(server));
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to bind: errno %d", errno);
+    this->mark_failed();
+    return;
+  }
+}
+
+void DDPComponent::loop() {
+  uint8_t buf[1460];
+
+  // A frame is usually split over several packets that arrive back to back, read all of them
+  for (int i = 0; i < MAX_PACKETS_PER_LOOP; i++) {
+    ssize_t len = this->socket_->read(buf, sizeof(buf));
+    if (len <= 0) {
+      return;
+    }
+
+    DDPPacket packet;
+    if (!this->packet_(buf, len, packet)) {
+      ESP_LOGV(TAG, "Invalid packet received of size %zd.", len);
+      continue;
+    }
+
+    ESP_LOGV(TAG, "Received DDP packet for offset %" PRIu32 ", with %u bytes%s", packet.offset, packet.length,
+             packet.push ? ", push" : "");
+
+    for (auto *light_effect : this->light_effects_) {
+      light_effect->process_(packet);
+    }
+  }
+}
+
+bool DDPComponent::packet_(const uint8_t *data, size_t len, DDPPacket &packet) {
+  if (len < HEADER_SIZE)
+    return false;
+
+  const uint8_t flags = data[0];
+  if ((flags & FLAG_VERSION_MASK) != FLAG_VERSION_1)
+    return false;
+  // Queries, replies and storage are for configuring devices, only pixel data is supported
+  if (flags & (FLAG_QUERY | FLAG_REPLY | FLAG_STORAGE))
+    return false;
+  if (data[3] != ID_DISPLAY)
+    return false;
+
+  const size_t header_size = flags & FLAG_TIMECODE ? HEADER_SIZE + TIMECODE_SIZE : HEADER_SIZE;
+  packet.offset = encode_uint32(data[4], data[5], data[6], data[7]);
+  packet.length = encode_uint16(data[8], data[9]);
+  if (len < header_size + packet.length)
+    return false;
+
+  packet.data = data + header_size;
+  packet.push = flags & FLAG_PUSH;
+  return true;
+}
+
+void DDPComponent::add_effect(DDPAddressableLightEffect *light_effect) {
+  if (this->light_effects_.count(light_effect)) {
+    return;
+  }
+
+  ESP_LOGD(TAG, "Registering '%s'.", light_effect->get_name().c_str());
+  this->light_effects_.insert(light_effect);
+}
+
+void DDPComponent::remove_effect(DDPAddressableLightEffect *light_effect) {
+  if (!this->light_effects_.count(light_effect)) {
+    return;
+  }
+
+  ESP_LOGD(TAG, "Unregistering '%s'.", light_effect->get_name().c_str());
+  this->light_effects_.erase(light_effect);
+}
+
+}  // namespace ddp
+}  // namespace esphome
+#endif
@@ -0,0 +1,45 @@
+#pragma once
+#include "esphome/core/defines.h"
+#ifdef USE_NETWORK
+#include "esphome/components/socket/socket.h"
+#include "esphome/core/component.h"
+
+#include <cinttypes>
+#include <memory>
+#include <set>
+
+namespace esphome {
+namespace ddp {
+
+class DDPAddressableLightEffect;
+
+struct DDPPacket {
+  uint32_t offset;      // Byte of the device's pixel data the first value goes to
+  uint16_t length;      // Number of values
+  const uint8_t *data;  // Points into the received datagram, only valid while it is processed
+  bool push;            // Last packet of a frame, show it now
+};
+
+class DDPComponent : public esphome::Component {
+  /*
+   * @brief Receives Distributed Display Protocol (DDP) packets, which address the pixel data of the whole device as
+   * one byte stream and mark the last packet of each frame.
+   */
+ public:
+  void setup() override;
+  void loop() override;
+  float get_setup_priority() const override { return setup_priority::AFTER_WIFI; }
+
+  void add_effect(DDPAddressableLightEffect *light_effect);
+  void remove_effect(DDPAddressableLightEffect *light_effect);
+
+ protected:
+  bool packet_(const uint8_t *data, size_t len, DDPPacket &packet);
+
+  std::unique_ptr<socket::Socket> socket_;
+  std::set<DDPAddressableLightEffect *> light_effects_;
+};
+
+}  // namespace ddp
+}  // namespace esphome
+#endif
@@ -0,0 +1,76 @@
+#include "ddp_addressable_light_effect.h"
+#include "ddp.h"
+#ifdef USE_NETWORK
+#include "esphome/core/log.h"
+
+#include <algorithm>
+
+namespace esphome {
+namespace ddp {
+
+static const char *const TAG = "ddp_addressable_light_effect";
+
+DDPAddressableLightEffect::DDPAddressableLightEffect(const std::string &name) : AddressableLightEffect(name) {}
+
+void DDPAddressableLightEffect::start() {
+  AddressableLightEffect::start();
+
+  if (this->ddp_) {
+    this->ddp_->add_effect(this);
+  }
+}
+
+void DDPAddressableLightEffect::stop() {
+  if (this->ddp_) {
+    this->ddp_->remove_effect(this);
+  }
+
+  AddressableLightEffect::stop();
+}
+
+void DDPAddressableLightEffect::apply(light::AddressableLight &it, const Color &current_color) {
+  // ignore, it is run by `DDPComponent::loop()`
+}
+
+void DDPAddressableLightEffect::process_(const DDPPacket &packet) {
+  auto *it = this->get_addressable_();
+
+  const uint32_t channels = this->channels_;
+  const uint32_t light_end = this->start_address_ + it->size() * channels;
+  const uint32_t begin = std::max(packet.offset, this->start_address_);
+  const uint32_t end = std::min(packet.offset + packet.length, light_end);
+
+  if (begin < end) {
+    // Only whole LEDs are written, the values of an LED split over two packets are dropped
+    const int32_t first_led = (begin - this->start_address_ + channels - 1) / channels;
+    const int32_t end_led = (end - this->start_address_) / channels;
+    const uint8_t *input_data = packet.data + (this->start_address_ + first_led * channels - packet.offset);
+
+    ESP_LOGV(TAG, "Applying data for '%s', for %" PRId32 "-%" PRId32 ".", this->get_name().c_str(), first_led,
+             end_led);
+
+    switch (this->channels_) {
+      case DDP_RGB:
+        it->set_colors(first_led, end_led - first_led, [input_data](int32_t i) {
+          const uint8_t *rgb = input_data + i * 3;
+          return Color(rgb[0], rgb[1], rgb[2], (rgb[0] + rgb[1] + rgb[2]) / 3);
+        });
+        break;
+
+      case DDP_RGBW:
+        it->set_colors(first_led, end_led - first_led, [input_data](int32_t i) {
+          const uint8_t *rgbw = input_data + i * 4;
+          return Color(rgbw[0], rgbw[1], rgbw[2], rgbw[3]);
+        });
+        break;
+    }
+  }
+
+  // Show the frame once the source says it is complete. Sources that never push show it once its last LED arrived.
+  if (packet.push || ((begin < end) && (end == light_end)))
+    it->schedule_show();
+}
+
+}  // namespace ddp
+}  // namespace esphome
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/components/light/addressable_light_effect.h"
+#ifdef USE_NETWORK
+namespace esphome {
+namespace ddp {
+
+class DDPComponent;
+struct DDPPacket;
+
+enum DDPLightChannels { DDP_RGB = 3, DDP_RGBW = 4 };
+
+class DDPAddressableLightEffect : public light::AddressableLightEffect {
+  /*
+   * @brief Writes DDP pixel data straight into the light and shows it once the packet that ends the frame arrived.
+   */
+ public:
+  DDPAddressableLightEffect(const std::string &name);
+
+  void start() override;
+  void stop() override;
+  void apply(light::AddressableLight &it, const Color &current_color) override;
+
+  void set_start_address(uint32_t start_address) { this->start_address_ = start_address; }
+  void set_channels(DDPLightChannels channels) { this->channels_ = channels; }
+  void set_ddp(DDPComponent *ddp) { this->ddp_ = ddp; }
+
+ protected:
+  void process_(const DDPPacket &packet);
+
+  uint32_t start_address_{0};
+  DDPLightChannels channels_{DDP_RGB};
+  DDPComponent *ddp_{nullptr};
+
+  friend class DDPComponent;
+};
+
+}  // namespace ddp
+}  // namespace esphome
+#endif
@@ -10,11 +10,13 @@ from esphome.const import (
     CONF_LOOP_TIME,
     PlatformFramework,
 )
+from esphome.core import CORE
 
 CODEOWNERS = ["@OttoWinter"]
 DEPENDENCIES = ["logger"]
 
 CONF_DEBUG_ID = "debug_id"
+CONF_HEAP_TRACKING = "heap_tracking"
 debug_ns = cg.esphome_ns.namespace("debug")
 DebugComponent = debug_ns.class_("DebugComponent", cg.PollingComponent)
 
@@ -23,6 +25,7 @@ CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
             cv.GenerateID(): cv.declare_id(DebugComponent),
+            cv.Optional(CONF_HEAP_TRACKING, default=False): cv.boolean,
             cv.Optional(CONF_DEVICE): cv.invalid(
                 "The 'device' option has been moved to the 'debug' text_sensor component"
             ),
@@ -46,6 +49,13 @@ CONFIG_SCHEMA = cv.All(
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
+    if config[CONF_HEAP_TRACKING]:
+        cg.add_define("USE_DEBUG_HEAP_TRACKING")
+        if CORE.using_esp_idf:
+            from esphome.components.esp32 import add_idf_sdkconfig_option
+
+            # Lets the tracker count the allocations made by each component
+            add_idf_sdkconfig_option("CONFIG_HEAP_USE_HOOKS", True)
 
 
 FILTER_SOURCE_FILES = filter_source_files_from_platform(
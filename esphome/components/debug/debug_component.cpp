@@ -13,16 +13,30 @@ namespace esphome {
 namespace debug {
 
 static const char *const TAG = "debug";
+#ifdef USE_DEBUG_HEAP_TRACKING
+static const size_t HEAP_TRACKING_LOG_COUNT = 5;
+#endif
 
 void DebugComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "Debug component:");
 #ifdef USE_TEXT_SENSOR
   LOG_TEXT_SENSOR("  ", "Device info", this->device_info_);
+#ifdef USE_DEBUG_HEAP_TRACKING
+  LOG_TEXT_SENSOR("  ", "Heap growth", this->heap_growth_);
+#endif
+#ifdef USE_DEBUG_LOOP_STATS
+  LOG_TEXT_SENSOR("  ", "Loop offender", this->loop_offender_);
+#endif
 #endif  // USE_TEXT_SENSOR
 #ifdef USE_SENSOR
   LOG_SENSOR("  ", "Free space on heap", this->free_sensor_);
   LOG_SENSOR("  ", "Largest free heap block", this->block_sensor_);
   LOG_SENSOR("  ", "CPU frequency", this->cpu_frequency_sensor_);
+#ifdef USE_DEBUG_LOOP_STATS
+  LOG_SENSOR("  ", "Loop duration", this->loop_duration_sensor_);
+  LOG_SENSOR("  ", "Loop gap", this->loop_gap_sensor_);
+  LOG_SENSOR("  ", "Loop overruns", this->loop_overruns_sensor_);
+#endif
 #if defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)
   LOG_SENSOR("  ", "Heap fragmentation", this->fragmentation_sensor_);
 #endif  // defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)
@@ -89,9 +103,54 @@ void DebugComponent::update() {
   }
 
 #endif  // USE_SENSOR
+#ifdef USE_DEBUG_HEAP_TRACKING
+  global_heap_tracker.log_top(HEAP_TRACKING_LOG_COUNT);
+#ifdef USE_TEXT_SENSOR
+  if (this->heap_growth_ != nullptr) {
+    this->heap_growth_->publish_state(global_heap_tracker.describe_top());
+  }
+#endif  // USE_TEXT_SENSOR
+#endif  // USE_DEBUG_HEAP_TRACKING
+#ifdef USE_DEBUG_LOOP_STATS
+  this->publish_loop_stats_();
+#endif
   update_platform_();
 }
 
+#ifdef USE_DEBUG_LOOP_STATS
+void DebugComponent::publish_loop_stats_() {
+  const auto &duration = global_loop_stats.get_duration();
+  const auto &gap = global_loop_stats.get_gap();
+  uint32_t offender_count;
+  Component *offender = global_loop_stats.get_top_offender(&offender_count);
+  const char *offender_name = offender == nullptr ? "" : offender->get_component_source();
+
+  ESP_LOGD(TAG,
+           "Loop: %" PRIu32 " iterations, duration p50=%" PRIu32 "ms p99=%" PRIu32 "ms max=%" PRIu32
+           "ms, gap p50=%" PRIu32 "ms p99=%" PRIu32 "ms max=%" PRIu32 "ms",
+           duration.get_count(), duration.get_percentile_ms(0.5f), duration.get_percentile_ms(0.99f),
+           duration.get_max_ms(), gap.get_percentile_ms(0.5f), gap.get_percentile_ms(0.99f), gap.get_max_ms());
+  if (offender != nullptr) {
+    ESP_LOGD(TAG, "Loop: %" PRIu32 " iterations over %" PRIu32 "ms, %s was the slowest in %" PRIu32 " of them",
+             global_loop_stats.get_overruns(), App.get_loop_interval(), offender_name, offender_count);
+  }
+
+#ifdef USE_SENSOR
+  if (this->loop_duration_sensor_ != nullptr)
+    this->loop_duration_sensor_->publish_state(duration.get_percentile_ms(0.99f));
+  if (this->loop_gap_sensor_ != nullptr)
+    this->loop_gap_sensor_->publish_state(gap.get_percentile_ms(0.99f));
+  if (this->loop_overruns_sensor_ != nullptr)
+    this->loop_overruns_sensor_->publish_state(global_loop_stats.get_overruns());
+#endif
+#ifdef USE_TEXT_SENSOR
+  if (this->loop_offender_ != nullptr)
+    this->loop_offender_->publish_state(offender_name);
+#endif
+  global_loop_stats.reset();
+}
+#endif  // USE_DEBUG_LOOP_STATS
+
 float DebugComponent::get_setup_priority() const { return setup_priority::LATE; }
 
 }  // namespace debug
@@ -4,6 +4,8 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/macros.h"
+#include "heap_tracker.h"
+#include "loop_stats.h"
 
 #ifdef USE_SENSOR
 #include "esphome/components/sensor/sensor.h"
@@ -25,6 +27,12 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_TEXT_SENSOR
   void set_device_info_sensor(text_sensor::TextSensor *device_info) { device_info_ = device_info; }
   void set_reset_reason_sensor(text_sensor::TextSensor *reset_reason) { reset_reason_ = reset_reason; }
+#ifdef USE_DEBUG_HEAP_TRACKING
+  void set_heap_growth_sensor(text_sensor::TextSensor *heap_growth) { heap_growth_ = heap_growth; }
+#endif
+#ifdef USE_DEBUG_LOOP_STATS
+  void set_loop_offender_sensor(text_sensor::TextSensor *loop_offender) { loop_offender_ = loop_offender; }
+#endif
 #endif  // USE_TEXT_SENSOR
 #ifdef USE_SENSOR
   void set_free_sensor(sensor::Sensor *free_sensor) { free_sensor_ = free_sensor; }
@@ -33,6 +41,11 @@ class DebugComponent : public PollingComponent {
   void set_fragmentation_sensor(sensor::Sensor *fragmentation_sensor) { fragmentation_sensor_ = fragmentation_sensor; }
 #endif
   void set_loop_time_sensor(sensor::Sensor *loop_time_sensor) { loop_time_sensor_ = loop_time_sensor; }
+#ifdef USE_DEBUG_LOOP_STATS
+  void set_loop_duration_sensor(sensor::Sensor *sensor) { this->loop_duration_sensor_ = sensor; }
+  void set_loop_gap_sensor(sensor::Sensor *sensor) { this->loop_gap_sensor_ = sensor; }
+  void set_loop_overruns_sensor(sensor::Sensor *sensor) { this->loop_overruns_sensor_ = sensor; }
+#endif
 #ifdef USE_ESP32
   void set_psram_sensor(sensor::Sensor *psram_sensor) { this->psram_sensor_ = psram_sensor; }
 #endif  // USE_ESP32
@@ -44,6 +57,9 @@ class DebugComponent : public PollingComponent {
   void on_shutdown() override;
 #endif  // USE_ESP32
  protected:
+#ifdef USE_DEBUG_HEAP_TRACKING
+  friend class HeapTracker;
+#endif
   uint32_t free_heap_{};
 
 #ifdef USE_SENSOR
@@ -56,6 +72,11 @@ class DebugComponent : public PollingComponent {
   sensor::Sensor *fragmentation_sensor_{nullptr};
 #endif
   sensor::Sensor *loop_time_sensor_{nullptr};
+#ifdef USE_DEBUG_LOOP_STATS
+  sensor::Sensor *loop_duration_sensor_{nullptr};
+  sensor::Sensor *loop_gap_sensor_{nullptr};
+  sensor::Sensor *loop_overruns_sensor_{nullptr};
+#endif
 #ifdef USE_ESP32
   sensor::Sensor *psram_sensor_{nullptr};
 #endif  // USE_ESP32
@@ -79,13 +100,22 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_TEXT_SENSOR
   text_sensor::TextSensor *device_info_{nullptr};
   text_sensor::TextSensor *reset_reason_{nullptr};
+#ifdef USE_DEBUG_HEAP_TRACKING
+  text_sensor::TextSensor *heap_growth_{nullptr};
+#endif
+#ifdef USE_DEBUG_LOOP_STATS
+  text_sensor::TextSensor *loop_offender_{nullptr};
+#endif
 #endif  // USE_TEXT_SENSOR
 
   std::string get_reset_reason_();
   std::string get_wakeup_cause_();
-  uint32_t get_free_heap_();
+  static uint32_t get_free_heap_();
   void get_device_info_(std::string &device_info);
   void update_platform_();
+#ifdef USE_DEBUG_LOOP_STATS
+  void publish_loop_stats_();
+#endif
 };
 
 }  // namespace debug
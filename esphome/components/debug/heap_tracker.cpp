@@ -0,0 +1,109 @@
+#include "heap_tracker.h"
+
+#ifdef USE_DEBUG_HEAP_TRACKING
+
+#include "debug_component.h"
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <vector>
+
+#ifdef CONFIG_HEAP_USE_HOOKS
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_attr.h>
+#endif
+
+namespace esphome {
+namespace debug {
+
+static const char *const TAG = "debug.heap";
+
+#ifdef CONFIG_HEAP_USE_HOOKS
+// Only the main task writes these, so the hooks don't need a lock. The task is only known once setup() runs.
+static TaskHandle_t main_task = nullptr;      // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile uint32_t main_allocs = 0;     // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile uint32_t main_frees = 0;      // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+// ESP-IDF calls these after every heap operation when CONFIG_HEAP_USE_HOOKS is set
+extern "C" void IRAM_ATTR esp_heap_trace_alloc_hook(void *ptr, size_t size, uint32_t caps) {
+  if (ptr != nullptr && main_task != nullptr && xTaskGetCurrentTaskHandle() == main_task)
+    main_allocs = main_allocs + 1;
+}
+extern "C" void IRAM_ATTR esp_heap_trace_free_hook(void *ptr) {
+  if (ptr != nullptr && main_task != nullptr && xTaskGetCurrentTaskHandle() == main_task)
+    main_frees = main_frees + 1;
+}
+#endif
+
+HeapTracker::Snapshot HeapTracker::begin() {
+  Snapshot snapshot{};
+  snapshot.free_heap = DebugComponent::get_free_heap_();
+#ifdef CONFIG_HEAP_USE_HOOKS
+  if (main_task == nullptr)
+    main_task = xTaskGetCurrentTaskHandle();
+  snapshot.alloc_count = main_allocs;
+  snapshot.free_count = main_frees;
+#endif
+  return snapshot;
+}
+
+void HeapTracker::record(Component *component, const Snapshot &start) {
+  // measure before the map lookup, which may allocate the first time a component is seen
+  int32_t used = (int32_t) (start.free_heap - DebugComponent::get_free_heap_());
+#ifdef CONFIG_HEAP_USE_HOOKS
+  uint32_t allocs = main_allocs - start.alloc_count;
+  uint32_t frees = main_frees - start.free_count;
+  if (used == 0 && allocs == 0 && frees == 0)
+    return;
+#else
+  if (used == 0)
+    return;
+#endif
+  auto &stats = this->stats_[component];
+  stats.live_bytes += used;
+  stats.peak_bytes = std::max(stats.peak_bytes, stats.live_bytes);
+#ifdef CONFIG_HEAP_USE_HOOKS
+  stats.alloc_count += allocs;
+  stats.free_count += frees;
+#endif
+}
+
+static const char *source_of(const Component *component) {
+  return component == nullptr ? "<none>" : component->get_component_source();
+}
+
+void HeapTracker::log_top(size_t count) const {
+  std::vector<std::pair<Component *, ComponentHeapStats>> sorted(this->stats_.begin(), this->stats_.end());
+  std::sort(sorted.begin(), sorted.end(),
+            [](const auto &a, const auto &b) { return a.second.live_bytes > b.second.live_bytes; });
+  ESP_LOGD(TAG, "Heap growth by component since boot:");
+  for (size_t i = 0; i != std::min(count, sorted.size()); i++) {
+    const auto &stats = sorted[i].second;
+    ESP_LOGD(TAG, "  %s: live=%" PRId32 " B, peak=%" PRId32 " B, allocs=%" PRIu32 ", frees=%" PRIu32,
+             source_of(sorted[i].first), stats.live_bytes, stats.peak_bytes, stats.alloc_count, stats.free_count);
+  }
+}
+
+std::string HeapTracker::describe_top() const {
+  const std::pair<Component *const, ComponentHeapStats> *top = nullptr;
+  for (const auto &it : this->stats_) {
+    if (top == nullptr || it.second.live_bytes > top->second.live_bytes)
+      top = &it;
+  }
+  if (top == nullptr)
+    return "";
+  return str_sprintf("%s: %" PRId32 " B (peak %" PRId32 " B)", source_of(top->first), top->second.live_bytes,
+                     top->second.peak_bytes);
+}
+
+}  // namespace debug
+
+debug::HeapTracker global_heap_tracker;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
+
+#endif  // USE_DEBUG_HEAP_TRACKING
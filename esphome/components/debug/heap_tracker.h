@@ -0,0 +1,62 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_DEBUG_HEAP_TRACKING
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace esphome {
+
+class Component;
+
+namespace debug {
+
+struct ComponentHeapStats {
+  /// Net growth of the used heap over all the runs of the component since boot. A leak makes it grow steadily.
+  int32_t live_bytes{0};
+  /// Highest value live_bytes had
+  int32_t peak_bytes{0};
+  /// Allocations and frees made by the main task while the component ran, only counted on ESP-IDF
+  uint32_t alloc_count{0};
+  uint32_t free_count{0};
+};
+
+/** Attributes heap usage to the component that was running when it changed.
+ *
+ * The core takes a snapshot before each setup(), loop() and scheduler callback and records the difference after it.
+ * Other tasks allocate at the same time, so a single record can be off, but memory a component keeps never comes
+ * back and adds up in its live bytes.
+ */
+class HeapTracker {
+ public:
+  struct Snapshot {
+    uint32_t free_heap;
+#ifdef CONFIG_HEAP_USE_HOOKS
+    uint32_t alloc_count;
+    uint32_t free_count;
+#endif
+  };
+
+  Snapshot begin();
+  void record(Component *component, const Snapshot &start);
+
+  const std::map<Component *, ComponentHeapStats> &get_stats() const { return this->stats_; }
+  /// Log the components whose heap grew the most
+  void log_top(size_t count) const;
+  /// Describe the component whose heap grew the most, for a text sensor
+  std::string describe_top() const;
+
+ protected:
+  std::map<Component *, ComponentHeapStats> stats_;
+};
+
+}  // namespace debug
+
+extern debug::HeapTracker global_heap_tracker;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
+
+#endif  // USE_DEBUG_HEAP_TRACKING
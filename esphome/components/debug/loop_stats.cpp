@@ -0,0 +1,96 @@
+#include "loop_stats.h"
+
+#ifdef USE_DEBUG_LOOP_STATS
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace debug {
+
+uint32_t LoopHistogram::bucket_upper_bound_(uint8_t bucket) {
+  if (bucket < LINEAR_BUCKETS)
+    return bucket + 1;
+  return LINEAR_BUCKETS << (bucket - LINEAR_BUCKETS + 1);
+}
+
+void LoopHistogram::record(uint32_t ms) {
+  uint8_t bucket;
+  if (ms < LINEAR_BUCKETS) {
+    bucket = ms;
+  } else {
+    bucket = LINEAR_BUCKETS;
+    while (bucket != BUCKET_COUNT - 1 && ms >= bucket_upper_bound_(bucket))
+      bucket++;
+  }
+  this->buckets_[bucket]++;
+  this->count_++;
+  this->max_ms_ = std::max(this->max_ms_, ms);
+}
+
+void LoopHistogram::reset() {
+  memset(this->buckets_, 0, sizeof(this->buckets_));
+  this->count_ = 0;
+  this->max_ms_ = 0;
+}
+
+uint32_t LoopHistogram::get_percentile_ms(float quantile) const {
+  if (this->count_ == 0)
+    return 0;
+  uint32_t target = static_cast<uint32_t>(quantile * this->count_);
+  if (target >= this->count_)
+    target = this->count_ - 1;
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < BUCKET_COUNT - 1; i++) {
+    seen += this->buckets_[i];
+    if (seen > target)
+      return std::min(bucket_upper_bound_(i), this->max_ms_);
+  }
+  return this->max_ms_;
+}
+
+void LoopStats::begin_iteration(uint32_t now) {
+  if (this->started_)
+    this->gap_.record(now - this->iteration_start_);
+  this->started_ = true;
+  this->iteration_start_ = now;
+  this->slowest_ = nullptr;
+  this->slowest_ms_ = 0;
+}
+
+void LoopStats::end_iteration(uint32_t now, uint32_t budget_ms) {
+  uint32_t duration = now - this->iteration_start_;
+  this->duration_.record(duration);
+  if (duration > budget_ms) {
+    this->overruns_++;
+    if (this->slowest_ != nullptr)
+      this->offenders_[this->slowest_]++;
+  }
+}
+
+Component *LoopStats::get_top_offender(uint32_t *count) const {
+  Component *top = nullptr;
+  *count = 0;
+  for (const auto &it : this->offenders_) {
+    if (it.second > *count) {
+      top = it.first;
+      *count = it.second;
+    }
+  }
+  return top;
+}
+
+void LoopStats::reset() {
+  this->duration_.reset();
+  this->gap_.reset();
+  this->offenders_.clear();
+  this->overruns_ = 0;
+}
+
+}  // namespace debug
+
+debug::LoopStats global_loop_stats;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
+
+#endif  // USE_DEBUG_LOOP_STATS
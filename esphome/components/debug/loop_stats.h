@@ -0,0 +1,80 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_DEBUG_LOOP_STATS
+
+#include <cstdint>
+#include <map>
+
+namespace esphome {
+
+class Component;
+
+namespace debug {
+
+/// Millisecond histogram: 1ms wide buckets up to 32ms, then buckets of doubling width, the last from 4096ms up.
+class LoopHistogram {
+ public:
+  static constexpr uint8_t LINEAR_BUCKETS = 32;
+  static constexpr uint8_t BUCKET_COUNT = LINEAR_BUCKETS + 8;
+
+  void record(uint32_t ms);
+  void reset();
+  uint32_t get_count() const { return this->count_; }
+  uint32_t get_max_ms() const { return this->max_ms_; }
+  /// Upper bound in milliseconds of the bucket containing the given quantile (0.0 - 1.0)
+  uint32_t get_percentile_ms(float quantile) const;
+
+ protected:
+  static uint32_t bucket_upper_bound_(uint8_t bucket);
+
+  uint32_t buckets_[BUCKET_COUNT]{};
+  uint32_t count_{0};
+  uint32_t max_ms_{0};
+};
+
+/** Timing of the main loop iterations between two debug updates.
+ *
+ * The duration of an iteration is the time spent running components and scheduler callbacks, the gap is the time from
+ * the start of one iteration to the start of the next, sleep included. An iteration is over budget when its duration
+ * exceeds the loop interval; the component that took longest in it is counted as the offender.
+ */
+class LoopStats {
+ public:
+  void begin_iteration(uint32_t now);
+  /// Called after each component operation in the iteration
+  void record_component(Component *component, uint32_t duration_ms) {
+    if (duration_ms >= this->slowest_ms_) {
+      this->slowest_ms_ = duration_ms;
+      this->slowest_ = component;
+    }
+  }
+  void end_iteration(uint32_t now, uint32_t budget_ms);
+
+  const LoopHistogram &get_duration() const { return this->duration_; }
+  const LoopHistogram &get_gap() const { return this->gap_; }
+  uint32_t get_overruns() const { return this->overruns_; }
+  /// The component that was slowest in the most over-budget iterations, nullptr if there were none
+  Component *get_top_offender(uint32_t *count) const;
+  /// Start a new period
+  void reset();
+
+ protected:
+  LoopHistogram duration_;
+  LoopHistogram gap_;
+  std::map<Component *, uint32_t> offenders_;
+  uint32_t overruns_{0};
+  uint32_t iteration_start_{0};
+  bool started_{false};
+  Component *slowest_{nullptr};
+  uint32_t slowest_ms_{0};
+};
+
+}  // namespace debug
+
+extern debug::LoopStats global_loop_stats;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
+
+#endif  // USE_DEBUG_LOOP_STATS
@@ -10,6 +10,7 @@ from esphome.const import (
     ENTITY_CATEGORY_DIAGNOSTIC,
     ICON_COUNTER,
     ICON_TIMER,
+    STATE_CLASS_MEASUREMENT,
     UNIT_BYTES,
     UNIT_HERTZ,
     UNIT_MILLISECOND,
@@ -20,6 +21,9 @@ from . import CONF_DEBUG_ID, DebugComponent
 
 DEPENDENCIES = ["debug"]
 
+CONF_LOOP_DURATION = "loop_duration"
+CONF_LOOP_GAP = "loop_gap"
+CONF_LOOP_OVERRUNS = "loop_overruns"
 CONF_PSRAM = "psram"
 
 CONFIG_SCHEMA = {
@@ -52,6 +56,27 @@ CONFIG_SCHEMA = {
         accuracy_decimals=0,
         entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
     ),
+    # 99th percentiles and counts over each update interval
+    cv.Optional(CONF_LOOP_DURATION): sensor.sensor_schema(
+        unit_of_measurement=UNIT_MILLISECOND,
+        icon=ICON_TIMER,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+    cv.Optional(CONF_LOOP_GAP): sensor.sensor_schema(
+        unit_of_measurement=UNIT_MILLISECOND,
+        icon=ICON_TIMER,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+    cv.Optional(CONF_LOOP_OVERRUNS): sensor.sensor_schema(
+        icon=ICON_COUNTER,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
     cv.Optional(CONF_PSRAM): cv.All(
         cv.only_on_esp32,
         cv.requires_component("psram"),
@@ -92,6 +117,21 @@ async def to_code(config):
         sens = await sensor.new_sensor(loop_time_conf)
         cg.add(debug_component.set_loop_time_sensor(sens))
 
+    if loop_duration_conf := config.get(CONF_LOOP_DURATION):
+        cg.add_define("USE_DEBUG_LOOP_STATS")
+        sens = await sensor.new_sensor(loop_duration_conf)
+        cg.add(debug_component.set_loop_duration_sensor(sens))
+
+    if loop_gap_conf := config.get(CONF_LOOP_GAP):
+        cg.add_define("USE_DEBUG_LOOP_STATS")
+        sens = await sensor.new_sensor(loop_gap_conf)
+        cg.add(debug_component.set_loop_gap_sensor(sens))
+
+    if loop_overruns_conf := config.get(CONF_LOOP_OVERRUNS):
+        cg.add_define("USE_DEBUG_LOOP_STATS")
+        sens = await sensor.new_sensor(loop_overruns_conf)
+        cg.add(debug_component.set_loop_overruns_sensor(sens))
+
     if psram_conf := config.get(CONF_PSRAM):
         sens = await sensor.new_sensor(psram_conf)
         cg.add(debug_component.set_psram_sensor(sens))
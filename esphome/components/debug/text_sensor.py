@@ -6,13 +6,17 @@ from esphome.const import (
     ENTITY_CATEGORY_DIAGNOSTIC,
     ICON_CHIP,
     ICON_RESTART,
+    ICON_TIMER,
 )
+import esphome.final_validate as fv
 
-from . import CONF_DEBUG_ID, DebugComponent
+from . import CONF_DEBUG_ID, CONF_HEAP_TRACKING, DebugComponent
 
 DEPENDENCIES = ["debug"]
 
 
+CONF_HEAP_GROWTH = "heap_growth"
+CONF_LOOP_OFFENDER = "loop_offender"
 CONF_RESET_REASON = "reset_reason"
 CONFIG_SCHEMA = cv.Schema(
     {
@@ -25,10 +29,31 @@ CONFIG_SCHEMA = cv.Schema(
             icon=ICON_RESTART,
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
+        cv.Optional(CONF_HEAP_GROWTH): text_sensor.text_sensor_schema(
+            icon=ICON_CHIP,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_LOOP_OFFENDER): text_sensor.text_sensor_schema(
+            icon=ICON_TIMER,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
     }
 )
 
 
+def _final_validate(config):
+    if CONF_HEAP_GROWTH not in config:
+        return
+    debug_config = fv.full_config.get()["debug"]
+    if not debug_config[CONF_HEAP_TRACKING]:
+        raise cv.Invalid(
+            f"'{CONF_HEAP_GROWTH}' requires '{CONF_HEAP_TRACKING}: true' in 'debug:'"
+        )
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
 async def to_code(config):
     debug_component = await cg.get_variable(config[CONF_DEBUG_ID])
 
@@ -38,3 +63,10 @@ async def to_code(config):
     if CONF_RESET_REASON in config:
         sens = await text_sensor.new_text_sensor(config[CONF_RESET_REASON])
         cg.add(debug_component.set_reset_reason_sensor(sens))
+    if CONF_HEAP_GROWTH in config:
+        sens = await text_sensor.new_text_sensor(config[CONF_HEAP_GROWTH])
+        cg.add(debug_component.set_heap_growth_sensor(sens))
+    if CONF_LOOP_OFFENDER in config:
+        cg.add_define("USE_DEBUG_LOOP_STATS")
+        sens = await text_sensor.new_text_sensor(config[CONF_LOOP_OFFENDER])
+        cg.add(debug_component.set_loop_offender_sensor(sens))
@@ -14,6 +14,7 @@ bool global_has_deep_sleep = false;  // NOLINT(cppcoreguidelines-avoid-non-const
 void DeepSleepComponent::setup() {
   ESP_LOGCONFIG(TAG, "Running setup");
   global_has_deep_sleep = true;
+  this->last_awake_duration_ = this->load_awake_duration_();
 
   const optional<uint32_t> run_duration = get_run_duration_();
   if (run_duration.has_value()) {
@@ -33,6 +34,9 @@ void DeepSleepComponent::dump_config() {
   if (this->run_duration_.has_value()) {
     ESP_LOGCONFIG(TAG, "  Run Duration: %" PRIu32 " ms", *this->run_duration_);
   }
+  if (this->last_awake_duration_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Last Wake Cycle: %" PRIu32 " ms", this->last_awake_duration_);
+  }
   this->dump_config_platform_();
 }
 
@@ -59,7 +63,7 @@ void DeepSleepComponent::begin_sleep(bool manual) {
     return;
   }
 
-  ESP_LOGI(TAG, "Beginning sleep");
+  ESP_LOGI(TAG, "Beginning sleep after %" PRIu32 " ms awake", millis());
   if (this->sleep_duration_.has_value()) {
     ESP_LOGI(TAG, "Sleeping for %" PRId64 "us", *this->sleep_duration_);
   }
@@ -69,6 +73,7 @@ void DeepSleepComponent::begin_sleep(bool manual) {
   App.teardown_components(TEARDOWN_TIMEOUT_DEEP_SLEEP_MS);
   App.run_powerdown_hooks();
 
+  this->save_awake_duration_(millis());
   this->deep_sleep_();
 }
 
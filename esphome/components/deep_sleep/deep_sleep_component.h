@@ -103,6 +103,9 @@ class DeepSleepComponent : public Component {
   void prevent_deep_sleep();
   void allow_deep_sleep();
 
+  /// Milliseconds the device was awake in the previous wake cycle, 0 after power on or reset.
+  uint32_t get_last_awake_duration() const { return this->last_awake_duration_; }
+
  protected:
   // Returns nullopt if no run duration is set. Otherwise, returns the run
   // duration before entering deep sleep.
@@ -111,6 +114,9 @@ class DeepSleepComponent : public Component {
   void dump_config_platform_();
   bool prepare_to_sleep_();
   void deep_sleep_();
+  /// Awake duration kept in RTC memory, which survives deep sleep but not a power cycle
+  uint32_t load_awake_duration_();
+  void save_awake_duration_(uint32_t duration);
 
   optional<uint64_t> sleep_duration_;
 #ifdef USE_ESP32
@@ -125,6 +131,7 @@ class DeepSleepComponent : public Component {
   optional<WakeupCauseToRunDuration> wakeup_cause_to_run_duration_;
 #endif
   optional<uint32_t> run_duration_;
+  uint32_t last_awake_duration_{0};
   bool next_enter_deep_sleep_{false};
   bool prevent_{false};
 };
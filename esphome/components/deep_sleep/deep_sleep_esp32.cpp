@@ -2,11 +2,16 @@
 #include "deep_sleep_component.h"
 #include "esphome/core/log.h"
 
+#include <esp_attr.h>
+
 namespace esphome {
 namespace deep_sleep {
 
 static const char *const TAG = "deep_sleep";
 
+// RTC slow memory keeps its contents through deep sleep, but not through a reset
+static RTC_DATA_ATTR uint32_t rtc_awake_duration = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
 optional<uint32_t> DeepSleepComponent::get_run_duration_() const {
   if (this->wakeup_cause_to_run_duration_.has_value()) {
     esp_sleep_wakeup_cause_t wakeup_cause = esp_sleep_get_wakeup_cause();
@@ -113,6 +118,14 @@ void DeepSleepComponent::deep_sleep_() {
   esp_deep_sleep_start();
 }
 
+uint32_t DeepSleepComponent::load_awake_duration_() {
+  if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_UNDEFINED)
+    return 0;
+  return rtc_awake_duration;
+}
+
+void DeepSleepComponent::save_awake_duration_(uint32_t duration) { rtc_awake_duration = duration; }
+
 }  // namespace deep_sleep
 }  // namespace esphome
 #endif
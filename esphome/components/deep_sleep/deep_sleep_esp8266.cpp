@@ -1,5 +1,6 @@
 #ifdef USE_ESP8266
 #include "deep_sleep_component.h"
+#include "esphome/core/preferences.h"
 
 #include <Esp.h>
 
@@ -18,6 +19,21 @@ void DeepSleepComponent::deep_sleep_() {
   ESP.deepSleep(*this->sleep_duration_);  // NOLINT(readability-static-accessed-through-instance)
 }
 
+static constexpr uint32_t AWAKE_DURATION_HASH = fnv1_hash("deep_sleep_awake_duration");
+
+// Preferences that aren't in flash are kept in the RTC user memory
+static ESPPreferenceObject awake_duration_pref() {
+  return global_preferences->make_preference<uint32_t>(AWAKE_DURATION_HASH, false);
+}
+
+uint32_t DeepSleepComponent::load_awake_duration_() {
+  uint32_t duration = 0;
+  awake_duration_pref().load(&duration);
+  return duration;
+}
+
+void DeepSleepComponent::save_awake_duration_(uint32_t duration) { awake_duration_pref().save(&duration); }
+
 }  // namespace deep_sleep
 }  // namespace esphome
 #endif
@@ -0,0 +1,99 @@
+#include "dirty_region.h"
+
+#include <algorithm>
+
+namespace esphome {
+namespace display {
+
+static inline uint32_t rect_area(const Rect &rect) { return static_cast<uint32_t>(rect.w) * rect.h; }
+
+static inline Rect rect_union(const Rect &a, const Rect &b) {
+  const int16_t x = std::min(a.x, b.x);
+  const int16_t y = std::min(a.y, b.y);
+  return Rect(x, y, std::max(a.x2(), b.x2()) - x, std::max(a.y2(), b.y2()) - y);
+}
+
+// Pixels sent in addition to both rectangles' if they are sent as their union. Overlaps count as savings.
+static inline int32_t merge_cost(const Rect &a, const Rect &b) {
+  return static_cast<int32_t>(rect_area(rect_union(a, b))) - static_cast<int32_t>(rect_area(a)) -
+         static_cast<int32_t>(rect_area(b));
+}
+
+void DirtyRegion::add(Rect rect) {
+  if ((rect.w <= 0) || (rect.h <= 0))
+    return;
+
+  if (this->tile_size_ > 1) {
+    const int16_t tile = this->tile_size_;
+    const int16_t x2 = (rect.x2() + tile - 1) / tile * tile;
+    const int16_t y2 = (rect.y2() + tile - 1) / tile * tile;
+    rect.x = rect.x / tile * tile;
+    rect.y = rect.y / tile * tile;
+    rect.w = x2 - rect.x;
+    rect.h = y2 - rect.y;
+  }
+
+  uint8_t best = 0;
+  int32_t best_cost = INT32_MAX;
+  for (uint8_t i = 0; i < this->count_; ++i) {
+    const int32_t cost = merge_cost(this->rects_[i], rect);
+    if (cost < best_cost) {
+      best_cost = cost;
+      best = i;
+    }
+  }
+
+  if ((this->count_ < MAX_RECTS) && (best_cost >= static_cast<int32_t>(this->rect_overhead_))) {
+    this->last_ = this->count_;
+    this->rects_[this->count_++] = rect;
+    return;
+  }
+
+  this->rects_[best] = rect_union(this->rects_[best], rect);
+  this->last_ = best;
+  this->merge_into_(best);
+}
+
+void DirtyRegion::add_all(int16_t width, int16_t height) {
+  this->rects_[0] = Rect(0, 0, width, height);
+  this->count_ = 1;
+  this->last_ = 0;
+}
+
+uint32_t DirtyRegion::area() const {
+  uint32_t area = 0;
+  for (const Rect &rect : *this) {
+    area += rect_area(rect);
+  }
+  return area;
+}
+
+void DirtyRegion::merge_into_(uint8_t index) {
+  // The grown rectangle may now overlap or nearly touch others, which are cheaper to send as part of it
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (uint8_t i = 0; i < this->count_; ++i) {
+      if ((i != index) &&
+          (merge_cost(this->rects_[index], this->rects_[i]) < static_cast<int32_t>(this->rect_overhead_))) {
+        this->rects_[index] = rect_union(this->rects_[index], this->rects_[i]);
+        this->remove_(i);
+        if (i < index)
+          --index;
+        merged = true;
+        break;
+      }
+    }
+  }
+  this->last_ = index;
+}
+
+void DirtyRegion::remove_(uint8_t index) {
+  for (uint8_t i = index + 1; i < this->count_; ++i) {
+    this->rects_[i - 1] = this->rects_[i];
+  }
+  --this->count_;
+}
+
+}  // namespace display
+}  // namespace esphome
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "rect.h"
+
+#include "esphome/core/helpers.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace display {
+
+class DirtyRegion {
+  /*
+   * @brief Tracks the changed parts of a display buffer as a few rectangles, so a driver only sends those to the panel.
+   *
+   * Every rectangle sent costs an address window and a new transfer on top of its pixels. A change is merged into an
+   * existing rectangle when the extra pixels the merged rectangle covers cost less than that overhead, otherwise it
+   * starts a new rectangle. Once all rectangles are in use, changes go to the rectangle that grows the least. Two small
+   * changes in opposite corners are then sent as two small rectangles instead of most of the panel.
+   */
+ public:
+  static const uint8_t MAX_RECTS = 4;
+
+  /// @brief Sets the cost of sending one more rectangle, in pixels. Defaults to 128 pixels.
+  void set_rect_overhead(uint32_t pixels) { this->rect_overhead_ = pixels; }
+
+  /// @brief Aligns rectangles to tiles of this many pixels, for panels whose address windows must be aligned.
+  /// The display's width and height must be multiples of it.
+  void set_tile_size(uint8_t tile_size) { this->tile_size_ = tile_size; }
+
+  /// @brief Marks a single pixel as changed
+  inline void add(int16_t x, int16_t y) ESPHOME_ALWAYS_INLINE {
+    // Drawing mostly touches pixels next to the previous ones, so check the rectangle that changed last first
+    if (this->count_ > 0) {
+      const Rect &last = this->rects_[this->last_];
+      if ((x >= last.x) && (x < last.x2()) && (y >= last.y) && (y < last.y2()))
+        return;
+    }
+    this->add(Rect(x, y, 1, 1));
+  }
+
+  /// @brief Marks a rectangle as changed
+  void add(Rect rect);
+
+  /// @brief Marks the whole display as changed, like after a fill
+  void add_all(int16_t width, int16_t height);
+
+  bool empty() const { return this->count_ == 0; }
+  size_t size() const { return this->count_; }
+  const Rect *begin() const { return this->rects_; }
+  const Rect *end() const { return this->rects_ + this->count_; }
+
+  /// @brief Total pixels in all rectangles
+  uint32_t area() const;
+
+  /// @brief Forgets all changes after they were sent and stores how many bytes sending them took
+  void flushed(uint32_t bytes_sent) {
+    this->last_bytes_sent_ = bytes_sent;
+    this->count_ = 0;
+    this->last_ = 0;
+  }
+
+  /// @brief Bytes of pixel data sent by the last update, 0 if nothing changed
+  uint32_t get_last_bytes_sent() const { return this->last_bytes_sent_; }
+
+ protected:
+  /// @brief Merges rectangles with the rectangle at `index` while that is cheaper than sending them separately
+  void merge_into_(uint8_t index);
+  void remove_(uint8_t index);
+
+  Rect rects_[MAX_RECTS];
+  uint8_t count_{0};
+  uint8_t last_{0};
+  uint8_t tile_size_{1};
+  uint32_t rect_overhead_{128};
+  uint32_t last_bytes_sent_{0};
+};
+
+}  // namespace display
+}  // namespace esphome
@@ -4,6 +4,9 @@
 #include "display_color_utils.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
+#ifdef USE_RUNTIME_STATS_TRACE
+#include "esphome/components/runtime_stats/trace_buffer.h"
+#endif
 
 namespace esphome {
 namespace display {
@@ -86,16 +89,28 @@ void Display::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8
   }
 }
 
-void HOT Display::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = x; i < x + width; i++)
-    this->draw_pixel_at(i, y, color);
+void HOT Display::draw_rgb565_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, size_t stride,
+                                 bool big_endian) {
+  for (int y = 0; y != h; y++, ptr += stride) {
+    const uint8_t *pos = ptr;
+    for (int x = 0; x != w; x++, pos += 2) {
+      const uint8_t first = progmem_read_byte(pos);
+      const uint8_t second = progmem_read_byte(pos + 1);
+      const uint16_t rgb565 = big_endian ? encode_uint16(first, second) : encode_uint16(second, first);
+      this->draw_pixel_at(x_start + x, y_start + y, ColorUtil::rgb565_to_color(rgb565));
+    }
+  }
 }
-void HOT Display::vertical_line(int x, int y, int height, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = y; i < y + height; i++)
-    this->draw_pixel_at(x, i, color);
+
+void HOT Display::fill_rect(int x_start, int y_start, int w, int h, Color color) {
+  for (int y = y_start; y < y_start + h; y++) {
+    for (int x = x_start; x < x_start + w; x++)
+      this->draw_pixel_at(x, y, color);
+  }
 }
+
+void HOT Display::horizontal_line(int x, int y, int width, Color color) { this->fill_rect(x, y, width, 1, color); }
+void HOT Display::vertical_line(int x, int y, int height, Color color) { this->fill_rect(x, y, 1, height, color); }
 void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->horizontal_line(x1, y1, width, color);
   this->horizontal_line(x1, y1 + height - 1, width, color);
@@ -103,10 +118,7 @@ void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
 void Display::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
-  for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
-  }
+  this->fill_rect(x1, y1, width, height, color);
 }
 void HOT Display::circle(int center_x, int center_xy, int radius, Color color) {
   int dx = -radius;
@@ -138,10 +150,7 @@ void Display::filled_circle(int center_x, int center_y, int radius, Color color)
   int e2;
 
   do {
-    this->draw_pixel_at(center_x - dx, center_y + dy, color);
-    this->draw_pixel_at(center_x + dx, center_y + dy, color);
-    this->draw_pixel_at(center_x + dx, center_y - dy, color);
-    this->draw_pixel_at(center_x - dx, center_y - dy, color);
+    // The spans include the outline pixels
     int hline_width = 2 * (-dx) + 1;
     this->horizontal_line(center_x + dx, center_y + dy, hline_width, color);
     this->horizontal_line(center_x + dx, center_y - dy, hline_width, color);
@@ -648,6 +657,12 @@ void Display::show_page(DisplayPage *page) {
 void Display::show_next_page() { this->page_->show_next(); }
 void Display::show_prev_page() { this->page_->show_prev(); }
 void Display::do_update_() {
+#ifdef USE_RUNTIME_STATS_TRACE
+  runtime_stats::TraceScope trace_scope("display.update", runtime_stats::TraceCategory::DISPLAY);
+#endif
+#ifdef USE_DISPLAY_STATS
+  const uint32_t start = micros();
+#endif
   if (this->auto_clear_enabled_) {
     this->clear();
   }
@@ -659,6 +674,9 @@ void Display::do_update_() {
     (*this->writer_)(*this);
   }
   this->clear_clipping_();
+#ifdef USE_DISPLAY_STATS
+  this->record_update_(micros() - start);
+#endif
 }
 void DisplayOnPageChangeTrigger::process(DisplayPage *from, DisplayPage *to) {
   if ((this->from_ == nullptr || this->from_ == from) && (this->to_ == nullptr || this->to_ == to))
@@ -192,6 +192,17 @@ extern const Color COLOR_OFF;
 /// Turn the pixel ON.
 extern const Color COLOR_ON;
 
+#ifdef USE_DISPLAY_STATS
+/// Rendering statistics of a display, summed over all updates since the last snapshot
+struct DisplayRenderStats {
+  uint32_t updates{0};
+  uint32_t draw_us{0};      // Running the lambda or page, including rasterising and converting into the buffer
+  uint32_t transfer_us{0};  // Sending to the panel, as far as the main loop waits for it
+  uint32_t pixels{0};       // Pixels written by drawing calls, after clipping
+  uint32_t bytes{0};        // Pixel data sent to the panel
+};
+#endif
+
 class BaseImage {
  public:
   virtual void draw(int x, int y, Display *display, Color color_on, Color color_off) = 0;
@@ -256,6 +267,21 @@ class Display : public PollingComponent {
     this->draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, 0, 0, 0);
   }
 
+  /** Draw a block of RGB565 pixels, for example part of an image, honouring the clipping region. Unlike
+   * draw_pixels_at() this always goes through the display's buffer, and the pixels may be stored in flash.
+   * The naive implementation here draws every pixel, drivers whose buffer holds RGB565 copy whole rows instead.
+   *
+   * \param stride The distance in bytes between the starts of two rows of source pixels
+   */
+  virtual void draw_rgb565_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, size_t stride,
+                              bool big_endian);
+
+  /** Fill a rectangle with one color. Lines, boxes, circles and the other filled shapes end up here one span at a
+   * time, so drivers with a frame buffer override this to clip once and fill whole rows in their native color format.
+   * The naive implementation here draws every pixel.
+   */
+  virtual void fill_rect(int x_start, int y_start, int w, int h, Color color);
+
   /// Draw a straight line from the point [x1,y1] to [x2,y2] with the given color.
   void line(int x1, int y1, int x2, int y2, Color color = COLOR_ON);
 
@@ -656,7 +682,36 @@ class Display : public PollingComponent {
   void test_card();
   void show_test_card() { this->show_test_card_ = true; }
 
+#ifdef USE_DISPLAY_STATS
+  /// Returns the statistics since the previous call and starts over
+  DisplayRenderStats take_render_stats() {
+    const DisplayRenderStats stats = this->render_stats_;
+    this->render_stats_ = DisplayRenderStats{};
+    return stats;
+  }
+#endif
+
  protected:
+  inline void count_pixels_(uint32_t pixels) ESPHOME_ALWAYS_INLINE {
+#ifdef USE_DISPLAY_STATS
+    this->render_stats_.pixels += pixels;
+#endif
+  }
+  /// Drivers that send to the panel record each transfer, with the time the main loop waited for it
+  void record_transfer_(uint32_t transfer_us, uint32_t bytes) {
+#ifdef USE_DISPLAY_STATS
+    this->render_stats_.transfer_us += transfer_us;
+    this->render_stats_.bytes += bytes;
+#endif
+  }
+  /// Records an update that drew for draw_us. Called by do_update_(), and by drivers that run the writer themselves.
+  void record_update_(uint32_t draw_us) {
+#ifdef USE_DISPLAY_STATS
+    this->render_stats_.updates++;
+    this->render_stats_.draw_us += draw_us;
+#endif
+  }
+
   bool clamp_x_(int x, int w, int &min_x, int &max_x);
   bool clamp_y_(int y, int h, int &min_y, int &max_y);
   void vprintf_(int x, int y, BaseFont *font, Color color, Color background, TextAlign align, const char *format,
@@ -685,6 +740,9 @@ class Display : public PollingComponent {
   bool auto_clear_enabled_{true};
   std::vector<Rect> clipping_rectangle_;
   bool show_test_card_{false};
+#ifdef USE_DISPLAY_STATS
+  DisplayRenderStats render_stats_{};
+#endif
 };
 
 class DisplayPage {
@@ -3,6 +3,8 @@
 #include <utility>
 
 #include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -11,7 +13,7 @@ namespace display {
 static const char *const TAG = "display";
 
 void DisplayBuffer::init_internal_(uint32_t buffer_length) {
-  RAMAllocator<uint8_t> allocator;
+  RAMAllocator<uint8_t> allocator(RAMAllocator<uint8_t>::NONE, "display buffer");
   this->buffer_ = allocator.allocate(buffer_length);
   if (this->buffer_ == nullptr) {
     ESP_LOGE(TAG, "Could not allocate buffer for display!");
@@ -65,8 +67,69 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
       break;
   }
   this->draw_absolute_pixel_internal(x, y, color);
+  this->count_pixels_(1);
   App.feed_wdt();
 }
 
+void HOT DisplayBuffer::fill_rect(int x_start, int y_start, int w, int h, Color color) {
+  int min_x, max_x, min_y, max_y;
+  if (!this->clamp_x_(x_start, w, min_x, max_x) || !this->clamp_y_(y_start, h, min_y, max_y))
+    return;
+
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      this->fill_absolute_rect_internal(min_x, min_y, max_x - min_x, max_y - min_y, color);
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      this->fill_absolute_rect_internal(this->get_width_internal() - max_y, min_x, max_y - min_y, max_x - min_x, color);
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      this->fill_absolute_rect_internal(this->get_width_internal() - max_x, this->get_height_internal() - max_y,
+                                        max_x - min_x, max_y - min_y, color);
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      this->fill_absolute_rect_internal(min_y, this->get_height_internal() - max_x, max_y - min_y, max_x - min_x,
+                                        color);
+      break;
+  }
+  this->count_pixels_((max_x - min_x) * (max_y - min_y));
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::fill_absolute_rect_internal(int x_start, int y_start, int w, int h, Color color) {
+  for (int y = y_start; y < y_start + h; y++) {
+    for (int x = x_start; x < x_start + w; x++)
+      this->draw_absolute_pixel_internal(x, y, color);
+  }
+}
+
+void HOT DisplayBuffer::draw_rgb565_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, size_t stride,
+                                       bool big_endian) {
+  if (this->rotation_ != DISPLAY_ROTATION_0_DEGREES) {
+    Display::draw_rgb565_at(x_start, y_start, w, h, ptr, stride, big_endian);
+    return;
+  }
+  int min_x, max_x, min_y, max_y;
+  if (!this->clamp_x_(x_start, w, min_x, max_x) || !this->clamp_y_(y_start, h, min_y, max_y))
+    return;
+  ptr += (min_y - y_start) * stride + (min_x - x_start) * 2;
+  this->draw_absolute_rgb565_internal(min_x, min_y, max_x - min_x, max_y - min_y, ptr, stride, big_endian);
+  this->count_pixels_((max_x - min_x) * (max_y - min_y));
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::draw_absolute_rgb565_internal(int x_start, int y_start, int w, int h, const uint8_t *ptr,
+                                                      size_t stride, bool big_endian) {
+  for (int y = 0; y != h; y++, ptr += stride) {
+    const uint8_t *pos = ptr;
+    for (int x = 0; x != w; x++, pos += 2) {
+      const uint8_t first = progmem_read_byte(pos);
+      const uint8_t second = progmem_read_byte(pos + 1);
+      const uint16_t rgb565 = big_endian ? encode_uint16(first, second) : encode_uint16(second, first);
+      this->draw_absolute_pixel_internal(x_start + x, y_start + y, ColorUtil::rgb565_to_color(rgb565));
+    }
+  }
+}
+
 }  // namespace display
 }  // namespace esphome
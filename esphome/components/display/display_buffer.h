@@ -22,9 +22,24 @@ class DisplayBuffer : public Display {
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
 
+  /// Clip the rectangle once and fill it in native coordinates.
+  void fill_rect(int x_start, int y_start, int w, int h, Color color) override;
+
+  /// Clip the block once and copy it in native coordinates when the display is not rotated.
+  void draw_rgb565_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, size_t stride,
+                      bool big_endian) override;
+
  protected:
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
 
+  /// Fill a rectangle that is already clipped to the display and rotated to native coordinates. Drivers override
+  /// this to fill their buffer row by row with the color converted once.
+  virtual void fill_absolute_rect_internal(int x_start, int y_start, int w, int h, Color color);
+
+  /// Draw a block of RGB565 pixels that is already clipped to the display, at native coordinates.
+  virtual void draw_absolute_rgb565_internal(int x_start, int y_start, int w, int h, const uint8_t *ptr, size_t stride,
+                                             bool big_endian);
+
   void init_internal_(uint32_t buffer_length);
 
   uint8_t *buffer_{nullptr};
@@ -66,6 +66,13 @@ class ColorUtil {
     }
     return color_return;
   }
+  /// Convert an RGB565 value to an opaque color, as the image component does
+  static inline Color rgb565_to_color(uint16_t rgb565) {
+    const uint8_t r = (rgb565 & 0xF800) >> 11;
+    const uint8_t g = (rgb565 & 0x07E0) >> 5;
+    const uint8_t b = rgb565 & 0x001F;
+    return Color((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), 0xFF);
+  }
   static inline Color rgb332_to_color(uint8_t rgb332_color) {
     return to_color((uint32_t) rgb332_color, COLOR_ORDER_RGB, COLOR_BITNESS_332);
   }
@@ -0,0 +1,32 @@
+import esphome.codegen as cg
+from esphome.components import display
+import esphome.config_validation as cv
+from esphome.const import CONF_DISPLAY_ID, CONF_ID
+
+DEPENDENCIES = ["display"]
+MULTI_CONF = True
+
+CONF_DISPLAY_STATS_ID = "display_stats_id"
+CONF_LOG_SUMMARY = "log_summary"
+
+display_stats_ns = cg.esphome_ns.namespace("display_stats")
+DisplayStatsComponent = display_stats_ns.class_(
+    "DisplayStatsComponent", cg.PollingComponent
+)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(DisplayStatsComponent),
+        cv.Required(CONF_DISPLAY_ID): cv.use_id(display.Display),
+        cv.Optional(CONF_LOG_SUMMARY, default=True): cv.boolean,
+    }
+).extend(cv.polling_component_schema("60s"))
+
+
+async def to_code(config):
+    disp = await cg.get_variable(config[CONF_DISPLAY_ID])
+    var = cg.new_Pvariable(config[CONF_ID], disp)
+    await cg.register_component(var, config)
+
+    cg.add_define("USE_DISPLAY_STATS")
+    cg.add(var.set_log_summary(config[CONF_LOG_SUMMARY]))
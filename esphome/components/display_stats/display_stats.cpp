@@ -0,0 +1,62 @@
+#include "display_stats.h"
+
+#ifdef USE_DISPLAY_STATS
+
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+
+namespace esphome {
+namespace display_stats {
+
+static const char *const TAG = "display_stats";
+
+void DisplayStatsComponent::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Display Stats:\n"
+                "  Log Summary: %s",
+                YESNO(this->log_summary_));
+  LOG_UPDATE_INTERVAL(this);
+}
+
+void DisplayStatsComponent::update() {
+  const display::DisplayRenderStats stats = this->display_->take_render_stats();
+  if (stats.updates == 0) {
+    if (this->log_summary_) {
+      ESP_LOGD(TAG, "No display updates in the last %" PRIu32 " ms", this->get_update_interval());
+    }
+    return;
+  }
+
+  const float draw_ms = stats.draw_us / (stats.updates * 1000.0f);
+  const float transfer_ms = stats.transfer_us / (stats.updates * 1000.0f);
+  const uint32_t pixels = stats.pixels / stats.updates;
+  const uint32_t bytes = stats.bytes / stats.updates;
+
+  if (this->log_summary_) {
+    ESP_LOGD(TAG,
+             "%" PRIu32 " updates in the last %" PRIu32 " ms, each: draw %.1f ms, transfer %.1f ms, %" PRIu32
+             " pixels drawn, %" PRIu32 " bytes sent",
+             stats.updates, this->get_update_interval(), draw_ms, transfer_ms, pixels, bytes);
+  }
+
+#ifdef USE_SENSOR
+  if (this->draw_time_sensor_ != nullptr) {
+    this->draw_time_sensor_->publish_state(draw_ms);
+  }
+  if (this->transfer_time_sensor_ != nullptr) {
+    this->transfer_time_sensor_->publish_state(transfer_ms);
+  }
+  if (this->pixels_drawn_sensor_ != nullptr) {
+    this->pixels_drawn_sensor_->publish_state(pixels);
+  }
+  if (this->bytes_sent_sensor_ != nullptr) {
+    this->bytes_sent_sensor_->publish_state(bytes);
+  }
+#endif
+}
+
+}  // namespace display_stats
+}  // namespace esphome
+
+#endif
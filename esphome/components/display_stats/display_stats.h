@@ -0,0 +1,54 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_DISPLAY_STATS
+
+#include "esphome/components/display/display.h"
+#include "esphome/core/component.h"
+
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
+namespace esphome {
+namespace display_stats {
+
+class DisplayStatsComponent : public PollingComponent {
+  /*
+   * @brief Takes a snapshot of a display's rendering statistics each update interval. Logs a summary and publishes
+   * averages per display update, so a slow screen can be traced to drawing or to sending data to the panel. Transfer
+   * statistics are only available for drivers that record them.
+   */
+ public:
+  explicit DisplayStatsComponent(display::Display *display) : display_(display) {}
+
+  void dump_config() override;
+  void update() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void set_log_summary(bool log_summary) { this->log_summary_ = log_summary; }
+
+#ifdef USE_SENSOR
+  void set_draw_time_sensor(sensor::Sensor *sensor) { this->draw_time_sensor_ = sensor; }
+  void set_transfer_time_sensor(sensor::Sensor *sensor) { this->transfer_time_sensor_ = sensor; }
+  void set_pixels_drawn_sensor(sensor::Sensor *sensor) { this->pixels_drawn_sensor_ = sensor; }
+  void set_bytes_sent_sensor(sensor::Sensor *sensor) { this->bytes_sent_sensor_ = sensor; }
+#endif
+
+ protected:
+  display::Display *display_;
+  bool log_summary_{true};
+
+#ifdef USE_SENSOR
+  sensor::Sensor *draw_time_sensor_{nullptr};
+  sensor::Sensor *transfer_time_sensor_{nullptr};
+  sensor::Sensor *pixels_drawn_sensor_{nullptr};
+  sensor::Sensor *bytes_sent_sensor_{nullptr};
+#endif
+};
+
+}  // namespace display_stats
+}  // namespace esphome
+
+#endif
@@ -0,0 +1,62 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_TIMER,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_BYTES,
+    UNIT_MILLISECOND,
+)
+
+from . import CONF_DISPLAY_STATS_ID, DisplayStatsComponent
+
+DEPENDENCIES = ["display_stats"]
+
+CONF_BYTES_SENT = "bytes_sent"
+CONF_DRAW_TIME = "draw_time"
+CONF_PIXELS_DRAWN = "pixels_drawn"
+CONF_TRANSFER_TIME = "transfer_time"
+
+_TIME_SCHEMA = sensor.sensor_schema(
+    unit_of_measurement=UNIT_MILLISECOND,
+    icon=ICON_TIMER,
+    accuracy_decimals=1,
+    state_class=STATE_CLASS_MEASUREMENT,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_DISPLAY_STATS_ID): cv.use_id(DisplayStatsComponent),
+        cv.Optional(CONF_DRAW_TIME): _TIME_SCHEMA,
+        cv.Optional(CONF_TRANSFER_TIME): _TIME_SCHEMA,
+        cv.Optional(CONF_PIXELS_DRAWN): sensor.sensor_schema(
+            icon="mdi:grid",
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_BYTES_SENT): sensor.sensor_schema(
+            unit_of_measurement=UNIT_BYTES,
+            icon="mdi:swap-horizontal",
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+)
+
+
+async def to_code(config):
+    parent = await cg.get_variable(config[CONF_DISPLAY_STATS_ID])
+
+    for key in (
+        CONF_DRAW_TIME,
+        CONF_TRANSFER_TIME,
+        CONF_PIXELS_DRAWN,
+        CONF_BYTES_SENT,
+    ):
+        if sensor_config := config.get(key):
+            sens = await sensor.new_sensor(sensor_config)
+            cg.add(getattr(parent, f"set_{key}_sensor")(sens))
@@ -1,8 +1,11 @@
 #ifdef USE_ARDUINO
 
 #include "dsmr.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 #include <AES.h>
 #include <Crypto.h>
 #include <GCM.h>
@@ -12,11 +15,52 @@ namespace dsmr {
 
 static const char *const TAG = "dsmr";
 
+/// Parses an OBIS reference like 1-0:1.8.1 into its groups, the missing ones are 255 like in the dsmr library
+static bool parse_obis(const char *str, size_t len, std::array<uint8_t, 6> &id) {
+  id.fill(255);
+  size_t group = 0;
+  uint16_t value = 0;
+  bool has_digit = false;
+  for (size_t i = 0; i < len; i++) {
+    const char c = str[i];
+    if (c >= '0' && c <= '9') {
+      value = value * 10 + (c - '0');
+      if (value > 255)
+        return false;
+      has_digit = true;
+    } else if ((c == '-' || c == ':' || c == '.' || c == '*') && has_digit && group < 5) {
+      id[group++] = value;
+      value = 0;
+      has_digit = false;
+    } else {
+      return false;
+    }
+  }
+  if (!has_digit)
+    return false;
+  id[group] = value;
+  return true;
+}
+
 void Dsmr::setup() {
   this->telegram_ = new char[this->max_telegram_len_];  // NOLINT
   if (this->request_pin_ != nullptr) {
     this->request_pin_->setup();
   }
+
+  // The telegram text sensor publishes the telegram as received, so nothing can be dropped for it. Encrypted
+  // telegrams are decrypted as a whole.
+  if (this->s_telegram_ == nullptr && this->decryption_key_.empty()) {
+#define DSMR_ADD_WANTED_OBIS(s) this->add_wanted_obis_(::dsmr::fields::s::id);
+    DSMR_SENSOR_LIST(DSMR_ADD_WANTED_OBIS, )
+    DSMR_TEXT_SENSOR_LIST(DSMR_ADD_WANTED_OBIS, )
+  }
+}
+
+void Dsmr::add_wanted_obis_(const ::dsmr::ObisId &id) {
+  std::array<uint8_t, 6> obis;
+  std::copy(id.v, id.v + obis.size(), obis.begin());
+  this->wanted_obis_.push_back(obis);
 }
 
 void Dsmr::loop() {
@@ -42,9 +86,7 @@ bool Dsmr::ready_to_request_data_() {
       this->start_requesting_data_();
     }
     if (!this->requesting_data_) {
-      while (this->available()) {
-        this->read();
-      }
+      this->discard_rx_();
     }
   }
   return this->requesting_data_;
@@ -117,13 +159,17 @@ void Dsmr::stop_requesting_data_() {
     } else {
       ESP_LOGV(TAG, "Stop reading data from P1 port");
     }
-    while (this->available()) {
-      this->read();
-    }
+    this->discard_rx_();
     this->requesting_data_ = false;
   }
 }
 
+void Dsmr::discard_rx_() {
+  uint8_t discard[RX_CHUNK_SIZE];
+  while (this->read_available(discard, sizeof(discard)) > 0) {
+  }
+}
+
 void Dsmr::reset_telegram_() {
   this->header_found_ = false;
   this->footer_found_ = false;
@@ -131,124 +177,201 @@ void Dsmr::reset_telegram_() {
   this->crypt_bytes_read_ = 0;
   this->crypt_telegram_len_ = 0;
   this->last_read_time_ = 0;
+  this->crc_ = 0;
+  this->crc_verified_ = false;
+  this->line_start_ = 0;
+  // The identification line is always kept
+  this->obis_checked_ = true;
+  this->dropping_line_ = false;
+  this->last_line_dropped_ = false;
+}
+
+bool Dsmr::filter_line_() {
+  this->obis_checked_ = true;
+  if (this->bytes_read_ == this->line_start_) {
+    // A value on a new line belongs to the line before
+    return !this->last_line_dropped_;
+  }
+  std::array<uint8_t, 6> obis;
+  if (!parse_obis(this->telegram_ + this->line_start_, this->bytes_read_ - this->line_start_, obis))
+    return true;  // Leave lines we don't understand to the parser
+  return std::find(this->wanted_obis_.begin(), this->wanted_obis_.end(), obis) != this->wanted_obis_.end();
+}
+
+bool Dsmr::check_crc_() {
+  // The checksum is 4 hex digits right after the '!'
+  uint8_t expected[2];
+  if (this->bytes_read_ < this->footer_pos_ + 5 ||
+      parse_hex(this->telegram_ + this->footer_pos_ + 1, 4, expected, sizeof(expected)) != 4) {
+    ESP_LOGE(TAG, "No checksum found");
+    return false;
+  }
+  const uint16_t expected_crc = (expected[0] << 8) | expected[1];
+  if (expected_crc != this->crc_) {
+    ESP_LOGE(TAG, "Checksum mismatch: telegram %04X, calculated %04X", expected_crc, this->crc_);
+    return false;
+  }
+  return true;
 }
 
 void Dsmr::receive_telegram_() {
+  uint8_t buf[RX_CHUNK_SIZE];
   while (this->available_within_timeout_()) {
-    const char c = this->read();
+    const size_t len = this->read_available(buf, sizeof(buf));
+    for (size_t i = 0; i < len; i++) {
+      const char c = buf[i];
+
+      // Find a new telegram header, i.e. forward slash.
+      if (c == '/') {
+        ESP_LOGV(TAG, "Header of telegram found");
+        this->reset_telegram_();
+        this->header_found_ = true;
+      }
+      if (!this->header_found_)
+        continue;
 
-    // Find a new telegram header, i.e. forward slash.
-    if (c == '/') {
-      ESP_LOGV(TAG, "Header of telegram found");
-      this->reset_telegram_();
-      this->header_found_ = true;
-    }
-    if (!this->header_found_)
-      continue;
+      // Check for buffer overflow.
+      if (this->bytes_read_ >= this->max_telegram_len_) {
+        this->reset_telegram_();
+        ESP_LOGE(TAG, "Error: telegram larger than buffer (%d bytes)", this->max_telegram_len_);
+        return;
+      }
 
-    // Check for buffer overflow.
-    if (this->bytes_read_ >= this->max_telegram_len_) {
-      this->reset_telegram_();
-      ESP_LOGE(TAG, "Error: telegram larger than buffer (%d bytes)", this->max_telegram_len_);
-      return;
-    }
+      if (this->crc_check_ && !this->footer_found_) {
+        const uint8_t byte = c;
+        this->crc_ = crc16(&byte, 1, this->crc_, 0xa001);
+      }
 
-    // Some v2.2 or v3 meters will send a new value which starts with '('
-    // in a new line, while the value belongs to the previous ObisId. For
-    // proper parsing, remove these new line characters.
-    if (c == '(') {
-      while (true) {
-        auto previous_char = this->telegram_[this->bytes_read_ - 1];
-        if (previous_char == '\n' || previous_char == '\r') {
-          this->bytes_read_--;
-        } else {
-          break;
+      if (this->dropping_line_) {
+        if (c == '\n') {
+          this->dropping_line_ = false;
+          this->obis_checked_ = false;
+        }
+        continue;
+      }
+      if (c == '(' && !this->obis_checked_ && !this->wanted_obis_.empty() && !this->footer_found_) {
+        this->last_line_dropped_ = !this->filter_line_();
+        if (this->last_line_dropped_) {
+          this->bytes_read_ = this->line_start_;
+          this->dropping_line_ = true;
+          continue;
         }
       }
-    }
 
-    // Store the byte in the buffer.
-    this->telegram_[this->bytes_read_] = c;
-    this->bytes_read_++;
+      // Some v2.2 or v3 meters will send a new value which starts with '('
+      // in a new line, while the value belongs to the previous ObisId. For
+      // proper parsing, remove these new line characters.
+      if (c == '(') {
+        while (true) {
+          auto previous_char = this->telegram_[this->bytes_read_ - 1];
+          if (previous_char == '\n' || previous_char == '\r') {
+            this->bytes_read_--;
+          } else {
+            break;
+          }
+        }
+      }
 
-    // Check for a footer, i.e. exclamation mark, followed by a hex checksum.
-    if (c == '!') {
-      ESP_LOGV(TAG, "Footer of telegram found");
-      this->footer_found_ = true;
-      continue;
-    }
-    // Check for the end of the hex checksum, i.e. a newline.
-    if (this->footer_found_ && c == '\n') {
-      // Parse the telegram and publish sensor values.
-      this->parse_telegram();
-      this->reset_telegram_();
-      return;
+      // Store the byte in the buffer.
+      this->telegram_[this->bytes_read_] = c;
+      this->bytes_read_++;
+
+      // Check for a footer, i.e. exclamation mark, followed by a hex checksum.
+      if (c == '!') {
+        ESP_LOGV(TAG, "Footer of telegram found");
+        this->footer_found_ = true;
+        this->footer_pos_ = this->bytes_read_ - 1;
+        continue;
+      }
+      if (c == '\n') {
+        this->line_start_ = this->bytes_read_;
+        this->obis_checked_ = false;
+      }
+      // Check for the end of the hex checksum, i.e. a newline.
+      if (this->footer_found_ && c == '\n') {
+        if (this->crc_check_) {
+          if (!this->check_crc_()) {
+            this->stop_requesting_data_();
+            this->reset_telegram_();
+            return;
+          }
+          this->crc_verified_ = true;
+        }
+        // Parse the telegram and publish sensor values.
+        this->parse_telegram();
+        this->reset_telegram_();
+        return;
+      }
     }
   }
 }
 
 void Dsmr::receive_encrypted_telegram_() {
+  uint8_t buf[RX_CHUNK_SIZE];
   while (this->available_within_timeout_()) {
-    const char c = this->read();
-
-    // Find a new telegram start byte.
-    if (!this->header_found_) {
-      if ((uint8_t) c != 0xDB) {
-        continue;
+    const size_t len = this->read_available(buf, sizeof(buf));
+    for (size_t i = 0; i < len; i++) {
+      const char c = buf[i];
+
+      // Find a new telegram start byte.
+      if (!this->header_found_) {
+        if ((uint8_t) c != 0xDB) {
+          continue;
+        }
+        ESP_LOGV(TAG, "Start byte 0xDB of encrypted telegram found");
+        this->reset_telegram_();
+        this->header_found_ = true;
       }
-      ESP_LOGV(TAG, "Start byte 0xDB of encrypted telegram found");
-      this->reset_telegram_();
-      this->header_found_ = true;
-    }
 
-    // Check for buffer overflow.
-    if (this->crypt_bytes_read_ >= this->max_telegram_len_) {
-      this->reset_telegram_();
-      ESP_LOGE(TAG, "Error: encrypted telegram larger than buffer (%d bytes)", this->max_telegram_len_);
-      return;
-    }
+      // Check for buffer overflow.
+      if (this->crypt_bytes_read_ >= this->max_telegram_len_) {
+        this->reset_telegram_();
+        ESP_LOGE(TAG, "Error: encrypted telegram larger than buffer (%d bytes)", this->max_telegram_len_);
+        return;
+      }
 
-    // Store the byte in the buffer.
-    this->crypt_telegram_[this->crypt_bytes_read_] = c;
-    this->crypt_bytes_read_++;
+      // Store the byte in the buffer.
+      this->crypt_telegram_[this->crypt_bytes_read_] = c;
+      this->crypt_bytes_read_++;
 
-    // Read the length of the incoming encrypted telegram.
-    if (this->crypt_telegram_len_ == 0 && this->crypt_bytes_read_ > 20) {
-      // Complete header + data bytes
-      this->crypt_telegram_len_ = 13 + (this->crypt_telegram_[11] << 8 | this->crypt_telegram_[12]);
-      ESP_LOGV(TAG, "Encrypted telegram length: %d bytes", this->crypt_telegram_len_);
-    }
+      // Read the length of the incoming encrypted telegram.
+      if (this->crypt_telegram_len_ == 0 && this->crypt_bytes_read_ > 20) {
+        // Complete header + data bytes
+        this->crypt_telegram_len_ = 13 + (this->crypt_telegram_[11] << 8 | this->crypt_telegram_[12]);
+        ESP_LOGV(TAG, "Encrypted telegram length: %d bytes", this->crypt_telegram_len_);
+      }
 
-    // Check for the end of the encrypted telegram.
-    if (this->crypt_telegram_len_ == 0 || this->crypt_bytes_read_ != this->crypt_telegram_len_) {
-      continue;
+      // Check for the end of the encrypted telegram.
+      if (this->crypt_telegram_len_ == 0 || this->crypt_bytes_read_ != this->crypt_telegram_len_) {
+        continue;
+      }
+      ESP_LOGV(TAG, "End of encrypted telegram found");
+
+      // Decrypt the encrypted telegram.
+      GCM<AES128> *gcmaes128{new GCM<AES128>()};
+      gcmaes128->setKey(this->decryption_key_.data(), gcmaes128->keySize());
+      // the iv is 8 bytes of the system title + 4 bytes frame counter
+      // system title is at byte 2 and frame counter at byte 15
+      for (int i = 10; i < 14; i++)
+        this->crypt_telegram_[i] = this->crypt_telegram_[i + 4];
+      constexpr uint16_t iv_size{12};
+      gcmaes128->setIV(&this->crypt_telegram_[2], iv_size);
+      gcmaes128->decrypt(reinterpret_cast<uint8_t *>(this->telegram_),
+                         // the ciphertext start at byte 18
+                         &this->crypt_telegram_[18],
+                         // cipher size
+                         this->crypt_bytes_read_ - 17);
+      delete gcmaes128;  // NOLINT(cppcoreguidelines-owning-memory)
+
+      this->bytes_read_ = strnlen(this->telegram_, this->max_telegram_len_);
+      ESP_LOGV(TAG, "Decrypted telegram size: %d bytes", this->bytes_read_);
+      ESP_LOGVV(TAG, "Decrypted telegram: %s", this->telegram_);
+
+      // Parse the decrypted telegram and publish sensor values.
+      this->parse_telegram();
+      this->reset_telegram_();
+      return;
     }
-    ESP_LOGV(TAG, "End of encrypted telegram found");
-
-    // Decrypt the encrypted telegram.
-    GCM<AES128> *gcmaes128{new GCM<AES128>()};
-    gcmaes128->setKey(this->decryption_key_.data(), gcmaes128->keySize());
-    // the iv is 8 bytes of the system title + 4 bytes frame counter
-    // system title is at byte 2 and frame counter at byte 15
-    for (int i = 10; i < 14; i++)
-      this->crypt_telegram_[i] = this->crypt_telegram_[i + 4];
-    constexpr uint16_t iv_size{12};
-    gcmaes128->setIV(&this->crypt_telegram_[2], iv_size);
-    gcmaes128->decrypt(reinterpret_cast<uint8_t *>(this->telegram_),
-                       // the ciphertext start at byte 18
-                       &this->crypt_telegram_[18],
-                       // cipher size
-                       this->crypt_bytes_read_ - 17);
-    delete gcmaes128;  // NOLINT(cppcoreguidelines-owning-memory)
-
-    this->bytes_read_ = strnlen(this->telegram_, this->max_telegram_len_);
-    ESP_LOGV(TAG, "Decrypted telegram size: %d bytes", this->bytes_read_);
-    ESP_LOGVV(TAG, "Decrypted telegram: %s", this->telegram_);
-
-    // Parse the decrypted telegram and publish sensor values.
-    this->parse_telegram();
-    this->reset_telegram_();
-    return;
   }
 }
 
@@ -257,9 +380,10 @@ bool Dsmr::parse_telegram() {
   ESP_LOGV(TAG, "Trying to parse telegram");
   this->stop_requesting_data_();
 
-  ::dsmr::ParseResult<void> res =
-      ::dsmr::P1Parser::parse(&data, this->telegram_, this->bytes_read_, false,
-                              this->crc_check_);  // Parse telegram according to data definition. Ignore unknown values.
+  // Parse telegram according to data definition. Ignore unknown values. The CRC of received telegrams was
+  // checked while reading them, the lines that were dropped are part of it.
+  ::dsmr::ParseResult<void> res = ::dsmr::P1Parser::parse(&data, this->telegram_, this->bytes_read_, false,
+                                                          this->crc_check_ && !this->crc_verified_);
   if (res.err) {
     // Parsing error, show it
     auto err_str = res.fullError(this->telegram_, this->telegram_ + this->bytes_read_);
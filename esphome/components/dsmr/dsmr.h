@@ -13,6 +13,7 @@
 #include <dsmr/parser.h>
 #include <dsmr/fields.h>
 
+#include <array>
 #include <vector>
 
 namespace esphome {
@@ -20,6 +21,9 @@ namespace dsmr {
 
 using namespace ::dsmr::fields;
 
+/// Bytes read from the UART at once, the telegram is parsed from these chunks
+static const size_t RX_CHUNK_SIZE = 64;
+
 // DSMR_**_LIST generated by ESPHome and written in esphome/core/defines
 
 #if !defined(DSMR_SENSOR_LIST) && !defined(DSMR_TEXT_SENSOR_LIST)
@@ -92,6 +96,11 @@ class Dsmr : public Component, public uart::UARTDevice {
   void receive_telegram_();
   void receive_encrypted_telegram_();
   void reset_telegram_();
+  /// Compares the checksum after the footer with the one calculated while reading
+  bool check_crc_();
+  /// Decides at the first '(' of a line if the line is kept, returns false if it is dropped
+  bool filter_line_();
+  void add_wanted_obis_(const ::dsmr::ObisId &id);
 
   /// Wait for UART data to become available within the read timeout.
   ///
@@ -113,6 +122,8 @@ class Dsmr : public Component, public uart::UARTDevice {
   bool ready_to_request_data_();
   void start_requesting_data_();
   void stop_requesting_data_();
+  /// Drops the bytes that were received already
+  void discard_rx_();
 
   // Read telegram
   uint32_t receive_timeout_;
@@ -127,6 +138,19 @@ class Dsmr : public Component, public uart::UARTDevice {
   bool header_found_{false};
   bool footer_found_{false};
 
+  // CRC of the telegram from the '/' up to the '!', updated as the bytes come in
+  uint16_t crc_{0};
+  size_t footer_pos_{0};
+  bool crc_verified_{false};
+
+  // OBIS codes of the configured sensors. Lines with other codes are dropped while they are read, so they are
+  // neither stored nor parsed. Empty when the whole telegram is needed for the telegram text sensor.
+  std::vector<std::array<uint8_t, 6>> wanted_obis_;
+  size_t line_start_{0};
+  bool obis_checked_{true};
+  bool dropping_line_{false};
+  bool last_line_dropped_{false};
+
   // handled outside dsmr
   text_sensor::TextSensor *s_telegram_{nullptr};
 
@@ -1,6 +1,7 @@
 #include "e131.h"
 #ifdef USE_NETWORK
 #include "e131_addressable_light_effect.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -8,6 +9,10 @@ namespace e131 {
 
 static const char *const TAG = "e131";
 static const int PORT = 5568;
+static const size_t MAX_PACKETS_PER_LOOP = 32;
+static const size_t MAX_PACKET_SIZE = 1460;
+// universes read from the socket in one call
+static const size_t RECEIVE_BATCH_SIZE = 4;
 
 E131Component::E131Component() {}
 
@@ -49,29 +54,46 @@ void E131Component::setup() {
     return;
   }
 
+  this->receive_pool_ = make_unique<socket::DatagramPool>(MAX_PACKET_SIZE, RECEIVE_BATCH_SIZE);
   join_igmp_groups_();
 }
 
 void E131Component::loop() {
-  std::vector<uint8_t> payload;
-  E131Packet packet;
-  int universe = 0;
-  uint8_t buf[1460];
-
-  ssize_t len = this->socket_->read(buf, sizeof(buf));
-  if (len == -1) {
-    return;
-  }
-  payload.resize(len);
-  memmove(&payload[0], buf, len);
-
-  if (!this->packet_(payload, universe, packet)) {
-    ESP_LOGV(TAG, "Invalid packet received of size %zu.", payload.size());
-    return;
+  auto &pool = *this->receive_pool_;
+  auto dropped = pool.get_dropped();
+
+  // A frame usually spans several universes that arrive back to back, so read all of them instead of one per loop
+  // iteration. The limit keeps a flood of packets from stalling the other components.
+  for (size_t read = 0; read < MAX_PACKETS_PER_LOOP;) {
+    auto count = this->socket_->read_batch(pool);
+    for (size_t i = 0; i != count; i++) {
+      const uint8_t *buf = pool.data(i);
+      size_t len = pool.size(i);
+
+      E131Packet packet;
+      int universe = 0;
+      if (this->packet_(buf, len, universe, packet)) {
+        if (!this->process_(universe, packet)) {
+          ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+        }
+        continue;
+      }
+
+      int sync_universe = 0;
+      if (this->sync_packet_(buf, len, sync_universe)) {
+        this->process_sync_(sync_universe);
+        continue;
+      }
+
+      ESP_LOGV(TAG, "Invalid packet received of size %zu.", len);
+    }
+    if (count != pool.get_count())
+      break;
+    read += count;
   }
 
-  if (!this->process_(universe, packet)) {
-    ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+  if (pool.get_dropped() != dropped) {
+    ESP_LOGW(TAG, "Dropped %" PRIu32 " packets longer than %zu bytes", pool.get_dropped() - dropped, MAX_PACKET_SIZE);
   }
 }
 
@@ -110,6 +132,11 @@ bool E131Component::process_(int universe, const E131Packet &packet) {
 
   ESP_LOGV(TAG, "Received E1.31 packet for %d universe, with %d bytes", universe, packet.count);
 
+  if ((packet.sync_universe != 0) && this->sync_universes_.insert(packet.sync_universe).second) {
+    // Sync packets are multicast to their own universe, so start listening once a source announces one
+    this->join_(packet.sync_universe);
+  }
+
   for (auto *light_effect : light_effects_) {
     handled = light_effect->process_(universe, packet) || handled;
   }
@@ -117,6 +144,14 @@ bool E131Component::process_(int universe, const E131Packet &packet) {
   return handled;
 }
 
+void E131Component::process_sync_(int sync_universe) {
+  ESP_LOGV(TAG, "Received E1.31 sync packet for %d universe", sync_universe);
+
+  for (auto *light_effect : light_effects_) {
+    light_effect->sync_(sync_universe);
+  }
+}
+
 }  // namespace e131
 }  // namespace esphome
 #endif
@@ -8,7 +8,6 @@
 #include <map>
 #include <memory>
 #include <set>
-#include <vector>
 
 namespace esphome {
 namespace e131 {
@@ -21,7 +20,8 @@ const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
 
 struct E131Packet {
   uint16_t count;
-  uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
+  const uint8_t *values;   // Points into the received datagram, only valid while it is processed
+  uint16_t sync_universe;  // Universe of the sync packet that shows the data, 0 to show it right away
 };
 
 class E131Component : public esphome::Component {
@@ -39,17 +39,20 @@ class E131Component : public esphome::Component {
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
+  bool packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet);
+  bool sync_packet_(const uint8_t *data, size_t len, int &sync_universe);
   bool process_(int universe, const E131Packet &packet);
+  void process_sync_(int sync_universe);
   bool join_igmp_groups_();
   void join_(int universe);
   void leave_(int universe);
 
   E131ListenMethod listen_method_{E131_MULTICAST};
   std::unique_ptr<socket::Socket> socket_;
+  std::unique_ptr<socket::DatagramPool> receive_pool_;
   std::set<E131AddressableLightEffect *> light_effects_;
   std::map<int, int> universe_consumers_;
-  std::map<int, E131Packet> universe_packets_;
+  std::set<int> sync_universes_;
 };
 
 }  // namespace e131
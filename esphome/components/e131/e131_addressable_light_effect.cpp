@@ -7,7 +7,9 @@ namespace esphome {
 namespace e131 {
 
 static const char *const TAG = "e131_addressable_light_effect";
-static const int MAX_DATA_SIZE = (sizeof(E131Packet::values) - 1);
+static const int MAX_DATA_SIZE = E131_MAX_PROPERTY_VALUES_COUNT - 1;
+// Show an incomplete frame after this long, for sources that lost a universe or send fewer than the light has
+static const uint32_t FRAME_TIMEOUT_MS = 100;
 
 E131AddressableLightEffect::E131AddressableLightEffect(const std::string &name) : AddressableLightEffect(name) {}
 
@@ -28,6 +30,10 @@ int E131AddressableLightEffect::get_universe_count() const {
 void E131AddressableLightEffect::start() {
   AddressableLightEffect::start();
 
+  this->received_universes_.assign(this->get_universe_count(), false);
+  this->received_count_ = 0;
+  this->sync_universe_ = 0;
+
   if (this->e131_) {
     this->e131_->add_effect(this);
   }
@@ -42,7 +48,9 @@ void E131AddressableLightEffect::stop() {
 }
 
 void E131AddressableLightEffect::apply(light::AddressableLight &it, const Color &current_color) {
-  // ignore, it is run by `E131Component::update()`
+  // the data is written by `E131Component::loop()`, only show frames that never completed here
+  if ((this->received_count_ > 0) && (millis() - this->frame_start_ > FRAME_TIMEOUT_MS))
+    this->show_frame_();
 }
 
 bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet) {
@@ -58,37 +66,61 @@ bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet
       std::min(it->size(), std::min(output_offset + get_lights_per_universe(), output_offset + packet.count - 1));
   auto *input_data = packet.values + 1;
 
+  // The same universe again means the source moved on to the next frame, so show what arrived of the previous one
+  const int index = universe - first_universe_;
+  if (this->received_universes_[index])
+    this->show_frame_();
+
   ESP_LOGV(TAG, "Applying data for '%s' on %d universe, for %" PRId32 "-%d.", get_name().c_str(), universe,
            output_offset, output_end);
 
   switch (channels_) {
     case E131_MONO:
-      for (; output_offset < output_end; output_offset++, input_data++) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[0], input_data[0], input_data[0]));
-      }
+      it->set_colors(output_offset, output_end - output_offset, [input_data](int32_t i) {
+        return Color(input_data[i], input_data[i], input_data[i], input_data[i]);
+      });
       break;
 
     case E131_RGB:
-      for (; output_offset < output_end; output_offset++, input_data += 3) {
-        auto output = (*it)[output_offset];
-        output.set(
-            Color(input_data[0], input_data[1], input_data[2], (input_data[0] + input_data[1] + input_data[2]) / 3));
-      }
+      it->set_colors(output_offset, output_end - output_offset, [input_data](int32_t i) {
+        const uint8_t *rgb = input_data + i * 3;
+        return Color(rgb[0], rgb[1], rgb[2], (rgb[0] + rgb[1] + rgb[2]) / 3);
+      });
       break;
 
     case E131_RGBW:
-      for (; output_offset < output_end; output_offset++, input_data += 4) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[1], input_data[2], input_data[3]));
-      }
+      it->set_colors(output_offset, output_end - output_offset, [input_data](int32_t i) {
+        const uint8_t *rgbw = input_data + i * 4;
+        return Color(rgbw[0], rgbw[1], rgbw[2], rgbw[3]);
+      });
       break;
   }
 
-  it->schedule_show();
+  if (this->received_count_ == 0)
+    this->frame_start_ = millis();
+  this->received_universes_[index] = true;
+  this->received_count_++;
+
+  if (packet.sync_universe != 0) {
+    this->sync_universe_ = packet.sync_universe;
+  } else if (this->received_count_ == static_cast<int>(this->received_universes_.size())) {
+    this->show_frame_();
+  }
   return true;
 }
 
+void E131AddressableLightEffect::sync_(int sync_universe) {
+  if ((this->sync_universe_ != 0) && (sync_universe == this->sync_universe_))
+    this->show_frame_();
+}
+
+void E131AddressableLightEffect::show_frame_() {
+  this->get_addressable_()->schedule_show();
+  std::fill(this->received_universes_.begin(), this->received_universes_.end(), false);
+  this->received_count_ = 0;
+  this->sync_universe_ = 0;
+}
+
 }  // namespace e131
 }  // namespace esphome
 #endif
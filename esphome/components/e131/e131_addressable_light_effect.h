@@ -3,6 +3,8 @@
 #include "esphome/core/component.h"
 #include "esphome/components/light/addressable_light_effect.h"
 #ifdef USE_NETWORK
+#include <vector>
+
 namespace esphome {
 namespace e131 {
 
@@ -12,6 +14,10 @@ struct E131Packet;
 enum E131LightChannels { E131_MONO = 1, E131_RGB = 3, E131_RGBW = 4 };
 
 class E131AddressableLightEffect : public light::AddressableLightEffect {
+  /*
+   * @brief Shows a frame once all its universes arrived, or once the source sends the sync packet it announced, so
+   * a frame spread over several universes never shows half old and half new.
+   */
  public:
   E131AddressableLightEffect(const std::string &name);
 
@@ -31,12 +37,19 @@ class E131AddressableLightEffect : public light::AddressableLightEffect {
 
  protected:
   bool process_(int universe, const E131Packet &packet);
+  void sync_(int sync_universe);
+  void show_frame_();
 
   int first_universe_{0};
   int last_universe_{0};
   E131LightChannels channels_{E131_RGB};
   E131Component *e131_{nullptr};
 
+  std::vector<bool> received_universes_;
+  int received_count_{0};
+  int sync_universe_{0};  // Sync packet the received universes wait for, 0 if none
+  uint32_t frame_start_{0};
+
   friend class E131Component;
 };
 
@@ -18,7 +18,9 @@ static const char *const TAG = "e131";
 
 static const uint8_t ACN_ID[12] = {0x41, 0x53, 0x43, 0x2d, 0x45, 0x31, 0x2e, 0x31, 0x37, 0x00, 0x00, 0x00};
 static const uint32_t VECTOR_ROOT = 4;
+static const uint32_t VECTOR_ROOT_EXTENDED = 8;
 static const uint32_t VECTOR_FRAME = 2;
+static const uint32_t VECTOR_EXTENDED_SYNCHRONIZATION = 1;
 static const uint8_t VECTOR_DMP = 2;
 
 // E1.31 Packet Structure
@@ -37,7 +39,7 @@ union E131RawPacket {
     uint32_t frame_vector;
     uint8_t source_name[64];
     uint8_t priority;
-    uint16_t reserved;
+    uint16_t sync_address;
     uint8_t sequence_number;
     uint8_t options;
     uint16_t universe;
@@ -59,6 +61,24 @@ union E131RawPacket {
 // Get the offset of `property_values[1]`
 const size_t E131_MIN_PACKET_SIZE = reinterpret_cast<size_t>(&((E131RawPacket *) nullptr)->property_values[1]);
 
+// E1.31 Synchronization Packet Structure, sent once all universes of a frame were sent
+struct E131RawSyncPacket {
+  // Root Layer
+  uint16_t preamble_size;
+  uint16_t postamble_size;
+  uint8_t acn_id[12];
+  uint16_t root_flength;
+  uint32_t root_vector;
+  uint8_t cid[16];
+
+  // Frame Layer
+  uint16_t frame_flength;
+  uint32_t frame_vector;
+  uint8_t sequence_number;
+  uint16_t sync_address;
+  uint16_t reserved;
+} __attribute__((packed));
+
 bool E131Component::join_igmp_groups_() {
   if (listen_method_ != E131_MULTICAST)
     return false;
@@ -116,11 +136,11 @@ void E131Component::leave_(int universe) {
   ESP_LOGD(TAG, "Left %d universe for E1.31.", universe);
 }
 
-bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet) {
-  if (data.size() < E131_MIN_PACKET_SIZE)
+bool E131Component::packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet) {
+  if (len < E131_MIN_PACKET_SIZE)
     return false;
 
-  auto *sbuff = reinterpret_cast<const E131RawPacket *>(&data[0]);
+  auto *sbuff = reinterpret_cast<const E131RawPacket *>(data);
 
   if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
     return false;
@@ -137,11 +157,32 @@ bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E13
   packet.count = htons(sbuff->property_value_count);
   if (packet.count > E131_MAX_PROPERTY_VALUES_COUNT)
     return false;
+  if (len < E131_MIN_PACKET_SIZE - 1 + packet.count)
+    return false;
 
-  memcpy(packet.values, sbuff->property_values, packet.count);
+  // The values are used straight from the datagram, they are only copied into the lights
+  packet.values = sbuff->property_values;
+  packet.sync_universe = htons(sbuff->sync_address);
   return true;
 }
 
+bool E131Component::sync_packet_(const uint8_t *data, size_t len, int &sync_universe) {
+  if (len < sizeof(E131RawSyncPacket))
+    return false;
+
+  auto *sbuff = reinterpret_cast<const E131RawSyncPacket *>(data);
+
+  if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
+    return false;
+  if (htonl(sbuff->root_vector) != VECTOR_ROOT_EXTENDED)
+    return false;
+  if (htonl(sbuff->frame_vector) != VECTOR_EXTENDED_SYNCHRONIZATION)
+    return false;
+
+  sync_universe = htons(sbuff->sync_address);
+  return sync_universe != 0;
+}
+
 }  // namespace e131
 }  // namespace esphome
 #endif
@@ -0,0 +1,24 @@
+import esphome.codegen as cg
+from esphome.core import CORE, ID
+
+CODEOWNERS = ["@esphome/core"]
+
+energy_accumulator_ns = cg.esphome_ns.namespace("energy_accumulator")
+EnergyStore = energy_accumulator_ns.class_("EnergyStore", cg.Component)
+
+KEY_ENERGY_STORE = "energy_accumulator_store"
+
+# How often changed accumulators are written to the preferences
+CHECKPOINT_INTERVAL_MS = 60000
+
+
+async def get_energy_store():
+    """Return the component that checkpoints all restored accumulators."""
+    if (store := CORE.data.get(KEY_ENERGY_STORE)) is None:
+        store = cg.new_Pvariable(
+            ID(KEY_ENERGY_STORE, is_declaration=True, type=EnergyStore),
+            CHECKPOINT_INTERVAL_MS,
+        )
+        CORE.data[KEY_ENERGY_STORE] = store
+        await cg.register_component(store, {})
+    return store
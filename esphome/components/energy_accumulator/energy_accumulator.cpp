@@ -0,0 +1,76 @@
+#include "energy_accumulator.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cmath>
+
+namespace esphome {
+namespace energy_accumulator {
+
+static const char *const TAG = "energy_accumulator";
+
+/// The counts get their own preference key, so they are never read as the float older versions saved under hash
+static const uint32_t COUNTS_PREFERENCE_SALT = 0x8E3A7C15UL;
+
+void EnergyAccumulator::add(double amount) {
+  const double counts = amount * COUNTS_PER_UNIT + this->remainder_;
+  const double whole = std::trunc(counts);
+  this->remainder_ = counts - whole;
+  this->counts_ += static_cast<int64_t>(whole);
+  this->dirty_ = true;
+}
+
+void EnergyAccumulator::set(double value) {
+  this->counts_ = std::llround(value * COUNTS_PER_UNIT);
+  this->remainder_ = 0.0;
+  this->dirty_ = true;
+}
+
+void EnergyAccumulator::restore(EnergyStore *store, uint32_t hash) {
+  this->pref_ = global_preferences->make_preference<int64_t>(hash ^ COUNTS_PREFERENCE_SALT);
+  int64_t counts;
+  if (this->pref_.load(&counts)) {
+    this->counts_ = counts;
+  } else {
+    float legacy_value;
+    ESPPreferenceObject legacy = global_preferences->make_preference<float>(hash);
+    if (legacy.load(&legacy_value) && std::isfinite(legacy_value)) {
+      this->set(legacy_value);
+    }
+  }
+  this->remainder_ = 0.0;
+  this->restored_ = true;
+  store->add(this);
+}
+
+bool EnergyAccumulator::save_if_dirty() {
+  if (!this->restored_ || !this->dirty_)
+    return false;
+  this->dirty_ = false;
+  return this->pref_.save(&this->counts_);
+}
+
+void EnergyStore::setup() {
+  this->set_interval("checkpoint", this->checkpoint_interval_, [this]() { this->checkpoint(); });
+}
+
+void EnergyStore::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Energy Store:\n"
+                "  Accumulators: %u\n"
+                "  Checkpoint interval: %" PRIu32 " s",
+                static_cast<unsigned>(this->accumulators_.size()), this->checkpoint_interval_ / 1000);
+}
+
+void EnergyStore::checkpoint() {
+  uint32_t saved = 0;
+  for (auto *accumulator : this->accumulators_) {
+    if (accumulator->save_if_dirty())
+      saved++;
+  }
+  if (saved > 0)
+    ESP_LOGV(TAG, "Saved %" PRIu32 " accumulators", saved);
+}
+
+}  // namespace energy_accumulator
+}  // namespace esphome
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/preferences.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace energy_accumulator {
+
+class EnergyStore;
+
+/** Sum of many small amounts, like the energy a power sensor integrates, without float drift.
+ *
+ * The total is kept as a 64 bit count of nano-units, and the part of each amount that is smaller than one count is
+ * carried over to the next one, so adding millions of tiny samples loses nothing and the total stays exact to 1e-9 of
+ * the unit for up to 9.2e9 units. add() is a few arithmetic operations, cheap enough to run for every sample of dozens
+ * of channels. Restored accumulators are written to the preferences by the EnergyStore in batches, not on every add().
+ */
+class EnergyAccumulator {
+ public:
+  /// Counts per unit of the accumulated value
+  static constexpr double COUNTS_PER_UNIT = 1e9;
+
+  void add(double amount);
+  void set(double value);
+  double get() const { return this->counts_ / COUNTS_PER_UNIT; }
+  int64_t get_counts() const { return this->counts_; }
+
+  /** Load the value saved for hash, usually the object id hash of the entity, and checkpoint it with the store.
+   *
+   * When nothing is saved yet, the float older versions saved under hash is restored, so the total survives the update.
+   */
+  void restore(EnergyStore *store, uint32_t hash);
+
+  /// Save to the preferences if changed since the last save, returns if it saved.
+  bool save_if_dirty();
+
+ protected:
+  ESPPreferenceObject pref_;
+  int64_t counts_{0};
+  /// The part of the added amounts that didn't make a whole count yet, in counts
+  double remainder_{0.0};
+  bool dirty_{false};
+  bool restored_{false};
+};
+
+/// Checkpoints all restored accumulators to the preferences every interval and at shutdown.
+class EnergyStore : public Component {
+ public:
+  explicit EnergyStore(uint32_t checkpoint_interval) : checkpoint_interval_(checkpoint_interval) {}
+
+  void setup() override;
+  void dump_config() override;
+  void on_shutdown() override { this->checkpoint(); }
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  void add(EnergyAccumulator *accumulator) { this->accumulators_.push_back(accumulator); }
+  /// Save every accumulator that changed since its last save.
+  void checkpoint();
+
+ protected:
+  std::vector<EnergyAccumulator *> accumulators_;
+  uint32_t checkpoint_interval_;
+};
+
+}  // namespace energy_accumulator
+}  // namespace esphome
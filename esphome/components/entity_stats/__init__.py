@@ -0,0 +1,25 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+
+CONF_ENTITY_STATS_ID = "entity_stats_id"
+CONF_TOP_COUNT = "top_count"
+
+entity_stats_ns = cg.esphome_ns.namespace("entity_stats")
+EntityStatsComponent = entity_stats_ns.class_(
+    "EntityStatsComponent", cg.PollingComponent, cg.Controller
+)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(EntityStatsComponent),
+        cv.Optional(CONF_TOP_COUNT, default=5): cv.int_range(min=1, max=20),
+    }
+).extend(cv.polling_component_schema("60s"))
+
+
+async def to_code(config):
+    cg.add_define("USE_ENTITY_STATS")
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.set_top_count(config[CONF_TOP_COUNT]))
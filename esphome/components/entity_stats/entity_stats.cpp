@@ -0,0 +1,188 @@
+#include "entity_stats.h"
+#ifdef USE_ENTITY_STATS
+
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+namespace esphome {
+namespace entity_stats {
+
+static const char *const TAG = "entity_stats";
+
+EntityStatsComponent *global_entity_stats = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+EntityStatsComponent::EntityStatsComponent() { global_entity_stats = this; }
+
+void EntityStatsComponent::setup() {
+  // Include internal entities, they cost CPU time the same way
+  this->setup_controller(true);
+  this->last_update_ = millis();
+}
+
+void EntityStatsComponent::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Entity Stats:\n"
+                "  Top entities: %u",
+                this->top_count_);
+  LOG_UPDATE_INTERVAL(this);
+#ifdef USE_TEXT_SENSOR
+  LOG_TEXT_SENSOR("  ", "Top Entities", this->top_entities_text_sensor_);
+#endif
+}
+
+void EntityStatsComponent::count_(EntityBase *obj) {
+  EntityStats &stats = obj->get_stats();
+  if (stats.publishes++ == 0)
+    this->tracked_.push_back({obj, {}});
+}
+
+void EntityStatsComponent::update() {
+  const uint32_t now = millis();
+  const uint32_t elapsed_ms = now - this->last_update_;
+  this->last_update_ = now;
+  if (elapsed_ms == 0)
+    return;
+
+  // Order by the states published since the last update, the noisiest first
+  std::vector<TrackedEntity *> order;
+  order.reserve(this->tracked_.size());
+  for (auto &tracked : this->tracked_)
+    order.push_back(&tracked);
+  size_t count = std::min<size_t>(this->top_count_, order.size());
+  std::partial_sort(order.begin(), order.begin() + count, order.end(), [](TrackedEntity *a, TrackedEntity *b) {
+    return a->entity->get_stats().publishes - a->last.publishes > b->entity->get_stats().publishes - b->last.publishes;
+  });
+
+  ESP_LOGD(TAG, "Top entities over the last %" PRIu32 " ms:", elapsed_ms);
+  std::string summary;
+  for (size_t i = 0; i < count; i++) {
+    const TrackedEntity &tracked = *order[i];
+    const EntityStats &stats = tracked.entity->get_stats();
+    uint32_t publishes = stats.publishes - tracked.last.publishes;
+    if (publishes == 0)
+      break;
+    float rate = publishes * 1000.0f / elapsed_ms;
+    ESP_LOGD(TAG,
+             "  '%s': %" PRIu32 " states (%.2f/s), %" PRIu32 " suppressed, API %" PRIu32 " B, MQTT %" PRIu32 " B",
+             tracked.entity->get_name().c_str(), publishes, rate, stats.suppressed() - tracked.last.suppressed(),
+             stats.api_bytes - tracked.last.api_bytes, stats.mqtt_bytes - tracked.last.mqtt_bytes);
+    if (!summary.empty())
+      summary += ", ";
+    summary += tracked.entity->get_name().str();
+    summary += str_sprintf(" %.2f/s", rate);
+  }
+
+  for (auto &tracked : this->tracked_)
+    tracked.last = tracked.entity->get_stats();
+
+#ifdef USE_TEXT_SENSOR
+  if (this->top_entities_text_sensor_ != nullptr) {
+    if (summary.empty())
+      summary = "none";
+    // Keep it within the state length Home Assistant accepts
+    if (summary.size() > 255)
+      summary.resize(255);
+    this->top_entities_text_sensor_->publish_state(summary);
+  }
+#endif
+}
+
+#define ENTITY_STATS_COUNT(entity_type, entity_name) \
+  void EntityStatsComponent::on_##entity_name##_update(entity_type *obj) { /* NOLINT(bugprone-macro-parentheses) */ \
+    this->count_(obj); \
+  }
+
+#define ENTITY_STATS_COUNT_IGNORE_PARAMS(entity_type, entity_name, ...) \
+  void EntityStatsComponent::on_##entity_name##_update(entity_type *obj, \
+                                                       __VA_ARGS__) { /* NOLINT(bugprone-macro-parentheses) */ \
+    this->count_(obj); \
+  }
+
+#ifdef USE_BINARY_SENSOR
+ENTITY_STATS_COUNT(binary_sensor::BinarySensor, binary_sensor)
+#endif
+
+#ifdef USE_COVER
+ENTITY_STATS_COUNT(cover::Cover, cover)
+#endif
+
+#ifdef USE_FAN
+ENTITY_STATS_COUNT(fan::Fan, fan)
+#endif
+
+#ifdef USE_LIGHT
+ENTITY_STATS_COUNT(light::LightState, light)
+#endif
+
+#ifdef USE_SENSOR
+ENTITY_STATS_COUNT_IGNORE_PARAMS(sensor::Sensor, sensor, float state)
+#endif
+
+#ifdef USE_SWITCH
+ENTITY_STATS_COUNT_IGNORE_PARAMS(switch_::Switch, switch, bool state)
+#endif
+
+#ifdef USE_TEXT_SENSOR
+ENTITY_STATS_COUNT_IGNORE_PARAMS(text_sensor::TextSensor, text_sensor, const std::string &state)
+#endif
+
+#ifdef USE_CLIMATE
+ENTITY_STATS_COUNT(climate::Climate, climate)
+#endif
+
+#ifdef USE_NUMBER
+ENTITY_STATS_COUNT_IGNORE_PARAMS(number::Number, number, float state)
+#endif
+
+#ifdef USE_DATETIME_DATE
+ENTITY_STATS_COUNT(datetime::DateEntity, date)
+#endif
+
+#ifdef USE_DATETIME_TIME
+ENTITY_STATS_COUNT(datetime::TimeEntity, time)
+#endif
+
+#ifdef USE_DATETIME_DATETIME
+ENTITY_STATS_COUNT(datetime::DateTimeEntity, datetime)
+#endif
+
+#ifdef USE_TEXT
+ENTITY_STATS_COUNT_IGNORE_PARAMS(text::Text, text, const std::string &state)
+#endif
+
+#ifdef USE_SELECT
+ENTITY_STATS_COUNT_IGNORE_PARAMS(select::Select, select, const std::string &state, size_t index)
+#endif
+
+#ifdef USE_LOCK
+ENTITY_STATS_COUNT(lock::Lock, lock)
+#endif
+
+#ifdef USE_VALVE
+ENTITY_STATS_COUNT(valve::Valve, valve)
+#endif
+
+#ifdef USE_MEDIA_PLAYER
+ENTITY_STATS_COUNT(media_player::MediaPlayer, media_player)
+#endif
+
+#ifdef USE_ALARM_CONTROL_PANEL
+ENTITY_STATS_COUNT(alarm_control_panel::AlarmControlPanel, alarm_control_panel)
+#endif
+
+#ifdef USE_EVENT
+void EntityStatsComponent::on_event(event::Event *obj, const std::string &event_type) { this->count_(obj); }
+#endif
+
+#ifdef USE_UPDATE
+void EntityStatsComponent::on_update(update::UpdateEntity *obj) { this->count_(obj); }
+#endif
+
+}  // namespace entity_stats
+}  // namespace esphome
+
+#endif  // USE_ENTITY_STATS
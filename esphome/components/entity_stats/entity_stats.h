@@ -0,0 +1,125 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#ifdef USE_ENTITY_STATS
+
+#include "esphome/core/component.h"
+#include "esphome/core/controller.h"
+#include "esphome/core/entity_base.h"
+
+#include <vector>
+
+#ifdef USE_TEXT_SENSOR
+#include "esphome/components/text_sensor/text_sensor.h"
+#endif
+
+namespace esphome {
+namespace entity_stats {
+
+/** Finds the entities that produce the most state traffic.
+ *
+ * Counts the states every entity publishes, including internal ones, in the EntityStats of the entity. The API and
+ * MQTT add the bytes they send for it and filtered sensors the values they get. Every update interval the entities
+ * that published the most states since the last update are logged and shown in the top_entities text sensor. The
+ * totals since boot are also exported by the prometheus component.
+ */
+class EntityStatsComponent : public PollingComponent, public Controller {
+ public:
+  EntityStatsComponent();
+
+  void setup() override;
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void set_top_count(uint8_t top_count) { this->top_count_ = top_count; }
+#ifdef USE_TEXT_SENSOR
+  void set_top_entities_text_sensor(text_sensor::TextSensor *sensor) { this->top_entities_text_sensor_ = sensor; }
+#endif
+
+  struct TrackedEntity {
+    EntityBase *entity;
+    /// Counters at the previous update, to report what changed during the interval
+    EntityStats last;
+  };
+  /// Entities that published at least once, in the order of their first state
+  const std::vector<TrackedEntity> &get_tracked() const { return this->tracked_; }
+
+#ifdef USE_BINARY_SENSOR
+  void on_binary_sensor_update(binary_sensor::BinarySensor *obj) override;
+#endif
+#ifdef USE_FAN
+  void on_fan_update(fan::Fan *obj) override;
+#endif
+#ifdef USE_LIGHT
+  void on_light_update(light::LightState *obj) override;
+#endif
+#ifdef USE_SENSOR
+  void on_sensor_update(sensor::Sensor *obj, float state) override;
+#endif
+#ifdef USE_SWITCH
+  void on_switch_update(switch_::Switch *obj, bool state) override;
+#endif
+#ifdef USE_COVER
+  void on_cover_update(cover::Cover *obj) override;
+#endif
+#ifdef USE_TEXT_SENSOR
+  void on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) override;
+#endif
+#ifdef USE_CLIMATE
+  void on_climate_update(climate::Climate *obj) override;
+#endif
+#ifdef USE_NUMBER
+  void on_number_update(number::Number *obj, float state) override;
+#endif
+#ifdef USE_DATETIME_DATE
+  void on_date_update(datetime::DateEntity *obj) override;
+#endif
+#ifdef USE_DATETIME_TIME
+  void on_time_update(datetime::TimeEntity *obj) override;
+#endif
+#ifdef USE_DATETIME_DATETIME
+  void on_datetime_update(datetime::DateTimeEntity *obj) override;
+#endif
+#ifdef USE_TEXT
+  void on_text_update(text::Text *obj, const std::string &state) override;
+#endif
+#ifdef USE_SELECT
+  void on_select_update(select::Select *obj, const std::string &state, size_t index) override;
+#endif
+#ifdef USE_LOCK
+  void on_lock_update(lock::Lock *obj) override;
+#endif
+#ifdef USE_VALVE
+  void on_valve_update(valve::Valve *obj) override;
+#endif
+#ifdef USE_MEDIA_PLAYER
+  void on_media_player_update(media_player::MediaPlayer *obj) override;
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+  void on_alarm_control_panel_update(alarm_control_panel::AlarmControlPanel *obj) override;
+#endif
+#ifdef USE_EVENT
+  void on_event(event::Event *obj, const std::string &event_type) override;
+#endif
+#ifdef USE_UPDATE
+  void on_update(update::UpdateEntity *obj) override;
+#endif
+
+ protected:
+  void count_(EntityBase *obj);
+
+  std::vector<TrackedEntity> tracked_;
+  uint32_t last_update_{0};
+  uint8_t top_count_{5};
+#ifdef USE_TEXT_SENSOR
+  text_sensor::TextSensor *top_entities_text_sensor_{nullptr};
+#endif
+};
+
+extern EntityStatsComponent *global_entity_stats;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace entity_stats
+}  // namespace esphome
+
+#endif  // USE_ENTITY_STATS
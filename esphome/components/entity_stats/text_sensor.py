@@ -0,0 +1,27 @@
+import esphome.codegen as cg
+from esphome.components import text_sensor
+import esphome.config_validation as cv
+from esphome.const import ENTITY_CATEGORY_DIAGNOSTIC, ICON_PULSE
+
+from . import CONF_ENTITY_STATS_ID, EntityStatsComponent
+
+DEPENDENCIES = ["entity_stats"]
+
+CONF_TOP_ENTITIES = "top_entities"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_ENTITY_STATS_ID): cv.use_id(EntityStatsComponent),
+        cv.Optional(CONF_TOP_ENTITIES): text_sensor.text_sensor_schema(
+            icon=ICON_PULSE,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+)
+
+
+async def to_code(config):
+    entity_stats = await cg.get_variable(config[CONF_ENTITY_STATS_ID])
+    if top_entities_config := config.get(CONF_TOP_ENTITIES):
+        sens = await text_sensor.new_text_sensor(top_entities_config)
+        cg.add(entity_stats.set_top_entities_text_sensor(sens))
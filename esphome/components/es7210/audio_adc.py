@@ -21,6 +21,8 @@ ES7210_BITS_PER_SAMPLE_ENUM = {
 
 ES7210_MIC_GAINS = [0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33, 34.5, 36, 37.5]
 
+CONF_TDM = "tdm"
+
 _validate_bits = cv.float_with_unit("bits", "bit")
 
 CONFIG_SCHEMA = (
@@ -34,6 +36,7 @@ CONFIG_SCHEMA = (
                 cv.decibel, cv.one_of(*ES7210_MIC_GAINS)
             ),
             cv.Optional(CONF_SAMPLE_RATE, default=16000): cv.int_range(min=1),
+            cv.Optional(CONF_TDM, default=False): cv.boolean,
         }
     )
     .extend(cv.COMPONENT_SCHEMA)
@@ -49,3 +52,4 @@ async def to_code(config):
     cg.add(var.set_bits_per_sample(config[CONF_BITS_PER_SAMPLE]))
     cg.add(var.set_mic_gain(config[CONF_MIC_GAIN]))
     cg.add(var.set_sample_rate(config[CONF_SAMPLE_RATE]))
+    cg.add(var.set_enable_tdm(config[CONF_TDM]))
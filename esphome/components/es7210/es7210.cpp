@@ -28,8 +28,9 @@ void ES7210::dump_config() {
   ESP_LOGCONFIG(TAG,
                 "ES7210 audio ADC:\n"
                 "  Bits Per Sample: %" PRIu8 "\n"
-                "  Sample Rate: %" PRIu32,
-                this->bits_per_sample_, this->sample_rate_);
+                "  Sample Rate: %" PRIu32 "\n"
+                "  TDM: %s",
+                this->bits_per_sample_, this->sample_rate_, YESNO(this->enable_tdm_));
 
   if (this->is_failed()) {
     ESP_LOGE(TAG, "  Failed to initialize");
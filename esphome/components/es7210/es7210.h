@@ -30,6 +30,8 @@ class ES7210 : public audio_adc::AudioAdc, public Component, public i2c::I2CDevi
   void set_bits_per_sample(ES7210BitsPerSample bits_per_sample) { this->bits_per_sample_ = bits_per_sample; }
   bool set_mic_gain(float mic_gain) override;
   void set_sample_rate(uint32_t sample_rate) { this->sample_rate_ = sample_rate; }
+  /// All four microphones on SDOUT1 as TDM slots 0 to 3, instead of two stereo pairs on SDOUT1 and SDOUT2
+  void set_enable_tdm(bool enable_tdm) { this->enable_tdm_ = enable_tdm; }
 
   float mic_gain() override { return this->mic_gain_; };
 
@@ -51,7 +53,7 @@ class ES7210 : public audio_adc::AudioAdc, public Component, public i2c::I2CDevi
   bool configure_sample_rate_();
 
   bool setup_complete_{false};
-  bool enable_tdm_{false};  // TDM is unsupported in ESPHome as of version 2024.12
+  bool enable_tdm_{false};
   float mic_gain_{0};
   ES7210BitsPerSample bits_per_sample_{ES7210_BITS_PER_SAMPLE_16};
   uint32_t sample_rate_{0};
@@ -44,6 +44,7 @@ from .boards import BOARDS, STANDARD_BOARDS
 from .const import (  # noqa
     KEY_BOARD,
     KEY_COMPONENTS,
+    KEY_DATA_PARTITIONS,
     KEY_ESP32,
     KEY_EXTRA_BUILD_FILES,
     KEY_PATH,
@@ -161,6 +162,7 @@ def set_core_data(config):
     CORE.data[KEY_ESP32][KEY_BOARD] = config[CONF_BOARD]
     CORE.data[KEY_ESP32][KEY_VARIANT] = variant
     CORE.data[KEY_ESP32][KEY_EXTRA_BUILD_FILES] = {}
+    CORE.data[KEY_ESP32][KEY_DATA_PARTITIONS] = {}
 
     return config
 
@@ -283,6 +285,17 @@ def add_extra_build_file(filename: str, path: str) -> bool:
     return False
 
 
+def add_idf_data_partition(name: str, subtype: int, size: int) -> None:
+    """Add a data partition to the generated esp-idf partition table.
+
+    The space is taken from the nvs partition. Custom partition tables have to
+    contain the partition themselves.
+    """
+    if not CORE.using_esp_idf:
+        raise ValueError("Not an esp-idf project")
+    CORE.data[KEY_ESP32][KEY_DATA_PARTITIONS][name] = (subtype, size)
+
+
 def _format_framework_arduino_version(ver: cv.Version) -> str:
     # format the given arduino (https://github.com/espressif/arduino-esp32/releases) version to
     # a PIO pioarduino/framework-arduinoespressif32 value
@@ -885,14 +898,18 @@ spiffs,   data, spiffs,  0x{spiffs_partition_start:X}, 0x{spiffs_partition_size:
 
 def get_idf_partition_csv(flash_size):
     app_partition_size = APP_PARTITION_SIZES[flash_size]
+    data_partitions = CORE.data[KEY_ESP32].get(KEY_DATA_PARTITIONS, {})
+    nvs_partition_size = 0x6D000 - sum(size for _, size in data_partitions.values())
 
     partition_csv = f"""\
 otadata,  data, ota,     ,        0x2000,
 phy_init, data, phy,     ,        0x1000,
 app0,     app,  ota_0,   ,        0x{app_partition_size:X},
 app1,     app,  ota_1,   ,        0x{app_partition_size:X},
-nvs,      data, nvs,     ,        0x6D000,
+nvs,      data, nvs,     ,        0x{nvs_partition_size:X},
 """
+    for name, (subtype, size) in data_partitions.items():
+        partition_csv += f"{name + ',':<9} data, 0x{subtype:X},    ,        0x{size:X},\n"
     return partition_csv
 
 
@@ -1,9 +1,14 @@
 #ifdef USE_ESP32
 
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 #include "esphome/core/preferences.h"
+#include "preferences_journal.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 #include <nvs_flash.h>
+#include <atomic>
 #include <cstring>
 #include <cinttypes>
 #include <vector>
@@ -20,6 +25,34 @@ struct NVSData {
 };
 
 static std::vector<NVSData> s_pending_save;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+// Saves being committed by the background task, not modified until it is done
+static std::vector<NVSData> s_syncing;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static std::atomic<bool> s_syncing_active{false};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+static const NVSData *find_pending(const std::string &key) {
+  for (auto &obj : s_pending_save) {
+    if (obj.key == key)
+      return &obj;
+  }
+  // Values being committed are newer than what is stored in NVS
+  if (s_syncing_active) {
+    for (auto &obj : s_syncing) {
+      if (obj.key == key)
+        return &obj;
+    }
+  }
+  return nullptr;
+}
+
+struct SyncResult {
+  int cached = 0;
+  int written = 0;
+  std::vector<size_t> failed;
+  esp_err_t last_err = ESP_OK;
+  std::string last_key{};
+  bool committed = true;
+  uint32_t duration = 0;
+};
 
 class ESP32PreferenceBackend : public ESPPreferenceBackend {
  public:
@@ -42,15 +75,14 @@ class ESP32PreferenceBackend : public ESPPreferenceBackend {
   }
   bool load(uint8_t *data, size_t len) override {
     // try find in pending saves and load from that
-    for (auto &obj : s_pending_save) {
-      if (obj.key == key) {
-        if (obj.data.size() != len) {
-          // size mismatch
-          return false;
-        }
-        memcpy(data, obj.data.data(), len);
-        return true;
+    const NVSData *pending = find_pending(key);
+    if (pending != nullptr) {
+      if (pending->data.size() != len) {
+        // size mismatch
+        return false;
       }
+      memcpy(data, pending->data.data(), len);
+      return true;
     }
 
     size_t actual_len;
@@ -108,53 +140,67 @@ class ESP32Preferences : public ESPPreferences {
   }
 
   bool sync() override {
+    this->wait_for_background_();
     if (s_pending_save.empty())
       return true;
 
     ESP_LOGV(TAG, "Saving %d items...", s_pending_save.size());
-    // goal try write all pending saves even if one fails
-    int cached = 0, written = 0, failed = 0;
-    esp_err_t last_err = ESP_OK;
-    std::string last_key{};
-
-    // go through vector from back to front (makes erase easier/more efficient)
-    for (ssize_t i = s_pending_save.size() - 1; i >= 0; i--) {
-      const auto &save = s_pending_save[i];
-      ESP_LOGVV(TAG, "Checking if NVS data %s has changed", save.key.c_str());
-      if (is_changed(nvs_handle, save)) {
-        esp_err_t err = nvs_set_blob(nvs_handle, save.key.c_str(), save.data.data(), save.data.size());
-        ESP_LOGV(TAG, "sync: key: %s, len: %d", save.key.c_str(), save.data.size());
-        if (err != 0) {
-          ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", save.key.c_str(), save.data.size(),
-                   esp_err_to_name(err));
-          failed++;
-          last_err = err;
-          last_key = save.key;
-          continue;
-        }
-        written++;
-      } else {
-        ESP_LOGV(TAG, "NVS data not changed skipping %s  len=%u", save.key.c_str(), save.data.size());
-        cached++;
-      }
-      s_pending_save.erase(s_pending_save.begin() + i);
+    SyncResult result;
+    this->write_(s_pending_save, result);
+    this->finish_(s_pending_save, result);
+    return result.failed.empty() && result.committed;
+  }
+
+  void begin_sync() override {
+    if (s_syncing_active)
+      return;
+    if (s_pending_save.empty()) {
+      this->sync_result_ = true;
+      return;
     }
-    ESP_LOGD(TAG, "Writing %d items: %d cached, %d written, %d failed", cached + written + failed, cached, written,
-             failed);
-    if (failed > 0) {
-      ESP_LOGE(TAG, "Writing %d items failed. Last error=%s for key=%s", failed, esp_err_to_name(last_err),
-               last_key.c_str());
+    if (this->sync_task_ == nullptr) {
+      // Below the loop task, so a commit only runs while the main loop is idle or on the other core
+      xTaskCreatePinnedToCore(sync_task, "prefs_sync", 3072, this, tskIDLE_PRIORITY, &this->sync_task_,
+                              portNUM_PROCESSORS > 1 ? 0 : tskNO_AFFINITY);
+      if (this->sync_task_ == nullptr) {
+        this->sync_result_ = this->sync();
+        return;
+      }
     }
+    ESP_LOGV(TAG, "Saving %d items in the background...", s_pending_save.size());
+    // Saves from now on go into a new pending list, so the background task has the snapshot for itself
+    s_syncing = std::move(s_pending_save);
+    s_pending_save.clear();
+    this->sync_done_ = false;
+    s_syncing_active = true;
+    xTaskNotifyGive(this->sync_task_);
+  }
 
-    // note: commit on esp-idf currently is a no-op, nvs_set_blob always writes
-    esp_err_t err = nvs_commit(nvs_handle);
-    if (err != 0) {
-      ESP_LOGV(TAG, "nvs_commit() failed: %s", esp_err_to_name(err));
+  bool poll_sync() override {
+    if (!s_syncing_active)
+      return true;
+    if (!this->sync_done_)
       return false;
-    }
 
-    return failed == 0;
+    this->finish_(s_syncing, this->sync_task_result_);
+    // Save failed items again, unless they were changed in the meantime
+    for (auto &save : s_syncing) {
+      bool newer = false;
+      for (auto &obj : s_pending_save) {
+        if (obj.key == save.key) {
+          newer = true;
+          break;
+        }
+      }
+      if (!newer)
+        s_pending_save.push_back(std::move(save));
+    }
+    s_syncing.clear();
+    s_syncing_active = false;
+    this->sync_result_ = this->sync_task_result_.failed.empty() && this->sync_task_result_.committed;
+    return true;
   }
+
   bool is_changed(const uint32_t nvs_handle, const NVSData &to_save) {
     NVSData stored_data{};
     size_t actual_len;
@@ -174,6 +220,7 @@ class ESP32Preferences : public ESPPreferences {
 
   bool reset() override {
     ESP_LOGD(TAG, "Erasing storage");
+    this->wait_for_background_();
     s_pending_save.clear();
 
     nvs_flash_deinit();
@@ -182,9 +229,89 @@ class ESP32Preferences : public ESPPreferences {
     nvs_handle = 0;
     return true;
   }
+
+ protected:
+  static void sync_task(void *arg) {
+    auto *prefs = static_cast<ESP32Preferences *>(arg);
+    while (true) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      prefs->sync_task_result_ = SyncResult{};
+      prefs->write_(s_syncing, prefs->sync_task_result_);
+      prefs->sync_done_ = true;
+    }
+  }
+
+  /// Try to write all items even if one fails, the indices of failed items are stored in the result.
+  void write_(const std::vector<NVSData> &items, SyncResult &result) {
+    uint32_t start = millis();
+    for (size_t i = 0; i < items.size(); i++) {
+      const auto &save = items[i];
+      ESP_LOGVV(TAG, "Checking if NVS data %s has changed", save.key.c_str());
+      if (is_changed(nvs_handle, save)) {
+        esp_err_t err = nvs_set_blob(nvs_handle, save.key.c_str(), save.data.data(), save.data.size());
+        ESP_LOGV(TAG, "sync: key: %s, len: %d", save.key.c_str(), save.data.size());
+        if (err != 0) {
+          ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", save.key.c_str(), save.data.size(),
+                   esp_err_to_name(err));
+          result.failed.push_back(i);
+          result.last_err = err;
+          result.last_key = save.key;
+          continue;
+        }
+        result.written++;
+      } else {
+        ESP_LOGV(TAG, "NVS data not changed skipping %s  len=%u", save.key.c_str(), save.data.size());
+        result.cached++;
+      }
+    }
+
+    // note: commit on esp-idf currently is a no-op, nvs_set_blob always writes
+    esp_err_t err = nvs_commit(nvs_handle);
+    if (err != 0) {
+      ESP_LOGV(TAG, "nvs_commit() failed: %s", esp_err_to_name(err));
+      result.committed = false;
+    }
+    result.duration = millis() - start;
+  }
+
+  /// Log the result and keep only the failed items in \p items.
+  void finish_(std::vector<NVSData> &items, const SyncResult &result) {
+    int failed = result.failed.size();
+    ESP_LOGD(TAG, "Writing %d items: %d cached, %d written, %d failed in %" PRIu32 " ms",
+             result.cached + result.written + failed, result.cached, result.written, failed, result.duration);
+    if (failed > 0) {
+      ESP_LOGE(TAG, "Writing %d items failed. Last error=%s for key=%s", failed, esp_err_to_name(result.last_err),
+               result.last_key.c_str());
+    }
+
+    std::vector<NVSData> remaining;
+    remaining.reserve(failed);
+    for (size_t i : result.failed)
+      remaining.push_back(std::move(items[i]));
+    items = std::move(remaining);
+  }
+
+  void wait_for_background_() {
+    while (s_syncing_active && !this->sync_done_)
+      delay(1);
+    this->poll_sync();
+  }
+
+  TaskHandle_t sync_task_{nullptr};
+  SyncResult sync_task_result_;
+  std::atomic<bool> sync_done_{false};
 };
 
 void setup_preferences() {
+#ifdef USE_ESP32_PREFERENCES_JOURNAL
+  auto *journal = new JournalPreferences();  // NOLINT(cppcoreguidelines-owning-memory)
+  if (journal->open()) {
+    global_preferences = journal;
+    return;
+  }
+  // Without the journal partition, for example with a custom partition table, keep using NVS
+  delete journal;  // NOLINT(cppcoreguidelines-owning-memory)
+#endif
   auto *prefs = new ESP32Preferences();  // NOLINT(cppcoreguidelines-owning-memory)
   prefs->open();
   global_preferences = prefs;
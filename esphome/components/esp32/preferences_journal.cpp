@@ -0,0 +1,326 @@
+#ifdef USE_ESP32
+
+#include "preferences_journal.h"
+
+#ifdef USE_ESP32_PREFERENCES_JOURNAL
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+#include <nvs_flash.h>
+#include <algorithm>
+#include <cinttypes>
+#include <cstddef>
+#include <cstring>
+
+namespace esphome {
+namespace esp32 {
+
+static const char *const TAG = "esp32.preferences";
+
+static const char *const JOURNAL_PARTITION_LABEL = "prefs_journal";
+static const esp_partition_subtype_t JOURNAL_PARTITION_SUBTYPE = static_cast<esp_partition_subtype_t>(0x40);
+static const uint32_t SECTOR_SIZE = 4096;
+static const uint32_t SECTOR_MAGIC = 0x4A525045;  // "EPRJ"
+static const uint32_t BLANK_KEY = 0xFFFFFFFF;
+static const uint16_t NO_SECTOR = 0xFFFF;
+static const size_t MAX_RECORD_LENGTH = 1024;
+
+struct SectorHeader {
+  uint32_t magic;
+  uint32_t sequence;
+};
+
+struct RecordHeader {
+  uint32_t key;
+  uint16_t length;
+  /// CRC-16 over key, length and data, so torn writes are detected.
+  uint16_t crc;
+};
+
+static uint32_t record_size(size_t length) { return sizeof(RecordHeader) + ((length + 3) & ~3); }
+
+static uint16_t record_crc(const RecordHeader &header, const uint8_t *data) {
+  uint16_t crc = crc16(reinterpret_cast<const uint8_t *>(&header), offsetof(RecordHeader, crc));
+  return crc16(data, header.length, crc);
+}
+
+class JournalPreferenceBackend : public ESPPreferenceBackend {
+ public:
+  JournalPreferenceBackend(JournalPreferences *prefs, uint32_t key) : prefs_(prefs), key_(key) {}
+  bool save(const uint8_t *data, size_t len) override { return this->prefs_->save(this->key_, data, len); }
+  bool load(uint8_t *data, size_t len) override { return this->prefs_->load(this->key_, data, len); }
+
+ protected:
+  JournalPreferences *prefs_;
+  uint32_t key_;
+};
+
+bool JournalPreferences::open() {
+  // NVS is still used by esp-idf itself, for example for the WiFi and PHY calibration data
+  nvs_flash_init();
+
+  this->partition_ =
+      esp_partition_find_first(ESP_PARTITION_TYPE_DATA, JOURNAL_PARTITION_SUBTYPE, JOURNAL_PARTITION_LABEL);
+  if (this->partition_ == nullptr) {
+    ESP_LOGE(TAG, "Partition '%s' not found", JOURNAL_PARTITION_LABEL);
+    return false;
+  }
+  this->sector_count_ = this->partition_->size / SECTOR_SIZE;
+  if (this->sector_count_ < 3) {
+    ESP_LOGE(TAG, "Partition '%s' is too small", JOURNAL_PARTITION_LABEL);
+    return false;
+  }
+
+  this->mount_();
+  return true;
+}
+
+ESPPreferenceObject JournalPreferences::make_preference(size_t length, uint32_t type, bool in_flash) {
+  return this->make_preference(length, type);
+}
+ESPPreferenceObject JournalPreferences::make_preference(size_t length, uint32_t type) {
+  auto *pref = new JournalPreferenceBackend(this, type);  // NOLINT(cppcoreguidelines-owning-memory)
+  return ESPPreferenceObject(pref);
+}
+
+JournalPreferences::Entry *JournalPreferences::find_(uint32_t key) {
+  for (auto &entry : this->entries_) {
+    if (entry.key == key)
+      return &entry;
+  }
+  return nullptr;
+}
+
+bool JournalPreferences::save(uint32_t key, const uint8_t *data, size_t len) {
+  if (!this->valid_ || key == BLANK_KEY || len > MAX_RECORD_LENGTH)
+    return false;
+  Entry *entry = this->find_(key);
+  if (entry == nullptr) {
+    this->entries_.push_back(Entry{key, {}, NO_SECTOR, false});
+    entry = &this->entries_.back();
+  } else if (entry->data.size() == len && memcmp(entry->data.data(), data, len) == 0) {
+    // Unchanged, nothing to write
+    return true;
+  }
+  entry->data.assign(data, data + len);
+  entry->dirty = true;
+  return true;
+}
+
+bool JournalPreferences::load(uint32_t key, uint8_t *data, size_t len) {
+  Entry *entry = this->find_(key);
+  if (entry == nullptr || entry->data.size() != len)
+    return false;
+  memcpy(data, entry->data.data(), len);
+  return true;
+}
+
+bool JournalPreferences::sync() {
+  if (!this->valid_)
+    return false;
+
+  int written = 0, failed = 0;
+  uint32_t data_bytes = this->data_bytes_;
+  uint32_t flash_bytes = this->flash_bytes_;
+  for (auto &entry : this->entries_) {
+    if (!entry.dirty)
+      continue;
+    if (this->append_(entry)) {
+      this->data_bytes_ += entry.data.size();
+      written++;
+    } else {
+      failed++;
+    }
+  }
+  if (written == 0 && failed == 0)
+    return true;
+
+  ESP_LOGD(TAG, "Writing %d items: %d written, %d failed, %" PRIu32 " bytes of data as %" PRIu32 " bytes of flash",
+           written + failed, written, failed, this->data_bytes_ - data_bytes, this->flash_bytes_ - flash_bytes);
+  ESP_LOGV(TAG, "Journal write amplification %.2f, %" PRIu32 " sector erases since boot",
+           this->data_bytes_ ? float(this->flash_bytes_) / float(this->data_bytes_) : 0.0f, this->erases_);
+  if (failed > 0) {
+    ESP_LOGE(TAG, "Writing %d items failed", failed);
+  }
+  return failed == 0;
+}
+
+bool JournalPreferences::reset() {
+  ESP_LOGD(TAG, "Erasing storage");
+  this->entries_.clear();
+  esp_partition_erase_range(this->partition_, 0, this->partition_->size);
+
+  nvs_flash_deinit();
+  nvs_flash_erase();
+  // Prevent any saves until restart
+  this->valid_ = false;
+  return true;
+}
+
+void JournalPreferences::mount_() {
+  // Replay all sectors from oldest to newest, so the newest record of each value wins
+  std::vector<std::pair<uint32_t, uint16_t>> sectors;
+  for (uint16_t sector = 0; sector < this->sector_count_; sector++) {
+    uint32_t sequence;
+    if (this->read_header_(sector, &sequence))
+      sectors.emplace_back(sequence, sector);
+  }
+  if (sectors.empty()) {
+    this->format_();
+    return;
+  }
+  std::sort(sectors.begin(), sectors.end());
+  for (const auto &[sequence, sector] : sectors)
+    this->offset_ = this->scan_sector_(sector);
+  this->sequence_ = sectors.back().first;
+  this->active_ = sectors.back().second;
+  this->valid_ = true;
+
+  // Restore the erased sector ahead of the log, an earlier advance may have been interrupted
+  if (!this->clear_((this->active_ + 1) % this->sector_count_))
+    ESP_LOGE(TAG, "Could not free the next journal sector");
+  ESP_LOGV(TAG, "Mounted journal: %zu values, active sector %u at offset %" PRIu32, this->entries_.size(),
+           this->active_, this->offset_);
+}
+
+void JournalPreferences::format_() {
+  ESP_LOGI(TAG, "Formatting preferences journal");
+  for (uint16_t sector = 0; sector < this->sector_count_; sector++)
+    this->erase_(sector);
+  this->sequence_ = 0;
+  this->valid_ = this->start_sector_(0);
+}
+
+bool JournalPreferences::read_header_(uint16_t sector, uint32_t *sequence) {
+  SectorHeader header{};
+  if (esp_partition_read(this->partition_, sector * SECTOR_SIZE, &header, sizeof(header)) != ESP_OK)
+    return false;
+  if (header.magic != SECTOR_MAGIC)
+    return false;
+  *sequence = header.sequence;
+  return true;
+}
+
+uint32_t JournalPreferences::scan_sector_(uint16_t sector) {
+  const uint32_t base = sector * SECTOR_SIZE;
+  uint32_t offset = sizeof(SectorHeader);
+  while (offset + sizeof(RecordHeader) <= SECTOR_SIZE) {
+    RecordHeader header{};
+    esp_partition_read(this->partition_, base + offset, &header, sizeof(header));
+    if (header.key == BLANK_KEY && header.length == 0xFFFF)
+      return offset;
+    if (header.length > MAX_RECORD_LENGTH || offset + record_size(header.length) > SECTOR_SIZE)
+      return SECTOR_SIZE;
+
+    this->buffer_.resize(header.length);
+    esp_partition_read(this->partition_, base + offset + sizeof(header), this->buffer_.data(), header.length);
+    if (record_crc(header, this->buffer_.data()) != header.crc) {
+      // Interrupted write, don't append after it
+      ESP_LOGW(TAG, "Invalid record in sector %u at offset %" PRIu32, sector, offset);
+      return SECTOR_SIZE;
+    }
+
+    Entry *entry = this->find_(header.key);
+    if (entry == nullptr) {
+      this->entries_.push_back(Entry{header.key, {}, NO_SECTOR, false});
+      entry = &this->entries_.back();
+    }
+    entry->data = this->buffer_;
+    entry->sector = sector;
+    offset += record_size(header.length);
+  }
+  return offset;
+}
+
+bool JournalPreferences::start_sector_(uint16_t sector) {
+  SectorHeader header{SECTOR_MAGIC, this->sequence_ + 1};
+  esp_err_t err = esp_partition_write(this->partition_, sector * SECTOR_SIZE, &header, sizeof(header));
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Starting sector %u failed: %s", sector, esp_err_to_name(err));
+    return false;
+  }
+  this->flash_bytes_ += sizeof(header);
+  this->sequence_++;
+  this->active_ = sector;
+  this->offset_ = sizeof(header);
+  return true;
+}
+
+bool JournalPreferences::append_(Entry &entry) {
+  if (this->offset_ + record_size(entry.data.size()) > SECTOR_SIZE && !this->advance_())
+    return false;
+  // A dirty entry may already have been written while its old sector was reclaimed
+  if (!entry.dirty)
+    return true;
+  return this->write_record_(entry);
+}
+
+bool JournalPreferences::write_record_(Entry &entry) {
+  const uint32_t size = record_size(entry.data.size());
+  if (this->offset_ + size > SECTOR_SIZE) {
+    ESP_LOGE(TAG, "No space for value %" PRIu32 " in sector %u", entry.key, this->active_);
+    return false;
+  }
+
+  RecordHeader header{entry.key, static_cast<uint16_t>(entry.data.size()), 0};
+  header.crc = record_crc(header, entry.data.data());
+  this->buffer_.assign(size, 0xFF);
+  memcpy(this->buffer_.data(), &header, sizeof(header));
+  memcpy(this->buffer_.data() + sizeof(header), entry.data.data(), entry.data.size());
+
+  esp_err_t err =
+      esp_partition_write(this->partition_, this->active_ * SECTOR_SIZE + this->offset_, this->buffer_.data(), size);
+  if (err != ESP_OK) {
+    ESP_LOGV(TAG, "Writing value %" PRIu32 " failed: %s", entry.key, esp_err_to_name(err));
+    // Don't retry at a possibly half written offset
+    this->offset_ = SECTOR_SIZE;
+    return false;
+  }
+  this->offset_ += size;
+  this->flash_bytes_ += size;
+  entry.sector = this->active_;
+  entry.dirty = false;
+  return true;
+}
+
+bool JournalPreferences::advance_() {
+  // The next sector is always erased, so the log can move on before anything is erased
+  if (!this->start_sector_((this->active_ + 1) % this->sector_count_))
+    return false;
+  return this->clear_((this->active_ + 1) % this->sector_count_);
+}
+
+bool JournalPreferences::clear_(uint16_t sector) {
+  uint32_t sequence;
+  if (this->read_header_(sector, &sequence)) {
+    // Copy the values whose newest record is in this sector to the active one, then it can be erased.
+    // They all came from one sector, so they always fit into a freshly started one.
+    for (auto &entry : this->entries_) {
+      if (entry.sector == sector && !this->write_record_(entry))
+        return false;
+    }
+    return this->erase_(sector);
+  }
+  // Sectors are only written after their header, so a blank header means the sector is still erased
+  SectorHeader header{};
+  esp_partition_read(this->partition_, sector * SECTOR_SIZE, &header, sizeof(header));
+  if (header.magic == BLANK_KEY && header.sequence == BLANK_KEY)
+    return true;
+  return this->erase_(sector);
+}
+
+bool JournalPreferences::erase_(uint16_t sector) {
+  esp_err_t err = esp_partition_erase_range(this->partition_, sector * SECTOR_SIZE, SECTOR_SIZE);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Erasing sector %u failed: %s", sector, esp_err_to_name(err));
+    return false;
+  }
+  this->erases_++;
+  return true;
+}
+
+}  // namespace esp32
+}  // namespace esphome
+
+#endif  // USE_ESP32_PREFERENCES_JOURNAL
+#endif  // USE_ESP32
@@ -0,0 +1,79 @@
+#pragma once
+
+#ifdef USE_ESP32
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_ESP32_PREFERENCES_JOURNAL
+
+#include "esphome/core/preferences.h"
+
+#include <esp_partition.h>
+#include <vector>
+
+namespace esphome {
+namespace esp32 {
+
+/** Preferences stored as an append-only log on a dedicated flash partition.
+ *
+ * The partition's sectors are used as a ring. A sync appends one record per changed value to the active sector.
+ * When it is full the log moves on to the next sector, which is always kept erased, and the values whose newest
+ * record is in the sector after that are copied forward so it can be erased in turn. Every sector is erased
+ * equally often, and saving needs no read-compare or page rewrite like NVS does.
+ */
+class JournalPreferences : public ESPPreferences {
+ public:
+  /// Mount the journal partition, returns false if there is none.
+  bool open();
+
+  ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override;
+  ESPPreferenceObject make_preference(size_t length, uint32_t type) override;
+  bool sync() override;
+  bool reset() override;
+
+  bool save(uint32_t key, const uint8_t *data, size_t len);
+  bool load(uint32_t key, uint8_t *data, size_t len);
+
+ protected:
+  struct Entry {
+    uint32_t key;
+    std::vector<uint8_t> data;
+    /// Sector with the newest record of this value, NO_SECTOR if it was never written.
+    uint16_t sector;
+    bool dirty;
+  };
+
+  Entry *find_(uint32_t key);
+  void mount_();
+  void format_();
+  /// Replay the records of a sector, returns the offset after the last valid record.
+  uint32_t scan_sector_(uint16_t sector);
+  bool read_header_(uint16_t sector, uint32_t *sequence);
+  bool start_sector_(uint16_t sector);
+  bool append_(Entry &entry);
+  bool write_record_(Entry &entry);
+  bool advance_();
+  /// Make sure \p sector is erased, moving its live values to the active sector first.
+  bool clear_(uint16_t sector);
+  bool erase_(uint16_t sector);
+
+  const esp_partition_t *partition_{nullptr};
+  std::vector<Entry> entries_;
+  std::vector<uint8_t> buffer_;
+  uint32_t sequence_{0};
+  uint32_t offset_{0};
+  uint16_t sector_count_{0};
+  uint16_t active_{0};
+  bool valid_{false};
+
+  // Write amplification statistics since boot
+  uint32_t data_bytes_{0};
+  uint32_t flash_bytes_{0};
+  uint32_t erases_{0};
+};
+
+}  // namespace esp32
+}  // namespace esphome
+
+#endif  // USE_ESP32_PREFERENCES_JOURNAL
+#endif  // USE_ESP32
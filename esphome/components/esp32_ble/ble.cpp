@@ -14,6 +14,8 @@
 #include <freertos/FreeRTOSConfig.h>
 #include <freertos/task.h>
 #include <nvs_flash.h>
+#include <algorithm>
+#include <cstring>
 
 #ifdef USE_ARDUINO
 #include <esp32-hal-bt.h>
@@ -34,6 +36,16 @@ void ESP32BLE::setup() {
     return;
   }
 
+  if (!this->gap_scan_event_handlers_.empty()) {
+    RAMAllocator<BLEScanResult> allocator;
+    this->scan_results_ = allocator.allocate(SCAN_RESULT_BUFFER_SIZE);
+    if (this->scan_results_ == nullptr) {
+      ESP_LOGE(TAG, "Could not allocate scan result buffer");
+      this->mark_failed();
+      return;
+    }
+  }
+
   this->state_ = BLE_COMPONENT_STATE_DISABLED;
   if (this->enable_on_boot_) {
     this->enable();
@@ -299,6 +311,8 @@ void ESP32BLE::loop() {
       break;
   }
 
+  this->dispatch_scan_results_();
+
   BLEEvent *ble_event = this->ble_events_.pop();
   while (ble_event != nullptr) {
     switch (ble_event->type_) {
@@ -324,14 +338,9 @@ void ESP32BLE::loop() {
       }
       case BLEEvent::GAP: {
         esp_gap_ble_cb_event_t gap_event = ble_event->event_.gap.gap_event;
+        // Results reported before this event must reach the handlers first
+        this->dispatch_scan_results_();
         switch (gap_event) {
-          case ESP_GAP_BLE_SCAN_RESULT_EVT:
-            // Use the new scan event handler - no memcpy!
-            for (auto *scan_handler : this->gap_scan_event_handlers_) {
-              scan_handler->gap_scan_event_handler(ble_event->scan_result());
-            }
-            break;
-
           // Scan complete events
           case ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT:
           case ESP_GAP_BLE_SCAN_START_COMPLETE_EVT:
@@ -406,6 +415,55 @@ void ESP32BLE::loop() {
   if (dropped > 0) {
     ESP_LOGW(TAG, "Dropped %u BLE events due to buffer overflow", dropped);
   }
+  dropped = this->scan_results_dropped_.exchange(0, std::memory_order_relaxed);
+  if (dropped > 0) {
+    ESP_LOGW(TAG, "Dropped %u BLE scan results due to buffer overflow", dropped);
+  }
+}
+
+void ESP32BLE::enqueue_scan_result_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) {
+  if (this->scan_results_ == nullptr)
+    return;
+
+  // Load our own index with relaxed ordering (we're the only writer)
+  uint8_t write_idx = this->scan_write_index_.load(std::memory_order_relaxed);
+  uint8_t next_write_idx = (write_idx + 1) % SCAN_RESULT_BUFFER_SIZE;
+  // Load consumer's index with acquire to see their latest updates
+  if (next_write_idx == this->scan_read_index_.load(std::memory_order_acquire)) {
+    this->scan_results_dropped_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  BLEScanResult &result = this->scan_results_[write_idx];
+  memcpy(result.bda, param.bda, sizeof(esp_bd_addr_t));
+  result.ble_addr_type = param.ble_addr_type;
+  result.rssi = param.rssi;
+  result.adv_data_len = param.adv_data_len;
+  result.scan_rsp_len = param.scan_rsp_len;
+  result.search_evt = param.search_evt;
+  // Only the used part of the payload, legacy advertisements are at most 31 + 31 bytes
+  memcpy(result.ble_adv, param.ble_adv,
+         std::min<size_t>(param.adv_data_len + param.scan_rsp_len, sizeof(result.ble_adv)));
+
+  // Store with release to ensure the write is visible before index update
+  this->scan_write_index_.store(next_write_idx, std::memory_order_release);
+}
+
+void ESP32BLE::dispatch_scan_results_() {
+  if (this->scan_results_ == nullptr)
+    return;
+
+  uint8_t read_idx = this->scan_read_index_.load(std::memory_order_relaxed);
+  uint8_t write_idx = this->scan_write_index_.load(std::memory_order_acquire);
+  while (read_idx != write_idx) {
+    // Up to the write index, or to the end of the buffer if it wrapped around
+    size_t count = (write_idx > read_idx) ? (write_idx - read_idx) : (SCAN_RESULT_BUFFER_SIZE - read_idx);
+    for (auto *scan_handler : this->gap_scan_event_handlers_) {
+      scan_handler->gap_scan_event_handler(&this->scan_results_[read_idx], count);
+    }
+    read_idx = (read_idx + count) % SCAN_RESULT_BUFFER_SIZE;
+    this->scan_read_index_.store(read_idx, std::memory_order_release);
+  }
 }
 
 // Helper function to load new event data based on type
@@ -446,8 +504,11 @@ template void enqueue_ble_event(esp_gattc_cb_event_t, esp_gatt_if_t, esp_ble_gat
 void ESP32BLE::gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) {
   switch (event) {
     // Queue GAP events that components need to handle
-    // Scanning events - used by esp32_ble_tracker
+    // Scan results go through their own ring, see dispatch_scan_results_()
     case ESP_GAP_BLE_SCAN_RESULT_EVT:
+      global_ble->enqueue_scan_result_(param->scan_rst);
+      return;
+    // Scanning events - used by esp32_ble_tracker
     case ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT:
     case ESP_GAP_BLE_SCAN_START_COMPLETE_EVT:
     case ESP_GAP_BLE_SCAN_STOP_COMPLETE_EVT:
@@ -4,6 +4,7 @@
 #include "ble_uuid.h"
 #include "ble_scan_result.h"
 
+#include <atomic>
 #include <functional>
 
 #include "esphome/core/automation.h"
@@ -76,7 +77,8 @@ class GAPEventHandler {
 
 class GAPScanEventHandler {
  public:
-  virtual void gap_scan_event_handler(const BLEScanResult &scan_result) = 0;
+  /// Called from the main loop with a run of results, in the order the stack reported them.
+  virtual void gap_scan_event_handler(const BLEScanResult *scan_results, size_t count) = 0;
 };
 
 class GATTcEventHandler {
@@ -146,6 +148,11 @@ class ESP32BLE : public Component {
  private:
   template<typename... Args> friend void enqueue_ble_event(Args... args);
 
+  /// Copy a scan result into the scan ring, called from the BLE task.
+  void enqueue_scan_result_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
+  /// Hand the results in the scan ring to the scan handlers, one call per contiguous run.
+  void dispatch_scan_results_();
+
   // Vectors (12 bytes each on 32-bit, naturally aligned to 4 bytes)
   std::vector<GAPEventHandler *> gap_event_handlers_;
   std::vector<GAPScanEventHandler *> gap_scan_event_handlers_;
@@ -157,6 +164,13 @@ class ESP32BLE : public Component {
   esphome::LockFreeQueue<BLEEvent, MAX_BLE_QUEUE_SIZE> ble_events_;
   esphome::EventPool<BLEEvent, MAX_BLE_QUEUE_SIZE> ble_event_pool_;
 
+  // Scan results bypass the event queue: the BLE task appends them to this SPSC ring and the main loop
+  // passes them on in batches, so a burst of advertisements costs one hand-off instead of one event each.
+  BLEScanResult *scan_results_{nullptr};
+  std::atomic<uint8_t> scan_write_index_{0};       // Written only by the BLE task (producer)
+  std::atomic<uint8_t> scan_read_index_{0};        // Written only by the main loop (consumer)
+  std::atomic<uint16_t> scan_results_dropped_{0};  // Results lost because the ring was full
+
   // optional<string> (typically 16+ bytes on 32-bit, aligned to 4 bytes)
   optional<std::string> name_;
 
@@ -49,24 +49,61 @@ void BLECharacteristic::notify() {
       this->service_->get_server()->get_connected_client_count() == 0)
     return;
 
+  bool was_pending = !this->pending_clients_.empty();
   for (auto &client : this->service_->get_server()->get_clients()) {
-    size_t length = this->value_.size();
     // If the client is not in the list of clients to notify, skip it
     if (this->clients_to_notify_.count(client) == 0)
       continue;
+    if (std::find(this->pending_clients_.begin(), this->pending_clients_.end(), client) == this->pending_clients_.end())
+      this->pending_clients_.push_back(client);
+  }
+  if (!was_pending && !this->pending_clients_.empty())
+    this->service_->get_server()->queue_notification_(this);
+}
+
+bool BLECharacteristic::send_notifications_(uint8_t &budget) {
+  BLEServer *server = this->service_->get_server();
+  auto it = this->pending_clients_.begin();
+  while (it != this->pending_clients_.end() && budget > 0) {
+    uint16_t client = *it;
+    auto subscription = this->clients_to_notify_.find(client);
+    if (subscription == this->clients_to_notify_.end() || server->get_clients().count(client) == 0) {
+      // Unsubscribed or disconnected in the meantime
+      it = this->pending_clients_.erase(it);
+      continue;
+    }
+    if (server->is_congested(client)) {
+      it++;
+      continue;
+    }
     // If the client is in the list of clients to notify, check if it requires an ack (i.e. INDICATE)
-    bool require_ack = this->clients_to_notify_[client];
+    bool require_ack = subscription->second;
     // TODO: Remove this block when INDICATE acknowledgment is supported
     if (require_ack) {
       ESP_LOGW(TAG, "INDICATE acknowledgment is not yet supported (i.e. it works as a NOTIFY)");
       require_ack = false;
     }
-    esp_err_t err = esp_ble_gatts_send_indicate(this->service_->get_server()->get_gatts_if(), client, this->handle_,
-                                                length, this->value_.data(), require_ack);
+    // A notification carries at most MTU - 3 bytes of the value
+    size_t length = std::min<size_t>(this->value_.size(), server->get_client_mtu(client) - 3);
+    esp_err_t err = esp_ble_gatts_send_indicate(server->get_gatts_if(), client, this->handle_, length,
+                                                this->value_.data(), require_ack);
     if (err != ESP_OK) {
-      ESP_LOGE(TAG, "esp_ble_gatts_send_indicate failed %d", err);
-      return;
+      // Out of buffers, try again on the next loop
+      ESP_LOGV(TAG, "esp_ble_gatts_send_indicate failed %d", err);
+      budget = 0;
+      break;
     }
+    budget--;
+    it = this->pending_clients_.erase(it);
+  }
+  return this->pending_clients_.empty();
+}
+
+void BLECharacteristic::do_delete() {
+  this->clients_to_notify_.clear();
+  if (!this->pending_clients_.empty()) {
+    this->pending_clients_.clear();
+    this->service_->get_server()->dequeue_notification_(this);
   }
 }
 
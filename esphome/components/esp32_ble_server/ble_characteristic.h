@@ -54,10 +54,15 @@ class BLECharacteristic : public EventEmitter<BLECharacteristicEvt::VectorEvt, s
   void set_write_property(bool value);
   void set_write_no_response_property(bool value);
 
+  /** Notify the subscribed clients of the current value.
+   *
+   * The notification is sent from the server loop, so calls in between coalesce and the clients get the latest
+   * value. Clients whose connection is congested are caught up once it clears.
+   */
   void notify();
 
   void do_create(BLEService *service);
-  void do_delete() { this->clients_to_notify_.clear(); }
+  void do_delete();
   void gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param);
 
   void add_descriptor(BLEDescriptor *descriptor);
@@ -78,6 +83,11 @@ class BLECharacteristic : public EventEmitter<BLECharacteristicEvt::VectorEvt, s
   bool is_failed();
 
  protected:
+  friend class BLEServer;
+
+  /// Send the pending notification to as many clients as possible, returns true once all have got it.
+  bool send_notifications_(uint8_t &budget);
+
   bool write_event_{false};
   BLEService *service_{};
   ESPBTUUID uuid_;
@@ -90,6 +100,8 @@ class BLECharacteristic : public EventEmitter<BLECharacteristicEvt::VectorEvt, s
 
   std::vector<BLEDescriptor *> descriptors_;
   std::unordered_map<uint16_t, bool> clients_to_notify_;
+  /// Clients that have not been sent the current value yet.
+  std::vector<uint16_t> pending_clients_;
 
   esp_gatt_perm_t permissions_ = ESP_GATT_PERM_READ | ESP_GATT_PERM_WRITE;
 
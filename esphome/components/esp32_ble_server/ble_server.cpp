@@ -13,12 +13,16 @@
 #include <esp_bt.h>
 #include <freertos/task.h>
 #include <esp_gap_ble_api.h>
+#include <algorithm>
 
 namespace esphome {
 namespace esp32_ble_server {
 
 static const char *const TAG = "esp32_ble_server";
 
+// Notifications handed to the stack per loop, the rest wait for the next one
+static constexpr uint8_t NOTIFICATIONS_PER_LOOP = 8;
+
 void BLEServer::setup() {
   if (this->parent_->is_failed()) {
     this->mark_failed();
@@ -52,6 +56,8 @@ void BLEServer::loop() {
                                          this->services_to_start_.begin() + index_to_remove - 1);
         }
       }
+      if (!this->pending_notifications_.empty())
+        this->send_pending_notifications_();
       break;
     }
     case INIT: {
@@ -170,6 +176,18 @@ void BLEServer::gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t ga
       this->registered_ = true;
       break;
     }
+    case ESP_GATTS_MTU_EVT: {
+      this->client_mtus_[param->mtu.conn_id] = param->mtu.mtu;
+      break;
+    }
+    case ESP_GATTS_CONGEST_EVT: {
+      if (param->congest.congested) {
+        this->congested_clients_.insert(param->congest.conn_id);
+      } else {
+        this->congested_clients_.erase(param->congest.conn_id);
+      }
+      break;
+    }
     default:
       break;
   }
@@ -179,9 +197,40 @@ void BLEServer::gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t ga
   }
 }
 
+void BLEServer::remove_client_(uint16_t conn_id) {
+  this->clients_.erase(conn_id);
+  this->congested_clients_.erase(conn_id);
+  this->client_mtus_.erase(conn_id);
+}
+
+uint16_t BLEServer::get_client_mtu(uint16_t conn_id) const {
+  auto it = this->client_mtus_.find(conn_id);
+  return it == this->client_mtus_.end() ? ESP_GATT_DEF_BLE_MTU_SIZE : it->second;
+}
+
+void BLEServer::dequeue_notification_(BLECharacteristic *characteristic) {
+  this->pending_notifications_.erase(
+      std::remove(this->pending_notifications_.begin(), this->pending_notifications_.end(), characteristic),
+      this->pending_notifications_.end());
+}
+
+void BLEServer::send_pending_notifications_() {
+  // Round robin over the characteristics so a busy one can't starve the others
+  uint8_t budget = NOTIFICATIONS_PER_LOOP;
+  size_t count = this->pending_notifications_.size();
+  for (size_t i = 0; i < count && budget > 0; i++) {
+    BLECharacteristic *characteristic = this->pending_notifications_.front();
+    this->pending_notifications_.erase(this->pending_notifications_.begin());
+    if (!characteristic->send_notifications_(budget))
+      this->pending_notifications_.push_back(characteristic);
+  }
+}
+
 void BLEServer::ble_before_disabled_event_handler() {
   // Delete all clients
   this->clients_.clear();
+  this->congested_clients_.clear();
+  this->client_mtus_.clear();
   // Delete all services
   for (auto &pair : this->services_) {
     pair.second->do_delete();
@@ -59,6 +59,9 @@ class BLEServer : public Component,
   esp_gatt_if_t get_gatts_if() { return this->gatts_if_; }
   uint32_t get_connected_client_count() { return this->clients_.size(); }
   const std::unordered_set<uint16_t> &get_clients() { return this->clients_; }
+  /// Whether the stack reported the connection as congested, notifications to it are held back until it clears.
+  bool is_congested(uint16_t conn_id) const { return this->congested_clients_.count(conn_id) != 0; }
+  uint16_t get_client_mtu(uint16_t conn_id) const;
 
   void gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if,
                            esp_ble_gatts_cb_param_t *param) override;
@@ -66,17 +69,28 @@ class BLEServer : public Component,
   void ble_before_disabled_event_handler() override;
 
  protected:
+  friend class BLECharacteristic;
+
   static std::string get_service_key(ESPBTUUID uuid, uint8_t inst_id);
   void restart_advertising_();
 
   void add_client_(uint16_t conn_id) { this->clients_.insert(conn_id); }
-  void remove_client_(uint16_t conn_id) { this->clients_.erase(conn_id); }
+  void remove_client_(uint16_t conn_id);
+  void queue_notification_(BLECharacteristic *characteristic) {
+    this->pending_notifications_.push_back(characteristic);
+  }
+  void dequeue_notification_(BLECharacteristic *characteristic);
+  void send_pending_notifications_();
 
   std::vector<uint8_t> manufacturer_data_{};
   esp_gatt_if_t gatts_if_{0};
   bool registered_{false};
 
   std::unordered_set<uint16_t> clients_;
+  std::unordered_set<uint16_t> congested_clients_;
+  std::unordered_map<uint16_t, uint16_t> client_mtus_;
+  /// Characteristics with notifications that have not reached all clients yet, in the order they were queued.
+  std::vector<BLECharacteristic *> pending_notifications_;
   std::unordered_map<std::string, BLEService *> services_{};
   std::vector<BLEService *> services_to_start_{};
   BLEService *device_information_service_{};
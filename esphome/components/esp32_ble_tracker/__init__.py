@@ -30,7 +30,7 @@ from esphome.const import (
     CONF_SERVICE_UUID,
     CONF_TRIGGER_ID,
 )
-from esphome.core import CORE, coroutine_with_priority
+from esphome.core import CORE, MACAddress, coroutine_with_priority
 from esphome.enum import StrEnum
 from esphome.types import ConfigType
 
@@ -44,6 +44,9 @@ CONF_MAX_CONNECTIONS = "max_connections"
 CONF_ESP32_BLE_ID = "esp32_ble_id"
 CONF_SCAN_PARAMETERS = "scan_parameters"
 CONF_WINDOW = "window"
+CONF_ADAPTIVE_WINDOW = "adaptive_window"
+CONF_MIN_WINDOW = "min_window"
+CONF_MAX_WINDOW = "max_window"
 CONF_ON_SCAN_END = "on_scan_end"
 CONF_SOFTWARE_COEXISTENCE = "software_coexistence"
 
@@ -124,6 +127,20 @@ def validate_scan_parameters(config):
             "cover all BLE channels."
         )
 
+    if adaptive := config.get(CONF_ADAPTIVE_WINDOW):
+        min_window = adaptive[CONF_MIN_WINDOW]
+        max_window = adaptive.setdefault(CONF_MAX_WINDOW, interval)
+        if not min_window <= window <= max_window:
+            raise cv.Invalid(
+                f"Scan window ({window}) needs to be between the adaptive "
+                f"min_window ({min_window}) and max_window ({max_window})"
+            )
+        if max_window > interval:
+            raise cv.Invalid(
+                f"Adaptive max_window ({max_window}) needs to be smaller than scan "
+                f"interval ({interval})"
+            )
+
     return config
 
 
@@ -187,6 +204,17 @@ CONFIG_SCHEMA = cv.All(
                         ): cv.positive_time_period_milliseconds,
                         cv.Optional(CONF_ACTIVE, default=True): cv.boolean,
                         cv.Optional(CONF_CONTINUOUS, default=True): cv.boolean,
+                        cv.Optional(CONF_ADAPTIVE_WINDOW): cv.Schema(
+                            {
+                                cv.Optional(CONF_MIN_WINDOW, default="10ms"): cv.All(
+                                    cv.positive_time_period_milliseconds,
+                                    cv.Range(min=cv.TimePeriod(milliseconds=3)),
+                                ),
+                                cv.Optional(
+                                    CONF_MAX_WINDOW
+                                ): cv.positive_time_period_milliseconds,
+                            }
+                        ),
                     }
                 ),
                 validate_scan_parameters,
@@ -298,6 +326,14 @@ async def to_code(config):
     cg.add(var.set_scan_window(int(params[CONF_WINDOW].total_milliseconds / 0.625)))
     cg.add(var.set_scan_active(params[CONF_ACTIVE]))
     cg.add(var.set_scan_continuous(params[CONF_CONTINUOUS]))
+    if adaptive := params.get(CONF_ADAPTIVE_WINDOW):
+        cg.add_define("USE_ESP32_BLE_ADAPTIVE_SCAN")
+        cg.add(
+            var.set_adaptive_window(
+                int(adaptive[CONF_MIN_WINDOW].total_milliseconds / 0.625),
+                int(adaptive[CONF_MAX_WINDOW].total_milliseconds / 0.625),
+            )
+        )
 
     # Register ESP_BT_DEVICE feature if any of the automation triggers are used
     if (
@@ -425,12 +461,19 @@ async def esp32_ble_tracker_stop_scan_action_to_code(
     return var
 
 
+def _add_address_filter(var: cg.SafeExpType, config: ConfigType) -> None:
+    # A listener for a single device only needs to see that device's advertisements
+    if isinstance(mac := config.get(CONF_MAC_ADDRESS), MACAddress):
+        cg.add(var.add_address_filter(mac.as_hex))
+
+
 async def register_ble_device(
     var: cg.SafeExpType, config: ConfigType
 ) -> cg.SafeExpType:
     register_ble_features({BLEFeatures.ESP_BT_DEVICE})
     paren = await cg.get_variable(config[CONF_ESP32_BLE_ID])
     cg.add(paren.register_listener(var))
+    _add_address_filter(var, config)
     return var
 
 
@@ -451,6 +494,7 @@ async def register_raw_ble_device(
     """
     paren = await cg.get_variable(config[CONF_ESP32_BLE_ID])
     cg.add(paren.register_listener(var))
+    _add_address_filter(var, config)
     return var
 
 
@@ -15,6 +15,7 @@
 #include <freertos/FreeRTOSConfig.h>
 #include <freertos/task.h>
 #include <nvs_flash.h>
+#include <algorithm>
 #include <cinttypes>
 
 #ifdef USE_OTA
@@ -40,6 +41,13 @@ namespace esp32_ble_tracker {
 
 static const char *const TAG = "esp32_ble_tracker";
 
+#ifdef USE_ESP32_BLE_ADAPTIVE_SCAN
+static constexpr uint32_t ADAPT_PERIOD_MS = 10000;
+// Periods in a row with (or without) backpressure before the window is changed
+static constexpr uint8_t SHRINK_AFTER_PERIODS = 2;
+static constexpr uint8_t GROW_AFTER_PERIODS = 6;
+#endif
+
 ESP32BLETracker *global_esp32_ble_tracker = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 float ESP32BLETracker::get_setup_priority() const { return setup_priority::AFTER_BLUETOOTH; }
@@ -71,6 +79,10 @@ void ESP32BLETracker::setup() {
         }
       });
 #endif
+
+#ifdef USE_ESP32_BLE_ADAPTIVE_SCAN
+  this->set_interval("adapt_scan", ADAPT_PERIOD_MS, [this]() { this->adapt_scan_window_(); });
+#endif
 }
 
 void ESP32BLETracker::loop() {
@@ -132,6 +144,9 @@ void ESP32BLETracker::loop() {
       // If write > read: process all results from read to write
       // If write <= read (wraparound): process from read to end of buffer first
       size_t batch_size = (write_idx > read_idx) ? (write_idx - read_idx) : (SCAN_RESULT_BUFFER_SIZE - read_idx);
+#ifdef USE_ESP32_BLE_ADAPTIVE_SCAN
+      this->adapt_advertisements_ += batch_size;
+#endif
 
       // Process the batch for raw advertisements
       if (this->raw_advertisements_) {
@@ -146,17 +161,20 @@ void ESP32BLETracker::loop() {
       // Process individual results for parsed advertisements
       if (this->parse_advertisements_) {
 #ifdef USE_ESP32_BLE_DEVICE
+        if (!this->listener_index_valid_)
+          this->rebuild_listener_index_();
         for (size_t i = 0; i < batch_size; i++) {
           BLEScanResult &scan_result = this->scan_ring_buffer_[read_idx + i];
+          // Only parsed once a listener, client or the device info log needs it
           ESPBTDevice device;
-          device.parse_scan_rst(scan_result);
+          bool parsed = false;
 
-          bool found = false;
-          for (auto *listener : this->listeners_) {
-            if (listener->parse_device(device))
-              found = true;
-          }
+          bool found = this->dispatch_scan_result_(scan_result, device, parsed);
 
+          if (!this->clients_.empty() && !parsed) {
+            device.parse_scan_rst(scan_result);
+            parsed = true;
+          }
           for (auto *client : this->clients_) {
             if (client->parse_device(device)) {
               found = true;
@@ -167,6 +185,8 @@ void ESP32BLETracker::loop() {
           }
 
           if (!found && !this->scan_continuous_) {
+            if (!parsed)
+              device.parse_scan_rst(scan_result);
             this->print_bt_device_info(device);
           }
         }
@@ -184,6 +204,7 @@ void ESP32BLETracker::loop() {
     size_t dropped = this->scan_results_dropped_.exchange(0, std::memory_order_relaxed);
     if (dropped > 0) {
       ESP_LOGW(TAG, "Dropped %zu BLE scan results due to buffer overflow", dropped);
+      this->report_backpressure();
     }
   }
   if (this->scanner_state_ == ScannerState::STOPPED) {
@@ -367,17 +388,91 @@ void ESP32BLETracker::register_client(ESPBTClient *client) {
 void ESP32BLETracker::register_listener(ESPBTDeviceListener *listener) {
   listener->set_parent(this);
   this->listeners_.push_back(listener);
+  this->listener_index_valid_ = false;
   this->recalculate_advertisement_parser_types();
 }
 
+void ESPBTDeviceListener::add_address_filter(uint64_t address) {
+  this->address_filters_.push_back(address);
+  if (this->parent_ != nullptr)
+    this->parent_->invalidate_listener_index();
+}
+
+void ESPBTDeviceListener::set_service_data_uuid_filter(uint16_t uuid) {
+  this->service_data_uuid_filter_ = uuid;
+  if (this->parent_ != nullptr)
+    this->parent_->invalidate_listener_index();
+}
+
+#ifdef USE_ESP32_BLE_DEVICE
+void ESP32BLETracker::rebuild_listener_index_() {
+  this->unfiltered_listeners_.clear();
+  this->address_index_.clear();
+  this->service_data_listeners_.clear();
+  for (auto *listener : this->listeners_) {
+    if (!listener->get_address_filters().empty()) {
+      for (uint64_t address : listener->get_address_filters())
+        this->address_index_.emplace_back(address, listener);
+    } else if (listener->get_service_data_uuid_filter() != 0) {
+      this->service_data_listeners_.push_back(listener);
+    } else {
+      this->unfiltered_listeners_.push_back(listener);
+    }
+  }
+  std::sort(this->address_index_.begin(), this->address_index_.end(),
+            [](const std::pair<uint64_t, ESPBTDeviceListener *> &a,
+               const std::pair<uint64_t, ESPBTDeviceListener *> &b) { return a.first < b.first; });
+  this->listener_index_valid_ = true;
+}
+
+bool ESP32BLETracker::dispatch_scan_result_(const BLEScanResult &scan_result, ESPBTDevice &device, bool &parsed) {
+  bool found = false;
+  const ESPBTDeviceView view(scan_result);
+  auto deliver = [&](ESPBTDeviceListener *listener) {
+    if (listener->get_advertisement_parser_type() == AdvertisementParserType::VIEW_ADVERTISEMENTS) {
+      if (listener->parse_device_view(view))
+        found = true;
+      return;
+    }
+    if (!parsed) {
+      device.parse_scan_rst(scan_result);
+      parsed = true;
+    }
+    if (listener->parse_device(device))
+      found = true;
+  };
+
+  for (auto *listener : this->unfiltered_listeners_)
+    deliver(listener);
+
+  if (!this->address_index_.empty()) {
+    const uint64_t address = esp32_ble::ble_addr_to_uint64(scan_result.bda);
+    auto it = std::lower_bound(
+        this->address_index_.begin(), this->address_index_.end(), address,
+        [](const std::pair<uint64_t, ESPBTDeviceListener *> &entry, uint64_t value) { return entry.first < value; });
+    for (; it != this->address_index_.end() && it->first == address; ++it)
+      deliver(it->second);
+  }
+
+  for (auto *listener : this->service_data_listeners_) {
+    const uint8_t *data;
+    uint8_t len;
+    if (view.get_service_data(ESPBTUUID::from_uint16(listener->get_service_data_uuid_filter()), &data, &len))
+      deliver(listener);
+  }
+  return found;
+}
+#endif  // USE_ESP32_BLE_DEVICE
+
 void ESP32BLETracker::recalculate_advertisement_parser_types() {
   this->raw_advertisements_ = false;
   this->parse_advertisements_ = false;
   for (auto *listener : this->listeners_) {
-    if (listener->get_advertisement_parser_type() == AdvertisementParserType::PARSED_ADVERTISEMENTS) {
-      this->parse_advertisements_ = true;
-    } else {
+    if (listener->get_advertisement_parser_type() == AdvertisementParserType::RAW_ADVERTISEMENTS) {
       this->raw_advertisements_ = true;
+    } else {
+      // Views are handed out from the same per-result loop as parsed devices
+      this->parse_advertisements_ = true;
     }
   }
   for (auto *client : this->clients_) {
@@ -409,49 +504,56 @@ void ESP32BLETracker::gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_ga
   }
 }
 
-void ESP32BLETracker::gap_scan_event_handler(const BLEScanResult &scan_result) {
-  ESP_LOGV(TAG, "gap_scan_result - event %d", scan_result.search_evt);
-
-  if (scan_result.search_evt == ESP_GAP_SEARCH_INQ_RES_EVT) {
-    // Lock-free SPSC ring buffer write (Producer side)
-    // This runs in the ESP-IDF Bluetooth stack callback thread
-    // IMPORTANT: Only this thread writes to ring_write_index_
-
-    // Load our own index with relaxed ordering (we're the only writer)
-    uint8_t write_idx = this->ring_write_index_.load(std::memory_order_relaxed);
-    uint8_t next_write_idx = (write_idx + 1) % SCAN_RESULT_BUFFER_SIZE;
-
-    // Load consumer's index with acquire to see their latest updates
-    uint8_t read_idx = this->ring_read_index_.load(std::memory_order_acquire);
+void ESP32BLETracker::gap_scan_event_handler(const BLEScanResult *scan_results, size_t count) {
+  // Lock-free SPSC ring buffer write (Producer side)
+  // IMPORTANT: Only this method writes to ring_write_index_
+
+  // Load our own index with relaxed ordering (we're the only writer)
+  uint8_t write_idx = this->ring_write_index_.load(std::memory_order_relaxed);
+  // Load consumer's index with acquire to see their latest updates
+  uint8_t read_idx = this->ring_read_index_.load(std::memory_order_acquire);
+
+  for (size_t i = 0; i < count; i++) {
+    const BLEScanResult &scan_result = scan_results[i];
+    ESP_LOGV(TAG, "gap_scan_result - event %d", scan_result.search_evt);
+
+    if (scan_result.search_evt == ESP_GAP_SEARCH_INQ_RES_EVT) {
+      uint8_t next_write_idx = (write_idx + 1) % SCAN_RESULT_BUFFER_SIZE;
+      // Check if buffer is full
+      if (next_write_idx != read_idx) {
+        this->scan_ring_buffer_[write_idx] = scan_result;
+        write_idx = next_write_idx;
+      } else {
+        // Buffer full, track dropped results
+        this->scan_results_dropped_.fetch_add(1, std::memory_order_relaxed);
+      }
+    } else if (scan_result.search_evt == ESP_GAP_SEARCH_INQ_CMPL_EVT) {
+      // Publish the results of this scan before it is marked as stopped
+      this->ring_write_index_.store(write_idx, std::memory_order_release);
+      this->gap_scan_inquiry_complete_();
+    }
+  }
 
-    // Check if buffer is full
-    if (next_write_idx != read_idx) {
-      // Write to ring buffer
-      this->scan_ring_buffer_[write_idx] = scan_result;
+  // Store with release to ensure the writes are visible before index update
+  this->ring_write_index_.store(write_idx, std::memory_order_release);
+}
 
-      // Store with release to ensure the write is visible before index update
-      this->ring_write_index_.store(next_write_idx, std::memory_order_release);
-    } else {
-      // Buffer full, track dropped results
-      this->scan_results_dropped_.fetch_add(1, std::memory_order_relaxed);
-    }
-  } else if (scan_result.search_evt == ESP_GAP_SEARCH_INQ_CMPL_EVT) {
-    // Scan finished on its own
-    if (this->scanner_state_ != ScannerState::RUNNING) {
-      if (this->scanner_state_ == ScannerState::STOPPING) {
-        ESP_LOGE(TAG, "Scan was not running when scan completed.");
-      } else if (this->scanner_state_ == ScannerState::STARTING) {
-        ESP_LOGE(TAG, "Scan was not started when scan completed.");
-      } else if (this->scanner_state_ == ScannerState::FAILED) {
-        ESP_LOGE(TAG, "Scan was in failed state when scan completed.");
-      } else if (this->scanner_state_ == ScannerState::IDLE) {
-        ESP_LOGE(TAG, "Scan was idle when scan completed.");
-      } else if (this->scanner_state_ == ScannerState::STOPPED) {
-        ESP_LOGE(TAG, "Scan was stopped when scan completed.");
-      }
+void ESP32BLETracker::gap_scan_inquiry_complete_() {
+  // Scan finished on its own
+  if (this->scanner_state_ != ScannerState::RUNNING) {
+    if (this->scanner_state_ == ScannerState::STOPPING) {
+      ESP_LOGE(TAG, "Scan was not running when scan completed.");
+    } else if (this->scanner_state_ == ScannerState::STARTING) {
+      ESP_LOGE(TAG, "Scan was not started when scan completed.");
+    } else if (this->scanner_state_ == ScannerState::FAILED) {
+      ESP_LOGE(TAG, "Scan was in failed state when scan completed.");
+    } else if (this->scanner_state_ == ScannerState::IDLE) {
+      ESP_LOGE(TAG, "Scan was idle when scan completed.");
+    } else if (this->scanner_state_ == ScannerState::STOPPED) {
+      ESP_LOGE(TAG, "Scan was stopped when scan completed.");
     }
-    this->set_scanner_state_(ScannerState::STOPPED);
   }
+  this->set_scanner_state_(ScannerState::STOPPED);
 }
 
 void ESP32BLETracker::gap_scan_set_param_complete_(const esp_ble_gap_cb_param_t::ble_scan_param_cmpl_evt_param &param) {
@@ -516,10 +618,146 @@ void ESP32BLETracker::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_i
 }
 
 void ESP32BLETracker::set_scanner_state_(ScannerState state) {
+#ifdef USE_ESP32_BLE_ADAPTIVE_SCAN
+  if (state == ScannerState::RUNNING && this->scanner_state_ != ScannerState::RUNNING) {
+    this->running_since_ = millis();
+  } else if (state != ScannerState::RUNNING && this->scanner_state_ == ScannerState::RUNNING) {
+    this->scan_time_ += millis() - this->running_since_;
+  }
+#endif
   this->scanner_state_ = state;
   this->scanner_state_callbacks_.call(state);
 }
 
+#ifdef USE_ESP32_BLE_ADAPTIVE_SCAN
+uint32_t ESP32BLETracker::take_scan_time_() {
+  const uint32_t now = millis();
+  if (this->scanner_state_ == ScannerState::RUNNING) {
+    this->scan_time_ += now - this->running_since_;
+    this->running_since_ = now;
+  }
+  uint32_t scan_time = this->scan_time_;
+  this->scan_time_ = 0;
+
+  // Within a running scan the radio listens for one window per interval
+  uint32_t elapsed = now - this->duty_cycle_updated_;
+  this->duty_cycle_updated_ = now;
+  if (elapsed != 0) {
+    this->duty_cycle_ = 100.0f * scan_time / elapsed * this->scan_window_ / this->scan_interval_;
+  }
+  return scan_time;
+}
+
+void ESP32BLETracker::adapt_scan_window_() {
+  uint32_t scan_time = this->take_scan_time_();
+  uint32_t advertisements = this->adapt_advertisements_;
+  uint16_t backpressure = this->backpressure_events_;
+  this->adapt_advertisements_ = 0;
+  this->backpressure_events_ = 0;
+
+  ESP_LOGV(TAG, "Scanned %" PRIu32 " ms, %" PRIu32 " advertisements, %u backpressure events, duty cycle %.1f%%",
+           scan_time, advertisements, backpressure, this->duty_cycle_);
+
+  // Give the window away quickly when advertisements can't be delivered (the API socket is not draining or
+  // WiFi is starved of airtime), win it back slowly once things are calm. Growing only helps if there are
+  // advertisements to be heard.
+  uint32_t window = this->scan_window_;
+  if (backpressure != 0) {
+    this->calm_periods_ = 0;
+    if (++this->pressured_periods_ >= SHRINK_AFTER_PERIODS) {
+      this->pressured_periods_ = 0;
+      window = std::max(this->min_scan_window_, window / 2);
+    }
+  } else if (scan_time != 0) {
+    this->pressured_periods_ = 0;
+    if (++this->calm_periods_ >= GROW_AFTER_PERIODS) {
+      this->calm_periods_ = 0;
+      if (advertisements != 0)
+        window = std::min(this->max_scan_window_, window + this->min_scan_window_);
+    }
+  }
+  if (window == this->scan_window_)
+    return;
+
+  ESP_LOGD(TAG, "Scan window %.1f ms -> %.1f ms (duty cycle %.1f%%)", this->scan_window_ * 0.625f, window * 0.625f,
+           this->duty_cycle_);
+  this->scan_window_ = window;
+  // The parameters only apply to a new scan, restart it if it would otherwise run on for minutes
+  if (this->scanner_state_ == ScannerState::RUNNING && this->scan_continuous_)
+    this->stop_scan_();
+}
+#endif
+
+bool ESPBTDeviceView::get_service_data(const ESPBTUUID &uuid, const uint8_t **data, uint8_t *len) const {
+  bool found = false;
+  this->for_each_record([&](const ESPBTAdvRecord &record) {
+    uint8_t uuid_len;
+    ESPBTUUID record_uuid;
+    if (record.type == ESP_BLE_AD_TYPE_SERVICE_DATA && record.length >= 2) {
+      uuid_len = 2;
+      record_uuid = ESPBTUUID::from_uint16(encode_uint16(record.data[1], record.data[0]));
+    } else if (record.type == ESP_BLE_AD_TYPE_32SERVICE_DATA && record.length >= 4) {
+      uuid_len = 4;
+      record_uuid =
+          ESPBTUUID::from_uint32(encode_uint32(record.data[3], record.data[2], record.data[1], record.data[0]));
+    } else if (record.type == ESP_BLE_AD_TYPE_128SERVICE_DATA && record.length >= 16) {
+      uuid_len = 16;
+      record_uuid = ESPBTUUID::from_raw(record.data);
+    } else {
+      return true;
+    }
+    if (record_uuid != uuid)
+      return true;
+    *data = record.data + uuid_len;
+    *len = record.length - uuid_len;
+    found = true;
+    return false;
+  });
+  return found;
+}
+
+bool ESPBTDeviceView::get_manufacturer_data(const ESPBTUUID &uuid, const uint8_t **data, uint8_t *len) const {
+  bool found = false;
+  this->for_each_record([&](const ESPBTAdvRecord &record) {
+    if (record.type != ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE || record.length < 2 ||
+        ESPBTUUID::from_uint16(encode_uint16(record.data[1], record.data[0])) != uuid)
+      return true;
+    *data = record.data + 2;
+    *len = record.length - 2;
+    found = true;
+    return false;
+  });
+  return found;
+}
+
+bool ESPBTDeviceView::has_service_uuid(const ESPBTUUID &uuid) const {
+  bool found = false;
+  this->for_each_record([&](const ESPBTAdvRecord &record) {
+    switch (record.type) {
+      case ESP_BLE_AD_TYPE_16SRV_CMPL:
+      case ESP_BLE_AD_TYPE_16SRV_PART:
+        for (uint8_t i = 0; i + 2 <= record.length; i += 2)
+          found |= ESPBTUUID::from_uint16(encode_uint16(record.data[i + 1], record.data[i])) == uuid;
+        break;
+      case ESP_BLE_AD_TYPE_32SRV_CMPL:
+      case ESP_BLE_AD_TYPE_32SRV_PART:
+        for (uint8_t i = 0; i + 4 <= record.length; i += 4) {
+          found |= ESPBTUUID::from_uint32(encode_uint32(record.data[i + 3], record.data[i + 2], record.data[i + 1],
+                                                        record.data[i])) == uuid;
+        }
+        break;
+      case ESP_BLE_AD_TYPE_128SRV_CMPL:
+      case ESP_BLE_AD_TYPE_128SRV_PART:
+        found |= record.length >= 16 && ESPBTUUID::from_raw(record.data) == uuid;
+        break;
+      default:
+        break;
+    }
+    return !found;
+  });
+  return found;
+}
+
 #ifdef USE_ESP32_BLE_DEVICE
 ESPBLEiBeacon::ESPBLEiBeacon(const uint8_t *data) { memcpy(&this->beacon_data_, data, sizeof(beacon_data_)); }
 optional<ESPBLEiBeacon> ESPBLEiBeacon::from_manufacturer_data(const ServiceData &data) {
@@ -538,9 +776,10 @@ void ESPBTDevice::parse_scan_rst(const BLEScanResult &scan_result) {
   this->address_type_ = static_cast<esp_ble_addr_type_t>(scan_result.ble_addr_type);
   this->rssi_ = scan_result.rssi;
 
-  // Parse advertisement data directly
-  uint8_t total_len = scan_result.adv_data_len + scan_result.scan_rsp_len;
-  this->parse_adv_(scan_result.ble_adv, total_len);
+  ESPBTDeviceView(scan_result).for_each_record([this](const ESPBTAdvRecord &record) {
+    this->parse_record_(record);
+    return true;
+  });
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
   ESP_LOGVV(TAG, "Parse Result:");
@@ -603,161 +842,150 @@ void ESPBTDevice::parse_scan_rst(const BLEScanResult &scan_result) {
 #endif
 }
 
-void ESPBTDevice::parse_adv_(const uint8_t *payload, uint8_t len) {
-  size_t offset = 0;
-
-  while (offset + 2 < len) {
-    const uint8_t field_length = payload[offset++];  // First byte is length of adv record
-    if (field_length == 0) {
-      continue;  // Possible zero padded advertisement data
-    }
-
-    // first byte of adv record is adv record type
-    const uint8_t record_type = payload[offset++];
-    const uint8_t *record = &payload[offset];
-    const uint8_t record_length = field_length - 1;
-    offset += record_length;
-
-    // See also Generic Access Profile Assigned Numbers:
-    // https://www.bluetooth.com/specifications/assigned-numbers/generic-access-profile/ See also ADVERTISING AND SCAN
-    // RESPONSE DATA FORMAT: https://www.bluetooth.com/specifications/bluetooth-core-specification/ (vol 3, part C, 11)
-    // See also Core Specification Supplement: https://www.bluetooth.com/specifications/bluetooth-core-specification/
-    // (called CSS here)
-
-    switch (record_type) {
-      case ESP_BLE_AD_TYPE_NAME_SHORT:
-      case ESP_BLE_AD_TYPE_NAME_CMPL: {
-        // CSS 1.2 LOCAL NAME
-        // "The Local Name data type shall be the same as, or a shortened version of, the local name assigned to the
-        // device." CSS 1: Optional in this context; shall not appear more than once in a block.
-        // SHORTENED LOCAL NAME
-        // "The Shortened Local Name data type defines a shortened version of the Local Name data type. The Shortened
-        // Local Name data type shall not be used to advertise a name that is longer than the Local Name data type."
-        if (record_length > this->name_.length()) {
-          this->name_ = std::string(reinterpret_cast<const char *>(record), record_length);
-        }
-        break;
+void ESPBTDevice::parse_record_(const ESPBTAdvRecord &adv_record) {
+  const uint8_t record_type = adv_record.type;
+  const uint8_t *record = adv_record.data;
+  const uint8_t record_length = adv_record.length;
+
+  // See also Generic Access Profile Assigned Numbers:
+  // https://www.bluetooth.com/specifications/assigned-numbers/generic-access-profile/ See also ADVERTISING AND SCAN
+  // RESPONSE DATA FORMAT: https://www.bluetooth.com/specifications/bluetooth-core-specification/ (vol 3, part C, 11)
+  // See also Core Specification Supplement: https://www.bluetooth.com/specifications/bluetooth-core-specification/
+  // (called CSS here)
+
+  switch (record_type) {
+    case ESP_BLE_AD_TYPE_NAME_SHORT:
+    case ESP_BLE_AD_TYPE_NAME_CMPL: {
+      // CSS 1.2 LOCAL NAME
+      // "The Local Name data type shall be the same as, or a shortened version of, the local name assigned to the
+      // device." CSS 1: Optional in this context; shall not appear more than once in a block.
+      // SHORTENED LOCAL NAME
+      // "The Shortened Local Name data type defines a shortened version of the Local Name data type. The Shortened
+      // Local Name data type shall not be used to advertise a name that is longer than the Local Name data type."
+      if (record_length > this->name_.length()) {
+        this->name_ = std::string(reinterpret_cast<const char *>(record), record_length);
       }
-      case ESP_BLE_AD_TYPE_TX_PWR: {
-        // CSS 1.5 TX POWER LEVEL
-        // "The TX Power Level data type indicates the transmitted power level of the packet containing the data type."
-        // CSS 1: Optional in this context (may appear more than once in a block).
-        this->tx_powers_.push_back(*payload);
-        break;
-      }
-      case ESP_BLE_AD_TYPE_APPEARANCE: {
-        // CSS 1.12 APPEARANCE
-        // "The Appearance data type defines the external appearance of the device."
-        // See also https://www.bluetooth.com/specifications/gatt/characteristics/
-        // CSS 1: Optional in this context; shall not appear more than once in a block and shall not appear in both
-        // the AD and SRD of the same extended advertising interval.
-        this->appearance_ = *reinterpret_cast<const uint16_t *>(record);
-        break;
-      }
-      case ESP_BLE_AD_TYPE_FLAG: {
-        // CSS 1.3 FLAGS
-        // "The Flags data type contains one bit Boolean flags. The Flags data type shall be included when any of the
-        // Flag bits are non-zero and the advertising packet is connectable, otherwise the Flags data type may be
-        // omitted."
-        // CSS 1: Optional in this context; shall not appear more than once in a block.
-        this->ad_flag_ = *record;
-        break;
-      }
-      // CSS 1.1 SERVICE UUID
-      // The Service UUID data type is used to include a list of Service or Service Class UUIDs.
-      // There are six data types defined for the three sizes of Service UUIDs that may be returned:
+      break;
+    }
+    case ESP_BLE_AD_TYPE_TX_PWR: {
+      // CSS 1.5 TX POWER LEVEL
+      // "The TX Power Level data type indicates the transmitted power level of the packet containing the data type."
       // CSS 1: Optional in this context (may appear more than once in a block).
-      case ESP_BLE_AD_TYPE_16SRV_CMPL:
-      case ESP_BLE_AD_TYPE_16SRV_PART: {
-        // • 16-bit Bluetooth Service UUIDs
-        for (uint8_t i = 0; i < record_length / 2; i++) {
-          this->service_uuids_.push_back(ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record + 2 * i)));
-        }
-        break;
-      }
-      case ESP_BLE_AD_TYPE_32SRV_CMPL:
-      case ESP_BLE_AD_TYPE_32SRV_PART: {
-        // • 32-bit Bluetooth Service UUIDs
-        for (uint8_t i = 0; i < record_length / 4; i++) {
-          this->service_uuids_.push_back(ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record + 4 * i)));
-        }
-        break;
-      }
-      case ESP_BLE_AD_TYPE_128SRV_CMPL:
-      case ESP_BLE_AD_TYPE_128SRV_PART: {
-        // • Global 128-bit Service UUIDs
-        this->service_uuids_.push_back(ESPBTUUID::from_raw(record));
-        break;
+      this->tx_powers_.push_back(*record);
+      break;
+    }
+    case ESP_BLE_AD_TYPE_APPEARANCE: {
+      // CSS 1.12 APPEARANCE
+      // "The Appearance data type defines the external appearance of the device."
+      // See also https://www.bluetooth.com/specifications/gatt/characteristics/
+      // CSS 1: Optional in this context; shall not appear more than once in a block and shall not appear in both
+      // the AD and SRD of the same extended advertising interval.
+      this->appearance_ = *reinterpret_cast<const uint16_t *>(record);
+      break;
+    }
+    case ESP_BLE_AD_TYPE_FLAG: {
+      // CSS 1.3 FLAGS
+      // "The Flags data type contains one bit Boolean flags. The Flags data type shall be included when any of the
+      // Flag bits are non-zero and the advertising packet is connectable, otherwise the Flags data type may be
+      // omitted."
+      // CSS 1: Optional in this context; shall not appear more than once in a block.
+      this->ad_flag_ = *record;
+      break;
+    }
+    // CSS 1.1 SERVICE UUID
+    // The Service UUID data type is used to include a list of Service or Service Class UUIDs.
+    // There are six data types defined for the three sizes of Service UUIDs that may be returned:
+    // CSS 1: Optional in this context (may appear more than once in a block).
+    case ESP_BLE_AD_TYPE_16SRV_CMPL:
+    case ESP_BLE_AD_TYPE_16SRV_PART: {
+      // • 16-bit Bluetooth Service UUIDs
+      for (uint8_t i = 0; i < record_length / 2; i++) {
+        this->service_uuids_.push_back(ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record + 2 * i)));
       }
-      case ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE: {
-        // CSS 1.4 MANUFACTURER SPECIFIC DATA
-        // "The Manufacturer Specific data type is used for manufacturer specific data. The first two data octets shall
-        // contain a company identifier from Assigned Numbers. The interpretation of any other octets within the data
-        // shall be defined by the manufacturer specified by the company identifier."
-        // CSS 1: Optional in this context (may appear more than once in a block).
-        if (record_length < 2) {
-          ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE");
-          break;
-        }
-        ServiceData data{};
-        data.uuid = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
-        data.data.assign(record + 2UL, record + record_length);
-        this->manufacturer_datas_.push_back(data);
-        break;
+      break;
+    }
+    case ESP_BLE_AD_TYPE_32SRV_CMPL:
+    case ESP_BLE_AD_TYPE_32SRV_PART: {
+      // • 32-bit Bluetooth Service UUIDs
+      for (uint8_t i = 0; i < record_length / 4; i++) {
+        this->service_uuids_.push_back(ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record + 4 * i)));
       }
-
-      // CSS 1.11 SERVICE DATA
-      // "The Service Data data type consists of a service UUID with the data associated with that service."
+      break;
+    }
+    case ESP_BLE_AD_TYPE_128SRV_CMPL:
+    case ESP_BLE_AD_TYPE_128SRV_PART: {
+      // • Global 128-bit Service UUIDs
+      this->service_uuids_.push_back(ESPBTUUID::from_raw(record));
+      break;
+    }
+    case ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE: {
+      // CSS 1.4 MANUFACTURER SPECIFIC DATA
+      // "The Manufacturer Specific data type is used for manufacturer specific data. The first two data octets shall
+      // contain a company identifier from Assigned Numbers. The interpretation of any other octets within the data
+      // shall be defined by the manufacturer specified by the company identifier."
       // CSS 1: Optional in this context (may appear more than once in a block).
-      case ESP_BLE_AD_TYPE_SERVICE_DATA: {
-        // «Service Data - 16 bit UUID»
-        // Size: 2 or more octets
-        // The first 2 octets contain the 16 bit Service UUID fol- lowed by additional service data
-        if (record_length < 2) {
-          ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_SERVICE_DATA");
-          break;
-        }
-        ServiceData data{};
-        data.uuid = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
-        data.data.assign(record + 2UL, record + record_length);
-        this->service_datas_.push_back(data);
+      if (record_length < 2) {
+        ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE");
         break;
       }
-      case ESP_BLE_AD_TYPE_32SERVICE_DATA: {
-        // «Service Data - 32 bit UUID»
-        // Size: 4 or more octets
-        // The first 4 octets contain the 32 bit Service UUID fol- lowed by additional service data
-        if (record_length < 4) {
-          ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_32SERVICE_DATA");
-          break;
-        }
-        ServiceData data{};
-        data.uuid = ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record));
-        data.data.assign(record + 4UL, record + record_length);
-        this->service_datas_.push_back(data);
+      ServiceData data{};
+      data.uuid = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
+      data.data.assign(record + 2UL, record + record_length);
+      this->manufacturer_datas_.push_back(data);
+      break;
+    }
+
+    // CSS 1.11 SERVICE DATA
+    // "The Service Data data type consists of a service UUID with the data associated with that service."
+    // CSS 1: Optional in this context (may appear more than once in a block).
+    case ESP_BLE_AD_TYPE_SERVICE_DATA: {
+      // «Service Data - 16 bit UUID»
+      // Size: 2 or more octets
+      // The first 2 octets contain the 16 bit Service UUID fol- lowed by additional service data
+      if (record_length < 2) {
+        ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_SERVICE_DATA");
         break;
       }
-      case ESP_BLE_AD_TYPE_128SERVICE_DATA: {
-        // «Service Data - 128 bit UUID»
-        // Size: 16 or more octets
-        // The first 16 octets contain the 128 bit Service UUID followed by additional service data
-        if (record_length < 16) {
-          ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_128SERVICE_DATA");
-          break;
-        }
-        ServiceData data{};
-        data.uuid = ESPBTUUID::from_raw(record);
-        data.data.assign(record + 16UL, record + record_length);
-        this->service_datas_.push_back(data);
+      ServiceData data{};
+      data.uuid = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
+      data.data.assign(record + 2UL, record + record_length);
+      this->service_datas_.push_back(data);
+      break;
+    }
+    case ESP_BLE_AD_TYPE_32SERVICE_DATA: {
+      // «Service Data - 32 bit UUID»
+      // Size: 4 or more octets
+      // The first 4 octets contain the 32 bit Service UUID fol- lowed by additional service data
+      if (record_length < 4) {
+        ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_32SERVICE_DATA");
         break;
       }
-      case ESP_BLE_AD_TYPE_INT_RANGE:
-        // Avoid logging this as it's very verbose
-        break;
-      default: {
-        ESP_LOGV(TAG, "Unhandled type: advType: 0x%02x", record_type);
+      ServiceData data{};
+      data.uuid = ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record));
+      data.data.assign(record + 4UL, record + record_length);
+      this->service_datas_.push_back(data);
+      break;
+    }
+    case ESP_BLE_AD_TYPE_128SERVICE_DATA: {
+      // «Service Data - 128 bit UUID»
+      // Size: 16 or more octets
+      // The first 16 octets contain the 128 bit Service UUID followed by additional service data
+      if (record_length < 16) {
+        ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_128SERVICE_DATA");
         break;
       }
+      ServiceData data{};
+      data.uuid = ESPBTUUID::from_raw(record);
+      data.data.assign(record + 16UL, record + record_length);
+      this->service_datas_.push_back(data);
+      break;
+    }
+    case ESP_BLE_AD_TYPE_INT_RANGE:
+      // Avoid logging this as it's very verbose
+      break;
+    default: {
+      ESP_LOGV(TAG, "Unhandled type: advType: 0x%02x", record_type);
+      break;
     }
   }
 }
@@ -782,6 +1010,10 @@ void ESP32BLETracker::dump_config() {
                 "  Continuous Scanning: %s",
                 this->scan_duration_, this->scan_interval_ * 0.625f, this->scan_window_ * 0.625f,
                 this->scan_active_ ? "ACTIVE" : "PASSIVE", YESNO(this->scan_continuous_));
+#ifdef USE_ESP32_BLE_ADAPTIVE_SCAN
+  ESP_LOGCONFIG(TAG, "  Adaptive Scan Window: %.1f - %.1f ms", this->min_scan_window_ * 0.625f,
+                this->max_scan_window_ * 0.625f);
+#endif
   switch (this->scanner_state_) {
     case ScannerState::IDLE:
       ESP_LOGCONFIG(TAG, "  Scanner State: IDLE");
@@ -812,11 +1044,8 @@ void ESP32BLETracker::dump_config() {
 #ifdef USE_ESP32_BLE_DEVICE
 void ESP32BLETracker::print_bt_device_info(const ESPBTDevice &device) {
   const uint64_t address = device.address_uint64();
-  for (auto &disc : this->already_discovered_) {
-    if (disc == address)
-      return;
-  }
-  this->already_discovered_.push_back(address);
+  if (this->already_discovered_.check_and_insert(address))
+    return;
 
   ESP_LOGD(TAG, "Found device %s RSSI=%d", device.address_str().c_str(), device.get_rssi());
 
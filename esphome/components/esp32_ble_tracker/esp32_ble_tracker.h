@@ -8,6 +8,7 @@
 #include <array>
 #include <atomic>
 #include <string>
+#include <utility>
 #include <vector>
 
 #ifdef USE_ESP32
@@ -32,6 +33,8 @@ using adv_data_t = std::vector<uint8_t>;
 enum AdvertisementParserType {
   PARSED_ADVERTISEMENTS,
   RAW_ADVERTISEMENTS,
+  /// Advertisements are passed to parse_device_view() without parsing them into an ESPBTDevice.
+  VIEW_ADVERTISEMENTS,
 };
 
 struct ServiceData {
@@ -39,6 +42,106 @@ struct ServiceData {
   adv_data_t data;
 };
 
+/** Fixed-size set of recently seen BLE addresses.
+ *
+ * Open addressing with a bounded probe window: when the window is full, the address seen least recently in it is
+ * replaced. Lookups are O(1) and memory stays the same however many (randomized) addresses pass by. The 48-bit
+ * address shares a slot with a 16-bit last-seen stamp.
+ */
+template<size_t N> class RecentAddressSet {
+  static_assert(N != 0 && (N & (N - 1)) == 0, "N must be a power of two");
+
+ public:
+  /// Mark \p address as seen, returns true if it already was.
+  bool check_and_insert(uint64_t address) {
+    address &= ADDRESS_MASK;
+    const uint16_t stamp = ++this->clock_;
+    size_t index = static_cast<size_t>((address * 0x9E3779B97F4A7C15ULL) >> 32) & (N - 1);
+    size_t victim = index;
+    uint16_t victim_age = 0;
+    for (size_t i = 0; i < PROBE_LIMIT; i++, index = (index + 1) & (N - 1)) {
+      uint64_t &slot = this->slots_[index];
+      if (slot == 0) {
+        // Addresses are never removed one by one, so nothing is stored past an empty slot
+        slot = address | (uint64_t(stamp) << 48);
+        return false;
+      }
+      if ((slot & ADDRESS_MASK) == address) {
+        slot = address | (uint64_t(stamp) << 48);
+        return true;
+      }
+      const uint16_t age = stamp - uint16_t(slot >> 48);
+      if (age > victim_age) {
+        victim = index;
+        victim_age = age;
+      }
+    }
+    this->slots_[victim] = address | (uint64_t(stamp) << 48);
+    return false;
+  }
+
+  void clear() { this->slots_.fill(0); }
+
+ protected:
+  static constexpr uint64_t ADDRESS_MASK = 0xFFFFFFFFFFFFULL;
+  static constexpr size_t PROBE_LIMIT = N < 8 ? N : 8;
+
+  std::array<uint64_t, N> slots_{};
+  uint16_t clock_{0};
+};
+
+/// One AD structure of an advertisement, pointing into the scan result it came from.
+struct ESPBTAdvRecord {
+  uint8_t type;
+  uint8_t length;
+  const uint8_t *data;
+};
+
+/** Non-owning view of a scan result.
+ *
+ * Reads the AD structures in place, so looking for one piece of data needs no heap allocation. The view is only valid
+ * as long as the scan result it was made from, ESPBTDevice::parse_scan_rst() copies everything out of it instead.
+ */
+class ESPBTDeviceView {
+ public:
+  explicit ESPBTDeviceView(const BLEScanResult &scan_result) : scan_result_(scan_result) {}
+
+  uint64_t address_uint64() const { return esp32_ble::ble_addr_to_uint64(this->scan_result_.bda); }
+  const uint8_t *address() const { return this->scan_result_.bda; }
+  esp_ble_addr_type_t get_address_type() const {
+    return static_cast<esp_ble_addr_type_t>(this->scan_result_.ble_addr_type);
+  }
+  int get_rssi() const { return this->scan_result_.rssi; }
+  const BLEScanResult &get_scan_result() const { return this->scan_result_; }
+
+  /// Call \p callback with every AD structure in the advertisement and scan response, until it returns false.
+  template<typename F> void for_each_record(F &&callback) const {
+    const uint8_t *payload = this->scan_result_.ble_adv;
+    const size_t len = this->scan_result_.adv_data_len + this->scan_result_.scan_rsp_len;
+    size_t offset = 0;
+    while (offset + 2 < len) {
+      const uint8_t field_length = payload[offset++];  // First byte is length of adv record
+      if (field_length == 0)
+        continue;  // Possible zero padded advertisement data
+      if (offset + field_length > len)
+        return;  // Truncated record
+      const ESPBTAdvRecord record{payload[offset], static_cast<uint8_t>(field_length - 1), &payload[offset + 1]};
+      offset += field_length;
+      if (!callback(record))
+        return;
+    }
+  }
+
+  /// Find the service data for \p uuid, \p data and \p len are set to the data after the UUID.
+  bool get_service_data(const ESPBTUUID &uuid, const uint8_t **data, uint8_t *len) const;
+  /// Find the manufacturer data for \p uuid, \p data and \p len are set to the data after the company identifier.
+  bool get_manufacturer_data(const ESPBTUUID &uuid, const uint8_t **data, uint8_t *len) const;
+  bool has_service_uuid(const ESPBTUUID &uuid) const;
+
+ protected:
+  const BLEScanResult &scan_result_;
+};
+
 #ifdef USE_ESP32_BLE_DEVICE
 class ESPBLEiBeacon {
  public:
@@ -101,7 +204,7 @@ class ESPBTDevice {
   }
 
  protected:
-  void parse_adv_(const uint8_t *payload, uint8_t len);
+  void parse_record_(const ESPBTAdvRecord &record);
 
   esp_bd_addr_t address_{
       0,
@@ -126,6 +229,8 @@ class ESPBTDeviceListener {
   virtual void on_scan_end() {}
 #ifdef USE_ESP32_BLE_DEVICE
   virtual bool parse_device(const ESPBTDevice &device) = 0;
+  /// Called instead of parse_device() for listeners returning VIEW_ADVERTISEMENTS as their parser type.
+  virtual bool parse_device_view(const ESPBTDeviceView &view) { return false; }
 #endif
   virtual bool parse_devices(const BLEScanResult *scan_results, size_t count) { return false; };
   virtual AdvertisementParserType get_advertisement_parser_type() {
@@ -133,8 +238,22 @@ class ESPBTDeviceListener {
   };
   void set_parent(ESP32BLETracker *parent) { parent_ = parent; }
 
+  /** Only pass advertisements from \p address to parse_device().
+   *
+   * Listeners without filters see every advertisement. The tracker looks filtered listeners up by address, and only
+   * parses an advertisement into an ESPBTDevice if some listener wants it.
+   */
+  void add_address_filter(uint64_t address);
+  /// Only pass advertisements carrying service data for this 16-bit UUID to parse_device(), unless address filters
+  /// are set too, those take precedence.
+  void set_service_data_uuid_filter(uint16_t uuid);
+  const std::vector<uint64_t> &get_address_filters() const { return this->address_filters_; }
+  uint16_t get_service_data_uuid_filter() const { return this->service_data_uuid_filter_; }
+
  protected:
   ESP32BLETracker *parent_{nullptr};
+  std::vector<uint64_t> address_filters_;
+  uint16_t service_data_uuid_filter_{0};
 };
 
 enum class ClientState : uint8_t {
@@ -229,6 +348,18 @@ class ESP32BLETracker : public Component,
   void set_scan_active(bool scan_active) { scan_active_ = scan_active; }
   bool get_scan_active() const { return scan_active_; }
   void set_scan_continuous(bool scan_continuous) { scan_continuous_ = scan_continuous; }
+#ifdef USE_ESP32_BLE_ADAPTIVE_SCAN
+  /// Let the scan window float between these bounds (in 0.625ms units) depending on load.
+  void set_adaptive_window(uint32_t min_window, uint32_t max_window) {
+    this->min_scan_window_ = min_window;
+    this->max_scan_window_ = max_window;
+  }
+  /// Fraction of time the radio spent scanning over the last adaptation period, in percent.
+  float get_duty_cycle() const { return this->duty_cycle_; }
+  uint32_t get_current_scan_window() const { return this->scan_window_; }
+#endif
+  /// Let the tracker know a consumer of advertisements could not keep up, for example because its socket is full.
+  void report_backpressure() { this->backpressure_events_++; }
 
   /// Setup the FreeRTOS task and the Bluetooth stack.
   void setup() override;
@@ -240,6 +371,8 @@ class ESP32BLETracker : public Component,
   void register_listener(ESPBTDeviceListener *listener);
   void register_client(ESPBTClient *client);
   void recalculate_advertisement_parser_types();
+  /// Rebuild the listener routing index before the next advertisement is processed.
+  void invalidate_listener_index() { this->listener_index_valid_ = false; }
 
 #ifdef USE_ESP32_BLE_DEVICE
   void print_bt_device_info(const ESPBTDevice &device);
@@ -251,7 +384,7 @@ class ESP32BLETracker : public Component,
   void gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if,
                            esp_ble_gattc_cb_param_t *param) override;
   void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) override;
-  void gap_scan_event_handler(const BLEScanResult &scan_result) override;
+  void gap_scan_event_handler(const BLEScanResult *scan_results, size_t count) override;
   void ble_before_disabled_event_handler() override;
 
   void add_scanner_state_callback(std::function<void(ScannerState)> &&callback) {
@@ -265,8 +398,8 @@ class ESP32BLETracker : public Component,
   void start_scan_(bool first);
   /// Called when a scan ends
   void end_of_scan_();
-  /// Called when a `ESP_GAP_BLE_SCAN_RESULT_EVT` event is received.
-  void gap_scan_result_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
+  /// Called when a scan result reports that the scan has ended.
+  void gap_scan_inquiry_complete_();
   /// Called when a `ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT` event is received.
   void gap_scan_set_param_complete_(const esp_ble_gap_cb_param_t::ble_scan_param_cmpl_evt_param &param);
   /// Called when a `ESP_GAP_BLE_SCAN_START_COMPLETE_EVT` event is received.
@@ -275,12 +408,32 @@ class ESP32BLETracker : public Component,
   void gap_scan_stop_complete_(const esp_ble_gap_cb_param_t::ble_scan_stop_cmpl_evt_param &param);
   /// Called to set the scanner state. Will also call callbacks to let listeners know when state is changed.
   void set_scanner_state_(ScannerState state);
+#ifdef USE_ESP32_BLE_ADAPTIVE_SCAN
+  /// Scanning time accumulated since the last call in ms, also updates the duty cycle.
+  uint32_t take_scan_time_();
+  /// Shrink or grow the scan window from the load seen since the last call.
+  void adapt_scan_window_();
+#endif
+#ifdef USE_ESP32_BLE_DEVICE
+  void rebuild_listener_index_();
+  /// Pass a scan result to the listeners interested in it, returns true if any of them handled it.
+  bool dispatch_scan_result_(const BLEScanResult &scan_result, ESPBTDevice &device, bool &parsed);
+#endif
 
   uint8_t app_id_{0};
 
-  /// Vector of addresses that have already been printed in print_bt_device_info
-  std::vector<uint64_t> already_discovered_;
+  /// Addresses that have already been printed in print_bt_device_info
+  RecentAddressSet<128> already_discovered_;
   std::vector<ESPBTDeviceListener *> listeners_;
+#ifdef USE_ESP32_BLE_DEVICE
+  /// Listeners without filters, they see every advertisement.
+  std::vector<ESPBTDeviceListener *> unfiltered_listeners_;
+  /// Listeners with address filters, sorted by address.
+  std::vector<std::pair<uint64_t, ESPBTDeviceListener *>> address_index_;
+  /// Listeners with only a service data UUID filter.
+  std::vector<ESPBTDeviceListener *> service_data_listeners_;
+#endif
+  bool listener_index_valid_{false};
   /// Client parameters.
   std::vector<ESPBTClient *> clients_;
   /// A structure holding the ESP BLE scan parameters.
@@ -289,6 +442,19 @@ class ESP32BLETracker : public Component,
   uint32_t scan_duration_;
   uint32_t scan_interval_;
   uint32_t scan_window_;
+#ifdef USE_ESP32_BLE_ADAPTIVE_SCAN
+  uint32_t min_scan_window_;
+  uint32_t max_scan_window_;
+  /// Advertisements received since the last adaptation.
+  uint32_t adapt_advertisements_{0};
+  uint32_t running_since_{0};
+  uint32_t scan_time_{0};
+  uint32_t duty_cycle_updated_{0};
+  float duty_cycle_{0.0f};
+  uint8_t pressured_periods_{0};
+  uint8_t calm_periods_{0};
+#endif
+  uint16_t backpressure_events_{0};
   uint8_t scan_start_fail_count_{0};
   bool scan_continuous_;
   bool scan_active_;
@@ -299,9 +465,9 @@ class ESP32BLETracker : public Component,
   bool parse_advertisements_{false};
 
   // Lock-free Single-Producer Single-Consumer (SPSC) ring buffer for scan results
-  // Producer: ESP-IDF Bluetooth stack callback (gap_scan_event_handler)
+  // Producer: scan result batches from ESP32BLE (gap_scan_event_handler)
   // Consumer: ESPHome main loop (loop() method)
-  // This design ensures zero blocking in the BT callback and prevents scan result loss
+  // Keeps the results of a scan until loop() can process them with the current client states
   BLEScanResult *scan_ring_buffer_;
   std::atomic<uint8_t> ring_write_index_{0};       // Written only by BT callback (producer)
   std::atomic<uint8_t> ring_read_index_{0};        // Written only by main loop (consumer)
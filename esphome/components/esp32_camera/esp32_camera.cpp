@@ -7,6 +7,9 @@
 
 #include <freertos/task.h>
 
+#include <algorithm>
+#include <cinttypes>
+
 namespace esphome {
 namespace esp32_camera {
 
@@ -188,6 +191,10 @@ void ESP32Camera::loop() {
   }
   if (now - this->last_update_ <= this->max_update_interval_)
     return;
+  // Capture only as fast as the fastest requester wants images
+  const uint8_t due = this->due_requesters_(now);
+  if (due == 0)
+    return;
 
   // request new image
   camera_fb_t *fb;
@@ -202,12 +209,39 @@ void ESP32Camera::loop() {
     xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
     return;
   }
-  this->current_image_ = std::make_shared<ESP32CameraImage>(fb, this->single_requesters_ | this->stream_requesters_);
+  // Every requester gets the same frame buffer, the streams that aren't due skip this one
+  this->current_image_ = std::make_shared<ESP32CameraImage>(fb, due);
 
   ESP_LOGD(TAG, "Got Image: len=%u", fb->len);
   this->new_image_callback_.call(this->current_image_);
   this->last_update_ = now;
-  this->single_requesters_ = 0;
+  this->single_requesters_ &= ~due;
+
+  for (uint8_t i = 0; i < this->requester_stats_.size(); i++) {
+    if ((due & (1U << i)) == 0)
+      continue;
+    auto &stats = this->requester_stats_[i];
+    if ((this->stream_requesters_ & (1U << i)) != 0 && stats.delivered != 0) {
+      // Count the frames the stream should have had since the previous one
+      const uint32_t period = std::max(stats.update_interval, this->max_update_interval_ + 1);
+      const uint32_t missed = (now - stats.last_delivery) / period;
+      if (missed > 1)
+        stats.dropped += missed - 1;
+    }
+    stats.delivered++;
+    stats.last_delivery = now;
+  }
+}
+
+uint8_t ESP32Camera::due_requesters_(uint32_t now) const {
+  uint8_t due = this->single_requesters_;
+  for (uint8_t i = 0; i < this->requester_stats_.size(); i++) {
+    const auto &stats = this->requester_stats_[i];
+    if ((this->stream_requesters_ & (1U << i)) != 0 &&
+        (stats.delivered == 0 || now - stats.last_delivery >= stats.update_interval))
+      due |= 1U << i;
+  }
+  return due;
 }
 
 float ESP32Camera::get_setup_priority() const { return setup_priority::DATA; }
@@ -368,12 +402,25 @@ void ESP32Camera::add_stream_stop_callback(std::function<void()> &&callback) {
 }
 void ESP32Camera::start_stream(camera::CameraRequester requester) {
   this->stream_start_callback_.call();
+  if ((this->stream_requesters_ & (1U << requester)) == 0) {
+    auto &stats = this->requester_stats_[requester];
+    stats.delivered = 0;
+    stats.dropped = 0;
+  }
   this->stream_requesters_ |= (1U << requester);
 }
 void ESP32Camera::stop_stream(camera::CameraRequester requester) {
   this->stream_stop_callback_.call();
+  if ((this->stream_requesters_ & (1U << requester)) != 0) {
+    const auto &stats = this->requester_stats_[requester];
+    ESP_LOGD(TAG, "Stream %u stopped: %" PRIu32 " frames delivered, %" PRIu32 " dropped", requester, stats.delivered,
+             stats.dropped);
+  }
   this->stream_requesters_ &= ~(1U << requester);
 }
+void ESP32Camera::set_requester_update_interval(camera::CameraRequester requester, uint32_t interval) {
+  this->requester_stats_[requester].update_interval = interval;
+}
 void ESP32Camera::request_image(camera::CameraRequester requester) { this->single_requesters_ |= (1U << requester); }
 camera::CameraImageReader *ESP32Camera::create_image_reader() { return new ESP32CameraImageReader; }
 void ESP32Camera::update_camera_parameters() {
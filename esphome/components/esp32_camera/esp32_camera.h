@@ -163,6 +163,7 @@ class ESP32Camera : public camera::Camera {
   void start_stream(camera::CameraRequester requester) override;
   void stop_stream(camera::CameraRequester requester) override;
   void request_image(camera::CameraRequester requester) override;
+  void set_requester_update_interval(camera::CameraRequester requester, uint32_t interval) override;
   void update_camera_parameters();
 
   void add_image_callback(std::function<void(std::shared_ptr<camera::CameraImage>)> &&callback) override;
@@ -174,6 +175,8 @@ class ESP32Camera : public camera::Camera {
   /* internal methods */
   bool has_requested_image_() const;
   bool can_return_image_() const;
+  /// Requesters that want the next captured image: all single requests and the streams whose interval passed.
+  uint8_t due_requesters_(uint32_t now) const;
 
   static void framebuffer_task(void *pv);
 
@@ -208,6 +211,14 @@ class ESP32Camera : public camera::Camera {
   std::shared_ptr<ESP32CameraImage> current_image_;
   uint8_t single_requesters_{0};
   uint8_t stream_requesters_{0};
+  /// Frame rate limit and delivery counters of every requester, the captured frame is shared between them.
+  struct RequesterStats {
+    uint32_t update_interval{0};
+    uint32_t last_delivery{0};
+    uint32_t delivered{0};
+    uint32_t dropped{0};
+  };
+  std::array<RequesterStats, camera::WEB_REQUESTER + 1> requester_stats_{};
   QueueHandle_t framebuffer_get_queue_;
   QueueHandle_t framebuffer_return_queue_;
   CallbackManager<void(std::shared_ptr<camera::CameraImage>)> new_image_callback_{};
@@ -13,11 +13,16 @@ Mode = esp32_camera_web_server_ns.enum("Mode")
 
 MODES = {"STREAM": Mode.STREAM, "SNAPSHOT": Mode.SNAPSHOT}
 
+CONF_MAX_FRAMERATE = "max_framerate"
+
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(CameraWebServer),
         cv.Required(CONF_PORT): cv.port,
         cv.Required(CONF_MODE): cv.enum(MODES, upper=True),
+        cv.Optional(CONF_MAX_FRAMERATE): cv.All(
+            cv.framerate, cv.Range(min=0, min_included=False, max=60)
+        ),
     },
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -26,4 +31,6 @@ async def to_code(config):
     server = cg.new_Pvariable(config[CONF_ID])
     cg.add(server.set_port(config[CONF_PORT]))
     cg.add(server.set_mode(config[CONF_MODE]))
+    if CONF_MAX_FRAMERATE in config:
+        cg.add(server.set_max_update_interval(1000 / config[CONF_MAX_FRAMERATE]))
     await cg.register_component(server, config)
@@ -46,6 +46,8 @@ void CameraWebServer::setup() {
   }
 
   this->semaphore_ = xSemaphoreCreateBinary();
+  if (this->max_update_interval_ != 0)
+    camera::Camera::instance()->set_requester_update_interval(camera::WEB_REQUESTER, this->max_update_interval_);
 
   httpd_config_t config = HTTPD_DEFAULT_CONFIG();
   config.server_port = this->port_;
@@ -91,6 +93,8 @@ void CameraWebServer::dump_config() {
                 this->port_);
   if (this->mode_ == STREAM) {
     ESP_LOGCONFIG(TAG, "  Mode: stream");
+    if (this->max_update_interval_ != 0)
+      ESP_LOGCONFIG(TAG, "  Max Framerate: %.1f fps", 1000.0f / this->max_update_interval_);
   } else {
     ESP_LOGCONFIG(TAG, "  Mode: snapshot");
   }
@@ -29,6 +29,7 @@ class CameraWebServer : public Component {
   float get_setup_priority() const override;
   void set_port(uint16_t port) { this->port_ = port; }
   void set_mode(Mode mode) { this->mode_ = mode; }
+  void set_max_update_interval(uint32_t max_update_interval) { this->max_update_interval_ = max_update_interval; }
   void loop() override;
 
  protected:
@@ -38,6 +39,7 @@ class CameraWebServer : public Component {
   esp_err_t snapshot_handler_(struct httpd_req *req);
 
   uint16_t port_{0};
+  uint32_t max_update_interval_{0};
   void *httpd_{nullptr};
   SemaphoreHandle_t semaphore_;
   std::shared_ptr<camera::CameraImage> image_;
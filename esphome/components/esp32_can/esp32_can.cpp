@@ -4,6 +4,8 @@
 
 #include <driver/twai.h>
 
+#include <vector>
+
 // WORKAROUND, because CAN_IO_UNUSED is just defined as (-1) in this version
 // of the framework which does not work with -fpermissive
 #undef CAN_IO_UNUSED
@@ -66,6 +68,33 @@ static bool get_bitrate(canbus::CanSpeed bitrate, twai_timing_config_t *t_config
   }
 }
 
+// Single filter mode puts a standard identifier in bits 31-21 and an extended one in bits 31-3
+static const uint8_t STD_ID_SHIFT = 21;
+static const uint8_t EXT_ID_SHIFT = 3;
+
+static twai_filter_config_t get_filter(const std::vector<canbus::CanFilter> &filters) {
+  twai_filter_config_t f_config = get_filter(this->get_rx_filters_());
+  if (filters.empty())
+    return f_config;
+  // The filter matches one frame format, both are needed with triggers for both
+  for (const auto &filter : filters) {
+    if (filter.use_extended_id != filters[0].use_extended_id) {
+      ESP_LOGW(TAG, "Hardware filter accepts all frames, triggers use standard and extended identifiers");
+      return f_config;
+    }
+  }
+  // Only the identifier bits all filters agree on are compared
+  uint32_t mask = filters[0].can_id_mask;
+  for (const auto &filter : filters)
+    mask &= filter.can_id_mask & ~(filter.can_id ^ filters[0].can_id);
+  const uint8_t shift = filters[0].use_extended_id ? EXT_ID_SHIFT : STD_ID_SHIFT;
+  f_config.acceptance_code = (filters[0].can_id & mask) << shift;
+  // set bits of the acceptance mask are ignored, so are RTR and the data bytes of standard frames
+  f_config.acceptance_mask = ~(mask << shift);
+  f_config.single_filter = true;
+  return f_config;
+}
+
 bool ESP32Can::setup_internal() {
   twai_general_config_t g_config =
       TWAI_GENERAL_CONFIG_DEFAULT((gpio_num_t) this->tx_, (gpio_num_t) this->rx_, TWAI_MODE_NORMAL);
@@ -135,6 +164,7 @@ canbus::Error ESP32Can::read_message(struct canbus::CanFrame *frame) {
   twai_message_t message;
 
   if (twai_receive(&message, 0) != ESP_OK) {
+    this->count_rx_overflows_();
     return canbus::ERROR_NOMSG;
   }
 
@@ -152,6 +182,16 @@ canbus::Error ESP32Can::read_message(struct canbus::CanFrame *frame) {
   return canbus::ERROR_OK;
 }
 
+void ESP32Can::count_rx_overflows_() {
+  twai_status_info_t status;
+  if (twai_get_status_info(&status) != ESP_OK)
+    return;
+  // The driver counts frames dropped with its queue full and frames the hardware FIFO overran on
+  this->add_rx_overflows_((status.rx_missed_count - this->rx_missed_) + (status.rx_overrun_count - this->rx_overrun_));
+  this->rx_missed_ = status.rx_missed_count;
+  this->rx_overrun_ = status.rx_overrun_count;
+}
+
 }  // namespace esp32_can
 }  // namespace esphome
 
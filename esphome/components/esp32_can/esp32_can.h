@@ -23,12 +23,16 @@ class ESP32Can : public canbus::Canbus {
   bool setup_internal() override;
   canbus::Error send_message(struct canbus::CanFrame *frame) override;
   canbus::Error read_message(struct canbus::CanFrame *frame) override;
+  void count_rx_overflows_();
 
   int rx_{-1};
   int tx_{-1};
   TickType_t tx_enqueue_timeout_ticks_{};
   optional<uint32_t> tx_queue_len_{};
   optional<uint32_t> rx_queue_len_{};
+  // driver counters of lost frames last added to the overflows
+  uint32_t rx_missed_{0};
+  uint32_t rx_overrun_{0};
 };
 
 }  // namespace esp32_can
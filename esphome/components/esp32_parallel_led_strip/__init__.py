@@ -0,0 +1,90 @@
+from dataclasses import dataclass
+
+from esphome import pins
+import esphome.codegen as cg
+from esphome.components.esp32 import const, only_on_variant
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_CHIPSET,
+    CONF_CLOCK_PIN,
+    CONF_DATA_PINS,
+    CONF_DC_PIN,
+    CONF_ID,
+    CONF_RESET_DURATION,
+)
+
+DEPENDENCIES = ["esp32"]
+MULTI_CONF = True
+
+CONF_PARALLEL_LED_STRIP_ID = "parallel_led_strip_id"
+
+esp32_parallel_led_strip_ns = cg.esphome_ns.namespace("esp32_parallel_led_strip")
+ParallelLEDStripBus = esp32_parallel_led_strip_ns.class_(
+    "ParallelLEDStripBus", cg.Component
+)
+
+
+@dataclass
+class BusTimings:
+    # Each bit is sent as `slots` bus clocks of `slot_ns`; a 0 is high for the first
+    # `bit0_slots` of them, a 1 for the first `bit1_slots`.
+    slot_ns: int
+    slots: int
+    bit0_slots: int
+    bit1_slots: int
+
+
+CHIPSETS = {
+    "WS2811": BusTimings(312, 4, 1, 2),
+    "WS2812": BusTimings(417, 3, 1, 2),
+    "SK6812": BusTimings(300, 4, 1, 2),
+    "APA106": BusTimings(340, 5, 1, 4),
+    "SM16703": BusTimings(300, 4, 1, 3),
+}
+
+
+def _validate_data_pins(value):
+    value = cv.ensure_list(pins.internal_gpio_output_pin_number)(value)
+    if len(value) not in (8, 16):
+        raise cv.Invalid("The parallel bus needs exactly 8 or 16 data pins")
+    if len(set(value)) != len(value):
+        raise cv.Invalid("Data pins must be unique")
+    return value
+
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(ParallelLEDStripBus),
+            cv.Required(CONF_DATA_PINS): _validate_data_pins,
+            cv.Required(CONF_CLOCK_PIN): pins.internal_gpio_output_pin_number,
+            # The LCD peripheral always drives a D/C line, the strips ignore it
+            cv.Required(CONF_DC_PIN): pins.internal_gpio_output_pin_number,
+            cv.Optional(CONF_CHIPSET, default="WS2812"): cv.one_of(
+                *CHIPSETS, upper=True
+            ),
+            cv.Optional(
+                CONF_RESET_DURATION, default="300us"
+            ): cv.positive_time_period_microseconds,
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    only_on_variant(supported=[const.VARIANT_ESP32S3]),
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    for pin in config[CONF_DATA_PINS]:
+        cg.add(var.add_data_pin(pin))
+    cg.add(var.set_clock_pin(config[CONF_CLOCK_PIN]))
+    cg.add(var.set_dc_pin(config[CONF_DC_PIN]))
+
+    timings = CHIPSETS[config[CONF_CHIPSET]]
+    cg.add(
+        var.set_timings(
+            timings.slot_ns, timings.slots, timings.bit0_slots, timings.bit1_slots
+        )
+    )
+    cg.add(var.set_reset_us(config[CONF_RESET_DURATION]))
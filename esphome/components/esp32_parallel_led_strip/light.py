@@ -0,0 +1,84 @@
+import esphome.codegen as cg
+from esphome.components import light
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_CHANNEL,
+    CONF_DATA_PINS,
+    CONF_IS_RGBW,
+    CONF_NUM_LEDS,
+    CONF_OUTPUT_ID,
+    CONF_RGB_ORDER,
+)
+import esphome.final_validate as fv
+
+from . import (
+    CONF_PARALLEL_LED_STRIP_ID,
+    ParallelLEDStripBus,
+    esp32_parallel_led_strip_ns,
+)
+
+DEPENDENCIES = ["esp32_parallel_led_strip"]
+
+CONF_IS_WRGB = "is_wrgb"
+
+ParallelLEDStripLightOutput = esp32_parallel_led_strip_ns.class_(
+    "ParallelLEDStripLightOutput", light.AddressableLight
+)
+
+RGBOrder = esp32_parallel_led_strip_ns.enum("RGBOrder")
+
+RGB_ORDERS = {
+    "RGB": RGBOrder.ORDER_RGB,
+    "RBG": RGBOrder.ORDER_RBG,
+    "GRB": RGBOrder.ORDER_GRB,
+    "GBR": RGBOrder.ORDER_GBR,
+    "BGR": RGBOrder.ORDER_BGR,
+    "BRG": RGBOrder.ORDER_BRG,
+}
+
+CONFIG_SCHEMA = cv.All(
+    light.ADDRESSABLE_LIGHT_SCHEMA.extend(
+        {
+            cv.GenerateID(CONF_OUTPUT_ID): cv.declare_id(ParallelLEDStripLightOutput),
+            cv.GenerateID(CONF_PARALLEL_LED_STRIP_ID): cv.use_id(ParallelLEDStripBus),
+            cv.Required(CONF_CHANNEL): cv.int_range(min=0, max=15),
+            cv.Required(CONF_NUM_LEDS): cv.positive_not_null_int,
+            cv.Required(CONF_RGB_ORDER): cv.enum(RGB_ORDERS, upper=True),
+            cv.Optional(CONF_IS_RGBW, default=False): cv.boolean,
+            cv.Optional(CONF_IS_WRGB, default=False): cv.boolean,
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    cv.has_at_most_one_key(CONF_IS_RGBW, CONF_IS_WRGB),
+)
+
+
+def _final_validate(config):
+    full_config = fv.full_config.get()
+    path = full_config.get_path_for_id(config[CONF_PARALLEL_LED_STRIP_ID])[:-1]
+    bus_config = full_config.get_config_for_path(path)
+    if config[CONF_CHANNEL] >= len(bus_config[CONF_DATA_PINS]):
+        raise cv.Invalid(
+            f"Channel {config[CONF_CHANNEL]} is out of range, the bus only has "
+            f"{len(bus_config[CONF_DATA_PINS])} data pins",
+            path=[CONF_CHANNEL],
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_OUTPUT_ID])
+    await light.register_light(var, config)
+    await cg.register_component(var, config)
+
+    cg.add(var.set_channel(config[CONF_CHANNEL]))
+    cg.add(var.set_num_leds(config[CONF_NUM_LEDS]))
+    cg.add(var.set_rgb_order(config[CONF_RGB_ORDER]))
+    cg.add(var.set_is_rgbw(config[CONF_IS_RGBW]))
+    cg.add(var.set_is_wrgb(config[CONF_IS_WRGB]))
+
+    bus = await cg.get_variable(config[CONF_PARALLEL_LED_STRIP_ID])
+    cg.add(var.set_parent(bus))
+    cg.add(bus.register_strip(var))
@@ -0,0 +1,275 @@
+#include "parallel_led_strip.h"
+
+#ifdef USE_ESP32_VARIANT_ESP32S3
+
+#include "esphome/core/log.h"
+
+#include <esp_attr.h>
+#include <esp_heap_caps.h>
+
+#include <algorithm>
+#include <cinttypes>
+
+namespace esphome {
+namespace esp32_parallel_led_strip {
+
+static const char *const TAG = "esp32_parallel_led_strip";
+
+void ParallelLEDStripBus::setup() {
+  ESP_LOGCONFIG(TAG, "Running setup");
+
+  for (auto *strip : this->strips_) {
+    for (auto *other : this->strips_) {
+      if ((other != strip) && (other->get_channel() == strip->get_channel())) {
+        ESP_LOGE(TAG, "Channel %u is used by more than one strip", strip->get_channel());
+        this->mark_failed();
+        return;
+      }
+    }
+    this->max_bytes_ = std::max(this->max_bytes_, strip->get_buffer_size());
+  }
+
+  const size_t word_size = this->data_pins_.size() / 8;
+  const size_t reset_words = (this->reset_us_ * 1000 + this->slot_ns_ - 1) / this->slot_ns_;
+  this->dma_len_ = (this->max_bytes_ * 8 * this->slots_ + reset_words) * word_size;
+  // Zeroed, so the reset words at the end are already low
+  this->dma_buf_ = static_cast<uint8_t *>(heap_caps_calloc(1, this->dma_len_, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL));
+  if (this->dma_buf_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate %zu bytes of DMA buffer!", this->dma_len_);
+    this->mark_failed();
+    return;
+  }
+
+  esp_lcd_i80_bus_config_t bus_config{};
+  bus_config.clk_src = LCD_CLK_SRC_DEFAULT;
+  bus_config.dc_gpio_num = this->dc_pin_;
+  bus_config.wr_gpio_num = this->clock_pin_;
+  for (size_t i = 0; i < this->data_pins_.size(); i++) {
+    bus_config.data_gpio_nums[i] = this->data_pins_[i];
+  }
+  bus_config.bus_width = this->data_pins_.size();
+  bus_config.max_transfer_bytes = this->dma_len_;
+  if (esp_lcd_new_i80_bus(&bus_config, &this->bus_) != ESP_OK) {
+    ESP_LOGE(TAG, "Bus creation failed");
+    this->mark_failed();
+    return;
+  }
+
+  esp_lcd_panel_io_i80_config_t io_config{};
+  io_config.cs_gpio_num = -1;
+  io_config.pclk_hz = 1000000000UL / this->slot_ns_;
+  io_config.trans_queue_depth = 1;
+  io_config.on_color_trans_done = on_transmit_done_;
+  io_config.user_ctx = this;
+  io_config.lcd_cmd_bits = 8;
+  io_config.lcd_param_bits = 8;
+  io_config.dc_levels.dc_data_level = 1;
+  if (esp_lcd_new_panel_io_i80(this->bus_, &io_config, &this->io_) != ESP_OK) {
+    ESP_LOGE(TAG, "Panel IO creation failed");
+    this->mark_failed();
+    return;
+  }
+
+  if (word_size == 2) {
+    this->prepare_buffer_<uint16_t>();
+  } else {
+    this->prepare_buffer_<uint8_t>();
+  }
+}
+
+template<typename T> void ParallelLEDStripBus::prepare_buffer_() {
+  T *out = reinterpret_cast<T *>(this->dma_buf_);
+  for (size_t pos = 0; pos < this->max_bytes_; pos++) {
+    // Lines of strips that already sent all their bytes stay low
+    T lines = 0;
+    for (auto *strip : this->strips_) {
+      if (pos < strip->get_buffer_size())
+        lines |= T(1) << strip->get_channel();
+    }
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      for (uint8_t slot = 0; slot < this->slots_; slot++) {
+        *out++ = slot < this->bit0_slots_ ? lines : 0;
+      }
+    }
+  }
+}
+
+template<typename T> void HOT ParallelLEDStripBus::encode_() {
+  const uint8_t data_slots = this->bit1_slots_ - this->bit0_slots_;
+  T *out = reinterpret_cast<T *>(this->dma_buf_) + this->bit0_slots_;
+  for (size_t pos = 0; pos < this->max_bytes_; pos++) {
+    // Transpose the byte at this position of every strip into one bus word per bit, most significant bit first
+    T words[8] = {};
+    for (auto *strip : this->strips_) {
+      const uint8_t *buf = strip->get_buffer();
+      if ((buf == nullptr) || (pos >= strip->get_buffer_size()) || (buf[pos] == 0))
+        continue;
+      const T line = T(1) << strip->get_channel();
+      const uint8_t byte = buf[pos];
+      for (uint8_t bit = 0; bit < 8; bit++) {
+        if (byte & (0x80 >> bit))
+          words[bit] |= line;
+      }
+    }
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      for (uint8_t slot = 0; slot < data_slots; slot++) {
+        out[slot] = words[bit];
+      }
+      out += this->slots_;
+    }
+  }
+}
+
+void ParallelLEDStripBus::loop() {
+  if (!this->pending_) {
+    this->disable_loop();
+    return;
+  }
+  // Try again next loop iteration while the previous frame is still on the wire
+  if (this->transmitting_)
+    return;
+  this->pending_ = false;
+
+  const uint32_t start = micros();
+  if (this->data_pins_.size() == 16) {
+    this->encode_<uint16_t>();
+  } else {
+    this->encode_<uint8_t>();
+  }
+  this->last_encode_us_ = micros() - start;
+  ESP_LOGVV(TAG, "Encoded frame in %" PRIu32 " us", this->last_encode_us_);
+
+  this->transmitting_ = true;
+  if (esp_lcd_panel_io_tx_color(this->io_, -1, this->dma_buf_, this->dma_len_) != ESP_OK) {
+    this->transmitting_ = false;
+    ESP_LOGE(TAG, "Transmit failed");
+    this->status_set_warning();
+    return;
+  }
+  this->status_clear_warning();
+}
+
+bool IRAM_ATTR ParallelLEDStripBus::on_transmit_done_(esp_lcd_panel_io_handle_t io,
+                                                      esp_lcd_panel_io_event_data_t *edata, void *user_ctx) {
+  static_cast<ParallelLEDStripBus *>(user_ctx)->transmitting_ = false;
+  return false;
+}
+
+void ParallelLEDStripBus::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "ESP32 Parallel LED Strip Bus:\n"
+                "  Clock Pin: %u\n"
+                "  DC Pin: %u\n"
+                "  Data Lines: %u\n"
+                "  Strips: %u\n"
+                "  Bit: %u slots of %u ns",
+                this->clock_pin_, this->dc_pin_, (unsigned) this->data_pins_.size(), (unsigned) this->strips_.size(),
+                this->slots_, this->slot_ns_);
+  if (this->dma_len_ == 0)
+    return;
+  // The DMA sends a fixed amount of words per frame, so this is the best case regardless of the colors
+  const uint32_t frame_us = this->dma_len_ / (this->data_pins_.size() / 8) * this->slot_ns_ / 1000;
+  ESP_LOGCONFIG(TAG,
+                "  Frame: %zu bytes, %" PRIu32 " us on the wire, up to %" PRIu32 " fps\n"
+                "  Last Encode Time: %" PRIu32 " us",
+                this->dma_len_, frame_us, 1000000 / (frame_us + this->last_encode_us_), this->last_encode_us_);
+}
+
+void ParallelLEDStripLightOutput::setup() {
+  ESP_LOGCONFIG(TAG, "Running setup");
+
+  RAMAllocator<uint8_t> allocator;
+  this->buf_ = allocator.allocate(this->get_buffer_size());
+  if (this->buf_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate LED buffer!");
+    this->mark_failed();
+    return;
+  }
+  memset(this->buf_, 0, this->get_buffer_size());
+
+  this->effect_data_ = allocator.allocate(this->num_leds_);
+  if (this->effect_data_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate effect data!");
+    this->mark_failed();
+    return;
+  }
+}
+
+void ParallelLEDStripLightOutput::write_state(light::LightState *state) {
+  if (!this->frame_changed_())
+    return;
+  this->mark_shown_();
+  // All strips on the bus go out together, so several strips changing in one loop iteration share one frame
+  this->parent_->schedule_transmit();
+}
+
+light::ESPBufferLayout ParallelLEDStripLightOutput::get_buffer_layout_() const {
+  light::ESPBufferLayout layout;
+  layout.buffer = this->buf_;
+  switch (this->rgb_order_) {
+    case ORDER_RGB:
+      layout.red = 0;
+      layout.green = 1;
+      layout.blue = 2;
+      break;
+    case ORDER_RBG:
+      layout.red = 0;
+      layout.green = 2;
+      layout.blue = 1;
+      break;
+    case ORDER_GRB:
+      layout.red = 1;
+      layout.green = 0;
+      layout.blue = 2;
+      break;
+    case ORDER_GBR:
+      layout.red = 2;
+      layout.green = 0;
+      layout.blue = 1;
+      break;
+    case ORDER_BGR:
+      layout.red = 2;
+      layout.green = 1;
+      layout.blue = 0;
+      break;
+    case ORDER_BRG:
+      layout.red = 1;
+      layout.green = 2;
+      layout.blue = 0;
+      break;
+  }
+  layout.stride = this->is_rgbw_ || this->is_wrgb_ ? 4 : 3;
+  if (this->is_wrgb_) {
+    layout.red++;
+    layout.green++;
+    layout.blue++;
+    layout.white = 0;
+  } else if (this->is_rgbw_) {
+    layout.white = 3;
+  }
+  return layout;
+}
+
+light::ESPColorView ParallelLEDStripLightOutput::get_view_internal(int32_t index) const {
+  const light::ESPBufferLayout layout = this->get_buffer_layout_();
+  uint8_t *led = this->buf_ + index * layout.stride;
+  return {led + layout.red,
+          led + layout.green,
+          led + layout.blue,
+          layout.white >= 0 ? led + layout.white : nullptr,
+          &this->effect_data_[index],
+          &this->correction_};
+}
+
+void ParallelLEDStripLightOutput::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "ESP32 Parallel LED Strip:\n"
+                "  Channel: %u\n"
+                "  Number of LEDs: %u",
+                this->channel_, this->num_leds_);
+}
+
+}  // namespace esp32_parallel_led_strip
+}  // namespace esphome
+
+#endif  // USE_ESP32_VARIANT_ESP32S3
@@ -0,0 +1,144 @@
+#pragma once
+
+// The LCD_CAM peripheral's i80 mode is only available on ESP32-S3
+#ifdef USE_ESP32_VARIANT_ESP32S3
+
+#include "esphome/components/light/addressable_light.h"
+#include "esphome/components/light/light_output.h"
+#include "esphome/core/color.h"
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+#include <esp_lcd_panel_io.h>
+
+#include <atomic>
+#include <vector>
+
+namespace esphome {
+namespace esp32_parallel_led_strip {
+
+enum RGBOrder : uint8_t {
+  ORDER_RGB,
+  ORDER_RBG,
+  ORDER_GRB,
+  ORDER_GBR,
+  ORDER_BGR,
+  ORDER_BRG,
+};
+
+class ParallelLEDStripLightOutput;
+
+class ParallelLEDStripBus : public Component {
+  /*
+   * @brief Clocks up to 16 LED strips out at once, one strip per data line of the LCD peripheral.
+   *
+   * Every bit of the strips is sent as a few bus words: the first words are high on the lines of all strips, the
+   * middle words only on the lines of strips sending a 1 and the last words low. Only the middle words depend on the
+   * colors, so the other words are written once at setup and each frame only fills in the middle ones. A frame then
+   * takes as long on the wire as the longest strip and the DMA sends it without the CPU.
+   */
+ public:
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::HARDWARE; }
+
+  void add_data_pin(uint8_t pin) { this->data_pins_.push_back(pin); }
+  void set_clock_pin(uint8_t pin) { this->clock_pin_ = pin; }
+  void set_dc_pin(uint8_t pin) { this->dc_pin_ = pin; }
+  void set_timings(uint16_t slot_ns, uint8_t slots, uint8_t bit0_slots, uint8_t bit1_slots) {
+    this->slot_ns_ = slot_ns;
+    this->slots_ = slots;
+    this->bit0_slots_ = bit0_slots;
+    this->bit1_slots_ = bit1_slots;
+  }
+  void set_reset_us(uint32_t reset_us) { this->reset_us_ = reset_us; }
+
+  void register_strip(ParallelLEDStripLightOutput *strip) { this->strips_.push_back(strip); }
+
+  /// @brief Sends all strips again once the frame on the wire is done
+  void schedule_transmit() {
+    this->pending_ = true;
+    this->enable_loop();
+  }
+
+ protected:
+  static bool on_transmit_done_(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx);
+
+  template<typename T> void prepare_buffer_();
+  template<typename T> void encode_();
+
+  std::vector<uint8_t> data_pins_;
+  std::vector<ParallelLEDStripLightOutput *> strips_;
+  uint8_t clock_pin_;
+  uint8_t dc_pin_;
+
+  uint16_t slot_ns_{417};
+  uint8_t slots_{3};
+  uint8_t bit0_slots_{1};
+  uint8_t bit1_slots_{2};
+  uint32_t reset_us_{300};
+
+  esp_lcd_i80_bus_handle_t bus_{nullptr};
+  esp_lcd_panel_io_handle_t io_{nullptr};
+  uint8_t *dma_buf_{nullptr};
+  size_t dma_len_{0};
+  size_t max_bytes_{0};  // Bytes of the longest strip
+
+  bool pending_{false};
+  std::atomic<bool> transmitting_{false};
+  uint32_t last_encode_us_{0};
+};
+
+class ParallelLEDStripLightOutput : public light::AddressableLight, public Parented<ParallelLEDStripBus> {
+ public:
+  void setup() override;
+  void write_state(light::LightState *state) override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::HARDWARE; }
+
+  int32_t size() const override { return this->num_leds_; }
+  light::LightTraits get_traits() override {
+    auto traits = light::LightTraits();
+    if (this->is_rgbw_ || this->is_wrgb_) {
+      traits.set_supported_color_modes({light::ColorMode::RGB_WHITE, light::ColorMode::WHITE});
+    } else {
+      traits.set_supported_color_modes({light::ColorMode::RGB});
+    }
+    return traits;
+  }
+
+  void set_channel(uint8_t channel) { this->channel_ = channel; }
+  void set_num_leds(uint16_t num_leds) { this->num_leds_ = num_leds; }
+  void set_is_rgbw(bool is_rgbw) { this->is_rgbw_ = is_rgbw; }
+  void set_is_wrgb(bool is_wrgb) { this->is_wrgb_ = is_wrgb; }
+  void set_rgb_order(RGBOrder rgb_order) { this->rgb_order_ = rgb_order; }
+
+  void clear_effect_data() override {
+    for (int i = 0; i < this->size(); i++)
+      this->effect_data_[i] = 0;
+  }
+
+  uint8_t get_channel() const { return this->channel_; }
+  size_t get_buffer_size() const { return this->num_leds_ * (this->is_rgbw_ || this->is_wrgb_ ? 4 : 3); }
+  /// @brief The bytes to send in wire order, nullptr if setup failed
+  const uint8_t *get_buffer() const { return this->buf_; }
+
+ protected:
+  light::ESPColorView get_view_internal(int32_t index) const override;
+  light::ESPBufferLayout get_buffer_layout_() const override;
+
+  uint8_t *buf_{nullptr};
+  uint8_t *effect_data_{nullptr};
+  uint8_t channel_;
+  uint16_t num_leds_;
+  bool is_rgbw_{false};
+  bool is_wrgb_{false};
+
+  RGBOrder rgb_order_{ORDER_RGB};
+};
+
+}  // namespace esp32_parallel_led_strip
+}  // namespace esphome
+
+#endif  // USE_ESP32_VARIANT_ESP32S3
@@ -63,7 +63,7 @@ void ESP32RMTLEDStripLightOutput::setup() {
 
   size_t buffer_size = this->get_buffer_size_();
 
-  RAMAllocator<uint8_t> allocator(this->use_psram_ ? 0 : RAMAllocator<uint8_t>::ALLOC_INTERNAL);
+  RAMAllocator<uint8_t> allocator(this->use_psram_ ? 0 : RAMAllocator<uint8_t>::ALLOC_INTERNAL, "led strip buffer");
   this->buf_ = allocator.allocate(buffer_size);
   if (this->buf_ == nullptr) {
     ESP_LOGE(TAG, "Cannot allocate LED buffer!");
@@ -157,10 +157,15 @@ void ESP32RMTLEDStripLightOutput::set_led_params(uint32_t bit0_high, uint32_t bi
 }
 
 void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
+  // Unchanged frames are not sent, so they neither refresh the strip nor count against the refresh rate
+  if (!this->frame_changed_())
+    return;
+
   // protect from refreshing too often
   uint32_t now = micros();
   if (*this->max_refresh_rate_ != 0 && (now - this->last_refresh_) < *this->max_refresh_rate_) {
     // try again next loop iteration, so that this change won't get lost
+    this->invalidate_frame_();
     this->schedule_show();
     return;
   }
@@ -172,6 +177,7 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
   esp_err_t error = rmt_tx_wait_all_done(this->channel_, 1000);
   if (error != ESP_OK) {
     ESP_LOGE(TAG, "RMT TX timeout");
+    this->invalidate_frame_();
     this->status_set_warning();
     return;
   }
@@ -213,53 +219,67 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
 #endif
   if (error != ESP_OK) {
     ESP_LOGE(TAG, "RMT TX error");
+    this->invalidate_frame_();
     this->status_set_warning();
     return;
   }
   this->status_clear_warning();
 }
 
-light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index) const {
-  int32_t r = 0, g = 0, b = 0;
+light::ESPBufferLayout ESP32RMTLEDStripLightOutput::get_buffer_layout_() const {
+  light::ESPBufferLayout layout;
+  layout.buffer = this->buf_;
   switch (this->rgb_order_) {
     case ORDER_RGB:
-      r = 0;
-      g = 1;
-      b = 2;
+      layout.red = 0;
+      layout.green = 1;
+      layout.blue = 2;
       break;
     case ORDER_RBG:
-      r = 0;
-      g = 2;
-      b = 1;
+      layout.red = 0;
+      layout.green = 2;
+      layout.blue = 1;
       break;
     case ORDER_GRB:
-      r = 1;
-      g = 0;
-      b = 2;
+      layout.red = 1;
+      layout.green = 0;
+      layout.blue = 2;
       break;
     case ORDER_GBR:
-      r = 2;
-      g = 0;
-      b = 1;
+      layout.red = 2;
+      layout.green = 0;
+      layout.blue = 1;
       break;
     case ORDER_BGR:
-      r = 2;
-      g = 1;
-      b = 0;
+      layout.red = 2;
+      layout.green = 1;
+      layout.blue = 0;
       break;
     case ORDER_BRG:
-      r = 1;
-      g = 2;
-      b = 0;
+      layout.red = 1;
+      layout.green = 2;
+      layout.blue = 0;
       break;
   }
-  uint8_t multiplier = this->is_rgbw_ || this->is_wrgb_ ? 4 : 3;
-  uint8_t white = this->is_wrgb_ ? 0 : 3;
+  layout.stride = this->is_rgbw_ || this->is_wrgb_ ? 4 : 3;
+  if (this->is_wrgb_) {
+    layout.red++;
+    layout.green++;
+    layout.blue++;
+    layout.white = 0;
+  } else if (this->is_rgbw_) {
+    layout.white = 3;
+  }
+  return layout;
+}
 
-  return {this->buf_ + (index * multiplier) + r + this->is_wrgb_,
-          this->buf_ + (index * multiplier) + g + this->is_wrgb_,
-          this->buf_ + (index * multiplier) + b + this->is_wrgb_,
-          this->is_rgbw_ || this->is_wrgb_ ? this->buf_ + (index * multiplier) + white : nullptr,
+light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index) const {
+  const light::ESPBufferLayout layout = this->get_buffer_layout_();
+  uint8_t *led = this->buf_ + index * layout.stride;
+  return {led + layout.red,
+          led + layout.green,
+          led + layout.blue,
+          layout.white >= 0 ? led + layout.white : nullptr,
           &this->effect_data_[index],
           &this->correction_};
 }
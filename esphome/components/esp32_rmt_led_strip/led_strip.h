@@ -73,6 +73,7 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override;
+  light::ESPBufferLayout get_buffer_layout_() const override;
 
   size_t get_buffer_size_() const { return this->num_leds_ * (this->is_rgbw_ || this->is_wrgb_ ? 4 : 3); }
 
@@ -160,18 +160,31 @@ ARDUINO_FRAMEWORK_SCHEMA = cv.All(
 
 
 BUILD_FLASH_MODES = ["qio", "qout", "dio", "dout"]
+CONF_RTC_CACHE = "rtc_cache"
+
+
+def _validate_rtc_cache(config):
+    if config[CONF_RTC_CACHE] and not config[CONF_RESTORE_FROM_FLASH]:
+        raise cv.Invalid(
+            f"'{CONF_RTC_CACHE}' requires '{CONF_RESTORE_FROM_FLASH}' to be enabled"
+        )
+    return config
+
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
             cv.Required(CONF_BOARD): cv.string_strict,
             cv.Optional(CONF_FRAMEWORK, default={}): ARDUINO_FRAMEWORK_SCHEMA,
             cv.Optional(CONF_RESTORE_FROM_FLASH, default=False): cv.boolean,
+            cv.Optional(CONF_RTC_CACHE, default=False): cv.boolean,
             cv.Optional(CONF_EARLY_PIN_INIT, default=True): cv.boolean,
             cv.Optional(CONF_BOARD_FLASH_MODE, default="dout"): cv.one_of(
                 *BUILD_FLASH_MODES, lower=True
             ),
         }
     ),
+    _validate_rtc_cache,
     set_core_data,
 )
 
@@ -218,6 +231,8 @@ async def to_code(config):
 
     if config[CONF_RESTORE_FROM_FLASH]:
         cg.add_define("USE_ESP8266_PREFERENCES_FLASH")
+    if config[CONF_RTC_CACHE]:
+        cg.add_define("USE_ESP8266_PREFERENCES_RTC_CACHE")
 
     if config[CONF_EARLY_PIN_INIT]:
         cg.add_define("USE_ESP8266_EARLY_PIN_INIT")
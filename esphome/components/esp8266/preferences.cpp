@@ -5,12 +5,14 @@ extern "C" {
 #include "spi_flash.h"
 }
 
+#include "esphome/core/application.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 #include "esphome/core/preferences.h"
 #include "preferences.h"
 
+#include <algorithm>
 #include <cstring>
 #include <vector>
 
@@ -22,6 +24,10 @@ static const char *const TAG = "esp8266.preferences";
 static bool s_prevent_write = false;         // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 static uint32_t *s_flash_storage = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 static bool s_flash_dirty = false;           // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#ifdef USE_ESP8266_PREFERENCES_RTC_CACHE
+// RTC copies are only written once setup is done, see ESP8266Preferences::start_rtc_cache_()
+static bool s_rtc_cache_ready = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
 
 static const uint32_t ESP_RTC_USER_MEM_START = 0x60001200;
 #define ESP_RTC_USER_MEM ((uint32_t *) ESP_RTC_USER_MEM_START)
@@ -121,6 +127,11 @@ class ESP8266PreferenceBackend : public ESPPreferenceBackend {
   uint32_t type = 0;
   bool in_flash = false;
   size_t length_words = 0;
+#ifdef USE_ESP8266_PREFERENCES_RTC_CACHE
+  /// Flash preferences can keep a copy in RTC memory that survives soft reboots, see load().
+  bool rtc_cached = false;
+  size_t rtc_offset = 0;
+#endif
 
   bool save(const uint8_t *data, size_t len) override {
     if ((len + 3) / 4 != length_words) {
@@ -131,6 +142,11 @@ class ESP8266PreferenceBackend : public ESPPreferenceBackend {
     memcpy(buffer.data(), data, len);
     buffer[buffer.size() - 1] = calculate_crc(buffer.begin(), buffer.end() - 1, type);
 
+#ifdef USE_ESP8266_PREFERENCES_RTC_CACHE
+    // The RTC copy is current right away, flash catches up on the next sync
+    if (rtc_cached && s_rtc_cache_ready)
+      save_to_rtc(rtc_offset, buffer.data(), buffer.size());
+#endif
     if (in_flash) {
       return save_to_flash(offset, buffer.data(), buffer.size());
     } else {
@@ -143,6 +159,15 @@ class ESP8266PreferenceBackend : public ESPPreferenceBackend {
     }
     std::vector<uint32_t> buffer;
     buffer.resize(length_words + 1);
+#ifdef USE_ESP8266_PREFERENCES_RTC_CACHE
+    if (rtc_cached && load_from_rtc(rtc_offset, buffer.data(), buffer.size()) &&
+        buffer[buffer.size() - 1] == calculate_crc(buffer.begin(), buffer.end() - 1, type)) {
+      // Saved before a soft reboot, possibly without reaching flash. Queue it for the next sync.
+      save_to_flash(offset, buffer.data(), buffer.size());
+      memcpy(data, buffer.data(), len);
+      return true;
+    }
+#endif
     bool ret;
     if (in_flash) {
       ret = load_from_flash(offset, buffer.data(), buffer.size());
@@ -157,6 +182,11 @@ class ESP8266PreferenceBackend : public ESPPreferenceBackend {
       return false;
     }
 
+#ifdef USE_ESP8266_PREFERENCES_RTC_CACHE
+    // RTC memory was lost (power cycle) or never written, seed it from flash
+    if (rtc_cached && s_rtc_cache_ready)
+      save_to_rtc(rtc_offset, buffer.data(), buffer.size());
+#endif
     memcpy(data, buffer.data(), len);
     return true;
   }
@@ -190,34 +220,24 @@ class ESP8266Preferences : public ESPPreferences {
       pref->length_words = length_words;
       pref->in_flash = true;
       current_flash_offset = end;
+#ifdef USE_ESP8266_PREFERENCES_RTC_CACHE
+      // Without room left in RTC memory the preference is only kept in flash
+      this->allocate_rtc_cache_(pref);
+#endif
       return {pref};
     }
 
-    uint32_t start = current_offset;
-    uint32_t end = start + length_words + 1;
-    bool in_normal = start < 96;
-    // Normal: offset 0-95 maps to RTC offset 32 - 127,
-    // Eboot: offset 96-127 maps to RTC offset 0 - 31 words
-    if (in_normal && end > 96) {
-      // start is in normal but end is not -> switch to Eboot
-      current_offset = start = 96;
-      end = start + length_words + 1;
-      in_normal = false;
-    }
-
-    if (end > 128) {
+    size_t rtc_offset;
+    if (!this->allocate_rtc_(length_words, &rtc_offset)) {
       // Doesn't fit in data, return uninitialized preference obj.
       return {};
     }
 
-    uint32_t rtc_offset = in_normal ? start + 32 : start - 96;
-
     auto *pref = new ESP8266PreferenceBackend();  // NOLINT(cppcoreguidelines-owning-memory)
     pref->offset = rtc_offset;
     pref->type = type;
     pref->length_words = length_words;
     pref->in_flash = false;
-    current_offset += length_words + 1;
     return pref;
   }
 
@@ -230,6 +250,14 @@ class ESP8266Preferences : public ESPPreferences {
   }
 
   bool sync() override {
+#ifdef USE_ESP8266_PREFERENCES_RTC_CACHE
+    this->start_rtc_cache_();
+#endif
+    if (this->snapshot_ != nullptr) {
+      // Finish the background commit in one go, then write anything saved since
+      while (!this->poll_sync()) {
+      }
+    }
     if (!s_flash_dirty)
       return true;
     if (s_prevent_write)
@@ -257,8 +285,68 @@ class ESP8266Preferences : public ESPPreferences {
     return true;
   }
 
+  void begin_sync() override {
+#ifdef USE_ESP8266_PREFERENCES_RTC_CACHE
+    this->start_rtc_cache_();
+#endif
+    if (this->snapshot_ != nullptr)
+      return;
+    if (!s_flash_dirty || s_prevent_write) {
+      this->sync_result_ = !s_flash_dirty;
+      return;
+    }
+
+    // Saves made while the commit is in progress mark the storage dirty again and are picked up by the next sync
+    this->snapshot_ = new uint32_t[ESP8266_FLASH_STORAGE_SIZE];  // NOLINT(cppcoreguidelines-owning-memory)
+    memcpy(this->snapshot_, s_flash_storage, ESP8266_FLASH_STORAGE_SIZE * 4);
+    s_flash_dirty = false;
+    this->snapshot_written_ = 0;
+
+    ESP_LOGD(TAG, "Saving in background");
+    // The sector erase can't be split, only the writes after it
+    SpiFlashOpResult erase_res;
+    {
+      InterruptLock lock;
+      erase_res = spi_flash_erase_sector(get_esp8266_flash_sector());
+    }
+    if (erase_res != SPI_FLASH_RESULT_OK) {
+      ESP_LOGE(TAG, "Erasing failed");
+      this->abort_snapshot_();
+    }
+  }
+
+  bool poll_sync() override {
+    if (this->snapshot_ == nullptr)
+      return true;
+
+    uint32_t count = std::min(ESP8266_FLASH_STORAGE_SIZE - this->snapshot_written_, SYNC_CHUNK_WORDS);
+    SpiFlashOpResult write_res;
+    {
+      InterruptLock lock;
+      write_res = spi_flash_write(get_esp8266_flash_address() + this->snapshot_written_ * 4,
+                                  this->snapshot_ + this->snapshot_written_, count * 4);
+    }
+    if (write_res != SPI_FLASH_RESULT_OK) {
+      ESP_LOGE(TAG, "Writing failed");
+      this->abort_snapshot_();
+      return true;
+    }
+
+    this->snapshot_written_ += count;
+    if (this->snapshot_written_ < ESP8266_FLASH_STORAGE_SIZE)
+      return false;
+
+    delete[] this->snapshot_;  // NOLINT(cppcoreguidelines-owning-memory)
+    this->snapshot_ = nullptr;
+    this->sync_result_ = true;
+    return true;
+  }
+
   bool reset() override {
     ESP_LOGD(TAG, "Erasing storage");
+    // Drop a background commit, its remaining chunks would land on the erased sector
+    delete[] this->snapshot_;  // NOLINT(cppcoreguidelines-owning-memory)
+    this->snapshot_ = nullptr;
     SpiFlashOpResult erase_res;
     {
       InterruptLock lock;
@@ -273,6 +361,87 @@ class ESP8266Preferences : public ESPPreferences {
     s_prevent_write = true;
     return true;
   }
+
+ protected:
+  /// Reserve RTC memory for a preference, returns false if it's full.
+  bool allocate_rtc_(uint32_t length_words, size_t *rtc_offset) {
+    uint32_t start = current_offset;
+    uint32_t end = start + length_words + 1;
+    bool in_normal = start < 96;
+    // Normal: offset 0-95 maps to RTC offset 32 - 127,
+    // Eboot: offset 96-127 maps to RTC offset 0 - 31 words
+    if (in_normal && end > 96) {
+      // start is in normal but end is not -> switch to Eboot
+      current_offset = start = 96;
+      end = start + length_words + 1;
+      in_normal = false;
+    }
+
+    if (end > 128)
+      return false;
+
+#ifdef USE_ESP8266_PREFERENCES_RTC_CACHE
+    // RTC-backed preferences keep the layout they have without the cache, drop the RTC copies in the way
+    while (in_normal && end > this->rtc_cache_floor_) {
+      ESP8266PreferenceBackend *evicted = this->rtc_cached_.back();
+      this->rtc_cached_.pop_back();
+      evicted->rtc_cached = false;
+      this->rtc_cache_floor_ += evicted->length_words + 1;
+    }
+#endif
+
+    *rtc_offset = in_normal ? start + 32 : start - 96;
+    current_offset += length_words + 1;
+    return true;
+  }
+
+#ifdef USE_ESP8266_PREFERENCES_RTC_CACHE
+  /// Give a flash preference an RTC copy if the normal area has room above the RTC-backed preferences.
+  void allocate_rtc_cache_(ESP8266PreferenceBackend *pref) {
+    // Copies grow down from the end of the normal area (offset 95), RTC-backed preferences grow up from 0
+    uint32_t size = pref->length_words + 1;
+    if (current_offset + size > this->rtc_cache_floor_)
+      return;
+    this->rtc_cache_floor_ -= size;
+    pref->rtc_offset = this->rtc_cache_floor_ + 32;
+    pref->rtc_cached = true;
+    this->rtc_cached_.push_back(pref);
+  }
+
+  /** Start writing the RTC copies, called before each sync.
+   *
+   * Components create their RTC-backed preferences during setup, possibly after flash preferences that got a copy.
+   * Until setup is done a copy may still be dropped for one of them, so it must not write to RTC memory yet.
+   * Once it is, every remaining copy is seeded from the flash storage, which holds the latest saved values.
+   */
+  void start_rtc_cache_() {
+    if (s_rtc_cache_ready || !App.is_setup_complete())
+      return;
+    s_rtc_cache_ready = true;
+    for (auto *pref : this->rtc_cached_)
+      save_to_rtc(pref->rtc_offset, &s_flash_storage[pref->offset], pref->length_words + 1);
+  }
+
+  /// Flash preferences with an RTC copy, the last one has the lowest RTC offset.
+  std::vector<ESP8266PreferenceBackend *> rtc_cached_;
+  /// Start of the RTC copies in preference offsets, everything from here up to 96 is used by them.
+  uint32_t rtc_cache_floor_{96};
+#endif
+
+  /// Flash words written per poll_sync() call, each chunk blocks interrupts for a fraction of a millisecond.
+  static const uint32_t SYNC_CHUNK_WORDS = 32;
+
+  void abort_snapshot_() {
+    // Keep the values dirty so the next sync rewrites the whole sector
+    delete[] this->snapshot_;  // NOLINT(cppcoreguidelines-owning-memory)
+    this->snapshot_ = nullptr;
+    s_flash_dirty = true;
+    this->sync_result_ = false;
+  }
+
+  /// Copy of the flash storage being committed by poll_sync(), nullptr when no commit is in progress.
+  uint32_t *snapshot_{nullptr};
+  uint32_t snapshot_written_{0};
 };
 
 void setup_preferences() {
@@ -8,6 +8,8 @@
 #include "esphome/components/ota/ota_backend_arduino_libretiny.h"
 #include "esphome/components/ota/ota_backend_arduino_rp2040.h"
 #include "esphome/components/ota/ota_backend_esp_idf.h"
+#include "esphome/components/ota/ota_backend_gzip.h"
+#include "esphome/components/ota/ota_write_task.h"
 #include "esphome/core/application.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -98,6 +100,7 @@ void ESPHomeOTAComponent::handle_() {
   bool update_started = false;
   size_t total = 0;
   uint32_t last_progress = 0;
+  uint32_t transfer_start = 0;
   uint8_t buf[1024];
   char *sbuf = reinterpret_cast<char *>(buf);
   size_t ota_size;
@@ -107,6 +110,12 @@ void ESPHomeOTAComponent::handle_() {
 #if USE_OTA_VERSION == 2
   size_t size_acknowledged = 0;
 #endif
+#ifdef USE_ESP32
+  // Flash writes run on their own task while the next buffer is received
+  std::unique_ptr<ota::OTAWriteTask> writer;
+  uint8_t *write_buf = nullptr;
+  size_t write_len = 0;
+#endif
 
   if (this->client_ == nullptr) {
     // We already checked server_->ready() in loop(), so we can accept directly
@@ -161,8 +170,20 @@ void ESPHomeOTAComponent::handle_() {
 
   // Acknowledge header - 1 byte
   buf[0] = ota::OTA_RESPONSE_HEADER_OK;
-  if ((ota_features & FEATURE_SUPPORTS_COMPRESSION) != 0 && backend->supports_compression()) {
-    buf[0] = ota::OTA_RESPONSE_SUPPORTS_COMPRESSION;
+  if ((ota_features & FEATURE_SUPPORTS_COMPRESSION) != 0) {
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+    // Decompress here for backends that can't themselves, if there's memory for the window
+    if (!backend->supports_compression()) {
+      auto inflater = make_unique<ota::GzipInflater>();
+      if (inflater->init()) {
+        backend = make_unique<ota::GzipOTABackend>(std::move(backend), std::move(inflater));
+      } else {
+        ESP_LOGW(TAG, "Not enough memory to receive a compressed update");
+      }
+    }
+#endif
+    if (backend->supports_compression())
+      buf[0] = ota::OTA_RESPONSE_SUPPORTS_COMPRESSION;
   }
 
   this->writeall_(buf, 1);
@@ -264,10 +285,36 @@ void ESPHomeOTAComponent::handle_() {
   buf[0] = ota::OTA_RESPONSE_BIN_MD5_OK;
   this->writeall_(buf, 1);
 
+#ifdef USE_ESP32
+  writer = make_unique<ota::OTAWriteTask>();
+  if (!writer->start(backend.get()))
+    writer.reset();
+#endif
+
+  transfer_start = millis();
   while (total < ota_size) {
     // TODO: timeout check
-    size_t requested = std::min(sizeof(buf), ota_size - total);
-    ssize_t read = this->client_->read(buf, requested);
+    uint8_t *target = buf;
+    size_t space = sizeof(buf);
+#ifdef USE_ESP32
+    if (writer) {
+      if (write_buf == nullptr) {
+        write_buf = writer->acquire();
+        if (write_buf == nullptr) {
+          error_code = writer->get_error();
+          if (error_code == ota::OTA_RESPONSE_OK)
+            error_code = ota::OTA_RESPONSE_ERROR_WRITING_FLASH;
+          ESP_LOGW(TAG, "Error writing binary data to flash!, error_code: %d", error_code);
+          goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+        }
+        write_len = 0;
+      }
+      target = write_buf + write_len;
+      space = ota::OTAWriteTask::BUFFER_SIZE - write_len;
+    }
+#endif
+    size_t requested = std::min(space, ota_size - total);
+    ssize_t read = this->client_->read(target, requested);
     if (read == -1) {
       if (errno == EAGAIN || errno == EWOULDBLOCK) {
         App.feed_wdt();
@@ -284,7 +331,20 @@ void ESPHomeOTAComponent::handle_() {
       goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
     }
 
-    error_code = backend->write(buf, read);
+#ifdef USE_ESP32
+    if (writer) {
+      write_len += read;
+      if (write_len == ota::OTAWriteTask::BUFFER_SIZE || total + read == ota_size) {
+        writer->submit(write_buf, write_len);
+        write_buf = nullptr;
+      }
+      // Reports the failure of an earlier buffer
+      error_code = writer->get_error();
+    } else
+#endif
+    {
+      error_code = backend->write(buf, read);
+    }
     if (error_code != ota::OTA_RESPONSE_OK) {
       ESP_LOGW(TAG, "Error writing binary data to flash!, error_code: %d", error_code);
       goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
@@ -312,6 +372,23 @@ void ESPHomeOTAComponent::handle_() {
     }
   }
 
+  {
+    const uint32_t elapsed = millis() - transfer_start;
+    ESP_LOGI(TAG, "Received %" PRIu32 " bytes in %" PRIu32 "ms (%" PRIu32 " kB/s)", static_cast<uint32_t>(total),
+             elapsed, elapsed > 0 ? static_cast<uint32_t>(total / elapsed) : 0);
+  }
+
+#ifdef USE_ESP32
+  if (writer) {
+    error_code = writer->finish();
+    writer.reset();
+    if (error_code != ota::OTA_RESPONSE_OK) {
+      ESP_LOGW(TAG, "Error writing binary data to flash!, error_code: %d", error_code);
+      goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
+    }
+  }
+#endif
+
   // Acknowledge receive OK - 1 byte
   buf[0] = ota::OTA_RESPONSE_RECEIVE_OK;
   this->writeall_(buf, 1);
@@ -349,6 +426,10 @@ error:
   this->client_->close();
   this->client_ = nullptr;
 
+#ifdef USE_ESP32
+  // Waits for a running write before the backend is aborted
+  writer.reset();
+#endif
   if (backend != nullptr && update_started) {
     backend->abort();
   }
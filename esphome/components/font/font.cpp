@@ -59,6 +59,21 @@ Font::Font(const GlyphData *data, int data_nr, int baseline, int height, int des
     glyphs_.emplace_back(&data[i]);
 }
 int Font::match_next_glyph(const uint8_t *str, int *match_length) {
+  // Glyphs are single characters, so an ASCII byte always matches the same glyph with length 1
+  const uint8_t first = str[0];
+  GlyphCacheEntry *entry = nullptr;
+  if ((first != '\0') && (first < 0x80)) {
+    entry = &this->glyph_cache_[first % GLYPH_CACHE_SIZE];
+    if ((entry->character == first) && (entry->index >= 0)) {
+      *match_length = 1;
+      return entry->index;
+    }
+  }
+  if (this->glyphs_.empty()) {
+    *match_length = 0;
+    return -1;
+  }
+
   int lo = 0;
   int hi = this->glyphs_.size() - 1;
   while (lo != hi) {
@@ -72,6 +87,10 @@ int Font::match_next_glyph(const uint8_t *str, int *match_length) {
   *match_length = this->glyphs_[lo].match_length(str);
   if (*match_length <= 0)
     return -1;
+  if ((entry != nullptr) && (*match_length == 1)) {
+    entry->character = first;
+    entry->index = lo;
+  }
   return lo;
 }
 #ifdef USE_DISPLAY
@@ -111,6 +130,14 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
   int i = 0;
   int x_at = x_start;
   int scan_x1, scan_y1, scan_width, scan_height;
+  const int bpp_max = (1 << this->bpp_) - 1;
+  // Anti-aliased pixels mix the colors by their coverage
+  auto blend = [&](int pixel) {
+    auto mix = [&](uint8_t on, uint8_t off) { return (uint8_t) (off + ((int) on - (int) off) * pixel / bpp_max); };
+    return Color(mix(color.r, background.r), mix(color.g, background.g), mix(color.b, background.b),
+                 mix(color.w, background.w));
+  };
+  const display::Rect clipping = display->get_clipping();
   while (text[i] != '\0') {
     int match_length;
     int glyph_n = this->match_next_glyph((const uint8_t *) text + i, &match_length);
@@ -131,22 +158,23 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
     glyph.scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
 
     const uint8_t *data = glyph.glyph_data_->data;
-    const int max_x = x_at + scan_x1 + scan_width;
+    const int min_x = x_at + scan_x1;
+    const int max_x = min_x + scan_width;
     const int max_y = y_start + scan_y1 + scan_height;
 
+    // Glyphs outside the clipping area, like those in other bands of a partial buffer, are not decoded at all
+    if (!clipping.inside(display::Rect(min_x, y_start + scan_y1, scan_width, scan_height))) {
+      x_at += glyph.glyph_data_->advance;
+      i += match_length;
+      continue;
+    }
+
     uint8_t bitmask = 0;
     uint8_t pixel_data = 0;
-    uint8_t bpp_max = (1 << this->bpp_) - 1;
-    auto diff_r = (float) color.r - (float) background.r;
-    auto diff_g = (float) color.g - (float) background.g;
-    auto diff_b = (float) color.b - (float) background.b;
-    auto diff_w = (float) color.w - (float) background.w;
-    auto b_r = (float) background.r;
-    auto b_g = (float) background.g;
-    auto b_b = (float) background.b;
-    auto b_w = (float) background.w;
     for (int glyph_y = y_start + scan_y1; glyph_y != max_y; glyph_y++) {
-      for (int glyph_x = x_at + scan_x1; glyph_x != max_x; glyph_x++) {
+      // Fully covered pixels are collected into spans, which displays fill much faster than single pixels
+      int span_start = min_x;
+      for (int glyph_x = min_x; glyph_x != max_x; glyph_x++) {
         uint8_t pixel = 0;
         for (int bit_num = 0; bit_num != this->bpp_; bit_num++) {
           if (bitmask == 0) {
@@ -158,15 +186,16 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
             pixel |= 1;
           bitmask >>= 1;
         }
-        if (pixel == bpp_max) {
-          display->draw_pixel_at(glyph_x, glyph_y, color);
-        } else if (pixel != 0) {
-          auto on = (float) pixel / (float) bpp_max;
-          auto blended = Color((uint8_t) (diff_r * on + b_r), (uint8_t) (diff_g * on + b_g),
-                               (uint8_t) (diff_b * on + b_b), (uint8_t) (diff_w * on + b_w));
-          display->draw_pixel_at(glyph_x, glyph_y, blended);
-        }
+        if (pixel == bpp_max)
+          continue;
+        if (glyph_x != span_start)
+          display->horizontal_line(span_start, glyph_y, glyph_x - span_start, color);
+        span_start = glyph_x + 1;
+        if (pixel != 0)
+          display->draw_pixel_at(glyph_x, glyph_y, blend(pixel));
       }
+      if (max_x != span_start)
+        display->horizontal_line(span_start, glyph_y, max_x - span_start, color);
     }
     x_at += glyph.glyph_data_->advance;
 
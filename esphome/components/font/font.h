@@ -62,6 +62,7 @@ class Font
   Font(const GlyphData *data, int data_nr, int baseline, int height, int descender, int xheight, int capheight,
        uint8_t bpp = 1);
 
+  /// Find the glyph for the character at the start of str and its length in bytes. Returns -1 if there is none.
   int match_next_glyph(const uint8_t *str, int *match_length);
 
 #ifdef USE_DISPLAY
@@ -89,6 +90,14 @@ class Font
   int xheight_;
   int capheight_;
   uint8_t bpp_;  // bits per pixel
+
+  /// Recently found glyphs of ASCII characters, indexed by the low bits of the character, to skip the binary search
+  struct GlyphCacheEntry {
+    uint8_t character{0};
+    int16_t index{-1};
+  };
+  static const uint8_t GLYPH_CACHE_SIZE = 16;
+  GlyphCacheEntry glyph_cache_[GLYPH_CACHE_SIZE]{};
 };
 
 }  // namespace font
@@ -34,7 +34,11 @@ template<typename T> class RestoringGlobalsComponent : public Component {
     memcpy(this->value_, initial_value.data(), sizeof(T));
   }
 
-  T &value() { return this->value_; }
+  /// The caller may write through the reference, so the value is checked for changes in the next loop iteration
+  T &value() {
+    this->enable_loop();
+    return this->value_;
+  }
 
   void setup() override {
     this->rtc_ = global_preferences->make_preference<T>(1944399030U ^ this->name_hash_);
@@ -44,7 +48,11 @@ template<typename T> class RestoringGlobalsComponent : public Component {
 
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
-  void loop() override { store_value_(); }
+  // Only runs after value() was used, nothing can change the value otherwise
+  void loop() override {
+    this->store_value_();
+    this->disable_loop();
+  }
 
   void on_shutdown() override { store_value_(); }
 
@@ -76,7 +84,11 @@ template<typename T, uint8_t SZ> class RestoringGlobalStringComponent : public C
     memcpy(this->value_, initial_value.data(), sizeof(T));
   }
 
-  T &value() { return this->value_; }
+  /// The caller may write through the reference, so the value is checked for changes in the next loop iteration
+  T &value() {
+    this->enable_loop();
+    return this->value_;
+  }
 
   void setup() override {
     char temp[SZ];
@@ -90,7 +102,11 @@ template<typename T, uint8_t SZ> class RestoringGlobalStringComponent : public C
 
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
-  void loop() override { store_value_(); }
+  // Only runs after value() was used, nothing can change the value otherwise
+  void loop() override {
+    this->store_value_();
+    this->disable_loop();
+  }
 
   void on_shutdown() override { store_value_(); }
 
@@ -16,6 +16,11 @@ void HomeassistantTextSensor::setup() {
         } else {
           ESP_LOGD(TAG, "'%s': Got state '%s'", this->entity_id_.c_str(), state.c_str());
         }
+        // Home Assistant sends the state again whenever an attribute changes
+        if (this->has_state() && state == this->raw_state) {
+          ESP_LOGV(TAG, "'%s': State unchanged", this->entity_id_.c_str());
+          return;
+        }
         this->publish_state(state);
       });
 }
@@ -40,6 +40,14 @@ HttpRequestResponseTrigger = http_request_ns.class_(
         cg.std_shared_ptr.template(HttpContainer), cg.std_string
     ),
 )
+HttpRequestResponseChunkTrigger = http_request_ns.class_(
+    "HttpRequestResponseChunkTrigger",
+    automation.Trigger.template(
+        cg.std_shared_ptr.template(HttpContainer),
+        cg.uint8.operator("ptr").operator("const"),
+        cg.size_t,
+    ),
+)
 
 CONF_HTTP_REQUEST_ID = "http_request_id"
 
@@ -49,10 +57,12 @@ CONF_FOLLOW_REDIRECTS = "follow_redirects"
 CONF_REDIRECT_LIMIT = "redirect_limit"
 CONF_BUFFER_SIZE_RX = "buffer_size_rx"
 CONF_BUFFER_SIZE_TX = "buffer_size_tx"
+CONF_KEEP_ALIVE_TIMEOUT = "keep_alive_timeout"
 CONF_CA_CERTIFICATE_PATH = "ca_certificate_path"
 
 CONF_MAX_RESPONSE_BUFFER_SIZE = "max_response_buffer_size"
 CONF_ON_RESPONSE = "on_response"
+CONF_ON_RESPONSE_CHUNK = "on_response_chunk"
 CONF_HEADERS = "headers"
 CONF_COLLECT_HEADERS = "collect_headers"
 CONF_BODY = "body"
@@ -129,6 +139,11 @@ CONFIG_SCHEMA = cv.All(
             cv.SplitDefault(CONF_BUFFER_SIZE_TX, esp32_idf=512): cv.All(
                 cv.uint16_t, cv.only_with_esp_idf
             ),
+            cv.Optional(CONF_KEEP_ALIVE_TIMEOUT): cv.All(
+                cv.positive_not_null_time_period,
+                cv.positive_time_period_milliseconds,
+                cv.only_with_esp_idf,
+            ),
             cv.Optional(CONF_CA_CERTIFICATE_PATH): cv.All(
                 cv.file_,
                 cv.only_on(PLATFORM_HOST),
@@ -163,6 +178,11 @@ async def to_code(config):
         if CORE.using_esp_idf:
             cg.add(var.set_buffer_size_rx(config[CONF_BUFFER_SIZE_RX]))
             cg.add(var.set_buffer_size_tx(config[CONF_BUFFER_SIZE_TX]))
+            if keep_alive_timeout := config.get(CONF_KEEP_ALIVE_TIMEOUT):
+                cg.add(var.set_keep_alive_timeout(keep_alive_timeout))
+                esp32.add_idf_sdkconfig_option(
+                    "CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS", True
+                )
 
             esp32.add_idf_sdkconfig_option(
                 "CONFIG_MBEDTLS_CERTIFICATE_BUNDLE",
@@ -220,6 +240,13 @@ HTTP_REQUEST_ACTION_SCHEMA = cv.Schema(
         cv.Optional(CONF_ON_RESPONSE): automation.validate_automation(
             {cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(HttpRequestResponseTrigger)}
         ),
+        cv.Optional(CONF_ON_RESPONSE_CHUNK): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(
+                    HttpRequestResponseChunkTrigger
+                )
+            }
+        ),
         cv.Optional(CONF_ON_ERROR): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(
@@ -315,6 +342,18 @@ async def http_request_action_to_code(config, action_id, template_arg, args):
             ],
             conf,
         )
+    for conf in config.get(CONF_ON_RESPONSE_CHUNK, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID])
+        cg.add(var.register_response_chunk_trigger(trigger))
+        await automation.build_automation(
+            trigger,
+            [
+                (cg.std_shared_ptr.template(HttpContainer), "response"),
+                (cg.uint8.operator("ptr").operator("const"), "data"),
+                (cg.size_t, "length"),
+            ],
+            conf,
+        )
     for conf in config.get(CONF_ON_ERROR, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID])
         cg.add(var.register_error_trigger(trigger))
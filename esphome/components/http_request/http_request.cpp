@@ -1,5 +1,7 @@
 #include "http_request.h"
 
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
 #include <cinttypes>
@@ -22,6 +24,27 @@ void HttpRequestComponent::dump_config() {
   }
 }
 
+int HttpContainer::read_chunk(uint8_t *buf, size_t max_len) {
+  uint32_t start = millis();
+  while (this->bytes_read_ < this->content_length) {
+    int read = this->read(buf, max_len);
+    App.feed_wdt();
+    if (read != 0)
+      return read;
+    if (millis() - start > this->parent_->get_timeout()) {
+      ESP_LOGW(TAG, "Timed out reading the response body");
+      return -1;
+    }
+    yield();
+  }
+  return 0;
+}
+
+bool HttpContainer::parse_json(const std::vector<std::string> &keep, const json::json_parse_t &f) {
+  return json::parse_json_stream([this](uint8_t *buf, size_t max_len) { return this->read_chunk(buf, max_len); },
+                                 keep, f);
+}
+
 std::string HttpContainer::get_response_header(const std::string &header_name) {
   auto response_headers = this->get_response_headers();
   auto header_name_lower_case = str_lower_case(header_name);
@@ -92,6 +92,21 @@ class HttpContainer : public Parented<HttpRequestComponent> {
   virtual int read(uint8_t *buf, size_t max_len) = 0;
   virtual void end() = 0;
 
+  /**
+   * @brief Reads the next part of the body, waiting for data up to the timeout of the component.
+   *
+   * @return The number of bytes read, 0 at the end of the body or -1 if the connection failed.
+   */
+  int read_chunk(uint8_t *buf, size_t max_len);
+
+  /**
+   * @brief Parses the body as JSON while it is read, without keeping the text of the body in memory.
+   *
+   * @param keep the members to store, like "main.temp" or "list[].id", all of them if empty
+   * @param f called with the root object if the body is valid JSON
+   */
+  bool parse_json(const std::vector<std::string> &keep, const json::json_parse_t &f);
+
   void set_secure(bool secure) { this->secure_ = secure; }
 
   size_t get_bytes_read() const { return this->bytes_read_; }
@@ -118,6 +133,9 @@ class HttpRequestResponseTrigger : public Trigger<std::shared_ptr<HttpContainer>
   }
 };
 
+/// Runs for every part of the response body as it arrives, before the response triggers
+class HttpRequestResponseChunkTrigger : public Trigger<std::shared_ptr<HttpContainer>, const uint8_t *, size_t> {};
+
 class HttpRequestComponent : public Component {
  public:
   void dump_config() override;
@@ -125,6 +143,7 @@ class HttpRequestComponent : public Component {
 
   void set_useragent(const char *useragent) { this->useragent_ = useragent; }
   void set_timeout(uint16_t timeout) { this->timeout_ = timeout; }
+  uint16_t get_timeout() const { return this->timeout_; }
   void set_watchdog_timeout(uint32_t watchdog_timeout) { this->watchdog_timeout_ = watchdog_timeout; }
   uint32_t get_watchdog_timeout() const { return this->watchdog_timeout_; }
   void set_follow_redirects(bool follow_redirects) { this->follow_redirects_ = follow_redirects; }
@@ -197,6 +216,10 @@ template<typename... Ts> class HttpRequestSendAction : public Action<Ts...> {
 
   void register_response_trigger(HttpRequestResponseTrigger *trigger) { this->response_triggers_.push_back(trigger); }
 
+  void register_response_chunk_trigger(HttpRequestResponseChunkTrigger *trigger) {
+    this->response_chunk_triggers_.push_back(trigger);
+  }
+
   void register_error_trigger(Trigger<> *trigger) { this->error_triggers_.push_back(trigger); }
 
   void set_max_response_buffer_size(size_t max_response_buffer_size) {
@@ -238,7 +261,19 @@ template<typename... Ts> class HttpRequestSendAction : public Action<Ts...> {
     size_t max_length = std::min(content_length, this->max_response_buffer_size_);
 
     std::string response_body;
-    if (this->capture_response_.value(x...)) {
+    if (!this->response_chunk_triggers_.empty()) {
+      // The body is read once, so a captured body is collected from the same chunks
+      const bool capture = this->capture_response_.value(x...);
+      uint8_t buf[512];
+      int read;
+      while ((read = container->read_chunk(buf, sizeof(buf))) > 0) {
+        if (capture && response_body.size() < max_length) {
+          response_body.append((char *) buf, std::min<size_t>(read, max_length - response_body.size()));
+        }
+        for (auto *trigger : this->response_chunk_triggers_)
+          trigger->trigger(container, buf, read);
+      }
+    } else if (this->capture_response_.value(x...)) {
       RAMAllocator<uint8_t> allocator;
       uint8_t *buf = allocator.allocate(max_length);
       if (buf != nullptr) {
@@ -284,6 +319,7 @@ template<typename... Ts> class HttpRequestSendAction : public Action<Ts...> {
   std::map<const char *, TemplatableValue<std::string, Ts...>> json_{};
   std::function<void(Ts..., JsonObject)> json_func_{nullptr};
   std::vector<HttpRequestResponseTrigger *> response_triggers_{};
+  std::vector<HttpRequestResponseChunkTrigger *> response_chunk_triggers_{};
   std::vector<Trigger<> *> error_triggers_{};
 
   size_t max_response_buffer_size_{SIZE_MAX};
@@ -14,22 +14,111 @@
 
 #include "esp_task_wdt.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace http_request {
 
 static const char *const TAG = "http_request.idf";
 
+// Rest of an unread response body that is skipped to keep the connection, larger ones close it
+static const size_t MAX_DRAIN_SIZE = 2048;
+
 struct UserData {
   const std::set<std::string> &collect_headers;
   std::map<std::string, std::list<std::string>> response_headers;
 };
 
+/// Everything in front of the path, a kept connection is only used for the same origin
+static std::string url_origin(const std::string &url) {
+  size_t start = url.find("://");
+  if (start == std::string::npos)
+    return url;
+  return url.substr(0, url.find('/', start + 3));
+}
+
+static void close_client(esp_http_client_handle_t client) {
+  esp_http_client_close(client);
+  esp_http_client_cleanup(client);
+}
+
+void HttpRequestIDF::setup() {
+  // Only needed to close idle connections
+  this->disable_loop();
+}
+
+void HttpRequestIDF::loop() {
+  std::vector<esp_http_client_handle_t> expired;
+  bool idle;
+  {
+    LockGuard guard{this->idle_lock_};
+    const uint32_t now = millis();
+    for (auto it = this->idle_clients_.begin(); it != this->idle_clients_.end();) {
+      if (now - it->since >= this->keep_alive_timeout_) {
+        expired.push_back(it->client);
+        it = this->idle_clients_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    idle = this->idle_clients_.empty();
+  }
+  for (auto *client : expired)
+    close_client(client);
+  if (idle)
+    this->disable_loop();
+}
+
 void HttpRequestIDF::dump_config() {
   HttpRequestComponent::dump_config();
   ESP_LOGCONFIG(TAG,
                 "  Buffer Size RX: %u\n"
                 "  Buffer Size TX: %u",
                 this->buffer_size_rx_, this->buffer_size_tx_);
+  if (this->keep_alive_timeout_ > 0) {
+    ESP_LOGCONFIG(TAG, "  Keep-Alive Timeout: %" PRIu32 "ms", this->keep_alive_timeout_);
+  }
+}
+
+esp_http_client_handle_t HttpRequestIDF::take_idle_client_(const std::string &origin,
+                                                           std::vector<std::string> &header_names) {
+  esp_http_client_handle_t client = nullptr;
+  {
+    LockGuard guard{this->idle_lock_};
+    for (auto it = this->idle_clients_.begin(); it != this->idle_clients_.end(); ++it) {
+      if (it->origin != origin)
+        continue;
+      if (millis() - it->since < this->keep_alive_timeout_) {
+        client = it->client;
+        header_names = std::move(it->header_names);
+        this->idle_clients_.erase(it);
+        return client;
+      }
+      client = it->client;
+      this->idle_clients_.erase(it);
+      break;
+    }
+  }
+  // Expired, but loop() didn't get to it yet
+  if (client != nullptr)
+    close_client(client);
+  return nullptr;
+}
+
+void HttpRequestIDF::release_client_(const std::string &origin, esp_http_client_handle_t client,
+                                     std::vector<std::string> header_names) {
+  esp_http_client_handle_t evicted = nullptr;
+  {
+    LockGuard guard{this->idle_lock_};
+    if (this->idle_clients_.size() >= MAX_IDLE_CLIENTS) {
+      evicted = this->idle_clients_.front().client;
+      this->idle_clients_.erase(this->idle_clients_.begin());
+    }
+    this->idle_clients_.push_back({origin, client, std::move(header_names), millis()});
+  }
+  if (evicted != nullptr)
+    close_client(evicted);
+  this->enable_loop_soon_any_context();
 }
 
 esp_err_t HttpRequestIDF::http_event_handler(esp_http_client_event_t *evt) {
@@ -79,69 +168,107 @@ std::shared_ptr<HttpContainer> HttpRequestIDF::perform(std::string url, std::str
   }
 
   bool secure = url.find("https:") != std::string::npos;
+  const std::string origin = url_origin(url);
 
-  esp_http_client_config_t config = {};
-
-  config.url = url.c_str();
-  config.method = method_idf;
-  config.timeout_ms = this->timeout_;
-  config.disable_auto_redirect = !this->follow_redirects_;
-  config.max_redirection_count = this->redirect_limit_;
-  config.auth_type = HTTP_AUTH_TYPE_BASIC;
-#if CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
-  if (secure) {
-    config.crt_bundle_attach = esp_crt_bundle_attach;
+  std::vector<std::string> stale_headers;
+  esp_http_client_handle_t client = nullptr;
+  if (this->keep_alive_timeout_ > 0) {
+    client = this->take_idle_client_(origin, stale_headers);
   }
-#endif
-
-  if (this->useragent_ != nullptr) {
-    config.user_agent = this->useragent_;
-  }
-
-  config.buffer_size = this->buffer_size_rx_;
-  config.buffer_size_tx = this->buffer_size_tx_;
+  bool reused = client != nullptr;
 
   const uint32_t start = millis();
   watchdog::WatchdogManager wdm(this->get_watchdog_timeout());
 
-  config.event_handler = http_event_handler;
   auto user_data = UserData{collect_headers, {}};
-  config.user_data = static_cast<void *>(&user_data);
 
-  esp_http_client_handle_t client = esp_http_client_init(&config);
+  if (reused) {
+    // The client keeps the headers of its last request
+    for (const auto &name : stale_headers) {
+      esp_http_client_delete_header(client, name.c_str());
+    }
+    esp_http_client_set_url(client, url.c_str());
+    esp_http_client_set_method(client, method_idf);
+    esp_http_client_set_timeout_ms(client, this->timeout_);
+    esp_http_client_set_user_data(client, static_cast<void *>(&user_data));
+  } else {
+    esp_http_client_config_t config = {};
+
+    config.url = url.c_str();
+    config.method = method_idf;
+    config.timeout_ms = this->timeout_;
+    config.disable_auto_redirect = !this->follow_redirects_;
+    config.max_redirection_count = this->redirect_limit_;
+    config.auth_type = HTTP_AUTH_TYPE_BASIC;
+#if CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
+    if (secure) {
+      config.crt_bundle_attach = esp_crt_bundle_attach;
+    }
+#endif
+#if CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+    // A reconnect of a kept client resumes the TLS session instead of a full handshake
+    config.save_client_session = this->keep_alive_timeout_ > 0;
+#endif
+
+    if (this->useragent_ != nullptr) {
+      config.user_agent = this->useragent_;
+    }
+
+    config.buffer_size = this->buffer_size_rx_;
+    config.buffer_size_tx = this->buffer_size_tx_;
+
+    config.event_handler = http_event_handler;
+    config.user_data = static_cast<void *>(&user_data);
+
+    client = esp_http_client_init(&config);
+  }
 
   std::shared_ptr<HttpContainerIDF> container = std::make_shared<HttpContainerIDF>(client);
   container->set_parent(this);
 
   container->set_secure(secure);
 
+  std::vector<std::string> header_names;
   for (const auto &header : request_headers) {
     esp_http_client_set_header(client, header.name.c_str(), header.value.c_str());
+    header_names.push_back(header.name);
   }
 
   const int body_len = body.length();
 
-  esp_err_t err = esp_http_client_open(client, body_len);
-  if (err != ESP_OK) {
-    this->status_momentary_error("failed", 1000);
-    ESP_LOGE(TAG, "HTTP Request failed: %s", esp_err_to_name(err));
-    esp_http_client_cleanup(client);
-    return nullptr;
-  }
+  auto send_request = [&]() -> esp_err_t {
+    esp_err_t err = esp_http_client_open(client, body_len);
+    if (err != ESP_OK)
+      return err;
 
-  if (body_len > 0) {
     int write_left = body_len;
     int write_index = 0;
     const char *buf = body.c_str();
     while (write_left > 0) {
       int written = esp_http_client_write(client, buf + write_index, write_left);
-      if (written < 0) {
-        err = ESP_FAIL;
-        break;
-      }
+      if (written < 0)
+        return ESP_FAIL;
       write_left -= written;
       write_index += written;
     }
+    return ESP_OK;
+  };
+
+  const uint32_t connect_start = millis();
+  esp_err_t err = send_request();
+  container->feed_wdt();
+  int64_t content_length = err == ESP_OK ? esp_http_client_fetch_headers(client) : -1;
+  // POST and PATCH aren't idempotent: the server may have acted on a request whose response got lost
+  const bool idempotent = method_idf != HTTP_METHOD_POST && method_idf != HTTP_METHOD_PATCH;
+  if (reused && content_length < 0 && idempotent) {
+    // The server closed the connection while it was idle
+    ESP_LOGD(TAG, "Kept connection to %s was closed, reconnecting", origin.c_str());
+    esp_http_client_close(client);
+    reused = false;
+    err = send_request();
+    container->feed_wdt();
+    if (err == ESP_OK)
+      content_length = esp_http_client_fetch_headers(client);
   }
 
   if (err != ESP_OK) {
@@ -151,14 +278,25 @@ std::shared_ptr<HttpContainer> HttpRequestIDF::perform(std::string url, std::str
     return nullptr;
   }
 
-  container->feed_wdt();
-  container->content_length = esp_http_client_fetch_headers(client);
+  this->request_count_++;
+  if (reused) {
+    this->reused_count_++;
+  } else if (this->keep_alive_timeout_ > 0) {
+    this->connect_count_++;
+    this->connect_ms_total_ += millis() - connect_start;
+    ESP_LOGD(TAG, "Connected to %s in %" PRIu32 "ms, %" PRIu32 " of %" PRIu32 " requests reused a connection",
+             origin.c_str(), millis() - connect_start, this->reused_count_, this->request_count_);
+  }
+
+  container->content_length = content_length;
   container->feed_wdt();
   container->status_code = esp_http_client_get_status_code(client);
   container->feed_wdt();
   container->set_response_headers(user_data.response_headers);
   container->duration_ms = millis() - start;
   if (is_success(container->status_code)) {
+    if (this->keep_alive_timeout_ > 0)
+      container->set_reusable(origin, std::move(header_names));
     return container;
   }
 
@@ -233,8 +371,24 @@ int HttpContainerIDF::read(uint8_t *buf, size_t max_len) {
 void HttpContainerIDF::end() {
   watchdog::WatchdogManager wdm(this->parent_->get_watchdog_timeout());
 
-  esp_http_client_close(this->client_);
-  esp_http_client_cleanup(this->client_);
+  if (!this->origin_.empty()) {
+    // The next response can only be read once this one was received completely
+    uint8_t buf[256];
+    size_t drained = 0;
+    while (!esp_http_client_is_complete_data_received(this->client_) && drained < MAX_DRAIN_SIZE) {
+      int read_len = esp_http_client_read(this->client_, (char *) buf, sizeof(buf));
+      if (read_len <= 0)
+        break;
+      drained += read_len;
+    }
+    if (esp_http_client_is_complete_data_received(this->client_)) {
+      static_cast<HttpRequestIDF *>(this->parent_)
+          ->release_client_(this->origin_, this->client_, std::move(this->header_names_));
+      return;
+    }
+  }
+
+  close_client(this->client_);
 }
 
 void HttpContainerIDF::feed_wdt() {
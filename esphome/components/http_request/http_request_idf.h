@@ -9,15 +9,26 @@
 #include <esp_netif.h>
 #include <esp_tls.h>
 
+#include <string>
+#include <vector>
+
 namespace esphome {
 namespace http_request {
 
+class HttpRequestIDF;
+
 class HttpContainerIDF : public HttpContainer {
  public:
   HttpContainerIDF(esp_http_client_handle_t client) : client_(client) {}
   int read(uint8_t *buf, size_t max_len) override;
   void end() override;
 
+  /// Lets end() keep the connection open for the next request to the same origin
+  void set_reusable(std::string origin, std::vector<std::string> header_names) {
+    this->origin_ = std::move(origin);
+    this->header_names_ = std::move(header_names);
+  }
+
   /// @brief Feeds the watchdog timer if the executing task has one attached
   void feed_wdt();
 
@@ -27,22 +38,64 @@ class HttpContainerIDF : public HttpContainer {
 
  protected:
   esp_http_client_handle_t client_;
+  /// Scheme, credentials, host and port of the URL, empty if the connection can't be reused
+  std::string origin_{};
+  /// Request headers that must be removed before the client sends the next request
+  std::vector<std::string> header_names_{};
 };
 
 class HttpRequestIDF : public HttpRequestComponent {
  public:
+  void setup() override;
+  void loop() override;
   void dump_config() override;
 
   void set_buffer_size_rx(uint16_t buffer_size_rx) { this->buffer_size_rx_ = buffer_size_rx; }
   void set_buffer_size_tx(uint16_t buffer_size_tx) { this->buffer_size_tx_ = buffer_size_tx; }
+  void set_keep_alive_timeout(uint32_t keep_alive_timeout) { this->keep_alive_timeout_ = keep_alive_timeout; }
+
+  /// Number of requests, and how many of them were sent over an open connection
+  uint32_t get_request_count() const { return this->request_count_; }
+  uint32_t get_reused_count() const { return this->reused_count_; }
+  /// Average time to open a new connection, TLS handshake included
+  uint32_t get_average_connect_ms() const {
+    return this->connect_count_ > 0 ? this->connect_ms_total_ / this->connect_count_ : 0;
+  }
 
  protected:
+  friend class HttpContainerIDF;
+
+  struct IdleClient {
+    std::string origin;
+    esp_http_client_handle_t client;
+    std::vector<std::string> header_names;
+    uint32_t since;
+  };
+  /// Keeps at most this many open connections to different origins
+  static constexpr size_t MAX_IDLE_CLIENTS = 2;
+
+  /// Returns an open connection to the origin and the headers its last request set, or nullptr
+  esp_http_client_handle_t take_idle_client_(const std::string &origin, std::vector<std::string> &header_names);
+  /// Keeps the client of a completed request open until keep_alive_timeout_, can be called from any task
+  void release_client_(const std::string &origin, esp_http_client_handle_t client,
+                       std::vector<std::string> header_names);
+
   std::shared_ptr<HttpContainer> perform(std::string url, std::string method, std::string body,
                                          std::list<Header> request_headers,
                                          std::set<std::string> collect_headers) override;
   // if zero ESP-IDF will use DEFAULT_HTTP_BUF_SIZE
   uint16_t buffer_size_rx_{};
   uint16_t buffer_size_tx_{};
+  // zero closes every connection after its request
+  uint32_t keep_alive_timeout_{0};
+
+  // protects idle_clients_, the http_request update runs on its own task
+  Mutex idle_lock_;
+  std::vector<IdleClient> idle_clients_{};
+  uint32_t request_count_{0};
+  uint32_t reused_count_{0};
+  uint32_t connect_count_{0};
+  uint32_t connect_ms_total_{0};
 
   /// @brief Monitors the http client events to gather response headers
   static esp_err_t http_event_handler(esp_http_client_event_t *evt);
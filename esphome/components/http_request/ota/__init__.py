@@ -2,7 +2,13 @@ from esphome import automation
 import esphome.codegen as cg
 from esphome.components.ota import BASE_OTA_SCHEMA, OTAComponent, ota_to_code
 import esphome.config_validation as cv
-from esphome.const import CONF_ID, CONF_PASSWORD, CONF_URL, CONF_USERNAME
+from esphome.const import (
+    CONF_BUFFER_SIZE,
+    CONF_ID,
+    CONF_PASSWORD,
+    CONF_URL,
+    CONF_USERNAME,
+)
 from esphome.core import coroutine_with_priority
 
 from .. import CONF_HTTP_REQUEST_ID, HttpRequestComponent, http_request_ns
@@ -14,6 +20,7 @@ DEPENDENCIES = ["network", "http_request"]
 
 CONF_MD5 = "md5"
 CONF_MD5_URL = "md5_url"
+CONF_RESUME_ATTEMPTS = "resume_attempts"
 
 OtaHttpRequestComponent = http_request_ns.class_(
     "OtaHttpRequestComponent", OTAComponent
@@ -27,6 +34,12 @@ CONFIG_SCHEMA = cv.All(
         {
             cv.GenerateID(): cv.declare_id(OtaHttpRequestComponent),
             cv.GenerateID(CONF_HTTP_REQUEST_ID): cv.use_id(HttpRequestComponent),
+            cv.Optional(CONF_BUFFER_SIZE, default=1024): cv.int_range(
+                min=256, max=16384
+            ),
+            cv.Optional(CONF_RESUME_ATTEMPTS, default=3): cv.int_range(
+                min=0, max=255
+            ),
         }
     )
     .extend(BASE_OTA_SCHEMA)
@@ -46,6 +59,8 @@ async def to_code(config):
     await ota_to_code(var, config)
     await cg.register_component(var, config)
     await cg.register_parented(var, config[CONF_HTTP_REQUEST_ID])
+    cg.add(var.set_buffer_size(config[CONF_BUFFER_SIZE]))
+    cg.add(var.set_resume_attempts(config[CONF_RESUME_ATTEMPTS]))
 
 
 OTA_HTTP_REQUEST_FLASH_ACTION_SCHEMA = cv.All(
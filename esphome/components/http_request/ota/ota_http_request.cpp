@@ -12,10 +12,14 @@
 #include "esphome/components/ota/ota_backend_arduino_rp2040.h"
 #include "esphome/components/ota/ota_backend_esp_idf.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace http_request {
 
 static const char *const TAG = "http_request.ota";
+// Wait before resuming a broken download, multiplied by the number of the attempt
+static const uint32_t RESUME_BACKOFF_MS = 1000;
 
 void OtaHttpRequestComponent::setup() {
 #ifdef USE_OTA_STATE_CALLBACK
@@ -23,7 +27,13 @@ void OtaHttpRequestComponent::setup() {
 #endif
 }
 
-void OtaHttpRequestComponent::dump_config() { ESP_LOGCONFIG(TAG, "Over-The-Air updates via HTTP request"); };
+void OtaHttpRequestComponent::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Over-The-Air updates via HTTP request:\n"
+                "  Buffer Size: %u\n"
+                "  Resume Attempts: %u",
+                this->buffer_size_, this->resume_attempts_);
+};
 
 void OtaHttpRequestComponent::set_md5_url(const std::string &url) {
   if (!this->validate_url_(url)) {
@@ -80,12 +90,13 @@ void OtaHttpRequestComponent::cleanup_(std::unique_ptr<ota::OTABackend> backend,
     ESP_LOGV(TAG, "Aborting OTA backend");
     backend->abort();
   }
-  ESP_LOGV(TAG, "Aborting HTTP connection");
-  container->end();
+  if (container != nullptr) {
+    ESP_LOGV(TAG, "Aborting HTTP connection");
+    container->end();
+  }
 };
 
 uint8_t OtaHttpRequestComponent::do_ota_() {
-  uint8_t buf[OtaHttpRequestComponent::HTTP_RECV_BUFFER + 1];
   uint32_t last_progress = 0;
   uint32_t update_start_time = millis();
   md5::MD5Digest md5_receive;
@@ -109,6 +120,8 @@ uint8_t OtaHttpRequestComponent::do_ota_() {
   if (container == nullptr || container->status_code != HTTP_STATUS_OK) {
     return OTA_CONNECTION_ERROR;
   }
+  const size_t image_size = container->content_length;
+  std::unique_ptr<uint8_t[]> buf(new uint8_t[this->buffer_size_]);
 
   // we will compute MD5 on the fly for verification -- Arduino OTA seems to ignore it
   md5_receive.init();
@@ -123,41 +136,63 @@ uint8_t OtaHttpRequestComponent::do_ota_() {
     return error_code;
   }
 
-  while (container->get_bytes_read() < container->content_length) {
-    // read a maximum of chunk_size bytes into buf. (real read size returned)
-    int bufsize = container->read(buf, OtaHttpRequestComponent::HTTP_RECV_BUFFER);
-    ESP_LOGVV(TAG, "bytes_read_ = %u, body_length_ = %u, bufsize = %i", container->get_bytes_read(),
-              container->content_length, bufsize);
+  size_t received = 0;
+  uint8_t resumes = 0;
+  uint32_t last_data = millis();
+  while (received < image_size) {
+    // read a maximum of buffer_size_ bytes into buf. (real read size returned)
+    int bufsize = container->read(buf.get(), std::min<size_t>(this->buffer_size_, image_size - received));
+    ESP_LOGVV(TAG, "received = %zu, image_size = %zu, bufsize = %i", received, image_size, bufsize);
 
     // feed watchdog and give other tasks a chance to run
     App.feed_wdt();
     yield();
 
-    if (bufsize < 0) {
-      ESP_LOGE(TAG, "Stream closed");
-      this->cleanup_(std::move(backend), container);
-      return OTA_CONNECTION_ERROR;
-    } else if (bufsize > 0 && bufsize <= OtaHttpRequestComponent::HTTP_RECV_BUFFER) {
+    uint32_t now = millis();
+    if (bufsize > 0) {
+      last_data = now;
       // add read bytes to MD5
-      md5_receive.add(buf, bufsize);
+      md5_receive.add(buf.get(), bufsize);
 
       // write bytes to OTA backend
       this->update_started_ = true;
-      error_code = backend->write(buf, bufsize);
+      error_code = backend->write(buf.get(), bufsize);
       if (error_code != ota::OTA_RESPONSE_OK) {
         // error code explanation available at
         // https://github.com/esphome/esphome/blob/dev/esphome/components/ota/ota_backend.h
-        ESP_LOGE(TAG, "Error code (%02X) writing binary data to flash at offset %d and size %d", error_code,
-                 container->get_bytes_read() - bufsize, container->content_length);
+        ESP_LOGE(TAG, "Error code (%02X) writing binary data to flash at offset %zu and size %zu", error_code, received,
+                 image_size);
         this->cleanup_(std::move(backend), container);
         return error_code;
       }
+      received += bufsize;
+    } else if (bufsize < 0 || now - last_data > this->parent_->get_timeout()) {
+      // The backend stays open, written data is kept and the download continues where it broke off
+      ESP_LOGW(TAG, "Stream closed at %zu of %zu bytes", received, image_size);
+      container->end();
+      container = nullptr;
+      while (container == nullptr) {
+        if (resumes >= this->resume_attempts_) {
+          ESP_LOGE(TAG, "Download failed after %u resume attempts", resumes);
+          this->cleanup_(std::move(backend), container);
+          return OTA_CONNECTION_ERROR;
+        }
+        resumes++;
+        const uint32_t wait_start = millis();
+        while (millis() - wait_start < RESUME_BACKOFF_MS * resumes) {
+          App.feed_wdt();
+          delay(10);
+        }
+        ESP_LOGI(TAG, "Resuming download (attempt %u of %u)", resumes, this->resume_attempts_);
+        container = this->resume_(url_with_auth, received, image_size);
+      }
+      last_data = millis();
+      continue;
     }
 
-    uint32_t now = millis();
-    if ((now - last_progress > 1000) or (container->get_bytes_read() == container->content_length)) {
+    if ((now - last_progress > 1000) or (received == image_size)) {
       last_progress = now;
-      float percentage = container->get_bytes_read() * 100.0f / container->content_length;
+      float percentage = received * 100.0f / image_size;
       ESP_LOGD(TAG, "Progress: %0.1f%%", percentage);
 #ifdef USE_OTA_STATE_CALLBACK
       this->state_callback_.call(ota::OTA_IN_PROGRESS, percentage, 0);
@@ -216,6 +251,25 @@ std::string OtaHttpRequestComponent::get_url_with_auth_(const std::string &url)
   return url_with_auth;
 }
 
+std::shared_ptr<HttpContainer> OtaHttpRequestComponent::resume_(const std::string &url, size_t offset,
+                                                                size_t image_size) {
+  std::list<Header> headers;
+  headers.push_back({"Range", str_sprintf("bytes=%" PRIu32 "-", static_cast<uint32_t>(offset))});
+  auto container = this->parent_->get(url, headers, {"content-range"});
+  if (container == nullptr)
+    return nullptr;
+
+  // A server without range support answers with the whole image, which can't be appended to the written part
+  const std::string expected_range = str_sprintf("bytes %" PRIu32 "-", static_cast<uint32_t>(offset));
+  if (container->status_code != HTTP_STATUS_PARTIAL_CONTENT || container->content_length != image_size - offset ||
+      !str_startswith(container->get_response_header("content-range"), expected_range)) {
+    ESP_LOGW(TAG, "Server can't continue the download at %zu (status %d)", offset, container->status_code);
+    container->end();
+    return nullptr;
+  }
+  return container;
+}
+
 bool OtaHttpRequestComponent::http_get_md5_() {
   if (this->md5_url_.empty()) {
     return false;
@@ -32,6 +32,8 @@ class OtaHttpRequestComponent : public ota::OTAComponent, public Parented<HttpRe
   void set_md5(const std::string &md5) { this->md5_expected_ = md5; }
   void set_password(const std::string &password) { this->password_ = password; }
   void set_url(const std::string &url);
+  void set_buffer_size(uint16_t buffer_size) { this->buffer_size_ = buffer_size; }
+  void set_resume_attempts(uint8_t resume_attempts) { this->resume_attempts_ = resume_attempts; }
   void set_username(const std::string &username) { this->username_ = username; }
 
   std::string md5_computed() { return this->md5_computed_; }
@@ -43,6 +45,8 @@ class OtaHttpRequestComponent : public ota::OTAComponent, public Parented<HttpRe
   void cleanup_(std::unique_ptr<ota::OTABackend> backend, const std::shared_ptr<HttpContainer> &container);
   uint8_t do_ota_();
   std::string get_url_with_auth_(const std::string &url);
+  /// Requests the rest of the image from offset on, nullptr if the server can't continue there
+  std::shared_ptr<HttpContainer> resume_(const std::string &url, size_t offset, size_t image_size);
   bool http_get_md5_();
   bool validate_url_(const std::string &url);
 
@@ -54,7 +58,9 @@ class OtaHttpRequestComponent : public ota::OTAComponent, public Parented<HttpRe
   std::string url_{};
   int status_ = -1;
   bool update_started_ = false;
-  static const uint16_t HTTP_RECV_BUFFER = 256;  // the firmware GET chunk size
+  uint16_t buffer_size_{1024};  // the firmware GET chunk size
+  // how often a download that broke off continues with a range request
+  uint8_t resume_attempts_{3};
 };
 
 }  // namespace http_request
@@ -21,10 +21,40 @@ void HX711Sensor::dump_config() {
   LOG_SENSOR("", "HX711", this);
   LOG_PIN("  DOUT Pin: ", this->dout_pin_);
   LOG_PIN("  SCK Pin: ", this->sck_pin_);
+  ESP_LOGCONFIG(TAG, "  Continuous: %s", YESNO(this->continuous_));
   LOG_UPDATE_INTERVAL(this);
 }
 float HX711Sensor::get_setup_priority() const { return setup_priority::DATA; }
+void HX711Sensor::loop() {
+  if (!this->continuous_) {
+    this->disable_loop();
+    return;
+  }
+  // DOUT goes low once a conversion is ready, at 10 or 80 Hz depending on the RATE pin
+  if (this->dout_pin_->digital_read())
+    return;
+  uint32_t result;
+  if (this->read_sensor_(&result)) {
+    this->sample_sum_ += static_cast<int32_t>(result);
+    this->sample_count_++;
+  }
+}
+
 void HX711Sensor::update() {
+  if (this->continuous_) {
+    if (this->sample_count_ == 0) {
+      ESP_LOGW(TAG, "'%s': No samples since the last update", this->name_.c_str());
+      this->status_set_warning();
+      return;
+    }
+    float value = static_cast<float>(this->sample_sum_) / this->sample_count_;
+    ESP_LOGD(TAG, "'%s': Got value %.1f from %" PRIu32 " samples", this->name_.c_str(), value, this->sample_count_);
+    this->sample_sum_ = 0;
+    this->sample_count_ = 0;
+    this->publish_state(value);
+    return;
+  }
+
   uint32_t result;
   if (this->read_sensor_(&result)) {
     int32_t value = static_cast<int32_t>(result);
@@ -40,27 +70,31 @@ bool HX711Sensor::read_sensor_(uint32_t *result) {
   }
 
   uint32_t data = 0;
-  bool final_dout;
 
-  {
-    InterruptLock lock;
-    for (uint8_t i = 0; i < 24; i++) {
+  // SCK high for more than 60 us powers the chip down, so interrupts are held off while it is high. The low phase
+  // has no upper limit, so interrupts are only held off for a bit at a time instead of for the whole read.
+  for (uint8_t i = 0; i < 24; i++) {
+    {
+      InterruptLock lock;
       this->sck_pin_->digital_write(true);
       delayMicroseconds(1);
       data |= uint32_t(this->dout_pin_->digital_read()) << (23 - i);
       this->sck_pin_->digital_write(false);
-      delayMicroseconds(1);
     }
+    delayMicroseconds(1);
+  }
 
-    // Cycle clock pin for gain setting
-    for (uint8_t i = 0; i < static_cast<uint8_t>(this->gain_); i++) {
+  // Cycle clock pin for gain setting
+  for (uint8_t i = 0; i < static_cast<uint8_t>(this->gain_); i++) {
+    {
+      InterruptLock lock;
       this->sck_pin_->digital_write(true);
       delayMicroseconds(1);
       this->sck_pin_->digital_write(false);
-      delayMicroseconds(1);
     }
-    final_dout = this->dout_pin_->digital_read();
+    delayMicroseconds(1);
   }
+  bool final_dout = this->dout_pin_->digital_read();
 
   if (!final_dout) {
     ESP_LOGW(TAG, "HX711 DOUT pin not high after reading (data 0x%" PRIx32 ")!", data);
@@ -20,8 +20,11 @@ class HX711Sensor : public sensor::Sensor, public PollingComponent {
   void set_dout_pin(GPIOPin *dout_pin) { dout_pin_ = dout_pin; }
   void set_sck_pin(GPIOPin *sck_pin) { sck_pin_ = sck_pin; }
   void set_gain(HX711Gain gain) { gain_ = gain; }
+  /// Read every conversion in the loop and publish the average of the samples since the last update
+  void set_continuous(bool continuous) { continuous_ = continuous; }
 
   void setup() override;
+  void loop() override;
   void dump_config() override;
   float get_setup_priority() const override;
   void update() override;
@@ -31,7 +34,10 @@ class HX711Sensor : public sensor::Sensor, public PollingComponent {
 
   GPIOPin *dout_pin_;
   GPIOPin *sck_pin_;
+  int64_t sample_sum_{0};
+  uint32_t sample_count_{0};
   HX711Gain gain_{HX711_GAIN_128};
+  bool continuous_{false};
 };
 
 }  // namespace hx711
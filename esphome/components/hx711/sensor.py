@@ -2,7 +2,13 @@ from esphome import pins
 import esphome.codegen as cg
 from esphome.components import sensor
 import esphome.config_validation as cv
-from esphome.const import CONF_CLK_PIN, CONF_GAIN, ICON_SCALE, STATE_CLASS_MEASUREMENT
+from esphome.const import (
+    CONF_CLK_PIN,
+    CONF_CONTINUOUS,
+    CONF_GAIN,
+    ICON_SCALE,
+    STATE_CLASS_MEASUREMENT,
+)
 
 hx711_ns = cg.esphome_ns.namespace("hx711")
 HX711Sensor = hx711_ns.class_("HX711Sensor", sensor.Sensor, cg.PollingComponent)
@@ -28,6 +34,7 @@ CONFIG_SCHEMA = (
             cv.Required(CONF_DOUT_PIN): pins.gpio_input_pin_schema,
             cv.Required(CONF_CLK_PIN): pins.gpio_output_pin_schema,
             cv.Optional(CONF_GAIN, default=128): cv.enum(GAINS, int=True),
+            cv.Optional(CONF_CONTINUOUS, default=False): cv.boolean,
         }
     )
     .extend(cv.polling_component_schema("60s"))
@@ -43,3 +50,4 @@ async def to_code(config):
     sck_pin = await cg.gpio_pin_expression(config[CONF_CLK_PIN])
     cg.add(var.set_sck_pin(sck_pin))
     cg.add(var.set_gain(config[CONF_GAIN]))
+    cg.add(var.set_continuous(config[CONF_CONTINUOUS]))
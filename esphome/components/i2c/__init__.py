@@ -150,6 +150,11 @@ async def register_i2c_device(var, config):
     parent = await cg.get_variable(config[CONF_I2C_ID])
     cg.add(var.set_i2c_bus(parent))
     cg.add(var.set_i2c_address(config[CONF_ADDRESS]))
+    # Spread the updates of the sensors on one bus apart
+    if (id_ := config.get(CONF_ID)) is not None and id_.type.inherits_from(
+        cg.PollingComponent
+    ):
+        cg.add(var.set_polling_group(parent))
 
 
 def final_validate_device_schema(
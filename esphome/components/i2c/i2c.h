@@ -172,6 +172,22 @@ class I2CDevice {
   /// @return an i2c::ErrorCode
   ErrorCode read_register(uint8_t a_register, uint8_t *data, size_t len, bool stop = true);
 
+  /// @brief Queues reading a register without waiting for the bus, see I2CBus::submit()
+  /// @param a_register address of the register to read from
+  /// @param data buffer for the bytes read, must stay valid until the callback ran
+  /// @param len length of the buffer = number of bytes to read
+  /// @param callback called from the main loop with the result
+  /// @return false if the read could not be queued
+  bool read_register_async(uint8_t a_register, uint8_t *data, size_t len, TransactionCallback &&callback) {
+    return bus_->submit(address_, &a_register, 1, data, len, std::move(callback));
+  }
+
+  /// @brief Queues a write followed by a read without waiting for the bus, see I2CBus::submit()
+  bool transfer_async(const uint8_t *write_data, size_t write_len, uint8_t *read_data, size_t read_len,
+                      TransactionCallback &&callback) {
+    return bus_->submit(address_, write_data, write_len, read_data, read_len, std::move(callback));
+  }
+
   /// @brief reads an array of bytes from a specific register in the I²C device
   /// @param a_register the 16 bits internal address of the I²C register to read from
   /// @param data pointer to an array of bytes to store the information
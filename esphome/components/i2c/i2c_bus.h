@@ -1,6 +1,7 @@
 #pragma once
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <utility>
 #include <vector>
 
@@ -32,6 +33,9 @@ struct WriteBuffer {
   size_t len;           ///< length of the buffer
 };
 
+/// @brief Called with the result of a transaction queued with I2CBus::submit()
+using TransactionCallback = std::function<void(ErrorCode)>;
+
 /// @brief This Class provides the methods to read and write bytes from an I2CBus.
 /// @note The I2CBus virtual class follows a *Factory design pattern* that provides all the interfaces methods required
 /// by clients while deferring the actual implementation of these methods to a subclasses. I2C-bus specification and
@@ -91,6 +95,32 @@ class I2CBus {
   /// @details This is a pure virtual method that must be implemented in the subclass.
   virtual ErrorCode writev(uint8_t address, WriteBuffer *buffers, size_t count, bool stop) = 0;
 
+  /// @brief Queues a write followed by a read and returns without waiting for the bus.
+  /// @param address address of the I²C component on the i2c bus
+  /// @param write_data bytes to send first, copied if the bus queues them
+  /// @param write_len number of bytes to send, at most MAX_TRANSACTION_WRITE
+  /// @param read_data buffer for the bytes read afterwards, must stay valid until the callback ran
+  /// @param read_len number of bytes to read, 0 to only write
+  /// @param callback called from the main loop with the result once the transaction finished
+  /// @return false if the transaction could not be queued, the callback is not called then
+  /// @details Buses without a queue run the transaction right away and call the callback before returning.
+  virtual bool submit(uint8_t address, const uint8_t *write_data, size_t write_len, uint8_t *read_data,
+                      size_t read_len, TransactionCallback &&callback) {
+    if (write_len > MAX_TRANSACTION_WRITE)
+      return false;
+    ErrorCode err = ERROR_OK;
+    if (write_len > 0 || read_len == 0)
+      err = this->write(address, write_data, write_len);
+    if (err == ERROR_OK && read_len > 0)
+      err = this->read(address, read_data, read_len);
+    if (callback)
+      callback(err);
+    return true;
+  }
+
+  /// @brief Most bytes a queued transaction writes, enough for a register address or a short command
+  static constexpr size_t MAX_TRANSACTION_WRITE = 8;
+
  protected:
   /// @brief Scans the I2C bus for devices. Devices presence is kept in an array of std::pair
   /// that contains the address and the corresponding bool presence flag.
@@ -80,6 +80,8 @@ void IDFI2CBus::setup() {
     ESP_LOGV(TAG, "Scanning for devices");
     this->i2c_scan();
   }
+  this->record_stats_ = true;
+  this->disable_loop();
 #else
 #if SOC_HP_I2C_NUM > 1
   next_port = (next_port == I2C_NUM_0) ? I2C_NUM_1 : I2C_NUM_MAX;
@@ -127,6 +129,8 @@ void IDFI2CBus::setup() {
     ESP_LOGV(TAG, "Scanning bus for active devices");
     this->i2c_scan();
   }
+  this->record_stats_ = true;
+  this->disable_loop();
 #endif
 }
 
@@ -165,6 +169,136 @@ void IDFI2CBus::dump_config() {
       }
     }
   }
+  LockGuard guard(this->lock_);
+  for (const auto &stats : this->stats_) {
+    ESP_LOGCONFIG(TAG,
+                  "  Device 0x%02X:\n"
+                  "    Transactions: %" PRIu32 "\n"
+                  "    Errors: %" PRIu32 "\n"
+                  "    Average Time: %" PRIu32 "us\n"
+                  "    Max Time: %" PRIu32 "us",
+                  stats.address, stats.transactions, stats.errors,
+                  static_cast<uint32_t>(stats.total_us / stats.transactions), stats.max_us);
+  }
+}
+
+void IDFI2CBus::loop() {
+  I2CTransaction *transaction;
+  while ((transaction = this->results_.pop()) != nullptr) {
+    this->queued_--;
+    if (transaction->callback)
+      transaction->callback(transaction->error);
+    this->transaction_pool_.release(transaction);
+  }
+  if (this->queued_ == 0)
+    this->disable_loop();
+}
+
+ErrorCode IDFI2CBus::readv(uint8_t address, ReadBuffer *buffers, size_t cnt) {
+  LockGuard guard(this->lock_);
+  const uint32_t start = micros();
+  ErrorCode err = this->readv_(address, buffers, cnt);
+  this->record_(address, start, err);
+  return err;
+}
+
+ErrorCode IDFI2CBus::writev(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) {
+  LockGuard guard(this->lock_);
+  const uint32_t start = micros();
+  ErrorCode err = this->writev_(address, buffers, cnt, stop);
+  this->record_(address, start, err);
+  return err;
+}
+
+bool IDFI2CBus::submit(uint8_t address, const uint8_t *write_data, size_t write_len, uint8_t *read_data,
+                       size_t read_len, TransactionCallback &&callback) {
+  if (write_len > MAX_TRANSACTION_WRITE || !this->initialized_)
+    return false;
+  if (this->task_handle_ == nullptr && !this->start_transaction_task_())
+    return false;
+
+  I2CTransaction *transaction = this->transaction_pool_.allocate();
+  if (transaction == nullptr)
+    return false;
+  transaction->callback = std::move(callback);
+  transaction->read_data = read_data;
+  transaction->read_len = read_len;
+  if (write_len > 0)
+    memcpy(transaction->write_data, write_data, write_len);
+  transaction->write_len = write_len;
+  transaction->address = address;
+  if (!this->requests_.push(transaction)) {
+    this->transaction_pool_.release(transaction);
+    return false;
+  }
+  this->queued_++;
+  this->enable_loop();
+  return true;
+}
+
+bool IDFI2CBus::start_transaction_task_() {
+  if (xTaskCreate(IDFI2CBus::transaction_task_, "i2c", 3072, this, 2, &this->task_handle_) != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create transaction task");
+    this->task_handle_ = nullptr;
+    return false;
+  }
+  this->requests_.set_task_to_notify(this->task_handle_);
+  return true;
+}
+
+void IDFI2CBus::transaction_task_(void *arg) {
+  auto *self = static_cast<IDFI2CBus *>(arg);
+  while (true) {
+    I2CTransaction *transaction = self->requests_.pop();
+    if (transaction == nullptr) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+    {
+      // Holding the lock over both halves keeps transactions of the main loop from getting between them
+      LockGuard guard(self->lock_);
+      const uint32_t start = micros();
+      ErrorCode err = ERROR_OK;
+      if (transaction->write_len > 0 || transaction->read_len == 0) {
+        WriteBuffer buf{transaction->write_data, transaction->write_len};
+        err = self->writev_(transaction->address, &buf, 1, true);
+      }
+      if (err == ERROR_OK && transaction->read_len > 0) {
+        ReadBuffer buf{transaction->read_data, transaction->read_len};
+        err = self->readv_(transaction->address, &buf, 1);
+      }
+      self->record_(transaction->address, start, err);
+      transaction->error = err;
+    }
+    // Never full, there are no more transactions than it holds
+    self->results_.push(transaction);
+#ifdef USE_EVENT_DRIVEN_LOOP
+    App.wake_loop_threadsafe();
+#endif
+  }
+}
+
+void IDFI2CBus::record_(uint8_t address, uint32_t start_us, ErrorCode err) {
+  if (!this->record_stats_)
+    return;
+  const uint32_t elapsed = micros() - start_us;
+  I2CDeviceStats *stats = nullptr;
+  for (auto &entry : this->stats_) {
+    if (entry.address == address) {
+      stats = &entry;
+      break;
+    }
+  }
+  if (stats == nullptr) {
+    this->stats_.push_back(I2CDeviceStats{address, 0, 0, 0, 0});
+    stats = &this->stats_.back();
+  }
+  stats->transactions++;
+  if (err != ERROR_OK)
+    stats->errors++;
+  stats->total_us += elapsed;
+  if (elapsed > stats->max_us)
+    stats->max_us = elapsed;
 }
 
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 4, 2)
@@ -178,7 +312,7 @@ void IDFI2CBus::i2c_scan() {
 }
 #endif
 
-ErrorCode IDFI2CBus::readv(uint8_t address, ReadBuffer *buffers, size_t cnt) {
+ErrorCode IDFI2CBus::readv_(uint8_t address, ReadBuffer *buffers, size_t cnt) {
   // logging is only enabled with vv level, if warnings are shown the caller
   // should log them
   if (!initialized_) {
@@ -317,7 +451,7 @@ ErrorCode IDFI2CBus::readv(uint8_t address, ReadBuffer *buffers, size_t cnt) {
   return ERROR_OK;
 }
 
-ErrorCode IDFI2CBus::writev(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) {
+ErrorCode IDFI2CBus::writev_(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) {
   // logging is only enabled with vv level, if warnings are shown the caller
   // should log them
   if (!initialized_) {
@@ -4,7 +4,15 @@
 
 #include "esp_idf_version.h"
 #include "esphome/core/component.h"
+#include "esphome/core/event_pool.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/lock_free_queue.h"
 #include "i2c_bus.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <vector>
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 4, 2)
 #include <driver/i2c_master.h>
 #else
@@ -20,12 +28,39 @@ enum RecoveryCode {
   RECOVERY_COMPLETED,
 };
 
+/// A transaction queued with IDFI2CBus::submit()
+struct I2CTransaction {
+  TransactionCallback callback;
+  uint8_t *read_data;
+  size_t read_len;
+  uint8_t write_data[I2CBus::MAX_TRANSACTION_WRITE];
+  uint8_t write_len;
+  uint8_t address;
+  ErrorCode error;
+
+  void release() { this->callback = nullptr; }
+};
+
+/// Transactions and bus time of one device, to find the devices that keep the bus busy
+struct I2CDeviceStats {
+  uint8_t address;
+  uint32_t transactions;
+  uint32_t errors;
+  uint64_t total_us;
+  uint32_t max_us;
+};
+
 class IDFI2CBus : public InternalI2CBus, public Component {
  public:
   void setup() override;
+  void loop() override;
   void dump_config() override;
   ErrorCode readv(uint8_t address, ReadBuffer *buffers, size_t cnt) override;
   ErrorCode writev(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) override;
+  /// Runs the transaction on a task of the bus, so the main loop continues while it waits for the device.
+  /// Must be called from the main loop, like the callback is.
+  bool submit(uint8_t address, const uint8_t *write_data, size_t write_len, uint8_t *read_data, size_t read_len,
+              TransactionCallback &&callback) override;
   float get_setup_priority() const override { return setup_priority::BUS; }
 
   void set_scan(bool scan) { scan_ = scan; }
@@ -43,6 +78,14 @@ class IDFI2CBus : public InternalI2CBus, public Component {
   RecoveryCode recovery_result_;
 
  protected:
+  static constexpr uint8_t MAX_QUEUED_TRANSACTIONS = 16;
+
+  static void transaction_task_(void *arg);
+  bool start_transaction_task_();
+  ErrorCode readv_(uint8_t address, ReadBuffer *buffers, size_t cnt);
+  ErrorCode writev_(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop);
+  void record_(uint8_t address, uint32_t start_us, ErrorCode err);
+
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 4, 2)
   i2c_master_dev_handle_t dev_;
   i2c_master_bus_handle_t bus_;
@@ -56,6 +99,18 @@ class IDFI2CBus : public InternalI2CBus, public Component {
   uint32_t frequency_;
   uint32_t timeout_ = 0;
   bool initialized_ = false;
+
+  // Serializes transactions of the main loop and the transaction task
+  Mutex lock_;
+  std::vector<I2CDeviceStats> stats_;
+  bool record_stats_{false};
+
+  // Transactions go from the main loop to the task in requests_, and back when finished in results_
+  TaskHandle_t task_handle_{nullptr};
+  NotifyingLockFreeQueue<I2CTransaction, MAX_QUEUED_TRANSACTIONS + 1> requests_;
+  LockFreeQueue<I2CTransaction, MAX_QUEUED_TRANSACTIONS + 1> results_;
+  EventPool<I2CTransaction, MAX_QUEUED_TRANSACTIONS> transaction_pool_;
+  uint8_t queued_{0};
 };
 
 }  // namespace i2c
@@ -32,6 +32,7 @@ CONF_ADC_PIN = "adc_pin"
 CONF_ADC_TYPE = "adc_type"
 CONF_CORRECT_DC_OFFSET = "correct_dc_offset"
 CONF_PDM = "pdm"
+CONF_TDM_SLOTS = "tdm_slots"
 
 I2SAudioMicrophone = i2s_audio_ns.class_(
     "I2SAudioMicrophone", I2SAudioIn, microphone.Microphone, cg.Component
@@ -39,6 +40,14 @@ I2SAudioMicrophone = i2s_audio_ns.class_(
 
 INTERNAL_ADC_VARIANTS = [esp32.const.VARIANT_ESP32]
 PDM_VARIANTS = [esp32.const.VARIANT_ESP32, esp32.const.VARIANT_ESP32S3]
+TDM_VARIANTS = [
+    esp32.const.VARIANT_ESP32C3,
+    esp32.const.VARIANT_ESP32C5,
+    esp32.const.VARIANT_ESP32C6,
+    esp32.const.VARIANT_ESP32H2,
+    esp32.const.VARIANT_ESP32P4,
+    esp32.const.VARIANT_ESP32S3,
+]
 
 
 def _validate_esp32_variant(config):
@@ -47,6 +56,11 @@ def _validate_esp32_variant(config):
         if config[CONF_PDM]:
             if variant not in PDM_VARIANTS:
                 raise cv.Invalid(f"{variant} does not support PDM")
+        if CONF_TDM_SLOTS in config:
+            if config[CONF_PDM]:
+                raise cv.Invalid(f"{CONF_TDM_SLOTS} is not supported with PDM")
+            if variant not in TDM_VARIANTS:
+                raise cv.Invalid(f"{variant} does not support TDM")
         return config
     if config[CONF_ADC_TYPE] == "internal":
         if variant not in INTERNAL_ADC_VARIANTS:
@@ -62,7 +76,9 @@ def _validate_channel(config):
 
 
 def _set_num_channels_from_config(config):
-    if config[CONF_CHANNEL] in (CONF_LEFT, CONF_RIGHT):
+    if CONF_TDM_SLOTS in config:
+        config[CONF_NUM_CHANNELS] = config[CONF_TDM_SLOTS]
+    elif config[CONF_CHANNEL] in (CONF_LEFT, CONF_RIGHT):
         config[CONF_NUM_CHANNELS] = 1
     else:
         config[CONF_NUM_CHANNELS] = 2
@@ -108,6 +124,8 @@ CONFIG_SCHEMA = cv.All(
                 {
                     cv.Required(CONF_I2S_DIN_PIN): pins.internal_gpio_input_pin_number,
                     cv.Optional(CONF_PDM, default=False): cv.boolean,
+                    # Every slot becomes a channel, MicrophoneSource supports up to 8
+                    cv.Optional(CONF_TDM_SLOTS): cv.int_range(min=2, max=8),
                 }
             ),
         },
@@ -125,6 +143,8 @@ def _final_validate(config):
     if not use_legacy():
         if config[CONF_ADC_TYPE] == "internal":
             raise cv.Invalid("Internal ADC is only compatible with legacy i2s driver.")
+    elif CONF_TDM_SLOTS in config:
+        raise cv.Invalid("TDM is not supported by the legacy i2s driver.")
 
 
 FINAL_VALIDATE_SCHEMA = _final_validate
@@ -144,5 +164,7 @@ async def to_code(config):
     else:
         cg.add(var.set_din_pin(config[CONF_I2S_DIN_PIN]))
         cg.add(var.set_pdm(config[CONF_PDM]))
+        if CONF_TDM_SLOTS in config:
+            cg.add(var.set_tdm_slots(config[CONF_TDM_SLOTS]))
 
     cg.add(var.set_correct_dc_offset(config[CONF_CORRECT_DC_OFFSET]))
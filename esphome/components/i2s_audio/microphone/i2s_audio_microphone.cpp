@@ -7,6 +7,9 @@
 #else
 #include <driver/i2s_std.h>
 #include <driver/i2s_pdm.h>
+#if SOC_I2S_SUPPORTS_TDM
+#include <driver/i2s_tdm.h>
+#endif
 #endif
 
 #include "esphome/core/hal.h"
@@ -14,6 +17,8 @@
 
 #include "esphome/components/audio/audio.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace i2s_audio {
 
@@ -21,6 +26,10 @@ static const UBaseType_t MAX_LISTENERS = 16;
 
 static const uint32_t READ_DURATION_MS = 16;
 
+static const uint32_t DMA_FRAME_NUM = 256;
+// A DMA buffer holds at most 4092 bytes, which limits the frames per buffer with many TDM slots
+static const uint32_t DMA_BUFFER_MAX_BYTES = 4092;
+
 static const size_t TASK_STACK_SIZE = 4096;
 static const ssize_t TASK_PRIORITY = 23;
 
@@ -86,6 +95,11 @@ void I2SAudioMicrophone::dump_config() {
                 "  PDM: %s\n"
                 "  DC offset correction: %s",
                 static_cast<int8_t>(this->din_pin_), YESNO(this->pdm_), YESNO(this->correct_dc_offset_));
+#ifndef USE_I2S_LEGACY
+  if (this->tdm_slots_ > 0) {
+    ESP_LOGCONFIG(TAG, "  TDM slots: %u", this->tdm_slots_);
+  }
+#endif
 }
 
 void I2SAudioMicrophone::configure_stream_settings_() {
@@ -102,7 +116,9 @@ void I2SAudioMicrophone::configure_stream_settings_() {
     bits_per_sample = this->slot_bit_width_;
   }
 
-  if (this->slot_mode_ == I2S_SLOT_MODE_STEREO) {
+  if (this->tdm_slots_ > 0) {
+    channel_count = this->tdm_slots_;
+  } else if (this->slot_mode_ == I2S_SLOT_MODE_STEREO) {
     channel_count = 2;
   }
 #endif
@@ -202,9 +218,13 @@ bool I2SAudioMicrophone::start_driver_() {
       .id = this->parent_->get_port(),
       .role = this->i2s_role_,
       .dma_desc_num = 4,
-      .dma_frame_num = 256,
+      .dma_frame_num = DMA_FRAME_NUM,
       .auto_clear = false,
   };
+  if (this->tdm_slots_ > 0) {
+    const uint32_t slot_bytes = this->slot_bit_width_ == I2S_SLOT_BIT_WIDTH_AUTO ? 2 : this->slot_bit_width_ / 8;
+    chan_cfg.dma_frame_num = std::min(DMA_FRAME_NUM, DMA_BUFFER_MAX_BYTES / (this->tdm_slots_ * slot_bytes));
+  }
   /* Allocate a new RX channel and get the handle of this channel */
   err = i2s_new_channel(&chan_cfg, NULL, &this->rx_handle_);
   if (err != ESP_OK) {
@@ -257,6 +277,40 @@ bool I2SAudioMicrophone::start_driver_() {
     };
     err = i2s_channel_init_pdm_rx_mode(this->rx_handle_, &pdm_rx_cfg);
   } else
+#endif
+#if SOC_I2S_SUPPORTS_TDM
+  if (this->tdm_slots_ > 0) {
+    i2s_tdm_clk_config_t clk_cfg = {
+        .sample_rate_hz = this->sample_rate_,
+        .clk_src = clk_src,
+        .mclk_multiple = this->mclk_multiple_,
+    };
+    // All slots are read into one interleaved frame per sample, channel n of the stream is slot n
+    i2s_tdm_slot_config_t tdm_slot_cfg =
+        I2S_TDM_PHILIPS_SLOT_DEFAULT_CONFIG((i2s_data_bit_width_t) this->slot_bit_width_, I2S_SLOT_MODE_STEREO,
+                                            (i2s_tdm_slot_mask_t) ((1U << this->tdm_slots_) - 1));
+    tdm_slot_cfg.slot_bit_width = this->slot_bit_width_;
+
+    i2s_tdm_config_t tdm_cfg = {
+        .clk_cfg = clk_cfg,
+        .slot_cfg = tdm_slot_cfg,
+        .gpio_cfg =
+            {
+                .mclk = pin_config.mclk,
+                .bclk = pin_config.bclk,
+                .ws = pin_config.ws,
+                .dout = I2S_GPIO_UNUSED,
+                .din = this->din_pin_,
+                .invert_flags =
+                    {
+                        .mclk_inv = pin_config.invert_flags.mclk_inv,
+                        .bclk_inv = pin_config.invert_flags.bclk_inv,
+                        .ws_inv = pin_config.invert_flags.ws_inv,
+                    },
+            },
+    };
+    err = i2s_channel_init_tdm_mode(this->rx_handle_, &tdm_cfg);
+  } else
 #endif
   {
     i2s_std_clk_config_t clk_cfg = {
@@ -34,6 +34,11 @@ class I2SAudioMicrophone : public I2SAudioIn, public microphone::Microphone, pub
 
   void set_pdm(bool pdm) { this->pdm_ = pdm; }
 
+#ifndef USE_I2S_LEGACY
+  /// @brief Reads this many TDM slots as the channels of the stream, 0 reads standard I2S
+  void set_tdm_slots(uint8_t tdm_slots) { this->tdm_slots_ = tdm_slots; }
+#endif
+
 #ifdef USE_I2S_LEGACY
 #if SOC_I2S_SUPPORTS_ADC
   void set_adc_channel(adc_channel_t channel) {
@@ -77,6 +82,7 @@ class I2SAudioMicrophone : public I2SAudioIn, public microphone::Microphone, pub
 #else
   gpio_num_t din_pin_{I2S_GPIO_UNUSED};
   i2s_chan_handle_t rx_handle_;
+  uint8_t tdm_slots_{0};
 #endif
   bool pdm_{false};
 
@@ -23,6 +23,8 @@ static const uint8_t DMA_BUFFER_DURATION_MS = 15;
 static const size_t DMA_BUFFERS_COUNT = 4;
 
 static const size_t TASK_DELAY_MS = DMA_BUFFER_DURATION_MS * DMA_BUFFERS_COUNT / 2;
+// Shorter than a DMA buffer, so waiting for more audio doesn't cause an underflow
+static const size_t NO_DATA_DELAY_MS = DMA_BUFFER_DURATION_MS / 3;
 
 static const size_t TASK_STACK_SIZE = 4096;
 static const ssize_t TASK_PRIORITY = 23;
@@ -267,7 +269,7 @@ void I2SAudioSpeaker::speaker_task(void *params) {
 
   if (event_group_bits & (SpeakerEventGroupBits::COMMAND_STOP | SpeakerEventGroupBits::COMMAND_STOP_GRACEFULLY)) {
     // Received a stop signal before the task was requested to start
-    this_speaker->delete_task_(0);
+    this_speaker->delete_task_();
   }
 
   xEventGroupSetBits(this_speaker->event_group_, SpeakerEventGroupBits::STATE_STARTING);
@@ -278,16 +280,29 @@ void I2SAudioSpeaker::speaker_task(void *params) {
   // Ensure ring buffer duration is at least the duration of all DMA buffers
   const uint32_t ring_buffer_duration = std::max(dma_buffers_duration_ms, this_speaker->buffer_duration_ms_);
 
+  // The audio is processed in place in the ring buffer and written straight from it to the I2S driver. Only read
+  // whole units, so in place processing never splits a sample. The ring buffer size is a multiple of the unit, so data
+  // wrapping around its end also starts on a unit.
+  size_t read_unit_size = audio_stream_info.frames_to_bytes(1);
+#ifdef USE_ESP32_VARIANT_ESP32
+  if (audio_stream_info.get_channels() == 1 && audio_stream_info.get_bits_per_sample() <= 16) {
+    // Samples are swapped in pairs
+    read_unit_size = 2 * sizeof(int16_t);
+  }
+#endif
+
   // The DMA buffers may have more bits per sample, so calculate buffer sizes based in the input audio stream info
-  const size_t data_buffer_size = audio_stream_info.ms_to_bytes(dma_buffers_duration_ms);
-  const size_t ring_buffer_size = audio_stream_info.ms_to_bytes(ring_buffer_duration);
+  const size_t max_read_size = audio_stream_info.ms_to_bytes(dma_buffers_duration_ms);
+  // Audio being written to the I2S driver still occupies the ring buffer, so make room for it on top of the duration
+  size_t ring_buffer_size = audio_stream_info.ms_to_bytes(ring_buffer_duration) + max_read_size;
+  ring_buffer_size += (read_unit_size - ring_buffer_size % read_unit_size) % read_unit_size;
 
-  const size_t single_dma_buffer_input_size = data_buffer_size / DMA_BUFFERS_COUNT;
+  const size_t single_dma_buffer_input_size = max_read_size / DMA_BUFFERS_COUNT;
 
-  if (this_speaker->send_esp_err_to_event_group_(this_speaker->allocate_buffers_(data_buffer_size, ring_buffer_size))) {
+  if (this_speaker->send_esp_err_to_event_group_(this_speaker->allocate_buffers_(ring_buffer_size))) {
     // Failed to allocate buffers
     xEventGroupSetBits(this_speaker->event_group_, SpeakerEventGroupBits::ERR_ESP_NO_MEM);
-    this_speaker->delete_task_(data_buffer_size);
+    this_speaker->delete_task_();
   }
 
   if (!this_speaker->send_esp_err_to_event_group_(this_speaker->start_i2s_driver_(audio_stream_info))) {
@@ -296,6 +311,9 @@ void I2SAudioSpeaker::speaker_task(void *params) {
     bool stop_gracefully = false;
     uint32_t last_data_received_time = millis();
     bool tx_dma_underflow = false;
+#ifdef USE_AUDIO_STATS
+    bool wrote_since_underflow = false;  // Underflows before the first write or after the last one aren't underruns
+#endif
 
     this_speaker->accumulated_frames_written_ = 0;
 
@@ -334,6 +352,21 @@ void I2SAudioSpeaker::speaker_task(void *params) {
       }
 #endif
 
+#ifdef USE_AUDIO_STATS
+      if (this_speaker->audio_stats_ != nullptr) {
+        if (tx_dma_underflow && wrote_since_underflow && !stop_gracefully) {
+          this_speaker->audio_stats_->record_underrun();
+        }
+        const size_t available = this_speaker->audio_ring_buffer_->available();
+        this_speaker->audio_stats_->record_fill(available, this_speaker->audio_ring_buffer_->free());
+        this_speaker->audio_stats_->set_buffered_ms(audio_stream_info.bytes_to_ms(available) +
+                                                    (tx_dma_underflow ? 0 : dma_buffers_duration_ms));
+      }
+      if (tx_dma_underflow) {
+        wrote_since_underflow = false;
+      }
+#endif
+
       if (this_speaker->pause_state_) {
         // Pause state is accessed atomically, so thread safe
         // Delay so the task can yields, then skip transferring audio data
@@ -341,27 +374,42 @@ void I2SAudioSpeaker::speaker_task(void *params) {
         continue;
       }
 
-      size_t bytes_read = this_speaker->audio_ring_buffer_->read((void *) this_speaker->data_buffer_, data_buffer_size,
-                                                                 pdMS_TO_TICKS(TASK_DELAY_MS));
+      size_t bytes_to_read = std::min(this_speaker->audio_ring_buffer_->available(), max_read_size);
+      bytes_to_read -= bytes_to_read % read_unit_size;
+
+      size_t bytes_read = 0;
+      uint8_t *data = nullptr;
+      if (bytes_to_read > 0) {
+        data = this_speaker->audio_ring_buffer_->acquire_read(bytes_read, bytes_to_read);
+      }
 
-      if (bytes_read > 0) {
+      if (data != nullptr) {
+#ifdef USE_AUDIO_STATS
+        const uint32_t processing_start_us = micros();
+#endif
         if ((audio_stream_info.get_bits_per_sample() == 16) && (this_speaker->q15_volume_factor_ < INT16_MAX)) {
           // Scale samples by the volume factor in place
-          q15_multiplication((int16_t *) this_speaker->data_buffer_, (int16_t *) this_speaker->data_buffer_,
-                             bytes_read / sizeof(int16_t), this_speaker->q15_volume_factor_);
+          q15_multiplication((int16_t *) data, (int16_t *) data, bytes_read / sizeof(int16_t),
+                             this_speaker->q15_volume_factor_);
         }
 
 #ifdef USE_ESP32_VARIANT_ESP32
         // For ESP32 8/16 bit mono mode samples need to be switched.
         if (audio_stream_info.get_channels() == 1 && audio_stream_info.get_bits_per_sample() <= 16) {
           size_t len = bytes_read / sizeof(int16_t);
-          int16_t *tmp_buf = (int16_t *) this_speaker->data_buffer_;
+          int16_t *tmp_buf = (int16_t *) data;
           for (int i = 0; i < len; i += 2) {
             int16_t tmp = tmp_buf[i];
             tmp_buf[i] = tmp_buf[i + 1];
             tmp_buf[i + 1] = tmp;
           }
         }
+#endif
+#ifdef USE_AUDIO_STATS
+        // Only the sample processing is busy time, the writes below mostly wait for free DMA buffers
+        if (this_speaker->audio_stats_ != nullptr) {
+          this_speaker->audio_stats_->add_busy_us(micros() - processing_start_us);
+        }
 #endif
         // Write the audio data to a single DMA buffer at a time to reduce latency for the audio duration played
         // callback.
@@ -373,17 +421,16 @@ void I2SAudioSpeaker::speaker_task(void *params) {
 
 #ifdef USE_I2S_LEGACY
           if (audio_stream_info.get_bits_per_sample() == (uint8_t) this_speaker->bits_per_sample_) {
-            i2s_write(this_speaker->parent_->get_port(), this_speaker->data_buffer_ + i * single_dma_buffer_input_size,
-                      bytes_to_write, &bytes_written, pdMS_TO_TICKS(DMA_BUFFER_DURATION_MS * 5));
+            i2s_write(this_speaker->parent_->get_port(), data + i * single_dma_buffer_input_size, bytes_to_write,
+                      &bytes_written, pdMS_TO_TICKS(DMA_BUFFER_DURATION_MS * 5));
           } else if (audio_stream_info.get_bits_per_sample() < (uint8_t) this_speaker->bits_per_sample_) {
-            i2s_write_expand(this_speaker->parent_->get_port(),
-                             this_speaker->data_buffer_ + i * single_dma_buffer_input_size, bytes_to_write,
-                             audio_stream_info.get_bits_per_sample(), this_speaker->bits_per_sample_, &bytes_written,
-                             pdMS_TO_TICKS(DMA_BUFFER_DURATION_MS * 5));
+            i2s_write_expand(this_speaker->parent_->get_port(), data + i * single_dma_buffer_input_size,
+                             bytes_to_write, audio_stream_info.get_bits_per_sample(), this_speaker->bits_per_sample_,
+                             &bytes_written, pdMS_TO_TICKS(DMA_BUFFER_DURATION_MS * 5));
           }
 #else
-          i2s_channel_write(this_speaker->tx_handle_, this_speaker->data_buffer_ + i * single_dma_buffer_input_size,
-                            bytes_to_write, &bytes_written, pdMS_TO_TICKS(DMA_BUFFER_DURATION_MS * 5));
+          i2s_channel_write(this_speaker->tx_handle_, data + i * single_dma_buffer_input_size, bytes_to_write,
+                            &bytes_written, pdMS_TO_TICKS(DMA_BUFFER_DURATION_MS * 5));
 #endif
 
           int64_t now = esp_timer_get_time();
@@ -397,13 +444,19 @@ void I2SAudioSpeaker::speaker_task(void *params) {
                                                now + dma_buffers_duration_ms * 1000);
 
           tx_dma_underflow = false;
+#ifdef USE_AUDIO_STATS
+          wrote_since_underflow = true;
+#endif
           last_data_received_time = millis();
         }
+
+        this_speaker->audio_ring_buffer_->release_read(data);
       } else {
         // No data received
         if (stop_gracefully && tx_dma_underflow) {
           break;
         }
+        delay(NO_DATA_DELAY_MS);
       }
     }
 
@@ -418,7 +471,7 @@ void I2SAudioSpeaker::speaker_task(void *params) {
     this_speaker->parent_->unlock();
   }
 
-  this_speaker->delete_task_(data_buffer_size);
+  this_speaker->delete_task_();
 }
 
 void I2SAudioSpeaker::start() {
@@ -481,17 +534,7 @@ bool I2SAudioSpeaker::send_esp_err_to_event_group_(esp_err_t err) {
   }
 }
 
-esp_err_t I2SAudioSpeaker::allocate_buffers_(size_t data_buffer_size, size_t ring_buffer_size) {
-  if (this->data_buffer_ == nullptr) {
-    // Allocate data buffer for temporarily storing audio from the ring buffer before writing to the I2S bus
-    RAMAllocator<uint8_t> allocator;
-    this->data_buffer_ = allocator.allocate(data_buffer_size);
-  }
-
-  if (this->data_buffer_ == nullptr) {
-    return ESP_ERR_NO_MEM;
-  }
-
+esp_err_t I2SAudioSpeaker::allocate_buffers_(size_t ring_buffer_size) {
   if (this->audio_ring_buffer_.use_count() == 0) {
     // Allocate ring buffer. Uses a shared_ptr to ensure it isn't improperly deallocated.
     this->audio_ring_buffer_ = RingBuffer::create(ring_buffer_size);
@@ -694,15 +737,9 @@ esp_err_t I2SAudioSpeaker::start_i2s_driver_(audio::AudioStreamInfo &audio_strea
   return err;
 }
 
-void I2SAudioSpeaker::delete_task_(size_t buffer_size) {
+void I2SAudioSpeaker::delete_task_() {
   this->audio_ring_buffer_.reset();  // Releases ownership of the shared_ptr
 
-  if (this->data_buffer_ != nullptr) {
-    RAMAllocator<uint8_t> allocator;
-    allocator.deallocate(this->data_buffer_, buffer_size);
-    this->data_buffer_ = nullptr;
-  }
-
   xEventGroupSetBits(this->event_group_, SpeakerEventGroupBits::STATE_STOPPED);
 
   this->task_created_ = false;
@@ -9,6 +9,7 @@
 #include <freertos/FreeRTOS.h>
 
 #include "esphome/components/audio/audio.h"
+#include "esphome/components/audio/audio_stats.h"
 #include "esphome/components/speaker/speaker.h"
 
 #include "esphome/core/component.h"
@@ -28,6 +29,9 @@ class I2SAudioSpeaker : public I2SAudioOut, public speaker::Speaker, public Comp
   void loop() override;
 
   void set_buffer_duration(uint32_t buffer_duration_ms) { this->buffer_duration_ms_ = buffer_duration_ms; }
+#ifdef USE_AUDIO_STATS
+  void set_audio_stats_name(const std::string &name) { this->audio_stats_ = new audio::AudioStageStats(name); }
+#endif
   void set_timeout(uint32_t ms) { this->timeout_ = ms; }
 #ifdef USE_I2S_LEGACY
 #if SOC_I2S_SUPPORTS_DAC
@@ -94,12 +98,11 @@ class I2SAudioSpeaker : public I2SAudioOut, public speaker::Speaker, public Comp
   static bool i2s_overflow_cb(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx);
 #endif
 
-  /// @brief Allocates the data buffer and ring buffer
-  /// @param data_buffer_size Number of bytes to allocate for the data buffer.
+  /// @brief Allocates the ring buffer. Audio is written to the I2S driver straight from it.
   /// @param ring_buffer_size Number of bytes to allocate for the ring buffer.
-  /// @return ESP_ERR_NO_MEM if either buffer fails to allocate
+  /// @return ESP_ERR_NO_MEM if the buffer fails to allocate
   ///         ESP_OK if successful
-  esp_err_t allocate_buffers_(size_t data_buffer_size, size_t ring_buffer_size);
+  esp_err_t allocate_buffers_(size_t ring_buffer_size);
 
   /// @brief Starts the ESP32 I2S driver.
   /// Attempts to lock the I2S port, starts the I2S driver using the passed in stream information, and sets the data out
@@ -113,17 +116,15 @@ class I2SAudioSpeaker : public I2SAudioOut, public speaker::Speaker, public Comp
   esp_err_t start_i2s_driver_(audio::AudioStreamInfo &audio_stream_info);
 
   /// @brief Deletes the speaker's task.
-  /// Deallocates the data_buffer_ and audio_ring_buffer_, if necessary, and deletes the task. Should only be called by
-  /// the speaker_task itself.
-  /// @param buffer_size The allocated size of the data_buffer_.
-  void delete_task_(size_t buffer_size);
+  /// Deallocates the audio_ring_buffer_, if necessary, and deletes the task. Should only be called by the speaker_task
+  /// itself.
+  void delete_task_();
 
   TaskHandle_t speaker_task_handle_{nullptr};
   EventGroupHandle_t event_group_{nullptr};
 
   QueueHandle_t i2s_event_queue_;
 
-  uint8_t *data_buffer_;
   std::shared_ptr<RingBuffer> audio_ring_buffer_;
 
   uint32_t buffer_duration_ms_;
@@ -150,6 +151,10 @@ class I2SAudioSpeaker : public I2SAudioOut, public speaker::Speaker, public Comp
 #endif
 
   uint32_t accumulated_frames_written_{0};
+
+#ifdef USE_AUDIO_STATS
+  audio::AudioStageStats *audio_stats_{nullptr};
+#endif
 };
 
 }  // namespace i2s_audio
@@ -89,6 +89,7 @@ CONF_LED_PIN = "led_pin"
 CONF_COLOR_PALETTE_IMAGES = "color_palette_images"
 CONF_INVERT_DISPLAY = "invert_display"
 CONF_PIXEL_MODE = "pixel_mode"
+CONF_ASYNC_FLUSH = "async_flush"
 
 
 def cmd(c, *args):
@@ -142,6 +143,9 @@ def _validate(config):
         if CONF_INIT_SEQUENCE not in config or CONF_DIMENSIONS not in config:
             raise cv.Invalid("CUSTOM model requires init_sequence and dimensions")
 
+    if config[CONF_ASYNC_FLUSH] and not CORE.is_esp32:
+        raise cv.Invalid("async_flush is only available on ESP32")
+
     return config
 
 
@@ -186,6 +190,7 @@ CONFIG_SCHEMA = cv.All(
                 }
             ),
             cv.Optional(CONF_INIT_SEQUENCE): cv.ensure_list(map_sequence),
+            cv.Optional(CONF_ASYNC_FLUSH, default=False): cv.boolean,
         }
     )
     .extend(cv.polling_component_schema("1s"))
@@ -209,6 +214,10 @@ def final_validate(config):
     ):
         LOGGER.info("Consider enabling PSRAM if available for the display buffer")
 
+    if config[CONF_ASYNC_FLUSH]:
+        # The flush task writes to the bus while the main loop runs
+        spi.final_validate_exclusive_bus(config, CONF_ASYNC_FLUSH)
+
     return spi.final_validate_device_schema(
         "ili9xxx", require_miso=False, require_mosi=True
     )
@@ -233,6 +242,8 @@ async def to_code(config):
 
     if pixel_mode := config.get(CONF_PIXEL_MODE):
         cg.add(var.set_pixel_mode(pixel_mode))
+    if config[CONF_ASYNC_FLUSH]:
+        cg.add(var.set_async_flush(True))
     if CONF_COLOR_ORDER in config:
         cg.add(var.set_color_order(COLOR_ORDERS[config[CONF_COLOR_ORDER]]))
     if CONF_TRANSFORM in config:
@@ -4,6 +4,8 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace ili9xxx {
 
@@ -57,10 +59,9 @@ void ILI9XXXDisplay::setup() {
 
   this->set_madctl();
   this->command(this->pre_invertcolors_ ? ILI9XXX_INVON : ILI9XXX_INVOFF);
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
+  // Another rectangle costs an address window, about three SPI writes, expressed in the pixels sent meanwhile
+  this->dirty_region_.set_rect_overhead(3 * SPI_SETUP_US * (this->data_rate_ / 1000000) / 16);
+  this->dirty_region_.flushed(0);
 }
 
 void ILI9XXXDisplay::alloc_buffer_() {
@@ -71,7 +72,12 @@ void ILI9XXXDisplay::alloc_buffer_() {
   }
   if (this->buffer_ == nullptr) {
     this->mark_failed();
+    return;
   }
+#ifdef USE_ESP32
+  if (this->async_flush_)
+    this->alloc_flush_buffer_();
+#endif
 }
 
 void ILI9XXXDisplay::setup_pins_() {
@@ -134,10 +140,7 @@ void ILI9XXXDisplay::fill(Color color) {
   if (!this->check_buffer_())
     return;
   uint16_t new_color = 0;
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
+  this->dirty_region_.add_all(this->get_width_internal(), this->get_height_internal());
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
       new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
@@ -197,15 +200,8 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
     updated = true;
   }
   if (updated) {
-    // low and high watermark may speed up drawing from buffer
-    if (x < this->x_low_)
-      this->x_low_ = x;
-    if (y < this->y_low_)
-      this->y_low_ = y;
-    if (x > this->x_high_)
-      this->x_high_ = x;
-    if (y > this->y_high_)
-      this->y_high_ = y;
+    // only the changed regions are sent to the display
+    this->dirty_region_.add(x, y);
   }
 }
 
@@ -223,15 +219,167 @@ void ILI9XXXDisplay::update() {
   this->display_();
 }
 
+void HOT ILI9XXXDisplay::fill_absolute_rect_internal(int x_start, int y_start, int w, int h, Color color) {
+  if (!this->check_buffer_())
+    return;
+  bool updated = false;
+  if (this->buffer_color_mode_ == BITS_16) {
+    const uint16_t new_color = display::ColorUtil::color_to_565(color, display::ColorOrder::COLOR_ORDER_RGB);
+    const uint8_t high = new_color >> 8;
+    const uint8_t low = new_color & 0xFF;
+    for (int y = y_start; y < y_start + h; y++) {
+      uint8_t *pos = this->buffer_ + (y * this->width_ + x_start) * 2;
+      for (int x = 0; x < w; x++, pos += 2) {
+        if ((pos[0] != high) || (pos[1] != low)) {
+          pos[0] = high;
+          pos[1] = low;
+          updated = true;
+        }
+      }
+    }
+  } else {
+    const uint8_t new_color = this->buffer_color_mode_ == BITS_8_INDEXED
+                                  ? display::ColorUtil::color_to_index8_palette888(color, this->palette_)
+                                  : display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+    for (int y = y_start; y < y_start + h; y++) {
+      uint8_t *pos = this->buffer_ + y * this->width_ + x_start;
+      for (int x = 0; x < w; x++, pos++) {
+        if (*pos != new_color) {
+          *pos = new_color;
+          updated = true;
+        }
+      }
+    }
+  }
+  if (updated)
+    this->dirty_region_.add(display::Rect(x_start, y_start, w, h));
+}
+
+void HOT ILI9XXXDisplay::draw_absolute_rgb565_internal(int x_start, int y_start, int w, int h, const uint8_t *ptr,
+                                                       size_t stride, bool big_endian) {
+#ifndef USE_ESP8266
+  // The buffer holds big endian RGB565 like the source, so rows are copied as they are. On ESP8266 the source may be
+  // in flash, which needs aligned reads.
+  if (this->buffer_color_mode_ == BITS_16 && big_endian && this->check_buffer_()) {
+    bool updated = false;
+    for (int y = 0; y != h; y++, ptr += stride) {
+      uint8_t *row = this->buffer_ + ((y_start + y) * this->width_ + x_start) * 2;
+      if (memcmp(row, ptr, w * 2) != 0) {
+        memcpy(row, ptr, w * 2);
+        updated = true;
+      }
+    }
+    if (updated)
+      this->dirty_region_.add(display::Rect(x_start, y_start, w, h));
+    return;
+  }
+#endif
+  display::DisplayBuffer::draw_absolute_rgb565_internal(x_start, y_start, w, h, ptr, stride, big_endian);
+}
+
 void ILI9XXXDisplay::display_() {
   // check if something was displayed
-  if ((this->x_high_ < this->x_low_) || (this->y_high_ < this->y_low_)) {
+  if (this->dirty_region_.empty()) {
+    this->dirty_region_.flushed(0);
     return;
   }
 
-  // we will only update the changed rows to the display
-  size_t const w = this->x_high_ - this->x_low_ + 1;
-  size_t const h = this->y_high_ - this->y_low_ + 1;
+  const uint32_t start = micros();
+#ifdef USE_ESP32
+  if (this->flush_task_ != nullptr) {
+    this->queue_flush_();
+    this->last_stall_us_ = micros() - start;
+    this->record_transfer_(this->last_stall_us_, 0);
+    return;
+  }
+#endif
+  size_t bytes_sent = 0;
+  for (const display::Rect &rect : this->dirty_region_) {
+    bytes_sent += this->write_rect_(this->buffer_, rect, true);
+  }
+  this->last_flush_us_ = this->last_stall_us_ = micros() - start;
+  ESP_LOGV(TAG, "Data write of %zu bytes in %zu rectangles took %" PRIu32 "us", bytes_sent,
+           this->dirty_region_.size(), this->last_flush_us_);
+  this->record_transfer_(this->last_flush_us_, bytes_sent);
+  this->dirty_region_.flushed(bytes_sent);
+}
+
+uint32_t ILI9XXXDisplay::get_last_update_bytes() const {
+#ifdef USE_ESP32
+  if (this->flush_task_ != nullptr)
+    return this->flush_region_.get_last_bytes_sent();
+#endif
+  return this->dirty_region_.get_last_bytes_sent();
+}
+
+void ILI9XXXDisplay::wait_for_flush_() {
+#ifdef USE_ESP32
+  while (!this->flush_done_)
+    delay(1);
+#endif
+}
+
+#ifdef USE_ESP32
+void ILI9XXXDisplay::alloc_flush_buffer_() {
+  RAMAllocator<uint8_t> allocator;
+  const size_t length = this->get_buffer_length_() * (this->buffer_color_mode_ == BITS_16 ? 2 : 1);
+  this->flush_buffer_ = allocator.allocate(length);
+  if (this->flush_buffer_ == nullptr) {
+    ESP_LOGW(TAG, "Could not allocate the second buffer for async flush, flushing in the main loop");
+    return;
+  }
+  // On the other core where there is one, otherwise below the loop task so it only uses time the loop leaves idle
+  xTaskCreatePinnedToCore(flush_task, "ili9xxx_flush", 3072, this, portNUM_PROCESSORS > 1 ? 1 : tskIDLE_PRIORITY,
+                          &this->flush_task_, portNUM_PROCESSORS > 1 ? 0 : tskNO_AFFINITY);
+  if (this->flush_task_ == nullptr) {
+    ESP_LOGW(TAG, "Could not start the flush task, flushing in the main loop");
+    allocator.deallocate(this->flush_buffer_, length);
+    this->flush_buffer_ = nullptr;
+  }
+}
+
+void ILI9XXXDisplay::queue_flush_() {
+  // The task still reads the flush buffer of the previous frame
+  this->wait_for_flush_();
+  // Its bytes were sent in the background, so they are counted one frame late
+  this->record_transfer_(0, this->flush_region_.get_last_bytes_sent());
+
+  // Copy whole rows, the single write path sends full width
+  const size_t row_bytes = this->width_ * (this->buffer_color_mode_ == BITS_16 ? 2 : 1);
+  for (const display::Rect &rect : this->dirty_region_) {
+    memcpy(this->flush_buffer_ + rect.y * row_bytes, this->buffer_ + rect.y * row_bytes, rect.h * row_bytes);
+  }
+  this->flush_region_ = this->dirty_region_;
+  this->dirty_region_.flushed(0);
+  this->flush_done_ = false;
+  xTaskNotifyGive(this->flush_task_);
+}
+
+void ILI9XXXDisplay::flush_task(void *arg) {
+  auto *this_display = static_cast<ILI9XXXDisplay *>(arg);
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    const uint32_t start = micros();
+    size_t bytes_sent = 0;
+    for (const display::Rect &rect : this_display->flush_region_) {
+      bytes_sent += this_display->write_rect_(this_display->flush_buffer_, rect, false);
+    }
+    this_display->last_flush_us_ = micros() - start;
+    ESP_LOGV(TAG, "Async write of %zu bytes in %zu rectangles took %" PRIu32 "us", bytes_sent,
+             this_display->flush_region_.size(), this_display->last_flush_us_);
+    this_display->flush_region_.flushed(bytes_sent);
+    this_display->flush_done_ = true;
+  }
+}
+#endif
+
+size_t ILI9XXXDisplay::write_rect_(const uint8_t *buffer, const display::Rect &rect, bool feed_wdt) {
+  const uint16_t x_low = rect.x;
+  const uint16_t y_low = rect.y;
+  const uint16_t x_high = rect.x2() - 1;
+  const uint16_t y_high = rect.y2() - 1;
+  size_t const w = rect.w;
+  size_t const h = rect.h;
 
   size_t mhz = this->data_rate_ / 1000000;
   // estimate time for a single write
@@ -241,34 +389,34 @@ void ILI9XXXDisplay::display_() {
   ESP_LOGV(TAG,
            "Start display(xlow:%d, ylow:%d, xhigh:%d, yhigh:%d, width:%d, "
            "height:%zu, mode=%d, 18bit=%d, sw_time=%zuus, mw_time=%zuus)",
-           this->x_low_, this->y_low_, this->x_high_, this->y_high_, w, h, this->buffer_color_mode_,
-           this->is_18bitdisplay_, sw_time, mw_time);
-  auto now = millis();
+           x_low, y_low, x_high, y_high, w, h, this->buffer_color_mode_, this->is_18bitdisplay_, sw_time, mw_time);
+  size_t bytes_sent = 0;
   if (this->buffer_color_mode_ == BITS_16 && !this->is_18bitdisplay_ && sw_time < mw_time) {
     // 16 bit mode maps directly to display format
     ESP_LOGV(TAG, "Doing single write of %zu bytes", this->width_ * h * 2);
-    set_addr_window_(0, this->y_low_, this->width_ - 1, this->y_high_);
-    this->write_array(this->buffer_ + this->y_low_ * this->width_ * 2, h * this->width_ * 2);
+    set_addr_window_(0, y_low, this->width_ - 1, y_high);
+    this->write_array(buffer + y_low * this->width_ * 2, h * this->width_ * 2);
+    bytes_sent = h * this->width_ * 2;
   } else {
     ESP_LOGV(TAG, "Doing multiple write");
     uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
     size_t rem = h * w;  // remaining number of pixels to write
-    set_addr_window_(this->x_low_, this->y_low_, this->x_high_, this->y_high_);
+    set_addr_window_(x_low, y_low, x_high, y_high);
     size_t idx = 0;    // index into transfer_buffer
     size_t pixel = 0;  // pixel number offset
-    size_t pos = this->y_low_ * this->width_ + this->x_low_;
+    size_t pos = y_low * this->width_ + x_low;
     while (rem-- != 0) {
       uint16_t color_val;
       switch (this->buffer_color_mode_) {
         case BITS_8:
-          color_val = display::ColorUtil::color_to_565(display::ColorUtil::rgb332_to_color(this->buffer_[pos++]));
+          color_val = display::ColorUtil::color_to_565(display::ColorUtil::rgb332_to_color(buffer[pos++]));
           break;
         case BITS_8_INDEXED:
           color_val = display::ColorUtil::color_to_565(
-              display::ColorUtil::index8_to_color_palette888(this->buffer_[pos++], this->palette_));
+              display::ColorUtil::index8_to_color_palette888(buffer[pos++], this->palette_));
           break;
         default:  // case BITS_16:
-          color_val = (this->buffer_[pos * 2] << 8) + this->buffer_[pos * 2 + 1];
+          color_val = (buffer[pos * 2] << 8) + buffer[pos * 2 + 1];
           pos++;
           break;
       }
@@ -282,8 +430,10 @@ void ILI9XXXDisplay::display_() {
       }
       if (idx == sizeof(transfer_buffer)) {
         this->write_array(transfer_buffer, idx);
+        bytes_sent += idx;
         idx = 0;
-        App.feed_wdt();
+        if (feed_wdt)
+          App.feed_wdt();
       }
       // end of line? Skip to the next.
       if (++pixel == w) {
@@ -294,15 +444,11 @@ void ILI9XXXDisplay::display_() {
     // flush any balance.
     if (idx != 0) {
       this->write_array(transfer_buffer, idx);
+      bytes_sent += idx;
     }
   }
   this->end_data_();
-  ESP_LOGV(TAG, "Data write took %dms", (unsigned) (millis() - now));
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
+  return bytes_sent;
 }
 
 // note that this bypasses the buffer and writes directly to the display.
@@ -319,6 +465,7 @@ void ILI9XXXDisplay::draw_pixels_at(int x_start, int y_start, int w, int h, cons
                                      x_pad);
     return;
   }
+  this->wait_for_flush_();
   this->set_addr_window_(x_start, y_start, x_start + w - 1, y_start + h - 1);
   // x_ and y_offset are offsets into the source buffer, unrelated to our own offsets into the display.
   auto stride = x_offset + w + x_pad;
@@ -454,6 +601,7 @@ void ILI9XXXDisplay::set_addr_window_(uint16_t x1, uint16_t y1, uint16_t x2, uin
 void ILI9XXXDisplay::invert_colors(bool invert) {
   this->pre_invertcolors_ = invert;
   if (is_ready()) {
+    this->wait_for_flush_();
     this->command(invert ? ILI9XXX_INVON : ILI9XXX_INVOFF);
   }
 }
@@ -2,9 +2,16 @@
 #include "esphome/components/spi/spi.h"
 #include "esphome/components/display/display_buffer.h"
 #include "esphome/components/display/display_color_utils.h"
+#include "esphome/components/display/dirty_region.h"
 #include "ili9xxx_defines.h"
 #include "ili9xxx_init.h"
 
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+#endif
+
 namespace esphome {
 namespace ili9xxx {
 
@@ -82,6 +89,8 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   void set_mirror_x(bool mirror_x) { this->mirror_x_ = mirror_x; }
   void set_mirror_y(bool mirror_y) { this->mirror_y_ = mirror_y; }
   void set_pixel_mode(PixelMode mode) { this->pixel_mode_ = mode; }
+  /// Send frames from a copy of the buffer in a background task, so the main loop only waits for the copy
+  void set_async_flush(bool async_flush) { this->async_flush_ = async_flush; }
 
   void update() override;
 
@@ -89,12 +98,22 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
 
   void dump_config() override;
   void setup() override;
-  void on_powerdown() override { this->command(ILI9XXX_SLPIN); }
+  void on_powerdown() override {
+    this->wait_for_flush_();
+    this->command(ILI9XXX_SLPIN);
+  }
 
   display::DisplayType get_display_type() override { return display::DisplayType::DISPLAY_TYPE_COLOR; }
   void draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, display::ColorOrder order,
                       display::ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad) override;
 
+  /// Bytes of pixel data sent to the panel by the last update
+  uint32_t get_last_update_bytes() const;
+  /// Time the last frame took on the bus, the lower bound for the time between frames
+  uint32_t get_last_flush_us() const { return this->last_flush_us_; }
+  /// Time the last update blocked the main loop sending or handing off its frame
+  uint32_t get_last_stall_us() const { return this->last_stall_us_; }
+
  protected:
   inline bool check_buffer_() {
     if (this->buffer_ == nullptr) {
@@ -106,10 +125,20 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   }
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x_start, int y_start, int w, int h, Color color) override;
+  void draw_absolute_rgb565_internal(int x_start, int y_start, int w, int h, const uint8_t *ptr, size_t stride,
+                                     bool big_endian) override;
   void setup_pins_();
 
   virtual void set_madctl();
   void display_();
+  size_t write_rect_(const uint8_t *buffer, const display::Rect &rect, bool feed_wdt);
+  void wait_for_flush_();
+#ifdef USE_ESP32
+  void alloc_flush_buffer_();
+  void queue_flush_();
+  static void flush_task(void *arg);
+#endif
   void init_lcd_(const uint8_t *addr);
   void set_addr_window_(uint16_t x, uint16_t y, uint16_t x2, uint16_t y2);
   void reset_();
@@ -120,10 +149,7 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   int16_t height_{0};  ///< Display height as modified by current rotation
   int16_t offset_x_{0};
   int16_t offset_y_{0};
-  uint16_t x_low_{0};
-  uint16_t y_low_{0};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
+  display::DirtyRegion dirty_region_;
   const uint8_t *palette_{};
 
   ILI9XXXColorMode buffer_color_mode_{BITS_16};
@@ -151,6 +177,16 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   bool swap_xy_{};
   bool mirror_x_{};
   bool mirror_y_{};
+  bool async_flush_{false};
+  uint32_t last_flush_us_{0};
+  uint32_t last_stall_us_{0};
+#ifdef USE_ESP32
+  // The background task owns these while flush_done_ is false
+  uint8_t *flush_buffer_{nullptr};
+  display::DirtyRegion flush_region_;
+  TaskHandle_t flush_task_{nullptr};
+  std::atomic<bool> flush_done_{true};
+#endif
 };
 
 //-----------   M5Stack display --------------
@@ -26,8 +26,8 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
 
   switch (type_) {
     case IMAGE_TYPE_BINARY: {
-      for (int img_x = img_x0; img_x < w; img_x++) {
-        for (int img_y = img_y0; img_y < h; img_y++) {
+      for (int img_y = img_y0; img_y < h; img_y++) {
+        for (int img_x = img_x0; img_x < w; img_x++) {
           if (this->get_binary_pixel_(img_x, img_y)) {
             display->draw_pixel_at(x + img_x, y + img_y, color_on);
           } else if (!this->transparency_) {
@@ -38,8 +38,8 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       break;
     }
     case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = img_x0; img_x < w; img_x++) {
-        for (int img_y = img_y0; img_y < h; img_y++) {
+      for (int img_y = img_y0; img_y < h; img_y++) {
+        for (int img_x = img_x0; img_x < w; img_x++) {
           const uint32_t pos = (img_x + img_y * this->width_);
           const uint8_t gray = progmem_read_byte(this->data_start_ + pos);
           Color color = Color(gray, gray, gray, 0xFF);
@@ -65,18 +65,44 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       }
       break;
     case IMAGE_TYPE_RGB565:
-      for (int img_x = img_x0; img_x < w; img_x++) {
+      if (this->transparency_ == TRANSPARENCY_ALPHA_CHANNEL) {
         for (int img_y = img_y0; img_y < h; img_y++) {
-          auto color = this->get_rgb565_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
+          for (int img_x = img_x0; img_x < w; img_x++) {
+            auto color = this->get_rgb565_pixel_(img_x, img_y);
+            if (color.w >= 0x80) {
+              display->draw_pixel_at(x + img_x, y + img_y, color);
+            }
           }
         }
+      } else if (img_x0 < w) {
+        // Pixels are written as blocks in their stored format, which buffers holding RGB565 copy without conversion
+        const size_t stride = this->width_ * 2;
+        const uint8_t *row = this->data_start_ + img_y0 * stride;
+        if (this->transparency_ == TRANSPARENCY_OPAQUE) {
+          if (img_y0 < h)
+            display->draw_rgb565_at(x + img_x0, y + img_y0, w - img_x0, h - img_y0, row + img_x0 * 2, stride, true);
+          break;
+        }
+        // Split each row into runs between chroma key pixels
+        for (int img_y = img_y0; img_y < h; img_y++, row += stride) {
+          int run_start = img_x0;
+          for (int img_x = img_x0; img_x < w; img_x++) {
+            if (encode_uint16(progmem_read_byte(row + img_x * 2), progmem_read_byte(row + img_x * 2 + 1)) != 0x0020)
+              continue;
+            if (img_x != run_start) {
+              display->draw_rgb565_at(x + run_start, y + img_y, img_x - run_start, 1, row + run_start * 2, stride,
+                                      true);
+            }
+            run_start = img_x + 1;
+          }
+          if (w != run_start)
+            display->draw_rgb565_at(x + run_start, y + img_y, w - run_start, 1, row + run_start * 2, stride, true);
+        }
       }
       break;
     case IMAGE_TYPE_RGB:
-      for (int img_x = img_x0; img_x < w; img_x++) {
-        for (int img_y = img_y0; img_y < h; img_y++) {
+      for (int img_y = img_y0; img_y < h; img_y++) {
+        for (int img_x = img_x0; img_x < w; img_x++) {
           auto color = this->get_rgb_pixel_(img_x, img_y);
           if (color.w >= 0x80) {
             display->draw_pixel_at(x + img_x, y + img_y, color);
@@ -9,16 +9,13 @@ namespace integration {
 static const char *const TAG = "integration";
 
 void IntegrationSensor::setup() {
-  if (this->restore_) {
-    this->pref_ = global_preferences->make_preference<float>(this->get_object_id_hash());
-    float preference_value = 0;
-    this->pref_.load(&preference_value);
-    this->result_ = preference_value;
+  if (this->restore_ && this->store_ != nullptr) {
+    this->result_.restore(this->store_, this->get_object_id_hash());
   }
 
   this->last_update_ = millis();
 
-  this->publish_and_save_(this->result_);
+  this->publish_state(this->result_.get());
   this->sensor_->add_on_state_callback([this](float state) { this->process_sensor_value_(state); });
 }
 void IntegrationSensor::dump_config() { LOG_SENSOR("", "Integration Sensor", this); }
@@ -44,7 +41,8 @@ void IntegrationSensor::process_sensor_value_(float value) {
   }
   this->last_value_ = new_value;
   this->last_update_ = now;
-  this->publish_and_save_(this->result_ + area);
+  this->result_.add(area);
+  this->publish_state(this->result_.get());
 }
 
 }  // namespace integration
@@ -1,9 +1,9 @@
 #pragma once
 
 #include "esphome/core/component.h"
-#include "esphome/core/preferences.h"
 #include "esphome/core/automation.h"
 #include "esphome/core/hal.h"
+#include "esphome/components/energy_accumulator/energy_accumulator.h"
 #include "esphome/components/sensor/sensor.h"
 
 namespace esphome {
@@ -31,7 +31,11 @@ class IntegrationSensor : public sensor::Sensor, public Component {
   void set_time(IntegrationSensorTime time) { time_ = time; }
   void set_method(IntegrationMethod method) { method_ = method; }
   void set_restore(bool restore) { restore_ = restore; }
-  void reset() { this->publish_and_save_(0.0f); }
+  void set_store(energy_accumulator::EnergyStore *store) { store_ = store; }
+  void reset() {
+    this->result_.set(0.0);
+    this->publish_state(0.0f);
+  }
 
  protected:
   void process_sensor_value_(float value);
@@ -51,23 +55,16 @@ class IntegrationSensor : public sensor::Sensor, public Component {
         return 0.0f;
     }
   }
-  void publish_and_save_(double result) {
-    this->result_ = result;
-    this->publish_state(result);
-    if (this->restore_) {
-      float result_f = result;
-      this->pref_.save(&result_f);
-    }
-  }
 
   sensor::Sensor *sensor_;
   IntegrationSensorTime time_;
   IntegrationMethod method_;
   bool restore_;
-  ESPPreferenceObject pref_;
+  /// Checkpoints the result when restore is enabled
+  energy_accumulator::EnergyStore *store_{nullptr};
 
   uint32_t last_update_;
-  double result_{0.0f};
+  energy_accumulator::EnergyAccumulator result_;
   float last_value_{0.0f};
 };
 
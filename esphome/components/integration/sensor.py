@@ -1,6 +1,7 @@
 from esphome import automation
 import esphome.codegen as cg
 from esphome.components import sensor
+from esphome.components.energy_accumulator import get_energy_store
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_ACCURACY_DECIMALS,
@@ -12,6 +13,8 @@ from esphome.const import (
 )
 from esphome.core.entity_helpers import inherit_property_from
 
+AUTO_LOAD = ["energy_accumulator"]
+
 integration_ns = cg.esphome_ns.namespace("integration")
 IntegrationSensor = integration_ns.class_(
     "IntegrationSensor", sensor.Sensor, cg.Component
@@ -99,6 +102,8 @@ async def to_code(config):
     cg.add(var.set_time(config[CONF_TIME_UNIT]))
     cg.add(var.set_method(config[CONF_INTEGRATION_METHOD]))
     cg.add(var.set_restore(config[CONF_RESTORE]))
+    if config[CONF_RESTORE]:
+        cg.add(var.set_store(await get_energy_store()))
 
 
 @automation.register_action(
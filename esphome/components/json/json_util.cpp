@@ -1,6 +1,8 @@
 #include "json_util.h"
 #include "esphome/core/log.h"
 
+#include <cstring>
+
 // ArduinoJson::Allocator is included via ArduinoJson.h in json_util.h
 
 namespace esphome {
@@ -31,25 +33,45 @@ struct SpiRamAllocator : ArduinoJson::Allocator {
 };
 
 std::string build_json(const json_build_t &f) {
+  std::string output;
+  build_json_into(f, output);
+  return output;
+}
+
+void build_json_into(const json_build_t &f, std::string &output) {
   // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
+  output.clear();
   auto doc_allocator = SpiRamAllocator();
   JsonDocument json_document(&doc_allocator);
   if (json_document.overflowed()) {
     ESP_LOGE(TAG, "Could not allocate memory for JSON document!");
-    return "{}";
+    output = "{}";
+    return;
   }
   JsonObject root = json_document.to<JsonObject>();
   f(root);
   if (json_document.overflowed()) {
     ESP_LOGE(TAG, "Could not allocate memory for JSON document!");
-    return "{}";
+    output = "{}";
+    return;
   }
-  std::string output;
   serializeJson(json_document, output);
-  return output;
   // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
 }
 
+static bool handle_parse_result(DeserializationError err, JsonDocument &json_document, const json_parse_t &f) {
+  JsonObject root = json_document.as<JsonObject>();
+
+  if (err == DeserializationError::Ok) {
+    return f(root);
+  } else if (err == DeserializationError::NoMemory) {
+    ESP_LOGE(TAG, "Can not allocate more memory for deserialization. Consider making source string smaller");
+    return false;
+  }
+  ESP_LOGE(TAG, "Parse error: %s", err.c_str());
+  return false;
+}
+
 bool parse_json(const std::string &data, const json_parse_t &f) {
   // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
   auto doc_allocator = SpiRamAllocator();
@@ -59,17 +81,113 @@ bool parse_json(const std::string &data, const json_parse_t &f) {
     return false;
   }
   DeserializationError err = deserializeJson(json_document, data);
+  return handle_parse_result(err, json_document, f);
+  // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
+}
 
-  JsonObject root = json_document.as<JsonObject>();
+// Custom ArduinoJson reader that fetches the text in small pieces from a json_read_t
+class JsonStreamReader {
+ public:
+  explicit JsonStreamReader(const json_read_t &read) : read_(read) {}
 
-  if (err == DeserializationError::Ok) {
-    return f(root);
-  } else if (err == DeserializationError::NoMemory) {
-    ESP_LOGE(TAG, "Can not allocate more memory for deserialization. Consider making source string smaller");
+  int read() {
+    if (this->pos_ == this->len_ && !this->fill_())
+      return -1;
+    return this->buf_[this->pos_++];
+  }
+
+  size_t readBytes(char *buffer, size_t length) {  // NOLINT(readability-identifier-naming) ArduinoJson interface
+    size_t copied = 0;
+    while (copied < length && (this->pos_ < this->len_ || this->fill_())) {
+      size_t chunk = std::min(length - copied, this->len_ - this->pos_);
+      memcpy(buffer + copied, this->buf_ + this->pos_, chunk);
+      this->pos_ += chunk;
+      copied += chunk;
+    }
+    return copied;
+  }
+
+ protected:
+  bool fill_() {
+    int len = this->read_(this->buf_, sizeof(this->buf_));
+    if (len <= 0)
+      return false;
+    this->pos_ = 0;
+    this->len_ = len;
+    return true;
+  }
+
+  const json_read_t &read_;
+  uint8_t buf_[256];
+  size_t pos_{0};
+  size_t len_{0};
+};
+
+// Marks the member at path ("a.b", "list[].c") as kept in an ArduinoJson filter
+static void add_filter_path(JsonObject filter, const std::string &path) {
+  size_t start = 0;
+  while (true) {
+    const size_t end = path.find('.', start);
+    const bool last = end == std::string::npos;
+    std::string key = path.substr(start, last ? std::string::npos : end - start);
+    const bool array = key.ends_with("[]");
+    if (array)
+      key.resize(key.size() - 2);
+    if (filter[key].is<bool>())
+      return;  // the member is kept whole already
+
+    if (array) {
+      // The filter of the first element applies to all of them
+      JsonArray elements = filter[key].as<JsonArray>();
+      if (elements.isNull())
+        elements = filter[key].to<JsonArray>();
+      if (last) {
+        elements.clear();
+        elements.add(true);
+        return;
+      }
+      if (elements[0].is<bool>())
+        return;  // every element is kept whole already
+      JsonObject element = elements[0].as<JsonObject>();
+      if (element.isNull()) {
+        elements.clear();
+        element = elements.add<JsonObject>();
+      }
+      filter = element;
+    } else {
+      if (last) {
+        filter[key] = true;
+        return;
+      }
+      JsonObject child = filter[key].as<JsonObject>();
+      if (child.isNull())
+        child = filter[key].to<JsonObject>();
+      filter = child;
+    }
+    start = end + 1;
+  }
+}
+
+bool parse_json_stream(const json_read_t &read, const std::vector<std::string> &keep, const json_parse_t &f) {
+  // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
+  auto doc_allocator = SpiRamAllocator();
+  JsonDocument json_document(&doc_allocator);
+  JsonDocument filter(&doc_allocator);
+  if (json_document.overflowed() || filter.overflowed()) {
+    ESP_LOGE(TAG, "Could not allocate memory for JSON document!");
     return false;
   }
-  ESP_LOGE(TAG, "Parse error: %s", err.c_str());
-  return false;
+  JsonStreamReader reader(read);
+  DeserializationError err;
+  if (keep.empty()) {
+    err = deserializeJson(json_document, reader);
+  } else {
+    JsonObject filter_root = filter.to<JsonObject>();
+    for (const auto &path : keep)
+      add_filter_path(filter_root, path);
+    err = deserializeJson(json_document, reader, DeserializationOption::Filter(filter));
+  }
+  return handle_parse_result(err, json_document, f);
   // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
 }
 
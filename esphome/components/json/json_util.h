@@ -4,6 +4,8 @@
 
 #include "esphome/core/helpers.h"
 
+#include "json_writer.h"
+
 #define ARDUINOJSON_ENABLE_STD_STRING 1  // NOLINT
 
 #define ARDUINOJSON_USE_LONG_LONG 1  // NOLINT
@@ -19,11 +21,24 @@ using json_parse_t = std::function<bool(JsonObject)>;
 /// Callback function typedef for building JsonObjects.
 using json_build_t = std::function<void(JsonObject)>;
 
+/// Callback function typedef for reading JSON text in pieces, returns the number of bytes read and 0 at the end.
+using json_read_t = std::function<int(uint8_t *, size_t)>;
+
 /// Build a JSON string with the provided json build function.
 std::string build_json(const json_build_t &f);
+/// Build a JSON string into \p output, keeping its capacity so a buffer can be reused between calls.
+void build_json_into(const json_build_t &f, std::string &output);
 
 /// Parse a JSON string and run the provided json parse function if it's valid.
 bool parse_json(const std::string &data, const json_parse_t &f);
 
+/** Parse JSON while it is read and run the provided json parse function if it's valid.
+ *
+ * Only the members listed in \p keep are stored, so large documents can be processed in bounded memory. Nested
+ * members are separated by dots, and "[]" selects the member in every element of an array, like "list[].main.temp".
+ * An empty list keeps the whole document.
+ */
+bool parse_json_stream(const json_read_t &read, const std::vector<std::string> &keep, const json_parse_t &f);
+
 }  // namespace json
 }  // namespace esphome
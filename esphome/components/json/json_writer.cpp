@@ -0,0 +1,139 @@
+#include "json_writer.h"
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace esphome {
+namespace json {
+
+JsonObjectWriter::JsonObjectWriter(size_t reserve) {
+  this->output_.reserve(reserve);
+  this->output_ += '{';
+}
+
+void JsonObjectWriter::add(const char *key, const char *value) { this->add_string_(key, value, strlen(value)); }
+
+void JsonObjectWriter::add(const char *key, bool value) {
+  this->key_(key);
+  this->output_ += value ? "true" : "false";
+}
+
+void JsonObjectWriter::add(const char *key, int32_t value) {
+  this->key_(key);
+  char buf[12];
+  snprintf(buf, sizeof(buf), "%" PRId32, value);
+  this->output_ += buf;
+}
+
+void JsonObjectWriter::add(const char *key, uint32_t value) {
+  this->key_(key);
+  char buf[11];
+  snprintf(buf, sizeof(buf), "%" PRIu32, value);
+  this->output_ += buf;
+}
+
+void JsonObjectWriter::add(const char *key, float value) {
+  this->key_(key);
+  if (!std::isfinite(value)) {
+    this->output_ += "null";
+    return;
+  }
+  char buf[20];
+  // Most values read back exactly with 6 digits, 9 are always enough for a float
+  for (int precision = 6; precision <= 9; precision++) {
+    snprintf(buf, sizeof(buf), "%.*g", precision, value);
+    if (strtof(buf, nullptr) == value)
+      break;
+  }
+  this->output_ += buf;
+}
+
+void JsonObjectWriter::begin_object(const char *key) {
+  this->key_(key);
+  this->output_ += '{';
+  this->first_ = true;
+}
+
+void JsonObjectWriter::end_object() {
+  this->output_ += '}';
+  this->first_ = false;
+}
+
+void JsonObjectWriter::add_members(const std::string &object) {
+  // An empty object, or something that isn't an object, adds nothing
+  if (object.size() <= 2 || object.front() != '{' || object.back() != '}')
+    return;
+  if (!this->first_)
+    this->output_ += ',';
+  this->first_ = false;
+  this->output_.append(object, 1, object.size() - 2);
+}
+
+std::string JsonObjectWriter::release() {
+  this->output_ += '}';
+  return std::move(this->output_);
+}
+
+void JsonObjectWriter::key_(const char *key) {
+  if (!this->first_)
+    this->output_ += ',';
+  this->first_ = false;
+  this->output_ += '"';
+  this->write_escaped_(key, strlen(key));
+  this->output_ += "\":";
+}
+
+void JsonObjectWriter::add_string_(const char *key, const char *value, size_t len) {
+  this->key_(key);
+  this->output_ += '"';
+  this->write_escaped_(value, len);
+  this->output_ += '"';
+}
+
+void JsonObjectWriter::write_escaped_(const char *value, size_t len) {
+  static const char *const HEX_DIGITS = "0123456789abcdef";
+  const char *run = value;
+  const char *end = value + len;
+  for (const char *pos = value; pos < end; pos++) {
+    auto c = static_cast<uint8_t>(*pos);
+    if (c >= 0x20 && c != '"' && c != '\\')
+      continue;
+    // Copy the plain characters before this one in one go
+    this->output_.append(run, pos - run);
+    run = pos + 1;
+    this->output_ += '\\';
+    switch (c) {
+      case '"':
+      case '\\':
+        this->output_ += static_cast<char>(c);
+        break;
+      case '\b':
+        this->output_ += 'b';
+        break;
+      case '\f':
+        this->output_ += 'f';
+        break;
+      case '\n':
+        this->output_ += 'n';
+        break;
+      case '\r':
+        this->output_ += 'r';
+        break;
+      case '\t':
+        this->output_ += 't';
+        break;
+      default:
+        this->output_ += "u00";
+        this->output_ += HEX_DIGITS[c >> 4];
+        this->output_ += HEX_DIGITS[c & 0x0F];
+        break;
+    }
+  }
+  this->output_.append(run, end - run);
+}
+
+}  // namespace json
+}  // namespace esphome
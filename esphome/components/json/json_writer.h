@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace esphome {
+namespace json {
+
+/** Streaming writer for a flat JSON object that appends straight to a string.
+ *
+ * For messages sent at a high rate, such as web_server state events, where building a JsonDocument
+ * and serializing it is too expensive. Only string, number, bool and nested object members are supported,
+ * use build_json() for arrays and add_members() to merge in what it built.
+ */
+class JsonObjectWriter {
+ public:
+  explicit JsonObjectWriter(size_t reserve = 64);
+
+  void add(const char *key, const char *value);
+  void add(const char *key, const std::string &value) { this->add_string_(key, value.data(), value.size()); }
+  void add(const char *key, bool value);
+  void add(const char *key, int32_t value);
+  void add(const char *key, uint32_t value);
+  /// Written with the fewest digits that read back as the same float, NaN and infinity as null.
+  void add(const char *key, float value);
+
+  /// Start a nested object as the value of \p key, members are added to it until end_object().
+  void begin_object(const char *key);
+  void end_object();
+
+  /// Append the members of the serialized JSON object \p object, for example one made with build_json().
+  void add_members(const std::string &object);
+
+  /// Close the object and return the JSON text, the writer must not be used afterwards.
+  std::string release();
+
+ protected:
+  void key_(const char *key);
+  void add_string_(const char *key, const char *value, size_t len);
+  void write_escaped_(const char *value, size_t len);
+
+  std::string output_;
+  bool first_{true};
+};
+
+}  // namespace json
+}  // namespace esphome
@@ -281,8 +281,12 @@ void LD2410Component::restart_and_read_all_info() {
 }
 
 void LD2410Component::loop() {
-  while (this->available()) {
-    this->readline_(this->read());
+  uint8_t buf[MAX_LINE_LENGTH];
+  size_t len;
+  while ((len = this->read_available(buf, sizeof(buf))) > 0) {
+    for (size_t i = 0; i < len; i++) {
+      this->readline_(buf[i]);
+    }
   }
 }
 
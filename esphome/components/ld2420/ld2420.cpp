@@ -327,8 +327,13 @@ void LD2420Component::revert_config_action() {
 
 void LD2420Component::loop() {
   // If there is a active send command do not process it here, the send command call will handle it.
-  while (!this->cmd_active_ && this->available()) {
-    this->readline_(this->read(), this->buffer_data_, MAX_LINE_LENGTH);
+  // Reads in chunks, a byte at a time costs a UART call per byte.
+  uint8_t buf[MAX_LINE_LENGTH];
+  size_t len;
+  while (!this->cmd_active_ && (len = this->read_available(buf, sizeof(buf))) > 0) {
+    for (size_t i = 0; i < len; i++) {
+      this->readline_(buf[i], this->buffer_data_, MAX_LINE_LENGTH);
+    }
   }
 }
 
@@ -11,6 +11,9 @@ ld2450_ns = cg.esphome_ns.namespace("ld2450")
 LD2450Component = ld2450_ns.class_("LD2450Component", cg.Component, uart.UARTDevice)
 
 CONF_LD2450_ID = "ld2450_id"
+CONF_ANGLE_THRESHOLD = "angle_threshold"
+CONF_DISTANCE_THRESHOLD = "distance_threshold"
+CONF_SPEED_THRESHOLD = "speed_threshold"
 
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
@@ -20,6 +23,13 @@ CONFIG_SCHEMA = cv.All(
                 cv.positive_time_period_milliseconds,
                 cv.Range(min=cv.TimePeriod(milliseconds=1)),
             ),
+            cv.Optional(CONF_DISTANCE_THRESHOLD, default="0mm"): cv.All(
+                cv.distance, cv.Range(min=0, max=1.0)
+            ),
+            cv.Optional(CONF_SPEED_THRESHOLD, default=0): cv.int_range(min=0, max=100),
+            cv.Optional(CONF_ANGLE_THRESHOLD, default=0.1): cv.float_range(
+                min=0, max=90
+            ),
         }
     )
     .extend(uart.UART_DEVICE_SCHEMA)
@@ -46,3 +56,6 @@ async def to_code(config):
     await cg.register_component(var, config)
     await uart.register_uart_device(var, config)
     cg.add(var.set_throttle(config[CONF_THROTTLE]))
+    cg.add(var.set_distance_threshold(int(config[CONF_DISTANCE_THRESHOLD] * 1000)))
+    cg.add(var.set_speed_threshold(config[CONF_SPEED_THRESHOLD]))
+    cg.add(var.set_angle_threshold(config[CONF_ANGLE_THRESHOLD]))
@@ -178,6 +178,11 @@ static inline float calculate_angle(float base, float hypotenuse) {
   return angle_degrees;
 }
 
+// True when a value moved further than threshold from the last published one
+static inline bool changed_beyond(int32_t last, int32_t value, uint16_t threshold, bool force) {
+  return force || std::abs(value - last) > threshold;
+}
+
 static bool validate_header_footer(const uint8_t *header_footer, const uint8_t *buffer) {
   for (uint8_t i = 0; i < HEADER_FOOTER_SIZE; i++) {
     if (header_footer[i] != buffer[i]) {
@@ -207,8 +212,12 @@ void LD2450Component::dump_config() {
                 "LD2450:\n"
                 "  Firmware version: %s\n"
                 "  MAC address: %s\n"
-                "  Throttle: %u ms",
-                version.c_str(), mac_str.c_str(), this->throttle_);
+                "  Throttle: %u ms\n"
+                "  Distance threshold: %u mm\n"
+                "  Speed threshold: %u cm/s\n"
+                "  Angle threshold: %.1f°",
+                version.c_str(), mac_str.c_str(), this->throttle_, this->distance_threshold_, this->speed_threshold_,
+                this->angle_threshold_);
 #ifdef USE_BINARY_SENSOR
   ESP_LOGCONFIG(TAG, "Binary Sensors:");
   LOG_BINARY_SENSOR("  ", "MovingTarget", this->moving_target_binary_sensor_);
@@ -284,8 +293,12 @@ void LD2450Component::dump_config() {
 }
 
 void LD2450Component::loop() {
-  while (this->available()) {
-    this->readline_(this->read());
+  uint8_t buf[MAX_LINE_LENGTH];
+  size_t len;
+  while ((len = this->read_available(buf, sizeof(buf))) > 0) {
+    for (size_t i = 0; i < len; i++) {
+      this->readline_(buf[i]);
+    }
   }
 }
 
@@ -473,28 +486,30 @@ void LD2450Component::handle_periodic_data_() {
 #if defined(USE_BINARY_SENSOR) || defined(USE_SENSOR) || defined(USE_TEXT_SENSOR)
   // Loop thru targets
   for (index = 0; index < MAX_TARGETS; index++) {
+    is_moving = false;
+    start = TARGET_X + index * 8;
+    tx = ld2450::decode_coordinate(this->buffer_data_[start], this->buffer_data_[start + 1]);
+    start = TARGET_Y + index * 8;
+    ty = ld2450::decode_coordinate(this->buffer_data_[start], this->buffer_data_[start + 1]);
 #ifdef USE_SENSOR
+    // A target appearing or leaving is always published, whatever the thresholds
+    bool present = tx != 0 || ty != 0;
+    bool force = present != this->cached_target_data_[index].present;
+    this->cached_target_data_[index].present = present;
     // X
-    start = TARGET_X + index * 8;
-    is_moving = false;
     sensor::Sensor *sx = this->move_x_sensors_[index];
     if (sx != nullptr) {
-      val = ld2450::decode_coordinate(this->buffer_data_[start], this->buffer_data_[start + 1]);
-      tx = val;
-      if (this->cached_target_data_[index].x != val) {
-        sx->publish_state(val);
-        this->cached_target_data_[index].x = val;
+      if (changed_beyond(this->cached_target_data_[index].x, tx, this->distance_threshold_, force)) {
+        sx->publish_state(tx);
+        this->cached_target_data_[index].x = tx;
       }
     }
     // Y
-    start = TARGET_Y + index * 8;
     sensor::Sensor *sy = this->move_y_sensors_[index];
     if (sy != nullptr) {
-      val = ld2450::decode_coordinate(this->buffer_data_[start], this->buffer_data_[start + 1]);
-      ty = val;
-      if (this->cached_target_data_[index].y != val) {
-        sy->publish_state(val);
-        this->cached_target_data_[index].y = val;
+      if (changed_beyond(this->cached_target_data_[index].y, ty, this->distance_threshold_, force)) {
+        sy->publish_state(ty);
+        this->cached_target_data_[index].y = ty;
       }
     }
     // RESOLUTION
@@ -519,7 +534,7 @@ void LD2450Component::handle_periodic_data_() {
 #ifdef USE_SENSOR
     sensor::Sensor *ss = this->move_speed_sensors_[index];
     if (ss != nullptr) {
-      if (this->cached_target_data_[index].speed != val) {
+      if (changed_beyond(this->cached_target_data_[index].speed, val, this->speed_threshold_, force)) {
         ss->publish_state(val);
         this->cached_target_data_[index].speed = val;
       }
@@ -537,7 +552,7 @@ void LD2450Component::handle_periodic_data_() {
 #ifdef USE_SENSOR
     sensor::Sensor *sd = this->move_distance_sensors_[index];
     if (sd != nullptr) {
-      if (this->cached_target_data_[index].distance != val) {
+      if (changed_beyond(this->cached_target_data_[index].distance, val, this->distance_threshold_, force)) {
         sd->publish_state(val);
         this->cached_target_data_[index].distance = val;
       }
@@ -549,8 +564,8 @@ void LD2450Component::handle_periodic_data_() {
     }
     sensor::Sensor *sa = this->move_angle_sensors_[index];
     if (sa != nullptr) {
-      if (std::isnan(this->cached_target_data_[index].angle) ||
-          std::abs(this->cached_target_data_[index].angle - angle) > 0.1f) {
+      if (force || std::isnan(this->cached_target_data_[index].angle) ||
+          std::abs(this->cached_target_data_[index].angle - angle) > this->angle_threshold_) {
         sa->publish_state(angle);
         this->cached_target_data_[index].angle = angle;
       }
@@ -111,6 +111,9 @@ class LD2450Component : public Component, public uart::UARTDevice {
   void loop() override;
   void set_presence_timeout();
   void set_throttle(uint16_t value) { this->throttle_ = value; }
+  void set_distance_threshold(uint16_t value) { this->distance_threshold_ = value; }
+  void set_speed_threshold(uint16_t value) { this->speed_threshold_ = value; }
+  void set_angle_threshold(float value) { this->angle_threshold_ = value; }
   void read_all_info();
   void query_zone_info();
   void restart_and_read_all_info();
@@ -166,6 +169,10 @@ class LD2450Component : public Component, public uart::UARTDevice {
   uint32_t still_presence_millis_ = 0;
   uint32_t moving_presence_millis_ = 0;
   uint16_t throttle_ = 0;
+  // Smallest changes that get published, exact changes by default (the angle is an integer)
+  uint16_t distance_threshold_ = 0;
+  uint16_t speed_threshold_ = 0;
+  float angle_threshold_ = 0.1f;
   uint16_t timeout_ = 5;
   uint8_t buffer_data_[MAX_LINE_LENGTH];
   uint8_t mac_address_[6] = {0, 0, 0, 0, 0, 0};
@@ -187,6 +194,7 @@ class LD2450Component : public Component, public uart::UARTDevice {
     uint16_t distance = std::numeric_limits<uint16_t>::max();    // 65535, outside range of 0 to ~8990
     Direction direction = DIRECTION_UNDEFINED;                   // Undefined, will differ from any real direction
     float angle = NAN;                                           // NAN, safe sentinel for floats
+    bool present = false;                                        // A target was reported in the slot
   } cached_target_data_[MAX_TARGETS];
 
   struct CachedZoneData {
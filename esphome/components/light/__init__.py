@@ -66,6 +66,8 @@ from .types import (  # noqa
 CODEOWNERS = ["@esphome/core"]
 IS_PLATFORM_COMPONENT = True
 
+CONF_SKIP_UNCHANGED = "skip_unchanged"
+
 LightRestoreMode = light_ns.enum("LightRestoreMode")
 RESTORE_MODES = {
     "RESTORE_DEFAULT_OFF": LightRestoreMode.LIGHT_RESTORE_DEFAULT_OFF,
@@ -145,6 +147,7 @@ ADDRESSABLE_LIGHT_SCHEMA = RGB_LIGHT_SCHEMA.extend(
             [cv.percentage], cv.Length(min=3, max=4)
         ),
         cv.Optional(CONF_POWER_SUPPLY): cv.use_id(power_supply.PowerSupply),
+        cv.Optional(CONF_SKIP_UNCHANGED, default=False): cv.boolean,
     }
 )
 
@@ -261,6 +264,9 @@ async def setup_light_core_(light_var, output_var, config):
         var_ = await cg.get_variable(power_supply_id)
         cg.add(output_var.set_power_supply(var_))
 
+    if config.get(CONF_SKIP_UNCHANGED):
+        cg.add(output_var.set_skip_unchanged(True))
+
     if (mqtt_id := config.get(CONF_MQTT_ID)) is not None:
         mqtt_ = cg.new_Pvariable(mqtt_id, light_var)
         await mqtt.register_mqtt_component(mqtt_, config)
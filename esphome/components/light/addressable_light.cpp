@@ -1,6 +1,8 @@
 #include "addressable_light.h"
 #include "esphome/core/log.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace light {
 
@@ -48,6 +50,49 @@ void AddressableLight::update_state(LightState *state) {
   this->schedule_show();
 }
 
+void AddressableLight::move_leds(int32_t to, int32_t from, int32_t count) {
+  count = std::min(count, this->size() - std::max(to, from));
+  if ((to < 0) || (from < 0) || (count <= 0) || (to == from))
+    return;
+
+  const ESPBufferLayout layout = this->get_buffer_layout_();
+  if (layout.buffer != nullptr) {
+    memmove(layout.buffer + to * layout.stride, layout.buffer + from * layout.stride, count * layout.stride);
+    return;
+  }
+
+  // Copy in the direction that does not overwrite LEDs before they were copied
+  if (from > to) {
+    for (int32_t i = 0; i < count; i++)
+      this->get_view_internal(to + i).set(this->get_view_internal(from + i).get());
+  } else {
+    for (int32_t i = count - 1; i >= 0; i--)
+      this->get_view_internal(to + i).set(this->get_view_internal(from + i).get());
+  }
+}
+
+bool AddressableLight::frame_changed_() {
+  if (!this->skip_unchanged_)
+    return true;
+  const ESPBufferLayout layout = this->get_buffer_layout_();
+  if (layout.buffer == nullptr)
+    return true;
+
+  // 32-bit FNV-1a over the corrected bytes of all LEDs
+  uint32_t hash = 2166136261UL;
+  const uint8_t *data = layout.buffer;
+  const size_t len = static_cast<size_t>(this->size()) * layout.stride;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 16777619UL;
+  }
+  if (this->frame_hash_valid_ && (hash == this->last_frame_hash_))
+    return false;
+  this->last_frame_hash_ = hash;
+  this->frame_hash_valid_ = true;
+  return true;
+}
+
 void AddressableLightTransformer::start() {
   // don't try to transition over running effects.
   if (this->light_.is_effect_active())
@@ -10,6 +10,8 @@
 #include "light_state.h"
 #include "transformers.h"
 
+#include <algorithm>
+
 #ifdef USE_POWER_SUPPLY
 #include "esphome/components/power_supply/power_supply.h"
 #endif
@@ -28,6 +30,16 @@ class AddressableLightState : public LightState {
   using LightState::LightState;
 };
 
+/// Where a driver keeps the corrected bytes of its LEDs, so they can be written without a view per LED.
+struct ESPBufferLayout {
+  uint8_t *buffer{nullptr};  // Bytes of the first LED, nullptr if the driver has no such buffer
+  uint8_t stride{0};         // Bytes per LED
+  uint8_t red{0};
+  uint8_t green{0};
+  uint8_t blue{0};
+  int8_t white{-1};  // -1 without a white channel
+};
+
 class AddressableLight : public LightOutput, public Component {
  public:
   virtual int32_t size() const = 0;
@@ -42,6 +54,64 @@ class AddressableLight : public LightOutput, public Component {
   ESPRangeView all() { return ESPRangeView(this, 0, this->size()); }
   ESPRangeIterator begin() { return this->all().begin(); }
   ESPRangeIterator end() { return this->all().end(); }
+  /// @brief Sets `count` LEDs starting at `index` to `color_at(0)`, `color_at(1)`, ... like assigning each of them.
+  /// Drivers that expose their buffer get the colors corrected through cached tables and stored in one pass.
+  template<typename F> void set_colors(int32_t index, int32_t count, F &&color_at) {
+    count = std::min(count, this->size() - index);
+    if ((index < 0) || (count <= 0))
+      return;
+    const ESPBufferLayout layout = this->get_buffer_layout_();
+    if (layout.buffer == nullptr) {
+      for (int32_t i = 0; i < count; i++)
+        this->get_view_internal(index + i).set(color_at(i));
+      return;
+    }
+    const uint8_t *red = this->correction_.get_correction_tables();
+    const uint8_t *green = red + 256;
+    const uint8_t *blue = green + 256;
+    const uint8_t *white = blue + 256;
+    uint8_t *out = layout.buffer + index * layout.stride;
+    for (int32_t i = 0; i < count; i++, out += layout.stride) {
+      const Color color = color_at(i);
+      out[layout.red] = red[color.red];
+      out[layout.green] = green[color.green];
+      out[layout.blue] = blue[color.blue];
+      if (layout.white >= 0)
+        out[layout.white] = white[color.white];
+    }
+  }
+  /// @brief Replaces each of `count` LEDs starting at `index` with `fn(color, i)`, where `color` is what the LED's
+  /// view returns. Drivers that expose their buffer get read and written through cached tables in one pass.
+  template<typename F> void transform_colors(int32_t index, int32_t count, F &&fn) {
+    count = std::min(count, this->size() - index);
+    if ((index < 0) || (count <= 0))
+      return;
+    const ESPBufferLayout layout = this->get_buffer_layout_();
+    if (layout.buffer == nullptr) {
+      for (int32_t i = 0; i < count; i++) {
+        ESPColorView view = this->get_view_internal(index + i);
+        view.set(fn(view.get(), i));
+      }
+      return;
+    }
+    const uint8_t *correct = this->correction_.get_correction_tables();
+    const uint8_t *uncorrect = this->correction_.get_uncorrection_tables();
+    uint8_t *out = layout.buffer + index * layout.stride;
+    for (int32_t i = 0; i < count; i++, out += layout.stride) {
+      const uint8_t white = layout.white >= 0 ? uncorrect[768 + out[layout.white]] : 0;
+      const Color color = fn(Color(uncorrect[out[layout.red]], uncorrect[256 + out[layout.green]],
+                                   uncorrect[512 + out[layout.blue]], white),
+                             i);
+      out[layout.red] = correct[color.red];
+      out[layout.green] = correct[256 + color.green];
+      out[layout.blue] = correct[512 + color.blue];
+      if (layout.white >= 0)
+        out[layout.white] = correct[768 + color.white];
+    }
+  }
+  /// @brief Copies `count` LEDs from `from` to `to`, which may overlap. Drivers that expose their buffer copy the
+  /// corrected bytes as they are, without correcting them again.
+  void move_leds(int32_t to, int32_t from, int32_t count);
   void shift_left(int32_t amnt) {
     if (amnt < 0) {
       this->shift_right(-amnt);
@@ -74,6 +144,9 @@ class AddressableLight : public LightOutput, public Component {
   }
   void update_state(LightState *state) override;
   void schedule_show() { this->state_parent_->next_write_ = true; }
+  /// @brief Lets drivers skip writing frames identical to the last one written. Only drivers that expose their
+  /// buffer through get_buffer_layout_() can tell.
+  void set_skip_unchanged(bool skip_unchanged) { this->skip_unchanged_ = skip_unchanged; }
 
 #ifdef USE_POWER_SUPPLY
   void set_power_supply(power_supply::PowerSupply *power_supply) { this->power_.set_parent(power_supply); }
@@ -96,6 +169,13 @@ class AddressableLight : public LightOutput, public Component {
 #endif
   }
   virtual ESPColorView get_view_internal(int32_t index) const = 0;
+  /// @brief Drivers storing their LEDs as evenly spaced bytes in one buffer return its layout here, for set_colors()
+  virtual ESPBufferLayout get_buffer_layout_() const { return {}; }
+  /// @brief Returns false if skipping unchanged frames is enabled and the LEDs are the same as when this was last
+  /// called, so the driver can return from write_state() without sending anything
+  bool frame_changed_();
+  /// @brief Makes the next frame_changed_() return true, for drivers that could not send the frame after all
+  void invalidate_frame_() { this->frame_hash_valid_ = false; }
 
   ESPColorCorrection correction_{};
   LightState *state_parent_{nullptr};
@@ -103,6 +183,9 @@ class AddressableLight : public LightOutput, public Component {
   power_supply::PowerSupplyRequester power_;
 #endif
   bool effect_active_{false};
+  bool skip_unchanged_{false};
+  bool frame_hash_valid_{false};
+  uint32_t last_frame_hash_{0};
 };
 
 class AddressableLightTransformer : public LightTransitionTransformer {
@@ -298,12 +298,12 @@ class AddressableFireworksEffect : public AddressableLightEffect {
     this->last_update_ = now;
     // "invert" the fade out parameter so that higher values make fade out faster
     const uint8_t fade_out_mult = 255u - this->fade_out_rate_;
-    for (auto view : it) {
-      Color target = view.get() * fade_out_mult;
+    it.transform_colors(0, it.size(), [fade_out_mult](Color color, int32_t) {
+      Color target = color * fade_out_mult;
       if (target.r < 64)
         target *= 170;
-      view = target;
-    }
+      return target;
+    });
     int last = it.size() - 1;
     it[0].set(it[0].get() + (it[1].get() * 128));
     for (int i = 1; i < last; i++) {
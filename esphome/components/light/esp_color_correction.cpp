@@ -1,11 +1,13 @@
 #include "esp_color_correction.h"
 #include "light_color_values.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
 namespace light {
 
 void ESPColorCorrection::calculate_gamma_table(float gamma) {
+  this->invalidate_tables_();
   for (uint16_t i = 0; i < 256; i++) {
     // corrected = val ^ gamma
     auto corrected = to_uint8_scale(gamma_correct(i / 255.0f, gamma));
@@ -23,5 +25,43 @@ void ESPColorCorrection::calculate_gamma_table(float gamma) {
   }
 }
 
+const uint8_t *ESPColorCorrection::get_correction_tables() const {
+  if (this->correction_tables_ == nullptr) {
+    this->correction_tables_ = make_unique<uint8_t[]>(4 * 256);
+    this->correction_tables_valid_ = false;
+  }
+  if (!this->correction_tables_valid_) {
+    const uint8_t max_brightness[4] = {this->max_brightness_.red, this->max_brightness_.green,
+                                       this->max_brightness_.blue, this->max_brightness_.white};
+    uint8_t *table = this->correction_tables_.get();
+    for (uint8_t channel = 0; channel < 4; channel++) {
+      for (uint16_t i = 0; i < 256; i++) {
+        *table++ = this->gamma_table_[esp_scale8(esp_scale8(i, max_brightness[channel]), this->local_brightness_)];
+      }
+    }
+    this->correction_tables_valid_ = true;
+  }
+  return this->correction_tables_.get();
+}
+
+const uint8_t *ESPColorCorrection::get_uncorrection_tables() const {
+  if (this->uncorrection_tables_ == nullptr) {
+    this->uncorrection_tables_ = make_unique<uint8_t[]>(4 * 256);
+    this->uncorrection_tables_valid_ = false;
+  }
+  if (!this->uncorrection_tables_valid_) {
+    uint8_t *table = this->uncorrection_tables_.get();
+    for (uint16_t i = 0; i < 256; i++) {
+      const Color uncorrected = this->color_uncorrect(Color(i, i, i, i));
+      table[i] = uncorrected.red;
+      table[256 + i] = uncorrected.green;
+      table[512 + i] = uncorrected.blue;
+      table[768 + i] = uncorrected.white;
+    }
+    this->uncorrection_tables_valid_ = true;
+  }
+  return this->uncorrection_tables_.get();
+}
+
 }  // namespace light
 }  // namespace esphome
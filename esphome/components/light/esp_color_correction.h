@@ -2,15 +2,31 @@
 
 #include "esphome/core/color.h"
 
+#include <memory>
+
 namespace esphome {
 namespace light {
 
 class ESPColorCorrection {
  public:
   ESPColorCorrection() : max_brightness_(255, 255, 255, 255) {}
-  void set_max_brightness(const Color &max_brightness) { this->max_brightness_ = max_brightness; }
-  void set_local_brightness(uint8_t local_brightness) { this->local_brightness_ = local_brightness; }
+  void set_max_brightness(const Color &max_brightness) {
+    this->max_brightness_ = max_brightness;
+    this->invalidate_tables_();
+  }
+  void set_local_brightness(uint8_t local_brightness) {
+    if (local_brightness == this->local_brightness_)
+      return;
+    this->local_brightness_ = local_brightness;
+    this->invalidate_tables_();
+  }
   void calculate_gamma_table(float gamma);
+  /// @brief Returns four tables of 256 entries, for red, green, blue and white, that map an uncorrected value straight
+  /// to the corrected one color_correct() computes. They are rebuilt on first use after the brightness or gamma
+  /// changed, so writing many LEDs costs one lookup per channel instead of two scalings and a lookup.
+  const uint8_t *get_correction_tables() const;
+  /// @brief Same as get_correction_tables(), mapping corrected values back to what color_uncorrect() returns
+  const uint8_t *get_uncorrection_tables() const;
   inline Color color_correct(Color color) const ESPHOME_ALWAYS_INLINE {
     // corrected = (uncorrected * max_brightness * local_brightness) ^ gamma
     return Color(this->color_correct_red(color.red), this->color_correct_green(color.green),
@@ -71,6 +87,16 @@ class ESPColorCorrection {
   uint8_t gamma_reverse_table_[256];
   Color max_brightness_;
   uint8_t local_brightness_{255};
+  void invalidate_tables_() {
+    this->correction_tables_valid_ = false;
+    this->uncorrection_tables_valid_ = false;
+  }
+
+  // Only allocated once something reads or writes LEDs in bulk
+  mutable std::unique_ptr<uint8_t[]> correction_tables_;
+  mutable std::unique_ptr<uint8_t[]> uncorrection_tables_;
+  mutable bool correction_tables_valid_{false};
+  mutable bool uncorrection_tables_valid_{false};
 };
 
 }  // namespace light
@@ -62,6 +62,14 @@ class ESPColorView : public ESPColorSettable {
       return;
     *this->white_ = this->color_correction_->color_correct_white(white);
   }
+  /// @brief Stores an already corrected color, like one from get_color_correction()->color_correct()
+  void set_raw(const Color &color) {
+    *this->red_ = color.red;
+    *this->green_ = color.green;
+    *this->blue_ = color.blue;
+    if (this->white_ != nullptr)
+      *this->white_ = color.white;
+  }
   void set_effect_data(uint8_t effect_data) override {
     if (this->effect_data_ == nullptr)
       return;
@@ -93,6 +101,7 @@ class ESPColorView : public ESPColorSettable {
       return 0;
     return *this->effect_data_;
   }
+  const ESPColorCorrection *get_color_correction() const { return this->color_correction_; }
   void raw_set_color_correction(const ESPColorCorrection *color_correction) {
     this->color_correction_ = color_correction;
   }
@@ -18,8 +18,12 @@ ESPRangeIterator ESPRangeView::begin() { return {*this, this->begin_}; }
 ESPRangeIterator ESPRangeView::end() { return {*this, this->end_}; }
 
 void ESPRangeView::set(const Color &color) {
+  if (this->begin_ >= this->end_)
+    return;
+  // Every LED gets the same color, so correct it once and only store the result
+  const Color corrected = (*this->parent_)[this->begin_].get_color_correction()->color_correct(color);
   for (int32_t i = this->begin_; i < this->end_; i++) {
-    (*this->parent_)[i] = color;
+    (*this->parent_)[i].set_raw(corrected);
   }
 }
 
@@ -45,21 +49,46 @@ void ESPRangeView::set_effect_data(uint8_t effect_data) {
 }
 
 void ESPRangeView::fade_to_white(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_white(amnt);
+  this->parent_->transform_colors(this->begin_, this->size(),
+                                  [amnt](Color color, int32_t) { return color.fade_to_white(amnt); });
 }
 void ESPRangeView::fade_to_black(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_black(amnt);
+  this->parent_->transform_colors(this->begin_, this->size(),
+                                  [amnt](Color color, int32_t) { return color.fade_to_black(amnt); });
 }
 void ESPRangeView::lighten(uint8_t delta) {
-  for (auto c : *this)
-    c.lighten(delta);
+  this->parent_->transform_colors(this->begin_, this->size(),
+                                  [delta](Color color, int32_t) { return color.lighten(delta); });
 }
 void ESPRangeView::darken(uint8_t delta) {
-  for (auto c : *this)
-    c.darken(delta);
+  this->parent_->transform_colors(this->begin_, this->size(),
+                                  [delta](Color color, int32_t) { return color.darken(delta); });
+}
+
+void ESPRangeView::fill_gradient(const Color &from, const Color &to) {
+  const int32_t last = this->size() - 1;
+  if (last <= 0) {
+    this->set(from);
+    return;
+  }
+  this->parent_->set_colors(this->begin_, this->size(), [from, to, last](int32_t i) {
+    return Color(from).gradient(to, static_cast<uint8_t>(i * 255 / last));
+  });
+}
+
+void ESPRangeView::fill_palette(const Color *palette, size_t size, uint8_t start_index, uint8_t index_step) {
+  if (size == 0)
+    return;
+  this->parent_->set_colors(this->begin_, this->size(), [palette, size, start_index, index_step](int32_t i) {
+    return palette_color(palette, size, start_index + i * index_step);
+  });
+}
+
+void ESPRangeView::blend(const Color &color, uint8_t amnt) {
+  this->parent_->transform_colors(this->begin_, this->size(),
+                                  [color, amnt](Color current, int32_t) { return current.gradient(color, amnt); });
 }
+
 ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   // If size doesn't match, error (todo warning)
   if (rhs.size() != this->size())
@@ -71,25 +100,18 @@ ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
     return *this;
   }
 
-  // If both equal, already done
-  if (rhs.begin_ == this->begin_)
-    return *this;
-
-  if (rhs.begin_ > this->begin_) {
-    // Copy from left
-    for (int32_t i = 0; i < this->size(); i++) {
-      (*this)[i].set(rhs[i].get());
-    }
-  } else {
-    // Copy from right
-    for (int32_t i = this->size() - 1; i >= 0; i--) {
-      (*this)[i].set(rhs[i].get());
-    }
-  }
-
+  this->parent_->move_leds(this->begin_, rhs.begin_, this->size());
   return *this;
 }
 
+Color palette_color(const Color *palette, size_t size, uint8_t index) {
+  // Each entry covers 256 / size indices, the fraction within them blends towards the next entry
+  const uint32_t position = index * size;
+  const Color &current = palette[position / 256];
+  const Color &next = palette[(position / 256 + 1) % size];
+  return Color(current).gradient(next, position % 256);
+}
+
 ESPColorView ESPRangeIterator::operator*() const { return this->range_.parent_->get(this->i_); }
 
 }  // namespace light
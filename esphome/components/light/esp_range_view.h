@@ -11,6 +11,10 @@ int32_t interpret_index(int32_t index, int32_t size);
 class AddressableLight;
 class ESPRangeIterator;
 
+/// @brief Returns the color at `index` of a palette of `size` colors spread over 0-255, blending neighbouring entries.
+/// The palette wraps around, so index 255 blends the last entry towards the first.
+Color palette_color(const Color *palette, size_t size, uint8_t index);
+
 /**
  * A half-open range of LEDs, inclusive of the begin index and exclusive of the end index, using zero-based numbering.
  */
@@ -38,6 +42,17 @@ class ESPRangeView : public ESPColorSettable {
   void lighten(uint8_t delta) override;
   void darken(uint8_t delta) override;
 
+  // The operations below work on the whole range at once, which is several times faster than going through the view
+  // of every LED on drivers that expose their buffer.
+
+  /// @brief Fills the range with a gradient from `from` at the first LED to `to` at the last
+  void fill_gradient(const Color &from, const Color &to);
+  /// @brief Fills the range from a palette, like palette_color(), starting at `start_index` and advancing the index by
+  /// `index_step` per LED
+  void fill_palette(const Color *palette, size_t size, uint8_t start_index, uint8_t index_step);
+  /// @brief Moves every LED `amnt` of the way towards `color`, 255 reaching it
+  void blend(const Color &color, uint8_t amnt);
+
   ESPRangeView &operator=(const Color &rhs) {
     this->set(rhs);
     return *this;
@@ -0,0 +1,26 @@
+#include "gamma_table.h"
+
+namespace esphome {
+namespace light {
+
+GammaTable *GammaTable::first_table = nullptr;
+
+GammaTable::GammaTable(float gamma) : gamma_(gamma) {
+  for (size_t i = 0; i <= SIZE; i++) {
+    this->values_[i] = gamma_correct(static_cast<float>(i) / SIZE, gamma);
+  }
+}
+
+const GammaTable *GammaTable::get(float gamma) {
+  // Nearly every node uses one or two gamma values, so a list is searched quickly
+  GammaTable **tail = &first_table;
+  for (; *tail != nullptr; tail = &(*tail)->next_) {
+    if ((*tail)->gamma_ == gamma)
+      return *tail;
+  }
+  *tail = new GammaTable(gamma);  // NOLINT(cppcoreguidelines-owning-memory)
+  return *tail;
+}
+
+}  // namespace light
+}  // namespace esphome
@@ -8,45 +8,42 @@ namespace light {
 
 // See https://www.home-assistant.io/integrations/light.mqtt/#json-schema for documentation on the schema
 
-void LightJSONSchema::dump_json(LightState &state, JsonObject root) {
-  // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  if (state.supports_effects())
-    root["effect"] = state.get_effect_name();
-
-  auto values = state.remote_values;
-  auto traits = state.get_output()->get_traits();
-
-  switch (values.get_color_mode()) {
-    case ColorMode::UNKNOWN:  // don't need to set color mode if we don't know it
-      break;
+static const char *color_mode_to_json(ColorMode color_mode) {
+  switch (color_mode) {
     case ColorMode::ON_OFF:
-      root["color_mode"] = "onoff";
-      break;
+      return "onoff";
     case ColorMode::BRIGHTNESS:
-      root["color_mode"] = "brightness";
-      break;
+      return "brightness";
     case ColorMode::WHITE:  // not supported by HA in MQTT
-      root["color_mode"] = "white";
-      break;
+      return "white";
     case ColorMode::COLOR_TEMPERATURE:
-      root["color_mode"] = "color_temp";
-      break;
+      return "color_temp";
     case ColorMode::COLD_WARM_WHITE:  // not supported by HA
-      root["color_mode"] = "cwww";
-      break;
+      return "cwww";
     case ColorMode::RGB:
-      root["color_mode"] = "rgb";
-      break;
+      return "rgb";
     case ColorMode::RGB_WHITE:
-      root["color_mode"] = "rgbw";
-      break;
+      return "rgbw";
     case ColorMode::RGB_COLOR_TEMPERATURE:  // not supported by HA
-      root["color_mode"] = "rgbct";
-      break;
+      return "rgbct";
     case ColorMode::RGB_COLD_WARM_WHITE:
-      root["color_mode"] = "rgbww";
-      break;
+      return "rgbww";
+    case ColorMode::UNKNOWN:  // don't need to set color mode if we don't know it
+    default:
+      return nullptr;
   }
+}
+
+void LightJSONSchema::dump_json(LightState &state, JsonObject root) {
+  // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
+  if (state.supports_effects())
+    root["effect"] = state.get_effect_name();
+
+  auto values = state.remote_values;
+
+  const char *color_mode = color_mode_to_json(values.get_color_mode());
+  if (color_mode != nullptr)
+    root["color_mode"] = color_mode;
 
   if (values.get_color_mode() & ColorCapability::ON_OFF)
     root["state"] = (values.get_state() != 0.0f) ? "ON" : "OFF";
@@ -73,6 +70,41 @@ void LightJSONSchema::dump_json(LightState &state, JsonObject root) {
   }
 }
 
+void LightJSONSchema::dump_json(LightState &state, json::JsonObjectWriter &writer) {
+  if (state.supports_effects())
+    writer.add("effect", state.get_effect_name());
+
+  auto values = state.remote_values;
+
+  const char *color_mode = color_mode_to_json(values.get_color_mode());
+  if (color_mode != nullptr)
+    writer.add("color_mode", color_mode);
+
+  if (values.get_color_mode() & ColorCapability::ON_OFF)
+    writer.add("state", (values.get_state() != 0.0f) ? "ON" : "OFF");
+  if (values.get_color_mode() & ColorCapability::BRIGHTNESS)
+    writer.add("brightness", uint32_t(uint8_t(values.get_brightness() * 255)));
+
+  // Same members as the JsonObject version, the root level ones after the color object is closed
+  writer.begin_object("color");
+  if (values.get_color_mode() & ColorCapability::RGB) {
+    writer.add("r", uint32_t(uint8_t(values.get_color_brightness() * values.get_red() * 255)));
+    writer.add("g", uint32_t(uint8_t(values.get_color_brightness() * values.get_green() * 255)));
+    writer.add("b", uint32_t(uint8_t(values.get_color_brightness() * values.get_blue() * 255)));
+  }
+  if (values.get_color_mode() & ColorCapability::WHITE)
+    writer.add("w", uint32_t(uint8_t(values.get_white() * 255)));
+  if (values.get_color_mode() & ColorCapability::COLD_WARM_WHITE) {
+    writer.add("c", uint32_t(uint8_t(values.get_cold_white() * 255)));
+    writer.add("w", uint32_t(uint8_t(values.get_warm_white() * 255)));
+  }
+  writer.end_object();
+  if (values.get_color_mode() & ColorCapability::WHITE)
+    writer.add("white_value", uint32_t(uint8_t(values.get_white() * 255)));  // legacy API
+  if (values.get_color_mode() & ColorCapability::COLOR_TEMPERATURE)
+    writer.add("color_temp", uint32_t(values.get_color_temperature()));
+}
+
 void LightJSONSchema::parse_color_json(LightState &state, LightCall &call, JsonObject root) {
   if (root["state"].is<const char *>()) {
     auto val = parse_on_off(root["state"]);
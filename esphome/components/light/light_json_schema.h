@@ -15,6 +15,8 @@ class LightJSONSchema {
  public:
   /// Dump the state of a light as JSON.
   static void dump_json(LightState &state, JsonObject root);
+  /// Write the same state straight into a JsonObjectWriter, for state updates sent at a high rate.
+  static void dump_json(LightState &state, json::JsonObjectWriter &writer);
   /// Parse the JSON state of a light to a LightCall.
   static void parse_json(LightState &state, LightCall &call, JsonObject root);
 
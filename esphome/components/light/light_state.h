@@ -83,6 +83,10 @@ class LightState : public EntityBase, public Component {
   void loop() override;
   /// Shortly after HARDWARE.
   float get_setup_priority() const override;
+#ifdef USE_LOOP_TIERS
+  /// Effects and transitions need to be rendered at a steady rate.
+  LoopTier get_loop_tier() const override { return LoopTier::REALTIME; }
+#endif
 
   /** The current values of the light as outputted to the light.
    *
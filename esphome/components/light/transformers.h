@@ -33,11 +33,20 @@ class LightTransitionTransformer : public LightTransformer {
       this->intermediate_values_ = this->start_values_;
       this->intermediate_values_.set_state(false);
     }
+
+    this->last_progress_ = -1.0f;
   }
 
   optional<LightColorValues> apply() override {
     float p = this->get_progress_();
 
+    // Long transitions move so little per loop iteration that the outputs would mostly get the same values again, so
+    // only produce new values once the progress moved by a visible step. This only affects transitions longer than a
+    // minute or so, shorter ones move further every iteration anyway.
+    if ((p < 1.0f) && (p - this->last_progress_ < MIN_PROGRESS_STEP))
+      return {};
+    this->last_progress_ = p;
+
     // Halfway through, when intermediate state (off) is reached, flip it to the target, but remain off.
     if (this->changing_color_mode_ && p > 0.5f &&
         this->intermediate_values_.get_color_mode() != this->target_values_.get_color_mode()) {
@@ -59,9 +68,12 @@ class LightTransitionTransformer : public LightTransformer {
   // transition from 0 to 1 on x = [0, 1]
   static float smoothed_progress(float x) { return x * x * x * (x * (x * 6.0f - 15.0f) + 10.0f); }
 
+  static constexpr float MIN_PROGRESS_STEP = 1.0f / 4096.0f;
+
   LightColorValues end_values_{};
   LightColorValues intermediate_values_{};
   bool changing_color_mode_{false};
+  float last_progress_{-1.0f};
 };
 
 class LightFlashTransformer : public LightTransformer {
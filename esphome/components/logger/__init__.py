@@ -39,6 +39,7 @@ from esphome.const import (
     CONF_LOGGER,
     CONF_LOGS,
     CONF_ON_MESSAGE,
+    CONF_SIZE,
     CONF_TAG,
     CONF_TRIGGER_ID,
     CONF_TX_BUFFER_SIZE,
@@ -52,6 +53,7 @@ from esphome.const import (
     PlatformFramework,
 )
 from esphome.core import CORE, Lambda, coroutine_with_priority
+import esphome.final_validate as fv
 
 CODEOWNERS = ["@esphome/core"]
 logger_ns = cg.esphome_ns.namespace("logger")
@@ -96,6 +98,10 @@ DEFAULT = "DEFAULT"
 CONF_INITIAL_LEVEL = "initial_level"
 CONF_LOGGER_ID = "logger_id"
 CONF_TASK_LOG_BUFFER_SIZE = "task_log_buffer_size"
+CONF_PERSISTENT_LOG = "persistent_log"
+CONF_STORAGE = "storage"
+STORAGE_RTC = "rtc"
+STORAGE_PSRAM = "psram"
 
 UART_SELECTION_ESP32 = {
     VARIANT_ESP32: [UART0, UART1, UART2],
@@ -187,9 +193,31 @@ def validate_local_no_higher_than_global(value):
             raise cv.Invalid(
                 f"The configured log level for {tag} ({level}) must be no more severe than the global log level {value[CONF_LEVEL]}."
             )
+    persistent_log = value.get(CONF_PERSISTENT_LOG, {})
+    if CONF_LEVEL in persistent_log and (
+        LOG_LEVEL_SEVERITY.index(persistent_log[CONF_LEVEL]) > global_level
+    ):
+        raise cv.Invalid(
+            f"The persistent log level ({persistent_log[CONF_LEVEL]}) must be no more "
+            f"severe than the global log level {value[CONF_LEVEL]}."
+        )
     return value
 
 
+def _validate_persistent_log(config):
+    # RTC slow memory is 8KB on most variants and shared with other users
+    if config[CONF_STORAGE] == STORAGE_RTC and config[CONF_SIZE] > 4096:
+        raise cv.Invalid(
+            f"At most 4096 bytes fit into RTC memory, use '{CONF_STORAGE}: "
+            f"{STORAGE_PSRAM}' for a larger persistent log"
+        )
+    if config[CONF_STORAGE] == STORAGE_PSRAM and not CORE.using_esp_idf:
+        raise cv.Invalid(
+            f"'{CONF_STORAGE}: {STORAGE_PSRAM}' requires the ESP-IDF framework"
+        )
+    return config
+
+
 Logger = logger_ns.class_("Logger", cg.Component)
 LoggerMessageTrigger = logger_ns.class_(
     "LoggerMessageTrigger",
@@ -198,6 +226,7 @@ LoggerMessageTrigger = logger_ns.class_(
 
 
 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH = "esp8266_store_log_strings_in_flash"
+CONF_ASYNC_TX = "async_tx"
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -207,6 +236,9 @@ CONFIG_SCHEMA = cv.All(
                 cv.validate_bytes, cv.int_range(min=160, max=65535)
             ),
             cv.Optional(CONF_DEASSERT_RTS_DTR, default=False): cv.boolean,
+            cv.Optional(CONF_ASYNC_TX): cv.All(
+                cv.only_on_esp32, cv.only_with_esp_idf, cv.boolean
+            ),
             cv.SplitDefault(
                 CONF_TASK_LOG_BUFFER_SIZE,
                 esp32=768,  # Default: 768 bytes (~5-6 messages with 70-byte text plus thread names)
@@ -266,6 +298,21 @@ CONFIG_SCHEMA = cv.All(
                     cv.Optional(CONF_LEVEL, default="WARN"): is_log_level,
                 }
             ),
+            cv.Optional(CONF_PERSISTENT_LOG): cv.All(
+                cv.Schema(
+                    {
+                        cv.Optional(CONF_SIZE, default="2048B"): cv.All(
+                            cv.validate_bytes, cv.int_range(min=256, max=65536)
+                        ),
+                        cv.Optional(CONF_STORAGE, default=STORAGE_RTC): cv.one_of(
+                            STORAGE_RTC, STORAGE_PSRAM, lower=True
+                        ),
+                        cv.Optional(CONF_LEVEL): is_log_level,
+                    }
+                ),
+                cv.only_on_esp32,
+                _validate_persistent_log,
+            ),
             cv.SplitDefault(
                 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH, esp8266=True
             ): cv.All(cv.only_on_esp8266, cv.boolean),
@@ -275,6 +322,22 @@ CONFIG_SCHEMA = cv.All(
 )
 
 
+def _final_validate(config):
+    persistent_log = config.get(CONF_PERSISTENT_LOG, {})
+    if (
+        persistent_log.get(CONF_STORAGE) == STORAGE_PSRAM
+        and "psram" not in fv.full_config.get()
+    ):
+        raise cv.Invalid(
+            f"'{CONF_STORAGE}: {STORAGE_PSRAM}' for the persistent log requires the "
+            "psram component"
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
 @coroutine_with_priority(90.0)
 async def to_code(config):
     baud_rate = config[CONF_BAUD_RATE]
@@ -292,6 +355,20 @@ async def to_code(config):
         if task_log_buffer_size > 0:
             cg.add_define("USE_ESPHOME_TASK_LOG_BUFFER")
             cg.add(log.init_log_buffer(task_log_buffer_size))
+        if config.get(CONF_ASYNC_TX, False):
+            cg.add_define("USE_LOGGER_ASYNC_TX")
+        if persistent_log := config.get(CONF_PERSISTENT_LOG):
+            cg.add_define("USE_LOGGER_PERSISTENT_LOG")
+            cg.add_define(
+                "ESPHOME_LOGGER_PERSISTENT_LOG_SIZE", persistent_log[CONF_SIZE]
+            )
+            if persistent_log[CONF_STORAGE] == STORAGE_PSRAM:
+                cg.add_define("USE_LOGGER_PERSISTENT_LOG_PSRAM")
+                add_idf_sdkconfig_option(
+                    "CONFIG_SPIRAM_ALLOW_NOINIT_EXTERNAL_MEMORY", True
+                )
+            persistent_level = LOG_LEVELS[persistent_log.get(CONF_LEVEL, level)]
+            cg.add(log.init_persistent_log(persistent_level))
 
     cg.add(log.set_log_level(initial_level))
     if CONF_HARDWARE_UART in config:
@@ -485,6 +562,10 @@ FILTER_SOURCE_FILES = filter_source_files_from_platform(
             PlatformFramework.LN882X_ARDUINO,
         },
         "logger_zephyr.cpp": {PlatformFramework.NRF52_ZEPHYR},
+        "persistent_log_buffer.cpp": {
+            PlatformFramework.ESP32_ARDUINO,
+            PlatformFramework.ESP32_IDF,
+        },
         "task_log_buffer.cpp": {
             PlatformFramework.ESP32_ARDUINO,
             PlatformFramework.ESP32_IDF,
@@ -1,4 +1,5 @@
 #include "logger.h"
+#include <algorithm>
 #include <cinttypes>
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
 #include <memory>  // For unique_ptr
@@ -7,6 +8,9 @@
 #include "esphome/core/application.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
+#ifdef USE_RUNTIME_STATS_TRACE
+#include "esphome/components/runtime_stats/trace_buffer.h"
+#endif
 
 namespace esphome {
 namespace logger {
@@ -25,7 +29,7 @@ static const char *const TAG = "logger";
 //    - Fallback to emergency console logging only if ring buffer is full
 //  - WITHOUT task log buffer: Only emergency console output, no callbacks
 void HOT Logger::log_vprintf_(uint8_t level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
-  if (level > this->level_for(tag))
+  if (level > this->effective_level_ || level > this->level_for(tag))
     return;
 
   TaskHandle_t current_task = xTaskGetCurrentTaskHandle();
@@ -38,6 +42,9 @@ void HOT Logger::log_vprintf_(uint8_t level, const char *tag, int line, const ch
 
   // Main task uses the shared buffer for efficiency
   if (is_main_task) {
+#ifdef USE_RUNTIME_STATS_TRACE
+    runtime_stats::TraceScope trace_scope("logger.write", runtime_stats::TraceCategory::LOGGER);
+#endif
     this->log_message_to_buffer_and_send_(level, tag, line, format, args);
     this->reset_task_log_recursion_(is_main_task);
     return;
@@ -75,11 +82,14 @@ void HOT Logger::log_vprintf_(uint8_t level, const char *tag, int line, const ch
 #else
 // Implementation for all other platforms
 void HOT Logger::log_vprintf_(uint8_t level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
-  if (level > this->level_for(tag) || global_recursion_guard_)
+  if (level > this->effective_level_ || level > this->level_for(tag) || global_recursion_guard_)
     return;
 
   global_recursion_guard_ = true;
 
+#ifdef USE_RUNTIME_STATS_TRACE
+  runtime_stats::TraceScope trace_scope("logger.write", runtime_stats::TraceCategory::LOGGER);
+#endif
   // Format and send to both console and callbacks
   this->log_message_to_buffer_and_send_(level, tag, line, format, args);
 
@@ -111,7 +121,7 @@ void HOT Logger::log_vprintf_(uint8_t level, const char *tag, int line, const ch
 //
 void Logger::log_vprintf_(uint8_t level, const char *tag, int line, const __FlashStringHelper *format,
                           va_list args) {  // NOLINT
-  if (level > this->level_for(tag) || global_recursion_guard_)
+  if (level > this->effective_level_ || level > this->level_for(tag) || global_recursion_guard_)
     return;
 
   global_recursion_guard_ = true;
@@ -163,6 +173,7 @@ Logger::Logger(uint32_t baud_rate, size_t tx_buffer_size) : baud_rate_(baud_rate
 #elif defined(USE_ZEPHYR)
   this->main_task_ = k_current_get();
 #endif
+  this->update_effective_level_();
 }
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
 void Logger::init_log_buffer(size_t total_buffer_size) {
@@ -174,6 +185,18 @@ void Logger::init_log_buffer(size_t total_buffer_size) {
 }
 #endif
 
+#ifdef USE_LOGGER_PERSISTENT_LOG
+void Logger::init_persistent_log(uint8_t level) {
+  this->persistent_log_.init();
+  this->add_on_log_callback(
+      [this, level](uint8_t msg_level, const char *tag, const char *message, size_t message_len) {
+        if (msg_level <= level)
+          this->persistent_log_.append(message, message_len);
+      },
+      level);
+}
+#endif
+
 #ifndef USE_ZEPHYR
 #if defined(USE_LOGGER_USB_CDC) || defined(USE_ESP32)
 void Logger::loop() {
@@ -194,16 +217,35 @@ void Logger::loop() {
 #endif
 #endif
 
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+// Limits for draining the task log buffer in one loop iteration. A burst from BLE/WiFi tasks
+// is spread over several iterations instead of stalling the main loop on console writes.
+static constexpr uint8_t TASK_LOG_MAX_MESSAGES_PER_LOOP = 16;
+static constexpr uint32_t TASK_LOG_DRAIN_BUDGET_US = 4000;
+#endif
+
 void Logger::process_messages_() {
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
+  // Report messages other tasks lost to a full buffer since the last report
+  const uint32_t dropped = this->log_buffer_->get_dropped_count();
+  if (dropped != this->task_log_dropped_reported_) {
+    const uint32_t lost = dropped - this->task_log_dropped_reported_;
+    this->task_log_dropped_reported_ = dropped;
+    ESP_LOGW(TAG, "Task log buffer full, %" PRIu32 " messages dropped", lost);
+  }
+
   // Process any buffered messages when available
   if (this->log_buffer_->has_messages()) {
     logger::TaskLogBuffer::LogMessage *message;
     const char *text;
     void *received_token;
+    const uint32_t start = micros();
+    uint8_t processed = 0;
 
-    // Process messages from the buffer
-    while (this->log_buffer_->borrow_message_main_loop(&message, &text, &received_token)) {
+    // Process messages from the buffer, the loop stays enabled while messages are left
+    while (processed < TASK_LOG_MAX_MESSAGES_PER_LOOP && micros() - start < TASK_LOG_DRAIN_BUDGET_US &&
+           this->log_buffer_->borrow_message_main_loop(&message, &text, &received_token)) {
+      processed++;
       this->tx_buffer_at_ = 0;
       // Use the thread name that was stored when the message was created
       // This avoids potential crashes if the task no longer exists
@@ -236,15 +278,49 @@ void Logger::process_messages_() {
 #endif
 }
 
-void Logger::set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
+void Logger::set_baud_rate(uint32_t baud_rate) {
+  this->baud_rate_ = baud_rate;
+  this->update_effective_level_();
+}
 void Logger::set_log_level(const std::string &tag, uint8_t log_level) { this->log_levels_[tag] = log_level; }
 
 #if defined(USE_ESP32) || defined(USE_ESP8266) || defined(USE_RP2040) || defined(USE_LIBRETINY) || defined(USE_ZEPHYR)
 UARTSelection Logger::get_uart() const { return this->uart_; }
 #endif
 
-void Logger::add_on_log_callback(std::function<void(uint8_t, const char *, const char *, size_t)> &&callback) {
+void Logger::add_on_log_callback(std::function<void(uint8_t, const char *, const char *, size_t)> &&callback,
+                                 uint8_t level) {
+#ifdef USE_LOGGER_RAW_LOGS
+  this->formatted_log_requests_++;
+#endif
   this->log_callback_.add(std::move(callback));
+  if (level > this->callback_level_) {
+    this->callback_level_ = level;
+    this->update_effective_level_();
+  }
+}
+
+void Logger::set_log_sink_level(const void *sink, uint8_t level) {
+  auto it = std::find_if(this->sink_levels_.begin(), this->sink_levels_.end(),
+                         [sink](const std::pair<const void *, uint8_t> &entry) { return entry.first == sink; });
+  if (it == this->sink_levels_.end()) {
+    this->sink_levels_.emplace_back(sink, level);
+  } else if (it->second == level) {
+    return;
+  } else {
+    it->second = level;
+  }
+  this->update_effective_level_();
+}
+
+void Logger::update_effective_level_() {
+  // The console prints everything level_for() lets through
+  uint8_t level = this->baud_rate_ > 0 ? ESPHOME_LOG_LEVEL_VERY_VERBOSE : this->callback_level_;
+  for (const auto &entry : this->sink_levels_) {
+    if (entry.second > level)
+      level = entry.second;
+  }
+  this->effective_level_ = level;
 }
 float Logger::get_setup_priority() const { return setup_priority::BUS + 500.0f; }
 static const char *const LOG_LEVELS[] = {"NONE", "ERROR", "WARN", "INFO", "CONFIG", "DEBUG", "VERBOSE", "VERY_VERBOSE"};
@@ -263,9 +339,24 @@ void Logger::dump_config() {
 #endif
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
   if (this->log_buffer_) {
-    ESP_LOGCONFIG(TAG, "  Task Log Buffer Size: %u", this->log_buffer_->size());
+    ESP_LOGCONFIG(TAG,
+                  "  Task Log Buffer Size: %u\n"
+                  "  Task Log Messages Dropped: %" PRIu32,
+                  this->log_buffer_->size(), this->log_buffer_->get_dropped_count());
   }
 #endif
+#ifdef USE_LOGGER_PERSISTENT_LOG
+  ESP_LOGCONFIG(TAG,
+                "  Persistent Log Size: %u\n"
+                "  Previous Boot Log: %u bytes",
+                PersistentLogBuffer::size(), this->persistent_log_.get_previous_log_size());
+#endif
+#ifdef USE_LOGGER_ASYNC_TX
+  ESP_LOGCONFIG(TAG,
+                "  Async TX: YES\n"
+                "  TX Bytes Dropped: %" PRIu32,
+                this->get_tx_dropped_bytes());
+#endif
 
   for (auto &it : this->log_levels_) {
     ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.first.c_str(), LOG_LEVELS[it.second]);
@@ -15,6 +15,10 @@
 #include "task_log_buffer.h"
 #endif
 
+#ifdef USE_LOGGER_PERSISTENT_LOG
+#include "persistent_log_buffer.h"
+#endif
+
 #ifdef USE_ARDUINO
 #if defined(USE_ESP8266) || defined(USE_ESP32)
 #include <HardwareSerial.h>
@@ -29,6 +33,10 @@
 #include <driver/uart.h>
 #endif  // USE_ESP_IDF
 
+#ifdef USE_LOGGER_ASYNC_TX
+#include <atomic>
+#endif
+
 #ifdef USE_ZEPHYR
 #include <zephyr/kernel.h>
 struct device;
@@ -111,6 +119,13 @@ class Logger : public Component {
   explicit Logger(uint32_t baud_rate, size_t tx_buffer_size);
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
   void init_log_buffer(size_t total_buffer_size);
+  /// Number of messages from other tasks dropped because the task log buffer was full, since boot
+  uint32_t get_task_log_dropped_count() const { return this->log_buffer_->get_dropped_count(); }
+#endif
+#ifdef USE_LOGGER_PERSISTENT_LOG
+  /// Recover the previous boot's log ring and mirror messages up to level into it from now on
+  void init_persistent_log(uint8_t level);
+  const PersistentLogBuffer &get_persistent_log() const { return this->persistent_log_; }
 #endif
 #if defined(USE_LOGGER_USB_CDC) || defined(USE_ESP32) || defined(USE_ZEPHYR)
   void loop() override;
@@ -124,6 +139,10 @@ class Logger : public Component {
 #ifdef USE_ESP_IDF
   uart_port_t get_uart_num() const { return uart_num_; }
 #endif
+#ifdef USE_LOGGER_ASYNC_TX
+  /// Bytes of log output dropped because the UART TX buffer was full, since boot
+  uint32_t get_tx_dropped_bytes() const { return this->tx_dropped_bytes_.load(std::memory_order_relaxed); }
+#endif
 #ifdef USE_ESP32
   void create_pthread_key() { pthread_key_create(&log_recursion_key_, nullptr); }
 #endif
@@ -148,7 +167,28 @@ class Logger : public Component {
   inline uint8_t level_for(const char *tag);
 
   /// Register a callback that will be called for every log message sent
-  void add_on_log_callback(std::function<void(uint8_t, const char *, const char *, size_t)> &&callback);
+  /// @param level The highest level the callback uses, no message above it is formatted on its behalf
+  void add_on_log_callback(std::function<void(uint8_t, const char *, const char *, size_t)> &&callback,
+                           uint8_t level = ESPHOME_LOG_LEVEL_VERY_VERBOSE);
+  /// Report the highest level a sink with a runtime level (like API log subscriptions) currently wants,
+  /// ESPHOME_LOG_LEVEL_NONE for nothing. `sink` identifies the caller.
+  void set_log_sink_level(const void *sink, uint8_t level);
+#ifdef USE_LOGGER_RAW_LOGS
+  /// Register a formatted log callback that only needs messages while request_formatted_logs() is held.
+  /// Once raw callbacks received a message and nobody requests it formatted, printf is skipped entirely.
+  void add_on_requested_log_callback(std::function<void(uint8_t, const char *, const char *, size_t)> &&callback) {
+    this->log_callback_.add(std::move(callback));
+  }
+  void request_formatted_logs() { this->formatted_log_requests_++; }
+  void release_formatted_logs() { this->formatted_log_requests_--; }
+  /// Register a callback receiving the format string and arguments of messages logged from the main loop,
+  /// before they are formatted. The callback must va_copy the arguments before reading them.
+  void add_on_raw_log_callback(std::function<void(uint8_t, const char *, int, const char *, va_list)> &&callback) {
+    this->raw_log_callback_.add(std::move(callback));
+  }
+  /// True while the formatted callbacks run for a message the raw callbacks already received
+  bool is_raw_log_sent() const { return this->raw_log_sent_; }
+#endif
 
   // add a listener for log level changes
   void add_listener(std::function<void(uint8_t)> &&callback) { this->level_callback_.add(std::move(callback)); }
@@ -164,6 +204,11 @@ class Logger : public Component {
  protected:
   void process_messages_();
   void write_msg_(const char *msg);
+#ifdef USE_LOGGER_ASYNC_TX
+  // Check that len bytes fit the UART TX buffer without blocking, counting them as dropped otherwise
+  bool reserve_uart_tx_(size_t len);
+#endif
+  void update_effective_level_();
 
   // Format a log message with printf-style arguments and write it to a buffer with header, footer, and null terminator
   // It's the caller's responsibility to initialize buffer_at (typically to 0)
@@ -190,6 +235,15 @@ class Logger : public Component {
   // Helper to format and send a log message to both console and callbacks
   inline void HOT log_message_to_buffer_and_send_(uint8_t level, const char *tag, int line, const char *format,
                                                   va_list args) {
+#ifdef USE_LOGGER_RAW_LOGS
+    if (this->raw_log_callback_.size() > 0) {
+      this->raw_log_callback_.call(level, tag, line, format, args);
+      // Nobody needs the formatted message, skip printf
+      if (this->baud_rate_ == 0 && this->formatted_log_requests_ == 0)
+        return;
+      this->raw_log_sent_ = true;
+    }
+#endif
     // Format to tx_buffer and prepare for output
     this->tx_buffer_at_ = 0;  // Initialize buffer position
     this->format_log_to_buffer_with_terminator_(level, tag, line, format, args, this->tx_buffer_, &this->tx_buffer_at_,
@@ -199,6 +253,9 @@ class Logger : public Component {
       this->write_msg_(this->tx_buffer_);  // If logging is enabled, write to console
     }
     this->log_callback_.call(level, tag, this->tx_buffer_, this->tx_buffer_at_);
+#ifdef USE_LOGGER_RAW_LOGS
+    this->raw_log_sent_ = false;
+#endif
   }
 
   // Write the body of the log message to the buffer
@@ -252,19 +309,40 @@ class Logger : public Component {
 #ifdef USE_ESP_IDF
   uart_port_t uart_num_;  // 4 bytes (enum defaults to int size)
 #endif
+#ifdef USE_LOGGER_ASYNC_TX
+  std::atomic<uint32_t> tx_dropped_bytes_{0};     // Written from any task logging to the console
+  std::atomic<uint32_t> tx_dropped_reported_{0};  // Drop count already announced on the console
+#endif
 
   // Large objects (internally aligned)
   std::map<std::string, uint8_t> log_levels_{};
   CallbackManager<void(uint8_t, const char *, const char *, size_t)> log_callback_{};
   CallbackManager<void(uint8_t)> level_callback_{};
+  // Runtime levels reported through set_log_sink_level()
+  std::vector<std::pair<const void *, uint8_t>> sink_levels_{};
+#ifdef USE_LOGGER_RAW_LOGS
+  CallbackManager<void(uint8_t, const char *, int, const char *, va_list)> raw_log_callback_{};
+  // Formatted log callbacks that always need messages, plus held request_formatted_logs()
+  uint16_t formatted_log_requests_{0};
+  bool raw_log_sent_{false};
+#endif
+#ifdef USE_LOGGER_PERSISTENT_LOG
+  PersistentLogBuffer persistent_log_;
+#endif
 #ifdef USE_ESPHOME_TASK_LOG_BUFFER
   std::unique_ptr<logger::TaskLogBuffer> log_buffer_;  // Will be initialized with init_log_buffer
+  uint32_t task_log_dropped_reported_{0};              // Drop count already reported in the log
 #endif
 
   // Group smaller types together at the end
   uint16_t tx_buffer_at_{0};
   uint16_t tx_buffer_size_{0};
   uint8_t current_level_{ESPHOME_LOG_LEVEL_VERY_VERBOSE};
+  // Highest level of the callbacks registered with add_on_log_callback()
+  uint8_t callback_level_{ESPHOME_LOG_LEVEL_NONE};
+  // Highest level any output (UART, callbacks, runtime sinks) wants,
+  // checked before anything else so unwanted messages are never formatted
+  uint8_t effective_level_{ESPHOME_LOG_LEVEL_NONE};
 #if defined(USE_ESP32) || defined(USE_ESP8266) || defined(USE_RP2040) || defined(USE_ZEPHYR)
   UARTSelection uart_{UART_SELECTION_UART0};
 #endif
@@ -400,11 +478,13 @@ class LoggerMessageTrigger : public Trigger<uint8_t, const char *, const char *>
  public:
   explicit LoggerMessageTrigger(Logger *parent, uint8_t level) {
     this->level_ = level;
-    parent->add_on_log_callback([this](uint8_t level, const char *tag, const char *message, size_t message_len) {
-      if (level <= this->level_) {
-        this->trigger(level, tag, message);
-      }
-    });
+    parent->add_on_log_callback(
+        [this](uint8_t level, const char *tag, const char *message, size_t message_len) {
+          if (level <= this->level_) {
+            this->trigger(level, tag, message);
+          }
+        },
+        level);
   }
 
  protected:
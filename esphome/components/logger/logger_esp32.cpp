@@ -22,6 +22,7 @@
 #include "freertos/FreeRTOS.h"
 
 #include <fcntl.h>
+#include <cinttypes>
 #include <cstdint>
 #include <cstdio>
 
@@ -186,10 +187,49 @@ void HOT Logger::write_msg_(const char *msg) {
   } else {
     // Use tx_buffer_at_ if msg points to tx_buffer_, otherwise fall back to strlen
     size_t len = (msg == this->tx_buffer_) ? this->tx_buffer_at_ : strlen(msg);
+#ifdef USE_LOGGER_ASYNC_TX
+    if (!this->reserve_uart_tx_(len + 1))
+      return;
+#endif
     uart_write_bytes(this->uart_num_, msg, len);
     uart_write_bytes(this->uart_num_, "\n", 1);
   }
 }
+
+#ifdef USE_LOGGER_ASYNC_TX
+bool HOT Logger::reserve_uart_tx_(size_t len) {
+  // The driver's TX ring buffer (tx_buffer_size) is drained by the UART interrupt, so writes that
+  // fit into it return immediately. uart_write_bytes() only blocks once the ring is full.
+#if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 1, 0)
+  // No way to query the free space on older drivers, fall back to blocking writes
+  return true;
+#else
+  size_t free_size = 0;
+  if (uart_get_tx_buffer_free_size(this->uart_num_, &free_size) != ESP_OK)
+    return true;
+
+  uint32_t dropped = this->tx_dropped_bytes_.load(std::memory_order_relaxed);
+  uint32_t reported = this->tx_dropped_reported_.load(std::memory_order_relaxed);
+  if (dropped != reported) {
+    // Mark the gap in the console output as soon as there is room for the marker and the line
+    char marker[48];
+    int marker_len = snprintf(marker, sizeof(marker), "[%" PRIu32 " log bytes dropped]\n", dropped - reported);
+    // Only the task that moves the reported count forward writes the marker, so a gap is announced once
+    if (marker_len > 0 && free_size >= static_cast<size_t>(marker_len) + len &&
+        this->tx_dropped_reported_.compare_exchange_strong(reported, dropped, std::memory_order_relaxed)) {
+      uart_write_bytes(this->uart_num_, marker, marker_len);
+      free_size -= marker_len;
+    }
+  }
+
+  if (free_size < len) {
+    this->tx_dropped_bytes_.fetch_add(len, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+#endif
+}
+#endif  // USE_LOGGER_ASYNC_TX
 #else
 void HOT Logger::write_msg_(const char *msg) { this->hw_serial_->println(msg); }
 #endif
@@ -0,0 +1,102 @@
+#include "persistent_log_buffer.h"
+
+#ifdef USE_LOGGER_PERSISTENT_LOG
+
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <cstring>
+
+namespace esphome {
+namespace logger {
+
+// Changes whenever the layout of PersistentLogRing changes
+static const uint32_t PERSISTENT_LOG_MAGIC = 0x4C4F4731;  // "LOG1"
+
+struct PersistentLogRing {
+  uint32_t magic;
+  uint32_t head;  // Next write offset into data
+  uint32_t wrapped;
+  char data[ESPHOME_LOGGER_PERSISTENT_LOG_SIZE];
+};
+
+#ifdef USE_LOGGER_PERSISTENT_LOG_PSRAM
+static EXT_RAM_NOINIT_ATTR PersistentLogRing persistent_log_ring;  // NOLINT
+#else
+static RTC_NOINIT_ATTR PersistentLogRing persistent_log_ring;  // NOLINT
+#endif
+
+void PersistentLogBuffer::init() {
+  PersistentLogRing &ring = persistent_log_ring;
+  // After power loss the memory holds garbage, only trust it across resets that keep it powered
+  bool valid = ring.magic == PERSISTENT_LOG_MAGIC && ring.head < sizeof(ring.data) &&
+               (ring.wrapped != 0 || ring.head > 0) && esp_reset_reason() != ESP_RST_POWERON;
+  if (valid) {
+    const char *start = ring.data;
+    size_t first_len = ring.head;
+    const char *second = nullptr;
+    size_t second_len = 0;
+    if (ring.wrapped != 0) {
+      // Oldest data starts at head, skip the line that was partly overwritten
+      start = ring.data + ring.head;
+      first_len = sizeof(ring.data) - ring.head;
+      second = ring.data;
+      second_len = ring.head;
+      const char *newline = static_cast<const char *>(memchr(start, '\n', first_len));
+      if (newline != nullptr) {
+        first_len -= newline + 1 - start;
+        start = newline + 1;
+      } else {
+        newline = static_cast<const char *>(memchr(second, '\n', second_len));
+        first_len = 0;
+        if (newline != nullptr) {
+          second_len -= newline + 1 - second;
+          second = newline + 1;
+        } else {
+          second_len = 0;
+        }
+      }
+    }
+    this->previous_log_size_ = first_len + second_len;
+    if (this->previous_log_size_ > 0) {
+      this->previous_log_ = std::unique_ptr<char[]>(new char[this->previous_log_size_ + 1]);  // NOLINT
+      memcpy(this->previous_log_.get(), start, first_len);
+      if (second_len > 0)
+        memcpy(this->previous_log_.get() + first_len, second, second_len);
+      this->previous_log_[this->previous_log_size_] = '\0';
+    }
+  }
+
+  ring.head = 0;
+  ring.wrapped = 0;
+  ring.magic = PERSISTENT_LOG_MAGIC;
+}
+
+void PersistentLogBuffer::append(const char *msg, size_t len) {
+  // Keep the newest part of lines longer than the whole ring
+  if (len >= sizeof(persistent_log_ring.data)) {
+    msg += len - (sizeof(persistent_log_ring.data) - 1);
+    len = sizeof(persistent_log_ring.data) - 1;
+  }
+  this->write_(msg, len);
+  this->write_("\n", 1);
+}
+
+void PersistentLogBuffer::write_(const char *data, size_t len) {
+  PersistentLogRing &ring = persistent_log_ring;
+  size_t head = ring.head;
+  size_t first = sizeof(ring.data) - head;
+  if (len < first) {
+    memcpy(ring.data + head, data, len);
+    ring.head = head + len;
+    return;
+  }
+  memcpy(ring.data + head, data, first);
+  memcpy(ring.data, data + first, len - first);
+  ring.head = len - first;
+  ring.wrapped = 1;
+}
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_PERSISTENT_LOG
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_LOGGER_PERSISTENT_LOG
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace logger {
+
+/** Ring of formatted log lines in memory that is not cleared on a soft reset.
+ *
+ * The ring lives in RTC slow memory (or PSRAM) declared no-init, so after a watchdog, panic or
+ * software reset the lines written right before the reset are still there. On boot init() copies
+ * them out for get_previous_log() and starts a new ring. Appending is two memcpy's at most.
+ *
+ * Only the main loop appends, through a logger callback, so no locking is needed.
+ */
+class PersistentLogBuffer {
+ public:
+  /// Take over the lines of the previous boot if the ring survived, then start recording this boot.
+  void init();
+
+  /// Append a formatted log line, a newline is added after it.
+  void append(const char *msg, size_t len);
+
+  /// Lines recorded during the previous boot, null-terminated and separated by '\n', nullptr if none.
+  const char *get_previous_log() const { return this->previous_log_.get(); }
+  size_t get_previous_log_size() const { return this->previous_log_size_; }
+
+  static constexpr size_t size() { return ESPHOME_LOGGER_PERSISTENT_LOG_SIZE; }
+
+ protected:
+  void write_(const char *data, size_t len);
+
+  std::unique_ptr<char[]> previous_log_;
+  size_t previous_log_size_{0};
+};
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_PERSISTENT_LOG
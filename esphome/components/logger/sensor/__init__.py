@@ -0,0 +1,83 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_ID,
+    CONF_LOGGER,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_COUNTER,
+    STATE_CLASS_TOTAL_INCREASING,
+    UNIT_BYTES,
+)
+import esphome.final_validate as fv
+
+from .. import (
+    CONF_ASYNC_TX,
+    CONF_LOGGER_ID,
+    CONF_TASK_LOG_BUFFER_SIZE,
+    Logger,
+    logger_ns,
+)
+
+DEPENDENCIES = ["logger"]
+
+CONF_DROPPED_MESSAGES = "dropped_messages"
+CONF_DROPPED_TX_BYTES = "dropped_tx_bytes"
+
+LoggerSensor = logger_ns.class_("LoggerSensor", cg.PollingComponent)
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(LoggerSensor),
+            cv.GenerateID(CONF_LOGGER_ID): cv.use_id(Logger),
+            cv.Optional(CONF_DROPPED_MESSAGES): sensor.sensor_schema(
+                icon=ICON_COUNTER,
+                accuracy_decimals=0,
+                state_class=STATE_CLASS_TOTAL_INCREASING,
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+            cv.Optional(CONF_DROPPED_TX_BYTES): sensor.sensor_schema(
+                unit_of_measurement=UNIT_BYTES,
+                icon=ICON_COUNTER,
+                accuracy_decimals=0,
+                state_class=STATE_CLASS_TOTAL_INCREASING,
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+        }
+    ).extend(cv.polling_component_schema("60s")),
+    cv.only_on_esp32,
+)
+
+
+def _final_validate(config):
+    logger_config = fv.full_config.get()[CONF_LOGGER]
+    if CONF_DROPPED_MESSAGES in config and not logger_config.get(
+        CONF_TASK_LOG_BUFFER_SIZE, 0
+    ):
+        raise cv.Invalid(
+            f"'{CONF_DROPPED_MESSAGES}' needs the task log buffer, set a non-zero "
+            f"'{CONF_TASK_LOG_BUFFER_SIZE}' for the logger"
+        )
+    if CONF_DROPPED_TX_BYTES in config and not logger_config.get(CONF_ASYNC_TX, False):
+        raise cv.Invalid(
+            f"'{CONF_DROPPED_TX_BYTES}' needs '{CONF_ASYNC_TX}: true' for the logger"
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
+async def to_code(config):
+    parent = await cg.get_variable(config[CONF_LOGGER_ID])
+    var = cg.new_Pvariable(config[CONF_ID], parent)
+    await cg.register_component(var, config)
+
+    if dropped_config := config.get(CONF_DROPPED_MESSAGES):
+        sens = await sensor.new_sensor(dropped_config)
+        cg.add(var.set_dropped_messages_sensor(sens))
+
+    if dropped_tx_config := config.get(CONF_DROPPED_TX_BYTES):
+        sens = await sensor.new_sensor(dropped_tx_config)
+        cg.add(var.set_dropped_tx_bytes_sensor(sens))
@@ -0,0 +1,34 @@
+#include "logger_sensor.h"
+
+#if defined(USE_ESPHOME_TASK_LOG_BUFFER) || defined(USE_LOGGER_ASYNC_TX)
+
+namespace esphome {
+namespace logger {
+
+static const char *const TAG = "logger.sensor";
+
+void LoggerSensor::update() {
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+  if (this->dropped_messages_sensor_ != nullptr)
+    this->dropped_messages_sensor_->publish_state(this->parent_->get_task_log_dropped_count());
+#endif
+#ifdef USE_LOGGER_ASYNC_TX
+  if (this->dropped_tx_bytes_sensor_ != nullptr)
+    this->dropped_tx_bytes_sensor_->publish_state(this->parent_->get_tx_dropped_bytes());
+#endif
+}
+
+void LoggerSensor::dump_config() {
+  ESP_LOGCONFIG(TAG, "Logger Sensor:");
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+  LOG_SENSOR("  ", "Dropped Messages", this->dropped_messages_sensor_);
+#endif
+#ifdef USE_LOGGER_ASYNC_TX
+  LOG_SENSOR("  ", "Dropped TX Bytes", this->dropped_tx_bytes_sensor_);
+#endif
+}
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_ESPHOME_TASK_LOG_BUFFER || USE_LOGGER_ASYNC_TX
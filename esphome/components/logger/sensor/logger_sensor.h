@@ -0,0 +1,40 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#if defined(USE_ESPHOME_TASK_LOG_BUFFER) || defined(USE_LOGGER_ASYNC_TX)
+
+#include "esphome/components/logger/logger.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace logger {
+
+class LoggerSensor : public PollingComponent {
+ public:
+  explicit LoggerSensor(Logger *parent) : parent_(parent) {}
+
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+  void set_dropped_messages_sensor(sensor::Sensor *sensor) { this->dropped_messages_sensor_ = sensor; }
+#endif
+#ifdef USE_LOGGER_ASYNC_TX
+  void set_dropped_tx_bytes_sensor(sensor::Sensor *sensor) { this->dropped_tx_bytes_sensor_ = sensor; }
+#endif
+
+  void update() override;
+  void dump_config() override;
+
+ protected:
+  Logger *parent_;
+#ifdef USE_ESPHOME_TASK_LOG_BUFFER
+  sensor::Sensor *dropped_messages_sensor_{nullptr};
+#endif
+#ifdef USE_LOGGER_ASYNC_TX
+  sensor::Sensor *dropped_tx_bytes_sensor_{nullptr};
+#endif
+};
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_ESPHOME_TASK_LOG_BUFFER || USE_LOGGER_ASYNC_TX
@@ -55,8 +55,8 @@ void TaskLogBuffer::release_message_main_loop(void *token) {
     return;
   }
   vRingbufferReturnItem(ring_buffer_, token);
-  // Update counter to mark all messages as processed
-  last_processed_counter_ = message_counter_.load(std::memory_order_relaxed);
+  // Count this message only, the main loop may stop draining before the buffer is empty
+  last_processed_counter_++;
 }
 
 bool TaskLogBuffer::send_message_thread_safe(uint8_t level, const char *tag, uint16_t line, TaskHandle_t task_handle,
@@ -83,6 +83,7 @@ bool TaskLogBuffer::send_message_thread_safe(uint8_t level, const char *tag, uin
   BaseType_t result = xRingbufferSendAcquire(ring_buffer_, &acquired_memory, total_size, 0);
 
   if (result != pdTRUE || acquired_memory == nullptr) {
+    dropped_counter_.fetch_add(1, std::memory_order_relaxed);
     return false;  // Failed to acquire memory
   }
 
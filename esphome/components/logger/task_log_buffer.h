@@ -52,6 +52,9 @@ class TaskLogBuffer {
   // Get the total buffer size in bytes
   inline size_t size() const { return size_; }
 
+  // Number of messages dropped because the ring buffer was full, since boot
+  inline uint32_t get_dropped_count() const { return dropped_counter_.load(std::memory_order_relaxed); }
+
  private:
   RingbufHandle_t ring_buffer_{nullptr};  // FreeRTOS ring buffer handle
   StaticRingbuffer_t structure_;          // Static structure for the ring buffer
@@ -60,7 +63,8 @@ class TaskLogBuffer {
 
   // Atomic counter for message tracking (only differences matter)
   std::atomic<uint16_t> message_counter_{0};    // Incremented when messages are committed
-  mutable uint16_t last_processed_counter_{0};  // Tracks last processed message
+  mutable uint16_t last_processed_counter_{0};  // Incremented when messages are released
+  std::atomic<uint32_t> dropped_counter_{0};    // Messages that did not fit into the ring buffer
 };
 
 }  // namespace logger
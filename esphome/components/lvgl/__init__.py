@@ -189,6 +189,7 @@ def multi_conf_validate(configs: list[dict]):
             df.CONF_COLOR_DEPTH,
             df.CONF_BYTE_ORDER,
             df.CONF_TRANSPARENCY_KEY,
+            df.CONF_COALESCE_UPDATES,
         ):
             if base_config[item] != config[item]:
                 raise cv.Invalid(
@@ -219,6 +220,8 @@ def final_validation(configs):
                 config[CONF_DRAW_ROUNDING] = max(
                     draw_rounding, config[CONF_DRAW_ROUNDING]
                 )
+        if config[df.CONF_FLUSH_TASK] and not CORE.is_esp32:
+            raise cv.Invalid("flush_task is only available on ESP32")
         buffer_frac = config[CONF_BUFFER_SIZE]
         if CORE.is_esp32 and buffer_frac > 0.5 and "psram" not in global_config:
             LOGGER.warning("buffer_size: may need to be reduced without PSRAM")
@@ -335,6 +338,8 @@ async def to_code(configs):
             config[df.CONF_RESUME_ON_INPUT],
         )
         await cg.register_component(lv_component, config)
+        if config[df.CONF_FLUSH_TASK]:
+            cg.add(lv_component.set_flush_task(True))
         Widget.create(config[CONF_ID], lv_component, LvScrActType(), config)
 
         lv_scr_act = get_scr_act(lv_component)
@@ -421,6 +426,8 @@ LVGL_SCHEMA = cv.All(
                     df.CONF_DEFAULT_FONT, default="montserrat_14"
                 ): lvalid.lv_font,
                 cv.Optional(df.CONF_FULL_REFRESH, default=False): cv.boolean,
+                cv.Optional(df.CONF_FLUSH_TASK, default=False): cv.boolean,
+                cv.Optional(df.CONF_COALESCE_UPDATES, default=False): cv.boolean,
                 cv.Optional(CONF_DRAW_ROUNDING, default=2): cv.positive_int,
                 cv.Optional(CONF_BUFFER_SIZE, default=0): cv.percentage,
                 cv.Optional(df.CONF_LOG_LEVEL, default="WARN"): cv.one_of(
@@ -5,11 +5,12 @@ from esphome import automation
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.const import CONF_ACTION, CONF_GROUP, CONF_ID, CONF_TIMEOUT
-from esphome.core import Lambda
+from esphome.core import CORE, Lambda
 from esphome.cpp_generator import TemplateArguments, get_variable
 from esphome.cpp_types import nullptr
 
 from .defines import (
+    CONF_COALESCE_UPDATES,
     CONF_DISP_BG_COLOR,
     CONF_DISP_BG_IMAGE,
     CONF_DISP_BG_OPA,
@@ -89,6 +90,12 @@ async def action_to_code(
     return var
 
 
+def set_coalesce(var):
+    # The setting is the same for all LVGL instances, they share one update queue
+    if CORE.config["lvgl"][0][CONF_COALESCE_UPDATES]:
+        cg.add(var.set_coalesce(True))
+
+
 async def update_to_code(config, action_id, template_arg, args):
     async def do_update(widget: Widget):
         await set_obj_properties(widget, config)
@@ -100,9 +107,11 @@ async def update_to_code(config, action_id, template_arg, args):
             lv.event_send(widget.obj, UPDATE_EVENT, nullptr)
 
     widgets = await get_widgets(config[CONF_ID])
-    return await action_to_code(
+    var = await action_to_code(
         widgets, do_update, action_id, template_arg, args, config
     )
+    set_coalesce(var)
+    return var
 
 
 @automation.register_condition(
@@ -366,9 +375,11 @@ async def obj_update_to_code(config, action_id, template_arg, args):
         await set_obj_properties(widget, config)
 
     widgets = await get_widgets(config[CONF_ID])
-    return await action_to_code(
+    var = await action_to_code(
         widgets, do_update, action_id, template_arg, args, config
     )
+    set_coalesce(var)
+    return var
 
 
 def validate_refresh_config(config):
@@ -418,6 +418,7 @@ CONF_BUTTONS = "buttons"
 CONF_BYTE_ORDER = "byte_order"
 CONF_CHANGE_RATE = "change_rate"
 CONF_CLOSE_BUTTON = "close_button"
+CONF_COALESCE_UPDATES = "coalesce_updates"
 CONF_COLOR_DEPTH = "color_depth"
 CONF_CONTROL = "control"
 CONF_DEFAULT_FONT = "default_font"
@@ -436,6 +437,7 @@ CONF_FLEX_ALIGN_MAIN = "flex_align_main"
 CONF_FLEX_ALIGN_CROSS = "flex_align_cross"
 CONF_FLEX_ALIGN_TRACK = "flex_align_track"
 CONF_FLEX_GROW = "flex_grow"
+CONF_FLUSH_TASK = "flush_task"
 CONF_FREEZE = "freeze"
 CONF_FULL_REFRESH = "full_refresh"
 CONF_GRADIENTS = "gradients"
@@ -5,6 +5,7 @@
 #include "lvgl_hal.h"
 #include "lvgl_esphome.h"
 
+#include <cinttypes>
 #include <numeric>
 
 namespace esphome {
@@ -13,6 +14,11 @@ static const char *const TAG = "lvgl";
 
 static const size_t MIN_BUFFER_FRAC = 8;
 
+// Coalesced widget updates waiting for the next refresh, shared by all displays like the LVGL timers are
+static std::vector<LvDeferredUpdate *> deferred_updates;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void LvDeferredUpdate::defer_update_() { deferred_updates.push_back(this); }
+
 static const char *const EVENT_NAMES[] = {
     "NONE",
     "PRESSED",
@@ -93,6 +99,9 @@ void LvglComponent::dump_config() {
                 "  Draw rounding: %d",
                 this->disp_drv_.hor_res, this->disp_drv_.ver_res, 100 / this->buffer_frac_, this->rotation,
                 (int) this->draw_rounding);
+#ifdef USE_ESP32
+  ESP_LOGCONFIG(TAG, "  Flush task: %s", YESNO(this->flush_task_ != nullptr));
+#endif  // USE_ESP32
 }
 void LvglComponent::set_paused(bool paused, bool show_snow) {
   this->paused_ = paused;
@@ -207,6 +216,15 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
 
 void LvglComponent::flush_cb_(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
   if (!this->paused_) {
+#ifdef USE_ESP32
+    if (this->flush_task_ != nullptr) {
+      // LVGL renders into the other buffer meanwhile, and only waits if that is full before this one is flushed
+      this->flush_area_ = *area;
+      this->flush_pixels_ = color_p;
+      xTaskNotifyGive(this->flush_task_);
+      return;
+    }
+#endif  // USE_ESP32
     auto now = millis();
     this->draw_buffer_(area, color_p);
     ESP_LOGVV(TAG, "flush_cb, area=%d/%d, %d/%d took %dms", area->x1, area->y1, lv_area_get_width(area),
@@ -214,6 +232,41 @@ void LvglComponent::flush_cb_(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv
   }
   lv_disp_flush_ready(disp_drv);
 }
+
+#ifdef USE_ESP32
+void *LvglComponent::start_flush_task_(size_t buf_bytes) {
+  void *buffer = lv_custom_mem_alloc(buf_bytes);  // NOLINT
+  if (buffer == nullptr) {
+    ESP_LOGW(TAG, "Could not allocate the second draw buffer, flushing in the main loop");
+    return nullptr;
+  }
+  // On the other core where there is one, otherwise below the loop task so it only uses time the loop leaves idle
+  xTaskCreatePinnedToCore(flush_task, "lvgl_flush", 4096, this, portNUM_PROCESSORS > 1 ? 1 : tskIDLE_PRIORITY,
+                          &this->flush_task_, portNUM_PROCESSORS > 1 ? 0 : tskNO_AFFINITY);
+  if (this->flush_task_ == nullptr) {
+    ESP_LOGW(TAG, "Could not start the flush task, flushing in the main loop");
+    lv_custom_mem_free(buffer);
+    return nullptr;
+  }
+  // LVGL spins while both buffers wait to be flushed, let the task run instead
+  this->disp_drv_.wait_cb = [](lv_disp_drv_t *disp_drv) { delay(1); };
+  return buffer;
+}
+
+void LvglComponent::flush_task(void *arg) {
+  auto *component = static_cast<LvglComponent *>(arg);
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    auto now = millis();
+    component->draw_buffer_(&component->flush_area_, component->flush_pixels_);
+    ESP_LOGVV(TAG, "flush task, area=%d/%d, %d/%d took %dms", component->flush_area_.x1, component->flush_area_.y1,
+              lv_area_get_width(&component->flush_area_), lv_area_get_height(&component->flush_area_),
+              (int) (millis() - now));
+    lv_disp_flush_ready(&component->disp_drv_);
+  }
+}
+#endif  // USE_ESP32
+
 IdleTrigger::IdleTrigger(LvglComponent *parent, TemplatableValue<uint32_t> timeout) : timeout_(std::move(timeout)) {
   parent->add_on_idle_callback([this](uint32_t idle_time) {
     if (!this->is_idle_ && idle_time > this->timeout_.value()) {
@@ -257,6 +310,9 @@ void LVTouchListener::update(const touchscreen::TouchPoints_t &tpoints) {
   this->touch_pressed_ = !this->parent_->is_paused() && !tpoints.empty();
   if (this->touch_pressed_)
     this->touch_point_ = tpoints[0];
+  // Only the latest point is kept, have LVGL read it on its next timer run instead of after the read period
+  if (this->drv_.read_timer != nullptr)
+    lv_timer_ready(this->drv_.read_timer);
 }
 #endif  // USE_LVGL_TOUCHSCREEN
 
@@ -369,6 +425,9 @@ void LvKeyboardType::set_obj(lv_obj_t *lv_obj) {
 #endif  // USE_LVGL_KEYBOARD
 
 void LvglComponent::write_random_() {
+  // A last flush may still be using the rotation buffer
+  if (this->draw_buf_.flushing)
+    return;
   int iterations = 6 - lv_disp_get_inactive_time(this->disp_) / 60000;
   if (iterations <= 0)
     iterations = 1;
@@ -430,6 +489,11 @@ LvglComponent::LvglComponent(std::vector<display::Display *> displays, float buf
   this->disp_drv_.full_refresh = this->full_refresh_;
   this->disp_drv_.flush_cb = static_flush_cb;
   this->disp_drv_.rounder_cb = rounder_cb;
+#if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
+  this->disp_drv_.monitor_cb = [](lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px) {
+    ESP_LOGV(TAG, "Refreshed %" PRIu32 " px in %" PRIu32 " ms", px, time);
+  };
+#endif
   this->disp_ = lv_disp_drv_register(&this->disp_drv_);
 }
 
@@ -443,16 +507,16 @@ void LvglComponent::setup() {
     frac = 1;
   size_t buffer_pixels = width * height / frac;
   auto buf_bytes = buffer_pixels * LV_COLOR_DEPTH / 8;
-  void *buffer = nullptr;
-  if (this->buffer_frac_ >= MIN_BUFFER_FRAC / 2)
-    buffer = malloc(buf_bytes);  // NOLINT
-  if (buffer == nullptr)
-    buffer = lv_custom_mem_alloc(buf_bytes);  // NOLINT
+  // A small buffer is drawn into all the time, keep it in internal RAM if there is room
+  RAMAllocator<uint8_t> allocator(
+      this->buffer_frac_ >= MIN_BUFFER_FRAC / 2 ? RAMAllocator<uint8_t>::PREFER_INTERNAL : RAMAllocator<uint8_t>::NONE,
+      "lvgl draw buffer");
+  void *buffer = allocator.allocate(buf_bytes);
   // if specific buffer size not set and can't get 100%, try for a smaller one
   if (buffer == nullptr && this->buffer_frac_ == 0) {
     frac = MIN_BUFFER_FRAC;
     buffer_pixels /= MIN_BUFFER_FRAC;
-    buffer = lv_custom_mem_alloc(buf_bytes / MIN_BUFFER_FRAC);  // NOLINT
+    buffer = allocator.allocate(buf_bytes / MIN_BUFFER_FRAC);
   }
   if (buffer == nullptr) {
     this->status_set_error("Memory allocation failure");
@@ -460,7 +524,12 @@ void LvglComponent::setup() {
     return;
   }
   this->buffer_frac_ = frac;
-  lv_disp_draw_buf_init(&this->draw_buf_, buffer, nullptr, buffer_pixels);
+  void *buffer2 = nullptr;
+#ifdef USE_ESP32
+  if (this->use_flush_task_)
+    buffer2 = this->start_flush_task_(buffer_pixels * LV_COLOR_DEPTH / 8);
+#endif  // USE_ESP32
+  lv_disp_draw_buf_init(&this->draw_buf_, buffer, buffer2, buffer_pixels);
   this->disp_drv_.hor_res = width;
   this->disp_drv_.ver_res = height;
   // this->setup_driver_(display->get_width(), display->get_height());
@@ -504,6 +573,17 @@ void LvglComponent::loop() {
     if (this->show_snow_)
       this->write_random_();
   }
+  if (!deferred_updates.empty()) {
+    // Hold the updates back until the refresh timer is due, so each widget is changed once per frame
+    lv_timer_t *refr_timer = this->disp_->refr_timer;
+    if (refr_timer == nullptr || lv_tick_elaps(refr_timer->last_run) >= refr_timer->period) {
+      // Applying an update may play another action that defers again, that one waits for the next frame
+      const size_t count = deferred_updates.size();
+      for (size_t i = 0; i != count; i++)
+        deferred_updates[i]->apply_update();
+      deferred_updates.erase(deferred_updates.begin(), deferred_updates.begin() + count);
+    }
+  }
   lv_timer_handler_run_in_period(5);
 }
 
@@ -22,6 +22,9 @@
 #include "esphome/core/log.h"
 #include <lvgl.h>
 #include <map>
+#include <optional>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -36,6 +39,11 @@
 #include "esphome/components/key_provider/key_provider.h"
 #endif  // USE_LVGL_BUTTONMATRIX
 
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif  // USE_ESP32
+
 namespace esphome {
 namespace lvgl {
 
@@ -125,14 +133,46 @@ using set_value_lambda_t = std::function<void(float)>;
 using event_callback_t = void(_lv_event_t *);
 using text_lambda_t = std::function<const char *()>;
 
-template<typename... Ts> class ObjUpdateAction : public Action<Ts...> {
+// Something that changes widgets and can wait until the display is about to refresh
+class LvDeferredUpdate {
+ public:
+  virtual void apply_update() = 0;
+
+ protected:
+  /// Queues apply_update() to run once, before the next display refresh
+  void defer_update_();
+};
+
+template<typename... Ts> class ObjUpdateAction : public Action<Ts...>, public LvDeferredUpdate {
  public:
   explicit ObjUpdateAction(std::function<void(Ts...)> &&lamb) : lamb_(std::move(lamb)) {}
 
-  void play(Ts... x) override { this->lamb_(x...); }
+  /// Apply only the latest arguments, once per refresh, instead of changing the widgets on every play
+  void set_coalesce(bool coalesce) { this->coalesce_ = coalesce; }
+
+  void play(Ts... x) override {
+    if (!CAN_COALESCE || !this->coalesce_) {
+      this->lamb_(x...);
+      return;
+    }
+    if (!this->pending_.has_value())
+      this->defer_update_();
+    this->pending_.emplace(x...);
+  }
+
+  void apply_update() override {
+    auto args = std::move(*this->pending_);
+    this->pending_.reset();
+    std::apply(this->lamb_, args);
+  }
 
  protected:
+  /// Pointer arguments, like the lv_event_t * of event triggers, are gone by the next refresh and can't be replayed
+  static constexpr bool CAN_COALESCE = !(std::is_pointer_v<std::decay_t<Ts>> || ...);
+
   std::function<void(Ts...)> lamb_;
+  std::optional<std::tuple<std::decay_t<Ts>...>> pending_{};
+  bool coalesce_{false};
 };
 #ifdef USE_LVGL_FONT
 class FontEngine {
@@ -209,6 +249,10 @@ class LvglComponent : public PollingComponent {
       lv_group_focus_obj(mark);
     }
   }
+#ifdef USE_ESP32
+  // Flush to the displays from a separate task, while LVGL renders the next area into a second buffer.
+  void set_flush_task(bool flush_task) { this->use_flush_task_ = flush_task; }
+#endif  // USE_ESP32
   // rounding factor to align bounds of update area when drawing
   size_t draw_rounding{2};
 
@@ -218,6 +262,10 @@ class LvglComponent : public PollingComponent {
   void write_random_();
   void draw_buffer_(const lv_area_t *area, lv_color_t *ptr);
   void flush_cb_(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+#ifdef USE_ESP32
+  void *start_flush_task_(size_t buf_bytes);
+  static void flush_task(void *arg);
+#endif  // USE_ESP32
 
   std::vector<display::Display *> displays_{};
   size_t buffer_frac_{1};
@@ -237,6 +285,13 @@ class LvglComponent : public PollingComponent {
   CallbackManager<void(uint32_t)> idle_callbacks_{};
   CallbackManager<void(bool)> pause_callbacks_{};
   lv_color_t *rotate_buf_{};
+#ifdef USE_ESP32
+  bool use_flush_task_{};
+  TaskHandle_t flush_task_{nullptr};
+  // The task owns these, and the rotation buffer, while LVGL's draw buffer is flushing
+  lv_area_t flush_area_{};
+  lv_color_t *flush_pixels_{};
+#endif  // USE_ESP32
 };
 
 class IdleTrigger : public Trigger<> {
@@ -282,6 +337,8 @@ class LVTouchListener : public touchscreen::TouchListener, public Parented<LvglC
   void release() override {
     touch_pressed_ = false;
     this->parent_->maybe_wakeup();
+    if (this->drv_.read_timer != nullptr)
+      lv_timer_ready(this->drv_.read_timer);
   }
   lv_indev_drv_t *get_drv() { return &this->drv_; }
 
@@ -1,8 +1,9 @@
+from esphome import pins
 import esphome.codegen as cg
 from esphome.components import canbus, spi
 from esphome.components.canbus import CanbusComponent
 import esphome.config_validation as cv
-from esphome.const import CONF_ID, CONF_MODE
+from esphome.const import CONF_ID, CONF_INTERRUPT_PIN, CONF_MODE
 
 CODEOWNERS = ["@mvturnho", "@danielschramm"]
 DEPENDENCIES = ["spi"]
@@ -32,6 +33,7 @@ CONFIG_SCHEMA = canbus.CANBUS_SCHEMA.extend(
         cv.GenerateID(): cv.declare_id(mcp2515),
         cv.Optional(CONF_CLOCK, default="8MHZ"): cv.enum(CAN_CLOCK, upper=True),
         cv.Optional(CONF_MODE, default="NORMAL"): cv.enum(MCP_MODE, upper=True),
+        cv.Optional(CONF_INTERRUPT_PIN): pins.internal_gpio_input_pin_schema,
     }
 ).extend(spi.spi_device_schema(True))
 
@@ -46,5 +48,8 @@ async def to_code(config):
     if CONF_MODE in config:
         mode = MCP_MODE[config[CONF_MODE]]
         cg.add(var.set_mcp_mode(mode))
+    if interrupt_pin := config.get(CONF_INTERRUPT_PIN):
+        pin = await cg.gpio_pin_expression(interrupt_pin)
+        cg.add(var.set_interrupt_pin(pin))
 
     await spi.register_spi_device(var, config)
@@ -1,10 +1,38 @@
 #include "mcp2515.h"
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 
+#include <climits>
+#include <vector>
+
 namespace esphome {
 namespace mcp2515 {
 
 static const char *const TAG = "mcp2515";
+#ifdef USE_ESP32
+// the receive task also checks the chip this often, in case INT stays low for something it doesn't clear
+static const uint32_t RX_TASK_POLL_MS = 100;
+#endif
+
+// filters of each mask, RXB0 has RXF0-1 and RXB1 has RXF2-5
+static const uint8_t MASK_FILTERS[N_MASKS] = {2, 4};
+static const RXF MASK_FIRST_FILTER[N_MASKS] = {RXF0, RXF2};
+// the bits of an extended identifier below the standard one
+static const uint32_t EID_BITS = 0x3FFFF;
+
+namespace {
+// A filter in the layout of the chip's registers, where a standard identifier takes the upper 11 of the 29 bits
+struct ChipFilter {
+  uint32_t id;
+  uint32_t mask;
+  bool extended;
+};
+}  // namespace
+
+static uint32_t merge_mask(const ChipFilter &a, const ChipFilter &b) { return a.mask & b.mask & ~(a.id ^ b.id); }
+
+// Number of mask bits the filters lose if the given mask is used for them
+static int lost_bits(const ChipFilter &filter, uint32_t mask) { return __builtin_popcount(filter.mask & ~mask); }
 
 const struct MCP2515::TxBnRegs MCP2515::TXB[N_TXBUFFERS] = {{MCP_TXB0CTRL, MCP_TXB0SIDH, MCP_TXB0DATA},
                                                             {MCP_TXB1CTRL, MCP_TXB1SIDH, MCP_TXB1DATA},
@@ -20,17 +48,193 @@ bool MCP2515::setup_internal() {
     return false;
   if (this->set_bitrate_(this->bit_rate_, this->mcp_clock_) != canbus::ERROR_OK)
     return false;
+  if (this->set_filters_() != canbus::ERROR_OK)
+    return false;
   if (this->set_mode_(this->mcp_mode_) != canbus::ERROR_OK)
     return false;
   uint8_t err_flags = this->get_error_flags_();
   ESP_LOGD(TAG, "mcp2515 setup done, error_flags = %02X", err_flags);
+  if (this->interrupt_pin_ != nullptr) {
+    this->interrupt_pin_->setup();
+#ifdef USE_ESP32
+    if (!this->start_rx_task_())
+      return false;
+#endif
+  }
   return true;
 }
 
-canbus::Error MCP2515::reset_() {
+void MCP2515::dump_config() {
+  canbus::Canbus::dump_config();
+  LOG_PIN("  Interrupt Pin: ", this->interrupt_pin_);
+}
+
+canbus::Error MCP2515::set_filters_() {
+  std::vector<canbus::CanFilter> filters = this->get_rx_filters_();
+  if (filters.empty())
+    return canbus::ERROR_OK;
+
+  std::vector<ChipFilter> chip_filters;
+  chip_filters.reserve(filters.size());
+  for (const auto &filter : filters) {
+    if (filter.use_extended_id) {
+      chip_filters.push_back({filter.can_id & filter.can_id_mask, filter.can_id_mask, true});
+    } else {
+      chip_filters.push_back({(filter.can_id & filter.can_id_mask) << 18, filter.can_id_mask << 18, false});
+    }
+  }
+
+  // Combine the filters of the same format that lose the fewest mask bits until they fit the chip. A filter
+  // matches one format only, so with two formats there's always a pair left to combine.
+  while (chip_filters.size() > N_FILTERS) {
+    size_t best_a = 0, best_b = 0;
+    int best_cost = INT_MAX;
+    for (size_t a = 0; a < chip_filters.size(); a++) {
+      for (size_t b = a + 1; b < chip_filters.size(); b++) {
+        if (chip_filters[a].extended != chip_filters[b].extended)
+          continue;
+        const uint32_t mask = merge_mask(chip_filters[a], chip_filters[b]);
+        const int cost = lost_bits(chip_filters[a], mask) + lost_bits(chip_filters[b], mask);
+        if (cost < best_cost) {
+          best_cost = cost;
+          best_a = a;
+          best_b = b;
+        }
+      }
+    }
+    const uint32_t mask = merge_mask(chip_filters[best_a], chip_filters[best_b]);
+    chip_filters[best_a].id &= mask;
+    chip_filters[best_a].mask = mask;
+    chip_filters.erase(chip_filters.begin() + best_b);
+  }
+
+  // Each mask is shared by its filters. Pick the split of the filters between both masks losing the fewest bits.
+  const size_t count = chip_filters.size();
+  uint32_t masks[N_MASKS]{};
+  uint32_t best_split = 0;
+  int best_cost = INT_MAX;
+  for (uint32_t split = 0; split < (1u << count); split++) {
+    // bit n set: filter n uses mask 0
+    const size_t on_mask0 = __builtin_popcount(split);
+    if (on_mask0 > MASK_FILTERS[0] || count - on_mask0 > MASK_FILTERS[1])
+      continue;
+    uint32_t split_masks[N_MASKS] = {UINT32_MAX, UINT32_MAX};
+    for (size_t i = 0; i < count; i++) {
+      uint32_t &mask = split_masks[(split >> i) & 1 ? 0 : 1];
+      mask &= chip_filters[i].mask;
+      // For standard frames the chip compares the extended bits to the first two data bytes
+      if (!chip_filters[i].extended)
+        mask &= ~EID_BITS;
+    }
+    int cost = 0;
+    for (size_t i = 0; i < count; i++)
+      cost += lost_bits(chip_filters[i], split_masks[(split >> i) & 1 ? 0 : 1]);
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_split = split;
+      masks[0] = split_masks[0];
+      masks[1] = split_masks[1];
+    }
+  }
+
+  // Unused filters repeat one of their mask. A mask without filters repeats the other, it would accept all
+  // frames otherwise.
+  for (int m = 0; m < N_MASKS; m++) {
+    std::vector<const ChipFilter *> mask_filters;
+    for (size_t i = 0; i < count; i++) {
+      if (((best_split >> i) & 1) == (m == 0 ? 1u : 0u))
+        mask_filters.push_back(&chip_filters[i]);
+    }
+    uint32_t mask = masks[m];
+    if (mask_filters.empty()) {
+      mask = masks[1 - m];
+      for (size_t i = 0; i < count; i++) {
+        if (((best_split >> i) & 1) != (m == 0 ? 1u : 0u))
+          mask_filters.push_back(&chip_filters[i]);
+      }
+    }
+    canbus::Error res = this->set_filter_mask_(static_cast<MASK>(m), true, mask);
+    if (res != canbus::ERROR_OK)
+      return res;
+    for (size_t f = 0; f < MASK_FILTERS[m]; f++) {
+      const ChipFilter *filter = mask_filters[f < mask_filters.size() ? f : 0];
+      const RXF num = static_cast<RXF>(MASK_FIRST_FILTER[m] + f);
+      const uint32_t id = filter->id & mask;
+      res = filter->extended ? this->set_filter_(num, true, id) : this->set_filter_(num, false, id >> 18);
+      if (res != canbus::ERROR_OK)
+        return res;
+    }
+  }
+  ESP_LOGD(TAG, "Hardware filter set up for %zu triggers", filters.size());
+  return canbus::ERROR_OK;
+}
+
+#ifdef USE_ESP32
+bool MCP2515::start_rx_task_() {
+  // Above the main loop, the chip only holds two frames
+  if (xTaskCreate(MCP2515::rx_task_, "mcp2515", 3072, this, 3, &this->rx_task_handle_) != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create receive task");
+    this->rx_task_handle_ = nullptr;
+    return false;
+  }
+  this->interrupt_pin_->attach_interrupt(MCP2515::gpio_intr, this, gpio::INTERRUPT_FALLING_EDGE);
+  return true;
+}
+
+void IRAM_ATTR MCP2515::gpio_intr(MCP2515 *arg) {
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(arg->rx_task_handle_, &woken);
+  portYIELD_FROM_ISR(woken);
+}
+
+void MCP2515::rx_task_(void *arg) {
+  auto *self = static_cast<MCP2515 *>(arg);
+  while (true) {
+    uint32_t overflows = 0;
+    bool received = false;
+    // INT stays low while the chip holds a frame or an error interrupt is set
+    while (!self->interrupt_pin_->digital_read()) {
+      canbus::CanFrame frame;
+      canbus::Error err = self->receive_(&frame, overflows);
+      if (err != canbus::ERROR_OK)
+        break;
+      RxFrame *rx = self->rx_pool_.allocate();
+      if (rx == nullptr) {
+        // The main loop falls behind, the ring is full
+        overflows++;
+        continue;
+      }
+      rx->frame = frame;
+      // Never full, there are no more frames than it holds
+      self->rx_ring_.push(rx);
+      received = true;
+    }
+    if (overflows != 0)
+      self->chip_overflows_.fetch_add(overflows, std::memory_order_relaxed);
+    if (received || overflows != 0) {
+#ifdef USE_EVENT_DRIVEN_LOOP
+      App.wake_loop_threadsafe();
+#endif
+    }
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(RX_TASK_POLL_MS));
+  }
+}
+#endif
+
+void MCP2515::begin_transaction_() {
+  this->lock_.lock();
   this->enable();
-  this->transfer_byte(INSTRUCTION_RESET);
+}
+
+void MCP2515::end_transaction_() {
   this->disable();
+  this->lock_.unlock();
+}
+
+canbus::Error MCP2515::reset_() {
+  this->begin_transaction_();
+  this->transfer_byte(INSTRUCTION_RESET);
+  this->end_transaction_();
   ESP_LOGV(TAG, "reset_()");
   delay(10);
 
@@ -55,17 +259,17 @@ canbus::Error MCP2515::reset_() {
 }
 
 uint8_t MCP2515::read_register_(const REGISTER reg) {
-  this->enable();
+  this->begin_transaction_();
   this->transfer_byte(INSTRUCTION_READ);
   this->transfer_byte(reg);
   uint8_t ret = this->transfer_byte(0x00);
-  this->disable();
+  this->end_transaction_();
 
   return ret;
 }
 
 void MCP2515::read_registers_(const REGISTER reg, uint8_t values[], const uint8_t n) {
-  this->enable();
+  this->begin_transaction_();
   this->transfer_byte(INSTRUCTION_READ);
   this->transfer_byte(reg);
   // this->transfer_array(values, n);
@@ -73,42 +277,42 @@ void MCP2515::read_registers_(const REGISTER reg, uint8_t values[], const uint8_
   for (uint8_t i = 0; i < n; i++) {
     values[i] = this->transfer_byte(0x00);
   }
-  this->disable();
+  this->end_transaction_();
 }
 
 void MCP2515::set_register_(const REGISTER reg, const uint8_t value) {
-  this->enable();
+  this->begin_transaction_();
   this->transfer_byte(INSTRUCTION_WRITE);
   this->transfer_byte(reg);
   this->transfer_byte(value);
-  this->disable();
+  this->end_transaction_();
 }
 
 void MCP2515::set_registers_(const REGISTER reg, uint8_t values[], const uint8_t n) {
-  this->enable();
+  this->begin_transaction_();
   this->transfer_byte(INSTRUCTION_WRITE);
   this->transfer_byte(reg);
   // this->transfer_array(values, n);
   for (uint8_t i = 0; i < n; i++) {
     this->transfer_byte(values[i]);
   }
-  this->disable();
+  this->end_transaction_();
 }
 
 void MCP2515::modify_register_(const REGISTER reg, const uint8_t mask, const uint8_t data) {
-  this->enable();
+  this->begin_transaction_();
   this->transfer_byte(INSTRUCTION_BITMOD);
   this->transfer_byte(reg);
   this->transfer_byte(mask);
   this->transfer_byte(data);
-  this->disable();
+  this->end_transaction_();
 }
 
 uint8_t MCP2515::get_status_() {
-  this->enable();
+  this->begin_transaction_();
   this->transfer_byte(INSTRUCTION_READ_STATUS);
   uint8_t i = this->transfer_byte(0x00);
-  this->disable();
+  this->end_transaction_();
 
   return i;
 }
@@ -304,6 +508,30 @@ canbus::Error MCP2515::read_message_(RXBn rxbn, struct canbus::CanFrame *frame)
 }
 
 canbus::Error MCP2515::read_message(struct canbus::CanFrame *frame) {
+#ifdef USE_ESP32
+  if (this->rx_task_handle_ != nullptr) {
+    const uint32_t overflows = this->chip_overflows_.exchange(0, std::memory_order_relaxed);
+    if (overflows != 0)
+      this->add_rx_overflows_(overflows);
+    RxFrame *rx = this->rx_ring_.pop();
+    if (rx == nullptr)
+      return canbus::ERROR_NOMSG;
+    *frame = rx->frame;
+    this->rx_pool_.release(rx);
+    return canbus::ERROR_OK;
+  }
+#endif
+  // INT is high without a frame, no need to ask the chip over the bus
+  if (this->interrupt_pin_ != nullptr && this->interrupt_pin_->digital_read())
+    return canbus::ERROR_NOMSG;
+  uint32_t overflows = 0;
+  canbus::Error rc = this->receive_(frame, overflows);
+  if (overflows != 0)
+    this->add_rx_overflows_(overflows);
+  return rc;
+}
+
+canbus::Error MCP2515::receive_(struct canbus::CanFrame *frame, uint32_t &overflows) {
   canbus::Error rc;
   uint8_t stat = get_status_();
 
@@ -315,6 +543,10 @@ canbus::Error MCP2515::read_message(struct canbus::CanFrame *frame) {
     rc = canbus::ERROR_NOMSG;
   }
 
+  // Frames only get lost with both buffers full. Without a frame, INT is low for an error interrupt.
+  if ((stat & STAT_RXIF_MASK) == STAT_RXIF_MASK || (rc == canbus::ERROR_NOMSG && this->interrupt_pin_ != nullptr))
+    overflows += this->clear_rx_errors_();
+
   return rc;
 }
 
@@ -361,6 +593,21 @@ void MCP2515::clear_errif_() {
   modify_register_(MCP_CANINTF, CANINTF_ERRIF, 0);
 }
 
+uint8_t MCP2515::clear_rx_errors_() {
+  uint8_t intf = get_int_();
+  uint8_t lost = 0;
+  if (intf & CANINTF_ERRIF) {
+    uint8_t eflg = get_error_flags_();
+    lost = ((eflg & EFLG_RX0OVR) != 0) + ((eflg & EFLG_RX1OVR) != 0);
+    if (lost != 0)
+      clear_rx_n_ovr_flags_();
+    clear_errif_();
+  }
+  if (intf & CANINTF_MERRF)
+    clear_merr_();
+  return lost;
+}
+
 canbus::Error MCP2515::set_bitrate_(canbus::CanSpeed can_speed) { return this->set_bitrate_(can_speed, MCP_16MHZ); }
 
 canbus::Error MCP2515::set_bitrate_(canbus::CanSpeed can_speed, CanClock can_clock) {
@@ -3,14 +3,27 @@
 #include "esphome/components/canbus/canbus.h"
 #include "esphome/components/spi/spi.h"
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
 #include "mcp2515_defs.h"
 
+#ifdef USE_ESP32
+#include "esphome/core/event_pool.h"
+#include "esphome/core/lock_free_queue.h"
+
+#include <atomic>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 namespace esphome {
 namespace mcp2515 {
 static const uint32_t SPI_CLOCK = 10000000;  // 10MHz
 
 static const int N_TXBUFFERS = 3;
 static const int N_RXBUFFERS = 2;
+static const int N_MASKS = 2;
+static const int N_FILTERS = 6;
 enum CanClock { MCP_20MHZ, MCP_16MHZ, MCP_12MHZ, MCP_8MHZ };
 enum MASK { MASK0, MASK1 };
 enum RXF { RXF0 = 0, RXF1 = 1, RXF2 = 2, RXF3 = 3, RXF4 = 4, RXF5 = 5 };
@@ -52,6 +65,16 @@ enum STAT : uint8_t { STAT_RX0IF = (1 << 0), STAT_RX1IF = (1 << 1) };
 static const uint8_t STAT_RXIF_MASK = STAT_RX0IF | STAT_RX1IF;
 static const uint8_t EFLG_ERRORMASK = EFLG_RX1OVR | EFLG_RX0OVR | EFLG_TXBO | EFLG_TXEP | EFLG_RXEP;
 
+#ifdef USE_ESP32
+// frames buffered between the receive task and the main loop
+static const uint8_t RX_RING_SIZE = 32;
+
+struct RxFrame {
+  canbus::CanFrame frame;
+  void release() {}
+};
+#endif
+
 class MCP2515 : public canbus::Canbus,
                 public spi::SPIDevice<spi::BIT_ORDER_MSB_FIRST, spi::CLOCK_POLARITY_LOW, spi::CLOCK_PHASE_LEADING,
                                       spi::DATA_RATE_8MHZ> {
@@ -59,6 +82,8 @@ class MCP2515 : public canbus::Canbus,
   MCP2515(){};
   void set_mcp_clock(CanClock clock) { this->mcp_clock_ = clock; };
   void set_mcp_mode(const CanctrlReqopMode mode) { this->mcp_mode_ = mode; }
+  void set_interrupt_pin(InternalGPIOPin *interrupt_pin) { this->interrupt_pin_ = interrupt_pin; }
+  void dump_config() override;
   static const struct TxBnRegs {
     REGISTER CTRL;
     REGISTER SIDH;
@@ -75,7 +100,25 @@ class MCP2515 : public canbus::Canbus,
  protected:
   CanClock mcp_clock_{MCP_8MHZ};
   CanctrlReqopMode mcp_mode_ = CANCTRL_REQOP_NORMAL;
+  InternalGPIOPin *interrupt_pin_{nullptr};
+  // The receive task and the main loop both talk to the chip, every SPI transaction holds it
+  Mutex lock_;
+#ifdef USE_ESP32
+  TaskHandle_t rx_task_handle_{nullptr};
+  LockFreeQueue<RxFrame, RX_RING_SIZE + 1> rx_ring_;
+  EventPool<RxFrame, RX_RING_SIZE> rx_pool_;
+  std::atomic<uint32_t> chip_overflows_{0};
+
+  bool start_rx_task_();
+  static void rx_task_(void *arg);
+  static void gpio_intr(MCP2515 *arg);
+#endif
   bool setup_internal() override;
+  void begin_transaction_();
+  void end_transaction_();
+  canbus::Error set_filters_();
+  /// Reads a frame from the chip. Without a frame, clears the error interrupts and counts lost frames.
+  canbus::Error receive_(struct canbus::CanFrame *frame, uint32_t &overflows);
   canbus::Error set_mode_(CanctrlReqopMode mode);
 
   uint8_t read_register_(REGISTER reg);
@@ -107,6 +150,7 @@ class MCP2515 : public canbus::Canbus,
   void clear_rx_n_ovr_();
   void clear_merr_();
   void clear_errif_();
+  uint8_t clear_rx_errors_();
 };
 }  // namespace mcp2515
 }  // namespace esphome
@@ -36,12 +36,15 @@ DOMAIN = "micro_wake_word"
 
 
 CONF_FEATURE_STEP_SIZE = "feature_step_size"
+CONF_GATE_WAKE_WORDS = "gate_wake_words"
+CONF_LOOKBACK_DURATION = "lookback_duration"
 CONF_MODELS = "models"
 CONF_ON_WAKE_WORD_DETECTED = "on_wake_word_detected"
 CONF_PROBABILITY_CUTOFF = "probability_cutoff"
 CONF_SLIDING_WINDOW_AVERAGE_SIZE = "sliding_window_average_size"
 CONF_SLIDING_WINDOW_SIZE = "sliding_window_size"
 CONF_STOP_AFTER_DETECTION = "stop_after_detection"
+CONF_STRIDE_INTERVAL = "stride_interval"
 CONF_TENSOR_ARENA_SIZE = "tensor_arena_size"
 CONF_VAD = "vad"
 
@@ -311,6 +314,7 @@ MODEL_SCHEMA = cv.Schema(
         cv.Optional(CONF_PROBABILITY_CUTOFF): cv.percentage,
         cv.Optional(CONF_SLIDING_WINDOW_SIZE): cv.positive_int,
         cv.Optional(CONF_INTERNAL, default=False): cv.boolean,
+        cv.Optional(CONF_STRIDE_INTERVAL, default=1): cv.int_range(min=1, max=255),
         cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
     }
 )
@@ -323,6 +327,11 @@ VAD_MODEL_SCHEMA = MODEL_SCHEMA.extend(
                 CONF_MODEL,
                 default="vad",
             ): MODEL_SOURCE_SCHEMA,
+            cv.Optional(CONF_GATE_WAKE_WORDS, default=False): cv.boolean,
+            cv.Optional(CONF_LOOKBACK_DURATION, default="1s"): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(max=cv.TimePeriod(seconds=5)),
+            ),
         }
     )
 )
@@ -460,6 +469,11 @@ async def to_code(config):
     if vad_model := config.get(CONF_VAD):
         cg.add_define("USE_MICRO_WAKE_WORD_VAD")
 
+        if vad_model[CONF_GATE_WAKE_WORDS]:
+            cg.add(
+                var.set_vad_gate(vad_model[CONF_LOOKBACK_DURATION].total_milliseconds)
+            )
+
         # Use the general model loading code for the VAD codegen
         config[CONF_MODELS].append(vad_model)
 
@@ -490,6 +504,10 @@ async def to_code(config):
                     manifest[KEY_MICRO][CONF_TENSOR_ARENA_SIZE],
                 )
             )
+            if model_parameters[CONF_STRIDE_INTERVAL] > 1:
+                cg.add(
+                    var.set_vad_stride_interval(model_parameters[CONF_STRIDE_INTERVAL])
+                )
         else:
             # Only enable the first wake word by default. After first boot, the enable state is saved/loaded to the flash
             default_enabled = i == 0
@@ -508,6 +526,13 @@ async def to_code(config):
             for lang in manifest[KEY_TRAINED_LANGUAGES]:
                 cg.add(wake_word_model.add_trained_language(lang))
 
+            if model_parameters[CONF_STRIDE_INTERVAL] > 1:
+                cg.add(
+                    wake_word_model.set_stride_interval(
+                        model_parameters[CONF_STRIDE_INTERVAL]
+                    )
+                )
+
             cg.add(var.add_wake_word_model(wake_word_model))
 
     cg.add(var.set_features_step_size(manifest[KEY_MICRO][CONF_FEATURE_STEP_SIZE]))
@@ -23,6 +23,10 @@ static const size_t DATA_TIMEOUT_MS = 50;
 
 static const uint32_t RING_BUFFER_DURATION_MS = 120;
 
+// Queued features the wake word models catch up on per feature step once the VAD gate opens. Replaying a little at a
+// time keeps the inference task reading audio fast enough while the queue drains.
+static const uint8_t VAD_GATE_CATCH_UP_FEATURES = 4;
+
 static const uint32_t INFERENCE_TASK_STACK_SIZE = 3072;
 static const UBaseType_t INFERENCE_TASK_PRIORITY = 3;
 
@@ -68,12 +72,26 @@ void MicroWakeWord::dump_config() {
   }
 #ifdef USE_MICRO_WAKE_WORD_VAD
   this->vad_model_->log_model_config();
+  if (this->vad_gate_) {
+    ESP_LOGCONFIG(TAG, "  Wake words gated by VAD, lookback: %" PRIu32 " ms", this->vad_gate_lookback_ms_);
+  }
 #endif
 }
 
 void MicroWakeWord::setup() {
   ESP_LOGCONFIG(TAG, "Running setup");
 
+  // Offset the models' strides so their invokes are spread over the feature steps
+  uint8_t stride_phase = 0;
+  for (auto &model : this->wake_word_models_) {
+    model->set_shared_arena(&this->shared_arena_);
+    model->set_stride_phase(stride_phase++);
+  }
+#ifdef USE_MICRO_WAKE_WORD_VAD
+  this->vad_model_->set_shared_arena(&this->shared_arena_);
+  this->vad_model_->set_stride_phase(stride_phase);
+#endif
+
   this->frontend_config_.window.size_ms = FEATURE_DURATION_MS;
   this->frontend_config_.window.step_size_ms = this->features_step_size_;
   this->frontend_config_.filterbank.num_channels = PREPROCESSOR_FEATURE_SIZE;
@@ -104,21 +122,7 @@ void MicroWakeWord::setup() {
     return;
   }
 
-  this->microphone_source_->add_data_callback([this](const std::vector<uint8_t> &data) {
-    if (this->state_ == State::STOPPED) {
-      return;
-    }
-    std::shared_ptr<RingBuffer> temp_ring_buffer = this->ring_buffer_.lock();
-    if (this->ring_buffer_.use_count() > 1) {
-      size_t bytes_free = temp_ring_buffer->free();
-
-      if (bytes_free < data.size()) {
-        xEventGroupSetBits(this->event_group_, EventGroupBits::WARNING_FULL_RING_BUFFER);
-        temp_ring_buffer->reset();
-      }
-      temp_ring_buffer->write((void *) data.data(), data.size());
-    }
-  });
+  this->microphone_reader_ = this->microphone_source_->create_reader(RING_BUFFER_DURATION_MS);
 
 #ifdef USE_OTA
   ota::get_global_ota_callback()->add_on_state_callback(
@@ -149,28 +153,35 @@ void MicroWakeWord::inference_task(void *params) {
       // Allocate audio transfer buffer
       audio_buffer = audio::AudioSourceTransferBuffer::create(new_bytes_to_process);
 
-      if (audio_buffer == nullptr) {
+      if ((audio_buffer == nullptr) || !this_mww->allocate_shared_arena_()) {
         xEventGroupSetBits(this_mww->event_group_, EventGroupBits::ERROR_MEMORY);
       }
-    }
 
-    if (!(xEventGroupGetBits(this_mww->event_group_) & ERROR_BITS)) {
-      // Allocate ring buffer
-      std::shared_ptr<RingBuffer> temp_ring_buffer = RingBuffer::create(
-          this_mww->microphone_source_->get_audio_stream_info().ms_to_bytes(RING_BUFFER_DURATION_MS));
-      if (temp_ring_buffer.use_count() == 0) {
-        xEventGroupSetBits(this_mww->event_group_, EventGroupBits::ERROR_MEMORY);
+#ifdef USE_MICRO_WAKE_WORD_VAD
+      if (this_mww->vad_gate_) {
+        const size_t lookback_features =
+            std::max<size_t>(this_mww->vad_gate_lookback_ms_ / this_mww->features_step_size_, 1);
+        this_mww->gated_features_.assign(lookback_features * PREPROCESSOR_FEATURE_SIZE, 0);
+        this_mww->gated_features_head_ = 0;
+        this_mww->gated_features_count_ = 0;
       }
-      audio_buffer->set_source(temp_ring_buffer);
-      this_mww->ring_buffer_ = temp_ring_buffer;
+#endif
     }
 
     if (!(xEventGroupGetBits(this_mww->event_group_) & ERROR_BITS)) {
+      // Only detect wake words in audio captured from now on
+      this_mww->microphone_reader_->reset();
+      uint32_t overruns = this_mww->microphone_reader_->get_overruns();
+
       this_mww->microphone_source_->start();
       xEventGroupSetBits(this_mww->event_group_, EventGroupBits::TASK_RUNNING);
 
       while (!(xEventGroupGetBits(this_mww->event_group_) & COMMAND_STOP)) {
-        audio_buffer->transfer_data_from_source(pdMS_TO_TICKS(DATA_TIMEOUT_MS));
+        this_mww->microphone_reader_->transfer_to(*audio_buffer, pdMS_TO_TICKS(DATA_TIMEOUT_MS));
+        if (this_mww->microphone_reader_->get_overruns() != overruns) {
+          overruns = this_mww->microphone_reader_->get_overruns();
+          xEventGroupSetBits(this_mww->event_group_, EventGroupBits::WARNING_FULL_RING_BUFFER);
+        }
 
         if (audio_buffer->available() < new_bytes_to_process) {
           // Insufficient data to generate new spectrogram features, read more next iteration
@@ -197,6 +208,11 @@ void MicroWakeWord::inference_task(void *params) {
   xEventGroupSetBits(this_mww->event_group_, EventGroupBits::TASK_STOPPING);
 
   this_mww->unload_models_();
+  this_mww->free_shared_arena_();
+#ifdef USE_MICRO_WAKE_WORD_VAD
+  this_mww->gated_features_.clear();
+  this_mww->gated_features_.shrink_to_fit();
+#endif
   this_mww->microphone_source_->stop();
   FrontendFreeStateContents(&this_mww->frontend_state_);
 
@@ -443,26 +459,105 @@ void MicroWakeWord::process_probabilities_() {
 
 void MicroWakeWord::unload_models_() {
   for (auto &model : this->wake_word_models_) {
+    if (model->get_invoke_count() > 0) {
+      ESP_LOGD(TAG, "'%s' inference: %" PRIu32 " invokes, average %" PRIu32 " us, max %" PRIu32 " us",
+               model->get_wake_word().c_str(), model->get_invoke_count(), model->get_average_invoke_us(),
+               model->get_max_invoke_us());
+    }
     model->unload_model();
   }
 #ifdef USE_MICRO_WAKE_WORD_VAD
+  if (this->vad_model_->get_invoke_count() > 0) {
+    ESP_LOGD(TAG, "VAD inference: %" PRIu32 " invokes, average %" PRIu32 " us, max %" PRIu32 " us",
+             this->vad_model_->get_invoke_count(), this->vad_model_->get_average_invoke_us(),
+             this->vad_model_->get_max_invoke_us());
+  }
   this->vad_model_->unload_model();
 #endif
 }
 
+bool MicroWakeWord::allocate_shared_arena_() {
+  if (this->shared_arena_.data != nullptr) {
+    return true;
+  }
+
+  // A model's non-persistent tensors never need more than the single arena size from its manifest
+  size_t shared_arena_size = 0;
+  for (auto &model : this->wake_word_models_) {
+    shared_arena_size = std::max(shared_arena_size, model->get_tensor_arena_size());
+  }
+#ifdef USE_MICRO_WAKE_WORD_VAD
+  shared_arena_size = std::max(shared_arena_size, this->vad_model_->get_tensor_arena_size());
+#endif
+
+  RAMAllocator<uint8_t> arena_allocator;
+  this->shared_arena_.data = arena_allocator.allocate(shared_arena_size);
+  if (this->shared_arena_.data == nullptr) {
+    ESP_LOGE(TAG, "Could not allocate the shared tensor arena.");
+    return false;
+  }
+  this->shared_arena_.size = shared_arena_size;
+  return true;
+}
+
+void MicroWakeWord::free_shared_arena_() {
+  if (this->shared_arena_.data != nullptr) {
+    RAMAllocator<uint8_t> arena_allocator;
+    arena_allocator.deallocate(this->shared_arena_.data, this->shared_arena_.size);
+    this->shared_arena_.data = nullptr;
+    this->shared_arena_.size = 0;
+  }
+}
+
 bool MicroWakeWord::update_model_probabilities_(const int8_t audio_features[PREPROCESSOR_FEATURE_SIZE]) {
   bool success = true;
 
+#ifdef USE_MICRO_WAKE_WORD_VAD
+  success = success & this->vad_model_->perform_streaming_inference(audio_features);
+
+  if (this->vad_gate_) {
+    return success & this->update_gated_model_probabilities_(audio_features);
+  }
+#endif
+
   for (auto &model : this->wake_word_models_) {
     // Perform inference
     success = success & model->perform_streaming_inference(audio_features);
   }
+
+  return success;
+}
+
 #ifdef USE_MICRO_WAKE_WORD_VAD
-  success = success & this->vad_model_->perform_streaming_inference(audio_features);
-#endif
+bool MicroWakeWord::update_gated_model_probabilities_(const int8_t audio_features[PREPROCESSOR_FEATURE_SIZE]) {
+  const size_t capacity = this->gated_features_.size() / PREPROCESSOR_FEATURE_SIZE;
+
+  // Queue the new features, dropping the oldest ones once the lookback duration is full
+  const size_t tail = (this->gated_features_head_ + this->gated_features_count_) % capacity;
+  std::memcpy(&this->gated_features_[tail * PREPROCESSOR_FEATURE_SIZE], audio_features, PREPROCESSOR_FEATURE_SIZE);
+  if (this->gated_features_count_ < capacity) {
+    ++this->gated_features_count_;
+  } else {
+    this->gated_features_head_ = (this->gated_features_head_ + 1) % capacity;
+  }
+
+  if (!this->vad_model_->determine_detected().detected) {
+    return true;
+  }
+
+  bool success = true;
+  for (uint8_t i = 0; (i < VAD_GATE_CATCH_UP_FEATURES) && (this->gated_features_count_ > 0); ++i) {
+    const int8_t *features = &this->gated_features_[this->gated_features_head_ * PREPROCESSOR_FEATURE_SIZE];
+    for (auto &model : this->wake_word_models_) {
+      success = success & model->perform_streaming_inference(features);
+    }
+    this->gated_features_head_ = (this->gated_features_head_ + 1) % capacity;
+    --this->gated_features_count_;
+  }
 
   return success;
 }
+#endif
 
 }  // namespace micro_wake_word
 }  // namespace esphome
@@ -9,7 +9,6 @@
 
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
-#include "esphome/core/ring_buffer.h"
 
 #include <freertos/event_groups.h>
 
@@ -53,6 +52,14 @@ class MicroWakeWord : public Component {
 #ifdef USE_MICRO_WAKE_WORD_VAD
   void add_vad_model(const uint8_t *model_start, uint8_t probability_cutoff, size_t sliding_window_size,
                      size_t tensor_arena_size);
+  void set_vad_stride_interval(uint8_t stride_interval) { this->vad_model_->set_stride_interval(stride_interval); }
+
+  /// @brief Only runs the wake word models while the VAD model detects voice. Features from the lookback duration
+  /// before the voice starts are queued, so the models still see the beginning of the wake word.
+  void set_vad_gate(uint32_t lookback_duration_ms) {
+    this->vad_gate_ = true;
+    this->vad_gate_lookback_ms_ = lookback_duration_ms;
+  }
 
   // Intended for the voice assistant component to fetch VAD status
   bool get_vad_state() { return this->vad_state_; }
@@ -67,12 +74,23 @@ class MicroWakeWord : public Component {
   Trigger<std::string> *wake_word_detected_trigger_ = new Trigger<std::string>();
   State state_{State::STOPPED};
 
-  std::weak_ptr<RingBuffer> ring_buffer_;
+  std::unique_ptr<microphone::MicrophoneReader> microphone_reader_;
   std::vector<WakeWordModel *> wake_word_models_;
 
+  // Every model's non-persistent tensors, only allocated while the inference task runs
+  SharedTensorArena shared_arena_;
+
 #ifdef USE_MICRO_WAKE_WORD_VAD
   std::unique_ptr<VADModel> vad_model_;
   bool vad_state_{false};
+
+  bool vad_gate_{false};
+  uint32_t vad_gate_lookback_ms_{0};
+
+  // Features the wake word models haven't run on yet, oldest first. Only allocated while the inference task runs.
+  std::vector<int8_t> gated_features_;
+  size_t gated_features_head_{0};
+  size_t gated_features_count_{0};
 #endif
 
   bool pending_start_{false};
@@ -117,10 +135,24 @@ class MicroWakeWord : public Component {
   /// @brief Deletes each model's TFLite interpreters and frees tensor arena memory.
   void unload_models_();
 
+  /// @brief Allocates the shared arena with room for the largest model's non-persistent tensors
+  /// @return True if successful, false otherwise
+  bool allocate_shared_arena_();
+  /// @brief Frees the shared arena. The models must already be unloaded.
+  void free_shared_arena_();
+
   /// @brief Runs an inference with each model using the new spectrogram features
   /// @param audio_features (int8_t *) Buffer containing new spectrogram features
   /// @return True if successful, false if any errors were encountered
   bool update_model_probabilities_(const int8_t audio_features[PREPROCESSOR_FEATURE_SIZE]);
+
+#ifdef USE_MICRO_WAKE_WORD_VAD
+  /// @brief Queues the new features and runs the wake word models on queued features while the VAD model detects
+  /// voice. Must be called after the VAD model ran on the new features.
+  /// @param audio_features (int8_t *) Buffer containing new spectrogram features
+  /// @return True if successful, false if any errors were encountered
+  bool update_gated_model_probabilities_(const int8_t audio_features[PREPROCESSOR_FEATURE_SIZE]);
+#endif
 };
 
 }  // namespace micro_wake_word
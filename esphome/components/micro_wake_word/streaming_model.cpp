@@ -2,49 +2,43 @@
 
 #ifdef USE_ESP_IDF
 
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#include <cstring>
+
 static const char *const TAG = "micro_wake_word";
 
 namespace esphome {
 namespace micro_wake_word {
 
+static const uint8_t PERSISTENT_ARENA_FILL = 0xA5;
+static const size_t PERSISTENT_ARENA_MARGIN = 256;  // Covers allocations whose first bytes weren't written
+
 void WakeWordModel::log_model_config() {
   ESP_LOGCONFIG(TAG,
                 "    - Wake Word: %s\n"
                 "      Probability cutoff: %.2f\n"
-                "      Sliding window size: %d",
-                this->wake_word_.c_str(), this->probability_cutoff_ / 255.0f, this->sliding_window_size_);
+                "      Sliding window size: %d\n"
+                "      Stride interval: %u",
+                this->wake_word_.c_str(), this->probability_cutoff_ / 255.0f, this->sliding_window_size_,
+                this->stride_interval_);
 }
 
 void VADModel::log_model_config() {
   ESP_LOGCONFIG(TAG,
                 "    - VAD Model\n"
                 "      Probability cutoff: %.2f\n"
-                "      Sliding window size: %d",
-                this->probability_cutoff_ / 255.0f, this->sliding_window_size_);
+                "      Sliding window size: %d\n"
+                "      Stride interval: %u",
+                this->probability_cutoff_ / 255.0f, this->sliding_window_size_, this->stride_interval_);
 }
 
 bool StreamingModel::load_model_() {
-  RAMAllocator<uint8_t> arena_allocator;
-
-  if (this->tensor_arena_ == nullptr) {
-    this->tensor_arena_ = arena_allocator.allocate(this->tensor_arena_size_);
-    if (this->tensor_arena_ == nullptr) {
-      ESP_LOGE(TAG, "Could not allocate the streaming model's tensor arena.");
-      return false;
-    }
-  }
-
-  if (this->var_arena_ == nullptr) {
-    this->var_arena_ = arena_allocator.allocate(STREAMING_MODEL_VARIABLE_ARENA_SIZE);
-    if (this->var_arena_ == nullptr) {
-      ESP_LOGE(TAG, "Could not allocate the streaming model's variable tensor arena.");
-      return false;
-    }
-    this->ma_ = tflite::MicroAllocator::Create(this->var_arena_, STREAMING_MODEL_VARIABLE_ARENA_SIZE);
-    this->mrv_ = tflite::MicroResourceVariables::Create(this->ma_, 20);
+  if ((this->shared_arena_ == nullptr) || (this->shared_arena_->data == nullptr)) {
+    ESP_LOGE(TAG, "The shared tensor arena isn't allocated.");
+    return false;
   }
 
   const tflite::Model *model = tflite::GetModel(this->model_start_);
@@ -54,10 +48,30 @@ bool StreamingModel::load_model_() {
   }
 
   if (this->interpreter_ == nullptr) {
-    this->interpreter_ =
-        make_unique<tflite::MicroInterpreter>(tflite::GetModel(this->model_start_), this->streaming_op_resolver_,
-                                              this->tensor_arena_, this->tensor_arena_size_, this->mrv_);
-    if (this->interpreter_->AllocateTensors() != kTfLiteOk) {
+    if (this->required_persistent_arena_size_ == 0) {
+      // The manifest's size covers a single arena holding both kinds of tensors, so it always fits the persistent ones
+      if (!this->create_interpreter_(this->tensor_arena_size_)) {
+        ESP_LOGE(TAG, "Failed to allocate tensors for the streaming model");
+        return false;
+      }
+
+      const size_t measured_size = std::min(this->persistent_arena_used_() + PERSISTENT_ARENA_MARGIN,
+                                            this->tensor_arena_size_);
+      this->required_persistent_arena_size_ = this->tensor_arena_size_;
+      if (measured_size < this->tensor_arena_size_) {
+        this->destroy_interpreter_();
+        if (this->create_interpreter_(measured_size)) {
+          this->required_persistent_arena_size_ = measured_size;
+        } else {
+          // Some allocation wasn't written to while measuring, so fall back to the manifest's size
+          this->destroy_interpreter_();
+          if (!this->create_interpreter_(this->tensor_arena_size_)) {
+            ESP_LOGE(TAG, "Failed to allocate tensors for the streaming model");
+            return false;
+          }
+        }
+      }
+    } else if (!this->create_interpreter_(this->required_persistent_arena_size_)) {
       ESP_LOGE(TAG, "Failed to allocate tensors for the streaming model");
       return false;
     }
@@ -86,28 +100,81 @@ bool StreamingModel::load_model_() {
       ESP_LOGE(TAG, "Streaming model tensor output is not uint8.");
       return false;
     }
+
+    this->stride_ = input->dims->data[1];
+    this->stride_features_.assign(this->stride_ * PREPROCESSOR_FEATURE_SIZE, 0);
+    this->current_stride_step_ = this->stride_phase_ % this->stride_;
+    this->strides_since_invoke_ = 0;
   }
 
+  this->invoke_count_ = 0;
+  this->last_invoke_us_ = 0;
+  this->max_invoke_us_ = 0;
+  this->total_invoke_us_ = 0;
+
   this->loaded_ = true;
   this->reset_probabilities();
   return true;
 }
 
-void StreamingModel::unload_model() {
+bool StreamingModel::create_interpreter_(size_t persistent_arena_size) {
+  RAMAllocator<uint8_t> arena_allocator;
+
+  this->var_arena_ = arena_allocator.allocate(STREAMING_MODEL_VARIABLE_ARENA_SIZE);
+  if (this->var_arena_ == nullptr) {
+    ESP_LOGE(TAG, "Could not allocate the streaming model's variable tensor arena.");
+    return false;
+  }
+  this->ma_ = tflite::MicroAllocator::Create(this->var_arena_, STREAMING_MODEL_VARIABLE_ARENA_SIZE);
+  this->mrv_ = tflite::MicroResourceVariables::Create(this->ma_, 20);
+
+  this->persistent_arena_ = arena_allocator.allocate(persistent_arena_size);
+  if (this->persistent_arena_ == nullptr) {
+    ESP_LOGE(TAG, "Could not allocate the streaming model's tensor arena.");
+    return false;
+  }
+  this->persistent_arena_size_ = persistent_arena_size;
+
+  // Persistent allocations grow down from the end of the arena, so the untouched fill at the start measures the rest
+  std::memset(this->persistent_arena_, PERSISTENT_ARENA_FILL, persistent_arena_size);
+
+  tflite::MicroAllocator *allocator = tflite::MicroAllocator::Create(
+      this->persistent_arena_, persistent_arena_size, this->shared_arena_->data, this->shared_arena_->size);
+  if (allocator == nullptr) {
+    return false;
+  }
+
+  this->interpreter_ = make_unique<tflite::MicroInterpreter>(tflite::GetModel(this->model_start_),
+                                                             this->streaming_op_resolver_, allocator, this->mrv_);
+  return this->interpreter_->AllocateTensors() == kTfLiteOk;
+}
+
+void StreamingModel::destroy_interpreter_() {
   this->interpreter_.reset();
 
   RAMAllocator<uint8_t> arena_allocator;
 
-  if (this->tensor_arena_ != nullptr) {
-    arena_allocator.deallocate(this->tensor_arena_, this->tensor_arena_size_);
-    this->tensor_arena_ = nullptr;
+  if (this->persistent_arena_ != nullptr) {
+    arena_allocator.deallocate(this->persistent_arena_, this->persistent_arena_size_);
+    this->persistent_arena_ = nullptr;
   }
 
   if (this->var_arena_ != nullptr) {
     arena_allocator.deallocate(this->var_arena_, STREAMING_MODEL_VARIABLE_ARENA_SIZE);
     this->var_arena_ = nullptr;
   }
+}
+
+size_t StreamingModel::persistent_arena_used_() const {
+  size_t untouched = 0;
+  while ((untouched < this->persistent_arena_size_) && (this->persistent_arena_[untouched] == PERSISTENT_ARENA_FILL)) {
+    ++untouched;
+  }
+  return this->persistent_arena_size_ - untouched;
+}
 
+void StreamingModel::unload_model() {
+  this->destroy_interpreter_();
   this->loaded_ = false;
 }
 
@@ -126,22 +193,32 @@ bool StreamingModel::perform_streaming_inference(const int8_t features[PREPROCES
   }
 
   if (this->loaded_) {
-    TfLiteTensor *input = this->interpreter_->input(0);
+    std::memcpy(this->stride_features_.data() + PREPROCESSOR_FEATURE_SIZE * this->current_stride_step_, features,
+                PREPROCESSOR_FEATURE_SIZE);
+    ++this->current_stride_step_;
 
-    uint8_t stride = this->interpreter_->input(0)->dims->data[1];
-    this->current_stride_step_ = this->current_stride_step_ % stride;
+    if (this->current_stride_step_ >= this->stride_) {
+      this->current_stride_step_ = 0;
+      ++this->strides_since_invoke_;
+    }
 
-    std::memmove(
-        (int8_t *) (tflite::GetTensorData<int8_t>(input)) + PREPROCESSOR_FEATURE_SIZE * this->current_stride_step_,
-        features, PREPROCESSOR_FEATURE_SIZE);
-    ++this->current_stride_step_;
+    if (this->strides_since_invoke_ >= this->stride_interval_) {
+      this->strides_since_invoke_ = 0;
+
+      // The input tensor is in the shared arena, so other models' invokes have overwritten it since the last one
+      TfLiteTensor *input = this->interpreter_->input(0);
+      std::memcpy(tflite::GetTensorData<int8_t>(input), this->stride_features_.data(), this->stride_features_.size());
 
-    if (this->current_stride_step_ >= stride) {
+      const uint32_t invoke_start = micros();
       TfLiteStatus invoke_status = this->interpreter_->Invoke();
+      this->last_invoke_us_ = micros() - invoke_start;
       if (invoke_status != kTfLiteOk) {
         ESP_LOGW(TAG, "Streaming interpreter invoke failed");
         return false;
       }
+      ++this->invoke_count_;
+      this->max_invoke_us_ = std::max(this->max_invoke_us_, this->last_invoke_us_);
+      this->total_invoke_us_ += this->last_invoke_us_;
 
       TfLiteTensor *output = this->interpreter_->output(0);
 
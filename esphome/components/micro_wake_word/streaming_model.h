@@ -16,6 +16,14 @@ namespace micro_wake_word {
 static const uint8_t MIN_SLICES_BEFORE_DETECTION = 100;
 static const uint32_t STREAMING_MODEL_VARIABLE_ARENA_SIZE = 1024;
 
+/// @brief Memory for the models' non-persistent tensors (activations and scratch buffers). The inference task invokes
+/// the models one after another and every model keeps its own copy of its input features, so no model needs these
+/// contents to survive until its next invoke and all of them can plan into the same arena.
+struct SharedTensorArena {
+  uint8_t *data{nullptr};
+  size_t size{0};
+};
+
 struct DetectionEvent {
   std::string *wake_word;
   bool detected;
@@ -40,7 +48,7 @@ class StreamingModel {
   /// @brief Sets all recent_streaming_probabilities to 0 and resets the ignore window count
   void reset_probabilities();
 
-  /// @brief Destroys the TFLite interpreter and frees the tensor and variable arenas' memory
+  /// @brief Destroys the TFLite interpreter and frees the persistent and variable arenas' memory
   void unload_model();
 
   /// @brief Enable the model. The next performing_streaming_inference call will load it.
@@ -52,6 +60,28 @@ class StreamingModel {
   /// @brief Return true if the model is enabled.
   bool is_enabled() const { return this->enabled_; }
 
+  /// @brief Sets the arena the model plans its non-persistent tensors into. It must stay allocated while loaded.
+  void set_shared_arena(SharedTensorArena *shared_arena) { this->shared_arena_ = shared_arena; }
+
+  /// @brief Sets which feature step within the model's stride it invokes on. Giving models different phases spreads
+  /// their invokes over the feature steps instead of running all of them in the same step.
+  void set_stride_phase(uint8_t stride_phase) { this->stride_phase_ = stride_phase; }
+
+  /// @brief Only invokes the model on every Nth stride. The features of the strides in between are dropped, which
+  /// saves CPU at the cost of detection accuracy.
+  void set_stride_interval(uint8_t stride_interval) { this->stride_interval_ = stride_interval; }
+
+  /// @brief Returns the tensor arena size from the model's manifest, the most the model needs in any one arena
+  size_t get_tensor_arena_size() const { return this->tensor_arena_size_; }
+
+  // Invoke latency statistics since the model was last loaded, in microseconds
+  uint32_t get_invoke_count() const { return this->invoke_count_; }
+  uint32_t get_last_invoke_us() const { return this->last_invoke_us_; }
+  uint32_t get_max_invoke_us() const { return this->max_invoke_us_; }
+  uint32_t get_average_invoke_us() const {
+    return this->invoke_count_ == 0 ? 0 : static_cast<uint32_t>(this->total_invoke_us_ / this->invoke_count_);
+  }
+
   bool get_unprocessed_probability_status() const { return this->unprocessed_probability_status_; }
 
   // Quantized probability cutoffs mapping 0.0 - 1.0 to 0 - 255
@@ -60,9 +90,17 @@ class StreamingModel {
   void set_probability_cutoff(uint8_t probability_cutoff) { this->probability_cutoff_ = probability_cutoff; }
 
  protected:
-  /// @brief Allocates tensor and variable arenas and sets up the model interpreter
+  /// @brief Allocates the persistent and variable arenas and sets up the model interpreter. The first load measures
+  /// how much of the manifest's tensor arena size the persistent tensors need, later loads only allocate that much.
   /// @return True if successful, false otherwise
   bool load_model_();
+  /// @brief Allocates the arenas and builds the interpreter with a persistent arena of the given size
+  /// @return True if the model's tensors fit, false otherwise
+  bool create_interpreter_(size_t persistent_arena_size);
+  /// @brief Destroys the interpreter and frees the persistent and variable arenas
+  void destroy_interpreter_();
+  /// @brief Returns how many bytes at the end of the persistent arena the interpreter wrote to
+  size_t persistent_arena_used_() const;
   /// @brief Returns true if successfully registered the streaming model's TensorFlow operations
   bool register_streaming_ops_(tflite::MicroMutableOpResolver<20> &op_resolver);
 
@@ -72,6 +110,10 @@ class StreamingModel {
   bool enabled_{true};
   bool unprocessed_probability_status_{false};
   uint8_t current_stride_step_{0};
+  uint8_t stride_{1};
+  uint8_t stride_phase_{0};
+  uint8_t stride_interval_{1};
+  uint8_t strides_since_invoke_{0};
   int16_t ignore_windows_{-MIN_SLICES_BEFORE_DETECTION};
 
   uint8_t default_probability_cutoff_;
@@ -80,10 +122,21 @@ class StreamingModel {
 
   size_t last_n_index_{0};
   size_t tensor_arena_size_;
+  size_t persistent_arena_size_{0};
+  size_t required_persistent_arena_size_{0};  // 0 until measured on the first load
   std::vector<uint8_t> recent_streaming_probabilities_;
 
+  // Features for the current stride, copied into the input tensor just before invoking
+  std::vector<int8_t> stride_features_;
+
+  uint32_t invoke_count_{0};
+  uint32_t last_invoke_us_{0};
+  uint32_t max_invoke_us_{0};
+  uint64_t total_invoke_us_{0};
+
   const uint8_t *model_start_;
-  uint8_t *tensor_arena_{nullptr};
+  SharedTensorArena *shared_arena_{nullptr};
+  uint8_t *persistent_arena_{nullptr};
   uint8_t *var_arena_{nullptr};
   std::unique_ptr<tflite::MicroInterpreter> interpreter_;
   tflite::MicroResourceVariables *mrv_{nullptr};
@@ -1,8 +1,14 @@
 #include "microphone.h"
 
+#include "esphome/core/log.h"
+
+#include <algorithm>
+
 namespace esphome {
 namespace microphone {
 
+static const char *const TAG = "microphone";
+
 void Microphone::add_data_callback(std::function<void(const std::vector<uint8_t> &)> &&data_callback) {
   std::function<void(const std::vector<uint8_t> &)> mute_handled_callback =
       [this, data_callback](const std::vector<uint8_t> &data) {
@@ -15,5 +21,32 @@ void Microphone::add_data_callback(std::function<void(const std::vector<uint8_t>
   this->data_callbacks_.add(std::move(mute_handled_callback));
 }
 
+#ifdef USE_ESP32
+void Microphone::request_ring_duration(uint32_t duration_ms, SemaphoreHandle_t waiter) {
+  if (this->ring_duration_ms_ == 0) {
+    this->data_callbacks_.add([this](const std::vector<uint8_t> &data) {
+      MicrophoneRing *ring = this->ring_.load(std::memory_order_relaxed);
+      if (ring == nullptr) {
+        if (this->ring_failed_)
+          return;
+        // The stream info is only final once the microphone delivers audio
+        ring = MicrophoneRing::create(this->audio_stream_info_.ms_to_bytes(this->ring_duration_ms_),
+                                      this->audio_stream_info_.frames_to_bytes(1), this->ring_waiters_);
+        if (ring == nullptr) {
+          this->ring_failed_ = true;
+          ESP_LOGE(TAG, "Failed to allocate the shared audio ring");
+          return;
+        }
+        this->ring_.store(ring, std::memory_order_release);
+      }
+      ring->write(this->mute_state_ ? nullptr : data.data(), data.size());
+    });
+  }
+  this->ring_duration_ms_ = std::max(this->ring_duration_ms_, duration_ms);
+  if (waiter != nullptr)
+    this->ring_waiters_.push_back(waiter);
+}
+#endif
+
 }  // namespace microphone
 }  // namespace esphome
@@ -2,12 +2,17 @@
 
 #include "esphome/components/audio/audio.h"
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <vector>
 #include "esphome/core/helpers.h"
 
+#ifdef USE_ESP32
+#include "microphone_ring.h"
+#endif
+
 namespace esphome {
 namespace microphone {
 
@@ -32,6 +37,15 @@ class Microphone {
 
   audio::AudioStreamInfo get_audio_stream_info() { return this->audio_stream_info_; }
 
+#ifdef USE_ESP32
+  /// @brief Keeps at least \p duration_ms of captured audio in a ring shared by all MicrophoneReaders.
+  /// Must be called during setup, before the microphone starts.
+  /// @param waiter Binary semaphore the ring gives after every write, so the calling reader can block on it
+  void request_ring_duration(uint32_t duration_ms, SemaphoreHandle_t waiter);
+  /// @brief The shared ring, nullptr until audio was captured after request_ring_duration().
+  MicrophoneRing *get_ring() const { return this->ring_.load(std::memory_order_acquire); }
+#endif
+
  protected:
   State state_{STATE_STOPPED};
   bool mute_state_{false};
@@ -39,6 +53,14 @@ class Microphone {
   audio::AudioStreamInfo audio_stream_info_;
 
   CallbackManager<void(const std::vector<uint8_t> &)> data_callbacks_{};
+
+#ifdef USE_ESP32
+  // Allocated on the first write and kept for the lifetime of the microphone
+  std::atomic<MicrophoneRing *> ring_{nullptr};
+  std::vector<SemaphoreHandle_t> ring_waiters_;
+  uint32_t ring_duration_ms_{0};
+  bool ring_failed_{false};
+#endif
 };
 
 }  // namespace microphone
@@ -0,0 +1,82 @@
+#include "microphone_ring.h"
+
+#ifdef USE_ESP32
+
+#include "esphome/core/helpers.h"
+
+#include <freertos/task.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace microphone {
+
+MicrophoneRing *MicrophoneRing::create(size_t size, size_t frame_size, std::vector<SemaphoreHandle_t> waiters) {
+  size = (size + frame_size - 1) / frame_size * frame_size;
+
+  RAMAllocator<uint8_t> allocator;
+  uint8_t *buffer = allocator.allocate(size);
+  if (buffer == nullptr)
+    return nullptr;
+
+  auto *ring = new MicrophoneRing();  // NOLINT(cppcoreguidelines-owning-memory)
+  ring->buffer_ = buffer;
+  ring->size_ = size;
+  ring->range_ = size * (0x80000000UL / size);
+  ring->waiters_ = std::move(waiters);
+  return ring;
+}
+
+void MicrophoneRing::write(const uint8_t *data, size_t len) {
+  uint32_t head = this->head_.load(std::memory_order_relaxed);
+  if (len > this->size_) {
+    // Only the newest size_ bytes survive anyway
+    head = this->advance(head, len - this->size_);
+    if (data != nullptr)
+      data += len - this->size_;
+    len = this->size_;
+  }
+
+  // Announce the region about to be overwritten before touching it, so readers copying from it can tell
+  uint32_t new_head = this->advance(head, len);
+  this->claimed_.store(new_head, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  size_t offset = head % this->size_;
+  size_t first = std::min(len, this->size_ - offset);
+  if (data != nullptr) {
+    memcpy(this->buffer_ + offset, data, first);
+    memcpy(this->buffer_, data + first, len - first);
+  } else {
+    memset(this->buffer_ + offset, 0, first);
+    memset(this->buffer_, 0, len - first);
+  }
+
+  // Store with release so readers see the audio before the new head
+  this->head_.store(new_head, std::memory_order_release);
+  // A given semaphore stays given until its reader takes it, so a write between a reader's check and its wait
+  // still wakes it
+  for (SemaphoreHandle_t waiter : this->waiters_)
+    xSemaphoreGive(waiter);
+}
+
+void MicrophoneRing::wait_for_data(uint32_t head, SemaphoreHandle_t waiter, TickType_t ticks_to_wait) {
+  if (ticks_to_wait == 0)
+    return;
+  if (waiter == nullptr) {
+    // Creating the reader's semaphore failed, only the timeout can end the wait
+    vTaskDelay(ticks_to_wait);
+    return;
+  }
+  // Drop the wakeup of a write the reader already saw, then check again before blocking
+  xSemaphoreTake(waiter, 0);
+  if (this->get_head() != head)
+    return;
+  xSemaphoreTake(waiter, ticks_to_wait);
+}
+
+}  // namespace microphone
+}  // namespace esphome
+
+#endif  // USE_ESP32
@@ -0,0 +1,62 @@
+#pragma once
+
+#ifdef USE_ESP32
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace microphone {
+
+/** Ring of raw microphone audio with one writer and any number of readers.
+ *
+ * The microphone writes every chunk it captures once, and each reader keeps its own position instead of copying the
+ * audio into a buffer of its own. The writer never waits: a reader that falls more than the ring's size behind loses
+ * the oldest audio, which it detects from its position.
+ */
+class MicrophoneRing {
+ public:
+  /// @brief Allocates a ring for at least \p size bytes, rounded up to whole frames.
+  /// @param waiters One binary semaphore per reader, each is given after every write
+  /// @return nullptr if the allocation failed
+  static MicrophoneRing *create(size_t size, size_t frame_size, std::vector<SemaphoreHandle_t> waiters);
+
+  /// @brief Appends audio, overwriting the oldest data. Only called from the microphone's task.
+  /// @param data Audio to append, or nullptr to append silence
+  void write(const uint8_t *data, size_t len);
+
+  /// @brief Position after the newest byte that can be read.
+  uint32_t get_head() const { return this->head_.load(std::memory_order_acquire); }
+  /// @brief Position after the newest byte the writer has started on. Audio more than get_size() bytes before it may
+  /// have been overwritten, check after copying with an acquire fence in between.
+  uint32_t get_claimed() const { return this->claimed_.load(std::memory_order_relaxed); }
+  /// @brief Bytes between two positions, taking the wrap around of positions into account.
+  uint32_t distance(uint32_t from, uint32_t to) const { return (to + this->range_ - from) % this->range_; }
+  uint32_t advance(uint32_t position, uint32_t bytes) const { return (position + bytes) % this->range_; }
+
+  size_t get_size() const { return this->size_; }
+  const uint8_t *at(uint32_t position) const { return this->buffer_ + position % this->size_; }
+
+  /// @brief Blocks until the head moves away from \p head, up to \p ticks_to_wait.
+  /// @param waiter The calling reader's semaphore that was passed to create()
+  void wait_for_data(uint32_t head, SemaphoreHandle_t waiter, TickType_t ticks_to_wait);
+
+ protected:
+  uint8_t *buffer_{nullptr};
+  size_t size_{0};
+  /// Positions wrap at a multiple of the size, so a position modulo the size is always its offset in the buffer.
+  uint32_t range_{0};
+  std::atomic<uint32_t> head_{0};
+  std::atomic<uint32_t> claimed_{0};
+  std::vector<SemaphoreHandle_t> waiters_;
+};
+
+}  // namespace microphone
+}  // namespace esphome
+
+#endif  // USE_ESP32
@@ -1,5 +1,7 @@
 #include "microphone_source.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace microphone {
 
@@ -17,13 +19,23 @@ void MicrophoneSource::add_data_callback(std::function<void(const std::vector<ui
 
           // Take temporary ownership of samples vector to avoid deallaction before the callback finishes
           std::shared_ptr<std::vector<uint8_t>> output_samples = this->processed_samples_;
-          this->process_audio_(data, *output_samples);
+          const uint32_t frames = this->mic_->get_audio_stream_info().bytes_to_frames(data.size());
+          output_samples->resize(this->get_audio_stream_info().frames_to_bytes(frames));
+          this->process_audio_(data.data(), frames, output_samples->data());
           data_callback(*output_samples);
         }
       };
   this->mic_->add_data_callback(std::move(filtered_callback));
 }
 
+#ifdef USE_ESP32
+std::unique_ptr<MicrophoneReader> MicrophoneSource::create_reader(uint32_t duration_ms) {
+  SemaphoreHandle_t waiter = xSemaphoreCreateBinary();
+  this->mic_->request_ring_duration(duration_ms, waiter);
+  return make_unique<MicrophoneReader>(this, waiter);
+}
+#endif
+
 audio::AudioStreamInfo MicrophoneSource::get_audio_stream_info() {
   return audio::AudioStreamInfo(this->bits_per_sample_, this->channels_.count(),
                                 this->mic_->get_audio_stream_info().get_sample_rate());
@@ -44,7 +56,7 @@ void MicrophoneSource::stop() {
   }
 }
 
-void MicrophoneSource::process_audio_(const std::vector<uint8_t> &data, std::vector<uint8_t> &filtered_data) {
+void MicrophoneSource::process_audio_(const uint8_t *source, uint32_t frames, uint8_t *target) {
   // - Bit depth conversions are obtained by truncating bits or padding with zeros - no dithering is applied.
   // - In the comments, Qxx refers to a fixed point number with xx bits of precision for representing fractional values.
   //   For example, audio with a bit depth of 16 can store a sample in a int16, which can be considered a Q15 number.
@@ -58,22 +70,26 @@ void MicrophoneSource::process_audio_(const std::vector<uint8_t> &data, std::vec
 
   const size_t source_bytes_per_frame = this->mic_->get_audio_stream_info().frames_to_bytes(1);
 
-  const uint32_t total_frames = this->mic_->get_audio_stream_info().bytes_to_frames(data.size());
   const size_t target_bytes_per_sample = (this->bits_per_sample_ + 7) / 8;
-  const size_t target_bytes_per_frame = target_bytes_per_sample * this->channels_.count();
 
-  filtered_data.resize(target_bytes_per_frame * total_frames);
+  if (source_bytes_per_sample == 4 && target_bytes_per_sample == 2 &&
+      this->channels_.to_ulong() == (1UL << source_channels) - 1) {
+    // The common 32 bit I2S microphone to 16 bit consumer case, with every channel kept
+    audio::q31_to_q15_audio_samples(source, reinterpret_cast<int16_t *>(target), this->gain_factor_,
+                                    frames * source_channels);
+    return;
+  }
 
-  uint8_t *current_data = filtered_data.data();
+  uint8_t *current_data = target;
 
-  for (uint32_t frame_index = 0; frame_index < total_frames; ++frame_index) {
+  for (uint32_t frame_index = 0; frame_index < frames; ++frame_index) {
     for (uint32_t channel_index = 0; channel_index < source_channels; ++channel_index) {
       if (this->channels_.test(channel_index)) {
         // Channel's current sample is included in the target mask. Convert bits per sample, if necessary.
 
         const uint32_t sample_index = frame_index * source_bytes_per_frame + channel_index * source_bytes_per_sample;
 
-        int32_t sample = audio::unpack_audio_sample_to_q31(&data[sample_index], source_bytes_per_sample);  // Q31
+        int32_t sample = audio::unpack_audio_sample_to_q31(&source[sample_index], source_bytes_per_sample);  // Q31
         sample >>= 6;                                                                                      // Q31 -> Q25
 
         // Apply gain using multiplication
@@ -91,5 +107,96 @@ void MicrophoneSource::process_audio_(const std::vector<uint8_t> &data, std::vec
   }
 }
 
+#ifdef USE_ESP32
+void MicrophoneReader::reset() {
+  MicrophoneRing *ring = this->source_->mic_->get_ring();
+  this->synced_ = ring != nullptr;
+  if (this->synced_)
+    this->position_ = ring->get_head();
+}
+
+MicrophoneRing *MicrophoneReader::sync_() {
+  MicrophoneRing *ring = this->source_->mic_->get_ring();
+  if (ring != nullptr && !this->synced_) {
+    // The ring was created after the reset, so everything it still holds is new
+    uint32_t head = ring->get_head();
+    uint32_t filled = std::min<uint32_t>(ring->distance(0, head), ring->get_size());
+    this->position_ = ring->distance(filled, head);
+    this->synced_ = true;
+  }
+  return ring;
+}
+
+size_t MicrophoneReader::available() {
+  MicrophoneRing *ring = this->sync_();
+  if (ring == nullptr)
+    return 0;
+  uint32_t unread = std::min<uint32_t>(ring->distance(this->position_, ring->get_head()), ring->get_size());
+  const audio::AudioStreamInfo raw_info = this->source_->mic_->get_audio_stream_info();
+  return this->source_->get_audio_stream_info().frames_to_bytes(raw_info.bytes_to_frames(unread));
+}
+
+size_t MicrophoneReader::read(void *data, size_t len, TickType_t ticks_to_wait) {
+  MicrophoneRing *ring = this->sync_();
+  if (ring == nullptr) {
+    // The microphone hasn't captured anything yet, block like an empty ring would
+    if (ticks_to_wait > 0)
+      vTaskDelay(ticks_to_wait);
+    return 0;
+  }
+
+  uint32_t head = ring->get_head();
+  if (head == this->position_) {
+    ring->wait_for_data(head, this->waiter_, ticks_to_wait);
+    head = ring->get_head();
+  }
+
+  const audio::AudioStreamInfo raw_info = this->source_->mic_->get_audio_stream_info();
+  const audio::AudioStreamInfo target_info = this->source_->get_audio_stream_info();
+  const size_t raw_frame_size = raw_info.frames_to_bytes(1);
+
+  uint32_t unread = ring->distance(this->position_, head);
+  if (unread > ring->get_size()) {
+    // Lapped by the writer before the read even started
+    ++this->overruns_;
+    this->position_ = ring->distance(ring->get_size(), head);
+    unread = ring->get_size();
+  }
+  uint32_t frames = std::min<uint32_t>(raw_info.bytes_to_frames(unread), target_info.bytes_to_frames(len));
+
+  // Convert in at most two runs, split where the ring wraps around. The ring size is a whole number of frames.
+  uint8_t *target = static_cast<uint8_t *>(data);
+  uint32_t position = this->position_;
+  uint32_t remaining = frames;
+  while (remaining > 0) {
+    size_t contiguous = ring->get_size() - position % ring->get_size();
+    uint32_t run = std::min<uint32_t>(remaining, contiguous / raw_frame_size);
+    this->source_->process_audio_(ring->at(position), run, target);
+    target += target_info.frames_to_bytes(run);
+    position = ring->advance(position, raw_info.frames_to_bytes(run));
+    remaining -= run;
+  }
+
+  // The writer may have overwritten what was just converted, check against how far it got before trusting the data
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (ring->distance(this->position_, ring->get_claimed()) > ring->get_size()) {
+    ++this->overruns_;
+    this->position_ = ring->get_head();
+    return 0;
+  }
+
+  this->position_ = position;
+  return target_info.frames_to_bytes(frames);
+}
+
+size_t MicrophoneReader::transfer_to(audio::AudioSourceTransferBuffer &buffer, TickType_t ticks_to_wait) {
+  // Without a ring buffer source this only moves any unprocessed data to the start of the buffer
+  buffer.transfer_data_from_source(0);
+  size_t bytes_read = this->read(buffer.get_buffer_end(), buffer.free(), ticks_to_wait);
+  buffer.increase_buffer_length(bytes_read);
+  return bytes_read;
+}
+#endif
+
 }  // namespace microphone
 }  // namespace esphome
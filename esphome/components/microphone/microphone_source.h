@@ -8,13 +8,22 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <vector>
 
+#ifdef USE_ESP32
+#include "esphome/components/audio/audio_transfer_buffer.h"
+#endif
+
 namespace esphome {
 namespace microphone {
 
 static const int32_t MAX_GAIN_FACTOR = 64;
 
+#ifdef USE_ESP32
+class MicrophoneReader;
+#endif
+
 class MicrophoneSource {
   /*
    * @brief Helper class that handles converting raw microphone data to a requested format.
@@ -49,6 +58,13 @@ class MicrophoneSource {
 
   void add_data_callback(std::function<void(const std::vector<uint8_t> &)> &&data_callback);
 
+#ifdef USE_ESP32
+  /// @brief Creates a reader that converts audio straight from the microphone's shared ring instead of copying every
+  /// chunk through a callback into a ring buffer of its own. Must be called during setup.
+  /// @param duration_ms How much audio the reader may fall behind before the oldest audio is lost
+  std::unique_ptr<MicrophoneReader> create_reader(uint32_t duration_ms);
+#endif
+
   void set_gain_factor(int32_t gain_factor) { this->gain_factor_ = clamp<int32_t>(gain_factor, 1, MAX_GAIN_FACTOR); }
   int32_t get_gain_factor() { return this->gain_factor_; }
 
@@ -64,7 +80,12 @@ class MicrophoneSource {
   bool is_stopped() const { return !this->is_running(); };
 
  protected:
-  void process_audio_(const std::vector<uint8_t> &data, std::vector<uint8_t> &filtered_data);
+#ifdef USE_ESP32
+  friend class MicrophoneReader;
+#endif
+
+  /// @brief Converts \p frames frames of raw microphone audio from \p source into \p target
+  void process_audio_(const uint8_t *source, uint32_t frames, uint8_t *target);
 
   std::shared_ptr<std::vector<uint8_t>> processed_samples_;
 
@@ -76,5 +97,45 @@ class MicrophoneSource {
   bool passive_;  // Only pass audio if ``mic_`` is already running
 };
 
+#ifdef USE_ESP32
+class MicrophoneReader {
+  /*
+   * @brief Reads converted audio from a microphone's shared ring at its own position.
+   * Readers of the same microphone share one copy of the raw audio. A reader that falls further behind than the ring
+   * holds skips ahead to the newest audio and counts an overrun.
+   */
+ public:
+  MicrophoneReader(MicrophoneSource *source, SemaphoreHandle_t waiter) : source_(source), waiter_(waiter) {}
+
+  /// @brief Skips any unread audio, so the next read returns audio captured from now on.
+  void reset();
+
+  /// @brief Bytes of converted audio that can be read without blocking
+  size_t available();
+
+  /// @brief Reads up to \p len bytes of converted audio, whole frames only.
+  /// @param ticks_to_wait FreeRTOS ticks to block if no audio is available
+  /// @return Number of bytes read
+  size_t read(void *data, size_t len, TickType_t ticks_to_wait);
+
+  /// @brief Fills the free space of a transfer buffer with converted audio, like transfer_data_from_source().
+  /// @return Number of bytes read
+  size_t transfer_to(audio::AudioSourceTransferBuffer &buffer, TickType_t ticks_to_wait);
+
+  /// @brief Number of times the reader fell behind and lost audio
+  uint32_t get_overruns() const { return this->overruns_; }
+
+ protected:
+  /// @brief Returns the ring once it exists, positioning a reader that was reset before the first audio arrived.
+  MicrophoneRing *sync_();
+
+  MicrophoneSource *source_;
+  SemaphoreHandle_t waiter_;
+  uint32_t position_{0};
+  uint32_t overruns_{0};
+  bool synced_{false};
+};
+#endif
+
 }  // namespace microphone
 }  // namespace esphome
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <cstring>
 #include <utility>
 
 #include "esphome/components/spi/spi.h"
 #include "esphome/components/display/display.h"
 #include "esphome/components/display/display_color_utils.h"
+#include "esphome/components/display/dirty_region.h"
 
 namespace esphome {
 namespace mipi_spi {
@@ -473,8 +475,13 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
     if (this->buffer_ == nullptr) {
       this->mark_failed("Buffer allocation failed");
     }
+    // Some chips require that the drawing window be aligned on certain boundaries
+    this->dirty_region_.set_tile_size(this->draw_rounding_);
   }
 
+  /// Bytes of pixel data sent to the display by the last update
+  uint32_t get_last_update_bytes() const { return this->dirty_region_.get_last_bytes_sent(); }
+
   void update() override {
 #if ESPHOME_LOG_LEVEL == ESPHOME_LOG_LEVEL_VERBOSE
     auto now = millis();
@@ -482,16 +489,26 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
     if (this->is_failed()) {
       return;
     }
+    uint32_t bytes_sent = 0;
+#ifdef USE_DISPLAY_STATS
+    uint32_t draw_us = 0;
+    uint32_t transfer_us = 0;
+#endif
     // for updates with a small buffer, we repeatedly call the writer_ function, clipping the height to a fraction of
     // the display height,
     for (this->start_line_ = 0; this->start_line_ < HEIGHT; this->start_line_ += HEIGHT / FRACTION) {
 #if ESPHOME_LOG_LEVEL == ESPHOME_LOG_LEVEL_VERBOSE
       auto lap = millis();
+#endif
+#ifdef USE_DISPLAY_STATS
+      uint32_t band_start = micros();
 #endif
       this->end_line_ = this->start_line_ + HEIGHT / FRACTION;
       if (this->auto_clear_enabled_) {
         this->clear();
       }
+      // Clip to the band, so drawing that skips clipped areas does not repeat all its work for every band
+      this->start_clipping(this->band_rect_());
       if (this->page_ != nullptr) {
         this->page_->get_writer()(*this);
       } else if (this->writer_.has_value()) {
@@ -499,34 +516,40 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
       } else {
         this->test_card();
       }
+      this->clear_clipping_();
 #if ESPHOME_LOG_LEVEL == ESPHOME_LOG_LEVEL_VERBOSE
       esph_log_v(TAG, "Drawing from line %d took %dms", this->start_line_, millis() - lap);
       lap = millis();
 #endif
-      if (this->x_low_ > this->x_high_ || this->y_low_ > this->y_high_)
-        return;
-      esph_log_v(TAG, "x_low %d, y_low %d, x_high %d, y_high %d", this->x_low_, this->y_low_, this->x_high_,
-                 this->y_high_);
-      // Some chips require that the drawing window be aligned on certain boundaries
-      auto dr = this->draw_rounding_;
-      this->x_low_ = this->x_low_ / dr * dr;
-      this->y_low_ = this->y_low_ / dr * dr;
-      this->x_high_ = (this->x_high_ + dr) / dr * dr - 1;
-      this->y_high_ = (this->y_high_ + dr) / dr * dr - 1;
-      int w = this->x_high_ - this->x_low_ + 1;
-      int h = this->y_high_ - this->y_low_ + 1;
-      this->write_to_display_(this->x_low_, this->y_low_, w, h, this->buffer_, this->x_low_,
-                              this->y_low_ - this->start_line_, WIDTH - w);
-      // invalidate watermarks
-      this->x_low_ = WIDTH;
-      this->y_low_ = HEIGHT;
-      this->x_high_ = 0;
-      this->y_high_ = 0;
+#ifdef USE_DISPLAY_STATS
+      draw_us += micros() - band_start;
+      band_start = micros();
+#endif
+      if (this->dirty_region_.empty()) {
+        // Nothing changed in this band, later bands may still have changes
+        this->dirty_region_.flushed(bytes_sent);
+        continue;
+      }
+      for (const display::Rect &rect : this->dirty_region_) {
+        esph_log_v(TAG, "x %d, y %d, w %d, h %d", rect.x, rect.y, rect.w, rect.h);
+        this->write_to_display_(rect.x, rect.y, rect.w, rect.h, this->buffer_, rect.x, rect.y - this->start_line_,
+                                WIDTH - rect.w);
+        bytes_sent += static_cast<uint32_t>(rect.w) * rect.h * DISPLAYPIXEL;
+      }
+      // Records the bytes sent by all parts of the buffer so far
+      this->dirty_region_.flushed(bytes_sent);
+#ifdef USE_DISPLAY_STATS
+      transfer_us += micros() - band_start;
+#endif
 #if ESPHOME_LOG_LEVEL == ESPHOME_LOG_LEVEL_VERBOSE
       esph_log_v(TAG, "Write to display took %dms", millis() - lap);
       lap = millis();
 #endif
     }
+#ifdef USE_DISPLAY_STATS
+    this->record_update_(draw_us);
+    this->record_transfer_(transfer_us, bytes_sent);
+#endif
 #if ESPHOME_LOG_LEVEL == ESPHOME_LOG_LEVEL_VERBOSE
     esph_log_v(TAG, "Total update took %dms", millis() - now);
 #endif
@@ -540,26 +563,64 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
     if (x < 0 || x >= WIDTH || y < this->start_line_ || y >= this->end_line_)
       return;
     this->buffer_[(y - this->start_line_) * WIDTH + x] = convert_color_(color);
-    if (x < this->x_low_) {
-      this->x_low_ = x;
-    }
-    if (x > this->x_high_) {
-      this->x_high_ = x;
-    }
-    if (y < this->y_low_) {
-      this->y_low_ = y;
+    this->dirty_region_.add(x, y);
+    this->count_pixels_(1);
+  }
+
+  // Fill a rectangle, clipping and converting the color once and filling whole buffer rows.
+  void fill_rect(int x_start, int y_start, int w, int h, Color color) override {
+    int min_x, max_x, min_y, max_y;
+    if (!this->clamp_x_(x_start, w, min_x, max_x) || !this->clamp_y_(y_start, h, min_y, max_y))
+      return;
+    // Rotating opposite corners gives the native rectangle
+    int x1 = min_x, y1 = min_y, x2 = max_x - 1, y2 = max_y - 1;
+    rotate_coordinates_(x1, y1);
+    rotate_coordinates_(x2, y2);
+    if (x1 > x2)
+      std::swap(x1, x2);
+    if (y1 > y2)
+      std::swap(y1, y2);
+    y1 = std::max(y1, (int) this->start_line_);
+    y2 = std::min(y2, this->end_line_ - 1);
+    if (y1 > y2)
+      return;
+    const BUFFERTYPE pixel = convert_color_(color);
+    for (int y = y1; y <= y2; y++) {
+      std::fill_n(this->buffer_ + (y - this->start_line_) * WIDTH + x1, x2 - x1 + 1, pixel);
     }
-    if (y > this->y_high_) {
-      this->y_high_ = y;
+    this->dirty_region_.add(display::Rect(x1, y1, x2 - x1 + 1, y2 - y1 + 1));
+    this->count_pixels_((x2 - x1 + 1) * (y2 - y1 + 1));
+  }
+
+  // Copy RGB565 rows straight into the buffer when it has the same format, otherwise convert pixel by pixel.
+  void draw_rgb565_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, size_t stride,
+                      bool big_endian) override {
+#ifndef USE_ESP8266  // images are in flash there, which needs aligned reads
+    if constexpr (BUFFERPIXEL == PIXEL_MODE_16 && ROTATION == display::DISPLAY_ROTATION_0_DEGREES) {
+      if (big_endian == IS_BIG_ENDIAN) {
+        int min_x, max_x, min_y, max_y;
+        if (!this->clamp_x_(x_start, w, min_x, max_x) || !this->clamp_y_(y_start, h, min_y, max_y))
+          return;
+        min_y = std::max(min_y, (int) this->start_line_);
+        max_y = std::min(max_y, (int) this->end_line_);
+        if (min_y >= max_y)
+          return;
+        ptr += (min_y - y_start) * stride + (min_x - x_start) * 2;
+        for (int y = min_y; y != max_y; y++, ptr += stride) {
+          memcpy(this->buffer_ + (y - this->start_line_) * WIDTH + min_x, ptr, (max_x - min_x) * 2);
+        }
+        this->dirty_region_.add(display::Rect(min_x, min_y, max_x - min_x, max_y - min_y));
+        this->count_pixels_((max_x - min_x) * (max_y - min_y));
+        return;
+      }
     }
+#endif
+    display::Display::draw_rgb565_at(x_start, y_start, w, h, ptr, stride, big_endian);
   }
 
   // Fills the display with a color.
   void fill(Color color) override {
-    this->x_low_ = 0;
-    this->y_low_ = this->start_line_;
-    this->x_high_ = WIDTH - 1;
-    this->y_high_ = this->end_line_ - 1;
+    this->dirty_region_.add(display::Rect(0, this->start_line_, WIDTH, this->end_line_ - this->start_line_));
     std::fill_n(this->buffer_, HEIGHT * WIDTH / FRACTION, convert_color_(color));
   }
 
@@ -576,6 +637,19 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
   }
 
  protected:
+  // The band of the buffer, in the coordinates drawing uses
+  display::Rect band_rect_() const {
+    const int16_t lines = this->end_line_ - this->start_line_;
+    if constexpr (ROTATION == display::DISPLAY_ROTATION_180_DEGREES) {
+      return display::Rect(0, HEIGHT - this->end_line_, WIDTH, lines);
+    } else if constexpr (ROTATION == display::DISPLAY_ROTATION_90_DEGREES) {
+      return display::Rect(this->start_line_, 0, lines, WIDTH);
+    } else if constexpr (ROTATION == display::DISPLAY_ROTATION_270_DEGREES) {
+      return display::Rect(HEIGHT - this->end_line_, 0, lines, WIDTH);
+    }
+    return display::Rect(0, this->start_line_, WIDTH, lines);
+  }
+
   // Rotate the coordinates to match the display orientation.
   void rotate_coordinates_(int &x, int &y) const {
     if constexpr (ROTATION == display::DISPLAY_ROTATION_180_DEGREES) {
@@ -607,10 +681,7 @@ class MipiSpiBuffer : public MipiSpi<BUFFERTYPE, BUFFERPIXEL, IS_BIG_ENDIAN, DIS
   }
 
   BUFFERTYPE *buffer_{};
-  uint16_t x_low_{WIDTH};
-  uint16_t y_low_{HEIGHT};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
+  display::DirtyRegion dirty_region_;
   uint16_t start_line_{0};
   uint16_t end_line_{1};
 };
@@ -255,19 +255,16 @@ void MitsubishiClimate::transmit_state() {
   auto *data = transmit.get_data();
 
   data->set_carrier_frequency(38000);
+  // Two copies of the header, 16 timings per byte and the footer
+  data->reserve(2 * (4 + sizeof(remote_state) * 16));
   // repeat twice
   for (uint8_t r = 0; r < 2; r++) {
     // Header
     data->mark(MITSUBISHI_HEADER_MARK);
     data->space(MITSUBISHI_HEADER_SPACE);
     // Data
-    for (uint8_t i : remote_state) {
-      for (uint8_t j = 0; j < 8; j++) {
-        data->mark(MITSUBISHI_BIT_MARK);
-        bool bit = i & (1 << j);
-        data->space(bit ? MITSUBISHI_ONE_SPACE : MITSUBISHI_ZERO_SPACE);
-      }
-    }
+    data->encode_bytes(remote_state, sizeof(remote_state), MITSUBISHI_BIT_MARK, MITSUBISHI_ONE_SPACE,
+                       MITSUBISHI_ZERO_SPACE, false);
     // Footer
     if (r == 0) {
       data->mark(MITSUBISHI_BIT_MARK);
@@ -121,6 +121,7 @@ async def to_code(config):
     cg.add(var.set_output_channels(config[CONF_NUM_CHANNELS]))
     cg.add(var.set_output_speaker(spkr))
     cg.add(var.set_queue_mode(config[CONF_QUEUE_MODE]))
+    audio.add_audio_stats_stage(var, str(config[CONF_ID]))
 
     if task_stack_in_psram := config.get(CONF_TASK_STACK_IN_PSRAM):
         cg.add(var.set_task_stack_in_psram(task_stack_in_psram))
@@ -134,6 +135,7 @@ async def to_code(config):
         source_speaker = cg.new_Pvariable(speaker_config[CONF_ID])
 
         cg.add(source_speaker.set_buffer_duration(speaker_config[CONF_BUFFER_DURATION]))
+        audio.add_audio_stats_stage(source_speaker, str(speaker_config[CONF_ID]))
 
         if speaker_config[CONF_TIMEOUT] != CONF_NEVER:
             cg.add(source_speaker.set_timeout(speaker_config[CONF_TIMEOUT]))
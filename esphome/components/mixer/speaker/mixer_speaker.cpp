@@ -432,6 +432,14 @@ void MixerSpeaker::copy_frames(const int16_t *input_buffer, audio::AudioStreamIn
 
     return;
   }
+  if (input_channels == 1 && output_channels == 2) {
+    audio::mono_to_stereo_samples(input_buffer, output_buffer, frames_to_transfer);
+    return;
+  }
+  if (input_channels == 2 && output_channels == 1) {
+    audio::stereo_to_mono_samples(input_buffer, output_buffer, frames_to_transfer);
+    return;
+  }
 
   for (uint32_t frame_index = 0; frame_index < frames_to_transfer; ++frame_index) {
     for (uint8_t output_channel_index = 0; output_channel_index < output_channels; ++output_channel_index) {
@@ -450,6 +458,12 @@ void MixerSpeaker::mix_audio_samples(const int16_t *primary_buffer, audio::Audio
   const uint8_t secondary_channels = secondary_stream_info.get_channels();
   const uint8_t output_channels = output_stream_info.get_channels();
 
+  if (primary_channels == output_channels && secondary_channels == output_channels) {
+    // Same layout everywhere, so the frames can be added as one flat run of samples
+    audio::add_audio_samples(primary_buffer, secondary_buffer, output_buffer, frames_to_mix * output_channels);
+    return;
+  }
+
   const uint8_t max_primary_channel_index = primary_channels - 1;
   const uint8_t max_secondary_channel_index = secondary_channels - 1;
 
@@ -503,6 +517,14 @@ void MixerSpeaker::audio_mixer_task(void *params) {
     // Never shift the data in the output transfer buffer to avoid unnecessary, slow data moves
     output_transfer_buffer->transfer_data_to_sink(pdMS_TO_TICKS(TASK_DELAY_MS), false);
 
+#ifdef USE_AUDIO_STATS
+    if (this_mixer->audio_stats_ != nullptr) {
+      this_mixer->audio_stats_->record_fill(output_transfer_buffer->available(), output_transfer_buffer->free());
+      this_mixer->audio_stats_->set_buffered_ms(
+          this_mixer->audio_stream_info_.value().bytes_to_ms(output_transfer_buffer->available()));
+    }
+#endif
+
     const uint32_t output_frames_free =
         this_mixer->audio_stream_info_.value().bytes_to_frames(output_transfer_buffer->free());
 
@@ -514,6 +536,16 @@ void MixerSpeaker::audio_mixer_task(void *params) {
         std::shared_ptr<audio::AudioSourceTransferBuffer> transfer_buffer = speaker->get_transfer_buffer().lock();
         speaker->process_data_from_source(0);  // Transfers and ducks audio from source ring buffers
 
+#ifdef USE_AUDIO_STATS
+        RingBuffer *source_ring_buffer = transfer_buffer->get_ring_buffer();
+        if ((speaker->audio_stats_ != nullptr) && (source_ring_buffer != nullptr)) {
+          const size_t available = source_ring_buffer->available();
+          speaker->audio_stats_->record_fill(available, source_ring_buffer->free());
+          speaker->audio_stats_->set_buffered_ms(
+              speaker->get_audio_stream_info().bytes_to_ms(available + transfer_buffer->available()));
+        }
+#endif
+
         if ((transfer_buffer->available() > 0) && !speaker->get_pause_state()) {
           // Store the locked transfer buffers in their own vector to avoid releasing ownership until after the loop
           transfer_buffers_with_data.push_back(transfer_buffer);
@@ -528,6 +560,10 @@ void MixerSpeaker::audio_mixer_task(void *params) {
       continue;
     }
 
+#ifdef USE_AUDIO_STATS
+    audio::AudioStageTimer timer(this_mixer->audio_stats_);
+#endif
+
     uint32_t frames_to_mix = output_frames_free;
 
     if ((transfer_buffers_with_data.size() == 1) || this_mixer->queue_mode_) {
@@ -3,6 +3,7 @@
 #ifdef USE_ESP32
 
 #include "esphome/components/audio/audio.h"
+#include "esphome/components/audio/audio_stats.h"
 #include "esphome/components/audio/audio_transfer_buffer.h"
 #include "esphome/components/speaker/speaker.h"
 
@@ -78,6 +79,10 @@ class SourceSpeaker : public speaker::Speaker, public Component {
 
   std::weak_ptr<audio::AudioSourceTransferBuffer> get_transfer_buffer() { return this->transfer_buffer_; }
 
+#ifdef USE_AUDIO_STATS
+  void set_audio_stats_name(const std::string &name) { this->audio_stats_ = new audio::AudioStageStats(name); }
+#endif
+
  protected:
   friend class MixerSpeaker;
   esp_err_t start_();
@@ -115,6 +120,10 @@ class SourceSpeaker : public speaker::Speaker, public Component {
   uint32_t samples_per_ducking_step_{0};
 
   uint32_t pending_playback_frames_{0};
+
+#ifdef USE_AUDIO_STATS
+  audio::AudioStageStats *audio_stats_{nullptr};
+#endif
 };
 
 class MixerSpeaker : public Component {
@@ -140,6 +149,9 @@ class MixerSpeaker : public Component {
   void set_output_speaker(speaker::Speaker *speaker) { this->output_speaker_ = speaker; }
   void set_queue_mode(bool queue_mode) { this->queue_mode_ = queue_mode; }
   void set_task_stack_in_psram(bool task_stack_in_psram) { this->task_stack_in_psram_ = task_stack_in_psram; }
+#ifdef USE_AUDIO_STATS
+  void set_audio_stats_name(const std::string &name) { this->audio_stats_ = new audio::AudioStageStats(name); }
+#endif
 
   speaker::Speaker *get_output_speaker() const { return this->output_speaker_; }
 
@@ -199,6 +211,10 @@ class MixerSpeaker : public Component {
   StackType_t *task_stack_buffer_{nullptr};
 
   optional<audio::AudioStreamInfo> audio_stream_info_;
+
+#ifdef USE_AUDIO_STATS
+  audio::AudioStageStats *audio_stats_{nullptr};
+#endif
 };
 
 }  // namespace mixer_speaker
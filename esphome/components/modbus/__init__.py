@@ -6,11 +6,26 @@ from esphome import pins
 import esphome.codegen as cg
 from esphome.components import uart
 import esphome.config_validation as cv
-from esphome.const import CONF_ADDRESS, CONF_DISABLE_CRC, CONF_FLOW_CONTROL_PIN, CONF_ID
+from esphome.const import (
+    CONF_ADDRESS,
+    CONF_DISABLE_CRC,
+    CONF_FLOW_CONTROL_PIN,
+    CONF_GATEWAY,
+    CONF_ID,
+    CONF_PORT,
+    CONF_UART_ID,
+)
+from esphome.core import CORE
 from esphome.cpp_helpers import gpio_pin_expression
 import esphome.final_validate as fv
 
-DEPENDENCIES = ["uart"]
+
+def AUTO_LOAD():
+    # Modbus TCP isn't supported with the raw lwIP TCP socket implementation
+    if CORE.is_esp8266 or CORE.is_rp2040:
+        return []
+    return ["socket"]
+
 
 modbus_ns = cg.esphome_ns.namespace("modbus")
 Modbus = modbus_ns.class_("Modbus", cg.Component, uart.UARTDevice)
@@ -20,6 +35,10 @@ MULTI_CONF = True
 CONF_ROLE = "role"
 CONF_MODBUS_ID = "modbus_id"
 CONF_SEND_WAIT_TIME = "send_wait_time"
+CONF_ADAPTIVE_SEND_WAIT = "adaptive_send_wait"
+CONF_TCP = "tcp"
+CONF_HOST = "host"
+CONF_MAX_TRANSACTIONS = "max_transactions"
 
 ModbusRole = modbus_ns.enum("ModbusRole")
 MODBUS_ROLES = {
@@ -27,29 +46,108 @@ MODBUS_ROLES = {
     "server": ModbusRole.SERVER,
 }
 
-CONFIG_SCHEMA = (
+ModbusTcpMode = modbus_ns.enum("ModbusTcpMode")
+
+
+def _validate_tcp_platform(value):
+    if CORE.is_esp8266 or CORE.is_rp2040:
+        raise cv.Invalid("Modbus TCP is not supported on this platform")
+    return value
+
+
+TCP_SCHEMA = cv.All(
     cv.Schema(
         {
-            cv.GenerateID(): cv.declare_id(Modbus),
-            cv.Optional(CONF_ROLE, default="client"): cv.enum(MODBUS_ROLES),
-            cv.Optional(CONF_FLOW_CONTROL_PIN): pins.gpio_output_pin_schema,
-            cv.Optional(
-                CONF_SEND_WAIT_TIME, default="250ms"
-            ): cv.positive_time_period_milliseconds,
-            cv.Optional(CONF_DISABLE_CRC, default=False): cv.boolean,
+            cv.Optional(CONF_HOST): cv.ipaddress,
+            cv.Optional(CONF_PORT, default=502): cv.port,
+            cv.Optional(CONF_MAX_TRANSACTIONS, default=4): cv.int_range(min=1, max=16),
         }
-    )
-    .extend(cv.COMPONENT_SCHEMA)
-    .extend(uart.UART_DEVICE_SCHEMA)
+    ),
+    _validate_tcp_platform,
+    cv.requires_component("network"),
 )
 
+GATEWAY_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_PORT, default=502): cv.port,
+        }
+    ),
+    _validate_tcp_platform,
+    cv.requires_component("network"),
+)
+
+BASE_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(Modbus),
+        cv.Optional(CONF_ROLE, default="client"): cv.enum(MODBUS_ROLES),
+        cv.Optional(CONF_FLOW_CONTROL_PIN): pins.gpio_output_pin_schema,
+        cv.Optional(
+            CONF_SEND_WAIT_TIME, default="250ms"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_ADAPTIVE_SEND_WAIT, default=False): cv.boolean,
+        cv.Optional(CONF_DISABLE_CRC, default=False): cv.boolean,
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+TCP_HUB_SCHEMA = BASE_SCHEMA.extend({cv.Required(CONF_TCP): TCP_SCHEMA})
+
+UART_HUB_SCHEMA = BASE_SCHEMA.extend(uart.UART_DEVICE_SCHEMA).extend(
+    {cv.Optional(CONF_GATEWAY): GATEWAY_SCHEMA}
+)
+
+
+def _validate_transport(config):
+    # The UART's id is generated if it isn't given, so only hubs without tcp use one
+    if CONF_TCP not in config:
+        return UART_HUB_SCHEMA(config)
+    if CONF_UART_ID in config:
+        raise cv.Invalid(f"{CONF_TCP} and {CONF_UART_ID} can't be used together")
+    config = TCP_HUB_SCHEMA(config)
+    tcp = config[CONF_TCP]
+    if config[CONF_ROLE] == "client" and CONF_HOST not in tcp:
+        raise cv.Invalid(
+            f"{CONF_HOST} is required in client role", path=[CONF_TCP, CONF_HOST]
+        )
+    if config[CONF_ROLE] == "server" and CONF_HOST in tcp:
+        raise cv.Invalid(
+            f"{CONF_HOST} can't be used in server role, the server listens on its port",
+            path=[CONF_TCP, CONF_HOST],
+        )
+    return config
+
+
+def _validate_gateway(config):
+    if CONF_GATEWAY in config and config[CONF_ROLE] != "client":
+        raise cv.Invalid(
+            f"{CONF_GATEWAY} requires the client role", path=[CONF_GATEWAY]
+        )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(_validate_transport, _validate_gateway)
+
 
 async def to_code(config):
     cg.add_global(modbus_ns.using)
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
 
-    await uart.register_uart_device(var, config)
+    if tcp := config.get(CONF_TCP):
+        cg.add_define("USE_MODBUS_TCP")
+        if CONF_HOST in tcp:
+            cg.add(var.set_tcp_mode(ModbusTcpMode.TCP_CLIENT))
+            cg.add(var.set_tcp_host(str(tcp[CONF_HOST])))
+            cg.add(var.set_max_transactions(tcp[CONF_MAX_TRANSACTIONS]))
+        else:
+            cg.add(var.set_tcp_mode(ModbusTcpMode.TCP_SERVER))
+        cg.add(var.set_tcp_port(tcp[CONF_PORT]))
+    else:
+        await uart.register_uart_device(var, config)
+        if gateway := config.get(CONF_GATEWAY):
+            cg.add_define("USE_MODBUS_TCP")
+            cg.add(var.set_tcp_mode(ModbusTcpMode.TCP_GATEWAY))
+            cg.add(var.set_tcp_port(gateway[CONF_PORT]))
 
     cg.add(var.set_role(config[CONF_ROLE]))
     if CONF_FLOW_CONTROL_PIN in config:
@@ -57,6 +155,7 @@ async def to_code(config):
         cg.add(var.set_flow_control_pin(pin))
 
     cg.add(var.set_send_wait_time(config[CONF_SEND_WAIT_TIME]))
+    cg.add(var.set_adaptive_send_wait(config[CONF_ADAPTIVE_SEND_WAIT]))
     cg.add(var.set_disable_crc(config[CONF_DISABLE_CRC]))
 
 
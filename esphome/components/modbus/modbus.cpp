@@ -8,14 +8,41 @@ namespace modbus {
 
 static const char *const TAG = "modbus";
 
+// Added to twice a device's slowest recent response time when adapting the send wait time to it
+static const uint32_t ADAPTIVE_SEND_WAIT_MARGIN = 50;
+
 void Modbus::setup() {
   if (this->flow_control_pin_ != nullptr) {
     this->flow_control_pin_->setup();
   }
+  // RTU frames are at most 256 bytes
+  this->rx_buffer_.reserve(256);
+  this->rx_data_.reserve(256);
+  this->tx_buffer_.reserve(256);
+#ifdef USE_MODBUS_TCP
+  if (this->tcp_mode_ == TCP_CLIENT) {
+    this->transactions_.reserve(this->max_transactions_);
+    this->status_set_warning();
+  } else if (this->tcp_mode_ != TCP_NONE && !this->tcp_listen_()) {
+    this->mark_failed();
+  }
+#endif
 }
 void Modbus::loop() {
   const uint32_t now = App.get_loop_component_start_time();
 
+#ifdef USE_MODBUS_TCP
+  if (this->tcp_mode_ == TCP_CLIENT) {
+    this->tcp_client_loop_(now);
+    return;
+  }
+  if (this->tcp_mode_ != TCP_NONE) {
+    this->tcp_server_loop_();
+    if (this->tcp_mode_ == TCP_SERVER)
+      return;
+  }
+#endif
+
   while (this->available()) {
     uint8_t byte;
     this->read_byte(&byte);
@@ -38,13 +65,22 @@ void Modbus::loop() {
     }
 
     // stop blocking new send commands after sent_wait_time_ ms after response received
-    if (now - this->last_send_ > send_wait_time_) {
+    if (now - this->last_send_ > this->response_timeout_(this->waiting_for_response)) {
       if (waiting_for_response > 0) {
         ESP_LOGV(TAG, "Stop waiting for response from %d", waiting_for_response);
       }
-      waiting_for_response = 0;
+#ifdef USE_MODBUS_TCP
+      if (this->gateway_waiting_)
+        this->gateway_timeout_();
+#endif
+      this->stop_waiting_(now);
     }
   }
+
+#ifdef USE_MODBUS_TCP
+  if (this->tcp_mode_ == TCP_GATEWAY)
+    this->gateway_send_next_();
+#endif
 }
 
 bool Modbus::parse_modbus_byte_(uint8_t byte) {
@@ -137,16 +173,51 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
       }
     }
   }
-  std::vector<uint8_t> data(this->rx_buffer_.begin() + data_offset, this->rx_buffer_.begin() + data_offset + data_len);
+#ifdef USE_MODBUS_TCP
+  if (this->gateway_waiting_ && address == this->waiting_for_response) {
+    this->gateway_reply_(raw, data_offset + data_len);
+    this->stop_waiting_(millis());
+    ESP_LOGV(TAG, "Clearing buffer of %d bytes - forwarded", at);
+    this->rx_buffer_.clear();
+    return true;
+  }
+#endif
+
+  const bool pending = this->waiting_for_response == address;
+  this->response_transaction_id_ = pending ? this->pending_transaction_id_ : 0;
+  const bool found = this->dispatch_frame_(raw, data_offset, data_len, pending, this->last_send_);
+  this->response_transaction_id_ = 0;
+  this->stop_waiting_(millis());
+
+  if (!found) {
+    ESP_LOGW(TAG, "Got Modbus frame from unknown address 0x%02X! ", address);
+  }
+
+  // reset buffer
+  ESP_LOGV(TAG, "Clearing buffer of %d bytes - parse succeeded", at);
+  this->rx_buffer_.clear();
+  return true;
+}
+
+bool Modbus::dispatch_frame_(const uint8_t *frame, size_t data_offset, size_t data_len, bool pending,
+                             uint32_t sent) {
+  const uint8_t address = frame[0];
+  const uint8_t function_code = frame[1];
+  std::vector<uint8_t> &data = this->rx_data_;
+  data.assign(frame + data_offset, frame + data_offset + data_len);
+  const uint32_t now = millis();
   bool found = false;
   for (auto *device : this->devices_) {
     if (device->address_ == address) {
       found = true;
+      if (pending) {
+        device->record_response_(now, now - sent);
+      }
       // Is it an error response?
       if ((function_code & 0x80) == 0x80) {
-        ESP_LOGD(TAG, "Modbus error function code: 0x%X exception: %d", function_code, raw[2]);
-        if (waiting_for_response != 0) {
-          device->on_modbus_error(function_code & 0x7F, raw[2]);
+        ESP_LOGD(TAG, "Modbus error function code: 0x%X exception: %d", function_code, frame[2]);
+        if (pending) {
+          device->on_modbus_error(function_code & 0x7F, frame[2]);
         } else {
           // Ignore modbus exception not related to a pending command
           ESP_LOGD(TAG, "Ignoring Modbus error - not expecting a response");
@@ -168,27 +239,40 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
       device->on_modbus_data(data);
     }
   }
-  waiting_for_response = 0;
-
-  if (!found) {
-    ESP_LOGW(TAG, "Got Modbus frame from unknown address 0x%02X! ", address);
-  }
-
-  // reset buffer
-  ESP_LOGV(TAG, "Clearing buffer of %d bytes - parse succeeded", at);
-  this->rx_buffer_.clear();
-  return true;
+  return found;
 }
 
 void Modbus::dump_config() {
   ESP_LOGCONFIG(TAG, "Modbus:");
   LOG_PIN("  Flow Control Pin: ", this->flow_control_pin_);
   ESP_LOGCONFIG(TAG,
-                "  Send Wait Time: %d ms\n"
+                "  Send Wait Time: %d ms%s\n"
                 "  CRC Disabled: %s",
-                this->send_wait_time_, YESNO(this->disable_crc_));
+                this->send_wait_time_, this->adaptive_send_wait_ ? " (adaptive)" : "", YESNO(this->disable_crc_));
+#ifdef USE_MODBUS_TCP
+  switch (this->tcp_mode_) {
+    case TCP_CLIENT:
+      ESP_LOGCONFIG(TAG,
+                    "  TCP Server: %s:%u\n"
+                    "  Max Transactions: %u",
+                    this->tcp_host_.c_str(), this->tcp_port_, this->max_transactions_);
+      break;
+    case TCP_SERVER:
+      ESP_LOGCONFIG(TAG, "  TCP Port: %u", this->tcp_port_);
+      break;
+    case TCP_GATEWAY:
+      ESP_LOGCONFIG(TAG, "  TCP Gateway Port: %u", this->tcp_port_);
+      break;
+    default:
+      break;
+  }
+#endif
 }
 float Modbus::get_setup_priority() const {
+#ifdef USE_MODBUS_TCP
+  if (this->tcp_mode_ != TCP_NONE)
+    return setup_priority::AFTER_WIFI;
+#endif
   // After UART bus
   return setup_priority::BUS - 1.0f;
 }
@@ -204,7 +288,8 @@ void Modbus::send(uint8_t address, uint8_t function_code, uint16_t start_address
     return;
   }
 
-  std::vector<uint8_t> data;
+  std::vector<uint8_t> &data = this->tx_buffer_;
+  data.clear();
   data.push_back(address);
   data.push_back(function_code);
   if (this->role == ModbusRole::CLIENT) {
@@ -227,20 +312,7 @@ void Modbus::send(uint8_t address, uint8_t function_code, uint16_t start_address
     }
   }
 
-  auto crc = crc16(data.data(), data.size());
-  data.push_back(crc >> 0);
-  data.push_back(crc >> 8);
-
-  if (this->flow_control_pin_ != nullptr)
-    this->flow_control_pin_->digital_write(true);
-
-  this->write_array(data);
-  this->flush();
-
-  if (this->flow_control_pin_ != nullptr)
-    this->flow_control_pin_->digital_write(false);
-  waiting_for_response = address;
-  last_send_ = millis();
+  this->write_frame_(data.data(), data.size());
   ESP_LOGV(TAG, "Modbus write: %s", format_hex_pretty(data).c_str());
 }
 
@@ -251,19 +323,185 @@ void Modbus::send_raw(const std::vector<uint8_t> &payload) {
     return;
   }
 
+  this->write_frame_(payload.data(), payload.size());
+  ESP_LOGV(TAG, "Modbus write raw: %s", format_hex_pretty(payload).c_str());
+}
+
+void Modbus::write_frame_(const uint8_t *frame, size_t len) {
+#ifdef USE_MODBUS_TCP
+  if (this->tcp_mode_ == TCP_CLIENT) {
+    // Nothing waits for a response if the frame can't be sent, so the device sends the command again later
+    this->last_transaction_id_ = 0;
+    if (!this->tcp_connected_) {
+      ESP_LOGW(TAG, "Not connected to %s, dropping frame", this->tcp_host_.c_str());
+      return;
+    }
+    const uint16_t transaction_id = this->next_transaction_id_();
+    if (!this->tcp_write_(this->tcp_connection_.socket.get(), transaction_id, frame, len))
+      return;
+    const uint32_t now = millis();
+    this->last_transaction_id_ = transaction_id;
+    this->transactions_.push_back({transaction_id, frame[0], now});
+    this->last_send_ = now;
+    this->update_tcp_waiting_();
+    return;
+  }
+  if (this->tcp_mode_ == TCP_SERVER) {
+    if (this->reply_socket_ == nullptr) {
+      ESP_LOGW(TAG, "No TCP request to respond to, dropping frame");
+      return;
+    }
+    this->tcp_write_(this->reply_socket_, this->reply_transaction_id_, frame, len);
+    return;
+  }
+#endif
+
   if (this->flow_control_pin_ != nullptr)
     this->flow_control_pin_->digital_write(true);
 
-  auto crc = crc16(payload.data(), payload.size());
-  this->write_array(payload);
+  auto crc = crc16(frame, len);
+  this->write_array(frame, len);
   this->write_byte(crc & 0xFF);
   this->write_byte((crc >> 8) & 0xFF);
   this->flush();
+
   if (this->flow_control_pin_ != nullptr)
     this->flow_control_pin_->digital_write(false);
-  waiting_for_response = payload[0];
-  ESP_LOGV(TAG, "Modbus write raw: %s", format_hex_pretty(payload).c_str());
-  last_send_ = millis();
+  this->start_waiting_(frame[0]);
+}
+
+bool Modbus::can_send(ModbusDevice *device) {
+  if (this->waiting_for_response != 0)
+    return false;
+#ifdef USE_MODBUS_TCP
+  if (this->tcp_mode_ == TCP_CLIENT && !this->tcp_connected_)
+    return false;
+  // In gateway mode the TCP clients take every other turn
+  if (!this->gateway_requests_.empty() && !this->gateway_sent_last_)
+    return false;
+#endif
+
+  // Round robin: the bus goes to the first device after the previous sender that has a command ready
+  const size_t count = this->devices_.size();
+  size_t start = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (this->devices_[i] == this->last_sender_) {
+      start = i + 1;
+      break;
+    }
+  }
+  for (size_t n = 0; n < count; n++) {
+    ModbusDevice *candidate = this->devices_[(start + n) % count];
+    if (candidate == device)
+      break;
+    if (candidate->has_command_ready())
+      return false;
+  }
+  this->last_sender_ = device;
+#ifdef USE_MODBUS_TCP
+  this->gateway_sent_last_ = false;
+#endif
+  return true;
+}
+
+float Modbus::get_bus_utilization() {
+  const uint32_t now = millis();
+  if (this->busy_) {
+    this->busy_ms_ += now - this->busy_since_;
+    this->busy_since_ = now;
+  }
+  const uint32_t interval = now - this->utilization_since_;
+  const float utilization = interval > 0 ? 100.0f * this->busy_ms_ / interval : 0.0f;
+  this->busy_ms_ = 0;
+  this->utilization_since_ = now;
+  return utilization;
+}
+
+bool Modbus::is_pending(uint16_t transaction_id) const {
+  if (transaction_id == 0)
+    return false;
+#ifdef USE_MODBUS_TCP
+  if (this->tcp_mode_ == TCP_CLIENT) {
+    for (const auto &transaction : this->transactions_) {
+      if (transaction.id == transaction_id)
+        return true;
+    }
+    return false;
+  }
+#endif
+  return this->waiting_for_response != 0 && this->pending_transaction_id_ == transaction_id;
+}
+
+uint32_t Modbus::response_timeout_(uint8_t address) const {
+  if (!this->adaptive_send_wait_)
+    return this->send_wait_time_;
+  for (auto *device : this->devices_) {
+    if (device->address_ == address && device->response_time_peak_ms_ > 0) {
+      return std::min<uint32_t>(this->send_wait_time_, 2 * device->response_time_peak_ms_ + ADAPTIVE_SEND_WAIT_MARGIN);
+    }
+  }
+  return this->send_wait_time_;
+}
+
+uint16_t Modbus::next_transaction_id_() {
+  // 0 means no transaction
+  if (++this->transaction_counter_ == 0)
+    ++this->transaction_counter_;
+  return this->transaction_counter_;
+}
+
+void Modbus::start_waiting_(uint8_t address) {
+  const uint32_t now = millis();
+  this->stop_waiting_(now);
+  this->waiting_for_response = address;
+  this->last_transaction_id_ = this->next_transaction_id_();
+  this->pending_transaction_id_ = this->last_transaction_id_;
+  this->last_send_ = now;
+  this->set_busy_(address != 0, now);
+}
+
+void Modbus::stop_waiting_(uint32_t now) {
+  if (this->waiting_for_response == 0)
+    return;
+  this->set_busy_(false, now);
+  this->waiting_for_response = 0;
+#ifdef USE_MODBUS_TCP
+  this->gateway_waiting_ = false;
+#endif
+}
+
+void Modbus::set_busy_(bool busy, uint32_t now) {
+  if (busy == this->busy_)
+    return;
+  if (busy) {
+    this->busy_since_ = now;
+  } else {
+    this->busy_ms_ += now - this->busy_since_;
+  }
+  this->busy_ = busy;
+}
+
+void ModbusDevice::record_response_(uint32_t now, uint32_t response_time) {
+  // Averages over about eight responses. The peak falls just as slowly, so a few fast responses don't shorten the
+  // adaptive send wait time below what the device needs when it is busy.
+  response_time = std::max<uint32_t>(response_time, 1);
+  if (this->response_time_ms_ == 0) {
+    this->response_time_ms_ = response_time;
+  } else {
+    this->response_time_ms_ = (this->response_time_ms_ * 7 + response_time) / 8;
+  }
+  this->response_time_peak_ms_ =
+      std::max(response_time, this->response_time_peak_ms_ - this->response_time_peak_ms_ / 8);
+
+  if (this->last_response_ != 0) {
+    const uint32_t interval = now - this->last_response_;
+    if (this->response_interval_ms_ == 0) {
+      this->response_interval_ms_ = interval;
+    } else {
+      this->response_interval_ms_ = (this->response_interval_ms_ * 7 + interval) / 8;
+    }
+  }
+  this->last_response_ = now;
 }
 
 }  // namespace modbus
@@ -3,6 +3,14 @@
 #include "esphome/core/component.h"
 #include "esphome/components/uart/uart.h"
 
+#ifdef USE_MODBUS_TCP
+#include "esphome/components/socket/socket.h"
+
+#include <list>
+#include <memory>
+#include <string>
+#endif
+
 #include <vector>
 
 namespace esphome {
@@ -13,6 +21,17 @@ enum ModbusRole {
   SERVER,
 };
 
+enum ModbusTcpMode {
+  /// Frames go over the UART only
+  TCP_NONE,
+  /// Connects to a Modbus TCP server and sends the commands there instead of to the UART
+  TCP_CLIENT,
+  /// Accepts Modbus TCP connections and passes their requests to the server devices instead of reading the UART
+  TCP_SERVER,
+  /// Accepts Modbus TCP connections and forwards their requests to the devices on the UART
+  TCP_GATEWAY,
+};
+
 class ModbusDevice;
 
 class Modbus : public uart::UARTDevice, public Component {
@@ -37,6 +56,33 @@ class Modbus : public uart::UARTDevice, public Component {
   uint8_t waiting_for_response{0};
   void set_send_wait_time(uint16_t time_in_ms) { send_wait_time_ = time_in_ms; }
   void set_disable_crc(bool disable_crc) { disable_crc_ = disable_crc; }
+  /// Stop waiting for devices that answered before after a bit more than their slowest recent response, instead of
+  /// always waiting send_wait_time.
+  void set_adaptive_send_wait(bool adaptive_send_wait) { this->adaptive_send_wait_ = adaptive_send_wait; }
+
+  /// Returns true if `device` may send a command now. Nothing may be sent while a response is pending, and devices
+  /// with a command ready take turns, so the device that comes first in the main loop doesn't get the bus every time.
+  bool can_send(ModbusDevice *device);
+
+  /// Percentage of the time since the last call the bus spent sending commands and waiting for responses
+  float get_bus_utilization();
+
+  /// Id of the last command sent. Over TCP it is the transaction id of the command, over the UART it only counts.
+  uint16_t get_last_transaction_id() const { return this->last_transaction_id_; }
+  /// Id of the command the response currently passed to the devices answers, 0 if it wasn't expected
+  uint16_t get_response_transaction_id() const { return this->response_transaction_id_; }
+  /// Returns true while the command with this id waits for its response, false once it was answered or timed out
+  bool is_pending(uint16_t transaction_id) const;
+
+#ifdef USE_MODBUS_TCP
+  void set_tcp_mode(ModbusTcpMode tcp_mode) { this->tcp_mode_ = tcp_mode; }
+  /// IP address of the Modbus TCP server to connect to in client mode
+  void set_tcp_host(const std::string &tcp_host) { this->tcp_host_ = tcp_host; }
+  /// Port to connect to in client mode, or to listen on in server and gateway mode
+  void set_tcp_port(uint16_t tcp_port) { this->tcp_port_ = tcp_port; }
+  /// How many commands may wait for their responses at the same time in client mode
+  void set_max_transactions(uint8_t max_transactions) { this->max_transactions_ = max_transactions; }
+#endif
 
   ModbusRole role;
 
@@ -44,12 +90,97 @@ class Modbus : public uart::UARTDevice, public Component {
   GPIOPin *flow_control_pin_{nullptr};
 
   bool parse_modbus_byte_(uint8_t byte);
+  /// Passes a received frame, starting with the address, to the devices with that address. `pending` tells if the
+  /// frame answers a command waiting for its response. Returns false if no device has the address.
+  bool dispatch_frame_(const uint8_t *frame, size_t data_offset, size_t data_len, bool pending, uint32_t sent);
+  /// Sends a frame starting with the address, without CRC
+  void write_frame_(const uint8_t *frame, size_t len);
+  /// How long to wait for the response of the device at `address`
+  uint32_t response_timeout_(uint8_t address) const;
+  uint16_t next_transaction_id_();
+  void start_waiting_(uint8_t address);
+  void stop_waiting_(uint32_t now);
+  void set_busy_(bool busy, uint32_t now);
+
   uint16_t send_wait_time_{250};
+  bool adaptive_send_wait_{false};
   bool disable_crc_;
+  // Buffers keep their capacity between frames, so receiving and sending doesn't allocate once they reached their
+  // largest size
   std::vector<uint8_t> rx_buffer_;
+  std::vector<uint8_t> rx_data_;
+  std::vector<uint8_t> tx_buffer_;
   uint32_t last_modbus_byte_{0};
   uint32_t last_send_{0};
   std::vector<ModbusDevice *> devices_;
+  ModbusDevice *last_sender_{nullptr};
+  uint16_t transaction_counter_{0};
+  uint16_t last_transaction_id_{0};
+  uint16_t pending_transaction_id_{0};
+  uint16_t response_transaction_id_{0};
+  bool busy_{false};
+  uint32_t busy_since_{0};
+  uint32_t busy_ms_{0};
+  uint32_t utilization_since_{0};
+
+#ifdef USE_MODBUS_TCP
+  struct TcpTransaction {
+    uint16_t id;
+    uint8_t address;
+    uint32_t sent;
+  };
+  struct TcpConnection {
+    std::unique_ptr<socket::Socket> socket;
+    std::vector<uint8_t> rx_buffer;
+  };
+  struct GatewayRequest {
+    socket::Socket *socket;
+    uint16_t transaction_id;
+    std::vector<uint8_t> frame;
+  };
+
+  bool tcp_listen_();
+  void tcp_connect_(uint32_t now);
+  void tcp_close_();
+  void tcp_client_loop_(uint32_t now);
+  void tcp_server_loop_();
+  /// Reads and handles what arrived on `connection`. Returns false if it was closed or sent something invalid.
+  bool tcp_read_(TcpConnection &connection);
+  /// Handles all complete frames in the buffer of `connection`. Returns false if it holds an invalid frame.
+  bool tcp_parse_(TcpConnection &connection);
+  void tcp_handle_request_(TcpConnection &connection, uint16_t transaction_id, const uint8_t *frame, size_t len);
+  void tcp_handle_response_(uint16_t transaction_id, const uint8_t *frame, size_t len);
+  bool tcp_write_(socket::Socket *socket, uint16_t transaction_id, const uint8_t *frame, size_t len);
+  void tcp_send_error_(socket::Socket *socket, uint16_t transaction_id, const uint8_t *request,
+                       uint8_t exception_code);
+  /// Blocks devices that don't use can_send() while all transactions are in use in client mode
+  void update_tcp_waiting_();
+  /// Forwards the next TCP request to the UART in gateway mode if it is the gateway's turn
+  void gateway_send_next_();
+  void gateway_reply_(const uint8_t *frame, size_t len);
+  /// Answers the forwarded request with an exception after its device didn't respond
+  void gateway_timeout_();
+
+  ModbusTcpMode tcp_mode_{TCP_NONE};
+  std::string tcp_host_;
+  uint16_t tcp_port_{502};
+  uint8_t max_transactions_{4};
+  /// Connection to the server in client mode
+  TcpConnection tcp_connection_;
+  bool tcp_connected_{false};
+  uint32_t tcp_connect_started_{0};
+  std::vector<TcpTransaction> transactions_;
+  /// Listening socket and accepted connections in server and gateway mode
+  std::unique_ptr<socket::Socket> tcp_socket_;
+  std::list<TcpConnection> tcp_clients_;
+  /// Where to send the response to the request the devices currently handle in server mode
+  socket::Socket *reply_socket_{nullptr};
+  uint16_t reply_transaction_id_{0};
+  /// Requests to forward to the UART in gateway mode, the front one is on the bus while gateway_waiting_ is set
+  std::list<GatewayRequest> gateway_requests_;
+  bool gateway_waiting_{false};
+  bool gateway_sent_last_{false};
+#endif
 };
 
 class ModbusDevice {
@@ -75,12 +206,25 @@ class ModbusDevice {
   }
   // If more than one device is connected block sending a new command before a response is received
   bool waiting_for_response() { return parent_->waiting_for_response != 0; }
+  /// Devices queueing commands return true while one is ready to be sent, to take their turn in Modbus::can_send()
+  virtual bool has_command_ready() { return false; }
+
+  /// Smoothed time from sending a command to receiving its response in ms, 0 before the first response
+  uint32_t get_response_time() const { return this->response_time_ms_; }
+  /// Smoothed time between two responses in ms, the effective poll period of the device
+  uint32_t get_response_interval() const { return this->response_interval_ms_; }
 
  protected:
   friend Modbus;
 
+  void record_response_(uint32_t now, uint32_t response_time);
+
   Modbus *parent_;
   uint8_t address_;
+  uint32_t response_time_ms_{0};
+  uint32_t response_time_peak_ms_{0};
+  uint32_t response_interval_ms_{0};
+  uint32_t last_response_{0};
 };
 
 }  // namespace modbus
@@ -0,0 +1,389 @@
+#include "modbus.h"
+
+#ifdef USE_MODBUS_TCP
+
+#include "esphome/components/network/util.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <cerrno>
+
+namespace esphome {
+namespace modbus {
+
+static const char *const TAG = "modbus.tcp";
+
+// Transaction id, protocol id and length of the rest of the frame, 2 bytes each
+static const size_t MBAP_HEADER_SIZE = 6;
+// Unit id and a PDU of at most 253 bytes
+static const uint16_t MAX_FRAME_SIZE = 254;
+static const uint32_t CONNECT_TIMEOUT = 5000;
+static const uint32_t RECONNECT_INTERVAL = 5000;
+static const size_t MAX_TCP_CLIENTS = 4;
+static const size_t MAX_GATEWAY_REQUESTS = 8;
+
+static const uint8_t EXCEPTION_SERVER_DEVICE_BUSY = 0x06;
+static const uint8_t EXCEPTION_GATEWAY_TARGET_FAILED_TO_RESPOND = 0x0B;
+
+// Where the data passed to the devices starts in a frame. The frame length is known over TCP, so the data is the rest
+// of the frame.
+static size_t data_offset(ModbusRole role, uint8_t function_code) {
+  // User-defined function codes pass everything after the address
+  if (((function_code >= 65) && (function_code <= 72)) || ((function_code >= 100) && (function_code <= 110)))
+    return 1;
+  // Requests, exceptions and write responses have no byte count
+  if (role == ModbusRole::SERVER || (function_code & 0x80) == 0x80 || function_code == 0x5 || function_code == 0x6 ||
+      function_code == 0xF || function_code == 0x10)
+    return 2;
+  return 3;
+}
+
+bool Modbus::tcp_listen_() {
+  this->tcp_socket_ = socket::socket_ip_loop_monitored(SOCK_STREAM, 0);
+  if (this->tcp_socket_ == nullptr) {
+    ESP_LOGW(TAG, "Could not create socket");
+    return false;
+  }
+  int enable = 1;
+  int err = this->tcp_socket_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to set reuseaddr: errno %d", err);
+    // we can still continue
+  }
+  err = this->tcp_socket_->setblocking(false);
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to set nonblocking mode: errno %d", err);
+    return false;
+  }
+
+  struct sockaddr_storage server;
+  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server), this->tcp_port_);
+  if (sl == 0) {
+    ESP_LOGW(TAG, "Socket unable to set sockaddr: errno %d", errno);
+    return false;
+  }
+  err = this->tcp_socket_->bind((struct sockaddr *) &server, sl);
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to bind: errno %d", errno);
+    return false;
+  }
+  err = this->tcp_socket_->listen(MAX_TCP_CLIENTS);
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to listen: errno %d", errno);
+    return false;
+  }
+  return true;
+}
+
+void Modbus::tcp_connect_(uint32_t now) {
+  this->tcp_connect_started_ = now;
+#if defined(USE_SOCKET_IMPL_LWIP_SOCKETS) || defined(USE_SOCKET_IMPL_BSD_SOCKETS)
+  struct sockaddr_storage server;
+  socklen_t sl = socket::set_sockaddr((struct sockaddr *) &server, sizeof(server), this->tcp_host_, this->tcp_port_);
+  if (sl == 0) {
+    ESP_LOGW(TAG, "Socket unable to set sockaddr: errno %d", errno);
+    return;
+  }
+  auto sock = socket::socket_loop_monitored(server.ss_family, SOCK_STREAM, 0);
+  if (sock == nullptr) {
+    ESP_LOGW(TAG, "Could not create socket");
+    return;
+  }
+  int enable = 1;
+  int err = sock->setsockopt(IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(int));
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket could not enable TCP nodelay, errno %d", errno);
+  }
+  err = sock->setblocking(false);
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to set nonblocking mode: errno %d", err);
+    return;
+  }
+  // Finishes in the background, tcp_client_loop_() checks when it did
+  err = sock->connect((struct sockaddr *) &server, sl);
+  if (err != 0 && errno != EINPROGRESS) {
+    ESP_LOGW(TAG, "Connecting to %s:%u failed: errno %d", this->tcp_host_.c_str(), this->tcp_port_, errno);
+    sock->close();
+    return;
+  }
+  this->tcp_connection_.socket = std::move(sock);
+  this->tcp_connection_.rx_buffer.clear();
+#else
+  ESP_LOGE(TAG, "Client mode needs the lwip_sockets or bsd_sockets socket implementation");
+#endif
+}
+
+void Modbus::tcp_close_() {
+  if (this->tcp_connection_.socket != nullptr) {
+    this->tcp_connection_.socket->close();
+    this->tcp_connection_.socket.reset();
+  }
+  this->tcp_connected_ = false;
+  this->tcp_connection_.rx_buffer.clear();
+  // The devices send the commands that were waiting for a response again after reconnecting
+  this->transactions_.clear();
+  this->update_tcp_waiting_();
+  this->status_set_warning();
+}
+
+void Modbus::tcp_client_loop_(uint32_t now) {
+  if (this->tcp_connection_.socket == nullptr) {
+    if (network::is_connected() &&
+        (this->tcp_connect_started_ == 0 || now - this->tcp_connect_started_ > RECONNECT_INTERVAL))
+      this->tcp_connect_(now);
+    return;
+  }
+
+  if (!this->tcp_connected_) {
+    struct sockaddr_storage peer;
+    socklen_t peer_len = sizeof(peer);
+    if (this->tcp_connection_.socket->getpeername((struct sockaddr *) &peer, &peer_len) != 0) {
+      if (now - this->tcp_connect_started_ > CONNECT_TIMEOUT) {
+        ESP_LOGW(TAG, "Connecting to %s:%u timed out", this->tcp_host_.c_str(), this->tcp_port_);
+        this->tcp_close_();
+      }
+      return;
+    }
+    ESP_LOGI(TAG, "Connected to %s:%u", this->tcp_host_.c_str(), this->tcp_port_);
+    this->tcp_connected_ = true;
+    this->status_clear_warning();
+  }
+
+  if (!this->tcp_read_(this->tcp_connection_)) {
+    ESP_LOGW(TAG, "Connection to %s:%u closed", this->tcp_host_.c_str(), this->tcp_port_);
+    this->tcp_close_();
+    return;
+  }
+
+  // Commands without response are forgotten after the send wait time, their devices send them again
+  for (auto it = this->transactions_.begin(); it != this->transactions_.end();) {
+    if (now - it->sent > this->response_timeout_(it->address)) {
+      ESP_LOGV(TAG, "No response to transaction %u from %d", it->id, it->address);
+      it = this->transactions_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  this->update_tcp_waiting_();
+}
+
+void Modbus::tcp_server_loop_() {
+  if (this->tcp_socket_ == nullptr)
+    return;
+
+  if (this->tcp_socket_->ready()) {
+    while (true) {
+      struct sockaddr_storage source_addr;
+      socklen_t addr_len = sizeof(source_addr);
+      auto sock = this->tcp_socket_->accept_loop_monitored((struct sockaddr *) &source_addr, &addr_len);
+      if (!sock)
+        break;
+      if (this->tcp_clients_.size() >= MAX_TCP_CLIENTS) {
+        ESP_LOGW(TAG, "Rejecting %s, too many connections", sock->getpeername().c_str());
+        sock->close();
+        continue;
+      }
+      sock->setblocking(false);
+      ESP_LOGD(TAG, "Accepted %s", sock->getpeername().c_str());
+      this->tcp_clients_.push_back(TcpConnection{std::move(sock), {}});
+    }
+  }
+
+  for (auto it = this->tcp_clients_.begin(); it != this->tcp_clients_.end();) {
+    if (this->tcp_read_(*it)) {
+      ++it;
+      continue;
+    }
+    ESP_LOGD(TAG, "Closing %s", it->socket->getpeername().c_str());
+    // The responses to the requests of the connection can't be sent anymore
+    for (auto &request : this->gateway_requests_) {
+      if (request.socket == it->socket.get())
+        request.socket = nullptr;
+    }
+    it->socket->close();
+    it = this->tcp_clients_.erase(it);
+  }
+}
+
+bool Modbus::tcp_read_(TcpConnection &connection) {
+  if (!connection.socket->ready())
+    return true;
+
+  uint8_t buf[128];
+  while (true) {
+    ssize_t len = connection.socket->read(buf, sizeof(buf));
+    if (len == 0)
+      return false;
+    if (len < 0)
+      return errno == EAGAIN || errno == EWOULDBLOCK;
+    connection.rx_buffer.insert(connection.rx_buffer.end(), buf, buf + len);
+    if (!this->tcp_parse_(connection))
+      return false;
+  }
+}
+
+bool Modbus::tcp_parse_(TcpConnection &connection) {
+  std::vector<uint8_t> &rx = connection.rx_buffer;
+  size_t start = 0;
+  bool valid = true;
+  while (rx.size() - start >= MBAP_HEADER_SIZE) {
+    const uint8_t *header = &rx[start];
+    const uint16_t transaction_id = encode_uint16(header[0], header[1]);
+    const uint16_t protocol_id = encode_uint16(header[2], header[3]);
+    const uint16_t len = encode_uint16(header[4], header[5]);
+    if (protocol_id != 0 || len < 2 || len > MAX_FRAME_SIZE) {
+      ESP_LOGW(TAG, "Invalid MBAP header %s", format_hex_pretty(header, MBAP_HEADER_SIZE).c_str());
+      valid = false;
+      break;
+    }
+    if (rx.size() - start < MBAP_HEADER_SIZE + len)
+      break;
+
+    const uint8_t *frame = header + MBAP_HEADER_SIZE;
+    ESP_LOGVV(TAG, "Modbus TCP received %u: %s", transaction_id, format_hex_pretty(frame, len).c_str());
+    if (this->tcp_mode_ == TCP_CLIENT) {
+      this->tcp_handle_response_(transaction_id, frame, len);
+    } else {
+      this->tcp_handle_request_(connection, transaction_id, frame, len);
+    }
+    start += MBAP_HEADER_SIZE + len;
+  }
+
+  if (!valid) {
+    rx.clear();
+  } else if (start > 0) {
+    rx.erase(rx.begin(), rx.begin() + start);
+  }
+  return valid;
+}
+
+void Modbus::tcp_handle_request_(TcpConnection &connection, uint16_t transaction_id, const uint8_t *frame,
+                                 size_t len) {
+  if (this->tcp_mode_ == TCP_GATEWAY) {
+    if (this->gateway_requests_.size() >= MAX_GATEWAY_REQUESTS) {
+      ESP_LOGW(TAG, "Too many requests to forward, rejecting transaction %u", transaction_id);
+      this->tcp_send_error_(connection.socket.get(), transaction_id, frame, EXCEPTION_SERVER_DEVICE_BUSY);
+      return;
+    }
+    this->gateway_requests_.push_back(
+        GatewayRequest{connection.socket.get(), transaction_id, std::vector<uint8_t>(frame, frame + len)});
+    return;
+  }
+
+  const size_t offset = data_offset(this->role, frame[1]);
+  if (len < offset)
+    return;
+  // The devices respond from their callbacks, which send to the connection of the request
+  this->reply_socket_ = connection.socket.get();
+  this->reply_transaction_id_ = transaction_id;
+  const bool found = this->dispatch_frame_(frame, offset, len - offset, false, 0);
+  this->reply_socket_ = nullptr;
+  if (!found) {
+    ESP_LOGW(TAG, "Got Modbus TCP request for unknown address 0x%02X", frame[0]);
+    this->tcp_send_error_(connection.socket.get(), transaction_id, frame, EXCEPTION_GATEWAY_TARGET_FAILED_TO_RESPOND);
+  }
+}
+
+void Modbus::tcp_handle_response_(uint16_t transaction_id, const uint8_t *frame, size_t len) {
+  auto it = std::find_if(this->transactions_.begin(), this->transactions_.end(),
+                         [transaction_id](const TcpTransaction &t) { return t.id == transaction_id; });
+  if (it == this->transactions_.end()) {
+    ESP_LOGD(TAG, "Ignoring response to transaction %u - not expecting a response", transaction_id);
+    return;
+  }
+  const bool pending = it->address == frame[0];
+  const uint32_t sent = it->sent;
+  this->transactions_.erase(it);
+
+  const size_t offset = data_offset(this->role, frame[1]);
+  if (len >= offset) {
+    this->response_transaction_id_ = transaction_id;
+    if (!this->dispatch_frame_(frame, offset, len - offset, pending, sent)) {
+      ESP_LOGW(TAG, "Got Modbus frame from unknown address 0x%02X! ", frame[0]);
+    }
+    this->response_transaction_id_ = 0;
+  }
+  this->update_tcp_waiting_();
+}
+
+bool Modbus::tcp_write_(socket::Socket *socket, uint16_t transaction_id, const uint8_t *frame, size_t len) {
+  uint8_t header[MBAP_HEADER_SIZE] = {
+      uint8_t(transaction_id >> 8), uint8_t(transaction_id), 0, 0, uint8_t(len >> 8), uint8_t(len),
+  };
+  struct iovec iov[2];
+  iov[0].iov_base = header;
+  iov[0].iov_len = sizeof(header);
+  iov[1].iov_base = const_cast<uint8_t *>(frame);
+  iov[1].iov_len = len;
+  ssize_t sent = socket->writev(iov, 2);
+  if (sent != static_cast<ssize_t>(sizeof(header) + len)) {
+    ESP_LOGW(TAG, "Sending transaction %u failed: errno %d", transaction_id, errno);
+    // Reading fails from now on, which closes the connection
+    socket->shutdown(SHUT_RDWR);
+    return false;
+  }
+  ESP_LOGVV(TAG, "Modbus TCP write %u: %s", transaction_id, format_hex_pretty(frame, len).c_str());
+  return true;
+}
+
+void Modbus::tcp_send_error_(socket::Socket *socket, uint16_t transaction_id, const uint8_t *request,
+                             uint8_t exception_code) {
+  const uint8_t error[3] = {request[0], uint8_t(request[1] | 0x80), exception_code};
+  this->tcp_write_(socket, transaction_id, error, sizeof(error));
+}
+
+void Modbus::update_tcp_waiting_() {
+  const bool full = this->transactions_.size() >= this->max_transactions_;
+  this->waiting_for_response = full ? this->transactions_.back().address : 0;
+  this->set_busy_(!this->transactions_.empty(), millis());
+}
+
+void Modbus::gateway_send_next_() {
+  if (this->gateway_waiting_ || this->waiting_for_response != 0)
+    return;
+  while (!this->gateway_requests_.empty() && this->gateway_requests_.front().socket == nullptr) {
+    this->gateway_requests_.pop_front();
+  }
+  if (this->gateway_requests_.empty())
+    return;
+
+  // The TCP clients and the devices take turns
+  if (this->gateway_sent_last_) {
+    for (auto *device : this->devices_) {
+      if (device->has_command_ready())
+        return;
+    }
+  }
+
+  const GatewayRequest &request = this->gateway_requests_.front();
+  ESP_LOGV(TAG, "Forwarding transaction %u to %d", request.transaction_id, request.frame[0]);
+  this->write_frame_(request.frame.data(), request.frame.size());
+  this->gateway_sent_last_ = true;
+  if (request.frame[0] == 0) {
+    // Nothing answers broadcasts
+    this->gateway_requests_.pop_front();
+  } else {
+    this->gateway_waiting_ = true;
+  }
+}
+
+void Modbus::gateway_reply_(const uint8_t *frame, size_t len) {
+  const GatewayRequest &request = this->gateway_requests_.front();
+  if (request.socket != nullptr)
+    this->tcp_write_(request.socket, request.transaction_id, frame, len);
+  this->gateway_requests_.pop_front();
+  this->gateway_waiting_ = false;
+}
+
+void Modbus::gateway_timeout_() {
+  const GatewayRequest &request = this->gateway_requests_.front();
+  ESP_LOGD(TAG, "No response to forwarded transaction %u from %d", request.transaction_id, request.frame[0]);
+  const uint8_t error[3] = {request.frame[0], uint8_t(request.frame[1] | 0x80),
+                            EXCEPTION_GATEWAY_TARGET_FAILED_TO_RESPOND};
+  this->gateway_reply_(error, sizeof(error));
+}
+
+}  // namespace modbus
+}  // namespace esphome
+
+#endif
@@ -41,6 +41,8 @@ AUTO_LOAD = ["modbus"]
 CONF_READ_LAMBDA = "read_lambda"
 CONF_WRITE_LAMBDA = "write_lambda"
 CONF_SERVER_REGISTERS = "server_registers"
+CONF_MAX_REGISTER_GAP = "max_register_gap"
+CONF_MAX_REGISTERS_PER_READ = "max_registers_per_read"
 MULTI_CONF = True
 
 modbus_controller_ns = cg.esphome_ns.namespace("modbus_controller")
@@ -164,6 +166,11 @@ CONFIG_SCHEMA = cv.All(
             ): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_MAX_CMD_RETRIES, default=4): cv.positive_int,
             cv.Optional(CONF_OFFLINE_SKIP_UPDATES, default=0): cv.positive_int,
+            # A register costs 2 response bytes, a request about 13 bytes and a turnaround
+            cv.Optional(CONF_MAX_REGISTER_GAP, default=0): cv.int_range(min=0, max=124),
+            cv.Optional(CONF_MAX_REGISTERS_PER_READ, default=125): cv.int_range(
+                min=1, max=125
+            ),
             cv.Optional(
                 CONF_SERVER_REGISTERS,
             ): cv.ensure_list(ModbusServerRegisterSchema),
@@ -301,6 +308,8 @@ async def to_code(config):
     cg.add(var.set_command_throttle(config[CONF_COMMAND_THROTTLE]))
     cg.add(var.set_max_cmd_retries(config[CONF_MAX_CMD_RETRIES]))
     cg.add(var.set_offline_skip_updates(config[CONF_OFFLINE_SKIP_UPDATES]))
+    cg.add(var.set_max_register_gap(config[CONF_MAX_REGISTER_GAP]))
+    cg.add(var.set_max_registers_per_read(config[CONF_MAX_REGISTERS_PER_READ]))
     if CONF_SERVER_REGISTERS in config:
         for server_register in config[CONF_SERVER_REGISTERS]:
             server_register_var = cg.new_Pvariable(
@@ -13,12 +13,15 @@ void ModbusController::setup() { this->create_register_ranges_(); }
  To work with the existing modbus class and avoid polling for responses a command queue is used.
  send_next_command will submit the command at the top of the queue and set the corresponding callback
  to handle the response from the device.
+ The sent command waits in the sent queue until its response arrives, or goes back to the top of the command queue
+ to be sent again if the modbus hub stopped waiting for the response.
  Once the response has been processed it is removed from the queue and the next command is sent
 */
 bool ModbusController::send_next_command_() {
+  this->retry_sent_commands_();
   uint32_t last_send = millis() - this->last_command_timestamp_;
 
-  if ((last_send > this->command_throttle_) && !waiting_for_response() && !this->command_queue_.empty()) {
+  if ((last_send > this->command_throttle_) && !this->command_queue_.empty() && this->parent_->can_send(this)) {
     auto &command = this->command_queue_.front();
 
     // remove from queue if command was sent too often
@@ -38,7 +41,7 @@ bool ModbusController::send_next_command_() {
       }
       ESP_LOGD(TAG, "Modbus command to device=%d register=0x%02X no response received - removed from send queue",
                this->address_, command->register_address);
-      this->command_queue_.pop_front();
+      this->recycle_command_(this->command_queue_);
     } else {
       ESP_LOGV(TAG, "Sending next modbus command to device %d register 0x%02X count %d", this->address_,
                command->register_address, command->register_count);
@@ -50,16 +53,48 @@ bool ModbusController::send_next_command_() {
 
       // remove from queue if no handler is defined
       if (!command->on_data_func) {
-        this->command_queue_.pop_front();
+        this->recycle_command_(this->command_queue_);
+      } else {
+        command->transaction_id = this->parent_->get_last_transaction_id();
+        this->sent_queue_.splice(this->sent_queue_.end(), this->command_queue_, this->command_queue_.begin());
       }
     }
   }
   return (!this->command_queue_.empty());
 }
 
+void ModbusController::retry_sent_commands_() {
+  // From the back, so the commands keep their order at the top of the command queue
+  for (auto it = this->sent_queue_.end(); it != this->sent_queue_.begin();) {
+    auto prev = std::prev(it);
+    if (!this->parent_->is_pending((*prev)->transaction_id)) {
+      this->command_queue_.splice(this->command_queue_.begin(), this->sent_queue_, prev);
+    } else {
+      it = prev;
+    }
+  }
+}
+
+ModbusCommandItem *ModbusController::take_sent_command_(std::list<std::unique_ptr<ModbusCommandItem>> &queue) {
+  const uint16_t transaction_id = this->parent_->get_response_transaction_id();
+  for (auto it = this->sent_queue_.begin(); transaction_id != 0 && it != this->sent_queue_.end(); ++it) {
+    if ((*it)->transaction_id == transaction_id) {
+      queue.splice(queue.end(), this->sent_queue_, it);
+      return queue.back().get();
+    }
+  }
+  ESP_LOGD(TAG, "Modbus response from device=%d doesn't belong to a sent command - ignored", this->address_);
+  return nullptr;
+}
+
+bool ModbusController::has_command_ready() {
+  return !this->command_queue_.empty() && this->incoming_queue_.empty() &&
+         (millis() - this->last_command_timestamp_ > this->command_throttle_);
+}
+
 // Queue incoming response
 void ModbusController::on_modbus_data(const std::vector<uint8_t> &data) {
-  auto &current_command = this->command_queue_.front();
+  ModbusCommandItem *current_command = this->take_sent_command_(this->incoming_queue_);
   if (current_command != nullptr) {
     if (this->module_offline_) {
       ESP_LOGW(TAG, "Modbus device=%d back online", this->address_);
@@ -75,11 +110,9 @@ void ModbusController::on_modbus_data(const std::vector<uint8_t> &data) {
       this->online_callback_.call((int) current_command->function_code, current_command->register_address);
     }
 
-    // Move the commandItem to the response queue
+    // The commandItem is in the response queue now
     current_command->payload = data;
-    this->incoming_queue_.push(std::move(current_command));
     ESP_LOGV(TAG, "Modbus response queued");
-    this->command_queue_.pop_front();
   }
 }
 
@@ -93,7 +126,7 @@ void ModbusController::process_modbus_data_(const ModbusCommandItem *response) {
 void ModbusController::on_modbus_error(uint8_t function_code, uint8_t exception_code) {
   ESP_LOGE(TAG, "Modbus error function code: 0x%X exception: %d ", function_code, exception_code);
   // Remove pending command waiting for a response
-  auto &current_command = this->command_queue_.front();
+  ModbusCommandItem *current_command = this->take_sent_command_(this->free_commands_);
   if (current_command != nullptr) {
     ESP_LOGE(TAG,
              "Modbus error - last command: function code=0x%X  register address = 0x%X  "
@@ -101,7 +134,20 @@ void ModbusController::on_modbus_error(uint8_t function_code, uint8_t exception_
              "payload size=%zu",
              function_code, current_command->register_address, current_command->register_count,
              current_command->payload.size());
-    this->command_queue_.pop_front();
+
+    // Illegal data address or value: the device doesn't allow reading the unused registers of a bridged range
+    if (exception_code == 2 || exception_code == 3) {
+      for (auto &r : this->register_ranges_) {
+        if (r.parts.size() > 1 && !r.read_parts && r.register_type == current_command->register_type &&
+            r.start_address == current_command->register_address &&
+            r.register_count == current_command->register_count) {
+          ESP_LOGW(TAG, "Device=%d rejected reading 0x%X-0x%X, reading its %zu parts separately from now on",
+                   this->address_, r.start_address, r.start_address + r.register_count - 1, r.parts.size());
+          r.read_parts = true;
+          break;
+        }
+      }
+    }
   }
 }
 
@@ -232,7 +278,8 @@ void ModbusController::on_modbus_write_registers(uint8_t function_code, const st
   this->send_raw(response);
 }
 
-SensorSet ModbusController::find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const {
+const SensorSet &ModbusController::find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const {
+  static const SensorSet NO_SENSORS;
   auto reg_it = std::find_if(
       std::begin(this->register_ranges_), std::end(this->register_ranges_),
       [=](RegisterRange const &r) { return (r.start_address == start_address && r.register_type == register_type); });
@@ -244,14 +291,14 @@ SensorSet ModbusController::find_sensors_(ModbusRegisterType register_type, uint
   }
 
   // not found
-  return {};
+  return NO_SENSORS;
 }
 void ModbusController::on_register_data(ModbusRegisterType register_type, uint16_t start_address,
                                         const std::vector<uint8_t> &data) {
   ESP_LOGV(TAG, "data for register address : 0x%X : ", start_address);
 
   // loop through all sensors with the same start address
-  auto sensors = find_sensors_(register_type, start_address);
+  const auto &sensors = find_sensors_(register_type, start_address);
   for (auto *sensor : sensors) {
     sensor->parse_and_publish(data);
   }
@@ -259,20 +306,27 @@ void ModbusController::on_register_data(ModbusRegisterType register_type, uint16
 
 void ModbusController::queue_command(const ModbusCommandItem &command) {
   if (!this->allow_duplicate_commands_) {
-    // check if this command is already qeued.
-    // not very effective but the queue is never really large
-    for (auto &item : this->command_queue_) {
-      if (item->is_equal(command)) {
-        ESP_LOGW(TAG, "Duplicate modbus command found: type=0x%x address=%u count=%u",
-                 static_cast<uint8_t>(command.register_type), command.register_address, command.register_count);
-        // update the payload of the queued command
-        // replaces a previous command
-        item->payload = command.payload;
-        return;
+    // check if this command is already qeued or waiting for its response.
+    // not very effective but the queues are never really large
+    for (auto *queue : {&this->command_queue_, &this->sent_queue_}) {
+      for (auto &item : *queue) {
+        if (item->is_equal(command)) {
+          ESP_LOGW(TAG, "Duplicate modbus command found: type=0x%x address=%u count=%u",
+                   static_cast<uint8_t>(command.register_type), command.register_address, command.register_count);
+          // update the payload of the queued command
+          // replaces a previous command
+          item->payload = command.payload;
+          return;
+        }
       }
     }
   }
-  this->command_queue_.push_back(make_unique<ModbusCommandItem>(command));
+  if (this->free_commands_.empty()) {
+    this->command_queue_.push_back(make_unique<ModbusCommandItem>(command));
+  } else {
+    this->command_queue_.splice(this->command_queue_.end(), this->free_commands_, this->free_commands_.begin());
+    *this->command_queue_.back() = command;
+  }
 }
 
 void ModbusController::update_range_(RegisterRange &r) {
@@ -281,7 +335,7 @@ void ModbusController::update_range_(RegisterRange &r) {
   if (r.skip_updates_counter == 0) {
     // if a custom command is used the user supplied custom_data is only available in the SensorItem.
     if (r.register_type == ModbusRegisterType::CUSTOM) {
-      auto sensors = this->find_sensors_(r.register_type, r.start_address);
+      const auto &sensors = this->find_sensors_(r.register_type, r.start_address);
       if (!sensors.empty()) {
         auto sensor = sensors.cbegin();
         auto command_item = ModbusCommandItem::create_custom_command(
@@ -294,6 +348,8 @@ void ModbusController::update_range_(RegisterRange &r) {
         command_item.function_code = ModbusFunctionCode::CUSTOM;
         queue_command(command_item);
       }
+    } else if (r.read_parts) {
+      this->update_range_parts_(r);
     } else {
       queue_command(ModbusCommandItem::create_read_command(this, r.register_type, r.start_address, r.register_count));
     }
@@ -302,6 +358,27 @@ void ModbusController::update_range_(RegisterRange &r) {
     r.skip_updates_counter--;
   }
 }
+
+void ModbusController::update_range_parts_(RegisterRange &r) {
+  r.parts_data.assign(r.register_count * 2, 0);
+  r.parts_received = 0;
+  for (size_t i = 0; i < r.parts.size(); i++) {
+    const RegisterRangePart part = r.parts[i];
+    const bool last = i + 1 == r.parts.size();
+    queue_command(ModbusCommandItem::create_read_command(
+        this, r.register_type, r.start_address + part.offset, part.register_count,
+        [this, &r, part, last](ModbusRegisterType register_type, uint16_t start_address,
+                               const std::vector<uint8_t> &data) {
+          const size_t offset = part.offset * 2;
+          std::copy_n(data.begin(), std::min(data.size(), r.parts_data.size() - offset), r.parts_data.begin() + offset);
+          r.parts_received++;
+          // A part whose read failed would leave zeros in the data, so it's only passed on if all parts arrived
+          if (last && r.parts_received == r.parts.size())
+            this->on_register_data(r.register_type, r.start_address, r.parts_data);
+        }));
+  }
+}
+
 //
 // Queue the modbus requests to be send.
 // Once we get a response to the command it is removed from the queue and the next command is send
@@ -346,6 +423,7 @@ size_t ModbusController::create_register_ranges_() {
       r.sensors.insert(curr);
       r.skip_updates = curr->skip_updates;
       r.skip_updates_counter = 0;
+      r.parts.push_back({0, static_cast<uint8_t>(curr->register_count)});
       buffer_offset = curr->get_register_size();
 
       ESP_LOGV(TAG, "Started new range");
@@ -354,6 +432,11 @@ size_t ModbusController::create_register_ranges_() {
       // to reuse the last register or extend the current range
       if (!curr->force_new_range && r.register_type == curr->register_type &&
           curr->register_type != ModbusRegisterType::CUSTOM) {
+        const bool is_register =
+            r.register_type == ModbusRegisterType::HOLDING || r.register_type == ModbusRegisterType::READ;
+        const uint16_t range_end = r.start_address + r.register_count;
+        const bool fits = !is_register || (curr->start_address + curr->register_count - r.start_address <=
+                                            this->max_registers_per_read_);
         if (curr->start_address == (r.start_address + r.register_count - prev->register_count) &&
             curr->register_count == prev->register_count && curr->get_register_size() == prev->get_register_size()) {
           // this register can re-use the data from the previous register
@@ -370,7 +453,7 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Re-use previous register - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
-        } else if (curr->start_address == (r.start_address + r.register_count)) {
+        } else if (curr->start_address == range_end && fits) {
           // this register can extend the current range
 
           // remove this sensore because start_address is changed (sort-order)
@@ -380,6 +463,7 @@ size_t ModbusController::create_register_ranges_() {
           curr->offset += buffer_offset;
           buffer_offset += curr->get_register_size();
           r.register_count += curr->register_count;
+          r.parts.back().register_count += curr->register_count;
 
           this->sensorset_.insert(curr);
           // move iterator backwards because it will be incremented later
@@ -387,6 +471,29 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Extend range - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
+        } else if (is_register && fits && curr->start_address > range_end &&
+                   curr->start_address - range_end <= this->max_register_gap_ &&
+                   curr->skip_updates == prev->skip_updates && buffer_offset == r.register_count * 2 &&
+                   curr->get_register_size() == curr->register_count * 2u) {
+          // reading the unused registers up to this register costs less than another request
+          const uint16_t gap = curr->start_address - range_end;
+
+          // remove this sensore because start_address is changed (sort-order)
+          ix = this->sensorset_.erase(ix);
+
+          const uint16_t part_offset = curr->start_address - r.start_address;
+          r.parts.push_back({part_offset, static_cast<uint8_t>(curr->register_count)});
+          curr->start_address = r.start_address;
+          curr->offset += buffer_offset + gap * 2;
+          buffer_offset += gap * 2 + curr->get_register_size();
+          r.register_count += gap + curr->register_count;
+
+          this->sensorset_.insert(curr);
+          // move iterator backwards because it will be incremented later
+          ix--;
+
+          ESP_LOGV(TAG, "Bridge gap of %u registers - change to register: 0x%X %d offset=%u", gap,
+                   curr->start_address, curr->register_count, curr->offset);
         }
       }
     }
@@ -431,8 +538,16 @@ void ModbusController::dump_config() {
                 "ModbusController:\n"
                 "  Address: 0x%02X\n"
                 "  Max Command Retries: %d\n"
-                "  Offline Skip Updates: %d",
-                this->address_, this->max_cmd_retries_, this->offline_skip_updates_);
+                "  Offline Skip Updates: %d\n"
+                "  Max Register Gap: %u\n"
+                "  Max Registers Per Read: %u\n"
+                "  Read Requests: %zu",
+                this->address_, this->max_cmd_retries_, this->offline_skip_updates_, this->max_register_gap_,
+                this->max_registers_per_read_, this->register_ranges_.size());
+  for (auto &r : this->register_ranges_) {
+    ESP_LOGCONFIG(TAG, "    Type %u: 0x%X-0x%X, %zu sensors, %zu parts", static_cast<uint8_t>(r.register_type),
+                  r.start_address, r.start_address + r.register_count - 1, r.sensors.size(), r.parts.size());
+  }
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
   ESP_LOGCONFIG(TAG, "sensormap");
   for (auto &it : this->sensorset_) {
@@ -459,7 +574,7 @@ void ModbusController::loop() {
     auto &message = this->incoming_queue_.front();
     if (message != nullptr)
       this->process_modbus_data_(message.get());
-    this->incoming_queue_.pop();
+    this->recycle_command_(this->incoming_queue_);
 
   } else {
     // all messages processed send pending commands
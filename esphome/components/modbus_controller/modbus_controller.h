@@ -6,7 +6,6 @@
 #include "esphome/core/automation.h"
 
 #include <list>
-#include <queue>
 #include <set>
 #include <utility>
 #include <vector>
@@ -352,6 +351,12 @@ class SensorItemsComparator {
 
 using SensorSet = std::set<SensorItem *, SensorItemsComparator>;
 
+// Registers without gaps within a register range
+struct RegisterRangePart {
+  uint16_t offset;  // in registers from the start of the range
+  uint8_t register_count;
+};
+
 struct RegisterRange {
   uint16_t start_address;
   ModbusRegisterType register_type;
@@ -359,6 +364,12 @@ struct RegisterRange {
   uint16_t skip_updates;          // the config value
   SensorSet sensors;              // all sensors of this range
   uint16_t skip_updates_counter;  // the running value
+  // More than one if gaps between registers were bridged to read them in one request
+  std::vector<RegisterRangePart> parts;
+  // The device rejected reading the gaps, so the parts are read one by one and assembled in parts_data
+  bool read_parts;
+  std::vector<uint8_t> parts_data;
+  uint8_t parts_received;
 };
 
 class ModbusCommandItem {
@@ -372,6 +383,8 @@ class ModbusCommandItem {
   std::function<void(ModbusRegisterType register_type, uint16_t start_address, const std::vector<uint8_t> &data)>
       on_data_func;
   std::vector<uint8_t> payload = {};
+  /// Id the modbus hub gave the command when it was last sent, matches the response to it
+  uint16_t transaction_id{0};
   bool send();
   /// Check if the command should be retried based on the max_retries parameter
   bool should_retry(uint8_t max_retries) { return this->send_count_ <= max_retries; };
@@ -496,6 +509,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void on_modbus_data(const std::vector<uint8_t> &data) override;
   /// called when a modbus error response was received
   void on_modbus_error(uint8_t function_code, uint8_t exception_code) override;
+  /// true while a queued command can be sent, so other controllers on the bus leave it its turn
+  bool has_command_ready() override;
   /// called when a modbus request (function code 0x03 or 0x04) was parsed without errors
   void on_modbus_read_registers(uint8_t function_code, uint16_t start_address, uint16_t number_of_registers) final;
   /// called when a modbus request (function code 0x06 or 0x10) was parsed without errors
@@ -516,6 +531,12 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void set_command_throttle(uint16_t command_throttle) { this->command_throttle_ = command_throttle; }
   /// called by esphome generated code to set the offline_skip_updates
   void set_offline_skip_updates(uint16_t offline_skip_updates) { this->offline_skip_updates_ = offline_skip_updates; }
+  /// called by esphome generated code to read registers separated by up to this many unused registers in one request
+  void set_max_register_gap(uint8_t max_register_gap) { this->max_register_gap_ = max_register_gap; }
+  /// called by esphome generated code to limit how many registers are read in one request
+  void set_max_registers_per_read(uint8_t max_registers_per_read) {
+    this->max_registers_per_read_ = max_registers_per_read;
+  }
   /// get the number of queued modbus commands (should be mostly empty)
   size_t get_command_queue_length() { return command_queue_.size(); }
   /// get if the module is offline, didn't respond the last command
@@ -534,10 +555,20 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
  protected:
   /// parse sensormap_ and create range of sequential addresses
   size_t create_register_ranges_();
-  // find register in sensormap. Returns iterator with all registers having the same start address
-  SensorSet find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const;
+  // find register in sensormap. Returns all registers having the same start address
+  const SensorSet &find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const;
+  /// moves the first command of `queue` to the free commands
+  void recycle_command_(std::list<std::unique_ptr<ModbusCommandItem>> &queue) {
+    this->free_commands_.splice(this->free_commands_.end(), queue, queue.begin());
+  }
+  /// moves the sent command the current response answers to `queue`, returns nullptr if there is none
+  ModbusCommandItem *take_sent_command_(std::list<std::unique_ptr<ModbusCommandItem>> &queue);
+  /// moves sent commands whose response didn't arrive back to the send queue to retry them
+  void retry_sent_commands_();
   /// submit the read command for the address range to the send queue
   void update_range_(RegisterRange &r);
+  /// submit a read command for each part of the range, and pass the assembled data on once all parts arrived
+  void update_range_parts_(RegisterRange &r);
   /// parse incoming modbus data
   void process_modbus_data_(const ModbusCommandItem *response);
   /// send the next modbus command from the send queue
@@ -552,8 +583,13 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   std::vector<RegisterRange> register_ranges_{};
   /// Hold the pending requests to be sent
   std::list<std::unique_ptr<ModbusCommandItem>> command_queue_;
+  /// Sent commands waiting for their response. Over TCP more than one can wait at the same time.
+  std::list<std::unique_ptr<ModbusCommandItem>> sent_queue_;
   /// modbus response data waiting to get processed
-  std::queue<std::unique_ptr<ModbusCommandItem>> incoming_queue_;
+  std::list<std::unique_ptr<ModbusCommandItem>> incoming_queue_;
+  /// Commands that were sent or processed, reused with their list nodes and payload buffers so polling doesn't
+  /// allocate
+  std::list<std::unique_ptr<ModbusCommandItem>> free_commands_;
   /// if duplicate commands can be sent
   bool allow_duplicate_commands_{false};
   /// when was the last send operation
@@ -564,6 +600,10 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   bool module_offline_{false};
   /// how many updates to skip if module is offline
   uint16_t offline_skip_updates_{0};
+  /// unused registers allowed between two registers in one read request
+  uint8_t max_register_gap_{0};
+  /// registers allowed in one read request
+  uint8_t max_registers_per_read_{125};
   /// How many times we will retry a command if we get no response
   uint8_t max_cmd_retries_{4};
   /// Command sent callback
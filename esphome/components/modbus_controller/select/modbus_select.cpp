@@ -26,13 +26,14 @@ void ModbusSelect::parse_and_publish(const std::vector<uint8_t> &data) {
   if (!new_state.has_value()) {
     auto map_it = std::find(this->mapping_.cbegin(), this->mapping_.cend(), value);
 
-    if (map_it != this->mapping_.cend()) {
-      size_t idx = std::distance(this->mapping_.cbegin(), map_it);
-      new_state = this->traits.get_options()[idx];
-      ESP_LOGV(TAG, "Found option %s for value %lld", new_state->c_str(), value);
-    } else {
+    if (map_it == this->mapping_.cend()) {
       ESP_LOGE(TAG, "No option found for mapping %lld", value);
+      return;
     }
+    size_t idx = std::distance(this->mapping_.cbegin(), map_it);
+    ESP_LOGV(TAG, "Found option %zu for value %lld", idx, value);
+    this->publish_state(idx);
+    return;
   }
 
   if (new_state.has_value()) {
@@ -41,7 +42,7 @@ void ModbusSelect::parse_and_publish(const std::vector<uint8_t> &data) {
 }
 
 void ModbusSelect::control(const std::string &value) {
-  auto options = this->traits.get_options();
+  const auto &options = this->traits.get_options();
   auto opt_it = std::find(options.cbegin(), options.cend(), value);
   size_t idx = std::distance(options.cbegin(), opt_it);
   optional<int64_t> mapval = this->mapping_[idx];
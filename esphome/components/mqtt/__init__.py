@@ -1,6 +1,7 @@
+import hashlib
 import re
 
-from esphome import automation
+from esphome import automation, yaml_util
 from esphome.automation import Condition
 import esphome.codegen as cg
 from esphome.components import logger
@@ -56,6 +57,7 @@ from esphome.const import (
     PLATFORM_ESP32,
     PLATFORM_ESP8266,
     PlatformFramework,
+    __version__,
 )
 from esphome.core import CORE, coroutine_with_priority
 
@@ -69,6 +71,8 @@ def AUTO_LOAD():
 
 
 CONF_DISCOVER_IP = "discover_ip"
+CONF_DISCOVERY_SKIP_UNCHANGED = "discovery_skip_unchanged"
+CONF_DISCOVERY_WINDOW = "discovery_window"
 CONF_IDF_SEND_ASYNC = "idf_send_async"
 CONF_WAIT_FOR_CONNECTION = "wait_for_connection"
 
@@ -191,6 +195,13 @@ def validate_config(value):
             }
         else:
             out[CONF_SHUTDOWN_MESSAGE] = {}
+    if value[CONF_DISCOVERY_SKIP_UNCHANGED] and (
+        value[CONF_DISCOVERY] is not True or not value[CONF_DISCOVERY_RETAIN]
+    ):
+        raise cv.Invalid(
+            f"'{CONF_DISCOVERY_SKIP_UNCHANGED}' requires '{CONF_DISCOVERY}: true' "
+            f"and '{CONF_DISCOVERY_RETAIN}: true'"
+        )
     if CONF_LOG_TOPIC not in value:
         if topic_prefix != "":
             out[CONF_LOG_TOPIC] = {
@@ -241,6 +252,8 @@ CONFIG_SCHEMA = cv.All(
             ),
             cv.Optional(CONF_DISCOVERY_RETAIN, default=True): cv.boolean,
             cv.Optional(CONF_DISCOVER_IP, default=True): cv.boolean,
+            cv.Optional(CONF_DISCOVERY_WINDOW, default=0): cv.int_range(min=0, max=255),
+            cv.Optional(CONF_DISCOVERY_SKIP_UNCHANGED, default=False): cv.boolean,
             cv.Optional(
                 CONF_DISCOVERY_PREFIX, default="homeassistant"
             ): cv.publish_topic,
@@ -379,6 +392,14 @@ async def to_code(config):
 
     cg.add(var.set_topic_prefix(config[CONF_TOPIC_PREFIX], CORE.name))
 
+    if config[CONF_DISCOVERY_WINDOW] > 0:
+        cg.add(var.set_discovery_window(config[CONF_DISCOVERY_WINDOW]))
+    if config[CONF_DISCOVERY_SKIP_UNCHANGED]:
+        # Retained discovery messages only need to be sent again when the config changes
+        config_dump = yaml_util.dump(CORE.config, show_secrets=True) + __version__
+        config_hash = hashlib.sha256(config_dump.encode()).hexdigest()[:8]
+        cg.add(var.set_discovery_hash(int(config_hash, 16)))
+
     if config[CONF_USE_ABBREVIATIONS]:
         cg.add_define("USE_MQTT_ABBREVIATIONS")
 
@@ -63,6 +63,9 @@ class MQTTBackend {
                    message.retain);
   }
 
+  /// Number of publishes accepted but not handed to the network yet.
+  virtual size_t get_publish_backlog() const { return 0; }
+
   // called from MQTTClient::loop()
   virtual void loop() {}
 };
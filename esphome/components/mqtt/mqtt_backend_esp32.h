@@ -205,6 +205,10 @@ class MQTTBackendESP32 final : public MQTTBackend {
   }
   using MQTTBackend::publish;
 
+#if defined(USE_MQTT_IDF_ENQUEUE)
+  size_t get_publish_backlog() const final { return this->mqtt_queue_.size(); }
+#endif
+
   void loop() final;
 
   void set_ca_certificate(const std::string &cert) { ca_certificate_ = cert; }
@@ -2,6 +2,8 @@
 
 #ifdef USE_MQTT
 
+#include <algorithm>
+#include <cinttypes>
 #include <utility>
 #include "esphome/components/network/util.h"
 #include "esphome/core/application.h"
@@ -27,6 +29,9 @@ namespace mqtt {
 
 static const char *const TAG = "mqtt";
 
+// How long to wait for the retained discovery hash after connecting before assuming there is none
+static const uint32_t DISCOVERY_HASH_TIMEOUT = 2000;
+
 MQTTClientComponent::MQTTClientComponent() {
   global_mqtt_client = this;
   this->credentials_.client_id = App.get_name() + "-" + get_mac_address();
@@ -65,7 +70,8 @@ void MQTTClientComponent::setup() {
                            .qos = this->log_message_.qos,
                            .retain = this->log_message_.retain});
           }
-        });
+        },
+        this->log_level_);
   }
 #endif
 
@@ -80,6 +86,19 @@ void MQTTClientComponent::setup() {
         topic, [this](const std::string &topic, const std::string &payload) { this->send_device_info_(); }, 2);
   }
 
+  if (this->discovery_hash_ != 0) {
+    // The broker sends the retained hash right after subscribing
+    this->subscribe(this->get_discovery_hash_topic_(), [this](const std::string &topic, const std::string &payload) {
+      if (!this->discovery_hash_pending_)
+        return;
+      this->discovery_hash_pending_ = false;
+      if (payload == this->get_discovery_hash_payload_()) {
+        ESP_LOGD(TAG, "Discovery unchanged, skipping");
+        this->discovery_required_ = false;
+      }
+    });
+  }
+
   if (this->enable_on_boot_) {
     this->enable();
   }
@@ -169,6 +188,12 @@ void MQTTClientComponent::dump_config() {
                   "  Discovery prefix: '%s'\n"
                   "  Discovery retain: %s",
                   this->discovery_info_.prefix.c_str(), YESNO(this->discovery_info_.retain));
+    if (this->discovery_window_ != 0) {
+      ESP_LOGCONFIG(TAG, "  Discovery window: %u", this->discovery_window_);
+    }
+    if (this->discovery_hash_ != 0) {
+      ESP_LOGCONFIG(TAG, "  Discovery hash: %s", this->get_discovery_hash_payload_().c_str());
+    }
   }
   ESP_LOGCONFIG(TAG, "  Topic Prefix: '%s'", this->topic_prefix_.c_str());
   if (!this->log_message_.topic.empty()) {
@@ -314,10 +339,64 @@ void MQTTClientComponent::check_connected() {
   this->resubscribe_subscriptions_();
   this->send_device_info_();
 
+  this->discovery_required_ = true;
+  if (this->discovery_hash_ != 0) {
+    this->discovery_hash_pending_ = true;
+    this->discovery_hash_published_ = false;
+    this->discovery_hash_wait_start_ = millis();
+  }
   for (MQTTComponent *component : this->children_)
     component->schedule_resend_state();
 }
 
+bool MQTTClientComponent::acquire_discovery_slot() {
+  if (this->discovery_hash_pending_)
+    return false;
+  if (!this->discovery_required_ || this->discovery_window_ == 0)
+    return true;
+  if (this->discovery_slots_ == 0)
+    return false;
+  this->discovery_slots_--;
+  return true;
+}
+
+void MQTTClientComponent::process_discovery_() {
+  if (this->discovery_window_ != 0) {
+    // Messages the backend has not sent yet count against the window
+    size_t backlog = this->mqtt_backend_.get_publish_backlog();
+    this->discovery_slots_ = backlog >= this->discovery_window_ ? 0 : this->discovery_window_ - backlog;
+  }
+
+  if (this->discovery_hash_pending_ && millis() - this->discovery_hash_wait_start_ > DISCOVERY_HASH_TIMEOUT) {
+    ESP_LOGV(TAG, "No discovery hash on the broker");
+    this->discovery_hash_pending_ = false;
+  }
+  if (this->discovery_hash_published_ || this->discovery_hash_pending_)
+    return;
+  if (!this->discovery_required_) {
+    this->discovery_hash_published_ = true;
+    return;
+  }
+  // Only store the hash once every component sent its discovery, so an interrupted run is repeated
+  for (MQTTComponent *component : this->children_) {
+    if (component->is_resend_scheduled())
+      return;
+  }
+  this->discovery_hash_published_ =
+      this->publish(this->get_discovery_hash_topic_(), this->get_discovery_hash_payload_(), 0, true);
+}
+
+void MQTTClientComponent::set_discovery_hash(uint32_t config_hash) {
+  // The discovery payloads also contain the MAC address
+  this->discovery_hash_ = fnv1_hash(str_sprintf("%08" PRIx32, config_hash) + get_mac_address());
+}
+
+std::string MQTTClientComponent::get_discovery_hash_topic_() const { return this->topic_prefix_ + "/discovery_hash"; }
+
+std::string MQTTClientComponent::get_discovery_hash_payload_() const {
+  return str_sprintf("%08" PRIx32, this->discovery_hash_);
+}
+
 void MQTTClientComponent::loop() {
   // Call the backend loop first
   mqtt_backend_.loop();
@@ -388,6 +467,7 @@ void MQTTClientComponent::loop() {
 
         this->last_connected_ = now;
         this->resubscribe_subscriptions_();
+        this->process_discovery_();
       }
       break;
   }
@@ -444,6 +524,7 @@ void MQTTClientComponent::subscribe(const std::string &topic, mqtt_callback_t ca
   };
   this->resubscribe_subscription_(&subscription);
   this->subscriptions_.push_back(subscription);
+  this->topic_trie_dirty_ = true;
 }
 
 void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_json_callback_t &callback, uint8_t qos) {
@@ -462,6 +543,7 @@ void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_js
   };
   this->resubscribe_subscription_(&subscription);
   this->subscriptions_.push_back(subscription);
+  this->topic_trie_dirty_ = true;
 }
 
 void MQTTClientComponent::unsubscribe(const std::string &topic) {
@@ -479,6 +561,7 @@ void MQTTClientComponent::unsubscribe(const std::string &topic) {
   while (it != subscriptions_.end()) {
     if (it->topic == topic) {
       it = subscriptions_.erase(it);
+      this->topic_trie_dirty_ = true;
     } else {
       ++it;
     }
@@ -492,39 +575,40 @@ bool MQTTClientComponent::publish(const std::string &topic, const std::string &p
 
 bool MQTTClientComponent::publish(const std::string &topic, const char *payload, size_t payload_length, uint8_t qos,
                                   bool retain) {
-  return publish({.topic = topic, .payload = payload, .qos = qos, .retain = retain});
-}
-
-bool MQTTClientComponent::publish(const MQTTMessage &message) {
   if (!this->is_connected()) {
     // critical components will re-transmit their messages
     return false;
   }
-  bool logging_topic = this->log_message_.topic == message.topic;
-  bool ret = this->mqtt_backend_.publish(message);
+  // Handed straight to the backend, neither topic nor payload are copied
+  bool logging_topic = this->log_message_.topic == topic;
+  bool ret = this->mqtt_backend_.publish(topic.c_str(), payload, payload_length, qos, retain);
   delay(0);
   if (!ret && !logging_topic && this->is_connected()) {
     delay(0);
-    ret = this->mqtt_backend_.publish(message);
+    ret = this->mqtt_backend_.publish(topic.c_str(), payload, payload_length, qos, retain);
     delay(0);
   }
 
   if (!logging_topic) {
     if (ret) {
-      ESP_LOGV(TAG, "Publish(topic='%s' payload='%s' retain=%d qos=%d)", message.topic.c_str(), message.payload.c_str(),
-               message.retain, message.qos);
+      ESP_LOGV(TAG, "Publish(topic='%s' payload='%.*s' retain=%d qos=%d)", topic.c_str(), (int) payload_length,
+               payload, retain, qos);
     } else {
-      ESP_LOGV(TAG, "Publish failed for topic='%s' (len=%u). Will retry", message.topic.c_str(),
-               message.payload.length());
+      ESP_LOGV(TAG, "Publish failed for topic='%s' (len=%u). Will retry", topic.c_str(), payload_length);
       this->status_momentary_warning("publish", 1000);
     }
   }
   return ret != 0;
 }
+
+bool MQTTClientComponent::publish(const MQTTMessage &message) {
+  return this->publish(message.topic, message.payload.data(), message.payload.size(), message.qos, message.retain);
+}
 bool MQTTClientComponent::publish_json(const std::string &topic, const json::json_build_t &f, uint8_t qos,
                                        bool retain) {
-  std::string message = json::build_json(f);
-  return this->publish(topic, message, qos, retain);
+  // Serialized into a buffer that is kept between calls, so its capacity is only allocated once
+  json::build_json_into(f, this->json_buffer_);
+  return this->publish(topic, this->json_buffer_.data(), this->json_buffer_.size(), qos, retain);
 }
 
 void MQTTClientComponent::enable() {
@@ -544,72 +628,26 @@ void MQTTClientComponent::disable() {
   this->on_shutdown();
 }
 
-/** Check if the message topic matches the given subscription topic
- *
- * INFO: MQTT spec mandates that topics must not be empty and must be valid NULL-terminated UTF-8 strings.
- *
- * @param message The message topic that was received from the MQTT server. Note: this must not contain
- *                wildcard characters as mandated by the MQTT spec.
- * @param subscription The subscription topic we are matching against.
- * @param is_normal Is this a "normal" topic - Does the message topic not begin with a "$".
- * @param past_separator Are we past the first '/' topic separator.
- * @return true if the subscription topic matches the message topic, false otherwise.
- */
-static bool topic_match(const char *message, const char *subscription, bool is_normal, bool past_separator) {
-  // Reached end of both strings at the same time, this means we have a successful match
-  if (*message == '\0' && *subscription == '\0')
-    return true;
-
-  // Either the message or the subscribe are at the end. This means they don't match.
-  if (*message == '\0' || *subscription == '\0')
-    return false;
-
-  bool do_wildcards = is_normal || past_separator;
-
-  if (*subscription == '+' && do_wildcards) {
-    // single level wildcard
-    // consume + from subscription
-    subscription++;
-    // consume everything from message until '/' found or end of string
-    while (*message != '\0' && *message != '/') {
-      message++;
-    }
-    // after this, both pointers will point to a '/' or to the end of the string
-
-    return topic_match(message, subscription, is_normal, true);
-  }
-
-  if (*subscription == '#' && do_wildcards) {
-    // multilevel wildcard - MQTT mandates that this must be at end of subscribe topic
-    return true;
-  }
-
-  // this handles '/' and normal characters at the same time.
-  if (*message != *subscription)
-    return false;
-
-  past_separator = past_separator || *subscription == '/';
-
-  // consume characters
-  subscription++;
-  message++;
-
-  return topic_match(message, subscription, is_normal, past_separator);
-}
-
-static bool topic_match(const char *message, const char *subscription) {
-  return topic_match(message, subscription, *message != '\0' && *message != '$', false);
-}
-
 void MQTTClientComponent::on_message(const std::string &topic, const std::string &payload) {
 #ifdef USE_ESP8266
   // on ESP8266, this is called in lwIP/AsyncTCP task; some components do not like running
   // from a different task.
   this->defer([this, topic, payload]() {
 #endif
-    for (auto &subscription : this->subscriptions_) {
-      if (topic_match(topic.c_str(), subscription.topic.c_str()))
-        subscription.callback(topic, payload);
+    if (this->topic_trie_dirty_) {
+      this->topic_trie_.clear();
+      for (size_t i = 0; i < this->subscriptions_.size(); i++)
+        this->topic_trie_.insert(this->subscriptions_[i].topic.c_str(), i);
+      this->topic_trie_dirty_ = false;
+    }
+    this->matched_subscriptions_.clear();
+    this->topic_trie_.match(topic.c_str(), this->matched_subscriptions_);
+    // Same order as the subscriptions were made
+    std::sort(this->matched_subscriptions_.begin(), this->matched_subscriptions_.end());
+    for (uint16_t index : this->matched_subscriptions_) {
+      if (this->topic_trie_dirty_)
+        break;  // a callback changed the subscriptions, the remaining indices are stale
+      this->subscriptions_[index].callback(topic, payload);
     }
 #ifdef USE_ESP8266
   });
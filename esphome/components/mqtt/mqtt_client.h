@@ -18,6 +18,7 @@
 #include "mqtt_backend_libretiny.h"
 #endif
 #include "lwip/ip_addr.h"
+#include "mqtt_topic_trie.h"
 
 #include <vector>
 
@@ -134,6 +135,20 @@ class MQTTClientComponent : public Component {
   void disable_discovery();
   bool is_discovery_enabled() const;
   bool is_discovery_ip_enabled() const;
+  /// Maximum number of discovery messages sent or waiting in the backend at a time, 0 means no limit.
+  void set_discovery_window(uint8_t discovery_window) { this->discovery_window_ = discovery_window; }
+  /** Skip discovery on reconnect when nothing changed.
+   *
+   * A hash of the configuration is stored as retained message on the broker after all discovery messages were
+   * sent. If the broker still has the same hash on the next connect, only the states are sent.
+   *
+   * @param config_hash Hash of the configuration, generated at compile time.
+   */
+  void set_discovery_hash(uint32_t config_hash);
+  /// Whether components have to send their discovery messages after this connect.
+  bool is_discovery_required() const { return this->discovery_required_; }
+  /// Reserve one message of the discovery window, false means the component has to try again in a later loop.
+  bool acquire_discovery_slot();
 
 #if ASYNC_TCP_SSL_ENABLED
   /** Add a SSL fingerprint to use for TCP SSL connections to the MQTT broker.
@@ -229,6 +244,8 @@ class MQTTClientComponent : public Component {
    * @param retain Whether to retain the message.
    */
   bool publish_json(const std::string &topic, const json::json_build_t &f, uint8_t qos = 0, bool retain = false);
+  /// Size of the payload serialized by the last publish_json()
+  size_t get_last_json_size() const { return this->json_buffer_.size(); }
 
   /// Setup the MQTT client, registering a bunch of callbacks and attempting to connect.
   void setup() override;
@@ -272,6 +289,10 @@ class MQTTClientComponent : public Component {
 
  protected:
   void send_device_info_();
+  /// Refill the discovery window and store the discovery hash once all components sent their discovery.
+  void process_discovery_();
+  std::string get_discovery_hash_topic_() const;
+  std::string get_discovery_hash_payload_() const;
 
   /// Reconnect to the MQTT broker if not already connected.
   void start_connect_();
@@ -313,10 +334,23 @@ class MQTTClientComponent : public Component {
   };
   std::string topic_prefix_{};
   MQTTMessage log_message_;
+  std::string json_buffer_;  ///< Reused by publish_json()
   std::string payload_buffer_;
   int log_level_{ESPHOME_LOG_LEVEL};
 
   std::vector<MQTTSubscription> subscriptions_;
+  /// Subscription indices by topic filter, rebuilt on the next message after subscriptions_ changed.
+  MQTTTopicTrie topic_trie_;
+  std::vector<uint16_t> matched_subscriptions_;
+  bool topic_trie_dirty_{false};
+
+  uint32_t discovery_hash_{0};  ///< 0 if unchanged discovery is not skipped
+  uint32_t discovery_hash_wait_start_{0};
+  uint8_t discovery_window_{0};
+  uint8_t discovery_slots_{0};
+  bool discovery_required_{true};
+  bool discovery_hash_pending_{false};
+  bool discovery_hash_published_{true};
 #if defined(USE_ESP32)
   MQTTBackendESP32 mqtt_backend_;
 #elif defined(USE_ESP8266)
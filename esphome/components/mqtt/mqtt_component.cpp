@@ -36,28 +36,47 @@ std::string MQTTComponent::get_default_topic_for_(const std::string &suffix) con
   return topic_prefix + "/" + this->component_type() + "/" + this->get_default_object_id_() + "/" + suffix;
 }
 
-std::string MQTTComponent::get_state_topic_() const {
-  if (this->has_custom_state_topic_)
-    return this->custom_state_topic_.str();
-  return this->get_default_topic_for_("state");
+void MQTTComponent::cache_topics_() const {
+  this->state_topic_ =
+      this->has_custom_state_topic_ ? this->custom_state_topic_.str() : this->get_default_topic_for_("state");
+  this->command_topic_ =
+      this->has_custom_command_topic_ ? this->custom_command_topic_.str() : this->get_default_topic_for_("command");
+  this->topics_cached_ = true;
 }
 
-std::string MQTTComponent::get_command_topic_() const {
-  if (this->has_custom_command_topic_)
-    return this->custom_command_topic_.str();
-  return this->get_default_topic_for_("command");
+const std::string &MQTTComponent::get_state_topic_() const {
+  if (!this->topics_cached_)
+    this->cache_topics_();
+  return this->state_topic_;
+}
+
+const std::string &MQTTComponent::get_command_topic_() const {
+  if (!this->topics_cached_)
+    this->cache_topics_();
+  return this->command_topic_;
 }
 
 bool MQTTComponent::publish(const std::string &topic, const std::string &payload) {
+  return this->publish(topic, payload.data(), payload.size());
+}
+
+bool MQTTComponent::publish(const std::string &topic, const char *payload, size_t payload_length) {
   if (topic.empty())
     return false;
-  return global_mqtt_client->publish(topic, payload, this->qos_, this->retain_);
+#ifdef USE_ENTITY_STATS
+  this->get_entity()->get_stats().mqtt_bytes += topic.size() + payload_length;
+#endif
+  return global_mqtt_client->publish(topic, payload, payload_length, this->qos_, this->retain_);
 }
 
 bool MQTTComponent::publish_json(const std::string &topic, const json::json_build_t &f) {
   if (topic.empty())
     return false;
-  return global_mqtt_client->publish_json(topic, f, this->qos_, this->retain_);
+  bool ret = global_mqtt_client->publish_json(topic, f, this->qos_, this->retain_);
+#ifdef USE_ENTITY_STATS
+  this->get_entity()->get_stats().mqtt_bytes += topic.size() + global_mqtt_client->get_last_json_size();
+#endif
+  return ret;
 }
 
 bool MQTTComponent::send_discovery_() {
@@ -234,6 +253,8 @@ void MQTTComponent::set_availability(std::string topic, std::string payload_avai
 }
 void MQTTComponent::disable_availability() { this->set_availability("", "", ""); }
 void MQTTComponent::call_setup() {
+  // Topics only depend on configuration, build them once instead of on every publish
+  this->cache_topics_();
   if (this->is_internal())
     return;
 
@@ -241,17 +262,8 @@ void MQTTComponent::call_setup() {
 
   global_mqtt_client->register_mqtt_component(this);
 
-  if (!this->is_connected_())
-    return;
-
-  if (this->is_discovery_enabled()) {
-    if (!this->send_discovery_()) {
-      this->schedule_resend_state();
-    }
-  }
-  if (!this->send_initial_state()) {
-    this->schedule_resend_state();
-  }
+  if (this->is_connected_())
+    this->process_resend_();
 }
 
 void MQTTComponent::call_loop() {
@@ -264,8 +276,18 @@ void MQTTComponent::call_loop() {
     return;
   }
 
+  this->process_resend_();
+}
+
+void MQTTComponent::process_resend_() {
+  // Discovery is paced by the client, keep resend_state_ set and try again in a later loop
+  if (this->is_discovery_enabled() && !global_mqtt_client->acquire_discovery_slot()) {
+    this->resend_state_ = true;
+    return;
+  }
+
   this->resend_state_ = false;
-  if (this->is_discovery_enabled()) {
+  if (this->is_discovery_enabled() && global_mqtt_client->is_discovery_required()) {
     if (!this->send_discovery_()) {
       this->schedule_resend_state();
     }
@@ -281,6 +303,7 @@ void MQTTComponent::call_dump_config() {
   this->dump_config();
 }
 void MQTTComponent::schedule_resend_state() { this->resend_state_ = true; }
+bool MQTTComponent::is_resend_scheduled() const { return this->resend_state_; }
 bool MQTTComponent::is_connected_() const { return global_mqtt_client->is_connected(); }
 
 // Pull these properties from EntityBase if not overridden
@@ -301,7 +324,7 @@ bool MQTTComponent::is_internal() {
   }
 
   // No custom topics have been set
-  if (this->get_default_topic_for_("").empty()) {
+  if (global_mqtt_client->get_topic_prefix().empty()) {
     // If the default topic prefix is null, then the component, by default, is internal and should not publish
     return true;
   }
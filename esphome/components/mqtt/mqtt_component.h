@@ -114,6 +114,8 @@ class MQTTComponent : public Component {
 
   /// Internal method for the MQTT client base to schedule a resend of the state on reconnect.
   void schedule_resend_state();
+  /// Whether discovery and state still have to be sent after the last (re)connect.
+  bool is_resend_scheduled() const;
 
   /** Send a MQTT message.
    *
@@ -122,6 +124,14 @@ class MQTTComponent : public Component {
    */
   bool publish(const std::string &topic, const std::string &payload);
 
+  /** Send a MQTT message without copying the payload.
+   *
+   * @param topic The topic.
+   * @param payload The payload buffer.
+   * @param payload_length The length of the payload.
+   */
+  bool publish(const std::string &topic, const char *payload, size_t payload_length);
+
   /** Construct and send a JSON MQTT message.
    *
    * @param topic The topic.
@@ -174,16 +184,22 @@ class MQTTComponent : public Component {
   virtual bool is_disabled_by_default() const;
 
   /// Get the MQTT topic that new states will be shared to.
-  std::string get_state_topic_() const;
+  const std::string &get_state_topic_() const;
 
   /// Get the MQTT topic for listening to commands.
-  std::string get_command_topic_() const;
+  const std::string &get_command_topic_() const;
+
+  /// Build the state and command topics, they are cached as they can't change after setup.
+  void cache_topics_() const;
 
   bool is_connected_() const;
 
   /// Internal method to start sending discovery info, this will call send_discovery().
   bool send_discovery_();
 
+  /// Send discovery (when the client has room for it) and the current state.
+  void process_resend_();
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Generate the Home Assistant MQTT discovery object id by automatically transforming the friendly name.
@@ -194,6 +210,9 @@ class MQTTComponent : public Component {
 
   std::unique_ptr<Availability> availability_;
 
+  mutable std::string state_topic_{};
+  mutable std::string command_topic_{};
+
   bool has_custom_state_topic_{false};
   bool has_custom_command_topic_{false};
 
@@ -203,6 +222,7 @@ class MQTTComponent : public Component {
   uint8_t subscribe_qos_{0};
   bool discovery_enabled_{true};
   bool resend_state_{false};
+  mutable bool topics_cached_{false};
 };
 
 }  // namespace mqtt
@@ -32,10 +32,10 @@ void MQTTJSONLightComponent::setup() {
 MQTTJSONLightComponent::MQTTJSONLightComponent(LightState *state) : state_(state) {}
 
 bool MQTTJSONLightComponent::publish_state_() {
-  return this->publish_json(this->get_state_topic_(), [this](JsonObject root) {
-    // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-    LightJSONSchema::dump_json(*this->state_, root);
-  });
+  // Sent on every state change, write the JSON directly instead of building a JsonDocument
+  json::JsonObjectWriter writer(192);
+  LightJSONSchema::dump_json(*this->state_, writer);
+  return this->publish(this->get_state_topic_(), writer.release());
 }
 LightState *MQTTJSONLightComponent::get_state() const { return this->state_; }
 
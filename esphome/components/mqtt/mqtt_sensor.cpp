@@ -74,7 +74,9 @@ bool MQTTSensorComponent::publish_state(float value) {
   if (mqtt::global_mqtt_client->is_publish_nan_as_none() && std::isnan(value))
     return this->publish(this->get_state_topic_(), "None");
   int8_t accuracy = this->sensor_->get_accuracy_decimals();
-  return this->publish(this->get_state_topic_(), value_accuracy_to_string(value, accuracy));
+  char payload[32];
+  size_t len = value_accuracy_to_buf(payload, sizeof(payload), value, accuracy);
+  return this->publish(this->get_state_topic_(), payload, len);
 }
 
 }  // namespace mqtt
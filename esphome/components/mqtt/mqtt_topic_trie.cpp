@@ -0,0 +1,131 @@
+#include "mqtt_topic_trie.h"
+
+#ifdef USE_MQTT
+
+#include <cstring>
+
+namespace esphome {
+namespace mqtt {
+
+/** Check if the message topic matches the given subscription topic
+ *
+ * INFO: MQTT spec mandates that topics must not be empty and must be valid NULL-terminated UTF-8 strings.
+ *
+ * @param message The message topic that was received from the MQTT server. Note: this must not contain
+ *                wildcard characters as mandated by the MQTT spec.
+ * @param subscription The subscription topic we are matching against.
+ * @param is_normal Is this a "normal" topic - Does the message topic not begin with a "$".
+ * @param past_separator Are we past the first '/' topic separator.
+ * @return true if the subscription topic matches the message topic, false otherwise.
+ */
+static bool topic_match(const char *message, const char *subscription, bool is_normal, bool past_separator) {
+  // Reached end of both strings at the same time, this means we have a successful match
+  if (*message == '\0' && *subscription == '\0')
+    return true;
+
+  // Either the message or the subscribe are at the end. This means they don't match.
+  if (*message == '\0' || *subscription == '\0')
+    return false;
+
+  bool do_wildcards = is_normal || past_separator;
+
+  if (*subscription == '+' && do_wildcards) {
+    // single level wildcard
+    // consume + from subscription
+    subscription++;
+    // consume everything from message until '/' found or end of string
+    while (*message != '\0' && *message != '/') {
+      message++;
+    }
+    // after this, both pointers will point to a '/' or to the end of the string
+
+    return topic_match(message, subscription, is_normal, true);
+  }
+
+  if (*subscription == '#' && do_wildcards) {
+    // multilevel wildcard - MQTT mandates that this must be at end of subscribe topic
+    return true;
+  }
+
+  // this handles '/' and normal characters at the same time.
+  if (*message != *subscription)
+    return false;
+
+  past_separator = past_separator || *subscription == '/';
+
+  // consume characters
+  subscription++;
+  message++;
+
+  return topic_match(message, subscription, is_normal, past_separator);
+}
+
+bool topic_match(const char *message, const char *subscription) {
+  return topic_match(message, subscription, *message != '\0' && *message != '$', false);
+}
+
+void MQTTTopicTrie::insert(const char *filter, uint16_t id) {
+  Node *node = &this->root_;
+  while (true) {
+    const char *end = strchr(filter, '/');
+    size_t len = end == nullptr ? strlen(filter) : end - filter;
+    Node *child = nullptr;
+    for (auto &c : node->children) {
+      if (c.level.size() == len && memcmp(c.level.data(), filter, len) == 0) {
+        child = &c;
+        break;
+      }
+    }
+    if (child == nullptr) {
+      node->children.emplace_back();
+      child = &node->children.back();
+      child->level.assign(filter, len);
+    }
+    node = child;
+    if (end == nullptr)
+      break;
+    filter = end + 1;
+  }
+  node->ids.push_back(id);
+}
+
+void MQTTTopicTrie::clear() { this->root_ = Node{}; }
+
+void MQTTTopicTrie::match(const char *topic, std::vector<uint16_t> &ids) const {
+  match_(this->root_, topic, true, *topic == '$', ids);
+}
+
+void MQTTTopicTrie::match_(const Node &node, const char *topic, bool first_level, bool dollar,
+                           std::vector<uint16_t> &ids) {
+  // Wildcards at the first level don't match topics starting with '$', like $SYS/...
+  const bool wildcards = !(first_level && dollar);
+  const char *end = strchr(topic, '/');
+  size_t len = end == nullptr ? strlen(topic) : end - topic;
+
+  for (const auto &child : node.children) {
+    if (child.level.size() == 1 && child.level[0] == '#') {
+      // Matches all remaining levels, but not an empty remainder
+      if (wildcards && *topic != '\0')
+        ids.insert(ids.end(), child.ids.begin(), child.ids.end());
+      continue;
+    }
+    bool plus = child.level.size() == 1 && child.level[0] == '+';
+    if (plus) {
+      // Like topic_match(), '+' does not match an empty last level
+      if (!wildcards || (len == 0 && end == nullptr))
+        continue;
+    } else if (child.level.size() != len || memcmp(child.level.data(), topic, len) != 0) {
+      continue;
+    }
+    if (end == nullptr) {
+      ids.insert(ids.end(), child.ids.begin(), child.ids.end());
+    } else {
+      match_(child, end + 1, false, dollar, ids);
+    }
+  }
+}
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_MQTT
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace mqtt {
+
+/// Check if a topic matches a subscription filter, including the '+' and '#' wildcards.
+bool topic_match(const char *message, const char *subscription);
+
+/** Subscription filters split into their topic levels.
+ *
+ * Matching a topic walks it level by level instead of comparing it against every filter, so the cost
+ * depends on the topic depth and not on the number of subscriptions. Matches are the same as
+ * topic_match() for all valid filters.
+ */
+class MQTTTopicTrie {
+ public:
+  /// Add a filter, \p id is reported back by match() for topics matching it.
+  void insert(const char *filter, uint16_t id);
+  void clear();
+
+  /// Append the ids of all filters matching \p topic to \p ids, in no particular order.
+  void match(const char *topic, std::vector<uint16_t> &ids) const;
+
+ protected:
+  struct Node {
+    std::string level;
+    std::vector<uint16_t> ids;
+    std::vector<Node> children;
+  };
+
+  static void match_(const Node &node, const char *topic, bool first_level, bool dollar,
+                     std::vector<uint16_t> &ids);
+
+  Node root_;
+};
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
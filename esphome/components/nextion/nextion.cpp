@@ -35,13 +35,68 @@ bool Nextion::send_command_(const std::string &command) {
   }
 #endif  // USE_NEXTION_COMMAND_SPACING
 
+  // Keep the order of the commands queued before this one
+  this->flush_command_batch_();
+
   ESP_LOGN(TAG, "cmd: %s", command.c_str());
 
   this->write_str(command.c_str());
   const uint8_t to_send[3] = {0xFF, 0xFF, 0xFF};
   this->write_array(to_send, sizeof(to_send));
+  this->tx_commands_++;
+  this->tx_bytes_ += command.size() + sizeof(to_send);
+
+  return true;
+}
+
+bool Nextion::batch_command_(const std::string &command, uint16_t set_prefix_len, bool &coalesced) {
+  coalesced = false;
+#ifdef USE_NEXTION_COMMAND_SPACING
+  // Spaced commands go out one at a time
+  return this->send_command_(command);
+#else
+  if (!this->connection_state_.ignore_is_setup_ && !this->is_setup()) {
+    return false;
+  }
 
+  if (set_prefix_len != 0) {
+    // Last value wins, but only back to the first command that isn't a state set
+    for (auto it = this->command_batch_.rbegin(); it != this->command_batch_.rend() && it->set_prefix_len != 0; ++it) {
+      if (it->set_prefix_len == set_prefix_len &&
+          it->command.compare(0, set_prefix_len, command, 0, set_prefix_len) == 0) {
+        ESP_LOGN(TAG, "Coalesced: %s", command.c_str());
+        it->command = command;
+        this->tx_coalesced_++;
+        coalesced = true;
+        return true;
+      }
+    }
+  }
+  this->command_batch_.push_back({command, set_prefix_len});
   return true;
+#endif  // USE_NEXTION_COMMAND_SPACING
+}
+
+void Nextion::flush_command_batch_() {
+  if (this->command_batch_.empty()) {
+    return;
+  }
+
+  size_t length = 0;
+  for (const auto &batched : this->command_batch_) {
+    length += batched.command.size() + 3;
+  }
+  std::string data;
+  data.reserve(length);
+  for (const auto &batched : this->command_batch_) {
+    ESP_LOGN(TAG, "cmd: %s", batched.command.c_str());
+    data += batched.command;
+    data.append(3, '\xFF');
+  }
+  this->write_array(reinterpret_cast<const uint8_t *>(data.data()), data.size());
+  this->tx_commands_ += this->command_batch_.size();
+  this->tx_bytes_ += data.size();
+  this->command_batch_.clear();
 }
 
 bool Nextion::check_connect_() {
@@ -139,8 +194,15 @@ void Nextion::reset_(bool reset_nextion) {
   while (this->available()) {  // Clear receive buffer
     this->read_byte(&d);
   };
+  for (auto *entry : this->nextion_queue_) {
+    this->release_queue_entry_(entry);
+  }
+  for (auto *entry : this->waveform_queue_) {
+    this->release_queue_entry_(entry);
+  }
   this->nextion_queue_.clear();
   this->waveform_queue_.clear();
+  this->command_batch_.clear();
 }
 
 void Nextion::dump_config() {
@@ -199,6 +261,21 @@ void Nextion::update() {
   if (this->writer_.has_value()) {
     (*this->writer_)(*this);
   }
+
+#if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
+  const uint32_t now = millis();
+  const uint32_t elapsed = now - this->tx_stats_start_;
+  if (this->tx_commands_ != 0 && elapsed != 0) {
+    const float bytes_per_second = this->tx_bytes_ * 1000.0f / elapsed;
+    // A byte takes 10 bits on the line
+    ESP_LOGV(TAG, "TX: %" PRIu32 " cmds, %" PRIu32 " coalesced, %.0f B/s (%.0f%% of the link)", this->tx_commands_,
+             this->tx_coalesced_, bytes_per_second, bytes_per_second * 1000.0f / this->parent_->get_baud_rate());
+  }
+  this->tx_commands_ = 0;
+  this->tx_coalesced_ = 0;
+  this->tx_bytes_ = 0;
+  this->tx_stats_start_ = now;
+#endif
 }
 
 void Nextion::add_sleep_state_callback(std::function<void()> &&callback) {
@@ -343,6 +420,8 @@ void Nextion::loop() {
   // Try to send any pending commands if spacing allows
   this->process_pending_in_queue_();
 #endif  // USE_NEXTION_COMMAND_SPACING
+
+  this->flush_command_batch_();
 }
 
 #ifdef USE_NEXTION_COMMAND_SPACING
@@ -385,13 +464,47 @@ bool Nextion::remove_from_q_(bool report_empty) {
     if (component->get_variable_name() == "sleep_wake") {
       this->is_sleeping_ = false;
     }
-    delete component;  // NOLINT(cppcoreguidelines-owning-memory)
   }
-  delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+  this->release_queue_entry_(nb);
   this->nextion_queue_.pop_front();
   return true;
 }
 
+NextionQueue *Nextion::acquire_queue_entry_(NextionComponentBase *component) {
+  std::vector<NextionQueue *> &pool = component == nullptr ? this->no_result_pool_ : this->queue_pool_;
+  NextionQueue *entry;
+  if (!pool.empty()) {
+    entry = pool.back();
+    pool.pop_back();
+  } else {
+    RAMAllocator<nextion::NextionQueue> allocator;
+    entry = allocator.allocate(1);
+    if (entry == nullptr) {
+      ESP_LOGW(TAG, "Queue alloc failed");
+      return nullptr;
+    }
+    new (entry) nextion::NextionQueue();
+    if (component == nullptr) {
+      entry->component = new nextion::NextionComponentBase;  // NOLINT(cppcoreguidelines-owning-memory)
+    }
+  }
+  if (component != nullptr) {
+    entry->component = component;
+  }
+  entry->queue_time = App.get_loop_component_start_time();
+  return entry;
+}
+
+void Nextion::release_queue_entry_(NextionQueue *entry) {
+  entry->pending_command.clear();
+  if (entry->component->get_queue_type() == NextionQueueType::NO_RESULT) {
+    this->no_result_pool_.push_back(entry);
+  } else {
+    entry->component = nullptr;
+    this->queue_pool_.push_back(entry);
+  }
+}
+
 void Nextion::process_serial_() {
   uint8_t d;
 
@@ -497,7 +610,7 @@ void Nextion::process_nextion_commands_() {
 
           ESP_LOGN(TAG, "Remove waveform ID %d/ch %d", component->get_component_id(), component->get_wave_channel_id());
 
-          delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+          this->release_queue_entry_(nb);
           this->waveform_queue_.pop_front();
         }
         break;
@@ -608,7 +721,7 @@ void Nextion::process_nextion_commands_() {
                    component->get_queue_type_string().c_str());
         }
 
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+        this->release_queue_entry_(nb);
         this->nextion_queue_.pop_front();
 
         break;
@@ -655,7 +768,7 @@ void Nextion::process_nextion_commands_() {
           component->set_state_from_int(value, true, false);
         }
 
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+        this->release_queue_entry_(nb);
         this->nextion_queue_.pop_front();
 
         break;
@@ -828,7 +941,7 @@ void Nextion::process_nextion_commands_() {
                  component->get_wave_channel_id(), buffer_to_send);
 
         component->clear_wave_buffer(buffer_to_send);
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+        this->release_queue_entry_(nb);
         this->waveform_queue_.pop_front();
         break;
       }
@@ -858,14 +971,7 @@ void Nextion::process_nextion_commands_() {
         ESP_LOGD(TAG, "Remove old queue '%s':'%s'", component->get_queue_type_string().c_str(),
                  component->get_variable_name().c_str());
 
-        if (component->get_queue_type() == NextionQueueType::NO_RESULT) {
-          if (component->get_variable_name() == "sleep_wake") {
-            this->is_sleeping_ = false;
-          }
-          delete component;  // NOLINT(cppcoreguidelines-owning-memory)
-        }
-
-        delete this->nextion_queue_[i];  // NOLINT(cppcoreguidelines-owning-memory)
+        this->release_queue_entry_(this->nextion_queue_[i]);
 
         this->nextion_queue_.erase(this->nextion_queue_.begin() + i);
         i--;
@@ -1035,20 +1141,12 @@ void Nextion::add_no_result_to_queue_(const std::string &variable_name) {
   }
 #endif
 
-  RAMAllocator<nextion::NextionQueue> allocator;
-  nextion::NextionQueue *nextion_queue = allocator.allocate(1);
+  nextion::NextionQueue *nextion_queue = this->acquire_queue_entry_(nullptr);
   if (nextion_queue == nullptr) {
-    ESP_LOGW(TAG, "Queue alloc failed");
     return;
   }
-  new (nextion_queue) nextion::NextionQueue();
-
-  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-  nextion_queue->component = new nextion::NextionComponentBase;
   nextion_queue->component->set_variable_name(variable_name);
 
-  nextion_queue->queue_time = millis();
-
   this->nextion_queue_.push_back(nextion_queue);
 
   ESP_LOGN(TAG, "Queue NORESULT: %s", nextion_queue->component->get_variable_name().c_str());
@@ -1060,12 +1158,16 @@ void Nextion::add_no_result_to_queue_(const std::string &variable_name) {
  * @param variable_name Variable name for the queue
  * @param command
  */
-void Nextion::add_no_result_to_queue_with_command_(const std::string &variable_name, const std::string &command) {
+void Nextion::add_no_result_to_queue_with_command_(const std::string &variable_name, const std::string &command,
+                                                   uint16_t set_prefix_len) {
   if ((!this->is_setup() && !this->connection_state_.ignore_is_setup_) || command.empty())
     return;
 
-  if (this->send_command_(command)) {
-    this->add_no_result_to_queue_(variable_name);
+  bool coalesced;
+  if (this->batch_command_(command, set_prefix_len, coalesced)) {
+    // A coalesced set replaced one that is already in the queue and gets its acknowledgement
+    if (!coalesced)
+      this->add_no_result_to_queue_(variable_name);
 #ifdef USE_NEXTION_COMMAND_SPACING
   } else {
     // Command blocked by spacing, add to queue WITH the command for retry
@@ -1084,17 +1186,11 @@ void Nextion::add_no_result_to_queue_with_pending_command_(const std::string &va
   }
 #endif
 
-  RAMAllocator<nextion::NextionQueue> allocator;
-  nextion::NextionQueue *nextion_queue = allocator.allocate(1);
+  nextion::NextionQueue *nextion_queue = this->acquire_queue_entry_(nullptr);
   if (nextion_queue == nullptr) {
-    ESP_LOGW(TAG, "Queue alloc failed");
     return;
   }
-  new (nextion_queue) nextion::NextionQueue();
-
-  nextion_queue->component = new nextion::NextionComponentBase;
   nextion_queue->component->set_variable_name(variable_name);
-  nextion_queue->queue_time = App.get_loop_component_start_time();
   nextion_queue->pending_command = command;  // Store command for retry
 
   this->nextion_queue_.push_back(nextion_queue);
@@ -1171,8 +1267,10 @@ void Nextion::add_no_result_to_queue_with_set_internal_(const std::string &varia
   if ((!this->is_setup() && !this->connection_state_.ignore_is_setup_) || (!is_sleep_safe && this->is_sleeping()))
     return;
 
-  this->add_no_result_to_queue_with_ignore_sleep_printf_(variable_name, "%s=%" PRId32, variable_name_to_send.c_str(),
-                                                         state_value);
+  // Component states can be coalesced, the sleep safe control sets can't
+  this->add_no_result_to_queue_with_command_(variable_name,
+                                             str_sprintf("%s=%" PRId32, variable_name_to_send.c_str(), state_value),
+                                             is_sleep_safe ? 0 : variable_name_to_send.size() + 1);
 }
 
 /**
@@ -1199,8 +1297,9 @@ void Nextion::add_no_result_to_queue_with_set_internal_(const std::string &varia
   if ((!this->is_setup() && !this->connection_state_.ignore_is_setup_) || (!is_sleep_safe && this->is_sleeping()))
     return;
 
-  this->add_no_result_to_queue_with_printf_(variable_name, "%s=\"%s\"", variable_name_to_send.c_str(),
-                                            state_value.c_str());
+  this->add_no_result_to_queue_with_command_(
+      variable_name, str_sprintf("%s=\"%s\"", variable_name_to_send.c_str(), state_value.c_str()),
+      is_sleep_safe ? 0 : variable_name_to_send.size() + 1);
 }
 
 /**
@@ -1224,23 +1323,20 @@ void Nextion::add_to_get_queue(NextionComponentBase *component) {
   }
 #endif
 
-  RAMAllocator<nextion::NextionQueue> allocator;
-  nextion::NextionQueue *nextion_queue = allocator.allocate(1);
+  nextion::NextionQueue *nextion_queue = this->acquire_queue_entry_(component);
   if (nextion_queue == nullptr) {
-    ESP_LOGW(TAG, "Queue alloc failed");
     return;
   }
-  new (nextion_queue) nextion::NextionQueue();
-
-  nextion_queue->component = component;
-  nextion_queue->queue_time = App.get_loop_component_start_time();
 
   ESP_LOGN(TAG, "Queue %s: %s", component->get_queue_type_string().c_str(), component->get_variable_name().c_str());
 
   std::string command = "get " + component->get_variable_name_to_send();
 
-  if (this->send_command_(command)) {
+  bool coalesced;
+  if (this->batch_command_(command, 0, coalesced)) {
     this->nextion_queue_.push_back(nextion_queue);
+  } else {
+    this->release_queue_entry_(nextion_queue);
   }
 }
 
@@ -1256,16 +1352,10 @@ void Nextion::add_addt_command_to_queue(NextionComponentBase *component) {
   if ((!this->is_setup() && !this->connection_state_.ignore_is_setup_) || this->is_sleeping())
     return;
 
-  RAMAllocator<nextion::NextionQueue> allocator;
-  nextion::NextionQueue *nextion_queue = allocator.allocate(1);
+  nextion::NextionQueue *nextion_queue = this->acquire_queue_entry_(component);
   if (nextion_queue == nullptr) {
-    ESP_LOGW(TAG, "Queue alloc failed");
     return;
   }
-  new (nextion_queue) nextion::NextionQueue();
-
-  nextion_queue->component = component;
-  nextion_queue->queue_time = App.get_loop_component_start_time();
 
   this->waveform_queue_.push_back(nextion_queue);
   if (this->waveform_queue_.size() == 1)
@@ -1284,7 +1374,7 @@ void Nextion::check_pending_waveform_() {
   std::string command = "addt " + to_string(component->get_component_id()) + "," +
                         to_string(component->get_wave_channel_id()) + "," + to_string(buffer_to_send);
   if (!this->send_command_(command)) {
-    delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
+    this->release_queue_entry_(nb);
     this->waveform_queue_.pop_front();
   }
 }
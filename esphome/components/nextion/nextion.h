@@ -1322,6 +1322,35 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
 
   std::deque<NextionQueue *> nextion_queue_;
   std::deque<NextionQueue *> waveform_queue_;
+  /// Released queue entries to reuse. NO_RESULT entries keep their placeholder component, so they have their own pool.
+  std::vector<NextionQueue *> queue_pool_;
+  std::vector<NextionQueue *> no_result_pool_;
+  /// Takes an entry from the pool, or allocates one. Pass nullptr for a NO_RESULT entry.
+  NextionQueue *acquire_queue_entry_(NextionComponentBase *component);
+  void release_queue_entry_(NextionQueue *entry);
+
+  /// A queued command waiting for the write at the end of the loop
+  struct BatchedCommand {
+    std::string command;
+    /// Length of the "attribute=" prefix of a component state set, 0 if the command can't be coalesced
+    uint16_t set_prefix_len;
+  };
+  std::vector<BatchedCommand> command_batch_;
+  /**
+   * @brief Add a command to the batch written at the end of the loop
+   *
+   * A component state set replaces an unsent set of the same attribute, as long as no other command is between them
+   * that could depend on the order. Returns false if nothing was queued, true if the command was batched or sent,
+   * and sets coalesced when it replaced an earlier set, which then already has its queue entry.
+   */
+  bool batch_command_(const std::string &command, uint16_t set_prefix_len, bool &coalesced);
+  /// Writes all batched commands to the UART at once
+  void flush_command_batch_();
+  /// Throughput counters since the last update, logged at verbose level
+  uint32_t tx_commands_{0};
+  uint32_t tx_coalesced_{0};
+  uint32_t tx_bytes_{0};
+  uint32_t tx_stats_start_{0};
   uint16_t recv_ret_string_(std::string &response, uint32_t timeout, bool recv_flag);
   void all_components_send_state_(bool force_update = false);
   uint32_t comok_sent_ = 0;
@@ -1360,7 +1389,8 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
   void add_no_result_to_queue_(const std::string &variable_name);
   bool add_no_result_to_queue_with_ignore_sleep_printf_(const std::string &variable_name, const char *format, ...)
       __attribute__((format(printf, 3, 4)));
-  void add_no_result_to_queue_with_command_(const std::string &variable_name, const std::string &command);
+  void add_no_result_to_queue_with_command_(const std::string &variable_name, const std::string &command,
+                                            uint16_t set_prefix_len = 0);
 
 #ifdef USE_NEXTION_COMMAND_SPACING
   /**
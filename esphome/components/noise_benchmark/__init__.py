@@ -0,0 +1,50 @@
+"""
+Noise benchmark component for ESPHome.
+
+Measures the cost of the Noise API transport (handshake and frame encryption)
+on the target chip so the numbers can be compared across boards.
+"""
+
+import esphome.codegen as cg
+from esphome.components.api import CONF_ENCRYPTION
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+import esphome.final_validate as fv
+
+CODEOWNERS = ["@esphome/core"]
+DEPENDENCIES = ["api"]
+
+CONF_FRAME_SIZE = "frame_size"
+CONF_ITERATIONS = "iterations"
+
+noise_benchmark_ns = cg.esphome_ns.namespace("noise_benchmark")
+NoiseBenchmark = noise_benchmark_ns.class_("NoiseBenchmark", cg.Component)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(NoiseBenchmark),
+        cv.Optional(CONF_FRAME_SIZE, default=1024): cv.int_range(min=16, max=4096),
+        cv.Optional(CONF_ITERATIONS, default=32): cv.int_range(min=1, max=1000),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+def _final_validate(config):
+    api_config = fv.full_config.get()["api"]
+    if CONF_ENCRYPTION not in api_config:
+        raise cv.Invalid(
+            "noise_benchmark requires 'encryption' to be configured for the api"
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
+async def to_code(config):
+    cg.add_define("USE_NOISE_BENCHMARK")
+
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.set_frame_size(config[CONF_FRAME_SIZE]))
+    cg.add(var.set_iterations(config[CONF_ITERATIONS]))
@@ -0,0 +1,172 @@
+#include "noise_benchmark.h"
+
+#ifdef USE_NOISE_BENCHMARK
+
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include <noise/protocol.h>
+#include <cinttypes>
+#include <vector>
+
+namespace esphome {
+namespace noise_benchmark {
+
+static const char *const TAG = "noise_benchmark";
+
+static const uint8_t HANDSHAKE_ROUNDS = 4;
+static const uint8_t PROLOGUE[] = {'N', 'o', 'i', 's', 'e', 'A', 'P', 'I', 'I', 'n', 'i', 't'};
+static const uint8_t PSK[32] = {};
+
+static NoiseHandshakeState *create_handshake(int role) {
+  // Same protocol as api::APINoiseFrameHelper
+  NoiseProtocolId nid{};
+  nid.pattern_id = NOISE_PATTERN_NN;
+  nid.cipher_id = NOISE_CIPHER_CHACHAPOLY;
+  nid.dh_id = NOISE_DH_CURVE25519;
+  nid.prefix_id = NOISE_PREFIX_STANDARD;
+  nid.hybrid_id = NOISE_DH_NONE;
+  nid.hash_id = NOISE_HASH_SHA256;
+  nid.modifier_ids[0] = NOISE_MODIFIER_PSK0;
+
+  NoiseHandshakeState *handshake = nullptr;
+  if (noise_handshakestate_new_by_id(&handshake, &nid, role) != NOISE_ERROR_NONE)
+    return nullptr;
+  if (noise_handshakestate_set_pre_shared_key(handshake, PSK, sizeof(PSK)) != NOISE_ERROR_NONE ||
+      noise_handshakestate_set_prologue(handshake, PROLOGUE, sizeof(PROLOGUE)) != NOISE_ERROR_NONE ||
+      noise_handshakestate_start(handshake) != NOISE_ERROR_NONE) {
+    noise_handshakestate_free(handshake);
+    return nullptr;
+  }
+  return handshake;
+}
+
+/// Run a full handshake between an in-memory initiator and responder. On success the initiator's
+/// send cipher and the responder's receive cipher are returned so frames can be passed between them.
+static bool run_handshake(NoiseCipherState **send_cipher, NoiseCipherState **recv_cipher) {
+  NoiseHandshakeState *initiator = create_handshake(NOISE_ROLE_INITIATOR);
+  NoiseHandshakeState *responder = create_handshake(NOISE_ROLE_RESPONDER);
+  bool ok = initiator != nullptr && responder != nullptr;
+
+  uint8_t message[64];
+  while (ok) {
+    int initiator_action = noise_handshakestate_get_action(initiator);
+    int responder_action = noise_handshakestate_get_action(responder);
+    if (initiator_action == NOISE_ACTION_SPLIT && responder_action == NOISE_ACTION_SPLIT)
+      break;
+
+    NoiseHandshakeState *writer;
+    NoiseHandshakeState *reader;
+    if (initiator_action == NOISE_ACTION_WRITE_MESSAGE && responder_action == NOISE_ACTION_READ_MESSAGE) {
+      writer = initiator;
+      reader = responder;
+    } else if (responder_action == NOISE_ACTION_WRITE_MESSAGE && initiator_action == NOISE_ACTION_READ_MESSAGE) {
+      writer = responder;
+      reader = initiator;
+    } else {
+      ok = false;
+      break;
+    }
+
+    NoiseBuffer mbuf;
+    noise_buffer_init(mbuf);
+    noise_buffer_set_output(mbuf, message, sizeof(message));
+    ok = noise_handshakestate_write_message(writer, &mbuf, nullptr) == NOISE_ERROR_NONE;
+    if (ok) {
+      noise_buffer_set_input(mbuf, message, mbuf.size);
+      ok = noise_handshakestate_read_message(reader, &mbuf, nullptr) == NOISE_ERROR_NONE;
+    }
+  }
+
+  NoiseCipherState *initiator_recv = nullptr;
+  NoiseCipherState *responder_send = nullptr;
+  if (ok) {
+    ok = noise_handshakestate_split(initiator, send_cipher, &initiator_recv) == NOISE_ERROR_NONE &&
+         noise_handshakestate_split(responder, &responder_send, recv_cipher) == NOISE_ERROR_NONE;
+  }
+  if (initiator_recv != nullptr)
+    noise_cipherstate_free(initiator_recv);
+  if (responder_send != nullptr)
+    noise_cipherstate_free(responder_send);
+  if (initiator != nullptr)
+    noise_handshakestate_free(initiator);
+  if (responder != nullptr)
+    noise_handshakestate_free(responder);
+  return ok;
+}
+
+void NoiseBenchmark::loop() {
+  // Only run once, after everything else has been set up so boot is not delayed
+  this->run_();
+  this->disable_loop();
+}
+
+void NoiseBenchmark::run_() {
+  NoiseCipherState *send_cipher = nullptr;
+  NoiseCipherState *recv_cipher = nullptr;
+
+  uint32_t handshake_us = 0;
+  for (uint8_t i = 0; i < HANDSHAKE_ROUNDS; i++) {
+    if (send_cipher != nullptr)
+      noise_cipherstate_free(send_cipher);
+    if (recv_cipher != nullptr)
+      noise_cipherstate_free(recv_cipher);
+    send_cipher = recv_cipher = nullptr;
+
+    uint32_t start = micros();
+    bool ok = run_handshake(&send_cipher, &recv_cipher);
+    handshake_us += micros() - start;
+    if (!ok) {
+      ESP_LOGE(TAG, "Handshake failed");
+      this->mark_failed();
+      return;
+    }
+    App.feed_wdt();
+  }
+  // Both sides of the handshake run on this chip, a device only does the responder half
+  ESP_LOGI(TAG, "Handshake: %" PRIu32 " us (initiator + responder)", handshake_us / HANDSHAKE_ROUNDS);
+
+  size_t mac_length = noise_cipherstate_get_mac_length(send_cipher);
+  std::vector<uint8_t> frame(this->frame_size_ + mac_length);
+  uint32_t encrypt_us = 0;
+  uint32_t decrypt_us = 0;
+  bool ok = true;
+  for (uint16_t i = 0; i < this->iterations_ && ok; i++) {
+    NoiseBuffer mbuf;
+    noise_buffer_init(mbuf);
+    noise_buffer_set_inout(mbuf, frame.data(), this->frame_size_, frame.size());
+    uint32_t start = micros();
+    ok = noise_cipherstate_encrypt(send_cipher, &mbuf) == NOISE_ERROR_NONE;
+    encrypt_us += micros() - start;
+
+    noise_buffer_set_inout(mbuf, frame.data(), mbuf.size, frame.size());
+    start = micros();
+    ok = ok && noise_cipherstate_decrypt(recv_cipher, &mbuf) == NOISE_ERROR_NONE;
+    decrypt_us += micros() - start;
+  }
+  noise_cipherstate_free(send_cipher);
+  noise_cipherstate_free(recv_cipher);
+
+  if (!ok) {
+    ESP_LOGE(TAG, "Frame encryption failed");
+    this->mark_failed();
+    return;
+  }
+  uint32_t total_bytes = static_cast<uint32_t>(this->frame_size_) * this->iterations_;
+  ESP_LOGI(TAG, "Encrypt: %" PRIu32 " us/KB, decrypt: %" PRIu32 " us/KB (%u byte frames)",
+           static_cast<uint32_t>(uint64_t(encrypt_us) * 1024 / total_bytes),
+           static_cast<uint32_t>(uint64_t(decrypt_us) * 1024 / total_bytes), this->frame_size_);
+}
+
+void NoiseBenchmark::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Noise Benchmark:\n"
+                "  Frame Size: %u bytes\n"
+                "  Iterations: %u",
+                this->frame_size_, this->iterations_);
+}
+
+}  // namespace noise_benchmark
+}  // namespace esphome
+
+#endif  // USE_NOISE_BENCHMARK
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_NOISE_BENCHMARK
+
+#include <cstdint>
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace noise_benchmark {
+
+/** Times the Noise API transport on this chip once after boot.
+ *
+ * Runs complete in-memory handshakes using the same protocol as the native API
+ * (Noise_NNpsk0_25519_ChaChaPoly_SHA256), then encrypts and decrypts frames of the
+ * configured size. The results are logged per KB so they can be compared between
+ * chips and crypto backends.
+ */
+class NoiseBenchmark : public Component {
+ public:
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void set_frame_size(uint16_t frame_size) { this->frame_size_ = frame_size; }
+  void set_iterations(uint16_t iterations) { this->iterations_ = iterations; }
+
+ protected:
+  void run_();
+
+  uint16_t frame_size_{1024};
+  uint16_t iterations_{32};
+};
+
+}  // namespace noise_benchmark
+}  // namespace esphome
+
+#endif  // USE_NOISE_BENCHMARK
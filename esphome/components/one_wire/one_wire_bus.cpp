@@ -1,6 +1,8 @@
 #include "one_wire_bus.h"
 #include "esphome/core/helpers.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace one_wire {
 
@@ -56,6 +58,23 @@ void OneWireBus::search() {
   }
 }
 
+optional<uint32_t> OneWireBus::start_conversion(uint8_t cmd, uint32_t duration) {
+  uint32_t now = millis();
+  uint32_t elapsed = now - this->conversion_start_;
+  if (elapsed < this->conversion_duration_) {
+    // Still running, it started the caller's device too
+    this->conversion_duration_ = std::max(this->conversion_duration_, duration);
+    return elapsed < duration ? duration - elapsed : 0;
+  }
+  if (!this->reset_())
+    return {};
+  this->skip();
+  this->write8(cmd);
+  this->conversion_start_ = now;
+  this->conversion_duration_ = duration;
+  return duration;
+}
+
 void OneWireBus::skip() {
   this->write8(0xCC);  // skip ROM
 }
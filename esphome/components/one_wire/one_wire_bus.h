@@ -2,6 +2,7 @@
 
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
+#include "esphome/core/optional.h"
 #include <vector>
 
 namespace esphome {
@@ -18,6 +19,17 @@ class OneWireBus {
   /// Write a command to the bus that addresses all devices by skipping the ROM.
   void skip();
 
+  /** Start a conversion on all devices at once, or join the one that is still running.
+   *
+   * Sensors that convert on a command, like the Dallas temperature sensors, share one conversion this way instead of
+   * each one waiting for its own. A new conversion is only started once all devices that joined the last one are done.
+   *
+   * @param cmd The command that starts the conversion, sent after skipping the ROM.
+   * @param duration Milliseconds the calling device needs for the conversion.
+   * @return Milliseconds until the conversion of the calling device is done, nothing if the bus reset failed.
+   */
+  optional<uint32_t> start_conversion(uint8_t cmd, uint32_t duration);
+
   /// Read an 8 bit word from the bus.
   virtual uint8_t read8() = 0;
 
@@ -38,6 +50,8 @@ class OneWireBus {
 
  protected:
   std::vector<uint64_t> devices_;
+  uint32_t conversion_start_{0};
+  uint32_t conversion_duration_{0};
 
   /// log the found devices
   void dump_devices_(const char *tag);
@@ -2,6 +2,7 @@ import logging
 
 from esphome import automation
 import esphome.codegen as cg
+from esphome.components import display
 from esphome.components.const import CONF_BYTE_ORDER, CONF_REQUEST_HEADERS
 from esphome.components.http_request import CONF_HTTP_REQUEST_ID, HttpRequestComponent
 from esphome.components.image import (
@@ -16,6 +17,7 @@ from esphome.components.image import (
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_BUFFER_SIZE,
+    CONF_DISPLAY_ID,
     CONF_DITHER,
     CONF_FILE,
     CONF_FORMAT,
@@ -25,6 +27,8 @@ from esphome.const import (
     CONF_TRIGGER_ID,
     CONF_TYPE,
     CONF_URL,
+    CONF_X,
+    CONF_Y,
 )
 from esphome.core import Lambda
 
@@ -35,6 +39,7 @@ MULTI_CONF = True
 
 CONF_ON_DOWNLOAD_FINISHED = "on_download_finished"
 CONF_PLACEHOLDER = "placeholder"
+CONF_STREAM = "stream"
 CONF_UPDATE = "update"
 
 _LOGGER = logging.getLogger(__name__)
@@ -134,6 +139,13 @@ ONLINE_IMAGE_SCHEMA = (
             cv.Required(CONF_FORMAT): cv.one_of(*IMAGE_FORMATS, upper=True),
             cv.Optional(CONF_PLACEHOLDER): cv.use_id(Image_),
             cv.Optional(CONF_BUFFER_SIZE, default=65536): cv.int_range(256, 65536),
+            cv.Optional(CONF_STREAM): cv.Schema(
+                {
+                    cv.Required(CONF_DISPLAY_ID): cv.use_id(display.Display),
+                    cv.Optional(CONF_X, default=0): cv.int_,
+                    cv.Optional(CONF_Y, default=0): cv.int_,
+                }
+            ),
             cv.Optional(CONF_ON_DOWNLOAD_FINISHED): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(
@@ -231,6 +243,10 @@ async def to_code(config):
         placeholder = await cg.get_variable(placeholder_id)
         cg.add(var.set_placeholder(placeholder))
 
+    if stream := config.get(CONF_STREAM):
+        disp = await cg.get_variable(stream[CONF_DISPLAY_ID])
+        cg.add(var.set_stream_target(disp, stream[CONF_X], stream[CONF_Y]))
+
     for conf in config.get(CONF_ON_DOWNLOAD_FINISHED, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
         await automation.build_automation(trigger, [(bool, "cached")], conf)
@@ -18,8 +18,21 @@ bool ImageDecoder::set_size(int width, int height) {
 void ImageDecoder::draw(int x, int y, int w, int h, const Color &color) {
   auto width = std::min(this->image_->buffer_width_, static_cast<int>(std::ceil((x + w) * this->x_scale_)));
   auto height = std::min(this->image_->buffer_height_, static_cast<int>(std::ceil((y + h) * this->y_scale_)));
-  for (int i = x * this->x_scale_; i < width; i++) {
-    for (int j = y * this->y_scale_; j < height; j++) {
+  const int x_start = x * this->x_scale_;
+  const int y_start = y * this->y_scale_;
+  if (this->image_->stream_display_ != nullptr) {
+    // Streaming: the decoded block goes straight to the display, scaled to the target size, nothing is kept
+    if (this->image_->has_transparency() && color.w < 0x80)
+      return;
+    if (width > x_start && height > y_start) {
+      this->image_->stream_display_->filled_rectangle(this->image_->stream_x_ + x_start,
+                                                      this->image_->stream_y_ + y_start, width - x_start,
+                                                      height - y_start, color);
+    }
+    return;
+  }
+  for (int i = x_start; i < width; i++) {
+    for (int j = y_start; j < height; j++) {
       this->image_->draw_pixel_(i, j, color);
     }
   }
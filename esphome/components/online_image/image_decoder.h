@@ -110,7 +110,7 @@ class DownloadBuffer {
   size_t resize(size_t size);
 
  protected:
-  RAMAllocator<uint8_t> allocator_{};
+  RAMAllocator<uint8_t> allocator_{RAMAllocator<uint8_t>::NONE, "image download buffer"};
   uint8_t *buffer_;
   size_t size_;
   /** Total number of downloaded bytes not yet read. */
@@ -48,7 +48,12 @@ OnlineImage::OnlineImage(const std::string &url, int width, int height, ImageFor
 }
 
 void OnlineImage::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
-  if (this->data_start_) {
+  if (this->stream_display_ != nullptr) {
+    // Streamed images are drawn into the target display while decoding, there is nothing to draw from
+    if (this->width_ == 0 && this->placeholder_) {
+      this->placeholder_->draw(x, y, display, color_on, color_off);
+    }
+  } else if (this->data_start_) {
     Image::draw(x, y, display, color_on, color_off);
   } else if (this->placeholder_) {
     this->placeholder_->draw(x, y, display, color_on, color_off);
@@ -82,6 +87,14 @@ size_t OnlineImage::resize_(int width_in, int height_in) {
     }
   }
   size_t new_size = this->get_buffer_size_(width, height);
+  if (this->stream_display_ != nullptr) {
+    // Nothing to allocate, the decoder only needs the target size to scale to
+    this->buffer_width_ = width;
+    this->buffer_height_ = height;
+    this->width_ = width;
+    ESP_LOGV(TAG, "Streaming size: (%d, %d)", width, height);
+    return new_size;
+  }
   if (this->buffer_) {
     // Buffer already allocated => no need to resize
     return new_size;
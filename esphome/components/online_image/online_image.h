@@ -80,6 +80,23 @@ class OnlineImage : public PollingComponent,
    */
   void set_placeholder(image::Image *placeholder) { this->placeholder_ = placeholder; }
 
+  /**
+   * @brief Decode the image straight into a display instead of an image buffer.
+   *
+   * Decoded blocks are drawn at their final position while the image downloads, so no buffer of
+   * width x height pixels is needed. The image can then not be redrawn without downloading it again;
+   * the display must not clear or overwrite that area on its updates.
+   *
+   * @param display The display to draw the image into.
+   * @param x Horizontal position of the image's top-left corner on the display.
+   * @param y Vertical position of the image's top-left corner on the display.
+   */
+  void set_stream_target(display::Display *display, int x, int y) {
+    this->stream_display_ = display;
+    this->stream_x_ = x;
+    this->stream_y_ = y;
+  }
+
   /**
    * Release the buffer storing the image. The image will need to be downloaded again
    * to be able to be displayed.
@@ -99,7 +116,7 @@ class OnlineImage : public PollingComponent,
  protected:
   bool validate_url_(const std::string &url);
 
-  RAMAllocator<uint8_t> allocator_{};
+  RAMAllocator<uint8_t> allocator_{RAMAllocator<uint8_t>::NONE, "online image"};
 
   uint32_t get_buffer_size_() const { return get_buffer_size_(this->buffer_width_, this->buffer_height_); }
   int get_buffer_size_(int width, int height) const { return (this->get_bpp() * width + 7u) / 8u * height; }
@@ -156,6 +173,11 @@ class OnlineImage : public PollingComponent,
   const ImageFormat format_;
   image::Image *placeholder_{nullptr};
 
+  /** Display the image is decoded into, or nullptr to decode into `buffer_`. */
+  display::Display *stream_display_{nullptr};
+  int stream_x_{0};
+  int stream_y_{0};
+
   std::string url_{""};
 
   std::vector<std::pair<std::string, TemplatableValue<std::string> > > request_headers_;
@@ -13,12 +13,15 @@ import esphome.final_validate as fv
 from .const import (
     CONF_DEVICE_TYPE,
     CONF_EXT_PAN_ID,
+    CONF_FAST_POLL_DURATION,
+    CONF_FAST_POLL_PERIOD,
     CONF_FORCE_DATASET,
     CONF_MDNS_ID,
     CONF_MESH_LOCAL_PREFIX,
     CONF_NETWORK_KEY,
     CONF_NETWORK_NAME,
     CONF_PAN_ID,
+    CONF_POLL_PERIOD,
     CONF_PSKC,
     CONF_SRP_ID,
     CONF_TLV,
@@ -95,6 +98,26 @@ openthread_ns = cg.esphome_ns.namespace("openthread")
 OpenThreadComponent = openthread_ns.class_("OpenThreadComponent", cg.Component)
 OpenThreadSrpComponent = openthread_ns.class_("OpenThreadSrpComponent", cg.Component)
 
+# Limits of otLinkSetPollPeriod
+_poll_period = cv.All(
+    cv.positive_time_period_milliseconds,
+    cv.Range(
+        min=cv.TimePeriod(milliseconds=10),
+        max=cv.TimePeriod(milliseconds=0x3FFFFFF),
+    ),
+)
+
+
+def _validate_poll_period(config):
+    if CONF_POLL_PERIOD in config and config[CONF_DEVICE_TYPE] != "MTD":
+        raise cv.Invalid(
+            f"{CONF_POLL_PERIOD} only applies to sleepy end devices, "
+            f"set {CONF_DEVICE_TYPE}: MTD",
+            path=[CONF_POLL_PERIOD],
+        )
+    return config
+
+
 _CONNECTION_SCHEMA = cv.Schema(
     {
         cv.Optional(CONF_PAN_ID): cv.hex_int,
@@ -118,9 +141,15 @@ CONFIG_SCHEMA = cv.All(
             ),
             cv.Optional(CONF_FORCE_DATASET): cv.boolean,
             cv.Optional(CONF_TLV): cv.string_strict,
+            cv.Optional(CONF_POLL_PERIOD): _poll_period,
+            cv.Optional(CONF_FAST_POLL_PERIOD, default="100ms"): _poll_period,
+            cv.Optional(
+                CONF_FAST_POLL_DURATION, default="5s"
+            ): cv.positive_time_period_milliseconds,
         }
     ).extend(_CONNECTION_SCHEMA),
     cv.has_exactly_one_key(CONF_NETWORK_KEY, CONF_TLV),
+    _validate_poll_period,
     cv.only_with_esp_idf,
     only_on_variant(supported=[VARIANT_ESP32C6, VARIANT_ESP32H2]),
 )
@@ -144,6 +173,10 @@ async def to_code(config):
 
     ot = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(ot, config)
+    if poll_period := config.get(CONF_POLL_PERIOD):
+        cg.add(ot.set_poll_period(poll_period))
+        cg.add(ot.set_fast_poll_period(config[CONF_FAST_POLL_PERIOD]))
+        cg.add(ot.set_fast_poll_duration(config[CONF_FAST_POLL_DURATION]))
 
     srp = cg.new_Pvariable(config[CONF_SRP_ID])
     mdns_component = await cg.get_variable(config[CONF_MDNS_ID])
@@ -1,11 +1,14 @@
 CONF_DEVICE_TYPE = "device_type"
 CONF_EXT_PAN_ID = "ext_pan_id"
+CONF_FAST_POLL_DURATION = "fast_poll_duration"
+CONF_FAST_POLL_PERIOD = "fast_poll_period"
 CONF_FORCE_DATASET = "force_dataset"
 CONF_MDNS_ID = "mdns_id"
 CONF_MESH_LOCAL_PREFIX = "mesh_local_prefix"
 CONF_NETWORK_NAME = "network_name"
 CONF_NETWORK_KEY = "network_key"
 CONF_PAN_ID = "pan_id"
+CONF_POLL_PERIOD = "poll_period"
 CONF_PSKC = "pskc"
 CONF_SRP_ID = "srp_id"
 CONF_TLV = "tlv"
@@ -6,12 +6,14 @@
 
 #include <openthread/cli.h>
 #include <openthread/instance.h>
+#include <openthread/link.h>
 #include <openthread/logging.h>
 #include <openthread/netdata.h>
 #include <openthread/srp_client.h>
 #include <openthread/srp_client_buffers.h>
 #include <openthread/tasklet.h>
 
+#include <cinttypes>
 #include <cstring>
 
 #include "esphome/core/application.h"
@@ -20,6 +22,10 @@
 
 static const char *const TAG = "openthread";
 
+// How often the data traffic is checked to switch the poll period
+static const uint32_t POLL_CHECK_INTERVAL = 250;
+static const uint32_t POLL_STATS_INTERVAL = 60 * 60 * 1000;
+
 namespace esphome {
 namespace openthread {
 
@@ -58,6 +64,76 @@ bool OpenThreadComponent::is_connected() {
   return role >= OT_DEVICE_ROLE_CHILD;
 }
 
+void OpenThreadComponent::dump_config() {
+  ESP_LOGCONFIG(TAG, "OpenThread:");
+  if (this->poll_period_ == 0)
+    return;
+  ESP_LOGCONFIG(TAG,
+                "  Poll Period: %" PRIu32 " ms\n"
+                "  Fast Poll Period: %" PRIu32 " ms\n"
+                "  Fast Poll Duration: %" PRIu32 " ms",
+                this->poll_period_, this->fast_poll_period_, this->fast_poll_duration_);
+}
+
+void OpenThreadComponent::request_fast_poll() { this->fast_poll_until_ = millis() + this->fast_poll_duration_; }
+
+void OpenThreadComponent::setup_poll_scheduler_() {
+  if (this->poll_period_ == 0)
+    return;
+  this->last_check_ = this->stats_start_ = millis();
+  this->set_interval("poll", POLL_CHECK_INTERVAL, [this]() { this->update_poll_period_(); });
+}
+
+void OpenThreadComponent::update_poll_period_() {
+  // Don't hold up the main loop if the OpenThread task is busy, the next check will catch up
+  auto lock = InstanceLock::try_acquire(0);
+  if (!lock)
+    return;
+  otInstance *instance = lock->get_instance();
+  // Only a child has a parent to poll
+  if (instance == nullptr || otThreadGetDeviceRole(instance) != OT_DEVICE_ROLE_CHILD)
+    return;
+
+  const uint32_t now = millis();
+  const otMacCounters *counters = otLinkGetCounters(instance);
+  // Data frames in either direction mean something talks to the device, a reply or a command may follow.
+  // The data requests of the polls themselves are counted separately, so polling doesn't keep itself fast.
+  if (counters->mTxData != this->last_tx_data_ || counters->mRxData != this->last_rx_data_)
+    this->request_fast_poll();
+  this->last_tx_data_ = counters->mTxData;
+  this->last_rx_data_ = counters->mRxData;
+
+  if (this->current_poll_period_ == this->fast_poll_period_)
+    this->stats_fast_poll_ms_ += now - this->last_check_;
+  this->last_check_ = now;
+
+  const bool fast = static_cast<int32_t>(this->fast_poll_until_ - now) > 0;
+  const uint32_t period = fast ? this->fast_poll_period_ : this->poll_period_;
+  if (period != this->current_poll_period_) {
+    otError error = otLinkSetPollPeriod(instance, period);
+    if (error != OT_ERROR_NONE) {
+      ESP_LOGW(TAG, "Setting poll period to %" PRIu32 " ms failed: %s", period, otThreadErrorToString(error));
+    } else {
+      ESP_LOGV(TAG, "Poll period %" PRIu32 " ms", period);
+      this->current_poll_period_ = period;
+    }
+  }
+
+  if (now - this->stats_start_ >= POLL_STATS_INTERVAL) {
+    // The radio of a sleepy end device is mostly on for the polls and the frames around them
+    ESP_LOGD(TAG,
+             "Last hour: %" PRIu32 " data polls, %" PRIu32 " data frames sent, %" PRIu32 " received, %" PRIu32
+             " s fast polling",
+             counters->mTxDataPoll - this->stats_tx_data_poll_, counters->mTxData - this->stats_tx_data_,
+             counters->mRxData - this->stats_rx_data_, this->stats_fast_poll_ms_ / 1000);
+    this->stats_start_ = now;
+    this->stats_tx_data_poll_ = counters->mTxDataPoll;
+    this->stats_tx_data_ = counters->mTxData;
+    this->stats_rx_data_ = counters->mRxData;
+    this->stats_fast_poll_ms_ = 0;
+  }
+}
+
 // Gets the off-mesh routable address
 std::optional<otIp6Address> OpenThreadComponent::get_omr_address() {
   InstanceLock lock = InstanceLock::acquire();
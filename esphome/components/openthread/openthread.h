@@ -21,6 +21,7 @@ class OpenThreadComponent : public Component {
   OpenThreadComponent();
   ~OpenThreadComponent();
   void setup() override;
+  void dump_config() override;
   float get_setup_priority() const override { return setup_priority::WIFI; }
 
   bool is_connected();
@@ -28,8 +29,33 @@ class OpenThreadComponent : public Component {
   std::optional<otIp6Address> get_omr_address();
   void ot_main();
 
+  /// Data poll period of a sleepy end device while nothing talks to it, 0 leaves it to OpenThread
+  void set_poll_period(uint32_t poll_period) { this->poll_period_ = poll_period; }
+  void set_fast_poll_period(uint32_t fast_poll_period) { this->fast_poll_period_ = fast_poll_period; }
+  void set_fast_poll_duration(uint32_t fast_poll_duration) { this->fast_poll_duration_ = fast_poll_duration; }
+  /// Polls at the fast poll period for the fast poll duration, for example when a reply is expected
+  void request_fast_poll();
+
  protected:
   std::optional<otIp6Address> get_omr_address_(InstanceLock &lock);
+  void setup_poll_scheduler_();
+  /// Switches between the fast and the slow poll period depending on the recent data traffic
+  void update_poll_period_();
+
+  uint32_t poll_period_{0};
+  uint32_t fast_poll_period_{0};
+  uint32_t fast_poll_duration_{0};
+  uint32_t fast_poll_until_{0};
+  uint32_t current_poll_period_{0};
+  uint32_t last_check_{0};
+  uint32_t last_tx_data_{0};
+  uint32_t last_rx_data_{0};
+  // Counters of the current hour for the poll statistics
+  uint32_t stats_start_{0};
+  uint32_t stats_tx_data_poll_{0};
+  uint32_t stats_tx_data_{0};
+  uint32_t stats_rx_data_{0};
+  uint32_t stats_fast_poll_ms_{0};
 };
 
 extern OpenThreadComponent *global_openthread_component;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -47,6 +47,8 @@ void OpenThreadComponent::setup() {
         vTaskDelete(nullptr);
       },
       "ot_main", 10240, this, 5, nullptr);
+
+  this->setup_poll_scheduler_();
 }
 
 static esp_netif_t *init_openthread_netif(const esp_openthread_platform_config_t *config) {
@@ -124,8 +124,23 @@ async def ota_to_code(var, config):
         cg.add_define("USE_OTA_STATE_CALLBACK")
 
 
+# Platforms whose backends can't decompress an update themselves
+GZIP_PLATFORMS = {
+    PlatformFramework.ESP32_ARDUINO,
+    PlatformFramework.ESP32_IDF,
+    PlatformFramework.BK72XX_ARDUINO,
+    PlatformFramework.RTL87XX_ARDUINO,
+    PlatformFramework.LN882X_ARDUINO,
+}
+
 FILTER_SOURCE_FILES = filter_source_files_from_platform(
     {
+        "gzip_inflater.cpp": GZIP_PLATFORMS,
+        "ota_backend_gzip.cpp": GZIP_PLATFORMS,
+        "ota_write_task.cpp": {
+            PlatformFramework.ESP32_ARDUINO,
+            PlatformFramework.ESP32_IDF,
+        },
         "ota_backend_arduino_esp32.cpp": {PlatformFramework.ESP32_ARDUINO},
         "ota_backend_esp_idf.cpp": {PlatformFramework.ESP32_IDF},
         "ota_backend_arduino_esp8266.cpp": {PlatformFramework.ESP8266_ARDUINO},
@@ -0,0 +1,385 @@
+#include "gzip_inflater.h"
+
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace ota {
+
+static const uint8_t GZIP_ID1 = 0x1F;
+static const uint8_t GZIP_ID2 = 0x8B;
+static const uint8_t GZIP_METHOD_DEFLATE = 8;
+static const uint8_t GZIP_FHCRC = 0x02;
+static const uint8_t GZIP_FEXTRA = 0x04;
+static const uint8_t GZIP_FNAME = 0x08;
+static const uint8_t GZIP_FCOMMENT = 0x10;
+static const uint8_t GZIP_FRESERVED = 0xE0;
+
+static const uint8_t MAX_CODE_BITS = 15;
+static const uint16_t END_OF_BLOCK = 256;
+static const size_t MAX_LENGTH_CODES = 286;
+static const size_t MAX_DIST_CODES = 30;
+static const size_t FIXED_LENGTH_CODES = 288;
+
+static const uint16_t LENGTH_BASE[29] = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                         31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                         2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const uint16_t DIST_BASE[30] = {1,    2,    3,    4,    5,    7,    9,    13,    17,    25,
+                                       33,   49,   65,   97,   129,  193,  257,  385,   513,   769,
+                                       1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static const uint8_t DIST_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6,
+                                       6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+// order of the code length code lengths in a dynamic block header
+static const uint8_t CODE_LENGTH_ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len) {
+  // half-byte table, a full one would take 1kB
+  static const uint32_t TABLE[16] = {0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+                                     0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+                                     0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+  crc = ~crc;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    crc = (crc >> 4) ^ TABLE[crc & 0x0F];
+    crc = (crc >> 4) ^ TABLE[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+GzipInflater::~GzipInflater() {
+  RAMAllocator<uint8_t> allocator;
+  if (this->window_ != nullptr)
+    allocator.deallocate(this->window_, WINDOW_SIZE);
+  if (this->input_ != nullptr)
+    allocator.deallocate(this->input_, INPUT_SIZE);
+}
+
+bool GzipInflater::init() {
+  RAMAllocator<uint8_t> allocator;
+  if (this->window_ == nullptr)
+    this->window_ = allocator.allocate(WINDOW_SIZE);
+  if (this->input_ == nullptr)
+    this->input_ = allocator.allocate(INPUT_SIZE);
+  return this->window_ != nullptr && this->input_ != nullptr;
+}
+
+GzipInflater::Status GzipInflater::feed(const uint8_t *data, size_t len) {
+  while (len > 0) {
+    // Keep the input a step may still need at the front
+    if (this->in_pos_ > 0) {
+      memmove(this->input_, this->input_ + this->in_pos_, this->in_len_ - this->in_pos_);
+      this->in_len_ -= this->in_pos_;
+      this->in_pos_ = 0;
+    }
+    const size_t copy = std::min(len, INPUT_SIZE - this->in_len_);
+    memcpy(this->input_ + this->in_len_, data, copy);
+    this->in_len_ += copy;
+    data += copy;
+    len -= copy;
+    Status status = this->run_(false);
+    if (status != STATUS_OK)
+      return status;
+  }
+  return this->flush_() ? STATUS_OK : STATUS_ERROR;
+}
+
+GzipInflater::Status GzipInflater::finish() {
+  Status status = this->run_(true);
+  if (status == STATUS_OK)
+    return STATUS_ERROR;  // the stream ended early
+  return status;
+}
+
+GzipInflater::Status GzipInflater::run_(bool final) {
+  while (this->state_ != STATE_DONE && this->state_ != STATE_ERROR) {
+    if (!final && this->in_len_ - this->in_pos_ < MAX_STEP_INPUT)
+      return STATUS_OK;
+    if (!this->step_() || this->overrun_ || this->sink_failed_) {
+      this->state_ = STATE_ERROR;
+      break;
+    }
+  }
+  if (this->state_ == STATE_ERROR)
+    return STATUS_ERROR;
+  return STATUS_DONE;
+}
+
+uint32_t GzipInflater::bits_(uint8_t count) {
+  // up to 16 bits, the buffer never holds more than 23
+  while (this->bit_count_ < count) {
+    if (this->in_pos_ == this->in_len_) {
+      this->overrun_ = true;
+      return 0;
+    }
+    this->bit_buf_ |= static_cast<uint32_t>(this->input_[this->in_pos_++]) << this->bit_count_;
+    this->bit_count_ += 8;
+  }
+  const uint32_t value = this->bit_buf_ & ((1u << count) - 1);
+  this->bit_buf_ >>= count;
+  this->bit_count_ -= count;
+  return value;
+}
+
+int GzipInflater::decode_(const Huffman &huffman) {
+  // Canonical codes of a length are consecutive, their symbols are sorted by code
+  int code = 0;
+  int first = 0;
+  int index = 0;
+  for (uint8_t len = 1; len <= MAX_CODE_BITS; len++) {
+    code |= static_cast<int>(this->bits_(1));
+    const int count = huffman.count[len];
+    if (code - count < first)
+      return huffman.symbol[index + (code - first)];
+    index += count;
+    first += count;
+    first <<= 1;
+    code <<= 1;
+  }
+  return -1;
+}
+
+bool GzipInflater::build_(Huffman &huffman, const uint8_t *lengths, size_t count) {
+  memset(huffman.count, 0, sizeof(huffman.count));
+  for (size_t symbol = 0; symbol < count; symbol++)
+    huffman.count[lengths[symbol]]++;
+  if (huffman.count[0] == count)
+    return true;  // no codes, fine as long as none are used
+
+  // Reject more codes than fit the lengths
+  int left = 1;
+  for (uint8_t len = 1; len <= MAX_CODE_BITS; len++) {
+    left <<= 1;
+    left -= huffman.count[len];
+    if (left < 0)
+      return false;
+  }
+
+  uint16_t offsets[MAX_CODE_BITS + 1];
+  offsets[1] = 0;
+  for (uint8_t len = 1; len < MAX_CODE_BITS; len++)
+    offsets[len + 1] = offsets[len] + huffman.count[len];
+  for (size_t symbol = 0; symbol < count; symbol++) {
+    if (lengths[symbol] != 0)
+      huffman.symbol[offsets[lengths[symbol]]++] = symbol;
+  }
+  return true;
+}
+
+void GzipInflater::fixed_header_() {
+  uint8_t lengths[FIXED_LENGTH_CODES];
+  size_t symbol = 0;
+  for (; symbol < 144; symbol++)
+    lengths[symbol] = 8;
+  for (; symbol < 256; symbol++)
+    lengths[symbol] = 9;
+  for (; symbol < 280; symbol++)
+    lengths[symbol] = 7;
+  for (; symbol < FIXED_LENGTH_CODES; symbol++)
+    lengths[symbol] = 8;
+  build_(this->lencode_, lengths, FIXED_LENGTH_CODES);
+  for (symbol = 0; symbol < MAX_DIST_CODES; symbol++)
+    lengths[symbol] = 5;
+  build_(this->distcode_, lengths, MAX_DIST_CODES);
+}
+
+bool GzipInflater::dynamic_header_() {
+  const size_t nlen = this->bits_(5) + 257;
+  const size_t ndist = this->bits_(5) + 1;
+  const size_t ncode = this->bits_(4) + 4;
+  if (nlen > MAX_LENGTH_CODES || ndist > MAX_DIST_CODES)
+    return false;
+
+  uint8_t lengths[MAX_LENGTH_CODES + MAX_DIST_CODES];
+  for (size_t i = 0; i < 19; i++)
+    lengths[CODE_LENGTH_ORDER[i]] = i < ncode ? this->bits_(3) : 0;
+  // The length codes use lencode_ until the lengths of the actual codes are read
+  if (!build_(this->lencode_, lengths, 19))
+    return false;
+
+  size_t index = 0;
+  while (index < nlen + ndist) {
+    int symbol = this->decode_(this->lencode_);
+    if (symbol < 0)
+      return false;
+    if (symbol < 16) {
+      lengths[index++] = symbol;
+      continue;
+    }
+    uint8_t len = 0;
+    size_t repeat;
+    if (symbol == 16) {
+      if (index == 0)
+        return false;
+      len = lengths[index - 1];
+      repeat = 3 + this->bits_(2);
+    } else if (symbol == 17) {
+      repeat = 3 + this->bits_(3);
+    } else {
+      repeat = 11 + this->bits_(7);
+    }
+    if (index + repeat > nlen + ndist)
+      return false;
+    while (repeat-- > 0)
+      lengths[index++] = len;
+  }
+
+  // A block without an end can't be decoded
+  if (lengths[END_OF_BLOCK] == 0)
+    return false;
+  return build_(this->lencode_, lengths, nlen) && build_(this->distcode_, lengths + nlen, ndist);
+}
+
+bool GzipInflater::codes_step_() {
+  const int symbol = this->decode_(this->lencode_);
+  if (symbol < 0)
+    return false;
+  if (symbol < END_OF_BLOCK) {
+    this->put_(symbol);
+    return true;
+  }
+  if (symbol == END_OF_BLOCK) {
+    this->state_ = this->last_block_ ? STATE_TRAILER : STATE_BLOCK_HEADER;
+    return true;
+  }
+
+  const int length_code = symbol - END_OF_BLOCK - 1;
+  if (length_code >= 29)
+    return false;
+  size_t length = LENGTH_BASE[length_code] + this->bits_(LENGTH_EXTRA[length_code]);
+  const int dist_code = this->decode_(this->distcode_);
+  if (dist_code < 0 || dist_code >= static_cast<int>(MAX_DIST_CODES))
+    return false;
+  const size_t dist = DIST_BASE[dist_code] + this->bits_(DIST_EXTRA[dist_code]);
+  if (dist > this->total_out_)
+    return false;  // before the start of the output
+
+  size_t from = (this->window_pos_ + WINDOW_SIZE - dist) % WINDOW_SIZE;
+  while (length-- > 0) {
+    this->put_(this->window_[from]);
+    from = (from + 1) % WINDOW_SIZE;
+  }
+  return true;
+}
+
+bool GzipInflater::step_() {
+  switch (this->state_) {
+    case STATE_GZIP_HEADER: {
+      uint8_t header[10];
+      for (uint8_t &byte : header)
+        byte = this->bits_(8);
+      if (header[0] != GZIP_ID1 || header[1] != GZIP_ID2 || header[2] != GZIP_METHOD_DEFLATE ||
+          (header[3] & GZIP_FRESERVED) != 0)
+        return false;
+      this->gzip_flags_ = header[3];
+      this->state_ = STATE_GZIP_EXTRA;
+      return true;
+    }
+    case STATE_GZIP_EXTRA:
+      if (this->gzip_flags_ & GZIP_FEXTRA) {
+        size_t len = this->bits_(16);
+        if (len > MAX_STEP_INPUT - 2)
+          return false;
+        while (len-- > 0)
+          this->bits_(8);
+      }
+      this->state_ = STATE_GZIP_NAME;
+      return true;
+    case STATE_GZIP_NAME:
+      // a byte per step until the terminator, the name can be longer than a step reads
+      if ((this->gzip_flags_ & GZIP_FNAME) == 0 || this->bits_(8) == 0)
+        this->state_ = STATE_GZIP_COMMENT;
+      return true;
+    case STATE_GZIP_COMMENT:
+      if ((this->gzip_flags_ & GZIP_FCOMMENT) == 0 || this->bits_(8) == 0)
+        this->state_ = STATE_GZIP_HCRC;
+      return true;
+    case STATE_GZIP_HCRC:
+      if (this->gzip_flags_ & GZIP_FHCRC)
+        this->bits_(16);
+      this->state_ = STATE_BLOCK_HEADER;
+      return true;
+    case STATE_BLOCK_HEADER: {
+      this->last_block_ = this->bits_(1) != 0;
+      const uint32_t type = this->bits_(2);
+      if (type == 0) {
+        // Stored blocks start at a byte boundary
+        this->bits_(this->bit_count_ % 8);
+        const uint32_t len = this->bits_(16);
+        const uint32_t nlen = this->bits_(16);
+        if (len != (~nlen & 0xFFFF))
+          return false;
+        this->stored_left_ = len;
+        this->state_ = STATE_STORED;
+        return true;
+      }
+      if (type == 1) {
+        this->fixed_header_();
+      } else if (type != 2 || !this->dynamic_header_()) {
+        return false;
+      }
+      this->state_ = STATE_CODES;
+      return true;
+    }
+    case STATE_STORED: {
+      if (this->stored_left_ > 0 && this->bit_count_ == 0 && this->in_pos_ == this->in_len_)
+        return false;  // the stream ended
+      while (this->stored_left_ > 0 && this->bit_count_ >= 8) {
+        this->put_(this->bits_(8));
+        this->stored_left_--;
+      }
+      while (this->stored_left_ > 0 && this->in_pos_ < this->in_len_) {
+        this->put_(this->input_[this->in_pos_++]);
+        this->stored_left_--;
+      }
+      if (this->stored_left_ == 0)
+        this->state_ = this->last_block_ ? STATE_TRAILER : STATE_BLOCK_HEADER;
+      return true;
+    }
+    case STATE_CODES:
+      return this->codes_step_();
+    case STATE_TRAILER: {
+      if (!this->flush_())
+        return false;
+      this->bits_(this->bit_count_ % 8);
+      uint32_t crc = this->bits_(16);
+      crc |= this->bits_(16) << 16;
+      uint32_t size = this->bits_(16);
+      size |= this->bits_(16) << 16;
+      // the size is stored modulo 2^32
+      if (crc != this->crc_ || size != static_cast<uint32_t>(this->total_out_))
+        return false;
+      this->state_ = STATE_DONE;
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+void GzipInflater::put_(uint8_t byte) {
+  this->window_[this->window_pos_++] = byte;
+  this->total_out_++;
+  if (this->window_pos_ == WINDOW_SIZE) {
+    this->flush_();
+    this->window_pos_ = 0;
+    this->flushed_ = 0;
+  }
+}
+
+bool GzipInflater::flush_() {
+  if (this->window_pos_ == this->flushed_)
+    return !this->sink_failed_;
+  uint8_t *start = this->window_ + this->flushed_;
+  const size_t len = this->window_pos_ - this->flushed_;
+  this->flushed_ = this->window_pos_;
+  this->crc_ = crc32_update(this->crc_, start, len);
+  if (!this->sink_failed_ && this->sink_ && !this->sink_(start, len))
+    this->sink_failed_ = true;
+  return !this->sink_failed_;
+}
+
+}  // namespace ota
+}  // namespace esphome
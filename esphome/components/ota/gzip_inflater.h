@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace esphome {
+namespace ota {
+
+/** Streaming decompressor of a gzip file (RFC 1952) with a deflate stream (RFC 1951).
+ *
+ * Input is fed in pieces as it arrives, the output is passed to a sink in pieces of up to the 32kB window.
+ */
+class GzipInflater {
+ public:
+  enum Status : uint8_t { STATUS_OK, STATUS_DONE, STATUS_ERROR };
+  /// Receives decompressed data, returns false to stop with an error
+  using Sink = std::function<bool(uint8_t *data, size_t len)>;
+
+  ~GzipInflater();
+  /// Allocates the buffers, returns false without the memory for them
+  bool init();
+  void set_sink(Sink &&sink) { this->sink_ = std::move(sink); }
+
+  Status feed(const uint8_t *data, size_t len);
+  /// Decompresses the rest of the input, the stream has to end with it
+  Status finish();
+
+  size_t get_output_size() const { return this->total_out_; }
+
+ protected:
+  static const size_t WINDOW_SIZE = 32768;
+  static const size_t INPUT_SIZE = 2048;
+  // The most input one step reads, a dynamic block header. Steps only run with as much input at hand, until the end.
+  static const size_t MAX_STEP_INPUT = 640;
+
+  struct Huffman {
+    uint16_t count[16];
+    uint16_t symbol[288];
+  };
+
+  enum State : uint8_t {
+    STATE_GZIP_HEADER,
+    STATE_GZIP_EXTRA,
+    STATE_GZIP_NAME,
+    STATE_GZIP_COMMENT,
+    STATE_GZIP_HCRC,
+    STATE_BLOCK_HEADER,
+    STATE_STORED,
+    STATE_CODES,
+    STATE_TRAILER,
+    STATE_DONE,
+    STATE_ERROR,
+  };
+
+  Status run_(bool final);
+  bool step_();
+  uint32_t bits_(uint8_t count);
+  int decode_(const Huffman &huffman);
+  static bool build_(Huffman &huffman, const uint8_t *lengths, size_t count);
+  bool dynamic_header_();
+  void fixed_header_();
+  bool codes_step_();
+  void put_(uint8_t byte);
+  bool flush_();
+
+  Sink sink_;
+  uint8_t *window_{nullptr};
+  uint8_t *input_{nullptr};
+  Huffman lencode_;
+  Huffman distcode_;
+  size_t in_pos_{0};
+  size_t in_len_{0};
+  size_t window_pos_{0};
+  size_t flushed_{0};
+  size_t total_out_{0};
+  uint32_t crc_{0};
+  uint32_t bit_buf_{0};
+  uint16_t stored_left_{0};
+  uint8_t bit_count_{0};
+  uint8_t gzip_flags_{0};
+  State state_{STATE_GZIP_HEADER};
+  bool last_block_{false};
+  bool overrun_{false};
+  bool sink_failed_{false};
+};
+
+}  // namespace ota
+}  // namespace esphome
@@ -0,0 +1,82 @@
+#include "ota_backend_gzip.h"
+
+#ifdef USE_MD5
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cstring>
+
+namespace esphome {
+namespace ota {
+
+static const char *const TAG = "ota.gzip";
+
+OTAResponseTypes GzipOTABackend::begin(size_t image_size) {
+  this->compressed_size_ = image_size;
+  this->md5_.init();
+  this->inflater_->set_sink([this](uint8_t *data, size_t len) {
+    const uint32_t start = micros();
+    this->write_error_ = this->backend_->write(data, len);
+    this->write_us_ += micros() - start;
+    return this->write_error_ == OTA_RESPONSE_OK;
+  });
+  // The size after decompression is only known at the end
+  return this->backend_->begin(0);
+}
+
+void GzipOTABackend::set_update_md5(const char *md5) {
+  // The checksum is of the compressed upload, so the backend doesn't get it
+  memcpy(this->expected_md5_, md5, 32);
+  this->md5_set_ = true;
+}
+
+OTAResponseTypes GzipOTABackend::write(uint8_t *data, size_t len) {
+  this->md5_.add(data, len);
+  const uint32_t start = micros();
+  GzipInflater::Status status = this->inflater_->feed(data, len);
+  this->inflate_us_ += micros() - start;
+  if (status == GzipInflater::STATUS_ERROR) {
+    if (this->write_error_ != OTA_RESPONSE_OK)
+      return this->write_error_;
+    ESP_LOGW(TAG, "Decompression failed");
+    return OTA_RESPONSE_ERROR_DECOMPRESS;
+  }
+  return OTA_RESPONSE_OK;
+}
+
+OTAResponseTypes GzipOTABackend::end() {
+  const uint32_t start = micros();
+  GzipInflater::Status status = this->inflater_->finish();
+  this->inflate_us_ += micros() - start;
+  if (status != GzipInflater::STATUS_DONE) {
+    this->backend_->abort();
+    if (this->write_error_ != OTA_RESPONSE_OK)
+      return this->write_error_;
+    ESP_LOGW(TAG, "Decompression failed");
+    return OTA_RESPONSE_ERROR_DECOMPRESS;
+  }
+  if (this->md5_set_) {
+    this->md5_.calculate();
+    if (!this->md5_.equals_hex(this->expected_md5_)) {
+      this->backend_->abort();
+      return OTA_RESPONSE_ERROR_MD5_MISMATCH;
+    }
+  }
+
+  const size_t size = this->inflater_->get_output_size();
+  // Writing to flash happens while decompressing, it's not part of the decompression time
+  const uint32_t decompress_ms = (this->inflate_us_ - this->write_us_) / 1000;
+  ESP_LOGI(TAG,
+           "Decompressed %" PRIu32 " bytes to %" PRIu32 " in %" PRIu32 "ms (%" PRIu32 " kB/s), "
+           "writing took %" PRIu32 "ms",
+           static_cast<uint32_t>(this->compressed_size_), static_cast<uint32_t>(size), decompress_ms,
+           decompress_ms > 0 ? static_cast<uint32_t>(size / decompress_ms) : 0, this->write_us_ / 1000);
+  return this->backend_->end();
+}
+
+void GzipOTABackend::abort() { this->backend_->abort(); }
+
+}  // namespace ota
+}  // namespace esphome
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+#include "gzip_inflater.h"
+#include "ota_backend.h"
+
+#include "esphome/components/md5/md5.h"
+
+#include <memory>
+
+#ifdef USE_MD5
+namespace esphome {
+namespace ota {
+
+/// Decompresses a gzip compressed update for a backend that can't do it itself
+class GzipOTABackend : public OTABackend {
+ public:
+  GzipOTABackend(std::unique_ptr<OTABackend> backend, std::unique_ptr<GzipInflater> inflater)
+      : backend_(std::move(backend)), inflater_(std::move(inflater)) {}
+
+  OTAResponseTypes begin(size_t image_size) override;
+  void set_update_md5(const char *md5) override;
+  OTAResponseTypes write(uint8_t *data, size_t len) override;
+  OTAResponseTypes end() override;
+  void abort() override;
+  bool supports_compression() override { return true; }
+
+ protected:
+  std::unique_ptr<OTABackend> backend_;
+  std::unique_ptr<GzipInflater> inflater_;
+  md5::MD5Digest md5_{};
+  char expected_md5_[32];
+  bool md5_set_{false};
+  OTAResponseTypes write_error_{OTA_RESPONSE_OK};
+  size_t compressed_size_{0};
+  // time spent decompressing and writing the decompressed data
+  uint32_t inflate_us_{0};
+  uint32_t write_us_{0};
+};
+
+}  // namespace ota
+}  // namespace esphome
+#endif
@@ -0,0 +1,118 @@
+#ifdef USE_ESP32
+#include "ota_write_task.h"
+
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace ota {
+
+static const char *const TAG = "ota.write_task";
+
+static constexpr uint32_t WAIT_SLICE_MS = 100;
+// Longer than the erase of a flash sector plus the write of a buffer, even on slow flash
+static constexpr uint32_t WRITE_TIMEOUT_MS = 10000;
+
+OTAWriteTask::~OTAWriteTask() {
+  if (this->task_handle_ != nullptr) {
+    // The backend must not be aborted while a write is still running
+    this->finish();
+    vTaskDelete(this->task_handle_);
+  }
+  if (this->filled_ != nullptr)
+    vQueueDelete(this->filled_);
+  if (this->free_ != nullptr)
+    vQueueDelete(this->free_);
+  if (this->buffers_ != nullptr) {
+    RAMAllocator<uint8_t> allocator(RAMAllocator<uint8_t>::ALLOC_INTERNAL);
+    allocator.deallocate(this->buffers_, BUFFER_SIZE * BUFFER_COUNT);
+  }
+}
+
+bool OTAWriteTask::start(OTABackend *backend) {
+  this->backend_ = backend;
+  RAMAllocator<uint8_t> allocator(RAMAllocator<uint8_t>::ALLOC_INTERNAL);
+  this->buffers_ = allocator.allocate(BUFFER_SIZE * BUFFER_COUNT);
+  this->filled_ = xQueueCreate(BUFFER_COUNT, sizeof(Chunk));
+  this->free_ = xQueueCreate(BUFFER_COUNT, sizeof(uint8_t *));
+  if (this->buffers_ == nullptr || this->filled_ == nullptr || this->free_ == nullptr) {
+    ESP_LOGW(TAG, "Not enough memory, writing synchronously");
+    return false;
+  }
+  for (uint8_t i = 0; i < BUFFER_COUNT; i++) {
+    uint8_t *buffer = this->buffers_ + i * BUFFER_SIZE;
+    xQueueSend(this->free_, &buffer, 0);
+  }
+  // Above the loop task, so a write starts as soon as a buffer is full. Receiving continues while the
+  // flash is busy with the write.
+  if (xTaskCreate(OTAWriteTask::task_, "ota_write", 4096, this, 2, &this->task_handle_) != pdPASS) {
+    this->task_handle_ = nullptr;
+    ESP_LOGW(TAG, "Could not start task, writing synchronously");
+    return false;
+  }
+  return true;
+}
+
+bool OTAWriteTask::take_free_(uint8_t **buffer) {
+  const uint32_t start = millis();
+  while (xQueueReceive(this->free_, buffer, pdMS_TO_TICKS(WAIT_SLICE_MS)) != pdTRUE) {
+    App.feed_wdt();
+    if (millis() - start > WRITE_TIMEOUT_MS) {
+      ESP_LOGW(TAG, "Timed out waiting for flash write");
+      return false;
+    }
+  }
+  return true;
+}
+
+uint8_t *OTAWriteTask::acquire() {
+  uint8_t *buffer;
+  if (this->get_error() != OTA_RESPONSE_OK || !this->take_free_(&buffer))
+    return nullptr;
+  this->held_++;
+  return buffer;
+}
+
+void OTAWriteTask::submit(uint8_t *buffer, size_t len) {
+  Chunk chunk{buffer, len};
+  // Can't block, the queue has room for every buffer
+  xQueueSend(this->filled_, &chunk, 0);
+  this->held_--;
+}
+
+OTAResponseTypes OTAWriteTask::finish() {
+  // All buffers are back once the last write completed
+  uint8_t *buffers[BUFFER_COUNT];
+  uint8_t taken = 0;
+  while (taken + this->held_ < BUFFER_COUNT) {
+    if (!this->take_free_(&buffers[taken])) {
+      this->error_.store(OTA_RESPONSE_ERROR_WRITING_FLASH, std::memory_order_release);
+      break;
+    }
+    taken++;
+  }
+  for (uint8_t i = 0; i < taken; i++)
+    xQueueSend(this->free_, &buffers[i], 0);
+  return this->get_error();
+}
+
+void OTAWriteTask::task_(void *arg) {
+  auto *write_task = static_cast<OTAWriteTask *>(arg);
+  Chunk chunk;
+  while (true) {
+    if (xQueueReceive(write_task->filled_, &chunk, portMAX_DELAY) != pdTRUE)
+      continue;
+    if (write_task->get_error() == OTA_RESPONSE_OK) {
+      OTAResponseTypes error = write_task->backend_->write(chunk.data, chunk.len);
+      if (error != OTA_RESPONSE_OK)
+        write_task->error_.store(error, std::memory_order_release);
+    }
+    xQueueSend(write_task->free_, &chunk.data, portMAX_DELAY);
+  }
+}
+
+}  // namespace ota
+}  // namespace esphome
+#endif
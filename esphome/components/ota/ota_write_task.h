@@ -0,0 +1,61 @@
+#pragma once
+#ifdef USE_ESP32
+#include "ota_backend.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace ota {
+
+/** Writes an update to a backend from its own task.
+ *
+ * The receiving side fills one buffer from the network while the task writes the previous one to flash, so the
+ * transfer doesn't stall for every flash write. Buffers are passed back and forth through two queues; a buffer only
+ * returns from acquire() once its data was written.
+ */
+class OTAWriteTask {
+ public:
+  static constexpr size_t BUFFER_SIZE = 4096;
+  static constexpr uint8_t BUFFER_COUNT = 2;
+
+  ~OTAWriteTask();
+
+  /// Starts writing to the backend. Returns false if the task or its buffers can't be allocated.
+  bool start(OTABackend *backend);
+  /// Waits for an empty buffer of BUFFER_SIZE bytes. Returns nullptr if a write failed or takes too long.
+  uint8_t *acquire();
+  /// Hands a buffer from acquire() to the task for writing its first len bytes.
+  void submit(uint8_t *buffer, size_t len);
+  /// Waits until all submitted buffers are written and returns the first error of the writes.
+  OTAResponseTypes finish();
+  /// First error of the writes so far, the remaining data is discarded after it.
+  OTAResponseTypes get_error() const { return this->error_.load(std::memory_order_acquire); }
+
+ protected:
+  struct Chunk {
+    uint8_t *data;
+    size_t len;
+  };
+
+  static void task_(void *arg);
+  bool take_free_(uint8_t **buffer);
+
+  OTABackend *backend_{nullptr};
+  uint8_t *buffers_{nullptr};
+  TaskHandle_t task_handle_{nullptr};
+  QueueHandle_t filled_{nullptr};
+  QueueHandle_t free_{nullptr};
+  /// Buffers handed out by acquire() and not submitted yet
+  uint8_t held_{0};
+  std::atomic<OTAResponseTypes> error_{OTA_RESPONSE_OK};
+};
+
+}  // namespace ota
+}  // namespace esphome
+#endif
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace output {
+
+/** Collects the values of a multi-channel output chip until its next loop().
+ *
+ * A light writes all its channels one after another, so chip drivers store the values here from write_state() and
+ * send them from loop(). The batch remembers the range of channels that changed since the last flush. Chips with
+ * auto-incrementing registers can then update all of them in one bus transaction instead of one per channel, and
+ * skip the transaction when nothing changed.
+ */
+template<typename T, size_t N> class ChannelBatch {
+ public:
+  /// Stores a channel's value. Returns true if it differs from the stored one.
+  bool set(size_t channel, T value) {
+    if (channel >= N || this->values_[channel] == value)
+      return false;
+    this->values_[channel] = value;
+    this->mark_dirty(channel);
+    return true;
+  }
+
+  /// Includes a channel in the next flush even if its value didn't change, like after setup.
+  void mark_dirty(size_t channel) {
+    if (channel >= N)
+      return;
+    if (!this->is_dirty()) {
+      this->first_dirty_ = channel;
+      this->last_dirty_ = channel;
+    } else if (channel < this->first_dirty_) {
+      this->first_dirty_ = channel;
+    } else if (channel > this->last_dirty_) {
+      this->last_dirty_ = channel;
+    }
+  }
+
+  T operator[](size_t channel) const { return this->values_[channel]; }
+
+  bool is_dirty() const { return this->first_dirty_ < N; }
+  /// First and last changed channel, only valid if is_dirty()
+  size_t first_dirty() const { return this->first_dirty_; }
+  size_t last_dirty() const { return this->last_dirty_; }
+
+  /// Forgets the changes after they were sent to the chip
+  void flushed() {
+    this->first_dirty_ = N;
+    this->last_dirty_ = 0;
+  }
+
+ protected:
+  T values_[N]{};
+  size_t first_dirty_{N};
+  size_t last_dirty_{0};
+};
+
+}  // namespace output
+}  // namespace esphome
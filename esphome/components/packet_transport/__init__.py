@@ -154,6 +154,15 @@ def packet_transport_sensor_schema(base_schema):
     )
 
 
+def remote_id_hash(remote_id: str) -> int:
+    """FNV-1a hash of the UTF-8 bytes of a remote id, used to look up received values."""
+    hash_value = 2166136261
+    for byte in remote_id.encode():
+        hash_value ^= byte
+        hash_value = (hash_value * 16777619) & 0xFFFFFFFF
+    return hash_value
+
+
 def hash_encryption_key(config: dict):
     return list(hashlib.sha256(config[CONF_KEY].encode()).digest())
 
@@ -22,6 +22,7 @@ from . import (
     PacketTransport,
     packet_transport_sensor_schema,
     provider_name_validate,
+    remote_id_hash,
 )
 
 STATUS_SENSOR_SCHEMA = binary_sensor.binary_sensor_schema(
@@ -73,4 +74,8 @@ async def to_code(config):
         cg.add_define("USE_STATUS_SENSOR")
     else:  # CONF_DATA is default
         remote_id = str(config.get(CONF_REMOTE_ID) or config.get(CONF_ID))
-        cg.add(comp.add_remote_binary_sensor(config[CONF_PROVIDER], remote_id, var))
+        cg.add(
+            comp.add_remote_binary_sensor(
+                config[CONF_PROVIDER], remote_id, remote_id_hash(remote_id), var
+            )
+        )
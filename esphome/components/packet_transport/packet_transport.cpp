@@ -75,6 +75,30 @@ enum DecodeResult {
 
 static const size_t MAX_PING_KEYS = 4;
 
+// must match remote_id_hash() in __init__.py
+static uint32_t fnv1a_hash(const char *str) {
+  uint32_t hash = 2166136261UL;
+  while (*str != 0) {
+    hash ^= (uint8_t) *str++;
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+template<typename T> static T *find_remote_entity(const std::vector<RemoteEntity<T>> &entities, const char *id) {
+  if (entities.empty())
+    return nullptr;
+  auto hash = fnv1a_hash(id);
+  auto it = std::lower_bound(entities.begin(), entities.end(), hash,
+                             [](const RemoteEntity<T> &e, uint32_t h) { return e.hash < h; });
+  // the id still has to be compared, in case two ids of this provider have the same hash
+  for (; it != entities.end() && it->hash == hash; it++) {
+    if (strcmp(it->id, id) == 0)
+      return it->entity;
+  }
+  return nullptr;
+}
+
 static inline void add(std::vector<uint8_t> &vec, uint32_t data) {
   vec.push_back(data & 0xFF);
   vec.push_back((data >> 8) & 0xFF);
@@ -228,6 +252,8 @@ void PacketTransport::setup() {
   }
 #endif
   // initialise the header. This is invariant.
+  this->data_.reserve(this->get_max_packet_size());
+  this->encode_buffer_.reserve(round4(this->get_max_packet_size()));
   add(this->header_, MAGIC_NUMBER);
   add(this->header_, this->name_);
   // pad to a multiple of 4 bytes
@@ -256,7 +282,8 @@ void PacketTransport::flush_() {
     return;
   auto header_len = round4(this->header_.size());
   auto len = round4(data_.size());
-  auto encode_buffer = std::vector<uint8_t>(round4(header_len + len));
+  auto &encode_buffer = this->encode_buffer_;
+  encode_buffer.assign(round4(header_len + len), 0);
   memcpy(encode_buffer.data(), this->header_.data(), this->header_.size());
   memcpy(encode_buffer.data() + header_len, this->data_.data(), this->data_.size());
   if (this->is_encrypted_()) {
@@ -333,13 +360,13 @@ void PacketTransport::update() {
       }
 #endif
 #ifdef USE_SENSOR
-      for (auto &sensor : this->remote_sensors_[provider.first]) {
-        sensor.second->publish_state(NAN);
+      for (auto &sensor : provider.second.sensors) {
+        sensor.entity->publish_state(NAN);
       }
 #endif
 #ifdef USE_BINARY_SENSOR
-      for (auto &sensor : this->remote_binary_sensors_[provider.first]) {
-        sensor.second->invalidate_state();
+      for (auto &sensor : provider.second.binary_sensors) {
+        sensor.entity->invalidate_state();
       }
 #endif
     } else {
@@ -420,19 +447,13 @@ void PacketTransport::process_(const std::vector<uint8_t> &data) {
     return;
   }
 
-  if (this->providers_.count(namebuf) == 0) {
+  auto provider_it = this->providers_.find(namebuf);
+  if (provider_it == this->providers_.end()) {
     ESP_LOGVV(TAG, "Unknown hostname %s", namebuf);
     return;
   }
   ESP_LOGV(TAG, "Found hostname %s", namebuf);
 
-#ifdef USE_SENSOR
-  auto &sensors = this->remote_sensors_[namebuf];
-#endif
-#ifdef USE_BINARY_SENSOR
-  auto &binary_sensors = this->remote_binary_sensors_[namebuf];
-#endif
-
   if (!decoder.bump_to(4)) {
     ESP_LOGW(TAG, "Bad packet length %zu", data.size());
   }
@@ -442,7 +463,7 @@ void PacketTransport::process_(const std::vector<uint8_t> &data) {
     return;
   }
 
-  auto &provider = this->providers_[namebuf];
+  auto &provider = provider_it->second;
   // if encryption not used with this host, ping check is pointless since it would be easily spoofed.
   if (provider.encryption_key.empty())
     ping_key_seen = true;
@@ -484,16 +505,18 @@ void PacketTransport::process_(const std::vector<uint8_t> &data) {
     if (decoder.decode(BINARY_SENSOR_KEY, namebuf, sizeof(namebuf), byte) == DECODE_OK) {
       ESP_LOGV(TAG, "Got binary sensor %s %d", namebuf, byte);
 #ifdef USE_BINARY_SENSOR
-      if (binary_sensors.count(namebuf) != 0)
-        binary_sensors[namebuf]->publish_state(byte != 0);
+      auto *binary_sensor = find_remote_entity(provider.binary_sensors, namebuf);
+      if (binary_sensor != nullptr)
+        binary_sensor->publish_state(byte != 0);
 #endif
       continue;
     }
     if (decoder.decode(SENSOR_KEY, namebuf, sizeof(namebuf), rdata.u32) == DECODE_OK) {
       ESP_LOGV(TAG, "Got sensor %s %f", namebuf, rdata.f32);
 #ifdef USE_SENSOR
-      if (sensors.count(namebuf) != 0)
-        sensors[namebuf]->publish_state(rdata.f32);
+      auto *sensor = find_remote_entity(provider.sensors, namebuf);
+      if (sensor != nullptr)
+        sensor->publish_state(rdata.f32);
 #endif
       continue;
     }
@@ -525,12 +548,12 @@ void PacketTransport::dump_config() {
     ESP_LOGCONFIG(TAG, "  Remote host: %s", host.first.c_str());
     ESP_LOGCONFIG(TAG, "    Encrypted: %s", YESNO(!host.second.encryption_key.empty()));
 #ifdef USE_SENSOR
-    for (const auto &sensor : this->remote_sensors_[host.first.c_str()])
-      ESP_LOGCONFIG(TAG, "    Sensor: %s", sensor.first.c_str());
+    for (const auto &sensor : host.second.sensors)
+      ESP_LOGCONFIG(TAG, "    Sensor: %s", sensor.id);
 #endif
 #ifdef USE_BINARY_SENSOR
-    for (const auto &sensor : this->remote_binary_sensors_[host.first.c_str()])
-      ESP_LOGCONFIG(TAG, "    Binary Sensor: %s", sensor.first.c_str());
+    for (const auto &sensor : host.second.binary_sensors)
+      ESP_LOGCONFIG(TAG, "    Binary Sensor: %s", sensor.id);
 #endif
   }
 }
@@ -553,6 +576,11 @@ void PacketTransport::loop() {
   }
 }
 
+void PacketTransport::on_safe_shutdown() {
+  if (this->updated_)
+    this->send_data_(this->resend_data_);
+}
+
 void PacketTransport::send_ping_pong_request_() {
   if (!this->ping_pong_enable_ || !this->should_send())
     return;
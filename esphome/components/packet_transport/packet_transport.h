@@ -9,8 +9,9 @@
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
 
-#include <vector>
+#include <algorithm>
 #include <map>
+#include <vector>
 
 /**
  * Providing packet encoding functions for exchanging data with a remote host.
@@ -23,6 +24,13 @@
 namespace esphome {
 namespace packet_transport {
 
+/// A sensor received from a provider, looked up by the FNV-1a hash of its remote id
+template<typename T> struct RemoteEntity {
+  uint32_t hash;
+  const char *id;
+  T *entity;
+};
+
 struct Provider {
   std::vector<uint8_t> encryption_key;
   const char *name;
@@ -30,6 +38,13 @@ struct Provider {
   uint32_t last_key_response_time;
 #ifdef USE_STATUS_SENSOR
   binary_sensor::BinarySensor *status_sensor{nullptr};
+#endif
+  // sorted by hash so received values don't need string compares to find their sensor
+#ifdef USE_SENSOR
+  std::vector<RemoteEntity<sensor::Sensor>> sensors;
+#endif
+#ifdef USE_BINARY_SENSOR
+  std::vector<RemoteEntity<binary_sensor::BinarySensor>> binary_sensors;
 #endif
 };
 
@@ -54,15 +69,18 @@ class PacketTransport : public PollingComponent {
   void loop() override;
   void update() override;
   void dump_config() override;
+  /// Sends states published since the last loop, so they aren't lost when deep sleep starts right after them
+  void on_safe_shutdown() override;
 
 #ifdef USE_SENSOR
   void add_sensor(const char *id, sensor::Sensor *sensor) {
     Sensor st{sensor, id, true};
     this->sensors_.push_back(st);
   }
-  void add_remote_sensor(const char *hostname, const char *remote_id, sensor::Sensor *sensor) {
+  /// `remote_hash` is the FNV-1a hash of the UTF-8 bytes of `remote_id`, computed by the code generator
+  void add_remote_sensor(const char *hostname, const char *remote_id, uint32_t remote_hash, sensor::Sensor *sensor) {
     this->add_provider(hostname);
-    this->remote_sensors_[hostname][remote_id] = sensor;
+    add_remote_entity_(this->providers_[hostname].sensors, remote_id, remote_hash, sensor);
   }
 #endif
 #ifdef USE_BINARY_SENSOR
@@ -71,9 +89,10 @@ class PacketTransport : public PollingComponent {
     this->binary_sensors_.push_back(st);
   }
 
-  void add_remote_binary_sensor(const char *hostname, const char *remote_id, binary_sensor::BinarySensor *sensor) {
+  void add_remote_binary_sensor(const char *hostname, const char *remote_id, uint32_t remote_hash,
+                                binary_sensor::BinarySensor *sensor) {
     this->add_provider(hostname);
-    this->remote_binary_sensors_[hostname][remote_id] = sensor;
+    add_remote_entity_(this->providers_[hostname].binary_sensors, remote_id, remote_hash, sensor);
   }
 #endif
 
@@ -82,12 +101,6 @@ class PacketTransport : public PollingComponent {
       Provider provider{};
       provider.name = hostname;
       this->providers_[hostname] = provider;
-#ifdef USE_SENSOR
-      this->remote_sensors_[hostname] = std::map<std::string, sensor::Sensor *>();
-#endif
-#ifdef USE_BINARY_SENSOR
-      this->remote_binary_sensors_[hostname] = std::map<std::string, binary_sensor::BinarySensor *>();
-#endif
     }
   }
 
@@ -137,23 +150,31 @@ class PacketTransport : public PollingComponent {
 
 #ifdef USE_SENSOR
   std::vector<Sensor> sensors_{};
-  std::map<std::string, std::map<std::string, sensor::Sensor *>> remote_sensors_{};
 #endif
 #ifdef USE_BINARY_SENSOR
   std::vector<BinarySensor> binary_sensors_{};
-  std::map<std::string, std::map<std::string, binary_sensor::BinarySensor *>> remote_binary_sensors_{};
 #endif
 
-  std::map<std::string, Provider> providers_{};
+  // transparent comparator, so a received host name can be looked up without building a std::string
+  std::map<std::string, Provider, std::less<>> providers_{};
   std::vector<uint8_t> ping_header_{};
   std::vector<uint8_t> header_{};
   std::vector<uint8_t> data_{};
+  // reused for every packet sent, to avoid a heap allocation per flush
+  std::vector<uint8_t> encode_buffer_{};
   std::map<const char *, uint32_t> ping_keys_{};
   const char *platform_name_{""};
   void add_key_(const char *name, uint32_t key);
   void send_ping_pong_request_();
 
   inline bool is_encrypted_() { return !this->encryption_key_.empty(); }
+
+  template<typename T>
+  static void add_remote_entity_(std::vector<RemoteEntity<T>> &entities, const char *id, uint32_t hash, T *entity) {
+    auto pos = std::upper_bound(entities.begin(), entities.end(), hash,
+                                [](uint32_t h, const RemoteEntity<T> &e) { return h < e.hash; });
+    entities.insert(pos, RemoteEntity<T>{hash, id, entity});
+  }
 };
 
 }  // namespace packet_transport
@@ -7,6 +7,7 @@ from . import (
     CONF_REMOTE_ID,
     CONF_TRANSPORT_ID,
     packet_transport_sensor_schema,
+    remote_id_hash,
 )
 
 CONFIG_SCHEMA = packet_transport_sensor_schema(sensor_schema())
@@ -16,4 +17,8 @@ async def to_code(config):
     var = await new_sensor(config)
     comp = await cg.get_variable(config[CONF_TRANSPORT_ID])
     remote_id = str(config.get(CONF_REMOTE_ID) or config.get(CONF_ID))
-    cg.add(comp.add_remote_sensor(config[CONF_PROVIDER], remote_id, var))
+    cg.add(
+        comp.add_remote_sensor(
+            config[CONF_PROVIDER], remote_id, remote_id_hash(remote_id), var
+        )
+    )
@@ -15,6 +15,8 @@ from esphome.const import (
 )
 import esphome.final_validate as fv
 
+CONF_SERPENTINE_WIDTH = "serpentine_width"
+
 partitions_ns = cg.esphome_ns.namespace("partition")
 AddressableSegment = partitions_ns.class_("AddressableSegment")
 AddressableLightWrapper = cg.esphome_ns.namespace("light").class_(
@@ -81,8 +83,10 @@ CONFIG_SCHEMA = light.ADDRESSABLE_LIGHT_SCHEMA.extend(
                 cv.Any(ADDRESSABLE_SEGMENT_SCHEMA, NONADDRESSABLE_SEGMENT_SCHEMA),
                 validate_from_to,
             ),
-            cv.Length(min=1),
+            # The segment's index is stored in 8 bits of the LED map
+            cv.Length(min=1, max=256),
         ),
+        cv.Optional(CONF_SERPENTINE_WIDTH): cv.int_range(min=1),
     }
 )
 
@@ -117,5 +121,7 @@ async def to_code(config):
             )
 
     var = cg.new_Pvariable(config[CONF_OUTPUT_ID], segments)
+    if CONF_SERPENTINE_WIDTH in config:
+        cg.add(var.set_serpentine(config[CONF_SERPENTINE_WIDTH]))
     await cg.register_component(var, config)
     await light.register_light(var, config)
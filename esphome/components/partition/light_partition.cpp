@@ -1,10 +1,41 @@
 #include "light_partition.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace partition {
 
 static const char *const TAG = "partition.light";
 
+PartitionLightOutput::PartitionLightOutput(std::vector<AddressableSegment> segments) : segments_(std::move(segments)) {
+  int32_t off = 0;
+  for (auto &seg : this->segments_) {
+    seg.set_dst_offset(off);
+    off += seg.get_size();
+  }
+
+  this->map_.reserve(off);
+  for (uint32_t i = 0; i < this->segments_.size(); i++) {
+    const auto &seg = this->segments_[i];
+    for (int32_t seg_off = 0; seg_off < seg.get_size(); seg_off++) {
+      int32_t src_off;
+      if (seg.is_reversed()) {
+        src_off = seg.get_src_offset() + seg.get_size() - seg_off - 1;
+      } else {
+        src_off = seg.get_src_offset() + seg_off;
+      }
+      this->map_.push_back((i << MAP_SEGMENT_SHIFT) | src_off);
+    }
+  }
+}
+
+void PartitionLightOutput::set_serpentine(uint32_t width) {
+  for (uint32_t row = width; row < this->map_.size(); row += 2 * width) {
+    auto begin = this->map_.begin() + row;
+    std::reverse(begin, begin + std::min<uint32_t>(width, this->map_.size() - row));
+  }
+}
+
 }  // namespace partition
 }  // namespace esphome
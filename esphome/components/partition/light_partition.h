@@ -34,17 +34,11 @@ class AddressableSegment {
 
 class PartitionLightOutput : public light::AddressableLight {
  public:
-  explicit PartitionLightOutput(std::vector<AddressableSegment> segments) : segments_(std::move(segments)) {
-    int32_t off = 0;
-    for (auto &seg : this->segments_) {
-      seg.set_dst_offset(off);
-      off += seg.get_size();
-    }
-  }
-  int32_t size() const override {
-    auto &last_seg = this->segments_[this->segments_.size() - 1];
-    return last_seg.get_dst_offset() + last_seg.get_size();
-  }
+  explicit PartitionLightOutput(std::vector<AddressableSegment> segments);
+  int32_t size() const override { return this->map_.size(); }
+  /// @brief Arranges the LEDs as rows of `width` LEDs, with every other row wired in reverse like on most LED matrices,
+  /// so index `y * width + x` addresses column x of row y
+  void set_serpentine(uint32_t width);
   void clear_effect_data() override {
     for (auto &seg : this->segments_) {
       seg.get_src()->clear_effect_data();
@@ -60,37 +54,19 @@ class PartitionLightOutput : public light::AddressableLight {
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override {
-    uint32_t lo = 0;
-    uint32_t hi = this->segments_.size() - 1;
-    while (lo < hi) {
-      uint32_t mid = (lo + hi) / 2;
-      int32_t begin = this->segments_[mid].get_dst_offset();
-      int32_t end = begin + this->segments_[mid].get_size();
-      if (index < begin) {
-        hi = mid - 1;
-      } else if (index >= end) {
-        lo = mid + 1;
-      } else {
-        lo = hi = mid;
-      }
-    }
-    auto &seg = this->segments_[lo];
-    // offset within the segment
-    int32_t seg_off = index - seg.get_dst_offset();
-    // offset within the src
-    int32_t src_off;
-    if (seg.is_reversed()) {
-      src_off = seg.get_src_offset() + seg.get_size() - seg_off - 1;
-    } else {
-      src_off = seg.get_src_offset() + seg_off;
-    }
-
-    auto view = (*seg.get_src())[src_off];
+    const uint32_t entry = this->map_[index];
+    auto view = (*this->segments_[entry >> MAP_SEGMENT_SHIFT].get_src())[entry & MAP_OFFSET_MASK];
     view.raw_set_color_correction(&this->correction_);
     return view;
   }
 
+  static const uint8_t MAP_SEGMENT_SHIFT = 24;
+  static const uint32_t MAP_OFFSET_MASK = (1 << MAP_SEGMENT_SHIFT) - 1;
+
   std::vector<AddressableSegment> segments_;
+  // Segment index in the top 8 bits and the LED's index in the segment's light below it, for every LED of the
+  // partition. Built once, so finding an LED is a single lookup instead of a search through the segments.
+  std::vector<uint32_t> map_;
 };
 
 }  // namespace partition
@@ -79,7 +79,7 @@ void PCA9685Output::setup() {
   }
   delayMicroseconds(500);
 
-  this->loop();
+  this->flush_();
 }
 
 void PCA9685Output::dump_config() {
@@ -101,12 +101,24 @@ void PCA9685Output::dump_config() {
 }
 
 void PCA9685Output::loop() {
-  if (this->min_channel_ == 0xFF || !this->update_)
+  if (!this->pwm_amounts_.is_dirty()) {
+    this->disable_loop();
+    return;
+  }
+  this->flush_();
+}
+
+void PCA9685Output::flush_() {
+  if (!this->pwm_amounts_.is_dirty())
     return;
 
+  const uint8_t first = this->pwm_amounts_.first_dirty();
+  const uint8_t last = this->pwm_amounts_.last_dirty();
   const uint16_t num_channels = this->max_channel_ - this->min_channel_ + 1;
   const uint16_t phase_delta_begin = 4096 / num_channels;
-  for (uint8_t channel = this->min_channel_; channel <= this->max_channel_; channel++) {
+  uint8_t data[4 * 16];
+  uint8_t *pos = data;
+  for (uint8_t channel = first; channel <= last; channel++) {
     uint16_t phase_begin = (channel - this->min_channel_) * phase_delta_begin;
     uint16_t phase_end;
     uint16_t amount = this->pwm_amounts_[channel];
@@ -124,21 +136,21 @@ void PCA9685Output::loop() {
     ESP_LOGVV(TAG, "Channel %02u: amount=%04u phase_begin=%04u phase_end=%04u", channel, amount, phase_begin,
               phase_end);
 
-    uint8_t data[4];
-    data[0] = phase_begin & 0xFF;
-    data[1] = (phase_begin >> 8) & 0xFF;
-    data[2] = phase_end & 0xFF;
-    data[3] = (phase_end >> 8) & 0xFF;
+    *pos++ = phase_begin & 0xFF;
+    *pos++ = (phase_begin >> 8) & 0xFF;
+    *pos++ = phase_end & 0xFF;
+    *pos++ = (phase_end >> 8) & 0xFF;
+  }
 
-    uint8_t reg = PCA9685_REGISTER_LED0 + 4 * channel;
-    if (!this->write_bytes(reg, data, 4)) {
-      this->status_set_warning();
-      return;
-    }
+  // MODE1 has auto increment enabled, so the LEDn registers of all changed channels are written in one transaction.
+  // Unchanged channels between them are written with their current values.
+  if (!this->write_bytes(PCA9685_REGISTER_LED0 + 4 * first, data, pos - data)) {
+    this->status_set_warning();
+    return;
   }
 
   this->status_clear_warning();
-  this->update_ = false;
+  this->pwm_amounts_.flushed();
 }
 
 void PCA9685Output::register_channel(PCA9685Channel *channel) {
@@ -146,6 +158,8 @@ void PCA9685Output::register_channel(PCA9685Channel *channel) {
   this->min_channel_ = std::min(this->min_channel_, c);
   this->max_channel_ = std::max(this->max_channel_, c);
   channel->set_parent(this);
+  // Registered channels are written once on setup, whatever their value
+  this->pwm_amounts_.mark_dirty(c);
 }
 
 void PCA9685Channel::write_state(float state) {
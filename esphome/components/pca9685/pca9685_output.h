@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/components/output/channel_batch.h"
 #include "esphome/components/output/float_output.h"
 #include "esphome/components/i2c/i2c.h"
 
@@ -52,21 +53,20 @@ class PCA9685Output : public Component, public i2c::I2CDevice {
   friend PCA9685Channel;
 
   void set_channel_value_(uint8_t channel, uint16_t value) {
-    if (this->pwm_amounts_[channel] != value)
-      this->update_ = true;
-    this->pwm_amounts_[channel] = value;
+    if (this->pwm_amounts_.set(channel, value))
+      this->enable_loop();
   }
 
+  /// Writes all changed channels in one auto-incremented register write
+  void flush_();
+
   float frequency_;
   uint8_t mode_;
   bool extclk_ = false;
 
   uint8_t min_channel_{0xFF};
   uint8_t max_channel_{0x00};
-  uint16_t pwm_amounts_[16] = {
-      0,
-  };
-  bool update_{true};
+  output::ChannelBatch<uint16_t, 16> pwm_amounts_;
 };
 
 }  // namespace pca9685
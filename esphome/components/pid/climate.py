@@ -2,7 +2,12 @@ from esphome import automation
 import esphome.codegen as cg
 from esphome.components import climate, output, sensor
 import esphome.config_validation as cv
-from esphome.const import CONF_HUMIDITY_SENSOR, CONF_ID, CONF_SENSOR
+from esphome.const import (
+    CONF_HUMIDITY_SENSOR,
+    CONF_ID,
+    CONF_SENSOR,
+    CONF_UPDATE_INTERVAL,
+)
 
 pid_ns = cg.esphome_ns.namespace("pid")
 PIDClimate = pid_ns.class_("PIDClimate", climate.Climate, cg.Component)
@@ -20,6 +25,7 @@ CONF_KP = "kp"
 CONF_KI = "ki"
 CONF_STARTING_INTEGRAL_TERM = "starting_integral_term"
 CONF_KD = "kd"
+CONF_KF = "kf"
 CONF_CONTROL_PARAMETERS = "control_parameters"
 CONF_COOL_OUTPUT = "cool_output"
 CONF_HEAT_OUTPUT = "heat_output"
@@ -48,6 +54,10 @@ CONFIG_SCHEMA = cv.All(
             cv.Required(CONF_DEFAULT_TARGET_TEMPERATURE): cv.temperature,
             cv.Optional(CONF_COOL_OUTPUT): cv.use_id(output.FloatOutput),
             cv.Optional(CONF_HEAT_OUTPUT): cv.use_id(output.FloatOutput),
+            cv.Optional(CONF_UPDATE_INTERVAL): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(min=cv.TimePeriod(milliseconds=10)),
+            ),
             cv.Optional(CONF_DEADBAND_PARAMETERS): cv.Schema(
                 {
                     cv.Required(CONF_THRESHOLD_HIGH): cv.temperature,
@@ -65,6 +75,7 @@ CONFIG_SCHEMA = cv.All(
                     cv.Required(CONF_KP): cv.float_,
                     cv.Optional(CONF_KI, default=0.0): cv.float_,
                     cv.Optional(CONF_KD, default=0.0): cv.float_,
+                    cv.Optional(CONF_KF, default=0.0): cv.float_,
                     cv.Optional(CONF_STARTING_INTEGRAL_TERM, default=0.0): cv.float_,
                     cv.Optional(CONF_MIN_INTEGRAL, default=-1): cv.float_,
                     cv.Optional(CONF_MAX_INTEGRAL, default=1): cv.float_,
@@ -89,6 +100,9 @@ async def to_code(config):
         sens = await cg.get_variable(config[CONF_HUMIDITY_SENSOR])
         cg.add(var.set_humidity_sensor(sens))
 
+    if CONF_UPDATE_INTERVAL in config:
+        cg.add(var.set_update_interval(config[CONF_UPDATE_INTERVAL]))
+
     if CONF_COOL_OUTPUT in config:
         out = await cg.get_variable(config[CONF_COOL_OUTPUT])
         cg.add(var.set_cool_output(out))
@@ -99,6 +113,7 @@ async def to_code(config):
     cg.add(var.set_kp(params[CONF_KP]))
     cg.add(var.set_ki(params[CONF_KI]))
     cg.add(var.set_kd(params[CONF_KD]))
+    cg.add(var.set_kf(params[CONF_KF]))
     cg.add(var.set_starting_integral_term(params[CONF_STARTING_INTEGRAL_TERM]))
     cg.add(var.set_derivative_samples(params[CONF_DERIVATIVE_AVERAGING_SAMPLES]))
 
@@ -1,6 +1,8 @@
 #include "pid_climate.h"
 #include "esphome/core/log.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace pid {
 
@@ -11,10 +13,30 @@ void PIDClimate::setup() {
     // only publish if state/current temperature has changed in two digits of precision
     this->do_publish_ = roundf(state * 100) != roundf(this->current_temperature * 100);
     this->current_temperature = state;
+    if (this->update_interval_ != 0) {
+      // the PID runs at its own rate, it picks the new value up on the next period
+      if (this->do_publish_) {
+        this->publish_state();
+        this->do_publish_ = false;
+      }
+      return;
+    }
     this->update_pid_();
   });
   this->current_temperature = this->sensor_->state;
 
+  if (this->update_interval_ != 0) {
+    // a fixed time step keeps the I and D terms independent of loop jitter, which is measured instead
+    this->controller_.set_fixed_dt(this->update_interval_ / 1000.0f);
+    this->set_interval("pid", this->update_interval_, [this]() {
+      const uint32_t now = millis();
+      if (this->last_update_ != 0)
+        this->jitter_ = static_cast<int32_t>(now - this->last_update_ - this->update_interval_);
+      this->last_update_ = now;
+      this->update_pid_();
+    });
+  }
+
   // register for humidity values and get initial state
   if (this->humidity_sensor_ != nullptr) {
     this->humidity_sensor_->add_on_state_callback([this](float state) {
@@ -75,8 +97,11 @@ void PIDClimate::dump_config() {
   LOG_CLIMATE("", "PID Climate", this);
   ESP_LOGCONFIG(TAG,
                 "  Control Parameters:\n"
-                "    kp: %.5f, ki: %.5f, kd: %.5f, output samples: %d",
-                controller_.kp_, controller_.ki_, controller_.kd_, controller_.output_samples_);
+                "    kp: %.5f, ki: %.5f, kd: %.5f, kf: %.5f, output samples: %d",
+                controller_.kp_, controller_.ki_, controller_.kd_, controller_.kf_, controller_.output_samples_);
+  if (this->update_interval_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Update Interval: %" PRIu32 " ms", this->update_interval_);
+  }
 
   if (controller_.threshold_low_ == 0 && controller_.threshold_high_ == 0) {
     ESP_LOGCONFIG(TAG, "  Deadband disabled.");
@@ -156,8 +181,10 @@ void PIDClimate::update_pid_() {
     this->write_output_(value);
   }
 
-  if (this->do_publish_)
+  if (this->do_publish_) {
     this->publish_state();
+    this->do_publish_ = false;
+  }
 }
 void PIDClimate::start_autotune(std::unique_ptr<PIDAutotuner> &&autotune) {
   this->autotuner_ = std::move(autotune);
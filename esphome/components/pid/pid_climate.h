@@ -25,6 +25,9 @@ class PIDClimate : public climate::Climate, public Component {
   void set_kp(float kp) { controller_.kp_ = kp; }
   void set_ki(float ki) { controller_.ki_ = ki; }
   void set_kd(float kd) { controller_.kd_ = kd; }
+  void set_kf(float kf) { controller_.kf_ = kf; }
+  /// Run the PID at this fixed interval instead of on every sensor value, 0 to disable
+  void set_update_interval(uint32_t update_interval) { update_interval_ = update_interval; }
   void set_min_integral(float min_integral) { controller_.min_integral_ = min_integral; }
   void set_max_integral(float max_integral) { controller_.max_integral_ = max_integral; }
   void set_output_samples(int in) { controller_.output_samples_ = in; }
@@ -44,11 +47,15 @@ class PIDClimate : public climate::Climate, public Component {
   float get_kp() { return controller_.kp_; }
   float get_ki() { return controller_.ki_; }
   float get_kd() { return controller_.kd_; }
+  float get_kf() { return controller_.kf_; }
   float get_min_integral() { return controller_.min_integral_; }
   float get_max_integral() { return controller_.max_integral_; }
   float get_proportional_term() const { return controller_.proportional_term_; }
   float get_integral_term() const { return controller_.integral_term_; }
   float get_derivative_term() const { return controller_.derivative_term_; }
+  float get_feed_forward_term() const { return controller_.feed_forward_term_; }
+  /// How much the last fixed rate period differed from update_interval, in ms
+  float get_jitter() const { return jitter_; }
   int get_output_samples() { return controller_.output_samples_; }
   int get_derivative_samples() { return controller_.derivative_samples_; }
 
@@ -99,6 +106,9 @@ class PIDClimate : public climate::Climate, public Component {
   float default_target_temperature_;
   std::unique_ptr<PIDAutotuner> autotuner_;
   bool do_publish_ = false;
+  uint32_t update_interval_{0};
+  uint32_t last_update_{0};
+  float jitter_{0.0f};
 };
 
 template<typename... Ts> class PIDAutotuneAction : public Action<Ts...> {
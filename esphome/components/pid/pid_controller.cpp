@@ -18,8 +18,11 @@ float PIDController::update(float setpoint, float process_value) {
   calculate_integral_term_();
   calculate_derivative_term_(setpoint);
 
-  // u(t) := p(t) + i(t) + d(t)
-  float output = proportional_term_ + integral_term_ + derivative_term_;
+  // f(t) := K_f * r(t)
+  feed_forward_term_ = kf_ * setpoint;
+
+  // u(t) := p(t) + i(t) + d(t) + f(t)
+  float output = proportional_term_ + integral_term_ + derivative_term_ + feed_forward_term_;
 
   // smooth/sample the output
   int samples = in_deadband() ? deadband_output_samples_ : output_samples_;
@@ -122,6 +125,8 @@ float PIDController::calculate_relative_time_() {
     return 0.0f;
   }
   last_time_ = now;
+  if (fixed_dt_ != 0.0f)
+    return fixed_dt_;
   return dt / 1000.0f;
 }
 
@@ -11,6 +11,8 @@ struct PIDController {
 
   void reset_accumulated_integral() { accumulated_integral_ = 0; }
   void set_starting_integral_term(float in) { accumulated_integral_ = in; }
+  /// Use this time step in seconds for every update instead of measuring the time between them
+  void set_fixed_dt(float dt) { fixed_dt_ = dt; }
 
   bool in_deadband();
 
@@ -23,6 +25,8 @@ struct PIDController {
   float ki_ = 0;
   /// Differential gain K_d.
   float kd_ = 0;
+  /// Feed-forward gain K_f, applied to the setpoint.
+  float kf_ = 0;
 
   // smooth the derivative value using a weighted average over X samples
   int derivative_samples_ = 8;
@@ -46,6 +50,7 @@ struct PIDController {
   float proportional_term_;
   float integral_term_;
   float derivative_term_;
+  float feed_forward_term_;
 
   void calculate_proportional_term_();
   void calculate_integral_term_();
@@ -59,6 +64,8 @@ struct PIDController {
   /// Accumulated integral value
   float accumulated_integral_ = 0;
   uint32_t last_time_ = 0;
+  /// Time step for fixed rate updates, 0 to measure it
+  float fixed_dt_ = 0;
 
   // this is a list of derivative values for smoothing.
   std::deque<float> derivative_list_;
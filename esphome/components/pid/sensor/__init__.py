@@ -19,6 +19,8 @@ PID_CLIMATE_SENSOR_TYPES = {
     "KP": PIDClimateSensorType.PID_SENSOR_TYPE_KP,
     "KI": PIDClimateSensorType.PID_SENSOR_TYPE_KI,
     "KD": PIDClimateSensorType.PID_SENSOR_TYPE_KD,
+    "FEED_FORWARD": PIDClimateSensorType.PID_SENSOR_TYPE_FEED_FORWARD,
+    "JITTER": PIDClimateSensorType.PID_SENSOR_TYPE_JITTER,
 }
 
 CONF_CLIMATE_ID = "climate_id"
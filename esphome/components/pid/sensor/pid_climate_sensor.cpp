@@ -47,6 +47,13 @@ void PIDClimateSensor::update_from_parent_() {
       value = this->parent_->get_kd();
       this->publish_state(value);
       return;
+    case PID_SENSOR_TYPE_FEED_FORWARD:
+      value = this->parent_->get_feed_forward_term();
+      break;
+    case PID_SENSOR_TYPE_JITTER:
+      value = this->parent_->get_jitter();
+      this->publish_state(value);
+      return;
     default:
       value = NAN;
       break;
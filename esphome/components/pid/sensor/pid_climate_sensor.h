@@ -17,6 +17,8 @@ enum PIDClimateSensorType {
   PID_SENSOR_TYPE_KP,
   PID_SENSOR_TYPE_KI,
   PID_SENSOR_TYPE_KD,
+  PID_SENSOR_TYPE_FEED_FORWARD,
+  PID_SENSOR_TYPE_JITTER,
 };
 
 class PIDClimateSensor : public sensor::Sensor, public Component {
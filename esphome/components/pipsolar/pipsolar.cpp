@@ -8,16 +8,12 @@ namespace pipsolar {
 static const char *const TAG = "pipsolar";
 
 void Pipsolar::setup() {
+  this->frame_reader_.set_terminator(0x0D);
   this->state_ = STATE_IDLE;
   this->command_start_millis_ = 0;
 }
 
-void Pipsolar::empty_uart_buffer_() {
-  uint8_t byte;
-  while (this->available()) {
-    this->read_byte(&byte);
-  }
-}
+void Pipsolar::empty_uart_buffer_() { this->frame_reader_.clear(this->parent_); }
 
 void Pipsolar::loop() {
   // Read message
@@ -716,29 +712,19 @@ void Pipsolar::loop() {
   }
 
   if (this->state_ == STATE_COMMAND || this->state_ == STATE_POLL) {
-    while (this->available()) {
-      uint8_t byte;
-      this->read_byte(&byte);
-
-      if (this->read_pos_ == PIPSOLAR_READ_BUFFER_LENGTH) {
-        this->read_pos_ = 0;
-        this->empty_uart_buffer_();
+    if (this->frame_reader_.read(this->parent_, millis())) {
+      // An answer that filled the buffer without end byte fails the CRC check like any other broken answer
+      this->read_pos_ = this->frame_reader_.size();
+      memcpy(this->read_buffer_, this->frame_reader_.data(), this->read_pos_);
+      this->read_buffer_[this->read_pos_] = 0;
+      this->empty_uart_buffer_();
+      if (this->state_ == STATE_POLL) {
+        this->state_ = STATE_POLL_COMPLETE;
       }
-      this->read_buffer_[this->read_pos_] = byte;
-      this->read_pos_++;
-
-      // end of answer
-      if (byte == 0x0D) {
-        this->read_buffer_[this->read_pos_] = 0;
-        this->empty_uart_buffer_();
-        if (this->state_ == STATE_POLL) {
-          this->state_ = STATE_POLL_COMPLETE;
-        }
-        if (this->state_ == STATE_COMMAND) {
-          this->state_ = STATE_COMMAND_COMPLETE;
-        }
+      if (this->state_ == STATE_COMMAND) {
+        this->state_ = STATE_COMMAND_COMPLETE;
       }
-    }  // available
+    }
   }
   if (this->state_ == STATE_COMMAND) {
     if (millis() - this->command_start_millis_ > esphome::pipsolar::Pipsolar::COMMAND_TIMEOUT) {
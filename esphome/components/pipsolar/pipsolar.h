@@ -5,6 +5,7 @@
 #include "esphome/components/switch/switch.h"
 #include "esphome/components/text_sensor/text_sensor.h"
 #include "esphome/components/uart/uart.h"
+#include "esphome/components/uart/uart_frame_reader.h"
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
 
@@ -202,6 +203,8 @@ class Pipsolar : public uart::UARTDevice, public PollingComponent {
   uint8_t command_queue_position_ = 0;
   uint8_t read_buffer_[PIPSOLAR_READ_BUFFER_LENGTH];
   size_t read_pos_{0};
+  // Leaves room for the terminating zero in read_buffer_
+  uart::UARTFrameReader frame_reader_{PIPSOLAR_READ_BUFFER_LENGTH - 1};
 
   uint32_t command_start_millis_ = 0;
   uint8_t state_;
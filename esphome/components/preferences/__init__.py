@@ -1,17 +1,44 @@
 import esphome.codegen as cg
+from esphome.components.esp32 import add_idf_data_partition
 import esphome.config_validation as cv
-from esphome.const import CONF_ID
+from esphome.const import CONF_ID, CONF_SIZE
 
 CODEOWNERS = ["@esphome/core"]
 
 preferences_ns = cg.esphome_ns.namespace("preferences")
 IntervalSyncer = preferences_ns.class_("IntervalSyncer", cg.Component)
 
+CONF_BACKGROUND_SYNC = "background_sync"
 CONF_FLASH_WRITE_INTERVAL = "flash_write_interval"
+CONF_JOURNAL = "journal"
+
+# Partition the ESP32 journal backend stores its log in
+JOURNAL_PARTITION_NAME = "prefs_journal"
+JOURNAL_PARTITION_SUBTYPE = 0x40
+FLASH_SECTOR_SIZE = 0x1000
+
+
+def validate_journal_size(value):
+    value = cv.validate_bytes(value)
+    if value % FLASH_SECTOR_SIZE != 0:
+        raise cv.Invalid("The journal size must be a multiple of 4KB")
+    # One sector is always kept erased, so at least three are needed
+    return cv.int_range(min=3 * FLASH_SECTOR_SIZE, max=0x40000)(value)
+
+
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(IntervalSyncer),
         cv.Optional(CONF_FLASH_WRITE_INTERVAL, default="60s"): cv.update_interval,
+        cv.Optional(CONF_BACKGROUND_SYNC, default=False): cv.boolean,
+        cv.Optional(CONF_JOURNAL): cv.All(
+            cv.Schema(
+                {
+                    cv.Optional(CONF_SIZE, default="64KB"): validate_journal_size,
+                }
+            ),
+            cv.only_with_esp_idf,
+        ),
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -19,4 +46,12 @@ CONFIG_SCHEMA = cv.Schema(
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     cg.add(var.set_write_interval(config[CONF_FLASH_WRITE_INTERVAL]))
+    if config[CONF_BACKGROUND_SYNC]:
+        cg.add(var.set_background(True))
     await cg.register_component(var, config)
+
+    if (journal := config.get(CONF_JOURNAL)) is not None:
+        add_idf_data_partition(
+            JOURNAL_PARTITION_NAME, JOURNAL_PARTITION_SUBTYPE, journal[CONF_SIZE]
+        )
+        cg.add_define("USE_ESP32_PREFERENCES_JOURNAL")
@@ -2,6 +2,10 @@
 
 #include "esphome/core/preferences.h"
 #include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+
+#include <functional>
 
 namespace esphome {
 namespace preferences {
@@ -9,23 +13,71 @@ namespace preferences {
 class IntervalSyncer : public Component {
  public:
   void set_write_interval(uint32_t write_interval) { this->write_interval_ = write_interval; }
+  /// Commit in the background where the backend supports it instead of blocking the main loop.
+  void set_background(bool background) { this->background_ = background; }
+  /// Called after every commit with its result and how long it took in milliseconds.
+  void add_on_sync_callback(std::function<void(bool, uint32_t)> &&callback) {
+    this->sync_callback_.add(std::move(callback));
+  }
+  /// Duration of the last finished commit in milliseconds.
+  uint32_t get_last_sync_duration() const { return this->last_sync_duration_; }
+
   void setup() override {
     if (this->write_interval_ != 0) {
-      set_interval(this->write_interval_, []() { global_preferences->sync(); });
+      set_interval(this->write_interval_, [this]() { this->sync_(); });
       // When using interval-based syncing, we don't need the loop
       this->disable_loop();
     }
   }
   void loop() override {
+    if (this->syncing_) {
+      if (!global_preferences->poll_sync())
+        return;
+      this->syncing_ = false;
+      this->finish_(global_preferences->get_sync_result());
+      if (this->write_interval_ != 0)
+        this->disable_loop();
+      return;
+    }
     if (this->write_interval_ == 0) {
-      global_preferences->sync();
+      this->sync_();
     }
   }
-  void on_shutdown() override { global_preferences->sync(); }
+  void on_shutdown() override {
+    // Blocks until a background commit in progress has finished as well
+    global_preferences->sync();
+  }
   float get_setup_priority() const override { return setup_priority::BUS; }
 
  protected:
+  void sync_() {
+    if (this->syncing_)
+      return;
+    this->sync_start_ = millis();
+    if (!this->background_) {
+      this->finish_(global_preferences->sync());
+      return;
+    }
+    global_preferences->begin_sync();
+    if (global_preferences->poll_sync()) {
+      this->finish_(global_preferences->get_sync_result());
+      return;
+    }
+    // Poll the commit from the loop until it is done
+    this->syncing_ = true;
+    this->enable_loop();
+  }
+  void finish_(bool success) {
+    this->last_sync_duration_ = millis() - this->sync_start_;
+    this->sync_callback_.call(success, this->last_sync_duration_);
+  }
+
+  CallbackManager<void(bool, uint32_t)> sync_callback_;
   uint32_t write_interval_{60000};
+  uint32_t sync_start_{0};
+  uint32_t last_sync_duration_{0};
+  bool background_{false};
+  bool syncing_{false};
 };
 
 }  // namespace preferences
@@ -1,4 +1,6 @@
 #include "pulse_meter_sensor.h"
+#include <algorithm>
+#include <cmath>
 #include <utility>
 #include "esphome/core/log.h"
 
@@ -7,6 +9,11 @@ namespace pulse_meter {
 
 static const char *const TAG = "pulse_meter";
 
+#ifdef PULSE_METER_HAS_PCNT
+/// With the pulse counter, aim for one interrupt every 10 ms no matter how fast the pulses are.
+static const uint32_t PCNT_CAPTURE_INTERVAL_US = 10000;
+#endif  // PULSE_METER_HAS_PCNT
+
 void PulseMeterSensor::set_total_pulses(uint32_t pulses) {
   this->total_pulses_ = pulses;
   if (this->total_sensor_ != nullptr) {
@@ -24,7 +31,14 @@ void PulseMeterSensor::setup() {
   // Set the last processed edge to now for the first timeout
   this->last_processed_edge_us_ = micros();
 
-  if (this->filter_mode_ == FILTER_EDGE) {
+  if (this->use_pcnt_) {
+#ifdef PULSE_METER_HAS_PCNT
+    if (!this->pcnt_setup_()) {
+      this->mark_failed();
+      return;
+    }
+#endif  // PULSE_METER_HAS_PCNT
+  } else if (this->filter_mode_ == FILTER_EDGE) {
     this->pin_->attach_interrupt(PulseMeterSensor::edge_intr, this, gpio::INTERRUPT_RISING_EDGE);
   } else if (this->filter_mode_ == FILTER_PULSE) {
     // Set the pin value to the current value to avoid a false edge
@@ -50,13 +64,16 @@ void PulseMeterSensor::loop() {
     // If the edges are rising too slowly it also implies that the pulse rate is slow.
     // Therefore the update rate of the loop is likely fast enough to detect the edges.
     // When the main loop detects an edge that the ISR didn't it will run the ISR functions directly.
-    bool current = this->pin_->digital_read();
-    if (this->filter_mode_ == FILTER_EDGE && current && !this->last_pin_val_) {
-      PulseMeterSensor::edge_intr(this);
-    } else if (this->filter_mode_ == FILTER_PULSE && current != this->last_pin_val_) {
-      PulseMeterSensor::pulse_intr(this);
+    // The pulse counter sees every edge, so this isn't needed with it.
+    if (!this->use_pcnt_) {
+      bool current = this->pin_->digital_read();
+      if (this->filter_mode_ == FILTER_EDGE && current && !this->last_pin_val_) {
+        PulseMeterSensor::edge_intr(this);
+      } else if (this->filter_mode_ == FILTER_PULSE && current != this->last_pin_val_) {
+        PulseMeterSensor::pulse_intr(this);
+      }
+      this->last_pin_val_ = current;
     }
-    this->last_pin_val_ = current;
 
     // Swap out set and get to get the latest state from the ISR
     std::swap(this->set_, this->get_);
@@ -99,6 +116,10 @@ void PulseMeterSensor::loop() {
         ESP_LOGV(TAG, "New pulse, delta: %" PRIu32 " µs, count: %" PRIu32 ", width: %.5f µs", delta_us,
                  this->get_->count_, pulse_width_us);
         this->publish_state((60.0f * 1000000.0f) / pulse_width_us);
+#ifdef PULSE_METER_HAS_PCNT
+        if (this->use_pcnt_)
+          this->pcnt_adapt_(pulse_width_us);
+#endif  // PULSE_METER_HAS_PCNT
       } break;
     }
 
@@ -108,6 +129,16 @@ void PulseMeterSensor::loop() {
   else {
     const uint32_t time_since_valid_edge_us = now - this->last_processed_edge_us_;
 
+#ifdef PULSE_METER_HAS_PCNT
+    // The pulses slowed down a lot, don't wait for the limit to be reached
+    if (this->use_pcnt_ && this->pcnt_limit_ > 1 && time_since_valid_edge_us > 4 * PCNT_CAPTURE_INTERVAL_US) {
+      int16_t counted = 0;
+      pcnt_get_counter_value(this->pcnt_unit_, &counted);
+      this->pcnt_set_limit_(std::max<int32_t>(
+          1, static_cast<int64_t>(counted) * PCNT_CAPTURE_INTERVAL_US / time_since_valid_edge_us));
+    }
+#endif  // PULSE_METER_HAS_PCNT
+
     switch (this->meter_state_) {
       // Running and initial states can timeout
       case MeterState::INITIAL:
@@ -130,7 +161,14 @@ float PulseMeterSensor::get_setup_priority() const { return setup_priority::DATA
 void PulseMeterSensor::dump_config() {
   LOG_SENSOR("", "Pulse Meter", this);
   LOG_PIN("  Pin: ", this->pin_);
-  if (this->filter_mode_ == FILTER_EDGE) {
+  if (this->use_pcnt_) {
+#ifdef PULSE_METER_HAS_PCNT
+    ESP_LOGCONFIG(TAG,
+                  "  Using PCNT unit %u\n"
+                  "  Hardware filter: %" PRIu32 " µs",
+                  this->pcnt_unit_, this->filter_us_);
+#endif  // PULSE_METER_HAS_PCNT
+  } else if (this->filter_mode_ == FILTER_EDGE) {
     ESP_LOGCONFIG(TAG, "  Filtering rising edges less than %" PRIu32 " µs apart", this->filter_us_);
   } else {
     ESP_LOGCONFIG(TAG, "  Filtering pulses shorter than %" PRIu32 " µs", this->filter_us_);
@@ -185,5 +223,111 @@ void IRAM_ATTR PulseMeterSensor::pulse_intr(PulseMeterSensor *sensor) {
   sensor->last_pin_val_ = pin_val;
 }
 
+#ifdef PULSE_METER_HAS_PCNT
+void IRAM_ATTR PulseMeterSensor::pcnt_intr(void *arg) {
+  // This is an interrupt handler - we can't call any virtual method from this method
+  // Get the current time before we do anything else so the measurements are consistent
+  const uint32_t now = micros();
+  auto *sensor = static_cast<PulseMeterSensor *>(arg);
+  auto &set = *sensor->set_;
+
+  // The counter reached its limit and restarted at the edge that just happened
+  set.last_detected_edge_us_ = now;
+  set.last_rising_edge_us_ = now;
+  set.count_ += sensor->pcnt_limit_;  // NOLINT(clang-diagnostic-deprecated-volatile)
+}
+
+bool PulseMeterSensor::pcnt_setup_() {
+  // pulse_counter hands out the units from the first one up, take them from the last one down
+  static int next_pcnt_unit = PCNT_UNIT_MAX - 1;
+  static bool isr_service_installed = false;
+  if (next_pcnt_unit < PCNT_UNIT_0) {
+    ESP_LOGE(TAG, "No free PCNT unit");
+    return false;
+  }
+  this->pcnt_unit_ = pcnt_unit_t(next_pcnt_unit--);
+
+  pcnt_config_t pcnt_config = {
+      .pulse_gpio_num = this->pin_->get_pin(),
+      .ctrl_gpio_num = PCNT_PIN_NOT_USED,
+      .lctrl_mode = PCNT_MODE_KEEP,
+      .hctrl_mode = PCNT_MODE_KEEP,
+      .pos_mode = PCNT_COUNT_INC,
+      .neg_mode = PCNT_COUNT_DIS,
+      .counter_h_lim = this->pcnt_limit_,
+      .counter_l_lim = 0,
+      .unit = this->pcnt_unit_,
+      .channel = PCNT_CHANNEL_0,
+  };
+  esp_err_t error = pcnt_unit_config(&pcnt_config);
+  if (error != ESP_OK) {
+    ESP_LOGE(TAG, "Configuring PCNT failed: %s", esp_err_to_name(error));
+    return false;
+  }
+
+  if (this->filter_us_ != 0) {
+    // The filter counts APB clock cycles
+    uint16_t filter_val = std::min(static_cast<unsigned int>(this->filter_us_ * 80u), 1023u);
+    error = pcnt_set_filter_value(this->pcnt_unit_, filter_val);
+    if (error == ESP_OK)
+      error = pcnt_filter_enable(this->pcnt_unit_);
+    if (error != ESP_OK) {
+      ESP_LOGE(TAG, "Setting PCNT filter failed: %s", esp_err_to_name(error));
+      return false;
+    }
+  }
+
+  if (!isr_service_installed) {
+    error = pcnt_isr_service_install(0);
+    if (error != ESP_OK) {
+      ESP_LOGE(TAG, "Installing PCNT ISR service failed: %s", esp_err_to_name(error));
+      return false;
+    }
+    isr_service_installed = true;
+  }
+  error = pcnt_event_enable(this->pcnt_unit_, PCNT_EVT_H_LIM);
+  if (error == ESP_OK)
+    error = pcnt_isr_handler_add(this->pcnt_unit_, PulseMeterSensor::pcnt_intr, this);
+  if (error != ESP_OK) {
+    ESP_LOGE(TAG, "Enabling PCNT interrupt failed: %s", esp_err_to_name(error));
+    return false;
+  }
+
+  pcnt_counter_pause(this->pcnt_unit_);
+  pcnt_counter_clear(this->pcnt_unit_);
+  pcnt_counter_resume(this->pcnt_unit_);
+  return true;
+}
+
+void PulseMeterSensor::pcnt_adapt_(float pulse_width_us) {
+  const int32_t limit = clamp<int32_t>(lroundf(PCNT_CAPTURE_INTERVAL_US / pulse_width_us), 1, INT16_MAX);
+  // Restarting the counter costs a measurement, only do it when the interrupt rate is off by more than 2x
+  if (limit > this->pcnt_limit_ * 2 || limit * 2 < this->pcnt_limit_)
+    this->pcnt_set_limit_(limit);
+}
+
+void PulseMeterSensor::pcnt_set_limit_(int16_t limit) {
+  int16_t counted = 0;
+  {
+    // Keep the interrupt from using the new limit for pulses counted with the old one
+    InterruptLock lock;
+    pcnt_counter_pause(this->pcnt_unit_);
+    pcnt_get_counter_value(this->pcnt_unit_, &counted);
+    pcnt_set_event_value(this->pcnt_unit_, PCNT_EVT_H_LIM, limit);
+    pcnt_counter_clear(this->pcnt_unit_);
+    this->pcnt_limit_ = limit;
+    pcnt_counter_resume(this->pcnt_unit_);
+  }
+  ESP_LOGV(TAG, "PCNT limit now %d pulses per interrupt", limit);
+
+  // The counted pulses don't end at a timestamped edge, so they can only go into the total
+  if (this->total_sensor_ != nullptr && counted > 0)
+    this->total_pulses_ += counted;
+  // The next interrupt is the new reference for the pulse width
+  if (this->meter_state_ == MeterState::RUNNING)
+    this->meter_state_ = MeterState::INITIAL;
+}
+#endif  // PULSE_METER_HAS_PCNT
+
 }  // namespace pulse_meter
 }  // namespace esphome
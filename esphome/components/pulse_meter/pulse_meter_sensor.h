@@ -7,6 +7,11 @@
 
 #include <cinttypes>
 
+#if defined(USE_ESP32) && !defined(USE_ESP32_VARIANT_ESP32C2) && !defined(USE_ESP32_VARIANT_ESP32C3)
+#include <driver/pcnt.h>
+#define PULSE_METER_HAS_PCNT
+#endif  // defined(USE_ESP32) && !defined(USE_ESP32_VARIANT_ESP32C2) && !defined(USE_ESP32_VARIANT_ESP32C3)
+
 namespace esphome {
 namespace pulse_meter {
 
@@ -22,23 +27,37 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
   void set_timeout_us(uint32_t timeout) { this->timeout_us_ = timeout; }
   void set_total_sensor(sensor::Sensor *sensor) { this->total_sensor_ = sensor; }
   void set_filter_mode(InternalFilterMode mode) { this->filter_mode_ = mode; }
+  /// Count the pulses with the ESP32 pulse counter peripheral instead of an interrupt per edge (edge filter only).
+  void set_use_pcnt(bool use_pcnt) { this->use_pcnt_ = use_pcnt; }
 
   void set_total_pulses(uint32_t pulses);
 
   void setup() override;
   void loop() override;
   float get_setup_priority() const override;
+#ifdef USE_LOOP_TIERS
+  LoopTier get_loop_tier() const override { return LoopTier::REALTIME; }
+#endif
   void dump_config() override;
 
  protected:
   static void edge_intr(PulseMeterSensor *sensor);
   static void pulse_intr(PulseMeterSensor *sensor);
+#ifdef PULSE_METER_HAS_PCNT
+  static void pcnt_intr(void *arg);
+  bool pcnt_setup_();
+  /// Adjust the pulses per interrupt to the pulse width, so the interrupt rate stays about the same
+  void pcnt_adapt_(float pulse_width_us);
+  /// Restart the hardware counter with a new limit, the pulses it has counted so far only go into the total
+  void pcnt_set_limit_(int16_t limit);
+#endif  // PULSE_METER_HAS_PCNT
 
   InternalGPIOPin *pin_{nullptr};
   uint32_t filter_us_ = 0;
   uint32_t timeout_us_ = 1000000UL * 60UL * 5UL;
   sensor::Sensor *total_sensor_{nullptr};
   InternalFilterMode filter_mode_{FILTER_EDGE};
+  bool use_pcnt_{false};
 
   // Variables used in the loop
   enum class MeterState { INITIAL, RUNNING, TIMED_OUT };
@@ -77,6 +96,12 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
     bool latched_ = false;
   };
   PulseState pulse_state_{};
+
+#ifdef PULSE_METER_HAS_PCNT
+  pcnt_unit_t pcnt_unit_{PCNT_UNIT_0};
+  /// The counter interrupts and restarts every this many pulses, the interrupt timestamps the last one
+  volatile int16_t pcnt_limit_{1};
+#endif  // PULSE_METER_HAS_PCNT
 };
 
 }  // namespace pulse_meter
@@ -17,6 +17,8 @@ from esphome.const import (
     UNIT_PULSES,
     UNIT_PULSES_PER_MINUTE,
 )
+from esphome.components.esp32 import get_esp32_variant
+from esphome.components.esp32.const import VARIANT_ESP32C2, VARIANT_ESP32C3
 from esphome.core import CORE
 
 CODEOWNERS = ["@stevebaxter", "@cstaahl", "@TrentHouliston"]
@@ -36,6 +38,8 @@ FILTER_MODES = {
 
 SetTotalPulsesAction = pulse_meter_ns.class_("SetTotalPulsesAction", automation.Action)
 
+CONF_USE_PCNT = "use_pcnt"
+
 
 def validate_internal_filter(value):
     return cv.positive_time_period_microseconds(value)
@@ -57,27 +61,49 @@ def validate_pulse_meter_pin(value):
     return value
 
 
-CONFIG_SCHEMA = sensor.sensor_schema(
-    PulseMeterSensor,
-    unit_of_measurement=UNIT_PULSES_PER_MINUTE,
-    icon=ICON_PULSE,
-    accuracy_decimals=2,
-    state_class=STATE_CLASS_MEASUREMENT,
-).extend(
-    {
-        cv.Required(CONF_PIN): validate_pulse_meter_pin,
-        cv.Optional(CONF_INTERNAL_FILTER, default="13us"): validate_internal_filter,
-        cv.Optional(CONF_TIMEOUT, default="5min"): validate_timeout,
-        cv.Optional(CONF_TOTAL): sensor.sensor_schema(
-            unit_of_measurement=UNIT_PULSES,
-            icon=ICON_PULSE,
-            accuracy_decimals=0,
-            state_class=STATE_CLASS_TOTAL_INCREASING,
-        ),
-        cv.Optional(CONF_INTERNAL_FILTER_MODE, default="EDGE"): cv.enum(
-            FILTER_MODES, upper=True
-        ),
-    }
+def validate_use_pcnt(config):
+    if not config[CONF_USE_PCNT]:
+        return config
+    if not CORE.is_esp32 or get_esp32_variant() in (VARIANT_ESP32C2, VARIANT_ESP32C3):
+        raise cv.Invalid("Hardware PCNT is not available on this chip", [CONF_USE_PCNT])
+    if config[CONF_INTERNAL_FILTER_MODE] != "EDGE":
+        raise cv.Invalid(
+            "Hardware PCNT only supports the EDGE filter mode",
+            [CONF_INTERNAL_FILTER_MODE],
+        )
+    if config[CONF_INTERNAL_FILTER].total_microseconds > 13:
+        raise cv.Invalid(
+            "Maximum internal filter value when using ESP32 hardware PCNT is 13us",
+            [CONF_INTERNAL_FILTER],
+        )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    sensor.sensor_schema(
+        PulseMeterSensor,
+        unit_of_measurement=UNIT_PULSES_PER_MINUTE,
+        icon=ICON_PULSE,
+        accuracy_decimals=2,
+        state_class=STATE_CLASS_MEASUREMENT,
+    ).extend(
+        {
+            cv.Required(CONF_PIN): validate_pulse_meter_pin,
+            cv.Optional(CONF_INTERNAL_FILTER, default="13us"): validate_internal_filter,
+            cv.Optional(CONF_TIMEOUT, default="5min"): validate_timeout,
+            cv.Optional(CONF_TOTAL): sensor.sensor_schema(
+                unit_of_measurement=UNIT_PULSES,
+                icon=ICON_PULSE,
+                accuracy_decimals=0,
+                state_class=STATE_CLASS_TOTAL_INCREASING,
+            ),
+            cv.Optional(CONF_INTERNAL_FILTER_MODE, default="EDGE"): cv.enum(
+                FILTER_MODES, upper=True
+            ),
+            cv.Optional(CONF_USE_PCNT, default=False): cv.boolean,
+        }
+    ),
+    validate_use_pcnt,
 )
 
 
@@ -90,6 +116,8 @@ async def to_code(config):
     cg.add(var.set_filter_us(config[CONF_INTERNAL_FILTER]))
     cg.add(var.set_timeout_us(config[CONF_TIMEOUT]))
     cg.add(var.set_filter_mode(config[CONF_INTERNAL_FILTER_MODE]))
+    if config[CONF_USE_PCNT]:
+        cg.add(var.set_use_pcnt(True))
 
     if CONF_TOTAL in config:
         sens = await sensor.new_sensor(config[CONF_TOTAL])
@@ -1,6 +1,7 @@
 #include "qmc5883l.h"
 #include "esphome/core/application.h"
 #include "esphome/core/log.h"
+#include "esphome/core/loop_arena.h"
 #include "esphome/core/hal.h"
 #include <cmath>
 
@@ -91,7 +92,7 @@ void QMC5883LComponent::update() {
   if (ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_DEBUG) {
     err = this->read_register(QMC5883L_REGISTER_STATUS, &status, 1);
     if (err != i2c::ERROR_OK) {
-      this->status_set_warning(str_sprintf("status read failed (%d)", err).c_str());
+      this->status_set_warning(arena_sprintf("status read failed (%d)", err).c_str());
       return;
     }
   }
@@ -113,7 +114,7 @@ void QMC5883LComponent::update() {
   }
   err = this->read_bytes_16_le_(start, &raw[dest], 3 - dest);
   if (err != i2c::ERROR_OK) {
-    this->status_set_warning(str_sprintf("mag read failed (%d)", err).c_str());
+    this->status_set_warning(arena_sprintf("mag read failed (%d)", err).c_str());
     return;
   }
 
@@ -141,7 +142,7 @@ void QMC5883LComponent::update() {
     uint16_t raw_temp;
     err = this->read_bytes_16_le_(QMC5883L_REGISTER_TEMPERATURE_LSB, &raw_temp);
     if (err != i2c::ERROR_OK) {
-      this->status_set_warning(str_sprintf("temp read failed (%d)", err).c_str());
+      this->status_set_warning(arena_sprintf("temp read failed (%d)", err).c_str());
       return;
     }
     temp = int16_t(raw_temp) * 0.01f;
@@ -88,6 +88,21 @@ bool RemoteReceiveData::expect_pulse_with_gap(uint32_t mark, uint32_t space) {
   return true;
 }
 
+/* RemoteTransmitData */
+
+void RemoteTransmitData::encode_bytes(const uint8_t *bytes, size_t len, uint32_t bit_mark, uint32_t one_space,
+                                      uint32_t zero_space, bool msb_first) {
+  // Indexed by the bit value, so the loop has no branch per bit
+  const int32_t spaces[2] = {-static_cast<int32_t>(zero_space), -static_cast<int32_t>(one_space)};
+  for (size_t i = 0; i < len; i++) {
+    uint8_t byte = bytes[i];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      this->data_.push_back(bit_mark);
+      this->data_.push_back(spaces[msb_first ? (byte >> (7 - bit)) & 1 : (byte >> bit) & 1]);
+    }
+  }
+}
+
 /* RemoteReceiverBinarySensorBase */
 
 bool RemoteReceiverBinarySensorBase::on_receive(RemoteReceiveData src) {
@@ -111,21 +126,33 @@ void RemoteReceiverBase::register_dumper(RemoteReceiverDumperBase *dumper) {
 
 void RemoteReceiverBase::call_listeners_() {
   for (auto *listener : this->listeners_)
-    listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_));
+    listener->on_receive(this->frame_data_());
 }
 
 void RemoteReceiverBase::call_dumpers_() {
   bool success = false;
   for (auto *dumper : this->dumpers_) {
-    if (dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_)))
+    if (dumper->dump(this->frame_data_()))
       success = true;
   }
   if (!success) {
     for (auto *dumper : this->secondary_dumpers_)
-      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_));
+      dumper->dump(this->frame_data_());
   }
 }
 
+void RemoteReceiverBase::call_listeners_dumpers_() {
+  // Counted across all receivers, so decode_once() never mixes up frames of two receivers
+  static uint32_t last_frame_id = 0;
+  if (++last_frame_id == 0)
+    last_frame_id = 1;
+  this->frame_id_ = last_frame_id;
+  this->call_listeners_();
+  this->call_dumpers_();
+  // temp_ will hold the next frame
+  this->frame_id_ = 0;
+}
+
 void RemoteReceiverBinarySensorBase::dump_config() { LOG_BINARY_SENSOR("", "Remote Receiver Binary Sensor", this); }
 
 void RemoteTransmitterBase::send_(uint32_t send_times, uint32_t send_wait) {
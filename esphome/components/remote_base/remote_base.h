@@ -27,6 +27,10 @@ class RemoteTransmitData {
     this->space(space);
   }
   void reserve(uint32_t len) { this->data_.reserve(len); }
+  /// Appends every bit of bytes as a bit_mark mark followed by a one_space or zero_space space. Callers reserve the
+  /// whole frame up front.
+  void encode_bytes(const uint8_t *bytes, size_t len, uint32_t bit_mark, uint32_t one_space, uint32_t zero_space,
+                    bool msb_first);
   void set_carrier_frequency(uint32_t carrier_frequency) { this->carrier_frequency_ = carrier_frequency; }
   uint32_t get_carrier_frequency() const { return this->carrier_frequency_; }
   const RawTimings &get_data() const { return this->data_; }
@@ -43,8 +47,9 @@ class RemoteTransmitData {
 
 class RemoteReceiveData {
  public:
-  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode)
-      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode) {}
+  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode,
+                             uint32_t frame_id = 0)
+      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode), frame_id_(frame_id) {}
 
   const RawTimings &get_raw_data() const { return this->data_; }
   uint32_t get_index() const { return index_; }
@@ -75,6 +80,8 @@ class RemoteReceiveData {
   }
   uint32_t get_tolerance() { return tolerance_; }
   ToleranceMode get_tolerance_mode() { return this->tolerance_mode_; }
+  /// Identifies the received frame across all receivers, 0 if it has no identity and mustn't be cached
+  uint32_t get_frame_id() const { return this->frame_id_; }
 
  protected:
   int32_t lower_bound_(uint32_t length) const {
@@ -98,6 +105,7 @@ class RemoteReceiveData {
   uint32_t index_;
   uint32_t tolerance_;
   ToleranceMode tolerance_mode_;
+  uint32_t frame_id_;
 };
 
 class RemoteComponentBase {
@@ -192,9 +200,9 @@ class RemoteReceiverBase : public RemoteComponentBase {
  protected:
   void call_listeners_();
   void call_dumpers_();
-  void call_listeners_dumpers_() {
-    this->call_listeners_();
-    this->call_dumpers_();
+  void call_listeners_dumpers_();
+  RemoteReceiveData frame_data_() const {
+    return RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_, this->frame_id_);
   }
 
   std::vector<RemoteReceiverListener *> listeners_;
@@ -203,6 +211,7 @@ class RemoteReceiverBase : public RemoteComponentBase {
   RawTimings temp_;
   uint32_t tolerance_{25};
   ToleranceMode tolerance_mode_{TOLERANCE_MODE_PERCENTAGE};
+  uint32_t frame_id_{0};
 };
 
 class RemoteReceiverBinarySensorBase : public binary_sensor::BinarySensorInitiallyOff,
@@ -225,14 +234,29 @@ template<typename T> class RemoteProtocol {
   virtual void dump(const ProtocolData &data) = 0;
 };
 
+/** Decodes a frame with protocol T once per frame, however many binary sensors, triggers and dumpers use T.
+ *
+ * Each of them would otherwise decode every frame again from the start. Frames without an id are always decoded.
+ */
+template<typename T> optional<typename T::ProtocolData> decode_once(RemoteReceiveData src) {
+  static uint32_t decoded_frame_id = 0;
+  static optional<typename T::ProtocolData> decoded;
+  if (src.get_frame_id() == 0)
+    return T().decode(src);
+  if (src.get_frame_id() != decoded_frame_id) {
+    decoded = T().decode(src);
+    decoded_frame_id = src.get_frame_id();
+  }
+  return decoded;
+}
+
 template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBinarySensorBase {
  public:
   RemoteReceiverBinarySensor() : RemoteReceiverBinarySensorBase() {}
 
  protected:
   bool matches(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = decode_once<T>(src);
     return res.has_value() && *res == this->data_;
   }
 
@@ -247,8 +271,7 @@ template<typename T>
 class RemoteReceiverTrigger : public Trigger<typename T::ProtocolData>, public RemoteReceiverListener {
  protected:
   bool on_receive(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = decode_once<T>(src);
     if (res.has_value()) {
       this->trigger(*res);
       return true;
@@ -289,11 +312,10 @@ template<typename... Ts> class RemoteTransmitterActionBase : public RemoteTransm
 template<typename T> class RemoteReceiverDumper : public RemoteReceiverDumperBase {
  public:
   bool dump(RemoteReceiveData src) override {
-    auto proto = T();
-    auto decoded = proto.decode(src);
+    auto decoded = decode_once<T>(src);
     if (!decoded.has_value())
       return false;
-    proto.dump(*decoded);
+    T().dump(*decoded);
     return true;
   }
 };
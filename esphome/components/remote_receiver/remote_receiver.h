@@ -59,6 +59,9 @@ class RemoteReceiverComponent : public remote_base::RemoteReceiverBase,
   void setup() override;
   void dump_config() override;
   void loop() override;
+#ifdef USE_LOOP_TIERS
+  LoopTier get_loop_tier() const override { return LoopTier::REALTIME; }
+#endif
 
 #ifdef USE_ESP32
   void set_filter_symbols(uint32_t filter_symbols) { this->filter_symbols_ = filter_symbols; }
@@ -6,12 +6,33 @@
 #include <vector>
 
 #if defined(USE_ESP32)
+#include <esp_idf_version.h>
 #include <driver/rmt_tx.h>
 #endif
 
 namespace esphome {
 namespace remote_transmitter {
 
+#if defined(USE_ESP32) && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+/// Progress of the RMT encoder through the timings being sent. Symbols are generated from the timings while the
+/// RMT peripheral sends, so no symbol buffer of the whole transmission is needed.
+struct RmtStream {
+  const int32_t *timings;
+  size_t count;
+  size_t index;               // next timing to encode
+  uint32_t ticks_per_ten_us;  // RMT clock
+  uint32_t ticks_left;        // of the timing being encoded
+  bool level;                 // of the timing being encoded, after inversion
+  bool inverted;
+  uint32_t repeats_left;      // copies to send after the current one
+  uint32_t wait_ticks;        // between copies
+  bool wait_level;
+  bool waiting;               // encoding the wait before the next copy
+  bool half_pending;          // the first half of `pending` is filled
+  rmt_symbol_word_t pending;
+};
+#endif
+
 class RemoteTransmitterComponent : public remote_base::RemoteTransmitterBase,
                                    public Component
 #ifdef USE_ESP32
@@ -57,7 +78,11 @@ class RemoteTransmitterComponent : public remote_base::RemoteTransmitterBase,
 
   uint32_t current_carrier_frequency_{38000};
   bool initialized_{false};
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+  RmtStream stream_{};
+#else
   std::vector<rmt_symbol_word_t> rmt_temp_;
+#endif
   bool with_dma_{false};
   bool eot_level_{false};
   rmt_channel_handle_t channel_{NULL};
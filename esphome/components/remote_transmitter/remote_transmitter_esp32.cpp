@@ -10,6 +10,69 @@ namespace remote_transmitter {
 
 static const char *const TAG = "remote_transmitter";
 
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+static const uint32_t RMT_MAX_DURATION = 32767;
+
+// Returns the next part of the transmission as one half of an RMT symbol, false when all copies were sent
+static bool IRAM_ATTR stream_next_half(RmtStream *stream, bool *level, uint32_t *duration) {
+  while (stream->ticks_left == 0) {
+    if (stream->index < stream->count) {
+      int32_t val = stream->timings[stream->index++];
+      stream->level = (val >= 0) ^ stream->inverted;
+      if (val < 0)
+        val = -val;
+      stream->ticks_left = static_cast<uint32_t>(val) * stream->ticks_per_ten_us / 10;
+    } else if (stream->repeats_left == 0) {
+      return false;
+    } else if (!stream->waiting && stream->wait_ticks > 0) {
+      // The wait between copies, at the level the line idles at after a transmission
+      stream->waiting = true;
+      stream->level = stream->wait_level;
+      stream->ticks_left = stream->wait_ticks;
+    } else {
+      stream->waiting = false;
+      stream->repeats_left--;
+      stream->index = 0;
+    }
+  }
+  *level = stream->level;
+  *duration = std::min(stream->ticks_left, RMT_MAX_DURATION);
+  stream->ticks_left -= *duration;
+  return true;
+}
+
+static size_t IRAM_ATTR HOT encoder_callback(const void *data, size_t size, size_t symbols_written,
+                                             size_t symbols_free, rmt_symbol_word_t *symbols, bool *done, void *arg) {
+  auto *stream = static_cast<RmtStream *>(arg);
+  size_t written = 0;
+  bool level;
+  uint32_t duration;
+  while (written < symbols_free) {
+    if (!stream_next_half(stream, &level, &duration)) {
+      if (stream->half_pending) {
+        stream->pending.level1 = 0;
+        stream->pending.duration1 = 0;
+        symbols[written++] = stream->pending;
+        stream->half_pending = false;
+      }
+      *done = true;
+      break;
+    }
+    if (!stream->half_pending) {
+      stream->pending.level0 = level;
+      stream->pending.duration0 = duration;
+      stream->half_pending = true;
+    } else {
+      stream->pending.level1 = level;
+      stream->pending.duration1 = duration;
+      symbols[written++] = stream->pending;
+      stream->half_pending = false;
+    }
+  }
+  return written;
+}
+#endif
+
 void RemoteTransmitterComponent::setup() {
   ESP_LOGCONFIG(TAG, "Running setup");
   this->inverted_ = this->pin_->is_inverted();
@@ -35,17 +98,28 @@ void RemoteTransmitterComponent::dump_config() {
 }
 
 void RemoteTransmitterComponent::digital_write(bool value) {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+  // A single tick at the level, without any timings
+  this->stream_ = {};
+  this->stream_.ticks_left = 1;
+  this->stream_.level = value;
+  const void *payload = &this->stream_;
+  const size_t payload_size = sizeof(this->stream_);
+#else
   rmt_symbol_word_t symbol = {
       .duration0 = 1,
       .level0 = value,
       .duration1 = 0,
       .level1 = value,
   };
+  const void *payload = &symbol;
+  const size_t payload_size = sizeof(symbol);
+#endif
   rmt_transmit_config_t config;
   memset(&config, 0, sizeof(config));
   config.loop_count = 0;
   config.flags.eot_level = value;
-  esp_err_t error = rmt_transmit(this->channel_, this->encoder_, &symbol, sizeof(symbol), &config);
+  esp_err_t error = rmt_transmit(this->channel_, this->encoder_, payload, payload_size, &config);
   if (error != ESP_OK) {
     ESP_LOGW(TAG, "rmt_transmit failed: %s", esp_err_to_name(error));
     this->status_set_warning();
@@ -91,6 +165,20 @@ void RemoteTransmitterComponent::configure_rmt_() {
       gpio_pullup_dis(gpio_num_t(this->pin_->get_pin()));
     }
 
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+    rmt_simple_encoder_config_t encoder;
+    memset(&encoder, 0, sizeof(encoder));
+    encoder.callback = encoder_callback;
+    encoder.arg = &this->stream_;
+    encoder.min_chunk_size = 1;
+    error = rmt_new_simple_encoder(&encoder, &this->encoder_);
+    if (error != ESP_OK) {
+      this->error_code_ = error;
+      this->error_string_ = "in rmt_new_simple_encoder";
+      this->mark_failed();
+      return;
+    }
+#else
     rmt_copy_encoder_config_t encoder;
     memset(&encoder, 0, sizeof(encoder));
     error = rmt_new_copy_encoder(&encoder, &this->encoder_);
@@ -100,6 +188,7 @@ void RemoteTransmitterComponent::configure_rmt_() {
       this->mark_failed();
       return;
     }
+#endif
 
     error = rmt_enable(this->channel_);
     if (error != ESP_OK) {
@@ -140,6 +229,41 @@ void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t sen
     this->configure_rmt_();
   }
 
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+  const auto &timings = this->temp_.get_data();
+  if (timings.empty() || send_times == 0) {
+    ESP_LOGE(TAG, "Empty data");
+    return;
+  }
+  // All copies go out as one transmission, the encoder inserts the waits between them
+  this->stream_ = {};
+  this->stream_.timings = timings.data();
+  this->stream_.count = timings.size();
+  this->stream_.ticks_per_ten_us = this->clock_resolution_ / 100000u;
+  this->stream_.inverted = this->inverted_;
+  this->stream_.repeats_left = send_times - 1;
+  this->stream_.wait_ticks = this->from_microseconds_(send_wait);
+  this->stream_.wait_level = this->eot_level_;
+
+  this->transmit_trigger_->trigger();
+  rmt_transmit_config_t config;
+  memset(&config, 0, sizeof(config));
+  config.loop_count = 0;
+  config.flags.eot_level = this->eot_level_;
+  esp_err_t error =
+      rmt_transmit(this->channel_, this->encoder_, timings.data(), timings.size() * sizeof(int32_t), &config);
+  if (error != ESP_OK) {
+    ESP_LOGW(TAG, "rmt_transmit failed: %s", esp_err_to_name(error));
+    this->status_set_warning();
+  } else {
+    this->status_clear_warning();
+  }
+  error = rmt_tx_wait_all_done(this->channel_, -1);
+  if (error != ESP_OK) {
+    ESP_LOGW(TAG, "rmt_tx_wait_all_done failed: %s", esp_err_to_name(error));
+    this->status_set_warning();
+  }
+#else
   this->rmt_temp_.clear();
   this->rmt_temp_.reserve((this->temp_.get_data().size() + 1) / 2);
   uint32_t rmt_i = 0;
@@ -199,6 +323,7 @@ void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t sen
     if (i + 1 < send_times)
       delayMicroseconds(send_wait);
   }
+#endif
   this->complete_trigger_->trigger();
 }
 
@@ -87,6 +87,7 @@ async def to_code(config):
     cg.add(var.set_output_speaker(output_spkr))
 
     cg.add(var.set_buffer_duration(config[CONF_BUFFER_DURATION]))
+    audio.add_audio_stats_stage(var, str(config[CONF_ID]))
 
     if task_stack_in_psram := config.get(CONF_TASK_STACK_IN_PSRAM):
         cg.add(var.set_task_stack_in_psram(task_stack_in_psram))
@@ -265,6 +265,11 @@ void ResamplerSpeaker::resample_task(void *params) {
   esp_err_t err = resampler->start(this_resampler->audio_stream_info_, this_resampler->target_stream_info_,
                                    this_resampler->taps_, this_resampler->filters_);
 
+#ifdef USE_AUDIO_STATS
+  // Kept alive by the resampler, which owns the ring buffer. Locking the weak_ptr would make play() drop audio.
+  RingBuffer *stats_ring_buffer = nullptr;
+#endif
+
   if (err == ESP_OK) {
     std::shared_ptr<RingBuffer> temp_ring_buffer =
         RingBuffer::create(this_resampler->audio_stream_info_.ms_to_bytes(this_resampler->buffer_duration_ms_));
@@ -277,6 +282,10 @@ void ResamplerSpeaker::resample_task(void *params) {
 
       this_resampler->output_speaker_->set_audio_stream_info(this_resampler->target_stream_info_);
       resampler->add_sink(this_resampler->output_speaker_);
+#ifdef USE_AUDIO_STATS
+      resampler->set_stats(this_resampler->audio_stats_);
+      stats_ring_buffer = temp_ring_buffer.get();
+#endif
     }
   }
 
@@ -299,6 +308,14 @@ void ResamplerSpeaker::resample_task(void *params) {
     int32_t ms_differential = 0;
     audio::AudioResamplerState resampler_state = resampler->resample(false, &ms_differential);
 
+#ifdef USE_AUDIO_STATS
+    if ((this_resampler->audio_stats_ != nullptr) && (stats_ring_buffer != nullptr)) {
+      const size_t available = stats_ring_buffer->available();
+      this_resampler->audio_stats_->record_fill(available, stats_ring_buffer->free());
+      this_resampler->audio_stats_->set_buffered_ms(this_resampler->audio_stream_info_.bytes_to_ms(available));
+    }
+#endif
+
     if (resampler_state == audio::AudioResamplerState::FINISHED) {
       break;
     } else if (resampler_state == audio::AudioResamplerState::FAILED) {
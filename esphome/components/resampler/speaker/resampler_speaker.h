@@ -3,6 +3,7 @@
 #ifdef USE_ESP32
 
 #include "esphome/components/audio/audio.h"
+#include "esphome/components/audio/audio_stats.h"
 #include "esphome/components/audio/audio_transfer_buffer.h"
 #include "esphome/components/speaker/speaker.h"
 
@@ -53,6 +54,10 @@ class ResamplerSpeaker : public Component, public speaker::Speaker {
 
   void set_buffer_duration(uint32_t buffer_duration_ms) { this->buffer_duration_ms_ = buffer_duration_ms; }
 
+#ifdef USE_AUDIO_STATS
+  void set_audio_stats_name(const std::string &name) { this->audio_stats_ = new audio::AudioStageStats(name); }
+#endif
+
  protected:
   /// @brief Starts the output speaker after setting the resampled stream info. If resampling is required, it starts the
   /// task.
@@ -101,6 +106,10 @@ class ResamplerSpeaker : public Component, public speaker::Speaker {
   uint32_t buffer_duration_ms_;
 
   uint64_t callback_remainder_{0};
+
+#ifdef USE_AUDIO_STATS
+  audio::AudioStageStats *audio_stats_{nullptr};
+#endif
 };
 
 }  // namespace resampler
@@ -150,8 +150,14 @@ void RP2040PIOLEDStripLightOutput::write_state(light::LightState *state) {
     return;
   }
 
+  // Long strips take longer to send than a loop iteration. Instead of blocking the loop until the previous frame is
+  // out, send the current buffer once the DMA channel is free again.
+  if (!sem_try_acquire(&RP2040PIOLEDStripLightOutput::dma_write_complete_sem_[this->dma_chan_])) {
+    this->set_timeout("write", 1, [this]() { this->write_state(nullptr); });
+    return;
+  }
+
   // the bits are already in the correct order for the pio program so we can just copy the buffer using DMA
-  sem_acquire_blocking(&RP2040PIOLEDStripLightOutput::dma_write_complete_sem_[this->dma_chan_]);
   dma_channel_transfer_from_buffer_now(this->dma_chan_, this->buf_, this->get_buffer_size_());
 }
 
@@ -0,0 +1,116 @@
+from esphome import automation
+import esphome.codegen as cg
+from esphome.components import sensor, time
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_ID,
+    CONF_SENSOR_ID,
+    CONF_SENSORS,
+    CONF_SIZE,
+    CONF_THRESHOLD,
+    CONF_TIME_ID,
+    CONF_TRIGGER_ID,
+    PLATFORM_ESP32,
+    PLATFORM_ESP8266,
+)
+from esphome.core import CORE
+
+DEPENDENCIES = ["sensor"]
+
+CONF_ON_UPLOAD = "on_upload"
+CONF_UPLOAD_EVERY = "upload_every"
+
+rtc_history_ns = cg.esphome_ns.namespace("rtc_history")
+RtcHistory = rtc_history_ns.class_("RtcHistory", cg.Component)
+HistoryReading = rtc_history_ns.struct("HistoryReading")
+UploadTrigger = rtc_history_ns.class_(
+    "UploadTrigger", automation.Trigger.template(cg.std_vector.template(HistoryReading))
+)
+UploadAction = rtc_history_ns.class_("UploadAction", automation.Action)
+UploadDueCondition = rtc_history_ns.class_("UploadDueCondition", automation.Condition)
+
+
+def _validate_size(config):
+    # The ESP8266 shares its 512 bytes of RTC user memory with the other preferences
+    if CORE.is_esp8266 and config[CONF_SIZE] > 16:
+        raise cv.Invalid(
+            "The ESP8266 can keep at most 16 readings in RTC memory", path=[CONF_SIZE]
+        )
+    return config
+
+
+SENSOR_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_SENSOR_ID): cv.use_id(sensor.Sensor),
+        cv.Optional(CONF_THRESHOLD): cv.positive_float,
+    }
+)
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(RtcHistory),
+            cv.Required(CONF_SENSORS): cv.All(
+                cv.ensure_list(SENSOR_SCHEMA), cv.Length(min=1, max=8)
+            ),
+            cv.Optional(CONF_SIZE, default=16): cv.int_range(min=1, max=128),
+            cv.Optional(CONF_UPLOAD_EVERY, default=10): cv.int_range(
+                min=1, max=65535
+            ),
+            cv.Optional(CONF_TIME_ID): cv.use_id(time.RealTimeClock),
+            cv.Optional(CONF_ON_UPLOAD): automation.validate_automation(
+                {
+                    cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(UploadTrigger),
+                }
+            ),
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    cv.only_on([PLATFORM_ESP32, PLATFORM_ESP8266]),
+    _validate_size,
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    cg.add_define("ESPHOME_RTC_HISTORY_SIZE", config[CONF_SIZE])
+    cg.add_define("ESPHOME_RTC_HISTORY_SENSORS", len(config[CONF_SENSORS]))
+    for conf in config[CONF_SENSORS]:
+        sens = await cg.get_variable(conf[CONF_SENSOR_ID])
+        cg.add(var.add_sensor(sens, conf.get(CONF_THRESHOLD, float("nan"))))
+    cg.add(var.set_upload_every(config[CONF_UPLOAD_EVERY]))
+    if CONF_TIME_ID in config:
+        time_ = await cg.get_variable(config[CONF_TIME_ID])
+        cg.add(var.set_time(time_))
+
+    for conf in config.get(CONF_ON_UPLOAD, []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        await automation.build_automation(
+            trigger, [(cg.std_vector.template(HistoryReading), "readings")], conf
+        )
+
+
+RTC_HISTORY_ACTION_SCHEMA = automation.maybe_simple_id(
+    {
+        cv.GenerateID(): cv.use_id(RtcHistory),
+    }
+)
+
+
+@automation.register_action(
+    "rtc_history.upload", UploadAction, RTC_HISTORY_ACTION_SCHEMA
+)
+async def rtc_history_upload_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_condition(
+    "rtc_history.upload_due", UploadDueCondition, RTC_HISTORY_ACTION_SCHEMA
+)
+async def rtc_history_upload_due_to_code(config, condition_id, template_arg, args):
+    var = cg.new_Pvariable(condition_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
@@ -0,0 +1,133 @@
+#include "rtc_history.h"
+#include "esphome/core/application.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <cmath>
+
+#ifdef USE_ESP32
+#include <esp_attr.h>
+#endif
+
+namespace esphome {
+namespace rtc_history {
+
+static const char *const TAG = "rtc_history";
+static constexpr uint32_t PREFERENCE_HASH = fnv1_hash("rtc_history");
+
+struct HistoryStore {
+  /// Hash of the build, a different firmware may have a different layout or sensors
+  uint32_t build;
+  uint16_t head;
+  uint16_t count;
+  uint16_t wakes;
+  uint8_t due;
+  /// Value of every sensor in the last upload, NAN before the first one
+  float uploaded[ESPHOME_RTC_HISTORY_SENSORS];
+  HistoryReading readings[ESPHOME_RTC_HISTORY_SIZE];
+};
+
+#ifdef USE_ESP32
+// RTC slow memory keeps its contents through deep sleep and resets, it is cleared on power on
+static RTC_DATA_ATTR HistoryStore store;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#else
+// The RTC user memory is read and written through a preference that isn't in flash
+static HistoryStore store;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+
+void RtcHistory::add_sensor(sensor::Sensor *sensor, float threshold) {
+  uint8_t index = this->sensors_.size();
+  this->sensors_.push_back(sensor);
+  this->thresholds_.push_back(threshold);
+  sensor->add_on_state_callback([this, index](float value) { this->record_(index, value); });
+}
+
+void RtcHistory::setup() {
+  uint32_t build = fnv1_hash(App.get_compilation_time());
+#ifdef USE_ESP8266
+  this->pref_ = global_preferences->make_preference<HistoryStore>(PREFERENCE_HASH, false);
+  if (!this->pref_.load(&store))
+    store.build = 0;
+#endif
+  if (store.build != build || store.count > ESPHOME_RTC_HISTORY_SIZE || store.head >= ESPHOME_RTC_HISTORY_SIZE) {
+    store.build = build;
+    store.head = 0;
+    store.count = 0;
+    store.wakes = 0;
+    store.due = true;
+    for (float &value : store.uploaded)
+      value = NAN;
+  }
+  if (++store.wakes >= this->upload_every_)
+    store.due = true;
+  this->save_();
+}
+
+void RtcHistory::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "RTC History:\n"
+                "  Size: %u\n"
+                "  Upload Every: %u wakes\n"
+                "  Stored: %u readings, %u wakes\n"
+                "  Upload Due: %s",
+                ESPHOME_RTC_HISTORY_SIZE, this->upload_every_, store.count, store.wakes, YESNO(store.due));
+  for (size_t i = 0; i < this->sensors_.size(); i++) {
+    ESP_LOGCONFIG(TAG, "  Sensor '%s', threshold %.2f", this->sensors_[i]->get_name().c_str(), this->thresholds_[i]);
+  }
+}
+
+bool RtcHistory::is_upload_due() const { return store.due; }
+
+size_t RtcHistory::size() const { return store.count; }
+
+void RtcHistory::record_(uint8_t index, float value) {
+  if (std::isnan(value))
+    return;
+  HistoryReading &reading = store.readings[store.head];
+  reading.timestamp = 0;
+#ifdef USE_TIME
+  if (this->time_ != nullptr) {
+    ESPTime now = this->time_->now();
+    if (now.is_valid())
+      reading.timestamp = now.timestamp;
+  }
+#endif
+  reading.value = value;
+  reading.sensor = index;
+  store.head = (store.head + 1) % ESPHOME_RTC_HISTORY_SIZE;
+  if (store.count < ESPHOME_RTC_HISTORY_SIZE)
+    store.count++;
+
+  // Comparisons with NAN are false, so a missing threshold or first upload never makes it due here
+  if (std::fabs(value - store.uploaded[index]) >= this->thresholds_[index])
+    store.due = true;
+  this->save_();
+}
+
+void RtcHistory::upload() {
+  std::vector<HistoryReading> readings;
+  readings.reserve(store.count);
+  size_t start = (store.head + ESPHOME_RTC_HISTORY_SIZE - store.count) % ESPHOME_RTC_HISTORY_SIZE;
+  for (size_t i = 0; i < store.count; i++) {
+    const HistoryReading &reading = store.readings[(start + i) % ESPHOME_RTC_HISTORY_SIZE];
+    readings.push_back(reading);
+    store.uploaded[reading.sensor] = reading.value;
+  }
+  ESP_LOGD(TAG, "Uploading %u readings from %u wakes", store.count, store.wakes);
+
+  store.head = 0;
+  store.count = 0;
+  store.wakes = 0;
+  store.due = false;
+  this->save_();
+  this->upload_callback_.call(std::move(readings));
+}
+
+void RtcHistory::save_() {
+#ifdef USE_ESP8266
+  this->pref_.save(&store);
+#endif
+}
+
+}  // namespace rtc_history
+}  // namespace esphome
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/preferences.h"
+#include "esphome/components/sensor/sensor.h"
+
+#ifdef USE_TIME
+#include "esphome/components/time/real_time_clock.h"
+#endif
+
+#include <vector>
+
+namespace esphome {
+namespace rtc_history {
+
+/// One stored sensor value
+struct HistoryReading {
+  /// UNIX time of the reading, 0 without a valid time source
+  uint32_t timestamp;
+  float value;
+  /// Index of the sensor in the order of the configuration
+  uint8_t sensor;
+};
+
+/** Keeps sensor readings in RTC memory through deep sleep, so the network only has to come up every few wakes.
+ *
+ * The readings of the configured sensors go into a ring held in RTC memory, the oldest are overwritten when it is
+ * full. The history is due for upload once upload_every wakes passed since the last upload, or when a sensor moved at
+ * least its threshold away from the value it had in the last upload. The upload action hands the readings to the
+ * on_upload triggers, oldest first, and starts a new history. A fresh history after power on is due right away.
+ */
+class RtcHistory : public Component {
+ public:
+  void setup() override;
+  void dump_config() override;
+  // Before the sensors, so their first states are recorded
+  float get_setup_priority() const override { return setup_priority::HARDWARE; }
+
+  /// threshold is NAN when the sensor can't make the upload due
+  void add_sensor(sensor::Sensor *sensor, float threshold);
+  void set_upload_every(uint16_t upload_every) { this->upload_every_ = upload_every; }
+#ifdef USE_TIME
+  void set_time(time::RealTimeClock *time) { this->time_ = time; }
+#endif
+
+  bool is_upload_due() const;
+  size_t size() const;
+  /// Hands the readings to the upload callbacks, oldest first, and clears them
+  void upload();
+
+  void add_on_upload_callback(std::function<void(std::vector<HistoryReading>)> &&callback) {
+    this->upload_callback_.add(std::move(callback));
+  }
+
+ protected:
+  void record_(uint8_t index, float value);
+  void save_();
+
+  std::vector<sensor::Sensor *> sensors_;
+  std::vector<float> thresholds_;
+  CallbackManager<void(std::vector<HistoryReading>)> upload_callback_;
+#ifdef USE_TIME
+  time::RealTimeClock *time_{nullptr};
+#endif
+#ifdef USE_ESP8266
+  ESPPreferenceObject pref_;
+#endif
+  uint16_t upload_every_{10};
+};
+
+class UploadTrigger : public Trigger<std::vector<HistoryReading>> {
+ public:
+  explicit UploadTrigger(RtcHistory *parent) {
+    parent->add_on_upload_callback([this](std::vector<HistoryReading> readings) { this->trigger(readings); });
+  }
+};
+
+template<typename... Ts> class UploadAction : public Action<Ts...>, public Parented<RtcHistory> {
+ public:
+  void play(Ts... x) override { this->parent_->upload(); }
+};
+
+template<typename... Ts> class UploadDueCondition : public Condition<Ts...>, public Parented<RtcHistory> {
+ public:
+  bool check(Ts... x) override { return this->parent_->is_upload_due(); }
+};
+
+}  // namespace rtc_history
+}  // namespace esphome
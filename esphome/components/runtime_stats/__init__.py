@@ -2,16 +2,37 @@
 Runtime statistics component for ESPHome.
 """
 
+from esphome import automation
 import esphome.codegen as cg
+from esphome.components import web_server_base
+from esphome.components.web_server_base import CONF_WEB_SERVER_BASE_ID
 import esphome.config_validation as cv
-from esphome.const import CONF_ID
+from esphome.const import CONF_BUFFER_SIZE, CONF_ID
 
 CODEOWNERS = ["@bdraco"]
 
 CONF_LOG_INTERVAL = "log_interval"
+CONF_RUNTIME_STATS_ID = "runtime_stats_id"
+CONF_TRACE = "trace"
+CONF_WEB_HANDLER_ID = "web_handler_id"
 
 runtime_stats_ns = cg.esphome_ns.namespace("runtime_stats")
 RuntimeStatsCollector = runtime_stats_ns.class_("RuntimeStatsCollector")
+TraceBuffer = runtime_stats_ns.class_("TraceBuffer")
+TraceWebHandler = runtime_stats_ns.class_("TraceWebHandler", cg.Component)
+DumpTraceAction = runtime_stats_ns.class_("DumpTraceAction", automation.Action)
+
+TRACE_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(TraceBuffer),
+        cv.GenerateID(CONF_WEB_HANDLER_ID): cv.declare_id(TraceWebHandler),
+        cv.OnlyWith(CONF_WEB_SERVER_BASE_ID, "web_server_base"): cv.use_id(
+            web_server_base.WebServerBase
+        ),
+        # Each event takes about 110 bytes of JSON in the export
+        cv.Optional(CONF_BUFFER_SIZE, default=256): cv.int_range(min=16, max=2048),
+    }
+)
 
 CONFIG_SCHEMA = cv.Schema(
     {
@@ -19,6 +40,7 @@ CONFIG_SCHEMA = cv.Schema(
         cv.Optional(
             CONF_LOG_INTERVAL, default="60s"
         ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_TRACE): TRACE_SCHEMA,
     }
 )
 
@@ -32,3 +54,23 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
 
     cg.add(var.set_log_interval(config[CONF_LOG_INTERVAL]))
+
+    if trace_config := config.get(CONF_TRACE):
+        cg.add_define("USE_RUNTIME_STATS_TRACE")
+        # The constructor sets global_trace_buffer
+        cg.new_Pvariable(trace_config[CONF_ID], trace_config[CONF_BUFFER_SIZE])
+        if CONF_WEB_SERVER_BASE_ID in trace_config:
+            cg.add_define("USE_RUNTIME_STATS_TRACE_WEB")
+            base = await cg.get_variable(trace_config[CONF_WEB_SERVER_BASE_ID])
+            handler = cg.new_Pvariable(trace_config[CONF_WEB_HANDLER_ID], base)
+            await cg.register_component(handler, {})
+
+
+@automation.register_action(
+    "runtime_stats.dump_trace",
+    DumpTraceAction,
+    automation.maybe_simple_id({cv.GenerateID(): cv.use_id(TraceBuffer)}),
+)
+async def dump_trace_to_code(config, action_id, template_arg, args):
+    buffer = await cg.get_variable(config[CONF_ID])
+    return cg.new_Pvariable(action_id, template_arg, buffer)
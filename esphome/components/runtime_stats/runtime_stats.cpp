@@ -2,7 +2,9 @@
 
 #ifdef USE_RUNTIME_STATS
 
+#include "esphome/core/application.h"
 #include "esphome/core/component.h"
+#include "esphome/core/loop_arena.h"
 #include <algorithm>
 
 namespace esphome {
@@ -13,21 +15,28 @@ RuntimeStatsCollector::RuntimeStatsCollector() : log_interval_(60000), next_log_
   global_runtime_stats = this;
 }
 
-void RuntimeStatsCollector::record_component_time(Component *component, uint32_t duration_ms, uint32_t current_time) {
+void RuntimeStatsCollector::record_component_time(Component *component, ComponentTimingSource source,
+                                                  uint32_t duration_ms, uint32_t duration_us, uint32_t current_time) {
   if (component == nullptr)
     return;
 
   // Check if we have cached the name for this component
+  const char *name;
   auto name_it = this->component_names_cache_.find(component);
   if (name_it == this->component_names_cache_.end()) {
     // First time seeing this component, cache its name
-    const char *source = component->get_component_source();
-    this->component_names_cache_[component] = source;
-    this->component_stats_[source].record_time(duration_ms);
+    name = component->get_component_source();
+    this->component_names_cache_[component] = name;
   } else {
-    this->component_stats_[name_it->second].record_time(duration_ms);
+    name = name_it->second;
   }
 
+  ComponentRuntimeStats &stats = this->component_stats_[name];
+  // Setup runs once and would skew the per-call averages, it is only tracked as a latency
+  if (source != ComponentTimingSource::SETUP)
+    stats.record_time(duration_ms);
+  stats.record_latency(source, duration_us);
+
   if (this->next_log_time_ == 0) {
     this->next_log_time_ = current_time + this->log_interval_;
     return;
@@ -79,7 +88,80 @@ void RuntimeStatsCollector::log_stats_() {
              stats->get_total_count(), stats->get_total_avg_time_ms(), stats->get_total_max_time_ms(),
              stats->get_total_time_ms());
   }
+
+  this->log_latency_();
+
+#ifdef ESPHOME_SCHEDULER_POOL_SIZE
+  ESP_LOGI(TAG, "Scheduler pool: in_use=%" PRIu16 ", high_water=%" PRIu16 "/%u, allocs=%" PRIu32 ", reuses=%" PRIu32,
+           App.scheduler.get_items_in_use(), App.scheduler.get_items_high_water(), ESPHOME_SCHEDULER_POOL_SIZE,
+           App.scheduler.get_pool_allocations(), App.scheduler.get_pool_reuses());
+#endif
+#ifdef ESPHOME_SCHEDULER_DEFER_RING
+  ESP_LOGI(TAG, "Defer ring: high_water=%u/%u, overflows=%" PRIu32, App.scheduler.get_defer_ring_high_water(),
+           ESPHOME_SCHEDULER_DEFER_RING_SIZE, App.scheduler.get_defer_ring_overflows());
+#endif
+  ESP_LOGI(TAG, "Loop arena: high_water=%u/%u, overflows=%" PRIu32,
+           static_cast<unsigned>(global_loop_arena.get_high_water()), ESPHOME_LOOP_ARENA_SIZE,
+           global_loop_arena.get_overflow_count());
+}
+
+void RuntimeStatsCollector::log_latency_() {
+  ESP_LOGI(TAG, "Latency (last %" PRIu32 "ms, microseconds):", this->log_interval_);
+  for (const auto &it : this->component_stats_) {
+    const LatencyHistogram &loop = it.second.get_loop_latency();
+    const LatencyHistogram &sched = it.second.get_scheduler_latency();
+    if (loop.get_count() > 0) {
+      ESP_LOGI(TAG, "  %s loop: p50=%" PRIu32 ", p90=%" PRIu32 ", p99=%" PRIu32 ", max=%" PRIu32, it.first,
+               loop.get_percentile_us(0.5f), loop.get_percentile_us(0.9f), loop.get_percentile_us(0.99f),
+               loop.get_max_us());
+    }
+    if (sched.get_count() > 0) {
+      ESP_LOGI(TAG, "  %s scheduler: p50=%" PRIu32 ", p90=%" PRIu32 ", p99=%" PRIu32 ", max=%" PRIu32, it.first,
+               sched.get_percentile_us(0.5f), sched.get_percentile_us(0.9f), sched.get_percentile_us(0.99f),
+               sched.get_max_us());
+    }
+  }
+
+  // Setup only happens once, report it with the first statistics
+  if (!this->setup_times_logged_) {
+    this->setup_times_logged_ = true;
+    ESP_LOGI(TAG, "Setup times (microseconds):");
+    for (const auto &it : this->component_stats_) {
+      if (it.second.get_setup_time_us() > 0)
+        ESP_LOGI(TAG, "  %s: %" PRIu32, it.first, it.second.get_setup_time_us());
+    }
+  }
+}
+
+#ifdef USE_TEXT_SENSOR
+void RuntimeStatsCollector::publish_slowest_(text_sensor::TextSensor *sensor, ComponentTimingSource source) {
+  if (sensor == nullptr)
+    return;
+
+  const char *slowest_name = nullptr;
+  const LatencyHistogram *slowest = nullptr;
+  for (const auto &it : this->component_stats_) {
+    const LatencyHistogram &histogram = source == ComponentTimingSource::SCHEDULER ? it.second.get_scheduler_latency()
+                                                                                    : it.second.get_loop_latency();
+    if (histogram.get_count() == 0)
+      continue;
+    if (slowest == nullptr || histogram.get_percentile_us(0.99f) > slowest->get_percentile_us(0.99f) ||
+        (histogram.get_percentile_us(0.99f) == slowest->get_percentile_us(0.99f) &&
+         histogram.get_max_us() > slowest->get_max_us())) {
+      slowest_name = it.first;
+      slowest = &histogram;
+    }
+  }
+  if (slowest == nullptr)
+    return;
+
+  char buf[128];
+  snprintf(buf, sizeof(buf), "%s p50=%" PRIu32 "us p90=%" PRIu32 "us p99=%" PRIu32 "us max=%" PRIu32 "us",
+           slowest_name, slowest->get_percentile_us(0.5f), slowest->get_percentile_us(0.9f),
+           slowest->get_percentile_us(0.99f), slowest->get_max_us());
+  sensor->publish_state(buf);
 }
+#endif
 
 void RuntimeStatsCollector::process_pending_stats(uint32_t current_time) {
   if (this->next_log_time_ == 0)
@@ -87,6 +169,10 @@ void RuntimeStatsCollector::process_pending_stats(uint32_t current_time) {
 
   if (current_time >= this->next_log_time_) {
     this->log_stats_();
+#ifdef USE_TEXT_SENSOR
+    this->publish_slowest_(this->loop_latency_text_sensor_, ComponentTimingSource::LOOP);
+    this->publish_slowest_(this->scheduler_latency_text_sensor_, ComponentTimingSource::SCHEDULER);
+#endif
     this->reset_stats_();
     this->next_log_time_ = current_time + this->log_interval_;
   }
@@ -4,21 +4,79 @@
 
 #ifdef USE_RUNTIME_STATS
 
+#include <algorithm>
 #include <map>
 #include <vector>
 #include <cstdint>
 #include <cstring>
+#include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
-namespace esphome {
+#ifdef USE_TEXT_SENSOR
+#include "esphome/components/text_sensor/text_sensor.h"
+#endif
 
-class Component;  // Forward declaration
+namespace esphome {
 
 namespace runtime_stats {
 
 static const char *const TAG = "runtime_stats";
 
+/** Latency histogram with logarithmic (power of two) microsecond buckets.
+ *
+ * Bucket 0 counts samples below 16us, bucket i counts samples in [2^(i+3), 2^(i+4)) us and the last
+ * bucket collects everything from ~262ms upwards. Percentiles are reported as the upper bound of the
+ * bucket that contains them, so they are accurate to within a factor of two.
+ */
+class LatencyHistogram {
+ public:
+  static constexpr uint8_t BUCKET_COUNT = 16;
+
+  void record(uint32_t duration_us) {
+    uint8_t bucket = 0;
+    if (duration_us >= 16) {
+      bucket = 31 - __builtin_clz(duration_us) - 3;
+      if (bucket >= BUCKET_COUNT)
+        bucket = BUCKET_COUNT - 1;
+    }
+    this->buckets_[bucket]++;
+    this->count_++;
+    if (duration_us > this->max_us_)
+      this->max_us_ = duration_us;
+  }
+
+  void reset() {
+    memset(this->buckets_, 0, sizeof(this->buckets_));
+    this->count_ = 0;
+    this->max_us_ = 0;
+  }
+
+  uint32_t get_count() const { return this->count_; }
+  uint32_t get_max_us() const { return this->max_us_; }
+
+  /// Upper bound in microseconds of the bucket containing the given quantile (0.0 - 1.0).
+  uint32_t get_percentile_us(float quantile) const {
+    if (this->count_ == 0)
+      return 0;
+    uint32_t target = static_cast<uint32_t>(quantile * this->count_);
+    if (target >= this->count_)
+      target = this->count_ - 1;
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < BUCKET_COUNT - 1; i++) {
+      seen += this->buckets_[i];
+      if (seen > target)
+        return std::min(1u << (i + 4), this->max_us_);
+    }
+    return this->max_us_;
+  }
+
+ protected:
+  uint32_t buckets_[BUCKET_COUNT]{};
+  uint32_t count_{0};
+  uint32_t max_us_{0};
+};
+
 class ComponentRuntimeStats {
  public:
   ComponentRuntimeStats()
@@ -47,8 +105,30 @@ class ComponentRuntimeStats {
     this->period_count_ = 0;
     this->period_time_ms_ = 0;
     this->period_max_time_ms_ = 0;
+    this->loop_latency_.reset();
+    this->scheduler_latency_.reset();
+  }
+
+  void record_latency(ComponentTimingSource source, uint32_t duration_us) {
+    switch (source) {
+      case ComponentTimingSource::LOOP:
+        this->loop_latency_.record(duration_us);
+        break;
+      case ComponentTimingSource::SCHEDULER:
+        this->scheduler_latency_.record(duration_us);
+        break;
+      case ComponentTimingSource::SETUP:
+        this->setup_time_us_ += duration_us;
+        break;
+    }
   }
 
+  // Latency distributions for the current period, in microseconds
+  const LatencyHistogram &get_loop_latency() const { return this->loop_latency_; }
+  const LatencyHistogram &get_scheduler_latency() const { return this->scheduler_latency_; }
+  /// Time spent in setup() since boot, in microseconds
+  uint32_t get_setup_time_us() const { return this->setup_time_us_; }
+
   // Period stats (reset each logging interval)
   uint32_t get_period_count() const { return this->period_count_; }
   uint32_t get_period_time_ms() const { return this->period_time_ms_; }
@@ -75,6 +155,11 @@ class ComponentRuntimeStats {
   uint32_t total_count_;
   uint32_t total_time_ms_;
   uint32_t total_max_time_ms_;
+
+  // Microsecond latency distributions (reset each logging interval)
+  LatencyHistogram loop_latency_;
+  LatencyHistogram scheduler_latency_;
+  uint32_t setup_time_us_{0};
 };
 
 // For sorting components by run time
@@ -95,13 +180,27 @@ class RuntimeStatsCollector {
   void set_log_interval(uint32_t log_interval) { this->log_interval_ = log_interval; }
   uint32_t get_log_interval() const { return this->log_interval_; }
 
-  void record_component_time(Component *component, uint32_t duration_ms, uint32_t current_time);
+  void record_component_time(Component *component, ComponentTimingSource source, uint32_t duration_ms,
+                             uint32_t duration_us, uint32_t current_time);
+
+#ifdef USE_TEXT_SENSOR
+  /// Publish the component with the highest p99 loop() latency each logging interval.
+  void set_loop_latency_text_sensor(text_sensor::TextSensor *sensor) { this->loop_latency_text_sensor_ = sensor; }
+  /// Publish the component with the highest p99 scheduler callback latency each logging interval.
+  void set_scheduler_latency_text_sensor(text_sensor::TextSensor *sensor) {
+    this->scheduler_latency_text_sensor_ = sensor;
+  }
+#endif
 
   // Process any pending stats printing (should be called after component loop)
   void process_pending_stats(uint32_t current_time);
 
  protected:
   void log_stats_();
+  void log_latency_();
+#ifdef USE_TEXT_SENSOR
+  void publish_slowest_(text_sensor::TextSensor *sensor, ComponentTimingSource source);
+#endif
 
   void reset_stats_() {
     for (auto &it : this->component_stats_) {
@@ -120,6 +219,11 @@ class RuntimeStatsCollector {
   std::map<Component *, const char *> component_names_cache_;
   uint32_t log_interval_;
   uint32_t next_log_time_;
+#ifdef USE_TEXT_SENSOR
+  text_sensor::TextSensor *loop_latency_text_sensor_{nullptr};
+  text_sensor::TextSensor *scheduler_latency_text_sensor_{nullptr};
+#endif
+  bool setup_times_logged_{false};
 };
 
 }  // namespace runtime_stats
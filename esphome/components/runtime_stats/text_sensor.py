@@ -0,0 +1,36 @@
+import esphome.codegen as cg
+from esphome.components import text_sensor
+import esphome.config_validation as cv
+from esphome.const import ENTITY_CATEGORY_DIAGNOSTIC, ICON_TIMER
+
+from . import CONF_RUNTIME_STATS_ID, RuntimeStatsCollector
+
+DEPENDENCIES = ["runtime_stats"]
+
+CONF_LOOP_LATENCY = "loop_latency"
+CONF_SCHEDULER_LATENCY = "scheduler_latency"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_RUNTIME_STATS_ID): cv.use_id(RuntimeStatsCollector),
+        cv.Optional(CONF_LOOP_LATENCY): text_sensor.text_sensor_schema(
+            icon=ICON_TIMER,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_SCHEDULER_LATENCY): text_sensor.text_sensor_schema(
+            icon=ICON_TIMER,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+)
+
+
+async def to_code(config):
+    runtime_stats = await cg.get_variable(config[CONF_RUNTIME_STATS_ID])
+
+    if loop_config := config.get(CONF_LOOP_LATENCY):
+        sens = await text_sensor.new_text_sensor(loop_config)
+        cg.add(runtime_stats.set_loop_latency_text_sensor(sens))
+    if scheduler_config := config.get(CONF_SCHEDULER_LATENCY):
+        sens = await text_sensor.new_text_sensor(scheduler_config)
+        cg.add(runtime_stats.set_scheduler_latency_text_sensor(sens))
@@ -0,0 +1,149 @@
+#include "trace_buffer.h"
+
+#ifdef USE_RUNTIME_STATS_TRACE
+
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+namespace esphome {
+
+namespace runtime_stats {
+
+static const char *const TRACE_TAG = "runtime_stats.trace";
+
+// Big enough for a component source name and the numbers
+static const size_t TRACE_EVENT_MAX_LEN = 160;
+#ifdef USE_RUNTIME_STATS_TRACE_WEB
+// How long a request waits for the main loop to pause the buffer
+static const uint32_t TRACE_EXPORT_TIMEOUT_MS = 2000;
+#ifdef USE_ESP_IDF
+// About one TCP segment per chunk
+static const size_t TRACE_CHUNK_SIZE = 1024;
+#endif
+#endif
+
+const char *trace_category_to_str(TraceCategory category) {
+  switch (category) {
+    case TraceCategory::SETUP:
+      return "setup";
+    case TraceCategory::LOOP:
+      return "loop";
+    case TraceCategory::SCHEDULER:
+      return "scheduler";
+    case TraceCategory::API:
+      return "api";
+    case TraceCategory::LOGGER:
+      return "logger";
+    case TraceCategory::DISPLAY:
+      return "display";
+    default:
+      return "unknown";
+  }
+}
+
+TraceBuffer::TraceBuffer(size_t capacity)
+    : events_(new TraceEvent[capacity]),  // NOLINT(cppcoreguidelines-owning-memory)
+      capacity_(capacity),
+      cycles_per_us_(arch_get_cpu_freq_hz() / 1e6) {
+  global_trace_buffer = this;
+}
+
+void TraceBuffer::record(const char *name, TraceCategory category, uint32_t start_cycles) {
+  if (this->paused_.load(std::memory_order_acquire))
+    return;
+  uint32_t cycles = arch_get_cpu_cycle_count();
+  if (cycles < this->last_cycles_)
+    this->wraps_ += 1ULL << 32;
+  this->last_cycles_ = cycles;
+  uint64_t end = this->wraps_ | cycles;
+  // Unsigned arithmetic gives the right duration even if the counter wrapped during the event
+  uint32_t duration = cycles - start_cycles;
+
+  TraceEvent &event = this->events_[this->head_];
+  event.start = end - duration;
+  event.duration = duration;
+  event.name = name;
+  event.category = category;
+  this->head_ = (this->head_ + 1) % this->capacity_;
+  if (this->count_ < this->capacity_)
+    this->count_++;
+}
+
+int TraceBuffer::format_event(size_t index, char *buffer, size_t buffer_size) const {
+  const TraceEvent &event = this->events_[(this->head_ + this->capacity_ - this->count_ + index) % this->capacity_];
+  return snprintf(buffer, buffer_size,
+                  R"({"name":"%s","cat":"%s","ph":"X","ts":%.3f,"dur":%.3f,"pid":1,"tid":1})",
+                  event.name == nullptr ? "<unknown>" : event.name, trace_category_to_str(event.category),
+                  event.start / this->cycles_per_us_, event.duration / this->cycles_per_us_);
+}
+
+void TraceBuffer::log_json() {
+  this->set_paused(true);
+  char buffer[TRACE_EVENT_MAX_LEN];
+  ESP_LOGI(TRACE_TAG, "[");
+  for (size_t i = 0; i < this->count_; i++) {
+    this->format_event(i, buffer, sizeof(buffer));
+    ESP_LOGI(TRACE_TAG, "%s%s", buffer, i + 1 < this->count_ ? "," : "");
+  }
+  ESP_LOGI(TRACE_TAG, "]");
+  this->set_paused(false);
+}
+
+#ifdef USE_RUNTIME_STATS_TRACE_WEB
+void TraceWebHandler::loop() {
+  if (this->export_requested_.exchange(false, std::memory_order_acquire)) {
+    // Paused here, so record() can't be writing an event while the web server task reads them
+    global_trace_buffer->set_paused(true);
+    this->export_ready_.store(true, std::memory_order_release);
+  }
+  this->disable_loop();
+}
+
+void TraceWebHandler::handleRequest(AsyncWebServerRequest *req) {
+#ifdef USE_ESP8266
+  // Requests are handled between loop iterations, nothing records meanwhile
+  global_trace_buffer->set_paused(true);
+#else
+  this->export_requested_.store(true, std::memory_order_release);
+  this->enable_loop_soon_any_context();
+  const uint32_t start = millis();
+  while (!this->export_ready_.load(std::memory_order_acquire)) {
+    // Once the main loop took the request it pauses the buffer right away, wait for that instead
+    if (millis() - start > TRACE_EXPORT_TIMEOUT_MS && this->export_requested_.exchange(false)) {
+      req->send(503, "text/plain", "Main loop busy");
+      return;
+    }
+    delay(1);
+  }
+  this->export_ready_.store(false, std::memory_order_relaxed);
+#endif
+  AsyncResponseStream *stream = req->beginResponseStream("application/json");
+#ifdef USE_ESP_IDF
+  // Send the events while they are formatted instead of holding the whole export on the heap
+  stream->set_chunk_size(TRACE_CHUNK_SIZE);
+#endif
+  char buffer[TRACE_EVENT_MAX_LEN];
+  stream->print("[");
+  size_t count = global_trace_buffer->size();
+  for (size_t i = 0; i < count; i++) {
+    if (i > 0)
+      stream->print(",\n");
+    global_trace_buffer->format_event(i, buffer, sizeof(buffer));
+    stream->print(buffer);
+  }
+  stream->print("]\n");
+  req->send(stream);
+  global_trace_buffer->set_paused(false);
+}
+#endif
+
+}  // namespace runtime_stats
+
+runtime_stats::TraceBuffer *global_trace_buffer =
+    nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
+
+#endif  // USE_RUNTIME_STATS_TRACE
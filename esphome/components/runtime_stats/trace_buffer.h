@@ -0,0 +1,145 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_RUNTIME_STATS_TRACE
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "esphome/core/automation.h"
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+
+#ifdef USE_RUNTIME_STATS_TRACE_WEB
+#include "esphome/components/web_server_base/web_server_base.h"
+#endif
+
+namespace esphome {
+namespace runtime_stats {
+
+enum class TraceCategory : uint8_t {
+  SETUP,
+  LOOP,
+  SCHEDULER,
+  API,
+  LOGGER,
+  DISPLAY,
+};
+
+const char *trace_category_to_str(TraceCategory category);
+
+/// One complete event: something that ran from start for duration CPU cycles
+struct TraceEvent {
+  uint64_t start;
+  uint32_t duration;
+  const char *name;
+  TraceCategory category;
+};
+
+/** Ring buffer of the most recent timed events of the main loop, exported in the Chrome trace format.
+ *
+ * Times come from the CPU cycle counter. It wraps after a few seconds, so the buffer extends it to 64 bits on every
+ * event; the main loop records often enough that no wrap is missed. Events are only recorded from the main loop task,
+ * which keeps recording lock free. Load the export in chrome://tracing or https://ui.perfetto.dev.
+ */
+class TraceBuffer {
+ public:
+  explicit TraceBuffer(size_t capacity);
+
+  /// Records an event that started at the given cycle count and ends now. name must stay valid.
+  void record(const char *name, TraceCategory category, uint32_t start_cycles);
+
+  size_t size() const { return this->count_; }
+  /// Writes the index-th oldest event as a Chrome trace event object, returns the length like snprintf.
+  int format_event(size_t index, char *buffer, size_t buffer_size) const;
+
+  /// Stops recording while the buffer is exported, so the export doesn't trace itself. Pausing from another task
+  /// races with record(), only resuming may happen there.
+  void set_paused(bool paused) { this->paused_.store(paused, std::memory_order_release); }
+
+  /// Logs the buffer as a JSON array, one event per line, so it can be collected over the API log.
+  void log_json();
+
+ protected:
+  std::unique_ptr<TraceEvent[]> events_;
+  size_t capacity_;
+  size_t head_{0};
+  size_t count_{0};
+  uint64_t wraps_{0};
+  uint32_t last_cycles_{0};
+  double cycles_per_us_;
+  std::atomic<bool> paused_{false};
+};
+
+/// Records the enclosing scope as a trace event
+class TraceScope {
+ public:
+  TraceScope(const char *name, TraceCategory category)
+      : name_(name), start_(arch_get_cpu_cycle_count()), category_(category) {}
+  ~TraceScope();
+
+ protected:
+  const char *name_;
+  uint32_t start_;
+  TraceCategory category_;
+};
+
+/// Logs the trace buffer
+template<typename... Ts> class DumpTraceAction : public Action<Ts...> {
+ public:
+  explicit DumpTraceAction(TraceBuffer *buffer) : buffer_(buffer) {}
+
+  void play(Ts... x) override { this->buffer_->log_json(); }
+
+ protected:
+  TraceBuffer *buffer_;
+};
+
+#ifdef USE_RUNTIME_STATS_TRACE_WEB
+/** Serves the trace buffer at /trace.json
+ *
+ * Requests are handled on the web server task. The handler asks the main loop to pause the buffer, so no event is
+ * halfway written, and streams the events once it did.
+ */
+class TraceWebHandler : public AsyncWebHandler, public Component {
+ public:
+  explicit TraceWebHandler(web_server_base::WebServerBase *base) : base_(base) {}
+
+  bool canHandle(AsyncWebServerRequest *request) const override {
+    return request->method() == HTTP_GET && request->url() == "/trace.json";
+  }
+  void handleRequest(AsyncWebServerRequest *req) override;
+
+  void setup() override {
+    this->base_->init();
+    this->base_->add_handler(this);
+    this->disable_loop();
+  }
+  /// Pauses the buffer for a waiting request
+  void loop() override;
+  float get_setup_priority() const override { return setup_priority::WIFI - 1.0f; }
+
+ protected:
+  web_server_base::WebServerBase *base_;
+  std::atomic<bool> export_requested_{false};
+  std::atomic<bool> export_ready_{false};
+};
+#endif
+
+}  // namespace runtime_stats
+
+extern runtime_stats::TraceBuffer *global_trace_buffer;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+namespace runtime_stats {
+
+inline TraceScope::~TraceScope() {
+  if (global_trace_buffer != nullptr)
+    global_trace_buffer->record(this->name_, this->category_, this->start_);
+}
+
+}  // namespace runtime_stats
+}  // namespace esphome
+
+#endif  // USE_RUNTIME_STATS_TRACE
@@ -4,7 +4,10 @@
 #include "esphome/core/component.h"
 #include "esphome/core/log.h"
 
-#include <queue>
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <utility>
 namespace esphome {
 namespace script {
 
@@ -37,15 +40,15 @@ template<typename... Ts> class Script : public ScriptLogger, public Trigger<Ts..
     this->execute_tuple_(tuple, typename gens<sizeof...(Ts)>::type());
   }
 
-  // Internal function to give scripts readable names.
-  void set_name(const std::string &name) { name_ = name; }
+  // Internal function to give scripts readable names, the name must stay valid (a string literal).
+  void set_name(const char *name) { name_ = name; }
 
  protected:
   template<int... S> void execute_tuple_(const std::tuple<Ts...> &tuple, seq<S...> /*unused*/) {
     this->execute(std::get<S>(tuple)...);
   }
 
-  std::string name_;
+  const char *name_{""};
 };
 
 /** A script type for which only a single instance at a time is allowed.
@@ -57,7 +60,7 @@ template<typename... Ts> class SingleScript : public Script<Ts...> {
  public:
   void execute(Ts... x) override {
     if (this->is_action_running()) {
-      this->esp_logw_(__LINE__, "Script '%s' is already running! (mode: single)", this->name_.c_str());
+      this->esp_logw_(__LINE__, "Script '%s' is already running! (mode: single)", this->name_);
       return;
     }
 
@@ -74,7 +77,7 @@ template<typename... Ts> class RestartScript : public Script<Ts...> {
  public:
   void execute(Ts... x) override {
     if (this->is_action_running()) {
-      this->esp_logd_(__LINE__, "Script '%s' restarting (mode: restart)", this->name_.c_str());
+      this->esp_logd_(__LINE__, "Script '%s' restarting (mode: restart)", this->name_);
       this->stop_action();
     }
 
@@ -84,7 +87,8 @@ template<typename... Ts> class RestartScript : public Script<Ts...> {
 
 /** A script type that queues new instances that are created.
  *
- * Only one instance of the script can be active at a time.
+ * Only one instance of the script can be active at a time. The arguments of the queued instances are kept in a ring
+ * that is allocated once for max_runs, without max_runs it grows when full.
  */
 template<typename... Ts> class QueueingScript : public Script<Ts...>, public Component {
  public:
@@ -93,13 +97,17 @@ template<typename... Ts> class QueueingScript : public Script<Ts...>, public Com
       // num_runs_ is the number of *queued* instances, so total number of instances is
       // num_runs_ + 1
       if (this->max_runs_ != 0 && this->num_runs_ + 1 >= this->max_runs_) {
-        this->esp_logw_(__LINE__, "Script '%s' maximum number of queued runs exceeded!", this->name_.c_str());
+        this->esp_logw_(__LINE__, "Script '%s' maximum number of queued runs exceeded!", this->name_);
         return;
       }
 
-      this->esp_logd_(__LINE__, "Script '%s' queueing new instance (mode: queued)", this->name_.c_str());
+      this->esp_logd_(__LINE__, "Script '%s' queueing new instance (mode: queued)", this->name_);
+      if (this->num_runs_ == this->queue_capacity_) {
+        // Only happens without max_runs, the queue is sized for max_runs otherwise
+        this->resize_queue_(std::max(this->queue_capacity_ * 2, 4));
+      }
+      this->var_queue_[(this->queue_front_ + this->num_runs_) % this->queue_capacity_] = std::make_tuple(x...);
       this->num_runs_++;
-      this->var_queue_.push(std::make_tuple(x...));
       return;
     }
 
@@ -116,22 +124,41 @@ template<typename... Ts> class QueueingScript : public Script<Ts...>, public Com
   void loop() override {
     if (this->num_runs_ != 0 && !this->is_action_running()) {
       this->num_runs_--;
-      auto &vars = this->var_queue_.front();
-      this->var_queue_.pop();
+      // Move the arguments out of the slot, the script may queue a new instance into it
+      std::tuple<Ts...> vars = std::move(this->var_queue_[this->queue_front_]);
+      this->queue_front_ = (this->queue_front_ + 1) % this->queue_capacity_;
       this->trigger_tuple_(vars, typename gens<sizeof...(Ts)>::type());
     }
   }
 
-  void set_max_runs(int max_runs) { max_runs_ = max_runs; }
+  void set_max_runs(int max_runs) {
+    max_runs_ = max_runs;
+    // One instance runs, the others wait in the queue
+    if (max_runs > 1)
+      this->resize_queue_(max_runs - 1);
+  }
 
  protected:
+  /// Moves the queued arguments into a ring of the given capacity, which must fit them.
+  void resize_queue_(int capacity) {
+    std::unique_ptr<std::tuple<Ts...>[]> queue(new std::tuple<Ts...>[capacity]);  // NOLINT
+    for (int i = 0; i < this->num_runs_; i++)
+      queue[i] = std::move(this->var_queue_[(this->queue_front_ + i) % this->queue_capacity_]);
+    this->var_queue_ = std::move(queue);
+    this->queue_capacity_ = capacity;
+    this->queue_front_ = 0;
+  }
+
   template<int... S> void trigger_tuple_(const std::tuple<Ts...> &tuple, seq<S...> /*unused*/) {
     this->trigger(std::get<S>(tuple)...);
   }
 
   int num_runs_ = 0;
   int max_runs_ = 0;
-  std::queue<std::tuple<Ts...>> var_queue_;
+  /// Ring of the arguments of the queued instances, allocated once from max_runs.
+  std::unique_ptr<std::tuple<Ts...>[]> var_queue_;
+  int queue_capacity_ = 0;
+  int queue_front_ = 0;
 };
 
 /** A script type that executes new instances in parallel.
@@ -143,7 +170,7 @@ template<typename... Ts> class ParallelScript : public Script<Ts...> {
  public:
   void execute(Ts... x) override {
     if (this->max_runs_ != 0 && this->automation_parent_->num_running() >= this->max_runs_) {
-      this->esp_logw_(__LINE__, "Script '%s' maximum number of parallel runs exceeded!", this->name_.c_str());
+      this->esp_logw_(__LINE__, "Script '%s' maximum number of parallel runs exceeded!", this->name_);
       return;
     }
     this->trigger(x...);
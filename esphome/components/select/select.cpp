@@ -8,18 +8,28 @@ static const char *const TAG = "select";
 
 void Select::publish_state(const std::string &state) {
   auto index = this->index_of(state);
-  const auto *name = this->get_name().c_str();
   if (index.has_value()) {
-    this->set_has_state(true);
-    this->state = state;
-    ESP_LOGD(TAG, "'%s': Sending state %s (index %zu)", name, state.c_str(), index.value());
-    this->state_callback_.call(state, index.value());
+    this->publish_state(index.value());
   } else {
-    ESP_LOGE(TAG, "'%s': invalid state for publish_state(): %s", name, state.c_str());
+    ESP_LOGE(TAG, "'%s': invalid state for publish_state(): %s", this->get_name().c_str(), state.c_str());
   }
 }
 
-void Select::add_on_state_callback(std::function<void(std::string, size_t)> &&callback) {
+void Select::publish_state(size_t index) {
+  const auto &options = this->traits.get_options();
+  if (index >= options.size()) {
+    ESP_LOGE(TAG, "'%s': invalid index for publish_state(): %zu", this->get_name().c_str(), index);
+    return;
+  }
+  this->set_has_state(true);
+  this->active_index_ = index;
+  // Assigning reuses the capacity of the string, it only allocates for an option longer than all before
+  this->state = options[index];
+  ESP_LOGD(TAG, "'%s': Sending state %s (index %zu)", this->get_name().c_str(), this->state.c_str(), index);
+  this->state_callback_.call(this->state, index);
+}
+
+void Select::add_on_state_callback(std::function<void(const std::string &, size_t)> &&callback) {
   this->state_callback_.add(std::move(callback));
 }
 
@@ -27,13 +37,10 @@ bool Select::has_option(const std::string &option) const { return this->index_of
 
 bool Select::has_index(size_t index) const { return index < this->size(); }
 
-size_t Select::size() const {
-  auto options = traits.get_options();
-  return options.size();
-}
+size_t Select::size() const { return this->traits.get_options().size(); }
 
 optional<size_t> Select::index_of(const std::string &option) const {
-  auto options = traits.get_options();
+  const auto &options = this->traits.get_options();
   auto it = std::find(options.begin(), options.end(), option);
   if (it == options.end()) {
     return {};
@@ -43,7 +50,7 @@ optional<size_t> Select::index_of(const std::string &option) const {
 
 optional<size_t> Select::active_index() const {
   if (this->has_state()) {
-    return this->index_of(this->state);
+    return this->active_index_;
   } else {
     return {};
   }
@@ -51,8 +58,7 @@ optional<size_t> Select::active_index() const {
 
 optional<std::string> Select::at(size_t index) const {
   if (this->has_index(index)) {
-    auto options = traits.get_options();
-    return options.at(index);
+    return this->traits.get_options()[index];
   } else {
     return {};
   }
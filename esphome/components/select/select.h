@@ -34,6 +34,8 @@ class Select : public EntityBase {
   SelectTraits traits;
 
   void publish_state(const std::string &state);
+  /// Publish the option at the given index offset, without looking the option up by its value.
+  void publish_state(size_t index);
 
   /// Instantiate a SelectCall object to modify this select component's state.
   SelectCall make_call() { return SelectCall(this); }
@@ -56,7 +58,7 @@ class Select : public EntityBase {
   /// Return the (optional) option value at the provided index offset.
   optional<std::string> at(size_t index) const;
 
-  void add_on_state_callback(std::function<void(std::string, size_t)> &&callback);
+  void add_on_state_callback(std::function<void(const std::string &, size_t)> &&callback);
 
  protected:
   friend class SelectCall;
@@ -69,7 +71,9 @@ class Select : public EntityBase {
    */
   virtual void control(const std::string &value) = 0;
 
-  CallbackManager<void(std::string, size_t)> state_callback_;
+  CallbackManager<void(const std::string &, size_t)> state_callback_;
+  /// Index offset of the active option, the canonical state that `state` mirrors.
+  size_t active_index_{0};
 };
 
 }  // namespace select
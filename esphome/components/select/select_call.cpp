@@ -45,7 +45,7 @@ void SelectCall::perform() {
   auto *parent = this->parent_;
   const auto *name = parent->get_name().c_str();
   const auto &traits = parent->traits;
-  auto options = traits.get_options();
+  const auto &options = traits.get_options();
 
   if (this->operation_ == SELECT_OP_NONE) {
     ESP_LOGW(TAG, "'%s' - SelectCall performed without selecting an operation", name);
@@ -86,7 +86,7 @@ void SelectCall::perform() {
     if (!parent->has_state()) {
       target_value = this->operation_ == SELECT_OP_NEXT ? options.front() : options.back();
     } else {
-      auto index = parent->index_of(parent->state);
+      auto index = parent->active_index();
       if (index.has_value()) {
         auto size = options.size();
         if (cycle) {
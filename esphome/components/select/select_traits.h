@@ -9,7 +9,7 @@ namespace select {
 class SelectTraits {
  public:
   void set_options(std::vector<std::string> options);
-  std::vector<std::string> get_options() const;
+  const std::vector<std::string> &get_options() const;
 
  protected:
   std::vector<std::string> options_;
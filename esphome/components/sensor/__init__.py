@@ -37,6 +37,7 @@ from esphome.const import (
     CONF_TO,
     CONF_TRIGGER_ID,
     CONF_TYPE,
+    CONF_TYPE_ID,
     CONF_UNIT_OF_MEASUREMENT,
     CONF_VALUE,
     CONF_WEB_SERVER,
@@ -104,6 +105,7 @@ from esphome.const import (
 from esphome.core import CORE, coroutine_with_priority
 from esphome.core.entity_helpers import entity_duplicate_validator, setup_entity
 from esphome.cpp_generator import MockObjClass
+from esphome.cpp_helpers import extract_registry_entry_config
 from esphome.util import Registry
 
 CODEOWNERS = ["@esphome/core"]
@@ -193,6 +195,18 @@ def validate_send_first_at(value):
 
 
 FILTER_REGISTRY = Registry()
+# Filters FusedFilter can run, mapped to a coroutine building their constructor args
+FUSABLE_FILTER_ARGS = {}
+
+
+def fusable_filter(name):
+    def decorator(fun):
+        FUSABLE_FILTER_ARGS[name] = fun
+        return fun
+
+    return decorator
+
+
 validate_filters = cv.validate_registry("filter", FILTER_REGISTRY)
 
 
@@ -269,6 +283,7 @@ SensorInRangeCondition = sensor_ns.class_("SensorInRangeCondition", Filter)
 ClampFilter = sensor_ns.class_("ClampFilter", Filter)
 RoundFilter = sensor_ns.class_("RoundFilter", Filter)
 RoundMultipleFilter = sensor_ns.class_("RoundMultipleFilter", Filter)
+FusedFilter = sensor_ns.class_("FusedFilter", Filter)
 
 validate_unit_of_measurement = cv.string_strict
 validate_accuracy_decimals = cv.int_
@@ -358,16 +373,20 @@ SENSOR_SCHEMA = sensor_schema()
 SENSOR_SCHEMA.add_extra(cv.deprecated_schema_constant("sensor"))
 
 
+@fusable_filter("offset")
+@fusable_filter("multiply")
+async def templatable_float_filter_args(config):
+    return [await cg.templatable(config, [], float)]
+
+
 @FILTER_REGISTRY.register("offset", OffsetFilter, cv.templatable(cv.float_))
 async def offset_filter_to_code(config, filter_id):
-    template_ = await cg.templatable(config, [], float)
-    return cg.new_Pvariable(filter_id, template_)
+    return cg.new_Pvariable(filter_id, *await templatable_float_filter_args(config))
 
 
 @FILTER_REGISTRY.register("multiply", MultiplyFilter, cv.templatable(cv.float_))
 async def multiply_filter_to_code(config, filter_id):
-    template_ = await cg.templatable(config, [], float)
-    return cg.new_Pvariable(filter_id, template_)
+    return cg.new_Pvariable(filter_id, *await templatable_float_filter_args(config))
 
 
 @FILTER_REGISTRY.register(
@@ -570,14 +589,15 @@ def validate_delta(config):
     raise cv.Invalid("Delta filter requires a positive number or percentage value.")
 
 
+@fusable_filter("delta")
+async def delta_filter_args(config):
+    percentage = config[CONF_TYPE] == "percentage"
+    return [config[CONF_VALUE], percentage]
+
+
 @FILTER_REGISTRY.register("delta", DeltaFilter, cv.Any(DELTA_SCHEMA, validate_delta))
 async def delta_filter_to_code(config, filter_id):
-    percentage = config[CONF_TYPE] == "percentage"
-    return cg.new_Pvariable(
-        filter_id,
-        config[CONF_VALUE],
-        percentage,
-    )
+    return cg.new_Pvariable(filter_id, *await delta_filter_args(config))
 
 
 @FILTER_REGISTRY.register("or", OrFilter, validate_filters)
@@ -586,11 +606,16 @@ async def or_filter_to_code(config, filter_id):
     return cg.new_Pvariable(filter_id, filters)
 
 
+@fusable_filter("throttle")
+async def throttle_filter_args(config):
+    return [config]
+
+
 @FILTER_REGISTRY.register(
     "throttle", ThrottleFilter, cv.positive_time_period_milliseconds
 )
 async def throttle_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(filter_id, config)
+    return cg.new_Pvariable(filter_id, *await throttle_filter_args(config))
 
 
 @FILTER_REGISTRY.register(
@@ -670,6 +695,11 @@ def validate_calibrate_linear(config):
     ),
 )
 async def calibrate_linear_filter_to_code(config, filter_id):
+    return cg.new_Pvariable(filter_id, *await calibrate_linear_filter_args(config))
+
+
+@fusable_filter("calibrate_linear")
+async def calibrate_linear_filter_args(config):
     x = [conf[CONF_FROM] for conf in config[CONF_DATAPOINTS]]
     y = [conf[CONF_TO] for conf in config[CONF_DATAPOINTS]]
 
@@ -679,7 +709,7 @@ async def calibrate_linear_filter_to_code(config, filter_id):
         linear_functions = [[k, b, float("NaN")]]
     elif config[CONF_METHOD] == "exact":
         linear_functions = map_linear(x, y)
-    return cg.new_Pvariable(filter_id, linear_functions)
+    return [linear_functions]
 
 
 CONF_DEGREE = "degree"
@@ -742,14 +772,18 @@ CLAMP_SCHEMA = cv.All(
 )
 
 
-@FILTER_REGISTRY.register("clamp", ClampFilter, CLAMP_SCHEMA)
-async def clamp_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(
-        filter_id,
+@fusable_filter("clamp")
+async def clamp_filter_args(config):
+    return [
         config[CONF_MIN_VALUE],
         config[CONF_MAX_VALUE],
         config[CONF_IGNORE_OUT_OF_RANGE],
-    )
+    ]
+
+
+@FILTER_REGISTRY.register("clamp", ClampFilter, CLAMP_SCHEMA)
+async def clamp_filter_to_code(config, filter_id):
+    return cg.new_Pvariable(filter_id, *await clamp_filter_args(config))
 
 
 @FILTER_REGISTRY.register(
@@ -763,10 +797,12 @@ async def clamp_filter_to_code(config, filter_id):
     ),
 )
 async def round_filter_to_code(config, filter_id):
-    return cg.new_Pvariable(
-        filter_id,
-        config[CONF_ACCURACY_DECIMALS],
-    )
+    return cg.new_Pvariable(filter_id, *await round_filter_args(config))
+
+
+@fusable_filter("round")
+async def round_filter_args(config):
+    return [config[CONF_ACCURACY_DECIMALS]]
 
 
 @FILTER_REGISTRY.register(
@@ -786,10 +822,33 @@ async def round_multiple_filter_to_code(config, filter_id):
     )
 
 
+# Components that subscribe to the state of every sensor
+_FRONTEND_SUBSCRIBERS = ("api", "mqtt", "web_server")
+
+
 async def build_filters(config):
     return await cg.build_registry_list(FILTER_REGISTRY, config)
 
 
+async def build_fused_filter(config):
+    """Build a filter chain as a single FusedFilter.
+
+    Returns None unless the chain has more than one filter and all of them are fusable.
+    """
+    entries = [extract_registry_entry_config(FILTER_REGISTRY, conf) for conf in config]
+    if len(entries) < 2 or any(e.name not in FUSABLE_FILTER_ARGS for e, _ in entries):
+        return None
+    stages = [
+        entry.type_id(*await FUSABLE_FILTER_ARGS[entry.name](conf))
+        for entry, conf in entries
+    ]
+    # The stages are created in place, so only the first filter's ID is declared
+    fused_id = config[0][CONF_TYPE_ID].copy()
+    fused_id.type = FusedFilter
+    template_args = cg.TemplateArguments(*(entry.type_id for entry, _ in entries))
+    return cg.new_Pvariable(fused_id, template_args, *stages)
+
+
 async def setup_sensor_core_(var, config):
     await setup_entity(var, config, "sensor")
 
@@ -803,8 +862,11 @@ async def setup_sensor_core_(var, config):
         cg.add(var.set_accuracy_decimals(accuracy_decimals))
     cg.add(var.set_force_update(config[CONF_FORCE_UPDATE]))
     if config.get(CONF_FILTERS):  # must exist and not be empty
-        filters = await build_filters(config[CONF_FILTERS])
-        cg.add(var.set_filters(filters))
+        if (fused := await build_fused_filter(config[CONF_FILTERS])) is not None:
+            cg.add(var.set_filters([fused]))
+        else:
+            filters = await build_filters(config[CONF_FILTERS])
+            cg.add(var.set_filters(filters))
 
     for conf in config.get(CONF_ON_VALUE, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
@@ -1114,4 +1176,10 @@ def _lstsq(a, b):
 @coroutine_with_priority(100.0)
 async def to_code(config):
     cg.add_define("USE_SENSOR")
+    # Each front-end registers exactly one state callback per sensor, so their
+    # callbacks can be stored inline instead of in a growing vector
+    if subscribers := sum(
+        1 for domain in _FRONTEND_SUBSCRIBERS if domain in CORE.loaded_integrations
+    ):
+        cg.add_define("ESPHOME_SENSOR_INLINE_CALLBACKS", subscribers)
     cg.add_global(sensor_ns.using)
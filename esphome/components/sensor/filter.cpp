@@ -1,4 +1,5 @@
 #include "filter.h"
+#include <algorithm>
 #include <cmath>
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -16,6 +17,21 @@ void Filter::input(float value) {
   if (out.has_value())
     this->output(*out);
 }
+void Filter::input_values(float *values, size_t count) {
+  ESP_LOGVV(TAG, "Filter(%p)::input_values(%zu values)", this, count);
+  count = this->new_values(values, count);
+  if (count)
+    this->output_values(values, count);
+}
+size_t Filter::new_values(float *values, size_t count) {
+  size_t out = 0;
+  for (size_t i = 0; i < count; i++) {
+    optional<float> value = this->new_value(values[i]);
+    if (value.has_value())
+      values[out++] = *value;
+  }
+  return out;
+}
 void Filter::output(float value) {
   if (this->next_ == nullptr) {
     ESP_LOGVV(TAG, "Filter(%p)::output(%f) -> SENSOR", this, value);
@@ -25,47 +41,121 @@ void Filter::output(float value) {
     this->next_->input(value);
   }
 }
+void Filter::output_values(float *values, size_t count) {
+  if (this->next_ == nullptr) {
+    for (size_t i = 0; i < count; i++)
+      this->parent_->internal_send_state_to_frontend(values[i]);
+  } else {
+    this->next_->input_values(values, count);
+  }
+}
 void Filter::initialize(Sensor *parent, Filter *next) {
   ESP_LOGVV(TAG, "Filter(%p)::initialize(parent=%p next=%p)", this, parent, next);
   this->parent_ = parent;
   this->next_ = next;
 }
 
+// ValueWindow
+void ValueWindow::set_capacity(size_t capacity) {
+  // Keep the newest values that still fit, oldest first
+  size_t keep = std::min(this->count_, capacity);
+  std::vector<float> ring;
+  ring.reserve(capacity);
+  for (size_t i = this->count_ - keep; i < this->count_; i++)
+    ring.push_back((*this)[i]);
+  ring.resize(capacity);
+  this->ring_ = std::move(ring);
+  this->head_ = 0;
+  this->count_ = keep;
+}
+bool ValueWindow::push(float value, float &evicted) {
+  size_t capacity = this->ring_.size();
+  if (this->count_ == capacity) {
+    evicted = this->ring_[this->head_];
+    this->ring_[this->head_] = value;
+    this->head_ = (this->head_ + 1) % capacity;
+    return true;
+  }
+  this->ring_[(this->head_ + this->count_) % capacity] = value;
+  this->count_++;
+  return false;
+}
+
+// SortedWindow
+void SortedWindow::push(float value, size_t window_size) {
+  size_t capacity = std::max<size_t>(window_size, 1);
+  if (capacity != this->values_.capacity()) {
+    this->values_.set_capacity(capacity);
+    this->sorted_.clear();
+    this->sorted_.reserve(capacity);
+    for (size_t i = 0; i < this->values_.size(); i++) {
+      if (!std::isnan(this->values_[i]))
+        this->sorted_.push_back(this->values_[i]);
+    }
+    std::sort(this->sorted_.begin(), this->sorted_.end());
+  }
+
+  float oldest;
+  if (this->values_.push(value, oldest) && !std::isnan(oldest))
+    this->sorted_.erase(std::lower_bound(this->sorted_.begin(), this->sorted_.end(), oldest));
+  if (!std::isnan(value))
+    this->sorted_.insert(std::upper_bound(this->sorted_.begin(), this->sorted_.end(), value), value);
+}
+
+// MonotonicWindow
+void MonotonicWindow::push(float value, size_t window_size) {
+  size_t window = std::max<size_t>(window_size, 1);
+  // At most one entry per value in the window
+  if (this->ring_.size() < window) {
+    std::vector<Entry> ring;
+    ring.reserve(window);
+    for (size_t i = 0; i < this->count_; i++)
+      ring.push_back(this->ring_[(this->head_ + i) % this->ring_.size()]);
+    ring.resize(window);
+    this->ring_ = std::move(ring);
+    this->head_ = 0;
+  }
+  size_t capacity = this->ring_.size();
+
+  this->pushed_++;
+  while (this->count_ && this->pushed_ - this->ring_[this->head_].index >= window) {
+    this->head_ = (this->head_ + 1) % capacity;
+    this->count_--;
+  }
+  if (std::isnan(value))
+    return;
+
+  // Older values that are not better than the new one can never be the result again
+  while (this->count_) {
+    float back = this->ring_[(this->head_ + this->count_ - 1) % capacity].value;
+    if (this->max_ ? back > value : back < value)
+      break;
+    this->count_--;
+  }
+  this->ring_[(this->head_ + this->count_) % capacity] = Entry{this->pushed_, value};
+  this->count_++;
+}
+
 // MedianFilter
 MedianFilter::MedianFilter(size_t window_size, size_t send_every, size_t send_first_at)
     : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
 void MedianFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
 void MedianFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
 optional<float> MedianFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value, this->window_size_);
   ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float median = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> median_queue;
-      median_queue.reserve(this->queue_.size());
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          median_queue.push_back(v);
-        }
-      }
-
-      sort(median_queue.begin(), median_queue.end());
-
-      size_t queue_size = median_queue.size();
-      if (queue_size) {
-        if (queue_size % 2) {
-          median = median_queue[queue_size / 2];
-        } else {
-          median = (median_queue[queue_size / 2] + median_queue[(queue_size / 2) - 1]) / 2.0f;
-        }
+    const std::vector<float> &values = this->window_.sorted();
+    size_t queue_size = values.size();
+    if (queue_size) {
+      if (queue_size % 2) {
+        median = values[queue_size / 2];
+      } else {
+        median = (values[queue_size / 2] + values[(queue_size / 2) - 1]) / 2.0f;
       }
     }
 
@@ -95,33 +185,19 @@ void QuantileFilter::set_send_every(size_t send_every) { this->send_every_ = sen
 void QuantileFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
 void QuantileFilter::set_quantile(float quantile) { this->quantile_ = quantile; }
 optional<float> QuantileFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value, this->window_size_);
   ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f), quantile:%f", this, value, this->quantile_);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float result = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> quantile_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          quantile_queue.push_back(v);
-        }
-      }
-
-      sort(quantile_queue.begin(), quantile_queue.end());
-
-      size_t queue_size = quantile_queue.size();
-      if (queue_size) {
-        size_t position = ceilf(queue_size * this->quantile_) - 1;
-        ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %zu/%zu", this, position + 1, queue_size);
-        result = quantile_queue[position];
-      }
+    const std::vector<float> &values = this->window_.sorted();
+    size_t queue_size = values.size();
+    if (queue_size) {
+      size_t position = ceilf(queue_size * this->quantile_) - 1;
+      ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %zu/%zu", this, position + 1, queue_size);
+      result = values[position];
     }
 
     ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f) SENDING %f", this, value, result);
@@ -136,21 +212,13 @@ MinFilter::MinFilter(size_t window_size, size_t send_every, size_t send_first_at
 void MinFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
 void MinFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
 optional<float> MinFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value, this->window_size_);
   ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float min = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        min = std::isnan(min) ? v : std::min(min, v);
-      }
-    }
+    float min = this->window_.get();
 
     ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f) SENDING %f", this, value, min);
     return min;
@@ -164,21 +232,13 @@ MaxFilter::MaxFilter(size_t window_size, size_t send_every, size_t send_first_at
 void MaxFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
 void MaxFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
 optional<float> MaxFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
-  }
-  this->queue_.push_back(value);
+  this->window_.push(value, this->window_size_);
   ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float max = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        max = std::isnan(max) ? v : std::max(max, v);
-      }
-    }
+    float max = this->window_.get();
 
     ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f) SENDING %f", this, value, max);
     return max;
@@ -193,27 +253,32 @@ SlidingWindowMovingAverageFilter::SlidingWindowMovingAverageFilter(size_t window
 void SlidingWindowMovingAverageFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
 void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
 optional<float> SlidingWindowMovingAverageFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
-    this->queue_.pop_front();
+  size_t capacity = std::max<size_t>(this->window_size_, 1);
+  if (capacity != this->window_.capacity()) {
+    this->window_.set_capacity(capacity);
+    this->recalculate_sum_();
   }
-  this->queue_.push_back(value);
+
+  float oldest;
+  if (this->window_.push(value, oldest) && !std::isnan(oldest)) {
+    this->add_(-oldest);
+    this->valid_count_--;
+  }
+  if (!std::isnan(value)) {
+    this->add_(value);
+    this->valid_count_++;
+  }
+  // Removing values leaves rounding errors in the running sum, so start over from the window once per cycle
+  if (++this->since_recalculate_ >= capacity)
+    this->recalculate_sum_();
   ESP_LOGVV(TAG, "SlidingWindowMovingAverageFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float sum = 0;
-    size_t valid_count = 0;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        sum += v;
-        valid_count++;
-      }
-    }
-
     float average = NAN;
-    if (valid_count) {
-      average = sum / valid_count;
+    if (this->valid_count_) {
+      average = this->sum_ / this->valid_count_;
     }
 
     ESP_LOGVV(TAG, "SlidingWindowMovingAverageFilter(%p)::new_value(%f) SENDING %f", this, value, average);
@@ -221,6 +286,25 @@ optional<float> SlidingWindowMovingAverageFilter::new_value(float value) {
   }
   return {};
 }
+void SlidingWindowMovingAverageFilter::add_(float value) {
+  float y = value - this->compensation_;
+  float t = this->sum_ + y;
+  this->compensation_ = (t - this->sum_) - y;
+  this->sum_ = t;
+}
+void SlidingWindowMovingAverageFilter::recalculate_sum_() {
+  this->sum_ = 0.0f;
+  this->compensation_ = 0.0f;
+  this->valid_count_ = 0;
+  this->since_recalculate_ = 0;
+  for (size_t i = 0; i < this->window_.size(); i++) {
+    float v = this->window_[i];
+    if (!std::isnan(v)) {
+      this->add_(v);
+      this->valid_count_++;
+    }
+  }
+}
 
 // ExponentialMovingAverageFilter
 ExponentialMovingAverageFilter::ExponentialMovingAverageFilter(float alpha, size_t send_every, size_t send_first_at)
@@ -245,6 +329,25 @@ optional<float> ExponentialMovingAverageFilter::new_value(float value) {
   }
   return {};
 }
+size_t ExponentialMovingAverageFilter::new_values(float *values, size_t count) {
+  size_t out = 0;
+  for (size_t i = 0; i < count; i++) {
+    float value = values[i];
+    if (!std::isnan(value)) {
+      if (this->first_value_) {
+        this->accumulator_ = value;
+        this->first_value_ = false;
+      } else {
+        this->accumulator_ = (this->alpha_ * value) + (1.0f - this->alpha_) * this->accumulator_;
+      }
+    }
+    if (++this->send_at_ >= this->send_every_) {
+      this->send_at_ = 0;
+      values[out++] = std::isnan(value) ? value : this->accumulator_;
+    }
+  }
+  return out;
+}
 void ExponentialMovingAverageFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
 void ExponentialMovingAverageFilter::set_alpha(float alpha) { this->alpha_ = alpha; }
 
@@ -292,11 +395,23 @@ optional<float> LambdaFilter::new_value(float value) {
 OffsetFilter::OffsetFilter(TemplatableValue<float> offset) : offset_(std::move(offset)) {}
 
 optional<float> OffsetFilter::new_value(float value) { return value + this->offset_.value(); }
+size_t OffsetFilter::new_values(float *values, size_t count) {
+  const float offset = this->offset_.value();
+  for (size_t i = 0; i < count; i++)
+    values[i] += offset;
+  return count;
+}
 
 // MultiplyFilter
 MultiplyFilter::MultiplyFilter(TemplatableValue<float> multiplier) : multiplier_(std::move(multiplier)) {}
 
 optional<float> MultiplyFilter::new_value(float value) { return value * this->multiplier_.value(); }
+size_t MultiplyFilter::new_values(float *values, size_t count) {
+  const float multiplier = this->multiplier_.value();
+  for (size_t i = 0; i < count; i++)
+    values[i] *= multiplier;
+  return count;
+}
 
 // FilterOutValueFilter
 FilterOutValueFilter::FilterOutValueFilter(std::vector<TemplatableValue<float>> values_to_filter_out)
@@ -432,6 +547,21 @@ optional<float> CalibrateLinearFilter::new_value(float value) {
   return NAN;
 }
 
+size_t CalibrateLinearFilter::new_values(float *values, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    float value = values[i];
+    float result = NAN;
+    for (const std::array<float, 3> &f : this->linear_functions_) {
+      if (!std::isfinite(f[2]) || value < f[2]) {
+        result = (value * f[0]) + f[1];
+        break;
+      }
+    }
+    values[i] = result;
+  }
+  return count;
+}
+
 optional<float> CalibratePolynomialFilter::new_value(float value) {
   float res = 0.0f;
   float x = 1.0f;
@@ -442,6 +572,23 @@ optional<float> CalibratePolynomialFilter::new_value(float value) {
   return res;
 }
 
+size_t CalibratePolynomialFilter::new_values(float *values, size_t count) {
+  const float *coefficients = this->coefficients_.data();
+  const size_t degree = this->coefficients_.size();
+  // Same summation order as new_value(), but the inner loop runs over independent values
+  for (size_t i = 0; i < count; i++) {
+    const float value = values[i];
+    float res = 0.0f;
+    float x = 1.0f;
+    for (size_t j = 0; j < degree; j++) {
+      res += x * coefficients[j];
+      x *= value;
+    }
+    values[i] = res;
+  }
+  return count;
+}
+
 ClampFilter::ClampFilter(float min, float max, bool ignore_out_of_range)
     : min_(min), max_(max), ignore_out_of_range_(ignore_out_of_range) {}
 optional<float> ClampFilter::new_value(float value) {
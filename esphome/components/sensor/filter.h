@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cmath>
 #include <queue>
+#include <tuple>
 #include <utility>
 #include <vector>
 #include "esphome/core/automation.h"
@@ -30,12 +32,26 @@ class Filter {
    */
   virtual optional<float> new_value(float value) = 0;
 
+  /** Filter a block of values in place.
+   *
+   * The values that should be pushed out are written to the start of \p values, in order. The default
+   * implementation calls new_value() for each value, filters with a cheaper loop over the whole block
+   * override this.
+   *
+   * @param values The new values, oldest first.
+   * @param count The number of values.
+   * @return The number of values that should be pushed out.
+   */
+  virtual size_t new_values(float *values, size_t count);
+
   /// Initialize this filter, please note this can be called more than once.
   virtual void initialize(Sensor *parent, Filter *next);
 
   void input(float value);
+  void input_values(float *values, size_t count);
 
   void output(float value);
+  void output_values(float *values, size_t count);
 
  protected:
   friend Sensor;
@@ -44,6 +60,75 @@ class Filter {
   Sensor *parent_{nullptr};
 };
 
+/// Fixed capacity ring buffer of the last values a windowed filter has seen.
+class ValueWindow {
+ public:
+  size_t capacity() const { return this->ring_.size(); }
+  /// Change the capacity, keeping the newest values that still fit.
+  void set_capacity(size_t capacity);
+
+  /** Add a value, dropping the oldest one if the window is full.
+   *
+   * @return true if a value was dropped, it is stored in \p evicted.
+   */
+  bool push(float value, float &evicted);
+
+  size_t size() const { return this->count_; }
+  /// The value at \p i, starting with the oldest one.
+  float operator[](size_t i) const { return this->ring_[(this->head_ + i) % this->ring_.size()]; }
+
+ protected:
+  std::vector<float> ring_;
+  size_t head_{0};
+  size_t count_{0};
+};
+
+/** Sliding window of the last values that keeps its non-NaN values sorted.
+ *
+ * Each new value is moved into place in the sorted copy with a binary search, so order statistics like the
+ * median don't need a copy and sort per output.
+ */
+class SortedWindow {
+ public:
+  /// Add a value, dropping the oldest one once the window holds \p window_size values.
+  void push(float value, size_t window_size);
+
+  /// The non-NaN values in the window, in ascending order.
+  const std::vector<float> &sorted() const { return this->sorted_; }
+
+ protected:
+  ValueWindow values_;
+  std::vector<float> sorted_;
+};
+
+/** Sliding window minimum or maximum of the last values.
+ *
+ * Only values that can still become the result are kept, in a monotonic queue ordered by age, so the front
+ * is always the result and each value is added and removed once.
+ */
+class MonotonicWindow {
+ public:
+  explicit MonotonicWindow(bool max) : max_(max) {}
+
+  /// Add a value, dropping values older than the last \p window_size ones.
+  void push(float value, size_t window_size);
+
+  /// The minimum (or maximum) non-NaN value in the window, NaN if there is none.
+  float get() const { return this->count_ ? this->ring_[this->head_].value : NAN; }
+
+ protected:
+  struct Entry {
+    size_t index;
+    float value;
+  };
+
+  std::vector<Entry> ring_;
+  size_t head_{0};
+  size_t count_{0};
+  size_t pushed_{0};
+  bool max_;
+};
+
 /** Simple quantile filter.
  *
  * Takes the quantile of the last <send_every> values and pushes it out every <send_every>.
@@ -68,7 +153,7 @@ class QuantileFilter : public Filter {
   void set_quantile(float quantile);
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
@@ -97,7 +182,7 @@ class MedianFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
@@ -143,7 +228,7 @@ class MinFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  MonotonicWindow window_{false};
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
@@ -171,7 +256,7 @@ class MaxFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  MonotonicWindow window_{true};
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
@@ -200,7 +285,16 @@ class SlidingWindowMovingAverageFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  void add_(float value);
+  void recalculate_sum_();
+
+  ValueWindow window_;
+  float sum_{0.0f};
+  /// Kahan summation compensation for the low-order bits lost in sum_.
+  float compensation_{0.0f};
+  size_t valid_count_{0};
+  /// Values added since sum_ was last recalculated from the window.
+  size_t since_recalculate_{0};
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
@@ -216,6 +310,7 @@ class ExponentialMovingAverageFilter : public Filter {
   ExponentialMovingAverageFilter(float alpha, size_t send_every, size_t send_first_at);
 
   optional<float> new_value(float value) override;
+  size_t new_values(float *values, size_t count) override;
 
   void set_send_every(size_t send_every);
   void set_alpha(float alpha);
@@ -277,6 +372,8 @@ class OffsetFilter : public Filter {
   explicit OffsetFilter(TemplatableValue<float> offset);
 
   optional<float> new_value(float value) override;
+  /// Adds the same offset to the whole block, it is only evaluated once.
+  size_t new_values(float *values, size_t count) override;
 
  protected:
   TemplatableValue<float> offset_;
@@ -287,6 +384,8 @@ class MultiplyFilter : public Filter {
  public:
   explicit MultiplyFilter(TemplatableValue<float> multiplier);
   optional<float> new_value(float value) override;
+  /// Multiplies the whole block with the same multiplier, it is only evaluated once.
+  size_t new_values(float *values, size_t count) override;
 
  protected:
   TemplatableValue<float> multiplier_;
@@ -396,6 +495,7 @@ class CalibrateLinearFilter : public Filter {
   CalibrateLinearFilter(std::vector<std::array<float, 3>> linear_functions)
       : linear_functions_(std::move(linear_functions)) {}
   optional<float> new_value(float value) override;
+  size_t new_values(float *values, size_t count) override;
 
  protected:
   std::vector<std::array<float, 3>> linear_functions_;
@@ -405,6 +505,7 @@ class CalibratePolynomialFilter : public Filter {
  public:
   CalibratePolynomialFilter(std::vector<float> coefficients) : coefficients_(std::move(coefficients)) {}
   optional<float> new_value(float value) override;
+  size_t new_values(float *values, size_t count) override;
 
  protected:
   std::vector<float> coefficients_;
@@ -461,5 +562,33 @@ class ToNTCTemperatureFilter : public Filter {
   double c_;
 };
 
+/** Runs a whole filter chain as one filter.
+ *
+ * Codegen uses this when every filter of a chain has a simple type. The stages are stored by value and their
+ * new_value() is called without virtual dispatch, so the chain costs one allocation and one virtual call per
+ * value instead of one per stage.
+ */
+template<typename... Stages> class FusedFilter : public Filter {
+ public:
+  explicit FusedFilter(Stages... stages) : stages_(std::move(stages)...) {}
+
+  optional<float> new_value(float value) override { return this->apply_<0>(value); }
+
+ protected:
+  template<size_t I> optional<float> apply_(float value) {
+    if constexpr (I == sizeof...(Stages)) {
+      return value;
+    } else {
+      using Stage = std::tuple_element_t<I, std::tuple<Stages...>>;
+      optional<float> out = std::get<I>(this->stages_).Stage::new_value(value);
+      if (!out.has_value())
+        return {};
+      return this->apply_<I + 1>(*out);
+    }
+  }
+
+  std::tuple<Stages...> stages_;
+};
+
 }  // namespace sensor
 }  // namespace esphome
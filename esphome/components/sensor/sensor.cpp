@@ -53,10 +53,37 @@ void Sensor::publish_state(float state) {
   if (this->filter_list_ == nullptr) {
     this->internal_send_state_to_frontend(state);
   } else {
+#ifdef USE_ENTITY_STATS
+    this->stats_.raw_inputs++;
+#endif
     this->filter_list_->input(state);
   }
 }
 
+void Sensor::publish_states(float *states, size_t count) {
+  if (count == 0)
+    return;
+  if (this->raw_callback_) {
+    for (size_t i = 0; i < count; i++) {
+      this->raw_state = states[i];
+      this->raw_callback_->call(states[i]);
+    }
+  }
+  this->raw_state = states[count - 1];
+
+  ESP_LOGV(TAG, "'%s': Received %zu new states", this->name_.c_str(), count);
+
+  if (this->filter_list_ == nullptr) {
+    for (size_t i = 0; i < count; i++)
+      this->internal_send_state_to_frontend(states[i]);
+  } else {
+#ifdef USE_ENTITY_STATS
+    this->stats_.raw_inputs += count;
+#endif
+    this->filter_list_->input_values(states, count);
+  }
+}
+
 void Sensor::add_on_state_callback(std::function<void(float)> &&callback) { this->callback_.add(std::move(callback)); }
 void Sensor::add_on_raw_state_callback(std::function<void(float)> &&callback) {
   if (!this->raw_callback_) {
@@ -105,5 +132,24 @@ void Sensor::internal_send_state_to_frontend(float state) {
   this->callback_.call(state);
 }
 
+void PublishGroup::stage(Sensor *sensor, float state) {
+  if (sensor == nullptr)
+    return;
+  for (auto &staged : this->staged_) {
+    if (staged.sensor == sensor) {
+      staged.state = state;
+      return;
+    }
+  }
+  this->staged_.push_back({sensor, state});
+}
+
+void PublishGroup::commit() {
+  for (auto &staged : this->staged_)
+    staged.sensor->publish_state(staged.state);
+  // Keeps the capacity, the next reading stages the same sensors again
+  this->staged_.clear();
+}
+
 }  // namespace sensor
 }  // namespace esphome
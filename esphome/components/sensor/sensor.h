@@ -116,6 +116,16 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
    */
   void publish_state(float state);
 
+  /** Publish a block of new states, like the samples of one high-rate read.
+   *
+   * Works like calling publish_state() for each state, but the whole block passes each filter at once, so
+   * filters with a block implementation can process it in a single loop.
+   *
+   * @param states The states, oldest first. The filters work in place, so the values are overwritten.
+   * @param count The number of states.
+   */
+  void publish_states(float *states, size_t count);
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Add a callback that will be called every time a filtered value arrives.
@@ -142,7 +152,12 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
 
  protected:
   std::unique_ptr<CallbackManager<void(float)>> raw_callback_;  ///< Storage for raw state callbacks (lazy allocated).
-  CallbackManager<void(float)> callback_;                       ///< Storage for filtered state callbacks.
+#ifdef ESPHOME_SENSOR_INLINE_CALLBACKS
+  /// Storage for filtered state callbacks, sized at compile time for the known front-end subscribers.
+  StaticCallbackManager<ESPHOME_SENSOR_INLINE_CALLBACKS, void(float)> callback_;
+#else
+  CallbackManager<void(float)> callback_;  ///< Storage for filtered state callbacks.
+#endif
 
   Filter *filter_list_{nullptr};  ///< Store all active filters.
 
@@ -159,5 +174,29 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
   } sensor_flags_{};
 };
 
+/** Stages the states of several sensors to publish them together.
+ *
+ * Meters that read many registers over several loop iterations stage every value as it is decoded and commit once the
+ * reading is complete. The states then go out in the same loop iteration, so the API sends them in one batch and
+ * clients never see a mix of old and new values. A reading that fails half way can be discarded instead.
+ */
+class PublishGroup {
+ public:
+  /// Stage a state, replacing one already staged for the sensor. Unconfigured sensors (nullptr) are skipped.
+  void stage(Sensor *sensor, float state);
+  /// Publish the staged states in the order they were first staged.
+  void commit();
+  /// Drop the staged states.
+  void discard() { this->staged_.clear(); }
+  bool empty() const { return this->staged_.empty(); }
+
+ protected:
+  struct StagedState {
+    Sensor *sensor;
+    float state;
+  };
+  std::vector<StagedState> staged_;
+};
+
 }  // namespace sensor
 }  // namespace esphome
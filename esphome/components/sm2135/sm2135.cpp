@@ -90,8 +90,10 @@ void SM2135::write_buffer_(uint8_t *buffer, uint8_t size) {
 }
 
 void SM2135::loop() {
-  if (!this->update_)
+  if (!this->update_) {
+    this->disable_loop();
     return;
+  }
 
   this->sm2135_start_();
   this->write_byte_(SM2135_ADDR_MC);
@@ -133,6 +135,7 @@ void SM2135::loop() {
 void SM2135::set_channel_value_(uint8_t channel, uint8_t value) {
   if (this->pwm_amounts_[channel] != value) {
     this->update_ = true;
+    this->enable_loop();
     this->update_channel_ = channel;
   }
   this->pwm_amounts_[channel] = value;
@@ -25,42 +25,48 @@ char Sml::check_start_end_bytes_(uint8_t byte) {
 }
 
 void Sml::loop() {
-  while (available()) {
-    const char c = read();
-
-    if (this->record_)
-      this->sml_data_.emplace_back(c);
-
-    switch (this->check_start_end_bytes_(c)) {
-      case START_BYTES_DETECTED: {
-        this->record_ = true;
-        this->sml_data_.clear();
-        // add start sequence (for callbacks)
-        this->sml_data_.insert(this->sml_data_.begin(), START_SEQ.begin(), START_SEQ.end());
-        break;
-      };
-      case END_BYTES_DETECTED: {
-        if (this->record_) {
-          this->record_ = false;
-
-          bool valid = check_sml_data(this->sml_data_);
-
-          // call callbacks
-          this->data_callbacks_.call(this->sml_data_, valid);
-
-          if (!valid)
-            break;
-
-          // remove start/end sequence
-          this->process_sml_file_(
-              BytesView(this->sml_data_).subview(START_SEQ.size(), this->sml_data_.size() - START_SEQ.size() - 8));
-        }
-        break;
-      };
-    };
+  uint8_t buf[RX_CHUNK_SIZE];
+  size_t len;
+  while ((len = this->read_available(buf, sizeof(buf))) != 0) {
+    for (size_t i = 0; i < len; i++) {
+      this->process_byte_(buf[i]);
+    }
   }
 }
 
+void Sml::process_byte_(const char c) {
+  if (this->record_)
+    this->sml_data_.emplace_back(c);
+
+  switch (this->check_start_end_bytes_(c)) {
+    case START_BYTES_DETECTED: {
+      this->record_ = true;
+      this->sml_data_.clear();
+      // add start sequence (for callbacks)
+      this->sml_data_.insert(this->sml_data_.begin(), START_SEQ.begin(), START_SEQ.end());
+      break;
+    };
+    case END_BYTES_DETECTED: {
+      if (this->record_) {
+        this->record_ = false;
+
+        bool valid = check_sml_data(this->sml_data_);
+
+        // call callbacks
+        this->data_callbacks_.call(this->sml_data_, valid);
+
+        if (!valid)
+          break;
+
+        // remove start/end sequence
+        this->process_sml_file_(
+            BytesView(this->sml_data_).subview(START_SEQ.size(), this->sml_data_.size() - START_SEQ.size() - 8));
+      }
+      break;
+    };
+  };
+}
+
 void Sml::add_on_data_callback(std::function<void(std::vector<uint8_t>, bool)> &&callback) {
   this->data_callbacks_.add(std::move(callback));
 }
@@ -10,6 +10,9 @@
 namespace esphome {
 namespace sml {
 
+/// Bytes read from the UART at once
+static const size_t RX_CHUNK_SIZE = 64;
+
 class SmlListener {
  public:
   std::string server_id;
@@ -31,6 +34,7 @@ class Sml : public Component, public uart::UARTDevice {
   void log_obis_info_(const std::vector<ObisInfo> &obis_info_vec);
   void publish_obis_info_(const std::vector<ObisInfo> &obis_info_vec);
   char check_start_end_bytes_(uint8_t byte);
+  void process_byte_(char c);
   void publish_value_(const ObisInfo &obis_info);
 
   // Serial parser
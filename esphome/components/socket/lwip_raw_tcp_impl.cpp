@@ -325,37 +325,21 @@ class LWIPRawImpl : public Socket {
     size_t read = 0;
     uint8_t *buf8 = reinterpret_cast<uint8_t *>(buf);
     while (len && rx_buf_ != nullptr) {
-      size_t pb_len = rx_buf_->len;
-      size_t pb_left = pb_len - rx_buf_offset_;
+      size_t pb_left = rx_buf_->len - rx_buf_offset_;
       if (pb_left == 0)
         break;
       size_t copysize = std::min(len, pb_left);
       memcpy(buf8, reinterpret_cast<uint8_t *>(rx_buf_->payload) + rx_buf_offset_, copysize);
-
-      if (pb_left == copysize) {
-        // full pb copied, free it
-        if (rx_buf_->next == nullptr) {
-          // last buffer in chain
-          pbuf_free(rx_buf_);
-          rx_buf_ = nullptr;
-          rx_buf_offset_ = 0;
-        } else {
-          auto *old_buf = rx_buf_;
-          rx_buf_ = rx_buf_->next;
-          pbuf_ref(rx_buf_);
-          pbuf_free(old_buf);
-          rx_buf_offset_ = 0;
-        }
-      } else {
-        rx_buf_offset_ += copysize;
-      }
-      LWIP_LOG("tcp_recved(%p %u)", pcb_, copysize);
-      tcp_recved(pcb_, copysize);
+      this->advance_rx_(copysize);
 
       buf8 += copysize;
       len -= copysize;
       read += copysize;
     }
+    if (read != 0) {
+      LWIP_LOG("tcp_recved(%p %u)", pcb_, read);
+      tcp_recved(pcb_, read);
+    }
 
     if (read == 0) {
       errno = EWOULDBLOCK;
@@ -364,6 +348,22 @@ class LWIPRawImpl : public Socket {
 
     return read;
   }
+  const uint8_t *peek(size_t *len) override {
+    if (pcb_ == nullptr || rx_buf_ == nullptr || rx_buf_->len == rx_buf_offset_)
+      return nullptr;
+    *len = rx_buf_->len - rx_buf_offset_;
+    return reinterpret_cast<const uint8_t *>(rx_buf_->payload) + rx_buf_offset_;
+  }
+  void consume(size_t len) override {
+    if (pcb_ == nullptr || rx_buf_ == nullptr)
+      return;
+    len = std::min(len, (size_t) (rx_buf_->len - rx_buf_offset_));
+    if (len == 0)
+      return;
+    this->advance_rx_(len);
+    LWIP_LOG("tcp_recved(%p %u)", pcb_, len);
+    tcp_recved(pcb_, len);
+  }
   ssize_t readv(const struct iovec *iov, int iovcnt) override {
     ssize_t ret = 0;
     for (int i = 0; i < iovcnt; i++) {
@@ -380,7 +380,7 @@ class LWIPRawImpl : public Socket {
     }
     return ret;
   }
-  ssize_t internal_write(const void *buf, size_t len) {
+  ssize_t internal_write(const void *buf, size_t len, bool more = false) {
     if (pcb_ == nullptr) {
       errno = ECONNRESET;
       return -1;
@@ -398,7 +398,11 @@ class LWIPRawImpl : public Socket {
     }
     size_t to_send = std::min((size_t) space, len);
     LWIP_LOG("tcp_write(%p buf=%p %u)", pcb_, buf, to_send);
-    err_t err = tcp_write(pcb_, buf, to_send, TCP_WRITE_FLAG_COPY);
+    // the data has to be copied: callers reuse their buffers as soon as this returns, long before the peer ACKs
+    uint8_t flags = TCP_WRITE_FLAG_COPY;
+    if (more || to_send != len)
+      flags |= TCP_WRITE_FLAG_MORE;
+    err_t err = tcp_write(pcb_, buf, to_send, flags);
     if (err == ERR_MEM) {
       LWIP_LOG("  -> err ERR_MEM");
       errno = EWOULDBLOCK;
@@ -446,7 +450,8 @@ class LWIPRawImpl : public Socket {
   ssize_t writev(const struct iovec *iov, int iovcnt) override {
     ssize_t written = 0;
     for (int i = 0; i < iovcnt; i++) {
-      ssize_t err = internal_write(reinterpret_cast<uint8_t *>(iov[i].iov_base), iov[i].iov_len);
+      // only the last part of the data gets the push flag
+      ssize_t err = internal_write(reinterpret_cast<uint8_t *>(iov[i].iov_base), iov[i].iov_len, i + 1 != iovcnt);
       if (err == -1) {
         if (written != 0)
           // if we already read some don't return an error
@@ -586,6 +591,26 @@ class LWIPRawImpl : public Socket {
     return -1;
   }
 
+  // drops len bytes of the head pbuf of rx_buf_, the caller has to tell lwIP with tcp_recved()
+  void advance_rx_(size_t len) {
+    if (len != rx_buf_->len - rx_buf_offset_) {
+      rx_buf_offset_ += len;
+      return;
+    }
+    // full pb consumed, free it
+    if (rx_buf_->next == nullptr) {
+      // last buffer in chain
+      pbuf_free(rx_buf_);
+      rx_buf_ = nullptr;
+    } else {
+      auto *old_buf = rx_buf_;
+      rx_buf_ = rx_buf_->next;
+      pbuf_ref(rx_buf_);
+      pbuf_free(old_buf);
+    }
+    rx_buf_offset_ = 0;
+  }
+
   struct tcp_pcb *pcb_;
   std::queue<std::unique_ptr<LWIPRawImpl>> accepted_sockets_;
   bool rx_closed_ = false;
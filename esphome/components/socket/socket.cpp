@@ -33,6 +33,21 @@ bool Socket::ready() const {
 #endif
 }
 
+size_t Socket::read_batch(DatagramPool &pool) {
+  size_t count = 0;
+  while (count != pool.count_) {
+    ssize_t len = this->read(pool.slot_(count), pool.max_size_ + 1);
+    if (len <= 0)
+      break;
+    if ((size_t) len > pool.max_size_) {
+      pool.dropped_++;
+      continue;
+    }
+    pool.sizes_[count++] = len;
+  }
+  return count;
+}
+
 std::unique_ptr<Socket> socket_ip(int type, int protocol) {
 #if USE_NETWORK_IPV6
   return socket(AF_INET6, type, protocol);
@@ -9,6 +9,8 @@
 namespace esphome {
 namespace socket {
 
+class DatagramPool;
+
 class Socket {
  public:
   Socket() = default;
@@ -43,6 +45,12 @@ class Socket {
   virtual ssize_t recvfrom(void *buf, size_t len, sockaddr *addr, socklen_t *addr_len) = 0;
 #endif
   virtual ssize_t readv(const struct iovec *iov, int iovcnt) = 0;
+  /// Look at the received data without copying it. Returns the next contiguous bytes and sets len to their number,
+  /// or returns nullptr if nothing is buffered or the implementation can't do this. The bytes stay valid until the
+  /// next consume() or read(); more data can follow them.
+  virtual const uint8_t *peek(size_t *len) { return nullptr; }
+  /// Drop len bytes returned by peek()
+  virtual void consume(size_t len) {}
   virtual ssize_t write(const void *buf, size_t len) = 0;
   virtual ssize_t writev(const struct iovec *iov, int iovcnt) = 0;
   virtual ssize_t sendto(const void *buf, size_t len, int flags, const struct sockaddr *to, socklen_t tolen) = 0;
@@ -58,12 +66,44 @@ class Socket {
   /// For non-monitored sockets, always returns true (assumes data may be available)
   bool ready() const;
 
+  /// Read all datagrams waiting on a non-blocking socket into the pool, until none is left or the pool is full.
+  /// Returns the number of datagrams in the pool; those are valid until the next call.
+  size_t read_batch(DatagramPool &pool);
+
  protected:
 #ifdef USE_SOCKET_SELECT_SUPPORT
   bool loop_monitored_{false};  ///< Whether this socket is monitored by the event loop
 #endif
 };
 
+/** Receive buffers for Socket::read_batch(), allocated once and reused for every batch.
+ *
+ * Each slot has one spare byte, so a datagram longer than max_size can be told apart from one that fits exactly.
+ * Such datagrams would only be seen truncated, so they are dropped and counted instead.
+ */
+class DatagramPool {
+ public:
+  DatagramPool(size_t max_size, size_t count)
+      : buffer_(new uint8_t[(max_size + 1) * count]), sizes_(new size_t[count]), max_size_(max_size), count_(count) {}
+
+  const uint8_t *data(size_t index) const { return this->slot_(index); }
+  size_t size(size_t index) const { return this->sizes_[index]; }
+  size_t get_max_size() const { return this->max_size_; }
+  size_t get_count() const { return this->count_; }
+  /// Datagrams dropped since boot because they were longer than max_size
+  uint32_t get_dropped() const { return this->dropped_; }
+
+ protected:
+  friend class Socket;
+  uint8_t *slot_(size_t index) const { return this->buffer_.get() + index * (this->max_size_ + 1); }
+
+  std::unique_ptr<uint8_t[]> buffer_;
+  std::unique_ptr<size_t[]> sizes_;
+  size_t max_size_;
+  size_t count_;
+  uint32_t dropped_{0};
+};
+
 /// Create a socket of the given domain, type and protocol.
 std::unique_ptr<Socket> socket(int domain, int type, int protocol);
 /// Create a socket in the newest available IP domain (IPv6 or IPv4) of the given type and protocol.
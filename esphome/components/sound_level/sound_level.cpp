@@ -29,13 +29,7 @@ void SoundLevelComponent::dump_config() {
 }
 
 void SoundLevelComponent::setup() {
-  this->microphone_source_->add_data_callback([this](const std::vector<uint8_t> &data) {
-    std::shared_ptr<RingBuffer> temp_ring_buffer = this->ring_buffer_.lock();
-    if (this->ring_buffer_.use_count() == 2) {
-      // ``audio_buffer_`` and ``temp_ring_buffer`` share ownership of a ring buffer, so its safe/useful to write
-      temp_ring_buffer->write((void *) data.data(), data.size());
-    }
-  });
+  this->microphone_reader_ = this->microphone_source_->create_reader(RING_BUFFER_DURATION_MS);
 
   if (!this->microphone_source_->is_passive()) {
     // Automatically start the microphone if not in passive mode
@@ -82,8 +76,8 @@ void SoundLevelComponent::loop() {
     return;
   }
 
-  // Copy data from ring buffer into the transfer buffer - don't block to avoid slowing the main loop
-  this->audio_buffer_->transfer_data_from_source(0);
+  // Convert new audio into the transfer buffer - don't block to avoid slowing the main loop
+  this->microphone_reader_->transfer_to(*this->audio_buffer_, 0);
 
   if (this->audio_buffer_->available() == 0) {
     // No new audio available for processing
@@ -171,18 +165,8 @@ bool SoundLevelComponent::start_() {
     return false;
   }
 
-  // Allocates a new ring buffer, adds it as a source for the transfer buffer, and points ring_buffer_ to it
-  this->ring_buffer_.reset();  // Reset pointer to any previous ring buffer allocation
-  std::shared_ptr<RingBuffer> temp_ring_buffer =
-      RingBuffer::create(this->microphone_source_->get_audio_stream_info().ms_to_bytes(RING_BUFFER_DURATION_MS));
-  if (temp_ring_buffer.use_count() == 0) {
-    this->status_momentary_error("Failed to allocate ring buffer", 15000);
-    this->stop_();
-    return false;
-  } else {
-    this->ring_buffer_ = temp_ring_buffer;
-    this->audio_buffer_->set_source(temp_ring_buffer);
-  }
+  // Only measure audio captured from now on
+  this->microphone_reader_->reset();
 
   this->status_clear_error();
   return true;
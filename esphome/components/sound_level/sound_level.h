@@ -7,7 +7,6 @@
 #include "esphome/components/sensor/sensor.h"
 
 #include "esphome/core/component.h"
-#include "esphome/core/ring_buffer.h"
 
 namespace esphome {
 namespace sound_level {
@@ -36,11 +35,11 @@ class SoundLevelComponent : public Component {
   void stop();
 
  protected:
-  /// @brief Internal start command that, if necessary, allocates ``audio_buffer_`` and a ring buffer which
-  /// ``audio_buffer_`` owns and ``ring_buffer_`` points to. Returns true if allocations were successful.
+  /// @brief Internal start command that, if necessary, allocates ``audio_buffer_`` and resets
+  /// ``microphone_reader_``. Returns true if allocations were successful.
   bool start_();
 
-  /// @brief Internal stop command the deallocates ``audio_buffer_`` (which automatically deallocates its ring buffer)
+  /// @brief Internal stop command the deallocates ``audio_buffer_``
   void stop_();
 
   microphone::MicrophoneSource *microphone_source_{nullptr};
@@ -49,7 +48,7 @@ class SoundLevelComponent : public Component {
   sensor::Sensor *rms_sensor_{nullptr};
 
   std::unique_ptr<audio::AudioSourceTransferBuffer> audio_buffer_;
-  std::weak_ptr<RingBuffer> ring_buffer_;
+  std::unique_ptr<microphone::MicrophoneReader> microphone_reader_;
 
   int32_t squared_peak_{0};
   uint64_t squared_samples_sum_{0};
@@ -350,6 +350,7 @@ async def to_code(config):
     cg.add_define("USE_OTA_STATE_CALLBACK")
 
     cg.add(var.set_buffer_size(config[CONF_BUFFER_SIZE]))
+    audio.add_audio_stats_stage(var, str(config[CONF_ID]))
 
     cg.add(var.set_task_stack_in_psram(config[CONF_TASK_STACK_IN_PSRAM]))
     if config[CONF_TASK_STACK_IN_PSRAM]:
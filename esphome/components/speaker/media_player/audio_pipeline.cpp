@@ -17,6 +17,8 @@ static const uint32_t DECODE_TASK_STACK_SIZE = 3 * 1024;
 
 static const uint32_t INFO_ERROR_QUEUE_COUNT = 5;
 
+static const uint32_t PREFETCH_POLL_MS = 10;  // How often the reader checks on the decoder while holding queued media
+
 static const char *const TAG = "speaker_media_player.pipeline";
 
 enum EventGroupBits : uint32_t {
@@ -24,6 +26,10 @@ enum EventGroupBits : uint32_t {
 
   // Stops all activity in the pipeline elements; cleared by process_state() and set by stop() or by each task
   PIPELINE_COMMAND_STOP = (1 << 0),
+  // Open the queued media once the current one is read; cleared by reader task and set by queue_next_url/file
+  READER_COMMAND_PREFETCH = (1 << 1),
+  // The decoder switched to the queued media; cleared by take_next_started()
+  PIPELINE_MESSAGE_NEXT_STARTED = (1 << 2),
 
   // Read audio from an HTTP source; cleared by reader task and set by start_url
   READER_COMMAND_INIT_HTTP = (1 << 4),
@@ -36,11 +42,15 @@ enum EventGroupBits : uint32_t {
   READER_MESSAGE_FINISHED = (1 << 7),
   // Error reading the file; cleared by process_state()
   READER_MESSAGE_ERROR = (1 << 8),
+  // All of the current media is read and the queued media is opened; cleared by decoder task
+  READER_MESSAGE_NEXT_READY = (1 << 9),
 
   // Decoder is done (either through a faiilure or the end of the stream); cleared by decoder task
   DECODER_MESSAGE_FINISHED = (1 << 12),
   // Error decoding the file; cleared by process_state() by decoder task
   DECODER_MESSAGE_ERROR = (1 << 13),
+  // Decoder drained the current media and started on the queued media; cleared by reader task
+  DECODER_MESSAGE_NEXT_STARTED = (1 << 14),
 };
 
 AudioPipeline::AudioPipeline(speaker::Speaker *speaker, size_t buffer_size, bool task_stack_in_psram,
@@ -58,6 +68,7 @@ void AudioPipeline::start_url(const std::string &uri) {
   if (this->is_playing_) {
     xEventGroupSetBits(this->event_group_, PIPELINE_COMMAND_STOP);
   }
+  this->clear_queued_next_();
   this->current_uri_ = uri;
   this->pending_url_ = true;
 }
@@ -66,12 +77,52 @@ void AudioPipeline::start_file(audio::AudioFile *audio_file) {
   if (this->is_playing_) {
     xEventGroupSetBits(this->event_group_, PIPELINE_COMMAND_STOP);
   }
+  this->clear_queued_next_();
   this->current_audio_file_ = audio_file;
   this->pending_file_ = true;
 }
 
+void AudioPipeline::queue_next_url(const std::string &uri) {
+  if (this->next_queued_) {
+    return;
+  }
+  this->next_uri_ = uri;
+  this->next_audio_file_ = nullptr;
+  this->next_queued_ = true;
+  xEventGroupSetBits(this->event_group_, EventGroupBits::READER_COMMAND_PREFETCH);
+}
+
+void AudioPipeline::queue_next_file(audio::AudioFile *audio_file) {
+  if (this->next_queued_) {
+    return;
+  }
+  this->next_uri_.clear();
+  this->next_audio_file_ = audio_file;
+  this->next_queued_ = true;
+  xEventGroupSetBits(this->event_group_, EventGroupBits::READER_COMMAND_PREFETCH);
+}
+
+bool AudioPipeline::take_next_started() {
+  if (xEventGroupGetBits(this->event_group_) & EventGroupBits::PIPELINE_MESSAGE_NEXT_STARTED) {
+    xEventGroupClearBits(this->event_group_, EventGroupBits::PIPELINE_MESSAGE_NEXT_STARTED);
+    this->next_queued_ = false;
+    return true;
+  }
+  return false;
+}
+
+void AudioPipeline::clear_queued_next_() {
+  // Only called while stopping or stopped, so neither task is in the middle of a switch that would wait on these bits
+  xEventGroupClearBits(this->event_group_, EventGroupBits::READER_COMMAND_PREFETCH |
+                                               EventGroupBits::READER_MESSAGE_NEXT_READY |
+                                               EventGroupBits::DECODER_MESSAGE_NEXT_STARTED |
+                                               EventGroupBits::PIPELINE_MESSAGE_NEXT_STARTED);
+  this->next_queued_ = false;
+}
+
 esp_err_t AudioPipeline::stop() {
   xEventGroupSetBits(this->event_group_, EventGroupBits::PIPELINE_COMMAND_STOP);
+  this->clear_queued_next_();
 
   return ESP_OK;
 }
@@ -192,6 +243,7 @@ AudioPipelineState AudioPipeline::process_state() {
     if (event_bits & EventGroupBits::PIPELINE_COMMAND_STOP) {
       // Stop command is fully processed, so clear the command bit
       xEventGroupClearBits(this->event_group_, EventGroupBits::PIPELINE_COMMAND_STOP);
+      this->clear_queued_next_();
       this->hard_stop_ = true;
     }
 
@@ -348,6 +400,37 @@ void AudioPipeline::delete_tasks_() {
   }
 }
 
+std::unique_ptr<audio::AudioReader> AudioPipeline::prefetch_next_() {
+  // Open the queued media while the decoder drains what is left of the current media from the ring buffer. For urls
+  // this hides the connection setup and fills the reader's transfer buffer.
+  std::unique_ptr<audio::AudioReader> reader = make_unique<audio::AudioReader>(this->transfer_buffer_size_);
+  const bool is_file = this->next_audio_file_ != nullptr;
+  esp_err_t err = is_file ? reader->start(this->next_audio_file_, this->next_audio_file_type_)
+                          : reader->start(this->next_uri_, this->next_audio_file_type_);
+  if (err != ESP_OK) {
+    return nullptr;
+  }
+  xEventGroupSetBits(this->event_group_, EventGroupBits::READER_MESSAGE_NEXT_READY);
+
+  while (true) {
+    EventBits_t event_bits = xEventGroupGetBits(this->event_group_);
+    if (event_bits & EventGroupBits::PIPELINE_COMMAND_STOP) {
+      xEventGroupClearBits(this->event_group_, EventGroupBits::READER_MESSAGE_NEXT_READY);
+      return nullptr;
+    }
+    if (event_bits & EventGroupBits::DECODER_MESSAGE_NEXT_STARTED) {
+      xEventGroupClearBits(this->event_group_, EventGroupBits::DECODER_MESSAGE_NEXT_STARTED);
+      return reader;
+    }
+    // Without a sink, reading only fills the reader's transfer buffer. Files are in flash, so there is nothing to gain.
+    // A failed read shows up again once this is the current reader.
+    if (!is_file && reader->get_buffered_bytes() < this->transfer_buffer_size_) {
+      reader->read();
+    }
+    delay(PREFETCH_POLL_MS);
+  }
+}
+
 void AudioPipeline::read_task(void *params) {
   AudioPipeline *this_pipeline = (AudioPipeline *) params;
 
@@ -372,6 +455,10 @@ void AudioPipeline::read_task(void *params) {
 
       std::unique_ptr<audio::AudioReader> reader =
           make_unique<audio::AudioReader>(this_pipeline->transfer_buffer_size_);
+#ifdef USE_AUDIO_STATS
+      // Kept alive by the reader's sink. Not locked while running, as the tasks use its use_count as a signal.
+      RingBuffer *stats_ring_buffer = nullptr;
+#endif
 
       if (event_bits & EventGroupBits::READER_COMMAND_INIT_FILE) {
         err = reader->start(this_pipeline->current_audio_file_, this_pipeline->current_audio_file_type_);
@@ -393,6 +480,9 @@ void AudioPipeline::read_task(void *params) {
           err = ESP_ERR_NO_MEM;
         } else {
           reader->add_sink(this_pipeline->raw_file_ring_buffer_);
+#ifdef USE_AUDIO_STATS
+          stats_ring_buffer = this_pipeline->raw_file_ring_buffer_.lock().get();
+#endif
         }
       }
 
@@ -420,8 +510,28 @@ void AudioPipeline::read_task(void *params) {
 
         audio::AudioReaderState reader_state = reader->read();
 
+#ifdef USE_AUDIO_STATS
+        if ((this_pipeline->reader_stats_ != nullptr) && (stats_ring_buffer != nullptr)) {
+          this_pipeline->reader_stats_->record_fill(stats_ring_buffer->available(), stats_ring_buffer->free());
+        }
+#endif
+
         if (reader_state == audio::AudioReaderState::FINISHED) {
-          break;
+          if (!(event_bits & EventGroupBits::READER_COMMAND_PREFETCH)) {
+            break;
+          }
+          xEventGroupClearBits(this_pipeline->event_group_, EventGroupBits::READER_COMMAND_PREFETCH);
+
+          std::unique_ptr<audio::AudioReader> next_reader = this_pipeline->prefetch_next_();
+          if (next_reader == nullptr) {
+            // Finish normally, the media player then starts the queued media the usual way
+            break;
+          }
+          reader = std::move(next_reader);
+          reader->add_sink(this_pipeline->raw_file_ring_buffer_);
+          event.file_type = this_pipeline->current_audio_file_type_;
+          xQueueSend(this_pipeline->info_error_queue_, &event, portMAX_DELAY);
+          continue;
         } else if (reader_state == audio::AudioReaderState::FAILED) {
           xEventGroupSetBits(this_pipeline->event_group_,
                              EventGroupBits::READER_MESSAGE_ERROR | EventGroupBits::PIPELINE_COMMAND_STOP);
@@ -464,6 +574,9 @@ void AudioPipeline::decode_task(void *params) {
 
       esp_err_t err = decoder->start(this_pipeline->current_audio_file_type_);
       decoder->add_source(this_pipeline->raw_file_ring_buffer_);
+#ifdef USE_AUDIO_STATS
+      decoder->set_stats(this_pipeline->decoder_stats_);
+#endif
 
       if (err != ESP_OK) {
         // Send specific error message
@@ -477,6 +590,7 @@ void AudioPipeline::decode_task(void *params) {
 
       bool has_stream_info = false;
       bool started_playback = false;
+      bool switching_media = false;
 
       size_t initial_bytes_to_buffer = 0;
 
@@ -498,8 +612,9 @@ void AudioPipeline::decode_task(void *params) {
           decoder->set_pause_output_state(this_pipeline->pause_state_);
         }
 
-        // Stop gracefully if the reader has finished
-        audio::AudioDecoderState decoder_state = decoder->decode(event_bits & EventGroupBits::READER_MESSAGE_FINISHED);
+        // Stop gracefully if the reader has finished or moved on to the queued media
+        audio::AudioDecoderState decoder_state = decoder->decode(
+            event_bits & (EventGroupBits::READER_MESSAGE_FINISHED | EventGroupBits::READER_MESSAGE_NEXT_READY));
 
         if ((decoder_state == audio::AudioDecoderState::DECODING) ||
             (decoder_state == audio::AudioDecoderState::FINISHED)) {
@@ -507,7 +622,45 @@ void AudioPipeline::decode_task(void *params) {
         }
 
         if (decoder_state == audio::AudioDecoderState::FINISHED) {
-          break;
+          if (!(xEventGroupGetBits(this_pipeline->event_group_) & EventGroupBits::READER_MESSAGE_NEXT_READY)) {
+            break;
+          }
+
+          // Switch to the queued media at the decoder boundary. The speaker keeps running, so the new media's first
+          // samples follow the last ones of the previous media.
+          xEventGroupClearBits(this_pipeline->event_group_, EventGroupBits::READER_MESSAGE_NEXT_READY);
+          std::shared_ptr<RingBuffer> temp_ring_buffer = this_pipeline->raw_file_ring_buffer_.lock();
+          if (temp_ring_buffer != nullptr) {
+            // Drop anything after the end of the previous file, like trailing tags
+            temp_ring_buffer->reset();
+          }
+          this_pipeline->current_audio_file_type_ = this_pipeline->next_audio_file_type_;
+
+          event = InfoErrorEvent();
+          event.source = InfoErrorSource::DECODER;
+          decoder = make_unique<audio::AudioDecoder>(this_pipeline->transfer_buffer_size_,
+                                                     this_pipeline->transfer_buffer_size_);
+          err = decoder->start(this_pipeline->current_audio_file_type_);
+          decoder->add_source(this_pipeline->raw_file_ring_buffer_);
+#ifdef USE_AUDIO_STATS
+          decoder->set_stats(this_pipeline->decoder_stats_);
+#endif
+          if (err != ESP_OK) {
+            event.err = err;
+            xQueueSend(this_pipeline->info_error_queue_, &event, portMAX_DELAY);
+            xEventGroupSetBits(this_pipeline->event_group_,
+                               EventGroupBits::DECODER_MESSAGE_ERROR | EventGroupBits::PIPELINE_COMMAND_STOP);
+            break;
+          }
+
+          // The reader already buffered the start of the queued media, so don't wait for the initial buffer
+          has_stream_info = false;
+          started_playback = true;
+          switching_media = true;
+          this_pipeline->playback_ms_ = 0;
+          xEventGroupSetBits(this_pipeline->event_group_, EventGroupBits::DECODER_MESSAGE_NEXT_STARTED |
+                                                              EventGroupBits::PIPELINE_MESSAGE_NEXT_STARTED);
+          continue;
         } else if (decoder_state == audio::AudioDecoderState::FAILED) {
           if (!has_stream_info) {
             event.decoding_err = DecodingError::FAILED_HEADER;
@@ -537,6 +690,17 @@ void AudioPipeline::decode_task(void *params) {
             xEventGroupSetBits(this_pipeline->event_group_,
                                EventGroupBits::DECODER_MESSAGE_ERROR | EventGroupBits::PIPELINE_COMMAND_STOP);
           } else {
+            if (switching_media &&
+                (this_pipeline->speaker_->get_audio_stream_info() != this_pipeline->current_audio_stream_info_)) {
+              // The speaker can't change its format while running, so this switch can't be gapless
+              this_pipeline->speaker_->finish();
+              while (this_pipeline->speaker_->is_running() &&
+                     !(xEventGroupGetBits(this_pipeline->event_group_) & EventGroupBits::PIPELINE_COMMAND_STOP)) {
+                delay(10);
+              }
+            }
+            switching_media = false;
+
             // Send audio directly to the speaker
             this_pipeline->speaker_->set_audio_stream_info(this_pipeline->current_audio_stream_info_);
             decoder->add_sink(this_pipeline->speaker_);
@@ -5,6 +5,7 @@
 #include "esphome/components/audio/audio.h"
 #include "esphome/components/audio/audio_reader.h"
 #include "esphome/components/audio/audio_decoder.h"
+#include "esphome/components/audio/audio_stats.h"
 #include "esphome/components/speaker/speaker.h"
 
 #include "esphome/core/ring_buffer.h"
@@ -77,6 +78,20 @@ class AudioPipeline {
   /// @return ESP_OK if successful or an appropriate error if not
   void start_file(audio::AudioFile *audio_file);
 
+  /// @brief Queues a url to play right after the current media, without stopping the speaker in between. The reader
+  /// connects and buffers it while the decoder drains the current media.
+  void queue_next_url(const std::string &uri);
+
+  /// @brief Queues an AudioFile to play right after the current media, without stopping the speaker in between.
+  void queue_next_file(audio::AudioFile *audio_file);
+
+  /// @brief True if media was queued and the pipeline hasn't moved on to it yet. Starting or stopping the pipeline
+  /// drops the queued media.
+  bool has_queued_next() const { return this->next_queued_; }
+
+  /// @brief Returns true once after the pipeline switched to the queued media.
+  bool take_next_started();
+
   /// @brief Stops the pipeline. Sends a stop signal to each task (if running) and clears the ring buffers.
   /// @return ESP_OK if successful or ESP_ERR_TIMEOUT if the tasks did not indicate they stopped
   esp_err_t stop();
@@ -95,6 +110,14 @@ class AudioPipeline {
 
   void set_pause_state(bool pause_state);
 
+#ifdef USE_AUDIO_STATS
+  /// @brief Records the reader's file buffer fill level and the decoder's busy time and underruns into the stages
+  void set_audio_stats(audio::AudioStageStats *reader_stats, audio::AudioStageStats *decoder_stats) {
+    this->reader_stats_ = reader_stats;
+    this->decoder_stats_ = decoder_stats;
+  }
+#endif
+
  protected:
   /// @brief Allocates the event group and info error queue.
   /// @return ESP_OK if successful or ESP_ERR_NO_MEM if it is unable to allocate all parts
@@ -107,6 +130,13 @@ class AudioPipeline {
   /// @brief Resets the task related pointers and deallocates their stacks.
   void delete_tasks_();
 
+  /// @brief Drops any media queued with queue_next_url() or queue_next_file().
+  void clear_queued_next_();
+
+  /// @brief Opens the queued media and holds it until the decoder finished the current media. Runs in the reader task.
+  /// @return The reader for the queued media, or nullptr if it failed to open or the pipeline is stopping
+  std::unique_ptr<audio::AudioReader> prefetch_next_();
+
   std::string base_name_;
   UBaseType_t priority_;
 
@@ -127,6 +157,12 @@ class AudioPipeline {
   std::string current_uri_{};
   audio::AudioFile *current_audio_file_{nullptr};
 
+  // Media queued to play after the current one. Written before setting READER_COMMAND_PREFETCH, read by the reader.
+  bool next_queued_{false};
+  std::string next_uri_{};
+  audio::AudioFile *next_audio_file_{nullptr};
+  audio::AudioFileType next_audio_file_type_;
+
   audio::AudioFileType current_audio_file_type_;
   audio::AudioStreamInfo current_audio_stream_info_;
 
@@ -152,6 +188,11 @@ class AudioPipeline {
   TaskHandle_t decode_task_handle_{nullptr};
   StaticTask_t decode_task_stack_;
   StackType_t *decode_task_stack_buffer_{nullptr};
+
+#ifdef USE_AUDIO_STATS
+  audio::AudioStageStats *reader_stats_{nullptr};
+  audio::AudioStageStats *decoder_stats_{nullptr};
+#endif
 };
 
 }  // namespace speaker
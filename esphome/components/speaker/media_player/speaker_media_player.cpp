@@ -95,6 +95,13 @@ void SpeakerMediaPlayer::setup() {
     ESP_LOGE(TAG, "Failed to create announcement pipeline");
     this->mark_failed();
   }
+#ifdef USE_AUDIO_STATS
+  if ((this->announcement_pipeline_ != nullptr) && !this->audio_stats_name_.empty()) {
+    this->announcement_pipeline_->set_audio_stats(
+        new audio::AudioStageStats(this->audio_stats_name_ + "_announcement_reader"),
+        new audio::AudioStageStats(this->audio_stats_name_ + "_announcement_decoder"));
+  }
+#endif
 
   if (!this->single_pipeline_()) {
     this->media_pipeline_ = make_unique<AudioPipeline>(this->media_speaker_, this->buffer_size_,
@@ -104,6 +111,12 @@ void SpeakerMediaPlayer::setup() {
       ESP_LOGE(TAG, "Failed to create media pipeline");
       this->mark_failed();
     }
+#ifdef USE_AUDIO_STATS
+    if ((this->media_pipeline_ != nullptr) && !this->audio_stats_name_.empty()) {
+      this->media_pipeline_->set_audio_stats(new audio::AudioStageStats(this->audio_stats_name_ + "_media_reader"),
+                                             new audio::AudioStageStats(this->audio_stats_name_ + "_media_decoder"));
+    }
+#endif
   }
 
   ESP_LOGI(TAG, "Set up speaker media player");
@@ -311,6 +324,18 @@ void SpeakerMediaPlayer::loop() {
     this->media_pipeline_state_ = this->media_pipeline_->process_state();
   }
 
+  if (this->media_pipeline_ != nullptr) {
+    if (this->media_pipeline_->take_next_started()) {
+      // The pipeline moved on to the queued item without stopping
+      if (!this->media_repeat_one_ && !this->media_playlist_.empty()) {
+        this->media_playlist_.pop_front();
+      }
+    }
+    if ((this->media_pipeline_state_ == AudioPipelineState::PLAYING) && !this->media_pipeline_->has_queued_next()) {
+      this->queue_next_media_();
+    }
+  }
+
   if (this->media_pipeline_state_ == AudioPipelineState::ERROR_READING) {
     ESP_LOGE(TAG, "The media pipeline's file reader encountered an error.");
   } else if (this->media_pipeline_state_ == AudioPipelineState::ERROR_DECODING) {
@@ -407,6 +432,27 @@ void SpeakerMediaPlayer::loop() {
   }
 }
 
+void SpeakerMediaPlayer::queue_next_media_() {
+  if (this->media_playlist_delay_ms_ > 0) {
+    // The delay between items needs the pipeline to stop after each one
+    return;
+  }
+  const PlaylistItem *next = nullptr;
+  if (this->media_repeat_one_ && !this->media_playlist_.empty()) {
+    next = &this->media_playlist_.front();
+  } else if (this->media_playlist_.size() > 1) {
+    next = &this->media_playlist_[1];
+  }
+  if (next == nullptr) {
+    return;
+  }
+  if (next->url.has_value()) {
+    this->media_pipeline_->queue_next_url(next->url.value());
+  } else if (next->file.has_value()) {
+    this->media_pipeline_->queue_next_file(next->file.value());
+  }
+}
+
 void SpeakerMediaPlayer::play_file(audio::AudioFile *media_file, bool announcement, bool enqueue) {
   if (!this->is_ready()) {
     // Ignore any commands sent before the media player is setup
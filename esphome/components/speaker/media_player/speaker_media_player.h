@@ -51,6 +51,10 @@ class SpeakerMediaPlayer : public Component, public media_player::MediaPlayer {
 
   void set_buffer_size(size_t buffer_size) { this->buffer_size_ = buffer_size; }
   void set_task_stack_in_psram(bool task_stack_in_psram) { this->task_stack_in_psram_ = task_stack_in_psram; }
+#ifdef USE_AUDIO_STATS
+  /// @brief Each pipeline's reader and decoder record statistics as the stages <name>_<pipeline>_reader/_decoder
+  void set_audio_stats_name(const std::string &name) { this->audio_stats_name_ = name; }
+#endif
 
   // Percentage to increase or decrease the volume for volume up or volume down commands
   void set_volume_increment(float volume_increment) { this->volume_increment_ = volume_increment; }
@@ -101,6 +105,9 @@ class SpeakerMediaPlayer : public Component, public media_player::MediaPlayer {
   // Processes commands from media_control_command_queue_.
   void watch_media_commands_();
 
+  // Queues the media playlist's next item on the media pipeline, so it plays without a gap after the current one.
+  void queue_next_media_();
+
   std::unique_ptr<AudioPipeline> announcement_pipeline_;
   std::unique_ptr<AudioPipeline> media_pipeline_;
   Speaker *media_speaker_{nullptr};
@@ -125,6 +132,10 @@ class SpeakerMediaPlayer : public Component, public media_player::MediaPlayer {
 
   bool task_stack_in_psram_;
 
+#ifdef USE_AUDIO_STATS
+  std::string audio_stats_name_;
+#endif
+
   bool is_paused_{false};
   bool is_muted_{false};
 
@@ -83,6 +83,9 @@ CONF_FORCE_SW = "force_sw"
 CONF_INTERFACE = "interface"
 CONF_INTERFACE_INDEX = "interface_index"
 CONF_RELEASE_DEVICE = "release_device"
+CONF_BUS_PRIORITY = "bus_priority"
+# Keep in sync with MAX_BUS_PRIORITY in spi.h
+MAX_BUS_PRIORITY = 7
 TYPE_SINGLE = "single"
 TYPE_QUAD = "quad"
 TYPE_OCTAL = "octal"
@@ -402,6 +405,9 @@ def spi_device_schema(
             SPI_MODE_OPTIONS, upper=True
         ),
         cv.Optional(CONF_RELEASE_DEVICE): cv.All(cv.boolean, cv.only_with_esp_idf),
+        cv.Optional(CONF_BUS_PRIORITY): cv.All(
+            cv.int_range(min=0, max=MAX_BUS_PRIORITY), cv.only_with_esp_idf
+        ),
     }
     if cs_pin_required:
         schema[cv.Required(CONF_CS_PIN)] = pins.gpio_output_pin_schema
@@ -413,6 +419,11 @@ def spi_device_schema(
 async def register_spi_device(var, config):
     parent = await cg.get_variable(config[CONF_SPI_ID])
     cg.add(var.set_spi_parent(parent))
+    # Spread the updates of the sensors on one bus apart
+    if (id_ := config.get(CONF_ID)) is not None and id_.type.inherits_from(
+        cg.PollingComponent
+    ):
+        cg.add(var.set_polling_group(parent))
     if cs_pin := config.get(CONF_CS_PIN):
         pin = await cg.gpio_pin_expression(cs_pin)
         cg.add(var.set_cs_pin(pin))
@@ -422,6 +433,8 @@ async def register_spi_device(var, config):
         cg.add(var.set_mode(spi_mode))
     if release_device := config.get(CONF_RELEASE_DEVICE):
         cg.add(var.set_release_device(release_device))
+    if bus_priority := config.get(CONF_BUS_PRIORITY):
+        cg.add(var.set_bus_priority(bus_priority))
 
 
 def final_validate_device_schema(name: str, *, require_mosi: bool, require_miso: bool):
@@ -447,6 +460,33 @@ def final_validate_device_schema(name: str, *, require_mosi: bool, require_miso:
     )
 
 
+def _find_bus_users(config, bus_id, found):
+    if isinstance(config, dict):
+        if config.get(CONF_SPI_ID) == bus_id:
+            found.append(config)
+        for value in config.values():
+            _find_bus_users(value, bus_id, found)
+    elif isinstance(config, list):
+        for value in config:
+            _find_bus_users(value, bus_id, found)
+
+
+def final_validate_exclusive_bus(config, reason: str):
+    """Require that no other device uses the spi bus of this device.
+
+    For devices that use the bus from their own task, the bus isn't locked against
+    other devices on the main loop.
+    """
+    users = []
+    _find_bus_users(fv.full_config.get(), config[CONF_SPI_ID], users)
+    if others := [user for user in users if user.get(CONF_ID) != config[CONF_ID]]:
+        raise cv.Invalid(
+            f"{reason} needs an spi bus of its own, "
+            f"{len(others)} other device(s) use {config[CONF_SPI_ID]}",
+            path=[CONF_SPI_ID],
+        )
+
+
 FILTER_SOURCE_FILES = filter_source_files_from_platform(
     {
         "spi_arduino.cpp": {
@@ -38,6 +38,9 @@ using SPIInterface = void *;
 namespace esphome {
 namespace spi {
 
+/// Highest priority a device can be given with SPIClient::set_bus_priority()
+static const uint8_t MAX_BUS_PRIORITY = 7;
+
 /// The bit-order for SPI devices. This defines how the data read from and written to the device is interpreted.
 enum SPIBitOrder {
   /// The least significant bit is transmitted/received first.
@@ -251,10 +254,14 @@ class SPIDelegate {
   // check if device is ready
   virtual bool is_ready();
 
+  // devices with a higher priority may take the bus between the chunks of a long transfer of this one
+  void set_bus_priority(uint8_t priority) { this->bus_priority_ = priority; }
+
  protected:
   SPIBitOrder bit_order_{BIT_ORDER_MSB_FIRST};
   uint32_t data_rate_{1000000};
   SPIMode mode_{MODE0};
+  uint8_t bus_priority_{0};
   GPIOPin *cs_pin_{NullPin::NULL_PIN};
   static SPIDelegate *const NULL_DELEGATE;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 };
@@ -393,6 +400,7 @@ class SPIClient {
     esph_log_d("spi_device", "mode %u, data_rate %ukHz", (unsigned) this->mode_, (unsigned) (this->data_rate_ / 1000));
     this->delegate_ = this->parent_->register_device(this, this->mode_, this->bit_order_, this->data_rate_, this->cs_,
                                                      this->release_device_, this->write_only_);
+    this->delegate_->set_bus_priority(this->bus_priority_);
   }
 
   virtual void spi_teardown() {
@@ -403,6 +411,9 @@ class SPIClient {
   bool spi_is_ready() { return this->delegate_->is_ready(); }
   void set_release_device(bool release) { this->release_device_ = release; }
   void set_write_only(bool write_only) { this->write_only_ = write_only; }
+  /// Lets this device take the bus between the chunks of long transfers of devices with a lower priority.
+  /// Only supported by the ESP-IDF hardware SPI, up to MAX_BUS_PRIORITY.
+  void set_bus_priority(uint8_t priority) { this->bus_priority_ = priority; }
 
  protected:
   SPIBitOrder bit_order_{BIT_ORDER_MSB_FIRST};
@@ -412,6 +423,7 @@ class SPIClient {
   GPIOPin *cs_{nullptr};
   bool release_device_{false};
   bool write_only_{false};
+  uint8_t bus_priority_{0};
   SPIDelegate *delegate_{SPIDelegate::NULL_DELEGATE};
 };
 
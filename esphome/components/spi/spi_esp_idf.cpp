@@ -1,4 +1,5 @@
 #include "spi.h"
+#include <atomic>
 #include <vector>
 
 namespace esphome {
@@ -7,13 +8,31 @@ namespace spi {
 #ifdef USE_ESP_IDF
 static const char *const TAG = "spi-esp-idf";
 static const size_t MAX_TRANSFER_SIZE = 4092;  // dictated by ESP-IDF API.
+// chunks of a long transfer in flight at once, the DMA sends one while the next is queued
+static const size_t QUEUED_CHUNKS = 2;
+
+// Devices of a bus waiting to acquire it, by priority. Devices with a lower priority check it between the chunks of
+// long transfers and hand the bus over, so a short transfer of a device on another task doesn't wait for a whole
+// display flush.
+struct SPIBusWaiters {
+  std::atomic<uint8_t> count[MAX_BUS_PRIORITY + 1]{};
+
+  bool any_above(uint8_t priority) const {
+    for (size_t i = priority + 1; i <= MAX_BUS_PRIORITY; i++) {
+      if (this->count[i].load(std::memory_order_relaxed) != 0)
+        return true;
+    }
+    return false;
+  }
+};
 
 class SPIDelegateHw : public SPIDelegate {
  public:
-  SPIDelegateHw(SPIInterface channel, uint32_t data_rate, SPIBitOrder bit_order, SPIMode mode, GPIOPin *cs_pin,
-                bool release_device, bool write_only)
+  SPIDelegateHw(SPIInterface channel, SPIBusWaiters *waiters, uint32_t data_rate, SPIBitOrder bit_order, SPIMode mode,
+                GPIOPin *cs_pin, bool release_device, bool write_only)
       : SPIDelegate(data_rate, bit_order, mode, cs_pin),
         channel_(channel),
+        waiters_(waiters),
         release_device_(release_device),
         write_only_(write_only) {
     if (!this->release_device_)
@@ -26,8 +45,7 @@ class SPIDelegateHw : public SPIDelegate {
     if (this->release_device_)
       this->add_device_();
     if (this->is_ready()) {
-      if (spi_device_acquire_bus(this->handle_, portMAX_DELAY) != ESP_OK)
-        ESP_LOGE(TAG, "Failed to acquire SPI bus");
+      this->acquire_bus_();
       SPIDelegate::begin_transaction();
     } else {
       ESP_LOGW(TAG, "SPI device not ready, cannot begin transaction");
@@ -38,6 +56,7 @@ class SPIDelegateHw : public SPIDelegate {
     if (this->is_ready()) {
       SPIDelegate::end_transaction();
       spi_device_release_bus(this->handle_);
+      this->bus_acquired_ = false;
       if (this->release_device_) {
         spi_bus_remove_device(this->handle_);
         this->handle_ = nullptr;  // reset handle to indicate no device is registered
@@ -53,35 +72,28 @@ class SPIDelegateHw : public SPIDelegate {
 
   // do a transfer. either txbuf or rxbuf (but not both) may be null.
   // transfers above the maximum size will be split.
-  // TODO - make use of the queue for interrupt transfers to provide a (short) pipeline of blocks
-  // when splitting is required.
   void transfer(const uint8_t *txbuf, uint8_t *rxbuf, size_t length) override {
     if (rxbuf != nullptr && this->write_only_) {
       ESP_LOGE(TAG, "Attempted read from write-only channel");
       return;
     }
+    if (length > MAX_TRANSFER_SIZE) {
+      this->queued_transfer_(txbuf, rxbuf, length);
+      return;
+    }
     spi_transaction_t desc = {};
     desc.flags = 0;
-    while (length != 0) {
-      size_t const partial = std::min(length, MAX_TRANSFER_SIZE);
-      desc.length = partial * 8;
-      desc.rxlength = this->write_only_ ? 0 : partial * 8;
-      desc.tx_buffer = txbuf;
-      desc.rx_buffer = rxbuf;
-      // polling is used as it has about 10% less overhead than queuing an interrupt transfer
-      esp_err_t err = spi_device_polling_start(this->handle_, &desc, portMAX_DELAY);
-      if (err == ESP_OK) {
-        err = spi_device_polling_end(this->handle_, portMAX_DELAY);
-      }
-      if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Transmit failed - err %X", err);
-        break;
-      }
-      length -= partial;
-      if (txbuf != nullptr)
-        txbuf += partial;
-      if (rxbuf != nullptr)
-        rxbuf += partial;
+    desc.length = length * 8;
+    desc.rxlength = this->write_only_ ? 0 : length * 8;
+    desc.tx_buffer = txbuf;
+    desc.rx_buffer = rxbuf;
+    // polling is used as it has about 10% less overhead than queuing an interrupt transfer
+    esp_err_t err = spi_device_polling_start(this->handle_, &desc, portMAX_DELAY);
+    if (err == ESP_OK) {
+      err = spi_device_polling_end(this->handle_, portMAX_DELAY);
+    }
+    if (err != ESP_OK) {
+      ESP_LOGE(TAG, "Transmit failed - err %X", err);
     }
   }
 
@@ -151,6 +163,8 @@ class SPIDelegateHw : public SPIDelegate {
       // if more data is to be sent, skip the command and address phases.
       desc.command_bits = 0;
       desc.address_bits = 0;
+      if (length != 0)
+        this->yield_bus_();
     } while (length != 0);
   }
 
@@ -178,6 +192,8 @@ class SPIDelegateHw : public SPIDelegate {
         }
         this->write_array((const uint8_t *) buffer, partial * 2);
         length -= partial;
+        if (length != 0)
+          this->yield_bus_();
       }
     }
   }
@@ -185,13 +201,83 @@ class SPIDelegateHw : public SPIDelegate {
   void read_array(uint8_t *ptr, size_t length) override { this->transfer(nullptr, ptr, length); }
 
  protected:
+  void acquire_bus_() {
+    // Announce the wait, so a device with a lower priority in a long transfer hands the bus over
+    std::atomic<uint8_t> &waiting = this->waiters_->count[this->bus_priority_];
+    waiting.fetch_add(1, std::memory_order_relaxed);
+    if (spi_device_acquire_bus(this->handle_, portMAX_DELAY) != ESP_OK) {
+      ESP_LOGE(TAG, "Failed to acquire SPI bus");
+    } else {
+      this->bus_acquired_ = true;
+    }
+    waiting.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  bool should_yield_() const { return this->bus_acquired_ && this->waiters_->any_above(this->bus_priority_); }
+
+  // Hands the bus to a waiting device with a higher priority and waits until it is done with it. CS goes high
+  // meanwhile, the device sees the rest of the data as a continuation like after any other CS toggle.
+  void yield_bus_() {
+    if (!this->should_yield_())
+      return;
+    SPIDelegate::end_transaction();
+    spi_device_release_bus(this->handle_);
+    this->bus_acquired_ = false;
+    this->acquire_bus_();
+    SPIDelegate::begin_transaction();
+  }
+
+  // Sends a transfer above the maximum size as queued DMA chunks. The next chunk is queued while the previous one is
+  // sent, so the bus doesn't idle between chunks while the CPU sets up the next one.
+  void queued_transfer_(const uint8_t *txbuf, uint8_t *rxbuf, size_t length) {
+    spi_transaction_t descs[QUEUED_CHUNKS] = {};
+    size_t in_flight = 0;
+    size_t next = 0;
+    esp_err_t err = ESP_OK;
+    while (in_flight != 0 || (length != 0 && err == ESP_OK)) {
+      if (length != 0 && err == ESP_OK && in_flight < QUEUED_CHUNKS && !this->should_yield_()) {
+        size_t const partial = std::min(length, MAX_TRANSFER_SIZE);
+        spi_transaction_t &desc = descs[next];
+        next = (next + 1) % QUEUED_CHUNKS;
+        desc.length = partial * 8;
+        desc.rxlength = this->write_only_ ? 0 : partial * 8;
+        desc.tx_buffer = txbuf;
+        desc.rx_buffer = rxbuf;
+        err = spi_device_queue_trans(this->handle_, &desc, portMAX_DELAY);
+        if (err != ESP_OK)
+          continue;
+        in_flight++;
+        length -= partial;
+        if (txbuf != nullptr)
+          txbuf += partial;
+        if (rxbuf != nullptr)
+          rxbuf += partial;
+        continue;
+      }
+      if (in_flight == 0) {
+        // Only reached when a device with a higher priority waits, the bus is free to hand over
+        this->yield_bus_();
+        continue;
+      }
+      spi_transaction_t *done;
+      esp_err_t const result = spi_device_get_trans_result(this->handle_, &done, portMAX_DELAY);
+      if (result != ESP_OK) {
+        err = result;
+        break;
+      }
+      in_flight--;
+    }
+    if (err != ESP_OK)
+      ESP_LOGE(TAG, "Transmit failed - err %X", err);
+  }
+
   bool add_device_() {
     spi_device_interface_config_t config = {};
     config.mode = static_cast<uint8_t>(this->mode_);
     config.clock_speed_hz = static_cast<int>(this->data_rate_);
     config.spics_io_num = -1;
     config.flags = 0;
-    config.queue_size = 1;
+    config.queue_size = QUEUED_CHUNKS;
     config.pre_cb = nullptr;
     config.post_cb = nullptr;
     if (this->bit_order_ == BIT_ORDER_LSB_FIRST)
@@ -207,9 +293,11 @@ class SPIDelegateHw : public SPIDelegate {
   }
 
   SPIInterface channel_{};
+  SPIBusWaiters *waiters_;
   spi_device_handle_t handle_{};
   bool release_device_{false};
   bool write_only_{false};
+  bool bus_acquired_{false};
 };
 
 class SPIBusHw : public SPIBus {
@@ -251,12 +339,13 @@ class SPIBusHw : public SPIBus {
 
   SPIDelegate *get_delegate(uint32_t data_rate, SPIBitOrder bit_order, SPIMode mode, GPIOPin *cs_pin,
                             bool release_device, bool write_only) override {
-    return new SPIDelegateHw(this->channel_, data_rate, bit_order, mode, cs_pin, release_device,
+    return new SPIDelegateHw(this->channel_, &this->waiters_, data_rate, bit_order, mode, cs_pin, release_device,
                              write_only || Utility::get_pin_no(this->sdi_pin_) == -1);
   }
 
  protected:
   SPIInterface channel_{};
+  SPIBusWaiters waiters_;
 
   bool is_hw() override { return true; }
 };
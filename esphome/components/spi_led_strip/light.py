@@ -3,6 +3,8 @@ from esphome.components import light, spi
 import esphome.config_validation as cv
 from esphome.const import CONF_NUM_LEDS, CONF_OUTPUT_ID
 
+CONF_ASYNC_WRITE = "async_write"
+
 spi_led_strip_ns = cg.esphome_ns.namespace("spi_led_strip")
 SpiLedStrip = spi_led_strip_ns.class_(
     "SpiLedStrip", light.AddressableLight, spi.SPIDevice
@@ -12,12 +14,27 @@ CONFIG_SCHEMA = light.ADDRESSABLE_LIGHT_SCHEMA.extend(
     {
         cv.GenerateID(CONF_OUTPUT_ID): cv.declare_id(SpiLedStrip),
         cv.Optional(CONF_NUM_LEDS, default=1): cv.positive_not_null_int,
+        cv.Optional(CONF_ASYNC_WRITE, default=False): cv.All(
+            cv.boolean, cv.only_on_esp32
+        ),
     }
 ).extend(spi.spi_device_schema(False, "1MHz"))
 
 
+def _final_validate(config):
+    if config[CONF_ASYNC_WRITE]:
+        # The write task uses the bus while the main loop runs
+        spi.final_validate_exclusive_bus(config, CONF_ASYNC_WRITE)
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_OUTPUT_ID], config[CONF_NUM_LEDS])
     await light.register_light(var, config)
     await spi.register_spi_device(var, config)
+    if config[CONF_ASYNC_WRITE]:
+        cg.add(var.set_async_write(True))
     await cg.register_component(var, config)
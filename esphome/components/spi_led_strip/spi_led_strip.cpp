@@ -1,12 +1,16 @@
 #include "spi_led_strip.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace spi_led_strip {
 
 SpiLedStrip::SpiLedStrip(uint16_t num_leds) {
   this->num_leds_ = num_leds;
   RAMAllocator<uint8_t> allocator;
-  this->buffer_size_ = num_leds * 4 + 8;
+  // The data is delayed by half a clock in every LED, so the end frame needs at least num_leds / 2 more clocks to
+  // reach the last LED. 4 bytes were only enough for 64 LEDs.
+  this->buffer_size_ = 4 + num_leds * 4 + std::max<size_t>(4, (num_leds + 15) / 16);
   this->buf_ = allocator.allocate(this->buffer_size_);
   if (this->buf_ == nullptr) {
     ESP_LOGE(TAG, "Failed to allocate buffer of size %u", this->buffer_size_);
@@ -27,6 +31,10 @@ void SpiLedStrip::setup() {
     return;
   }
   this->spi_setup();
+#ifdef USE_ESP32
+  if (this->async_write_)
+    this->start_write_task_();
+#endif
 }
 light::LightTraits SpiLedStrip::get_traits() {
   auto traits = light::LightTraits();
@@ -41,10 +49,15 @@ void SpiLedStrip::dump_config() {
   } else {
     esph_log_config(TAG, "  Data rate: %ukHz", (unsigned) (this->data_rate_ / 1000));
   }
+#ifdef USE_ESP32
+  esph_log_config(TAG, "  Async write: %s", YESNO(this->write_task_ != nullptr));
+#endif
 }
 void SpiLedStrip::write_state(light::LightState *state) {
   if (this->is_failed())
     return;
+  if (!this->frame_changed_())
+    return;
   if (ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE) {
     char strbuf[49];
     size_t len = std::min(this->buffer_size_, (size_t) (sizeof(strbuf) - 1) / 3);
@@ -54,14 +67,72 @@ void SpiLedStrip::write_state(light::LightState *state) {
     }
     esph_log_v(TAG, "write_state: buf = %s", strbuf);
   }
+#ifdef USE_ESP32
+  if (this->write_task_ != nullptr) {
+    if (!this->write_done_) {
+      // The previous frame is still being sent. Skip this one instead of blocking the loop, the latest buffer goes
+      // out once the task is done.
+      this->invalidate_frame_();
+      this->set_timeout("write", 1, [this]() { this->write_state(nullptr); });
+      return;
+    }
+    memcpy(this->send_buf_, this->buf_, this->buffer_size_);
+    this->write_done_ = false;
+    xTaskNotifyGive(this->write_task_);
+    return;
+  }
+#endif
   this->enable();
   this->write_array(this->buf_, this->buffer_size_);
   this->disable();
 }
+#ifdef USE_ESP32
+void SpiLedStrip::start_write_task_() {
+  // Internal memory is DMA capable, so the SPI driver can send from it without a bounce buffer
+  RAMAllocator<uint8_t> allocator(RAMAllocator<uint8_t>::ALLOC_INTERNAL);
+  this->send_buf_ = allocator.allocate(this->buffer_size_);
+  if (this->send_buf_ == nullptr) {
+    ESP_LOGW(TAG, "Could not allocate the send buffer for async write, writing in the main loop");
+    return;
+  }
+  // On the other core where there is one, otherwise below the loop task so it only uses time the loop leaves idle
+  xTaskCreatePinnedToCore(write_task, "spi_led_strip", 2048, this, portNUM_PROCESSORS > 1 ? 1 : tskIDLE_PRIORITY,
+                          &this->write_task_, portNUM_PROCESSORS > 1 ? 0 : tskNO_AFFINITY);
+  if (this->write_task_ == nullptr) {
+    ESP_LOGW(TAG, "Could not start the write task, writing in the main loop");
+    allocator.deallocate(this->send_buf_, this->buffer_size_);
+    this->send_buf_ = nullptr;
+  }
+}
+
+void SpiLedStrip::write_task(void *arg) {
+  auto *this_strip = static_cast<SpiLedStrip *>(arg);
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    const uint32_t start = micros();
+    this_strip->enable();
+    this_strip->write_array(this_strip->send_buf_, this_strip->buffer_size_);
+    this_strip->disable();
+    ESP_LOGVV(TAG, "Async write of %zu bytes took %" PRIu32 "us", this_strip->buffer_size_, micros() - start);
+    this_strip->write_done_ = true;
+  }
+}
+#endif
+
 light::ESPColorView SpiLedStrip::get_view_internal(int32_t index) const {
   size_t pos = index * 4 + 5;
   return {this->buf_ + pos + 2,       this->buf_ + pos + 1, this->buf_ + pos + 0, nullptr,
           this->effect_data_ + index, &this->correction_};
 }
+light::ESPBufferLayout SpiLedStrip::get_buffer_layout_() const {
+  // Each LED is a 0xFF brightness byte followed by blue, green and red, after the 4 byte start frame
+  light::ESPBufferLayout layout;
+  layout.buffer = this->buf_ + 5;
+  layout.stride = 4;
+  layout.red = 2;
+  layout.green = 1;
+  layout.blue = 0;
+  return layout;
+}
 }  // namespace spi_led_strip
 }  // namespace esphome
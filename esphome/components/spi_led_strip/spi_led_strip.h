@@ -5,6 +5,12 @@
 #include "esphome/components/light/addressable_light.h"
 #include "esphome/components/spi/spi.h"
 
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+#endif
+
 namespace esphome {
 namespace spi_led_strip {
 
@@ -27,13 +33,27 @@ class SpiLedStrip : public light::AddressableLight,
 
   void clear_effect_data() override { memset(this->effect_data_, 0, this->num_leds_ * sizeof(this->effect_data_[0])); }
 
+  /// Send frames from a background task instead of blocking the main loop, needs an SPI bus of its own.
+  void set_async_write(bool async_write) { this->async_write_ = async_write; }
+
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override;
+  light::ESPBufferLayout get_buffer_layout_() const override;
 
   size_t buffer_size_{};
   uint8_t *effect_data_{nullptr};
   uint8_t *buf_{nullptr};
   uint16_t num_leds_;
+  bool async_write_{false};
+#ifdef USE_ESP32
+  void start_write_task_();
+  static void write_task(void *arg);
+
+  // The write task owns send_buf_ while write_done_ is false
+  uint8_t *send_buf_{nullptr};
+  TaskHandle_t write_task_{nullptr};
+  std::atomic<bool> write_done_{true};
+#endif
 };
 
 }  // namespace spi_led_strip
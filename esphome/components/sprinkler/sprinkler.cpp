@@ -391,17 +391,22 @@ SprinklerValveOperator *SprinklerValveRunRequest::valve_operator() { return this
 SprinklerValveRunRequestOrigin SprinklerValveRunRequest::request_is_from() { return this->origin_; }
 
 Sprinkler::Sprinkler() {}
-Sprinkler::Sprinkler(const std::string &name) {
-  // The `name` is needed to set timers up, hence non-default constructor
-  // replaces `set_name()` method previously existed
-  this->name_ = name;
-  this->timer_.push_back({this->name_ + "sm", false, 0, 0, std::bind(&Sprinkler::sm_timer_callback_, this)});
-  this->timer_.push_back({this->name_ + "vs", false, 0, 0, std::bind(&Sprinkler::valve_selection_callback_, this)});
-}
+Sprinkler::Sprinkler(const std::string &name) : name_(name) {}
 
 void Sprinkler::setup() { this->all_valves_off_(true); }
 
 void Sprinkler::loop() {
+  const uint32_t now = millis();
+  for (auto &timer : this->timer_) {
+    if (timer.active && now - timer.start_time >= timer.time) {
+      // A timer restarted by the callback continues from the planned expiry instead of now, so the loop latency of
+      //  every valve doesn't add up over a long cycle
+      this->timer_origin_ = timer.start_time + timer.time;
+      timer.active = false;
+      (this->*timer.func)();
+      this->timer_origin_.reset();
+    }
+  }
   for (auto &p : this->pump_) {
     p.loop();
   }
@@ -1386,23 +1391,20 @@ void Sprinkler::load_next_valve_run_request_(const optional<size_t> first_valve)
       this->next_req_.reset();
     }
   } else if (this->auto_advance() && this->multiplier()) {
-    if (this->next_valve_number_in_cycle_(first_valve).has_value()) {
-      // if there is another valve to run as a part of a cycle, load that
-      this->next_req_.set_valve(this->next_valve_number_in_cycle_(first_valve).value_or(0));
-      this->next_req_.set_request_from(CYCLE);
-      this->next_req_.set_run_duration(
-          this->valve_run_duration_adjusted(this->next_valve_number_in_cycle_(first_valve).value_or(0)));
-    } else if ((this->repeat_count_++ < this->repeat().value_or(0))) {
+    // each lookup scans the valves, so do it once
+    auto next_valve = this->next_valve_number_in_cycle_(first_valve);
+    if (!next_valve.has_value() && (this->repeat_count_++ < this->repeat().value_or(0))) {
       ESP_LOGD(TAG, "Repeating - starting cycle %" PRIu32 " of %" PRIu32, this->repeat_count_ + 1,
                this->repeat().value_or(0) + 1);
       // if there are repeats remaining and no more valves were left in the cycle, start a new cycle
       this->prep_full_cycle_();
-      if (this->next_valve_number_in_cycle_().has_value()) {  // this should always succeed here, but just in case...
-        this->next_req_.set_valve(this->next_valve_number_in_cycle_().value_or(0));
-        this->next_req_.set_request_from(CYCLE);
-        this->next_req_.set_run_duration(
-            this->valve_run_duration_adjusted(this->next_valve_number_in_cycle_().value_or(0)));
-      }
+      next_valve = this->next_valve_number_in_cycle_();  // this should always succeed here, but just in case...
+    }
+    if (next_valve.has_value()) {
+      // if there is another valve to run as a part of a cycle, load that
+      this->next_req_.set_valve(next_valve.value());
+      this->next_req_.set_request_from(CYCLE);
+      this->next_req_.set_run_duration(this->valve_run_duration_adjusted(next_valve.value()));
     }
   }
 }
@@ -1645,9 +1647,7 @@ std::string Sprinkler::state_as_str_(SprinklerState state) {
 
 void Sprinkler::start_timer_(const SprinklerTimerIndex timer_index) {
   if (this->timer_duration_(timer_index) > 0) {
-    this->set_timeout(this->timer_[timer_index].name, this->timer_duration_(timer_index),
-                      this->timer_cbf_(timer_index));
-    this->timer_[timer_index].start_time = millis();
+    this->timer_[timer_index].start_time = this->timer_origin_.value_or(millis());
     this->timer_[timer_index].active = true;
   }
   ESP_LOGVV(TAG, "Timer %zu started for %" PRIu32 " sec", static_cast<size_t>(timer_index),
@@ -1655,8 +1655,9 @@ void Sprinkler::start_timer_(const SprinklerTimerIndex timer_index) {
 }
 
 bool Sprinkler::cancel_timer_(const SprinklerTimerIndex timer_index) {
+  auto ret = this->timer_[timer_index].active;
   this->timer_[timer_index].active = false;
-  return this->cancel_timeout(this->timer_[timer_index].name);
+  return ret;
 }
 
 bool Sprinkler::timer_active_(const SprinklerTimerIndex timer_index) { return this->timer_[timer_index].active; }
@@ -1667,10 +1668,6 @@ void Sprinkler::set_timer_duration_(const SprinklerTimerIndex timer_index, const
 
 uint32_t Sprinkler::timer_duration_(const SprinklerTimerIndex timer_index) { return this->timer_[timer_index].time; }
 
-std::function<void()> Sprinkler::timer_cbf_(const SprinklerTimerIndex timer_index) {
-  return this->timer_[timer_index].func;
-}
-
 void Sprinkler::valve_selection_callback_() {
   this->timer_[sprinkler::TIMER_VALVE_SELECTION].active = false;
   ESP_LOGVV(TAG, "Valve selection timer expired");
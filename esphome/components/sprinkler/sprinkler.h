@@ -6,6 +6,7 @@
 #include "esphome/components/number/number.h"
 #include "esphome/components/switch/switch.h"
 
+#include <array>
 #include <vector>
 
 namespace esphome {
@@ -78,11 +79,10 @@ struct SprinklerQueueItem {
 };
 
 struct SprinklerTimer {
-  const std::string name;
   bool active;
   uint32_t time;
   uint32_t start_time;
-  std::function<void()> func;
+  void (Sprinkler::*func)();
 };
 
 struct SprinklerValve {
@@ -505,7 +505,6 @@ class Sprinkler : public Component {
   void set_timer_duration_(SprinklerTimerIndex timer_index, uint32_t time);
   /// returns time in milliseconds (ms)
   uint32_t timer_duration_(SprinklerTimerIndex timer_index);
-  std::function<void()> timer_cbf_(SprinklerTimerIndex timer_index);
 
   /// callback functions for timers
   void valve_selection_callback_();
@@ -581,8 +580,14 @@ class Sprinkler : public Component {
   /// Sprinkler valve operator objects
   std::vector<SprinklerValveOperator> valve_op_{2};
 
-  /// Valve control timers
-  std::vector<SprinklerTimer> timer_{};
+  /// Valve control timers, in the order of SprinklerTimerIndex; checked in loop()
+  std::array<SprinklerTimer, 2> timer_{{
+      {false, 0, 0, &Sprinkler::sm_timer_callback_},
+      {false, 0, 0, &Sprinkler::valve_selection_callback_},
+  }};
+
+  /// Planned expiry of the timer whose callback is running, timers started from it count from there
+  optional<uint32_t> timer_origin_;
 
   /// Other Sprinkler instances we should be aware of (used to check if pumps are in use)
   std::vector<Sprinkler *> other_controllers_;
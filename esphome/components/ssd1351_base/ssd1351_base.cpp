@@ -10,6 +10,7 @@ static const char *const TAG = "ssd1351";
 static const uint16_t SSD1351_COLORMASK = 0xffff;
 static const uint8_t SSD1351_MAX_CONTRAST = 15;
 static const uint8_t SSD1351_BYTESPERPIXEL = 2;
+static const uint32_t SSD1351_RECT_OVERHEAD_ROWS = 27;
 // SSD1351 commands
 static const uint8_t SSD1351_SETCOLUMN = 0x15;
 static const uint8_t SSD1351_SETROW = 0x75;
@@ -85,19 +86,31 @@ void SSD1351::setup() {
   this->data(0x80);
   this->data(0xC8);
   set_brightness(this->brightness_);
+  // Setting the address window takes seven commands and data bytes that each wait 1 ms, about as long as sending 27
+  // rows at 8 MHz
+  this->dirty_region_.set_rect_overhead(SSD1351_RECT_OVERHEAD_ROWS);
   this->fill(Color::BLACK);  // clear display - ensures we do not see garbage at power-on
   this->display();           // ...write buffer, which actually clears the display's memory
   this->turn_on();           // display ON
 }
 void SSD1351::display() {
-  this->command(SSD1351_SETCOLUMN);  // set column address
-  this->data(0x00);                  // set column start address
-  this->data(0x7F);                  // set column end address
-  this->command(SSD1351_SETROW);     // set row address
-  this->data(0x00);                  // set row start address
-  this->data(0x7F);                  // set last row
-  this->command(SSD1351_WRITERAM);
-  this->write_display_data();
+  const size_t row_bytes = size_t(this->get_width_internal()) * size_t(SSD1351_BYTESPERPIXEL);
+  const uint32_t start = micros();
+  size_t bytes_sent = 0;
+  for (const display::Rect &rect : this->dirty_region_) {
+    // Full rows are contiguous in the buffer, so every change is sent as the rows it spans
+    this->command(SSD1351_SETCOLUMN);  // set column address
+    this->data(0x00);                  // set column start address
+    this->data(0x7F);                  // set column end address
+    this->command(SSD1351_SETROW);     // set row address
+    this->data(rect.y);                // set row start address
+    this->data(rect.y2() - 1);         // set last row
+    this->command(SSD1351_WRITERAM);
+    this->write_display_data(this->buffer_ + rect.y * row_bytes, rect.h * row_bytes);
+    bytes_sent += rect.h * row_bytes;
+  }
+  this->record_transfer_(micros() - start, bytes_sent);
+  this->dirty_region_.flushed(bytes_sent);
 }
 void SSD1351::update() {
   this->do_update_();
@@ -156,11 +169,17 @@ void HOT SSD1351::draw_absolute_pixel_internal(int x, int y, Color color) {
   const uint32_t color565 = display::ColorUtil::color_to_565(color);
   // where should the bits go in the big buffer array? math...
   uint16_t pos = (x + y * this->get_width_internal()) * SSD1351_BYTESPERPIXEL;
-  this->buffer_[pos++] = (color565 >> 8) & 0xff;
-  this->buffer_[pos] = color565 & 0xff;
+  const uint8_t high = (color565 >> 8) & 0xff;
+  const uint8_t low = color565 & 0xff;
+  if ((this->buffer_[pos] == high) && (this->buffer_[pos + 1] == low))
+    return;
+  this->buffer_[pos++] = high;
+  this->buffer_[pos] = low;
+  this->dirty_region_.add(0, y);
 }
 void SSD1351::fill(Color color) {
   const uint32_t color565 = display::ColorUtil::color_to_565(color);
+  this->dirty_region_.add_all(1, this->get_height_internal());
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++) {
     if (i & 1) {
       this->buffer_[i] = color565 & 0xff;
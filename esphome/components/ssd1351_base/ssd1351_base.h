@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/hal.h"
 #include "esphome/components/display/display_buffer.h"
+#include "esphome/components/display/dirty_region.h"
 
 namespace esphome {
 namespace ssd1351_base {
@@ -33,10 +34,13 @@ class SSD1351 : public display::DisplayBuffer {
 
   display::DisplayType get_display_type() override { return display::DisplayType::DISPLAY_TYPE_COLOR; }
 
+  /// Bytes of pixel data sent to the panel by the last update
+  uint32_t get_last_update_bytes() const { return this->dirty_region_.get_last_bytes_sent(); }
+
  protected:
   virtual void command(uint8_t value) = 0;
   virtual void data(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  virtual void write_display_data(const uint8_t *data, size_t length) = 0;
   void init_reset_();
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
@@ -50,6 +54,9 @@ class SSD1351 : public display::DisplayBuffer {
   GPIOPin *reset_pin_{nullptr};
   bool is_on_{false};
   float brightness_{1.0};
+
+  // Tracks changed rows only, each as a one pixel wide rectangle at x = 0
+  display::DirtyRegion dirty_region_;
 };
 
 }  // namespace ssd1351_base
@@ -1,6 +1,8 @@
 #include "st7789v.h"
 #include "esphome/core/log.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace st7789v {
 
@@ -117,6 +119,7 @@ void ST7789V::setup() {
   backlight_(true);
 
   this->init_internal_(this->get_buffer_length_());
+  // Matches the cleared display, so only pixels drawn from here on need writing
   memset(this->buffer_, 0x00, this->get_buffer_length_());
 }
 
@@ -152,12 +155,29 @@ void ST7789V::update() {
 void ST7789V::set_model_str(const char *model_str) { this->model_str_ = model_str; }
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = this->offset_height_;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = this->offset_width_;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  if (this->dirty_region_.empty()) {
+    this->dirty_region_.flushed(0);
+    return;
+  }
 
+  const uint32_t start = micros();
+  size_t bytes_sent = 0;
   this->enable();
+  for (const display::Rect &rect : this->dirty_region_) {
+    bytes_sent += this->write_rect_(rect);
+  }
+  this->disable();
+  this->record_transfer_(micros() - start, bytes_sent);
+
+  ESP_LOGV(TAG, "Wrote %zu bytes in %zu rectangles", bytes_sent, this->dirty_region_.size());
+  this->dirty_region_.flushed(bytes_sent);
+}
+
+size_t ST7789V::write_rect_(const display::Rect &rect) {
+  uint16_t x1 = this->offset_height_ + rect.x;
+  uint16_t x2 = this->offset_height_ + rect.x2() - 1;
+  uint16_t y1 = this->offset_width_ + rect.y;
+  uint16_t y2 = this->offset_width_ + rect.y2() - 1;
 
   // set column(x) address
   this->dc_pin_->digital_write(false);
@@ -174,11 +194,12 @@ void ST7789V::write_display_data() {
   this->write_byte(ST7789_RAMWR);
   this->dc_pin_->digital_write(true);
 
+  const size_t width = this->get_width_internal();
   if (this->eightbitcolor_) {
     uint8_t temp_buffer[TEMP_BUFFER_SIZE];
     size_t temp_index = 0;
-    for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
+    for (size_t line = rect.y * width; line < rect.y2() * width; line = line + width) {
+      for (size_t index = rect.x; index < rect.x2(); ++index) {
         auto color = display::ColorUtil::color_to_565(
             display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
                                          display::ColorBitness::COLOR_BITNESS_332, true));
@@ -192,11 +213,16 @@ void ST7789V::write_display_data() {
     }
     if (temp_index != 0)
       this->write_array(temp_buffer, temp_index);
+  } else if (rect.w == width) {
+    // Full rows are contiguous in the buffer
+    this->write_array(this->buffer_ + rect.y * width * 2, rect.h * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    for (size_t line = rect.y; line < rect.y2(); ++line) {
+      this->write_array(this->buffer_ + (line * width + rect.x) * 2, rect.w * 2);
+    }
   }
 
-  this->disable();
+  return static_cast<size_t>(rect.w) * rect.h * 2;
 }
 
 void ST7789V::init_reset_() {
@@ -299,13 +325,75 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (this->eightbitcolor_) {
     auto color332 = display::ColorUtil::color_to_332(color);
     uint32_t pos = (x + y * this->get_width_internal());
+    if (this->buffer_[pos] == color332)
+      return;
     this->buffer_[pos] = color332;
   } else {
     auto color565 = display::ColorUtil::color_to_565(color);
     uint32_t pos = (x + y * this->get_width_internal()) * 2;
-    this->buffer_[pos++] = (color565 >> 8) & 0xff;
-    this->buffer_[pos] = color565 & 0xff;
+    const uint8_t high = (color565 >> 8) & 0xff;
+    const uint8_t low = color565 & 0xff;
+    if ((this->buffer_[pos] == high) && (this->buffer_[pos + 1] == low))
+      return;
+    this->buffer_[pos++] = high;
+    this->buffer_[pos] = low;
+  }
+  this->dirty_region_.add(x, y);
+}
+
+void HOT ST7789V::fill_absolute_rect_internal(int x_start, int y_start, int w, int h, Color color) {
+  const int width = this->get_width_internal();
+  bool updated = false;
+  if (this->eightbitcolor_) {
+    const uint8_t color332 = display::ColorUtil::color_to_332(color);
+    for (int y = y_start; y < y_start + h; y++) {
+      uint8_t *pos = this->buffer_ + y * width + x_start;
+      for (int x = 0; x < w; x++, pos++) {
+        if (*pos != color332) {
+          *pos = color332;
+          updated = true;
+        }
+      }
+    }
+  } else {
+    const uint16_t color565 = display::ColorUtil::color_to_565(color);
+    const uint8_t high = (color565 >> 8) & 0xff;
+    const uint8_t low = color565 & 0xff;
+    for (int y = y_start; y < y_start + h; y++) {
+      uint8_t *pos = this->buffer_ + (y * width + x_start) * 2;
+      for (int x = 0; x < w; x++, pos += 2) {
+        if ((pos[0] != high) || (pos[1] != low)) {
+          pos[0] = high;
+          pos[1] = low;
+          updated = true;
+        }
+      }
+    }
   }
+  if (updated)
+    this->dirty_region_.add(display::Rect(x_start, y_start, w, h));
+}
+
+void HOT ST7789V::draw_absolute_rgb565_internal(int x_start, int y_start, int w, int h, const uint8_t *ptr,
+                                                size_t stride, bool big_endian) {
+#ifndef USE_ESP8266
+  // The buffer holds big endian RGB565 like the source, so rows are copied as they are. On ESP8266 the source may be
+  // in flash, which needs aligned reads.
+  if (!this->eightbitcolor_ && big_endian) {
+    bool updated = false;
+    for (int y = 0; y != h; y++, ptr += stride) {
+      uint8_t *row = this->buffer_ + ((y_start + y) * this->get_width_internal() + x_start) * 2;
+      if (memcmp(row, ptr, w * 2) != 0) {
+        memcpy(row, ptr, w * 2);
+        updated = true;
+      }
+    }
+    if (updated)
+      this->dirty_region_.add(display::Rect(x_start, y_start, w, h));
+    return;
+  }
+#endif
+  display::DisplayBuffer::draw_absolute_rgb565_internal(x_start, y_start, w, h, ptr, stride, big_endian);
 }
 
 }  // namespace st7789v
@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/components/spi/spi.h"
 #include "esphome/components/display/display_buffer.h"
+#include "esphome/components/display/dirty_region.h"
 #ifdef USE_POWER_SUPPLY
 #include "esphome/components/power_supply/power_supply.h"
 #endif
@@ -132,8 +133,12 @@ class ST7789V : public display::DisplayBuffer,
   float get_setup_priority() const override;
   void update() override;
 
+  /// Writes the regions of the buffer that changed since the last write
   void write_display_data();
 
+  /// Bytes of pixel data sent to the panel by the last update
+  uint32_t get_last_update_bytes() const { return this->dirty_region_.get_last_bytes_sent(); }
+
   display::DisplayType get_display_type() override { return display::DisplayType::DISPLAY_TYPE_COLOR; }
 
  protected:
@@ -150,12 +155,15 @@ class ST7789V : public display::DisplayBuffer,
   uint16_t offset_height_{0};
   uint16_t offset_width_{0};
 
+  display::DirtyRegion dirty_region_;
+
   void init_reset_();
   void backlight_(bool onoff);
   void write_command_(uint8_t value);
   void write_data_(uint8_t value);
   void write_addr_(uint16_t addr1, uint16_t addr2);
   void write_color_(uint16_t color, uint16_t size);
+  size_t write_rect_(const display::Rect &rect);
 
   int get_height_internal() override { return this->height_; }
   int get_width_internal() override { return this->width_; }
@@ -164,6 +172,9 @@ class ST7789V : public display::DisplayBuffer,
   void draw_filled_rect_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x_start, int y_start, int w, int h, Color color) override;
+  void draw_absolute_rgb565_internal(int x_start, int y_start, int w, int h, const uint8_t *ptr, size_t stride,
+                                     bool big_endian) override;
 
   const char *model_str_;
 };
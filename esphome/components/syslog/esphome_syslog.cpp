@@ -23,7 +23,8 @@ void Syslog::setup() {
   logger::global_logger->add_on_log_callback(
       [this](int level, const char *tag, const char *message, size_t message_len) {
         this->log_(level, tag, message, message_len);
-      });
+      },
+      this->log_level_);
 }
 
 void Syslog::log_(const int level, const char *tag, const char *message, size_t message_len) const {
@@ -7,9 +7,10 @@ namespace text_sensor {
 static const char *const TAG = "text_sensor";
 
 void TextSensor::publish_state(const std::string &state) {
+  // Assigning reuses the capacity of the string, so a sensor whose state keeps its length doesn't allocate
   this->raw_state = state;
   if (this->raw_callback_) {
-    this->raw_callback_->call(state);
+    this->raw_callback_->call(this->raw_state);
   }
 
   ESP_LOGV(TAG, "'%s': Received new state %s", this->name_.c_str(), state.c_str());
@@ -17,7 +18,11 @@ void TextSensor::publish_state(const std::string &state) {
   if (this->filter_list_ == nullptr) {
     this->internal_send_state_to_frontend(state);
   } else {
-    this->filter_list_->input(state);
+#ifdef USE_ENTITY_STATS
+    this->stats_.raw_inputs++;
+#endif
+    // The filters work on this copy in place
+    this->filter_list_->input(std::string(state));
   }
 }
 
@@ -51,12 +56,12 @@ void TextSensor::clear_filters() {
   this->filter_list_ = nullptr;
 }
 
-void TextSensor::add_on_state_callback(std::function<void(std::string)> callback) {
+void TextSensor::add_on_state_callback(std::function<void(const std::string &)> callback) {
   this->callback_.add(std::move(callback));
 }
-void TextSensor::add_on_raw_state_callback(std::function<void(std::string)> callback) {
+void TextSensor::add_on_raw_state_callback(std::function<void(const std::string &)> callback) {
   if (!this->raw_callback_) {
-    this->raw_callback_ = make_unique<CallbackManager<void(std::string)>>();
+    this->raw_callback_ = make_unique<CallbackManager<void(const std::string &)>>();
   }
   this->raw_callback_->add(std::move(callback));
 }
@@ -52,9 +52,9 @@ class TextSensor : public EntityBase, public EntityBase_DeviceClass {
   /// Clear the entire filter chain.
   void clear_filters();
 
-  void add_on_state_callback(std::function<void(std::string)> callback);
+  void add_on_state_callback(std::function<void(const std::string &)> callback);
   /// Add a callback that will be called every time the sensor sends a raw value.
-  void add_on_raw_state_callback(std::function<void(std::string)> callback);
+  void add_on_raw_state_callback(std::function<void(const std::string &)> callback);
 
   std::string state;
   std::string raw_state;
@@ -65,9 +65,9 @@ class TextSensor : public EntityBase, public EntityBase_DeviceClass {
   void internal_send_state_to_frontend(const std::string &state);
 
  protected:
-  std::unique_ptr<CallbackManager<void(std::string)>>
-      raw_callback_;                             ///< Storage for raw state callbacks (lazy allocated).
-  CallbackManager<void(std::string)> callback_;  ///< Storage for filtered state callbacks.
+  std::unique_ptr<CallbackManager<void(const std::string &)>>
+      raw_callback_;                                     ///< Storage for raw state callbacks (lazy allocated).
+  CallbackManager<void(const std::string &)> callback_;  ///< Storage for filtered state callbacks.
 
   Filter *filter_list_{nullptr};  ///< Store all active filters.
 };
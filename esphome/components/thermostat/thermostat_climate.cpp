@@ -1,6 +1,9 @@
 #include "thermostat_climate.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace esphome {
 namespace thermostat {
 
@@ -17,6 +20,9 @@ void ThermostatClimate::setup() {
   }
   // add a callback so that whenever the sensor state changes we can take action
   this->sensor_->add_on_state_callback([this](float state) {
+    // Nothing depends on a repeated value, the timers re-evaluate the action when they expire
+    if (state == this->current_temperature || (std::isnan(state) && std::isnan(this->current_temperature)))
+      return;
     this->current_temperature = state;
     // required action may have changed, recompute, refresh, we'll publish_state() later
     this->switch_to_action_(this->compute_action_(), false);
@@ -29,6 +35,8 @@ void ThermostatClimate::setup() {
   // register for humidity values and get initial state
   if (this->humidity_sensor_ != nullptr) {
     this->humidity_sensor_->add_on_state_callback([this](float state) {
+      if (state == this->current_humidity || (std::isnan(state) && std::isnan(this->current_humidity)))
+        return;
       this->current_humidity = state;
       this->publish_state();
     });
@@ -60,15 +68,21 @@ void ThermostatClimate::setup() {
   this->switch_to_supplemental_action_(this->compute_supplemental_action_());
   this->setup_complete_ = true;
   this->publish_state();
+  this->update_next_timer_due_();
 }
 
 void ThermostatClimate::loop() {
+  const uint32_t now = millis();
+  // Only the timers need the loop, nothing to do before the earliest one expires
+  if (static_cast<int32_t>(now - this->next_timer_due_) < 0)
+    return;
   for (auto &timer : this->timer_) {
-    if (timer.active && (timer.started + timer.time < millis())) {
+    if (timer.active && now - timer.started >= timer.time) {
       timer.active = false;
-      timer.func();
+      (this->*timer.func)();
     }
   }
+  this->update_next_timer_due_();
 }
 
 float ThermostatClimate::cool_deadband() { return this->cooling_deadband_; }
@@ -767,7 +781,28 @@ void ThermostatClimate::start_timer_(const ThermostatClimateTimerIndex timer_ind
   if (this->timer_duration_(timer_index) > 0) {
     this->timer_[timer_index].started = millis();
     this->timer_[timer_index].active = true;
+    this->enable_loop();
+    this->update_next_timer_due_();
+  }
+}
+
+void ThermostatClimate::update_next_timer_due_() {
+  const uint32_t now = millis();
+  bool any_active = false;
+  uint32_t remaining = UINT32_MAX;
+  for (auto &timer : this->timer_) {
+    if (!timer.active)
+      continue;
+    any_active = true;
+    uint32_t elapsed = now - timer.started;
+    remaining = std::min(remaining, elapsed >= timer.time ? 0 : timer.time - elapsed);
+  }
+  if (!any_active) {
+    // A cancelled timer leaves the loop on until the next check, which is harmless
+    this->disable_loop();
+    return;
   }
+  this->next_timer_due_ = now + remaining;
 }
 
 bool ThermostatClimate::cancel_timer_(ThermostatClimateTimerIndex timer_index) {
@@ -784,10 +819,6 @@ uint32_t ThermostatClimate::timer_duration_(ThermostatClimateTimerIndex timer_in
   return this->timer_[timer_index].time;
 }
 
-std::function<void()> ThermostatClimate::timer_cbf_(ThermostatClimateTimerIndex timer_index) {
-  return this->timer_[timer_index].func;
-}
-
 void ThermostatClimate::cooling_max_run_time_timer_callback_() {
   ESP_LOGVV(TAG, "cooling_max_run_time timer expired");
   this->cooling_max_runtime_exceeded_ = true;
@@ -6,6 +6,7 @@
 #include "esphome/components/climate/climate.h"
 #include "esphome/components/sensor/sensor.h"
 
+#include <array>
 #include <cinttypes>
 #include <map>
 #include <vector>
@@ -31,11 +32,13 @@ enum OnBootRestoreFrom : uint8_t {
   DEFAULT_PRESET = 1,
 };
 
+class ThermostatClimate;
+
 struct ThermostatClimateTimer {
   bool active;
   uint32_t time;
   uint32_t started;
-  std::function<void()> func;
+  void (ThermostatClimate::*func)();
 };
 
 struct ThermostatClimateTargetTempConfig {
@@ -220,7 +223,8 @@ class ThermostatClimate : public climate::Climate, public Component {
   bool cancel_timer_(ThermostatClimateTimerIndex timer_index);
   bool timer_active_(ThermostatClimateTimerIndex timer_index);
   uint32_t timer_duration_(ThermostatClimateTimerIndex timer_index);
-  std::function<void()> timer_cbf_(ThermostatClimateTimerIndex timer_index);
+  /// Caches when the earliest active timer expires, turns the loop off while no timer is active
+  void update_next_timer_due_();
 
   /// set_timeout() callbacks for various actions (see above)
   void cooling_max_run_time_timer_callback_();
@@ -455,19 +459,21 @@ class ThermostatClimate : public climate::Climate, public Component {
   /// Default custom preset to use on start up
   std::string default_custom_preset_{};
 
-  /// Climate action timers
-  std::vector<ThermostatClimateTimer> timer_{
-      {false, 0, 0, std::bind(&ThermostatClimate::cooling_max_run_time_timer_callback_, this)},
-      {false, 0, 0, std::bind(&ThermostatClimate::cooling_off_timer_callback_, this)},
-      {false, 0, 0, std::bind(&ThermostatClimate::cooling_on_timer_callback_, this)},
-      {false, 0, 0, std::bind(&ThermostatClimate::fan_mode_timer_callback_, this)},
-      {false, 0, 0, std::bind(&ThermostatClimate::fanning_off_timer_callback_, this)},
-      {false, 0, 0, std::bind(&ThermostatClimate::fanning_on_timer_callback_, this)},
-      {false, 0, 0, std::bind(&ThermostatClimate::heating_max_run_time_timer_callback_, this)},
-      {false, 0, 0, std::bind(&ThermostatClimate::heating_off_timer_callback_, this)},
-      {false, 0, 0, std::bind(&ThermostatClimate::heating_on_timer_callback_, this)},
-      {false, 0, 0, std::bind(&ThermostatClimate::idle_on_timer_callback_, this)},
-  };
+  /// When the earliest active timer expires
+  uint32_t next_timer_due_{0};
+  /// Climate action timers, in the order of ThermostatClimateTimerIndex
+  std::array<ThermostatClimateTimer, 10> timer_{{
+      {false, 0, 0, &ThermostatClimate::cooling_max_run_time_timer_callback_},
+      {false, 0, 0, &ThermostatClimate::cooling_off_timer_callback_},
+      {false, 0, 0, &ThermostatClimate::cooling_on_timer_callback_},
+      {false, 0, 0, &ThermostatClimate::fan_mode_timer_callback_},
+      {false, 0, 0, &ThermostatClimate::fanning_off_timer_callback_},
+      {false, 0, 0, &ThermostatClimate::fanning_on_timer_callback_},
+      {false, 0, 0, &ThermostatClimate::heating_max_run_time_timer_callback_},
+      {false, 0, 0, &ThermostatClimate::heating_off_timer_callback_},
+      {false, 0, 0, &ThermostatClimate::heating_on_timer_callback_},
+      {false, 0, 0, &ThermostatClimate::idle_on_timer_callback_},
+  }};
 
   /// The set of standard preset configurations this thermostat supports (Eg. AWAY, ECO, etc)
   std::map<climate::ClimatePreset, ThermostatClimateTargetTempConfig> preset_config_{};
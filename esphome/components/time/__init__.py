@@ -26,7 +26,7 @@ from esphome.const import (
     CONF_TIMEZONE,
     CONF_TRIGGER_ID,
 )
-from esphome.core import CORE, coroutine_with_priority
+from esphome.core import CORE, ID, coroutine_with_priority
 
 _LOGGER = logging.getLogger(__name__)
 
@@ -35,7 +35,8 @@ IS_PLATFORM_COMPONENT = True
 
 time_ns = cg.esphome_ns.namespace("time")
 RealTimeClock = time_ns.class_("RealTimeClock", cg.PollingComponent)
-CronTrigger = time_ns.class_("CronTrigger", automation.Trigger.template(), cg.Component)
+CronTrigger = time_ns.class_("CronTrigger", automation.Trigger.template())
+CronScheduler = time_ns.class_("CronScheduler", cg.Component)
 SyncTrigger = time_ns.class_("SyncTrigger", automation.Trigger.template(), cg.Component)
 TimeHasTimeCondition = time_ns.class_("TimeHasTimeCondition", Condition)
 
@@ -305,13 +306,29 @@ TIME_SCHEMA = cv.Schema(
 ).extend(cv.polling_component_schema("15min"))
 
 
+KEY_CRON_SCHEDULER = "time_cron_scheduler"
+
+
+async def get_cron_scheduler():
+    """Return the component that runs the timeout of all cron triggers."""
+    if (scheduler := CORE.data.get(KEY_CRON_SCHEDULER)) is None:
+        scheduler = cg.new_Pvariable(
+            ID(KEY_CRON_SCHEDULER, is_declaration=True, type=CronScheduler)
+        )
+        CORE.data[KEY_CRON_SCHEDULER] = scheduler
+        await cg.register_component(scheduler, {})
+    return scheduler
+
+
 async def setup_time_core_(time_var, config):
     if timezone := config.get(CONF_TIMEZONE):
         cg.add(time_var.set_timezone(timezone))
         cg.add_define("USE_TIME_TIMEZONE")
 
     for conf in config.get(CONF_ON_TIME, []):
-        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], time_var)
+        trigger = cg.new_Pvariable(
+            conf[CONF_TRIGGER_ID], time_var, await get_cron_scheduler()
+        )
 
         seconds = conf.get(CONF_SECONDS, list(range(0, 61)))
         cg.add(trigger.add_seconds(seconds))
@@ -326,7 +343,6 @@ async def setup_time_core_(time_var, config):
         days_of_week = conf.get(CONF_DAYS_OF_WEEK, list(range(1, 8)))
         cg.add(trigger.add_days_of_week(days_of_week))
 
-        await cg.register_component(trigger, conf)
         await automation.build_automation(trigger, [], conf)
 
     for conf in config.get(CONF_ON_TIME_SYNC, []):
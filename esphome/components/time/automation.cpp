@@ -2,6 +2,7 @@
 
 #include "esphome/core/log.h"
 
+#include <algorithm>
 #include <cinttypes>
 
 namespace esphome {
@@ -10,6 +11,8 @@ namespace time {
 static const char *const TAG = "automation";
 static const int MAX_TIMESTAMP_DRIFT = 900;  // how far can the clock drift before we consider
                                              // there has been a drastic time synchronization
+static const time_t MAX_SEARCH_SECONDS = 1462 * 86400;  // give up on finding a match after four years
+static const char *const TIMEOUT_NAME = "cron";
 
 void CronTrigger::add_second(uint8_t second) { this->seconds_[second] = true; }
 void CronTrigger::add_minute(uint8_t minute) { this->minutes_[minute] = true; }
@@ -21,47 +24,54 @@ bool CronTrigger::matches(const ESPTime &time) {
   return time.is_valid() && this->seconds_[time.second] && this->minutes_[time.minute] && this->hours_[time.hour] &&
          this->days_of_month_[time.day_of_month] && this->months_[time.month] && this->days_of_week_[time.day_of_week];
 }
-void CronTrigger::loop() {
-  ESPTime time = this->rtc_->now();
-  if (!time.is_valid())
-    return;
 
-  if (this->last_check_.has_value()) {
-    if (*this->last_check_ > time && this->last_check_->timestamp - time.timestamp > MAX_TIMESTAMP_DRIFT) {
-      // We went back in time (a lot), probably caused by time synchronization
-      ESP_LOGW(TAG, "Time has jumped back!");
-    } else if (*this->last_check_ >= time) {
-      // already handled this one
-      return;
-    } else if (time > *this->last_check_ && time.timestamp - this->last_check_->timestamp > MAX_TIMESTAMP_DRIFT) {
-      // We went ahead in time (a lot), probably caused by time synchronization
-      ESP_LOGW(TAG, "Time has jumped ahead!");
-      this->last_check_ = time;
-      return;
-    }
+/// Returns the first set bit at or after start, or end if there is none.
+template<size_t N> static int next_bit(const std::bitset<N> &bits, int start, int end) {
+  while (start < end && !bits[start])
+    start++;
+  return start;
+}
 
-    while (true) {
-      this->last_check_->increment_second();
-      if (*this->last_check_ >= time)
-        break;
+/// The timestamp of the given local time, at least one second after timestamp.
+static time_t advance_local(ESPTime &time, time_t timestamp) {
+  // mktime normalizes the overflowing fields and picks the right DST offset
+  time.recalc_timestamp_local();
+  return std::max<time_t>(time.timestamp, timestamp + 1);
+}
 
-      if (this->matches(*this->last_check_))
-        this->trigger();
+time_t CronTrigger::next_match_(time_t after) const {
+  // Skip whole months, days, hours and minutes that can't match instead of testing every second
+  time_t timestamp = after + 1;
+  const time_t end = timestamp + MAX_SEARCH_SECONDS;
+  while (timestamp < end) {
+    ESPTime time = ESPTime::from_epoch_local(timestamp);
+    if (!this->months_[time.month]) {
+      time.month++;
+      time.day_of_month = 1;
+      time.hour = time.minute = time.second = 0;
+      timestamp = advance_local(time, timestamp);
+    } else if (!this->days_of_month_[time.day_of_month] || !this->days_of_week_[time.day_of_week]) {
+      time.day_of_month++;
+      time.hour = time.minute = time.second = 0;
+      timestamp = advance_local(time, timestamp);
+    } else if (!this->hours_[time.hour]) {
+      // DST changes on hour boundaries, so stepping in real time lands on the next local hour
+      timestamp += 3600 - time.minute * 60 - time.second;
+    } else if (!this->minutes_[time.minute]) {
+      int minute = next_bit(this->minutes_, time.minute, 60);
+      timestamp += (minute - time.minute) * 60 - time.second;
+    } else {
+      // The epoch time has no leap seconds, second 60 never matches
+      int second = next_bit(this->seconds_, time.second, 60);
+      if (second == time.second)
+        return timestamp;
+      timestamp += second - time.second;
     }
   }
-
-  this->last_check_ = time;
-  if (!time.fields_in_range()) {
-    ESP_LOGW(TAG, "Time is out of range!");
-    ESP_LOGD(TAG, "Second=%02u Minute=%02u Hour=%02u DayOfWeek=%u DayOfMonth=%u DayOfYear=%u Month=%u time=%" PRId64,
-             time.second, time.minute, time.hour, time.day_of_week, time.day_of_month, time.day_of_year, time.month,
-             (int64_t) time.timestamp);
-  }
-
-  if (this->matches(time))
-    this->trigger();
+  return 0;
 }
-CronTrigger::CronTrigger(RealTimeClock *rtc) : rtc_(rtc) {}
+
+CronTrigger::CronTrigger(RealTimeClock *rtc, CronScheduler *scheduler) : rtc_(rtc) { scheduler->add_(this); }
 void CronTrigger::add_seconds(const std::vector<uint8_t> &seconds) {
   for (uint8_t it : seconds)
     this->add_second(it);
@@ -86,7 +96,66 @@ void CronTrigger::add_days_of_week(const std::vector<uint8_t> &days_of_week) {
   for (uint8_t it : days_of_week)
     this->add_day_of_week(it);
 }
-float CronTrigger::get_setup_priority() const { return setup_priority::HARDWARE; }
+
+void CronScheduler::add_(CronTrigger *trigger) {
+  this->triggers_.push_back(trigger);
+  if (std::find(this->clocks_.begin(), this->clocks_.end(), trigger->rtc_) != this->clocks_.end())
+    return;
+  this->clocks_.push_back(trigger->rtc_);
+  trigger->rtc_->add_on_time_sync_callback([this]() { this->on_time_sync_(); });
+}
+
+void CronScheduler::setup() { this->run_(); }
+
+void CronScheduler::on_time_sync_() {
+  // The timezone may have changed too, start over from the last check so small jumps ahead still fire what they skip
+  if (this->last_check_ != 0) {
+    for (auto *trigger : this->triggers_)
+      trigger->next_ = trigger->next_match_(this->last_check_);
+  }
+  this->run_();
+}
+
+void CronScheduler::run_() {
+  // Every RealTimeClock sets the system clock, so all triggers share it
+  ESPTime now = ESPTime::from_epoch_local(::time(nullptr));
+  if (!now.is_valid()) {
+    this->set_timeout(TIMEOUT_NAME, 1000, [this]() { this->run_(); });
+    return;
+  }
+
+  bool jumped_back = this->last_check_ != 0 && this->last_check_ - now.timestamp > MAX_TIMESTAMP_DRIFT;
+  if (jumped_back) {
+    // We went back in time (a lot), probably caused by time synchronization
+    ESP_LOGW(TAG, "Time has jumped back!");
+  }
+  bool jumped_ahead = false;
+  for (auto *trigger : this->triggers_) {
+    if (this->last_check_ == 0 || jumped_back) {
+      trigger->next_ = trigger->next_match_(now.timestamp - 1);
+    } else if (trigger->next_ != 0 && now.timestamp - trigger->next_ > MAX_TIMESTAMP_DRIFT) {
+      // We went ahead in time (a lot), probably caused by time synchronization
+      jumped_ahead = true;
+      trigger->next_ = trigger->next_match_(now.timestamp);
+    }
+    while (trigger->next_ != 0 && trigger->next_ <= now.timestamp) {
+      trigger->trigger();
+      trigger->next_ = trigger->next_match_(trigger->next_);
+    }
+  }
+  if (jumped_ahead)
+    ESP_LOGW(TAG, "Time has jumped ahead!");
+  this->last_check_ = now.timestamp;
+
+  // Wake up at least every MAX_TIMESTAMP_DRIFT, so a clock change that isn't announced as a sync is still noticed
+  time_t next = now.timestamp + MAX_TIMESTAMP_DRIFT;
+  for (auto *trigger : this->triggers_) {
+    if (trigger->next_ != 0)
+      next = std::min(next, trigger->next_);
+  }
+  time_t delay = std::max<time_t>(next - ::time(nullptr), 0);
+  this->set_timeout(TIMEOUT_NAME, delay * 1000, [this]() { this->run_(); });
+}
 
 SyncTrigger::SyncTrigger(RealTimeClock *rtc) : rtc_(rtc) {
   rtc->add_on_time_sync_callback([this]() { this->trigger(); });
@@ -11,9 +11,16 @@
 namespace esphome {
 namespace time {
 
-class CronTrigger : public Trigger<>, public Component {
+class CronScheduler;
+
+/** Fires whenever the local time matches all of its fields.
+ *
+ * The trigger doesn't poll the time. It computes the timestamp of its next match and the shared CronScheduler runs it
+ * from a single timeout armed for the earliest match of all triggers.
+ */
+class CronTrigger : public Trigger<> {
  public:
-  explicit CronTrigger(RealTimeClock *rtc);
+  CronTrigger(RealTimeClock *rtc, CronScheduler *scheduler);
   void add_second(uint8_t second);
   void add_seconds(const std::vector<uint8_t> &seconds);
   void add_minute(uint8_t minute);
@@ -27,10 +34,13 @@ class CronTrigger : public Trigger<>, public Component {
   void add_day_of_week(uint8_t day_of_week);
   void add_days_of_week(const std::vector<uint8_t> &days_of_week);
   bool matches(const ESPTime &time);
-  void loop() override;
-  float get_setup_priority() const override;
 
  protected:
+  friend CronScheduler;
+
+  /// The first timestamp after the given one that matches, 0 if there is none in the next few years.
+  time_t next_match_(time_t after) const;
+
   std::bitset<61> seconds_;
   std::bitset<60> minutes_;
   std::bitset<24> hours_;
@@ -38,7 +48,28 @@ class CronTrigger : public Trigger<>, public Component {
   std::bitset<13> months_;
   std::bitset<8> days_of_week_;
   RealTimeClock *rtc_;
-  optional<ESPTime> last_check_;
+  /// Timestamp of the next match, 0 if there is none.
+  time_t next_{0};
+};
+
+/// Runs all CronTriggers from one scheduler timeout, recomputing their next match only when the time is synchronized.
+class CronScheduler : public Component {
+ public:
+  void setup() override;
+  float get_setup_priority() const override { return setup_priority::HARDWARE; }
+
+ protected:
+  friend CronTrigger;
+
+  void add_(CronTrigger *trigger);
+  void on_time_sync_();
+  /// Fires the triggers that are due and arms the timeout for the next match.
+  void run_();
+
+  std::vector<CronTrigger *> triggers_;
+  std::vector<RealTimeClock *> clocks_;
+  /// Time of the previous run, 0 until the time was valid once.
+  time_t last_check_{0};
 };
 
 class SyncTrigger : public Trigger<>, public Component {
@@ -107,7 +107,7 @@ void TLC59208FOutput::setup() {
   }
   delayMicroseconds(500);
 
-  this->loop();
+  this->flush_();
 }
 
 void TLC59208FOutput::dump_config() {
@@ -122,29 +122,39 @@ void TLC59208FOutput::dump_config() {
 }
 
 void TLC59208FOutput::loop() {
-  if (this->min_channel_ == 0xFF || !this->update_)
+  if (!this->pwm_amounts_.is_dirty()) {
+    this->disable_loop();
+    return;
+  }
+  this->flush_();
+}
+
+void TLC59208FOutput::flush_() {
+  if (!this->pwm_amounts_.is_dirty())
     return;
 
-  for (uint8_t channel = this->min_channel_; channel <= this->max_channel_; channel++) {
-    uint8_t pwm = this->pwm_amounts_[channel];
-    ESP_LOGVV(TAG, "Channel %02u: pwm=%04u ", channel, pwm);
+  const uint8_t first = this->pwm_amounts_.first_dirty();
+  const uint8_t last = this->pwm_amounts_.last_dirty();
+  uint8_t data[8];
+  for (uint8_t channel = first; channel <= last; channel++) {
+    data[channel - first] = this->pwm_amounts_[channel];
+    ESP_LOGVV(TAG, "Channel %02u: pwm=%04u ", channel, data[channel - first]);
+  }
 
-    uint8_t reg = TLC59208F_REG_PWM0 + channel;
-    if (!this->write_byte(reg, pwm)) {
-      this->status_set_warning();
-      return;
-    }
+  // MODE1 has auto increment enabled, so the PWMn registers of all changed channels are written in one transaction
+  if (!this->write_bytes(TLC59208F_REG_PWM0 + first, data, last - first + 1)) {
+    this->status_set_warning();
+    return;
   }
 
   this->status_clear_warning();
-  this->update_ = false;
+  this->pwm_amounts_.flushed();
 }
 
 void TLC59208FOutput::register_channel(TLC59208FChannel *channel) {
-  auto c = channel->channel_;
-  this->min_channel_ = std::min(this->min_channel_, c);
-  this->max_channel_ = std::max(this->max_channel_, c);
   channel->set_parent(this);
+  // Registered channels are written once on setup, whatever their value
+  this->pwm_amounts_.mark_dirty(channel->channel_);
 }
 
 void TLC59208FChannel::write_state(float state) {
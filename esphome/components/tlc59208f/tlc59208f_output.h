@@ -2,6 +2,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
+#include "esphome/components/output/channel_batch.h"
 #include "esphome/components/output/float_output.h"
 #include "esphome/components/i2c/i2c.h"
 
@@ -50,19 +51,16 @@ class TLC59208FOutput : public Component, public i2c::I2CDevice {
   friend TLC59208FChannel;
 
   void set_channel_value_(uint8_t channel, uint8_t value) {
-    if (this->pwm_amounts_[channel] != value)
-      this->update_ = true;
-    this->pwm_amounts_[channel] = value;
+    if (this->pwm_amounts_.set(channel, value))
+      this->enable_loop();
   }
 
+  /// Writes all changed channels in one auto-incremented register write
+  void flush_();
+
   uint8_t mode_;
 
-  uint8_t min_channel_{0xFF};
-  uint8_t max_channel_{0x00};
-  uint8_t pwm_amounts_[256] = {
-      0,
-  };
-  bool update_{true};
+  output::ChannelBatch<uint8_t, 8> pwm_amounts_;
 };
 
 }  // namespace tlc59208f
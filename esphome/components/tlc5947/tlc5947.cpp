@@ -32,8 +32,10 @@ void TLC5947::dump_config() {
 }
 
 void TLC5947::loop() {
-  if (!this->update_)
+  if (!this->update_) {
+    this->disable_loop();
     return;
+  }
 
   this->lat_pin_->digital_write(false);
 
@@ -65,6 +67,7 @@ void TLC5947::set_channel_value(uint16_t channel, uint16_t value) {
     return;
   if (this->pwm_amounts_[channel] != value) {
     this->update_ = true;
+    this->enable_loop();
   }
   this->pwm_amounts_[channel] = value;
 }
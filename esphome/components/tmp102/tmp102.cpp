@@ -31,21 +31,28 @@ void TMP102Component::update() {
     return;
   }
   this->set_timeout("read_temp", 50, [this]() {
-    int16_t raw_temperature;
-    if (this->read(reinterpret_cast<uint8_t *>(&raw_temperature), 2) != i2c::ERROR_OK) {
+    // The bus calls back once the bytes arrived, other components run meanwhile
+    if (!this->transfer_async(nullptr, 0, reinterpret_cast<uint8_t *>(&this->raw_temperature_), 2,
+                              [this](i2c::ErrorCode err) { this->publish_temperature_(err); })) {
       this->status_set_warning();
-      return;
     }
-    raw_temperature = i2c::i2ctohs(raw_temperature);
-    raw_temperature = raw_temperature >> 4;
-    float temperature = raw_temperature * TMP102_CONVERSION_FACTOR;
-    ESP_LOGD(TAG, "Got Temperature=%.1f°C", temperature);
-
-    this->publish_state(temperature);
-    this->status_clear_warning();
   });
 }
 
+void TMP102Component::publish_temperature_(i2c::ErrorCode err) {
+  if (err != i2c::ERROR_OK) {
+    this->status_set_warning();
+    return;
+  }
+  int16_t raw_temperature = i2c::i2ctohs(this->raw_temperature_);
+  raw_temperature = raw_temperature >> 4;
+  float temperature = raw_temperature * TMP102_CONVERSION_FACTOR;
+  ESP_LOGD(TAG, "Got Temperature=%.1f°C", temperature);
+
+  this->publish_state(temperature);
+  this->status_clear_warning();
+}
+
 float TMP102Component::get_setup_priority() const { return setup_priority::DATA; }
 
 }  // namespace tmp102
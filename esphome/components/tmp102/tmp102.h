@@ -13,6 +13,11 @@ class TMP102Component : public PollingComponent, public i2c::I2CDevice, public s
   void update() override;
 
   float get_setup_priority() const override;
+
+ protected:
+  void publish_temperature_(i2c::ErrorCode err);
+
+  int16_t raw_temperature_{0};
 };
 
 }  // namespace tmp102
@@ -1,5 +1,6 @@
 import esphome.codegen as cg
 from esphome.components import sensor, time
+from esphome.components.energy_accumulator import get_energy_store
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_ACCURACY_DECIMALS,
@@ -15,6 +16,7 @@ from esphome.const import (
 from esphome.core.entity_helpers import inherit_property_from
 
 DEPENDENCIES = ["time"]
+AUTO_LOAD = ["energy_accumulator"]
 
 CONF_POWER_ID = "power_id"
 total_daily_energy_ns = cg.esphome_ns.namespace("total_daily_energy")
@@ -89,4 +91,6 @@ async def to_code(config):
     time_ = await cg.get_variable(config[CONF_TIME_ID])
     cg.add(var.set_time(time_))
     cg.add(var.set_restore(config[CONF_RESTORE]))
+    if config[CONF_RESTORE]:
+        cg.add(var.set_store(await get_energy_store()))
     cg.add(var.set_method(config[CONF_METHOD]))
@@ -7,13 +7,10 @@ namespace total_daily_energy {
 static const char *const TAG = "total_daily_energy";
 
 void TotalDailyEnergy::setup() {
-  float initial_value = 0;
-
-  if (this->restore_) {
-    this->pref_ = global_preferences->make_preference<float>(this->get_object_id_hash());
-    this->pref_.load(&initial_value);
+  if (this->restore_ && this->store_ != nullptr) {
+    this->total_energy_.restore(this->store_, this->get_object_id_hash());
   }
-  this->publish_state_and_save(initial_value);
+  this->publish_state(this->total_energy_.get());
 
   this->last_update_ = millis();
 
@@ -34,27 +31,24 @@ void TotalDailyEnergy::loop() {
 
   if (t.day_of_year != this->last_day_of_year_) {
     this->last_day_of_year_ = t.day_of_year;
-    this->total_energy_ = 0;
     this->publish_state_and_save(0);
   }
 }
 
 void TotalDailyEnergy::publish_state_and_save(float state) {
-  this->total_energy_ = state;
+  // The store saves it with the next checkpoint
+  this->total_energy_.set(state);
   this->publish_state(state);
-  if (this->restore_) {
-    this->pref_.save(&state);
-  }
 }
 
 void TotalDailyEnergy::process_new_state_(float state) {
   if (std::isnan(state))
     return;
   const uint32_t now = millis();
-  const float old_state = this->last_power_state_;
-  const float new_state = state;
-  float delta_hours = (now - this->last_update_) / 1000.0f / 60.0f / 60.0f;
-  float delta_energy = 0.0f;
+  const double old_state = this->last_power_state_;
+  const double new_state = state;
+  const double delta_hours = (now - this->last_update_) / 1000.0 / 60.0 / 60.0;
+  double delta_energy = 0.0;
   switch (this->method_) {
     case TOTAL_DAILY_ENERGY_METHOD_TRAPEZOID:
       delta_energy = delta_hours * (old_state + new_state) / 2.0;
@@ -68,7 +62,8 @@ void TotalDailyEnergy::process_new_state_(float state) {
   }
   this->last_power_state_ = new_state;
   this->last_update_ = now;
-  this->publish_state_and_save(this->total_energy_ + delta_energy);
+  this->total_energy_.add(delta_energy);
+  this->publish_state(this->total_energy_.get());
 }
 
 }  // namespace total_daily_energy
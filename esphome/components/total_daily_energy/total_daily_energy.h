@@ -1,8 +1,8 @@
 #pragma once
 
 #include "esphome/core/component.h"
-#include "esphome/core/preferences.h"
 #include "esphome/core/hal.h"
+#include "esphome/components/energy_accumulator/energy_accumulator.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/time/real_time_clock.h"
 
@@ -18,6 +18,7 @@ enum TotalDailyEnergyMethod {
 class TotalDailyEnergy : public sensor::Sensor, public Component {
  public:
   void set_restore(bool restore) { restore_ = restore; }
+  void set_store(energy_accumulator::EnergyStore *store) { store_ = store; }
   void set_time(time::RealTimeClock *time) { time_ = time; }
   void set_parent(Sensor *parent) { parent_ = parent; }
   void set_method(TotalDailyEnergyMethod method) { method_ = method; }
@@ -30,14 +31,15 @@ class TotalDailyEnergy : public sensor::Sensor, public Component {
  protected:
   void process_new_state_(float state);
 
-  ESPPreferenceObject pref_;
+  /// Checkpoints the total when restore is enabled
+  energy_accumulator::EnergyStore *store_{nullptr};
   time::RealTimeClock *time_;
   Sensor *parent_;
   TotalDailyEnergyMethod method_;
   uint16_t last_day_of_year_{};
   uint32_t last_update_{0};
   bool restore_;
-  float total_energy_{0.0f};
+  energy_accumulator::EnergyAccumulator total_energy_;
   float last_power_state_{0.0f};
 };
 
@@ -1,5 +1,6 @@
 #include "touchscreen.h"
 
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -7,7 +8,13 @@ namespace touchscreen {
 
 static const char *const TAG = "touchscreen";
 
-void TouchscreenInterrupt::gpio_intr(TouchscreenInterrupt *store) { store->touched = true; }
+void IRAM_ATTR TouchscreenInterrupt::gpio_intr(TouchscreenInterrupt *store) {
+  store->touched = true;
+#ifdef USE_EVENT_DRIVEN_LOOP
+  // Read the controller in the next loop iteration instead of when the loop would wake up anyway
+  App.wake_loop_isr();
+#endif
+}
 
 void Touchscreen::attach_interrupt_(InternalGPIOPin *irq_pin, esphome::gpio::InterruptType type) {
   irq_pin->attach_interrupt(TouchscreenInterrupt::gpio_intr, &this->store_, type);
@@ -59,7 +66,8 @@ void Touchscreen::loop() {
         tp.second.state &= ~STATE_RELEASING;
       }
     } else {
-      this->defer([this]() { this->send_touches_(); });
+      // Listeners get the points in this loop iteration, so LVGL can read them before it renders
+      this->send_touches_();
       if (this->touch_timeout_ > 0) {
         // Simulate a touch after <this->touch_timeout_> ms. This will reset any existing timeout operation.
         // This is to detect touch release.
@@ -19,9 +19,13 @@ namespace tuya {
 static const char *const TAG = "tuya";
 static const int COMMAND_DELAY = 10;
 static const int RECEIVE_TIMEOUT = 300;
+// Shortest wait for an answer, for MCUs that answer quickly
+static const uint32_t MIN_RESPONSE_TIMEOUT = 50;
 static const int MAX_RETRIES = 5;
 
 void Tuya::setup() {
+  // Start from the full timeout and learn how fast the MCU answers
+  this->response_latency_ = RECEIVE_TIMEOUT;
   this->set_interval("heartbeat", 15000, [this] { this->send_empty_command_(TuyaCommandType::HEARTBEAT); });
   if (this->status_pin_ != nullptr) {
     this->status_pin_->digital_write(false);
@@ -71,6 +75,10 @@ void Tuya::dump_config() {
                   this->reset_pin_reported_);
   }
   LOG_PIN("  Status Pin: ", this->status_pin_);
+  ESP_LOGCONFIG(TAG,
+                "  Pack datapoints: %s\n"
+                "  Response latency: %" PRIu32 " ms",
+                YESNO(this->pack_datapoints_), this->response_latency_);
   ESP_LOGCONFIG(TAG, "  Product: '%s'", this->product_.c_str());
 }
 
@@ -144,6 +152,8 @@ void Tuya::handle_command_(uint8_t command, uint8_t version, const uint8_t *buff
 
   if (this->expected_response_.has_value() && this->expected_response_ == command_type) {
     this->expected_response_.reset();
+    uint32_t latency = millis() - this->last_command_timestamp_;
+    this->response_latency_ = (this->response_latency_ * 7 + latency) / 8;
     this->command_queue_.erase(command_queue_.begin());
     this->init_retries_ = 0;
   }
@@ -456,8 +466,9 @@ void Tuya::process_command_queue_() {
     this->rx_message_.clear();
   }
 
-  if (this->expected_response_.has_value() && delay > RECEIVE_TIMEOUT) {
+  if (this->expected_response_.has_value() && delay > this->response_timeout_()) {
     this->expected_response_.reset();
+    this->response_latency_ = (this->response_latency_ * 7 + RECEIVE_TIMEOUT) / 8;
     if (init_state_ != TuyaInitState::INIT_DONE) {
       if (++this->init_retries_ >= MAX_RETRIES) {
         this->init_failed_ = true;
@@ -479,6 +490,13 @@ void Tuya::process_command_queue_() {
   }
 }
 
+uint32_t Tuya::response_timeout_() const {
+  // Keep the full timeout while initializing, the retries count on it
+  if (this->init_state_ != TuyaInitState::INIT_DONE)
+    return RECEIVE_TIMEOUT;
+  return clamp<uint32_t>(this->response_latency_ * 3, MIN_RESPONSE_TIMEOUT, RECEIVE_TIMEOUT);
+}
+
 void Tuya::send_command_(const TuyaCommand &command) {
   command_queue_.push_back(command);
   process_command_queue_();
@@ -691,9 +709,45 @@ void Tuya::send_datapoint_command_(uint8_t datapoint_id, TuyaDatapointType datap
   buffer.push_back(data.size() >> 0);
   buffer.insert(buffer.end(), data.begin(), data.end());
 
+  if (this->merge_datapoint_(buffer))
+    return;
   this->send_command_(TuyaCommand{.cmd = TuyaCommandType::DATAPOINT_DELIVER, .payload = buffer});
 }
 
+// Sliders write the same datapoint many times a second, only the last value queued for a datapoint is sent.
+// Returns false when the record still has to be queued as a command of its own.
+bool Tuya::merge_datapoint_(const std::vector<uint8_t> &record) {
+  // While a response is expected the front command has already been sent
+  size_t first = this->expected_response_.has_value() ? 1 : 0;
+  TuyaCommand *last_deliver = nullptr;
+  for (size_t i = first; i < this->command_queue_.size(); i++) {
+    TuyaCommand &command = this->command_queue_[i];
+    if (command.cmd != TuyaCommandType::DATAPOINT_DELIVER)
+      continue;
+    last_deliver = &command;
+    std::vector<uint8_t> &payload = command.payload;
+    size_t pos = 0;
+    while (pos + 4 <= payload.size()) {
+      size_t end = pos + 4 + encode_uint16(payload[pos + 2], payload[pos + 3]);
+      if (end > payload.size())
+        break;
+      if (payload[pos] == record[0]) {
+        ESP_LOGV(TAG, "Replacing queued value of datapoint %u", record[0]);
+        payload.erase(payload.begin() + pos, payload.begin() + end);
+        payload.insert(payload.begin() + pos, record.begin(), record.end());
+        return true;
+      }
+      pos = end;
+    }
+  }
+  if (this->pack_datapoints_ && last_deliver != nullptr) {
+    ESP_LOGV(TAG, "Packing datapoint %u into a queued command", record[0]);
+    last_deliver->payload.insert(last_deliver->payload.end(), record.begin(), record.end());
+    return true;
+  }
+  return false;
+}
+
 void Tuya::register_listener(uint8_t datapoint_id, const std::function<void(TuyaDatapoint)> &func) {
   auto listener = TuyaDatapointListener{
       .datapoint_id = datapoint_id,
@@ -96,6 +96,8 @@ class Tuya : public Component, public uart::UARTDevice {
   void set_boolean_datapoint_value(uint8_t datapoint_id, bool value);
   void set_integer_datapoint_value(uint8_t datapoint_id, uint32_t value);
   void set_status_pin(InternalGPIOPin *status_pin) { this->status_pin_ = status_pin; }
+  /// Send several datapoints in one DATAPOINT_DELIVER command, for MCUs that accept it
+  void set_pack_datapoints(bool pack_datapoints) { this->pack_datapoints_ = pack_datapoints; }
   void set_string_datapoint_value(uint8_t datapoint_id, const std::string &value);
   void set_enum_datapoint_value(uint8_t datapoint_id, uint8_t value);
   void set_bitmask_datapoint_value(uint8_t datapoint_id, uint32_t value, uint8_t length);
@@ -132,6 +134,8 @@ class Tuya : public Component, public uart::UARTDevice {
   void set_string_datapoint_value_(uint8_t datapoint_id, const std::string &value, bool forced);
   void set_raw_datapoint_value_(uint8_t datapoint_id, const std::vector<uint8_t> &value, bool forced);
   void send_datapoint_command_(uint8_t datapoint_id, TuyaDatapointType datapoint_type, std::vector<uint8_t> data);
+  bool merge_datapoint_(const std::vector<uint8_t> &record);
+  uint32_t response_timeout_() const;
   void set_status_pin_();
   void send_wifi_status_();
   uint8_t get_wifi_status_code_();
@@ -144,6 +148,7 @@ class Tuya : public Component, public uart::UARTDevice {
 #endif
   TuyaInitState init_state_ = TuyaInitState::INIT_HEARTBEAT;
   bool init_failed_{false};
+  bool pack_datapoints_{false};
   int init_retries_{0};
   uint8_t protocol_version_ = -1;
   InternalGPIOPin *status_pin_{nullptr};
@@ -151,6 +156,8 @@ class Tuya : public Component, public uart::UARTDevice {
   int reset_pin_reported_ = -1;
   uint32_t last_command_timestamp_ = 0;
   uint32_t last_rx_char_timestamp_ = 0;
+  // Smoothed time the MCU takes to answer a command, paces the queue once initialization is done
+  uint32_t response_latency_{0};
   std::string product_ = "";
   std::vector<TuyaDatapointListener> listeners_;
   std::vector<TuyaDatapoint> datapoints_;
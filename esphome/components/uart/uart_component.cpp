@@ -1,5 +1,7 @@
 #include "uart_component.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace uart {
 
@@ -20,5 +22,15 @@ bool UARTComponent::check_read_timeout_(size_t len) {
   return true;
 }
 
+size_t UARTComponent::read_available(uint8_t *data, size_t max_len) {
+  const int available = this->available();
+  if (available <= 0 || max_len == 0)
+    return 0;
+  const size_t len = std::min<size_t>(available, max_len);
+  if (!this->read_array(data, len))
+    return 0;
+  return len;
+}
+
 }  // namespace uart
 }  // namespace esphome
@@ -67,6 +67,13 @@ class UARTComponent {
   // @return True if the specified number of bytes were successfully read, false otherwise.
   virtual bool read_array(uint8_t *data, size_t len) = 0;
 
+  // Reads up to max_len of the bytes that were received already, without waiting for more.
+  // Parsers that handle a byte at a time should read in chunks with this instead of calling read_byte() per byte.
+  // @param data Pointer to the array where the read data will be stored.
+  // @param max_len Maximum number of bytes to read.
+  // @return Number of bytes read, 0 if none were available.
+  size_t read_available(uint8_t *data, size_t max_len);
+
   // Pure virtual method to return the number of bytes available for reading.
   // @return Number of available bytes.
   virtual int available() = 0;
@@ -5,6 +5,9 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+#include <cstring>
+
 #ifdef USE_LOGGER
 #include "esphome/components/logger/logger.h"
 #endif
@@ -177,8 +180,7 @@ bool ESP8266UartComponent::read_array(uint8_t *data, size_t len) {
   if (this->hw_serial_ != nullptr) {
     this->hw_serial_->readBytes(data, len);
   } else {
-    for (size_t i = 0; i < len; i++)
-      data[i] = this->sw_serial_->read_byte();
+    this->sw_serial_->read_array(data, len);
   }
 #ifdef USE_UART_DEBUGGER
   for (size_t i = 0; i < len; i++) {
@@ -302,6 +304,20 @@ uint8_t ESP8266SoftwareSerial::read_byte() {
   this->rx_out_pos_ = (this->rx_out_pos_ + 1) % this->rx_buffer_size_;
   return data;
 }
+size_t ESP8266SoftwareSerial::read_array(uint8_t *data, size_t len) {
+  // The interrupt only moves rx_in_pos_, take it once so the copy works on a consistent view
+  const size_t in_pos = this->rx_in_pos_;
+  const size_t out_pos = this->rx_out_pos_;
+  const size_t avail = in_pos >= out_pos ? in_pos - out_pos : in_pos + this->rx_buffer_size_ - out_pos;
+  len = std::min(len, avail);
+  // The bytes are in at most two runs, the second one starts over at the beginning of the ring
+  const size_t first = std::min(len, this->rx_buffer_size_ - out_pos);
+  memcpy(data, &this->rx_buffer_[out_pos], first);
+  memcpy(data + first, this->rx_buffer_, len - first);
+  const size_t next = out_pos + len;
+  this->rx_out_pos_ = next >= this->rx_buffer_size_ ? next - this->rx_buffer_size_ : next;
+  return len;
+}
 uint8_t ESP8266SoftwareSerial::peek_byte() {
   if (this->rx_in_pos_ == this->rx_out_pos_)
     return 0;
@@ -19,6 +19,8 @@ class ESP8266SoftwareSerial {
 
   uint8_t read_byte();
   uint8_t peek_byte();
+  /// Copies up to len received bytes out of the ring buffer and returns how many were copied
+  size_t read_array(uint8_t *data, size_t len);
 
   void flush();
 
@@ -0,0 +1,59 @@
+#include "uart_frame_reader.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace uart {
+
+bool UARTFrameReader::read(UARTComponent *uart, uint32_t now) {
+  // The caller is done with the previous frame, bytes received after it may already hold the next one
+  if (this->frame_size_ > 0) {
+    this->buffer_.erase(this->buffer_.begin(), this->buffer_.begin() + this->frame_size_);
+    this->frame_size_ = 0;
+    if (this->find_frame_end_(0, now))
+      return true;
+  }
+
+  const size_t scanned = this->buffer_.size();
+  const int available = uart->available();
+  if (available > 0 && scanned < this->max_frame_size_) {
+    // Doesn't wait, the bytes were received already
+    const size_t len = std::min<size_t>(available, this->max_frame_size_ - scanned);
+    this->buffer_.resize(scanned + len);
+    if (!uart->read_array(&this->buffer_[scanned], len)) {
+      this->buffer_.resize(scanned);
+      return false;
+    }
+    this->last_byte_ = now;
+  }
+  return this->find_frame_end_(scanned, now);
+}
+
+bool UARTFrameReader::find_frame_end_(size_t from, uint32_t now) {
+  const size_t size = this->buffer_.size();
+  if (this->terminator_ >= 0 && from < size) {
+    const auto *end = static_cast<const uint8_t *>(memchr(&this->buffer_[from], this->terminator_, size - from));
+    if (end != nullptr) {
+      this->frame_size_ = end - this->buffer_.data() + 1;
+      return true;
+    }
+  }
+  if (size >= this->max_frame_size_ ||
+      (size > 0 && this->idle_timeout_ > 0 && now - this->last_byte_ >= this->idle_timeout_)) {
+    this->frame_size_ = size;
+    return true;
+  }
+  return false;
+}
+
+void UARTFrameReader::clear(UARTComponent *uart) {
+  this->buffer_.clear();
+  this->frame_size_ = 0;
+  uint8_t discard[32];
+  while (uart->read_available(discard, sizeof(discard)) > 0) {
+  }
+}
+
+}  // namespace uart
+}  // namespace esphome
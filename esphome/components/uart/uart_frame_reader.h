@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "uart_component.h"
+
+namespace esphome {
+namespace uart {
+
+/** Collects received bytes into frames, so a protocol parser runs once per frame instead of once per byte.
+ *
+ * Reading byte by byte costs a virtual call and, on some platforms, a lock and a driver call per byte. The reader
+ * takes everything the UART received in one read_array() call and looks for the end of a frame in its buffer. A frame
+ * ends after the terminator, once no byte arrived for the idle timeout, or when it reached the maximum size.
+ *
+ * Example for a protocol with lines ending in a carriage return:
+ * ```cpp
+ * if (this->frame_reader_.read(this->parent_, millis()))
+ *   this->parse_line_(this->frame_reader_.data(), this->frame_reader_.size());
+ * ```
+ */
+class UARTFrameReader {
+ public:
+  explicit UARTFrameReader(size_t max_frame_size) : max_frame_size_(max_frame_size) {
+    this->buffer_.reserve(max_frame_size);
+  }
+
+  /// Ends frames after this byte, which is part of the frame
+  void set_terminator(uint8_t terminator) { this->terminator_ = terminator; }
+  /// Ends frames once no byte arrived for this many ms, 0 to wait for the terminator or maximum size only
+  void set_idle_timeout(uint32_t idle_timeout) { this->idle_timeout_ = idle_timeout; }
+
+  /// Reads what `uart` received. Returns true if a frame is complete, which stays in data() until the next call.
+  bool read(UARTComponent *uart, uint32_t now);
+
+  const uint8_t *data() const { return this->buffer_.data(); }
+  size_t size() const { return this->frame_size_; }
+
+  /// Drops the buffered bytes and everything `uart` received so far
+  void clear(UARTComponent *uart);
+
+ protected:
+  bool find_frame_end_(size_t from, uint32_t now);
+
+  std::vector<uint8_t> buffer_;
+  size_t max_frame_size_;
+  /// Size of the frame returned by the last read(), at the start of the buffer
+  size_t frame_size_{0};
+  uint32_t idle_timeout_{0};
+  uint32_t last_byte_{0};
+  int16_t terminator_{-1};
+};
+
+}  // namespace uart
+}  // namespace esphome
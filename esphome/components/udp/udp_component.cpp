@@ -86,8 +86,10 @@ void UDPComponent::setup() {
       this->status_set_error("Unable to bind socket");
       return;
     }
+    this->receive_pool_ = make_unique<socket::DatagramPool>(MAX_PACKET_SIZE, RECEIVE_BATCH_SIZE);
   }
 #endif
+  this->receive_buffer_.reserve(MAX_PACKET_SIZE);
 #ifdef USE_SOCKET_IMPL_LWIP_TCP
   // 8266 and RP2040 `Duino
   for (const auto &address : this->addresses_) {
@@ -101,24 +103,43 @@ void UDPComponent::setup() {
 }
 
 void UDPComponent::loop() {
-  auto buf = std::vector<uint8_t>(MAX_PACKET_SIZE);
-  if (this->should_listen_) {
-    for (;;) {
+  if (!this->should_listen_)
+    return;
+  auto dropped = this->get_dropped_packets();
 #if defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
-      auto len = this->listen_socket_->read(buf.data(), buf.size());
+  // drain the socket in batches, so a burst doesn't wait in lwIP until its receive queue overflows
+  for (;;) {
+    auto &pool = *this->receive_pool_;
+    auto count = this->listen_socket_->read_batch(pool);
+    for (size_t i = 0; i != count; i++) {
+      auto len = pool.size(i);
+      this->receive_buffer_.assign(pool.data(i), pool.data(i) + len);
+      ESP_LOGV(TAG, "Received packet of length %zu", len);
+      this->packet_listeners_.call(this->receive_buffer_);
+    }
+    if (count != pool.get_count())
+      break;
+  }
 #endif
 #ifdef USE_SOCKET_IMPL_LWIP_TCP
-      auto len = this->udp_client_.parsePacket();
-      if (len > 0)
-        len = this->udp_client_.read(buf.data(), buf.size());
-#endif
-      if (len <= 0)
-        break;
-      buf.resize(len);
-      ESP_LOGV(TAG, "Received packet of length %zu", len);
-      this->packet_listeners_.call(buf);
+  for (;;) {
+    auto len = this->udp_client_.parsePacket();
+    if (len <= 0)
+      break;
+    if ((size_t) len > MAX_PACKET_SIZE) {
+      this->udp_client_.flush();
+      this->dropped_packets_++;
+      continue;
     }
+    this->receive_buffer_.resize(len);
+    this->udp_client_.read(this->receive_buffer_.data(), len);
+    ESP_LOGV(TAG, "Received packet of length %d", len);
+    this->packet_listeners_.call(this->receive_buffer_);
   }
+#endif
+  if (this->get_dropped_packets() != dropped)
+    ESP_LOGW(TAG, "Dropped %" PRIu32 " packets longer than %zu bytes", this->get_dropped_packets() - dropped,
+             MAX_PACKET_SIZE);
 }
 
 void UDPComponent::dump_config() {
@@ -136,6 +157,8 @@ void UDPComponent::dump_config() {
                 "  Broadcasting: %s\n"
                 "  Listening: %s",
                 YESNO(this->should_broadcast_), YESNO(this->should_listen_));
+  if (this->should_listen_)
+    ESP_LOGCONFIG(TAG, "  Dropped packets: %" PRIu32, this->get_dropped_packets());
 }
 
 void UDPComponent::send_packet(const uint8_t *data, size_t size) {
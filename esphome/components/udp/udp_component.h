@@ -15,6 +15,8 @@ namespace esphome {
 namespace udp {
 
 static const size_t MAX_PACKET_SIZE = 508;
+// datagrams read from the socket in one call
+static const size_t RECEIVE_BATCH_SIZE = 4;
 class UDPComponent : public Component {
  public:
   void add_address(const char *addr) { this->addresses_.emplace_back(addr); }
@@ -32,6 +34,14 @@ class UDPComponent : public Component {
   void send_packet(const uint8_t *data, size_t size);
   void send_packet(const std::vector<uint8_t> &buf) { this->send_packet(buf.data(), buf.size()); }
   float get_setup_priority() const override { return setup_priority::AFTER_WIFI; };
+  /// Received packets that were longer than MAX_PACKET_SIZE and thrown away
+  uint32_t get_dropped_packets() const {
+#if defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
+    return this->receive_pool_ == nullptr ? 0 : this->receive_pool_->get_dropped();
+#else
+    return this->dropped_packets_;
+#endif
+  }
 
  protected:
   uint16_t listen_port_{};
@@ -39,15 +49,19 @@ class UDPComponent : public Component {
   bool should_broadcast_{};
   bool should_listen_{};
   CallbackManager<void(std::vector<uint8_t> &)> packet_listeners_{};
+  // the listeners take a vector, this one is reused for every packet
+  std::vector<uint8_t> receive_buffer_{};
 
 #if defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
   std::unique_ptr<socket::Socket> broadcast_socket_ = nullptr;
   std::unique_ptr<socket::Socket> listen_socket_ = nullptr;
   std::vector<struct sockaddr> sockaddrs_{};
+  std::unique_ptr<socket::DatagramPool> receive_pool_{};
 #endif
 #ifdef USE_SOCKET_IMPL_LWIP_TCP
   std::vector<IPAddress> ipaddrs_{};
   WiFiUDP udp_client_{};
+  uint32_t dropped_packets_{0};
 #endif
   std::vector<std::string> addresses_{};
 
@@ -105,28 +105,26 @@ std::vector<CdcEps> USBUartTypeCdcAcm::parse_descriptors(usb_device_handle_t dev
   return cdc_devs;
 }
 
-void RingBuffer::push(uint8_t item) {
-  this->buffer_[this->insert_pos_] = item;
-  this->insert_pos_ = (this->insert_pos_ + 1) % this->buffer_size_;
-}
-void RingBuffer::push(const uint8_t *data, size_t len) {
-  for (size_t i = 0; i != len; i++) {
-    this->buffer_[this->insert_pos_] = *data++;
-    this->insert_pos_ = (this->insert_pos_ + 1) % this->buffer_size_;
-  }
+// Both copy in at most two spans, split where the data wraps around the end of the buffer
+size_t RingBuffer::push(const uint8_t *data, size_t len) {
+  len = std::min(len, this->get_free_space());
+  size_t first = std::min<size_t>(len, this->buffer_size_ - this->insert_pos_);
+  memcpy(this->buffer_ + this->insert_pos_, data, first);
+  memcpy(this->buffer_, data + first, len - first);
+  this->insert_pos_ = len - first != 0 ? len - first : this->insert_pos_ + first;
+  if (this->insert_pos_ == this->buffer_size_)
+    this->insert_pos_ = 0;
+  return len;
 }
 
-uint8_t RingBuffer::pop() {
-  uint8_t item = this->buffer_[this->read_pos_];
-  this->read_pos_ = (this->read_pos_ + 1) % this->buffer_size_;
-  return item;
-}
 size_t RingBuffer::pop(uint8_t *data, size_t len) {
   len = std::min(len, this->get_available());
-  for (size_t i = 0; i != len; i++) {
-    *data++ = this->buffer_[this->read_pos_];
-    this->read_pos_ = (this->read_pos_ + 1) % this->buffer_size_;
-  }
+  size_t first = std::min<size_t>(len, this->buffer_size_ - this->read_pos_);
+  memcpy(data, this->buffer_ + this->read_pos_, first);
+  memcpy(data + first, this->buffer_, len - first);
+  this->read_pos_ = len - first != 0 ? len - first : this->read_pos_ + first;
+  if (this->read_pos_ == this->buffer_size_)
+    this->read_pos_ = 0;
   return len;
 }
 void USBUartChannel::write_array(const uint8_t *data, size_t len) {
@@ -134,12 +132,9 @@ void USBUartChannel::write_array(const uint8_t *data, size_t len) {
     ESP_LOGV(TAG, "Channel not initialised - write ignored");
     return;
   }
-  while (this->output_buffer_.get_free_space() != 0 && len-- != 0) {
-    this->output_buffer_.push(*data++);
-  }
-  len++;
-  if (len > 0) {
-    ESP_LOGE(TAG, "Buffer full - failed to write %d bytes", len);
+  size_t written = this->output_buffer_.push(data, len);
+  if (written != len) {
+    ESP_LOGE(TAG, "Buffer full - failed to write %zu bytes", len - written);
   }
   this->parent_->start_output(this);
 }
@@ -163,9 +158,7 @@ bool USBUartChannel::read_array(uint8_t *data, size_t len) {
     len = available;
     status = false;
   }
-  for (size_t i = 0; i != len; i++) {
-    *data++ = this->input_buffer_.pop();
-  }
+  this->input_buffer_.pop(data, len);
   this->parent_->start_input(this);
   return status;
 }
@@ -187,12 +180,22 @@ void USBUartComponent::dump_config() {
   }
 }
 void USBUartComponent::start_input(USBUartChannel *channel) {
-  if (!channel->initialised_ || channel->input_started_ ||
-      channel->input_buffer_.get_free_space() < channel->cdc_dev_.in_ep->wMaxPacketSize)
+  if (!channel->initialised_)
     return;
   const auto *ep = channel->cdc_dev_.in_ep;
+  // Every transfer in flight may return a full packet, only start one if the buffer can take all of them
+  while (channel->inputs_in_flight_ < INPUT_TRANSFERS_PER_CHANNEL &&
+         channel->input_buffer_.get_free_space() >= (channel->inputs_in_flight_ + 1u) * ep->wMaxPacketSize) {
+    this->submit_input_(channel);
+  }
+}
+
+void USBUartComponent::submit_input_(USBUartChannel *channel) {
+  const auto *ep = channel->cdc_dev_.in_ep;
   auto callback = [this, channel](const usb_host::TransferStatus &status) {
     ESP_LOGV(TAG, "Transfer result: length: %u; status %X", status.data_len, status.error_code);
+    if (channel->inputs_in_flight_ != 0)
+      channel->inputs_in_flight_--;
     if (!status.success) {
       ESP_LOGE(TAG, "Control transfer failed, status=%s", esp_err_to_name(status.error_code));
       return;
@@ -203,18 +206,19 @@ void USBUartComponent::start_input(USBUartChannel *channel) {
                                std::vector<uint8_t>(status.data, status.data + status.data_len), ',');  // NOLINT()
     }
 #endif
-    channel->input_started_ = false;
     if (!channel->dummy_receiver_) {
-      for (size_t i = 0; i != status.data_len; i++) {
-        channel->input_buffer_.push(status.data[i]);
+      size_t dropped = status.data_len - channel->input_buffer_.push(status.data, status.data_len);
+      if (dropped != 0) {
+        channel->rx_overrun_bytes_ += dropped;
+        ESP_LOGW(TAG, "Channel %u input buffer full, dropped %zu bytes (%" PRIu32 " total)", channel->index_, dropped,
+                 channel->rx_overrun_bytes_);
       }
     }
-    if (channel->input_buffer_.get_free_space() >= channel->cdc_dev_.in_ep->wMaxPacketSize) {
-      this->defer([this, channel] { this->start_input(channel); });
-    }
+    // Resubmit right away instead of deferring to the next loop, the device can't send while no transfer is queued
+    this->start_input(channel);
   };
-  channel->input_started_ = true;
-  this->transfer_in(ep->bEndpointAddress, callback, ep->wMaxPacketSize);
+  if (this->transfer_in(ep->bEndpointAddress, callback, ep->wMaxPacketSize))
+    channel->inputs_in_flight_++;
 }
 
 void USBUartComponent::start_output(USBUartChannel *channel) {
@@ -302,7 +306,7 @@ void USBUartTypeCdcAcm::on_disconnected() {
     }
     usb_host_interface_release(this->handle_, this->device_handle_, channel->cdc_dev_.bulk_interface_number);
     channel->initialised_ = false;
-    channel->input_started_ = false;
+    channel->inputs_in_flight_ = 0;
     channel->output_started_ = false;
     channel->input_buffer_.clear();
     channel->output_buffer_.clear();
@@ -314,7 +318,7 @@ void USBUartTypeCdcAcm::enable_channels() {
   for (auto *channel : this->channels_) {
     if (!channel->initialised_)
       continue;
-    channel->input_started_ = false;
+    channel->inputs_in_flight_ = 0;
     channel->output_started_ = false;
     this->start_input(channel);
   }
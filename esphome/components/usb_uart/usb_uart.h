@@ -43,21 +43,25 @@ enum UARTStopBitsOptions {
   UART_CONFIG_STOP_BITS_2,
 };
 
+// Keeping a second bulk IN transfer queued lets the device send the next packet while the last one is processed
+static const uint8_t INPUT_TRANSFERS_PER_CHANNEL = 2;
+
 static const char *const PARITY_NAMES[] = {"NONE", "ODD", "EVEN", "MARK", "SPACE"};
 static const char *const STOP_BITS_NAMES[] = {"1", "1.5", "2"};
 
+/// Byte ring only used from the main loop, the USB host events are handled there too
 class RingBuffer {
  public:
   RingBuffer(uint16_t buffer_size) : buffer_size_(buffer_size), buffer_(new uint8_t[buffer_size]) {}
   bool is_empty() const { return this->read_pos_ == this->insert_pos_; }
   size_t get_available() const {
-    return (this->insert_pos_ + this->buffer_size_ - this->read_pos_) % this->buffer_size_;
+    return this->insert_pos_ >= this->read_pos_ ? this->insert_pos_ - this->read_pos_
+                                                : this->insert_pos_ + this->buffer_size_ - this->read_pos_;
   };
   size_t get_free_space() const { return this->buffer_size_ - 1 - this->get_available(); }
   uint8_t peek() const { return this->buffer_[this->read_pos_]; }
-  void push(uint8_t item);
-  void push(const uint8_t *data, size_t len);
-  uint8_t pop();
+  /// Copies as much of data as fits, returns the number of bytes stored
+  size_t push(const uint8_t *data, size_t len);
   size_t pop(uint8_t *data, size_t len);
   void clear() { this->read_pos_ = this->insert_pos_ = 0; }
 
@@ -94,7 +98,8 @@ class USBUartChannel : public uart::UARTComponent, public Parented<USBUartCompon
   RingBuffer input_buffer_;
   RingBuffer output_buffer_;
   UARTParityOptions parity_{UART_CONFIG_PARITY_NONE};
-  bool input_started_{true};
+  uint32_t rx_overrun_bytes_{0};
+  uint8_t inputs_in_flight_{0};
   bool output_started_{true};
   CdcEps cdc_dev_{};
   bool debug_{};
@@ -116,6 +121,8 @@ class USBUartComponent : public usb_host::USBClient {
   void start_output(USBUartChannel *channel);
 
  protected:
+  void submit_input_(USBUartChannel *channel);
+
   std::vector<USBUartChannel *> channels_{};
 };
 
@@ -1,7 +1,13 @@
 from esphome import automation
 from esphome.automation import register_action, register_condition
 import esphome.codegen as cg
-from esphome.components import media_player, micro_wake_word, microphone, speaker
+from esphome.components import (
+    esp32,
+    media_player,
+    micro_wake_word,
+    microphone,
+    speaker,
+)
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_ID,
@@ -47,6 +53,10 @@ CONF_WAKE_WORD = "wake_word"
 
 CONF_CONVERSATION_TIMEOUT = "conversation_timeout"
 
+CONF_BITRATE = "bitrate"
+CONF_COMPLEXITY = "complexity"
+CONF_OPUS = "opus"
+
 CONF_ON_TIMER_STARTED = "on_timer_started"
 CONF_ON_TIMER_UPDATED = "on_timer_updated"
 CONF_ON_TIMER_CANCELLED = "on_timer_cancelled"
@@ -86,6 +96,16 @@ def tts_stream_validate(config):
     return config
 
 
+OPUS_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_BITRATE, default=24000): cv.int_range(6000, 128000),
+            cv.Optional(CONF_COMPLEXITY, default=0): cv.int_range(0, 10),
+        }
+    ),
+    cv.only_with_esp_idf,
+)
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -118,6 +138,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_VOLUME_MULTIPLIER, default=1.0): cv.float_range(
                 min=0.0, min_included=False
             ),
+            cv.Optional(CONF_OPUS): OPUS_SCHEMA,
             cv.Optional(CONF_ON_LISTENING): automation.validate_automation(single=True),
             cv.Optional(CONF_ON_START): automation.validate_automation(single=True),
             cv.Optional(CONF_ON_WAKE_WORD_DETECTED): automation.validate_automation(
@@ -219,6 +240,12 @@ async def to_code(config):
     cg.add(var.set_volume_multiplier(config[CONF_VOLUME_MULTIPLIER]))
     cg.add(var.set_conversation_timeout(config[CONF_CONVERSATION_TIMEOUT]))
 
+    if opus_config := config.get(CONF_OPUS):
+        cg.add_define("USE_VOICE_ASSISTANT_OPUS")
+        esp32.add_idf_component(name="espressif/esp_audio_codec", ref="2.3.0")
+        cg.add(var.set_opus_bitrate(opus_config[CONF_BITRATE]))
+        cg.add(var.set_opus_complexity(opus_config[CONF_COMPLEXITY]))
+
     if CONF_ON_LISTENING in config:
         await automation.build_automation(
             var.get_listening_trigger(), [], config[CONF_ON_LISTENING]
@@ -0,0 +1,115 @@
+#include "opus_encoder.h"
+
+#ifdef USE_VOICE_ASSISTANT_OPUS
+
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <esp_opus_enc.h>
+
+namespace esphome {
+namespace voice_assistant {
+
+static const char *const TAG = "voice_assistant.opus";
+
+static const uint32_t OPUS_FRAME_DURATION_MS = 20;
+
+bool OpusEncoder::open(uint32_t sample_rate, uint32_t bitrate, uint8_t complexity) {
+  this->close();
+
+  esp_opus_enc_config_t config = ESP_OPUS_ENC_CONFIG_DEFAULT();
+  config.sample_rate = sample_rate;
+  config.channel = 1;
+  config.bits_per_sample = 16;
+  config.bitrate = bitrate;
+  config.frame_duration = ESP_OPUS_ENC_FRAME_DURATION_20_MS;
+  config.application_mode = ESP_OPUS_ENC_APPLICATION_VOIP;
+  config.complexity = complexity;
+  config.enable_fec = false;
+  config.enable_dtx = false;
+  config.enable_vbr = false;
+
+  if (esp_opus_enc_open(&config, sizeof(config), &this->handle_) != ESP_AUDIO_ERR_OK) {
+    ESP_LOGE(TAG, "Could not create the Opus encoder");
+    this->handle_ = nullptr;
+    return false;
+  }
+
+  int in_size = 0;
+  int out_size = 0;
+  if ((esp_opus_enc_get_frame_size(this->handle_, &in_size, &out_size) != ESP_AUDIO_ERR_OK) || (in_size <= 0) ||
+      (out_size <= 0)) {
+    ESP_LOGE(TAG, "Could not get the Opus frame size");
+    this->close();
+    return false;
+  }
+  this->frame_bytes_ = in_size;
+  this->packet_size_ = out_size;
+
+  RAMAllocator<uint8_t> allocator;
+  this->packet_ = allocator.allocate(this->packet_size_);
+  if (this->packet_ == nullptr) {
+    ESP_LOGE(TAG, "Could not allocate the Opus packet buffer");
+    this->close();
+    return false;
+  }
+
+  this->sample_rate_ = sample_rate;
+  this->frames_ = 0;
+  this->max_encode_us_ = 0;
+  this->total_encode_us_ = 0;
+  this->encoded_bytes_ = 0;
+  return true;
+}
+
+void OpusEncoder::close() {
+  if (this->handle_ != nullptr) {
+    esp_opus_enc_close(this->handle_);
+    this->handle_ = nullptr;
+  }
+  if (this->packet_ != nullptr) {
+    RAMAllocator<uint8_t> allocator;
+    allocator.deallocate(this->packet_, this->packet_size_);
+    this->packet_ = nullptr;
+  }
+}
+
+int32_t OpusEncoder::encode(const uint8_t *pcm) {
+  if (this->handle_ == nullptr) {
+    return -1;
+  }
+
+  esp_audio_enc_in_frame_t in_frame = {};
+  in_frame.buffer = const_cast<uint8_t *>(pcm);
+  in_frame.len = this->frame_bytes_;
+  esp_audio_enc_out_frame_t out_frame = {};
+  out_frame.buffer = this->packet_;
+  out_frame.len = this->packet_size_;
+
+  const uint32_t start = micros();
+  const esp_audio_err_t err = esp_opus_enc_process(this->handle_, &in_frame, &out_frame);
+  const uint32_t elapsed = micros() - start;
+  if (err != ESP_AUDIO_ERR_OK) {
+    return -1;
+  }
+
+  ++this->frames_;
+  this->max_encode_us_ = std::max(this->max_encode_us_, elapsed);
+  this->total_encode_us_ += elapsed;
+  this->encoded_bytes_ += out_frame.encoded_bytes;
+  return out_frame.encoded_bytes;
+}
+
+uint32_t OpusEncoder::get_average_bitrate() const {
+  const uint64_t duration_ms = static_cast<uint64_t>(this->frames_) * OPUS_FRAME_DURATION_MS;
+  if (duration_ms == 0) {
+    return 0;
+  }
+  return static_cast<uint32_t>(this->encoded_bytes_ * 8 * 1000 / duration_ms);
+}
+
+}  // namespace voice_assistant
+}  // namespace esphome
+
+#endif  // USE_VOICE_ASSISTANT_OPUS
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_VOICE_ASSISTANT_OPUS
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace voice_assistant {
+
+/// @brief Encodes mono 16 bit PCM into 20 ms Opus packets using the esp_audio_codec encoder. Keeps encode time and
+/// size statistics since it was opened.
+class OpusEncoder {
+ public:
+  ~OpusEncoder() { this->close(); }
+
+  /// @brief Creates the encoder and allocates the packet buffer
+  /// @return True if successful, false otherwise
+  bool open(uint32_t sample_rate, uint32_t bitrate, uint8_t complexity);
+
+  /// @brief Destroys the encoder and frees the packet buffer
+  void close();
+
+  bool is_open() const { return this->handle_ != nullptr; }
+
+  /// @brief Returns how many PCM bytes make up one packet
+  size_t get_frame_bytes() const { return this->frame_bytes_; }
+
+  /// @brief Encodes one frame of get_frame_bytes() PCM bytes
+  /// @return Size of the packet in get_packet(), or -1 if encoding failed
+  int32_t encode(const uint8_t *pcm);
+
+  const uint8_t *get_packet() const { return this->packet_; }
+
+  uint32_t get_frames() const { return this->frames_; }
+  uint32_t get_max_encode_us() const { return this->max_encode_us_; }
+  uint32_t get_average_encode_us() const {
+    return this->frames_ == 0 ? 0 : static_cast<uint32_t>(this->total_encode_us_ / this->frames_);
+  }
+  /// @brief Returns the average bitrate of the packets so far, in bits per second
+  uint32_t get_average_bitrate() const;
+
+ protected:
+  void *handle_{nullptr};
+  uint8_t *packet_{nullptr};
+  size_t packet_size_{0};
+  size_t frame_bytes_{0};
+  uint32_t sample_rate_{0};
+
+  uint32_t frames_{0};
+  uint32_t max_encode_us_{0};
+  uint64_t total_encode_us_{0};
+  uint64_t encoded_bytes_{0};
+};
+
+}  // namespace voice_assistant
+}  // namespace esphome
+
+#endif  // USE_VOICE_ASSISTANT_OPUS
@@ -19,8 +19,7 @@ static const char *const TAG = "voice_assistant";
 
 static const size_t SAMPLE_RATE_HZ = 16000;
 
-static const size_t RING_BUFFER_SAMPLES = 512 * SAMPLE_RATE_HZ / 1000;  // 512 ms * 16 kHz/ 1000 ms
-static const size_t RING_BUFFER_SIZE = RING_BUFFER_SAMPLES * sizeof(int16_t);
+static const uint32_t MIC_BUFFER_DURATION_MS = 512;
 static const size_t SEND_BUFFER_SAMPLES = 32 * SAMPLE_RATE_HZ / 1000;  // 32ms * 16kHz / 1000ms
 static const size_t SEND_BUFFER_SIZE = SEND_BUFFER_SAMPLES * sizeof(int16_t);
 static const size_t RECEIVE_SIZE = 1024;
@@ -29,12 +28,7 @@ static const size_t SPEAKER_BUFFER_SIZE = 16 * RECEIVE_SIZE;
 VoiceAssistant::VoiceAssistant() { global_voice_assistant = this; }
 
 void VoiceAssistant::setup() {
-  this->mic_source_->add_data_callback([this](const std::vector<uint8_t> &data) {
-    std::shared_ptr<RingBuffer> temp_ring_buffer = this->ring_buffer_;
-    if (this->ring_buffer_.use_count() > 1) {
-      temp_ring_buffer->write((void *) data.data(), data.size());
-    }
-  });
+  this->mic_reader_ = this->mic_source_->create_reader(MIC_BUFFER_DURATION_MS);
 
 #ifdef USE_MEDIA_PLAYER
   if (this->media_player_ != nullptr) {
@@ -115,14 +109,6 @@ bool VoiceAssistant::allocate_buffers_() {
   }
 #endif
 
-  if (this->ring_buffer_.use_count() == 0) {
-    this->ring_buffer_ = RingBuffer::create(RING_BUFFER_SIZE);
-    if (this->ring_buffer_.use_count() == 0) {
-      ESP_LOGE(TAG, "Could not allocate ring buffer");
-      return false;
-    }
-  }
-
   if (this->send_buffer_ == nullptr) {
     RAMAllocator<uint8_t> send_allocator;
     this->send_buffer_ = send_allocator.allocate(SEND_BUFFER_SIZE);
@@ -140,9 +126,7 @@ void VoiceAssistant::clear_buffers_() {
     memset(this->send_buffer_, 0, SEND_BUFFER_SIZE);
   }
 
-  if (this->ring_buffer_ != nullptr) {
-    this->ring_buffer_->reset();
-  }
+  this->mic_reader_->reset();
 
 #ifdef USE_SPEAKER
   if ((this->speaker_ != nullptr) && (this->speaker_buffer_ != nullptr)) {
@@ -156,16 +140,14 @@ void VoiceAssistant::clear_buffers_() {
 }
 
 void VoiceAssistant::deallocate_buffers_() {
+  this->stop_stream_codec_();
+
   if (this->send_buffer_ != nullptr) {
     RAMAllocator<uint8_t> send_deallocator;
     send_deallocator.deallocate(this->send_buffer_, SEND_BUFFER_SIZE);
     this->send_buffer_ = nullptr;
   }
 
-  if (this->ring_buffer_.use_count() > 0) {
-    this->ring_buffer_.reset();
-  }
-
 #ifdef USE_SPEAKER
   if ((this->speaker_ != nullptr) && (this->speaker_buffer_ != nullptr)) {
     RAMAllocator<uint8_t> speaker_deallocator;
@@ -235,6 +217,10 @@ void VoiceAssistant::loop() {
       audio_settings.noise_suppression_level = this->noise_suppression_level_;
       audio_settings.auto_gain = this->auto_gain_;
       audio_settings.volume_multiplier = this->volume_multiplier_;
+#ifdef USE_VOICE_ASSISTANT_OPUS
+      audio_settings.codec = api::enums::VOICE_ASSISTANT_AUDIO_CODEC_OPUS;
+      audio_settings.bitrate = this->opus_bitrate_;
+#endif
 
       api::VoiceAssistantRequest msg;
       msg.start = true;
@@ -268,12 +254,35 @@ void VoiceAssistant::loop() {
       break;  // State changed when udp server port received
     }
     case State::STREAMING_MICROPHONE: {
-      size_t available = this->ring_buffer_->available();
-      while (available >= SEND_BUFFER_SIZE) {
-        size_t read_bytes = this->ring_buffer_->read((void *) this->send_buffer_, SEND_BUFFER_SIZE, 0);
+      size_t chunk_bytes = SEND_BUFFER_SIZE;
+#ifdef USE_VOICE_ASSISTANT_OPUS
+      if (this->opus_encoder_.is_open()) {
+        chunk_bytes = this->opus_encoder_.get_frame_bytes();
+      }
+#endif
+      size_t available = this->mic_reader_->available();
+      while (available >= chunk_bytes) {
+        size_t read_bytes = this->mic_reader_->read(this->send_buffer_, chunk_bytes, 0);
+        const uint8_t *payload = this->send_buffer_;
+        size_t payload_bytes = read_bytes;
+#ifdef USE_VOICE_ASSISTANT_OPUS
+        if (this->opus_encoder_.is_open()) {
+          // Each Opus packet is sent on its own, so the client can decode every API message or datagram separately
+          int32_t packet_bytes = (read_bytes == chunk_bytes) ? this->opus_encoder_.encode(this->send_buffer_) : -1;
+          if (packet_bytes < 0) {
+            ESP_LOGW(TAG, "Could not encode the microphone audio");
+            this->error_trigger_->trigger("audio-codec", "Could not encode the microphone audio");
+            this->signal_stop_();
+            this->set_state_(State::STOP_MICROPHONE, State::IDLE);
+            break;
+          }
+          payload = this->opus_encoder_.get_packet();
+          payload_bytes = packet_bytes;
+        }
+#endif
         if (this->audio_mode_ == AUDIO_MODE_API) {
           api::VoiceAssistantAudio msg;
-          msg.set_data(this->send_buffer_, read_bytes);
+          msg.set_data(payload, payload_bytes);
           this->api_client_->send_message(msg, api::VoiceAssistantAudio::MESSAGE_TYPE);
         } else {
           if (!this->udp_socket_running_) {
@@ -282,15 +291,16 @@ void VoiceAssistant::loop() {
               break;
             }
           }
-          this->socket_->sendto(this->send_buffer_, read_bytes, 0, (struct sockaddr *) &this->dest_addr_,
+          this->socket_->sendto(payload, payload_bytes, 0, (struct sockaddr *) &this->dest_addr_,
                                 sizeof(this->dest_addr_));
         }
-        available = this->ring_buffer_->available();
+        available = this->mic_reader_->available();
       }
 
       break;
     }
     case State::STOP_MICROPHONE: {
+      this->stop_stream_codec_();
       if (this->mic_source_->is_running()) {
         this->mic_source_->stop();
         this->set_state_(State::STOPPING_MICROPHONE);
@@ -491,7 +501,7 @@ void VoiceAssistant::failed_to_start() {
   this->set_state_(State::STOP_MICROPHONE, State::IDLE);
 }
 
-void VoiceAssistant::start_streaming() {
+void VoiceAssistant::start_streaming(api::enums::VoiceAssistantAudioCodec codec) {
   if (this->state_ != State::STARTING_PIPELINE) {
     this->signal_stop_();
     return;
@@ -500,6 +510,13 @@ void VoiceAssistant::start_streaming() {
   ESP_LOGD(TAG, "Client started, streaming microphone");
   this->audio_mode_ = AUDIO_MODE_API;
 
+  if (!this->start_stream_codec_(codec)) {
+    this->error_trigger_->trigger("audio-codec", "Could not encode the microphone audio");
+    this->signal_stop_();
+    this->set_state_(State::STOP_MICROPHONE, State::IDLE);
+    return;
+  }
+
   if (this->mic_source_->is_running()) {
     this->set_state_(State::STREAMING_MICROPHONE, State::STREAMING_MICROPHONE);
   } else {
@@ -507,7 +524,8 @@ void VoiceAssistant::start_streaming() {
   }
 }
 
-void VoiceAssistant::start_streaming(struct sockaddr_storage *addr, uint16_t port) {
+void VoiceAssistant::start_streaming(struct sockaddr_storage *addr, uint16_t port,
+                                     api::enums::VoiceAssistantAudioCodec codec) {
   if (this->state_ != State::STARTING_PIPELINE) {
     this->signal_stop_();
     return;
@@ -530,6 +548,13 @@ void VoiceAssistant::start_streaming(struct sockaddr_storage *addr, uint16_t por
     return;
   }
 
+  if (!this->start_stream_codec_(codec)) {
+    this->error_trigger_->trigger("audio-codec", "Could not encode the microphone audio");
+    this->signal_stop_();
+    this->set_state_(State::STOP_MICROPHONE, State::IDLE);
+    return;
+  }
+
   if (this->mic_source_->is_running()) {
     this->set_state_(State::STREAMING_MICROPHONE, State::STREAMING_MICROPHONE);
   } else {
@@ -537,6 +562,41 @@ void VoiceAssistant::start_streaming(struct sockaddr_storage *addr, uint16_t por
   }
 }
 
+bool VoiceAssistant::start_stream_codec_(api::enums::VoiceAssistantAudioCodec codec) {
+  if (codec == api::enums::VOICE_ASSISTANT_AUDIO_CODEC_PCM) {
+    return true;
+  }
+#ifdef USE_VOICE_ASSISTANT_OPUS
+  if (codec == api::enums::VOICE_ASSISTANT_AUDIO_CODEC_OPUS) {
+    ESP_LOGD(TAG, "Encoding the microphone audio as Opus at %" PRIu32 " bps", this->opus_bitrate_);
+    if (!this->opus_encoder_.open(SAMPLE_RATE_HZ, this->opus_bitrate_, this->opus_complexity_)) {
+      return false;
+    }
+    if (this->opus_encoder_.get_frame_bytes() > SEND_BUFFER_SIZE) {
+      // Frames are read from the microphone into the send buffer
+      this->opus_encoder_.close();
+      return false;
+    }
+    return true;
+  }
+#endif
+  ESP_LOGW(TAG, "Client accepted an audio codec that wasn't offered");
+  return false;
+}
+
+void VoiceAssistant::stop_stream_codec_() {
+#ifdef USE_VOICE_ASSISTANT_OPUS
+  if (this->opus_encoder_.is_open()) {
+    if (this->opus_encoder_.get_frames() > 0) {
+      ESP_LOGD(TAG, "Opus: %" PRIu32 " frames, average %" PRIu32 " us, max %" PRIu32 " us, %" PRIu32 " bps",
+               this->opus_encoder_.get_frames(), this->opus_encoder_.get_average_encode_us(),
+               this->opus_encoder_.get_max_encode_us(), this->opus_encoder_.get_average_bitrate());
+    }
+    this->opus_encoder_.close();
+  }
+#endif
+}
+
 void VoiceAssistant::request_start(bool continuous, bool silence_detection) {
   if (this->api_client_ == nullptr) {
     ESP_LOGE(TAG, "No API client connected");
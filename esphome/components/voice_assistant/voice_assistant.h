@@ -7,7 +7,6 @@
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
-#include "esphome/core/ring_buffer.h"
 
 #include "esphome/components/api/api_connection.h"
 #include "esphome/components/api/api_pb2.h"
@@ -23,6 +22,10 @@
 #endif
 #include "esphome/components/socket/socket.h"
 
+#ifdef USE_VOICE_ASSISTANT_OPUS
+#include "opus_encoder.h"
+#endif
+
 #include <unordered_map>
 #include <vector>
 
@@ -41,6 +44,7 @@ enum VoiceAssistantFeature : uint32_t {
   FEATURE_TIMERS = 1 << 3,
   FEATURE_ANNOUNCE = 1 << 4,
   FEATURE_START_CONVERSATION = 1 << 5,
+  FEATURE_OPUS_AUDIO = 1 << 6,
 };
 
 enum class State {
@@ -106,8 +110,9 @@ class VoiceAssistant : public Component {
   void loop() override;
   void setup() override;
   float get_setup_priority() const override;
-  void start_streaming();
-  void start_streaming(struct sockaddr_storage *addr, uint16_t port);
+  void start_streaming(api::enums::VoiceAssistantAudioCodec codec = api::enums::VOICE_ASSISTANT_AUDIO_CODEC_PCM);
+  void start_streaming(struct sockaddr_storage *addr, uint16_t port,
+                       api::enums::VoiceAssistantAudioCodec codec = api::enums::VOICE_ASSISTANT_AUDIO_CODEC_PCM);
   void failed_to_start();
 
   void set_microphone_source(microphone::MicrophoneSource *mic_source) { this->mic_source_ = mic_source; }
@@ -157,6 +162,10 @@ class VoiceAssistant : public Component {
     }
 #endif
 
+#ifdef USE_VOICE_ASSISTANT_OPUS
+    flags |= VoiceAssistantFeature::FEATURE_OPUS_AUDIO;
+#endif
+
     return flags;
   }
 
@@ -182,6 +191,10 @@ class VoiceAssistant : public Component {
   void set_auto_gain(uint8_t auto_gain) { this->auto_gain_ = auto_gain; }
   void set_volume_multiplier(float volume_multiplier) { this->volume_multiplier_ = volume_multiplier; }
   void set_conversation_timeout(uint32_t conversation_timeout) { this->conversation_timeout_ = conversation_timeout; }
+#ifdef USE_VOICE_ASSISTANT_OPUS
+  void set_opus_bitrate(uint32_t bitrate) { this->opus_bitrate_ = bitrate; }
+  void set_opus_complexity(uint8_t complexity) { this->opus_complexity_ = complexity; }
+#endif
   void reset_conversation_id();
 
   Trigger<> *get_intent_end_trigger() const { return this->intent_end_trigger_; }
@@ -229,6 +242,12 @@ class VoiceAssistant : public Component {
   void signal_stop_();
   void start_playback_timeout_();
 
+  /// @brief Sets up encoding the microphone audio with the codec the client accepted
+  /// @return True if successful, false if the codec can't be used
+  bool start_stream_codec_(api::enums::VoiceAssistantAudioCodec codec);
+  /// @brief Stops encoding the microphone audio and logs the encoder's statistics
+  void stop_stream_codec_();
+
   std::unique_ptr<socket::Socket> socket_ = nullptr;
   struct sockaddr_storage dest_addr_;
 
@@ -291,7 +310,7 @@ class VoiceAssistant : public Component {
 
   std::string wake_word_{""};
 
-  std::shared_ptr<RingBuffer> ring_buffer_;
+  std::unique_ptr<microphone::MicrophoneReader> mic_reader_;
 
   bool use_wake_word_;
   uint8_t noise_suppression_level_;
@@ -301,6 +320,12 @@ class VoiceAssistant : public Component {
 
   uint8_t *send_buffer_{nullptr};
 
+#ifdef USE_VOICE_ASSISTANT_OPUS
+  OpusEncoder opus_encoder_;
+  uint32_t opus_bitrate_{24000};
+  uint8_t opus_complexity_{0};
+#endif
+
   bool continuous_{false};
   bool silence_detection_;
 
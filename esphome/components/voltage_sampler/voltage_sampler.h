@@ -2,6 +2,10 @@
 
 #include "esphome/core/component.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
 namespace esphome {
 namespace voltage_sampler {
 
@@ -10,6 +14,16 @@ class VoltageSampler {
  public:
   /// Get a voltage reading, in V.
   virtual float sample() = 0;
+
+  /** The rate in Hz of the blocks passed to add_on_samples_callback() callbacks.
+   *
+   * Samplers that convert in the background at a fixed rate (like the ESP32 ADC in continuous mode) return it, others
+   * return 0 and only support sample().
+   */
+  virtual uint32_t get_sample_rate() const { return 0; }
+
+  /// Called from the main loop with every block of new readings, in V, when get_sample_rate() is not 0.
+  virtual void add_on_samples_callback(std::function<void(const float *, size_t)> &&callback) {}
 };
 
 }  // namespace voltage_sampler
@@ -155,8 +155,10 @@ void WaveshareEPaper2P13InV3::full_update_() {
 }
 
 void WaveshareEPaper2P13InV3::display() {
-  if (this->is_busy_ || (this->busy_pin_ != nullptr && this->busy_pin_->digital_read()))
+  if (this->is_busy_ || (this->busy_pin_ != nullptr && this->busy_pin_->digital_read())) {
+    this->invalidate_frame_hash_();
     return;
+  }
   this->is_busy_ = true;
   const bool partial = this->at_update_ != 0;
   this->at_update_ = (this->at_update_ + 1) % this->full_update_every_;
@@ -169,8 +169,33 @@ bool WaveshareEPaperBase::wait_until_idle_() {
 }
 void WaveshareEPaperBase::update() {
   this->do_update_();
+  if (this->skip_unchanged_) {
+    const uint32_t hash = this->frame_hash_();
+    if (this->frame_hash_valid_ && hash == this->last_frame_hash_) {
+      ESP_LOGV(TAG, "Frame unchanged, skipping refresh");
+      return;
+    }
+    this->last_frame_hash_ = hash;
+    this->frame_hash_valid_ = true;
+  }
   this->display();
 }
+
+// 32 bit FNV-1a, cheap compared to a refresh, and an unnoticed change is very unlikely
+static uint32_t fnv1a_hash(uint32_t hash, const uint8_t *data, size_t length) {
+  for (size_t i = 0; i != length; i++) {
+    hash ^= data[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+static const uint32_t FNV1A_OFFSET_BASIS = 2166136261UL;
+
+uint32_t WaveshareEPaperBase::frame_hash_() {
+  if (this->buffer_ == nullptr)
+    return 0;
+  return fnv1a_hash(FNV1A_OFFSET_BASIS, this->buffer_, this->get_buffer_length_());
+}
 void WaveshareEPaper::fill(Color color) {
   // flip logic
   const uint8_t fill = color.is_on() ? 0x00 : 0xFF;
@@ -184,6 +209,16 @@ void WaveshareEPaper7C::setup() {
   this->reset_();
   this->initialize();
 }
+uint32_t WaveshareEPaper7C::frame_hash_() {
+  const uint32_t small_buffer_length = this->get_buffer_length_() / NUM_BUFFERS;
+  uint32_t hash = FNV1A_OFFSET_BASIS;
+  for (auto *buffer : this->buffers_) {
+    if (buffer == nullptr)
+      return 0;
+    hash = fnv1a_hash(hash, buffer, small_buffer_length);
+  }
+  return hash;
+}
 void WaveshareEPaper7C::init_internal_7c_(uint32_t buffer_length) {
   RAMAllocator<uint8_t> allocator;
   uint32_t small_buffer_length = buffer_length / NUM_BUFFERS;
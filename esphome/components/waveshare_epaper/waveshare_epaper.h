@@ -16,6 +16,8 @@ class WaveshareEPaperBase : public display::DisplayBuffer,
   void set_reset_pin(GPIOPin *reset) { this->reset_pin_ = reset; }
   void set_busy_pin(GPIOPin *busy) { this->busy_pin_ = busy; }
   void set_reset_duration(uint32_t reset_duration) { this->reset_duration_ = reset_duration; }
+  /// Skip refreshing the panel when an update draws the same frame as the one shown
+  void set_skip_unchanged(bool skip_unchanged) { this->skip_unchanged_ = skip_unchanged; }
 
   void command(uint8_t value);
   void data(uint8_t value);
@@ -47,6 +49,11 @@ class WaveshareEPaperBase : public display::DisplayBuffer,
 
   virtual int get_width_controller() { return this->get_width_internal(); };
 
+  /// Hash of the frame in the buffer, to detect updates that change nothing
+  virtual uint32_t frame_hash_();
+  /// Models that drop frames while busy call this, so the dropped frame is not taken as shown
+  void invalidate_frame_hash_() { this->frame_hash_valid_ = false; }
+
   virtual uint32_t get_buffer_length_() = 0;  // NOLINT(readability-identifier-naming)
   uint32_t reset_duration_{200};
 
@@ -59,6 +66,10 @@ class WaveshareEPaperBase : public display::DisplayBuffer,
   GPIOPin *dc_pin_;
   GPIOPin *busy_pin_{nullptr};
   virtual uint32_t idle_timeout_() { return 1000u; }  // NOLINT(readability-identifier-naming)
+
+  bool skip_unchanged_{false};
+  bool frame_hash_valid_{false};
+  uint32_t last_frame_hash_{0};
 };
 
 class WaveshareEPaper : public WaveshareEPaperBase {
@@ -95,6 +106,7 @@ class WaveshareEPaper7C : public WaveshareEPaperBase {
   uint32_t get_buffer_length_() override;
   void setup() override;
 
+  uint32_t frame_hash_() override;
   void init_internal_7c_(uint32_t buffer_length);
   void send_buffers_();
   void reset_();
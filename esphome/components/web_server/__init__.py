@@ -1,6 +1,8 @@
 from __future__ import annotations
 
 import gzip
+import hashlib
+from pathlib import Path
 
 import esphome.codegen as cg
 from esphome.components import web_server_base
@@ -40,6 +42,9 @@ AUTO_LOAD = ["json", "web_server_base"]
 CONF_SORTING_GROUP_ID = "sorting_group_id"
 CONF_SORTING_GROUPS = "sorting_groups"
 CONF_SORTING_WEIGHT = "sorting_weight"
+CONF_STATE_COALESCE_INTERVAL = "state_coalesce_interval"
+CONF_STATE_MIN_INTERVAL = "state_min_interval"
+CONF_WORKER_TASKS = "worker_tasks"
 
 
 web_server_ns = cg.esphome_ns.namespace("web_server")
@@ -190,6 +195,17 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_LOG, default=True): cv.boolean,
             cv.Optional(CONF_LOCAL): cv.boolean,
             cv.Optional(CONF_SORTING_GROUPS): cv.ensure_list(sorting_group),
+            cv.Optional(CONF_STATE_MIN_INTERVAL): cv.All(
+                cv.only_with_esp_idf, cv.positive_time_period_milliseconds
+            ),
+            cv.Optional(CONF_STATE_COALESCE_INTERVAL): cv.All(
+                cv.only_with_esp_idf, cv.positive_time_period_milliseconds
+            ),
+            cv.Optional(CONF_WORKER_TASKS): cv.All(
+                cv.only_with_esp_idf,
+                cv.require_framework_version(esp_idf=cv.Version(5, 1, 0)),
+                cv.int_range(min=1, max=4),
+            ),
         }
     ).extend(cv.COMPONENT_SCHEMA),
     cv.only_on(
@@ -234,17 +250,22 @@ async def add_entity_config(entity, config):
     )
 
 
-def build_index_html(config) -> str:
+def build_index_html(
+    config, css_etag: str | None = None, js_etag: str | None = None
+) -> str:
+    """Build the v2/v3 index page.
+
+    The includes are linked with their ETag as query string so browsers can cache
+    them forever and still pick up a new version after a firmware update.
+    """
     html = "<!DOCTYPE html><html><head><meta charset=UTF-8><link rel=icon href=data:>"
-    css_include = config.get(CONF_CSS_INCLUDE)
-    js_include = config.get(CONF_JS_INCLUDE)
-    if css_include:
-        html += "<link rel=stylesheet href=/0.css>"
+    if css_etag:
+        html += f"<link rel=stylesheet href=/0.css?v={css_etag}>"
     if config[CONF_CSS_URL]:
         html += f'<link rel=stylesheet href="{config[CONF_CSS_URL]}">'
     html += "</head><body>"
-    if js_include:
-        html += "<script type=module src=/0.js></script>"
+    if js_etag:
+        html += f"<script type=module src=/0.js?v={js_etag}></script>"
     html += "<esp-app></esp-app>"
     if config[CONF_JS_URL]:
         html += f'<script src="{config[CONF_JS_URL]}"></script>'
@@ -252,11 +273,24 @@ def build_index_html(config) -> str:
     return html
 
 
+def add_resource_etag(resource_name: str, content: bytes) -> str:
+    """Add a strong ETag derived from the resource content and return it."""
+    etag = hashlib.sha256(content).hexdigest()[:16]
+    cg.add_global(
+        cg.RawExpression(
+            f'const char ESPHOME_WEBSERVER_{resource_name}_ETAG[] = "\\"{etag}\\""'
+        )
+    )
+    return etag
+
+
 def add_resource_as_progmem(
     resource_name: str, content: str, compress: bool = True
-) -> None:
-    """Add a resource to progmem."""
+) -> str:
+    """Add a resource and its ETag to progmem, returns the ETag."""
     content_encoded = content.encode("utf-8")
+    # Hash before compressing, the gzip header contains a timestamp
+    etag = add_resource_etag(resource_name, content_encoded)
     if compress:
         content_encoded = gzip.compress(content_encoded)
     content_encoded_size = len(content_encoded)
@@ -267,6 +301,7 @@ def add_resource_as_progmem(
     )
     cg.add_global(cg.RawExpression(uint8_t))
     cg.add_global(cg.RawExpression(size_t))
+    return etag
 
 
 @coroutine_with_priority(40.0)
@@ -282,9 +317,23 @@ async def to_code(config):
     cg.add_define("USE_WEBSERVER")
     cg.add_define("USE_WEBSERVER_PORT", config[CONF_PORT])
     cg.add_define("USE_WEBSERVER_VERSION", version)
+    css_etag = None
+    if CONF_CSS_INCLUDE in config:
+        cg.add_define("USE_WEBSERVER_CSS_INCLUDE")
+        path = CORE.relative_config_path(config[CONF_CSS_INCLUDE])
+        with open(file=path, encoding="utf-8") as css_file:
+            css_etag = add_resource_as_progmem("CSS_INCLUDE", css_file.read())
+    js_etag = None
+    if CONF_JS_INCLUDE in config:
+        cg.add_define("USE_WEBSERVER_JS_INCLUDE")
+        path = CORE.relative_config_path(config[CONF_JS_INCLUDE])
+        with open(file=path, encoding="utf-8") as js_file:
+            js_etag = add_resource_as_progmem("JS_INCLUDE", js_file.read())
     if version >= 2:
         # Don't compress the index HTML as the data sizes are almost the same.
-        add_resource_as_progmem("INDEX_HTML", build_index_html(config), compress=False)
+        add_resource_as_progmem(
+            "INDEX_HTML", build_index_html(config, css_etag, js_etag), compress=False
+        )
     else:
         cg.add(var.set_css_url(config[CONF_CSS_URL]))
         cg.add(var.set_js_url(config[CONF_JS_URL]))
@@ -300,19 +349,17 @@ async def to_code(config):
     if CONF_AUTH in config:
         cg.add(paren.set_auth_username(config[CONF_AUTH][CONF_USERNAME]))
         cg.add(paren.set_auth_password(config[CONF_AUTH][CONF_PASSWORD]))
-    if CONF_CSS_INCLUDE in config:
-        cg.add_define("USE_WEBSERVER_CSS_INCLUDE")
-        path = CORE.relative_config_path(config[CONF_CSS_INCLUDE])
-        with open(file=path, encoding="utf-8") as css_file:
-            add_resource_as_progmem("CSS_INCLUDE", css_file.read())
-    if CONF_JS_INCLUDE in config:
-        cg.add_define("USE_WEBSERVER_JS_INCLUDE")
-        path = CORE.relative_config_path(config[CONF_JS_INCLUDE])
-        with open(file=path, encoding="utf-8") as js_file:
-            add_resource_as_progmem("JS_INCLUDE", js_file.read())
     cg.add(var.set_include_internal(config[CONF_INCLUDE_INTERNAL]))
+    if CONF_STATE_MIN_INTERVAL in config:
+        cg.add(var.set_state_min_interval(config[CONF_STATE_MIN_INTERVAL]))
+    if CONF_STATE_COALESCE_INTERVAL in config:
+        cg.add(var.set_state_coalesce_interval(config[CONF_STATE_COALESCE_INTERVAL]))
+    if CONF_WORKER_TASKS in config:
+        cg.add_define("USE_WEBSERVER_IDF_WORKER_TASKS", config[CONF_WORKER_TASKS])
     if CONF_LOCAL in config and config[CONF_LOCAL]:
         cg.add_define("USE_WEBSERVER_LOCAL")
+        index_header = Path(__file__).parent / f"server_index_v{version}.h"
+        add_resource_etag("INDEX_GZ", index_header.read_bytes())
 
     if (sorting_group_config := config.get(CONF_SORTING_GROUPS)) is not None:
         cg.add_define("USE_WEBSERVER_SORTING")
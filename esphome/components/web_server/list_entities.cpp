@@ -14,7 +14,8 @@ ListEntitiesIterator::ListEntitiesIterator(const WebServer *ws, DeferredUpdateEv
     : web_server_(ws), events_(es) {}
 #endif
 #ifdef USE_ESP_IDF
-ListEntitiesIterator::ListEntitiesIterator(const WebServer *ws, AsyncEventSource *es) : web_server_(ws), events_(es) {}
+ListEntitiesIterator::ListEntitiesIterator(const WebServer *ws, AsyncEventSourceResponse *es)
+    : web_server_(ws), events_(es) {}
 #endif
 ListEntitiesIterator::~ListEntitiesIterator() {}
 
@@ -7,7 +7,7 @@
 namespace esphome {
 #ifdef USE_ESP_IDF
 namespace web_server_idf {
-class AsyncEventSource;
+class AsyncEventSourceResponse;
 }
 #endif
 namespace web_server {
@@ -23,7 +23,7 @@ class ListEntitiesIterator : public ComponentIterator {
   ListEntitiesIterator(const WebServer *ws, DeferredUpdateEventSource *es);
 #endif
 #ifdef USE_ESP_IDF
-  ListEntitiesIterator(const WebServer *ws, esphome::web_server_idf::AsyncEventSource *es);
+  ListEntitiesIterator(const WebServer *ws, esphome::web_server_idf::AsyncEventSourceResponse *es);
 #endif
   virtual ~ListEntitiesIterator();
 #ifdef USE_BINARY_SENSOR
@@ -94,7 +94,8 @@ class ListEntitiesIterator : public ComponentIterator {
   DeferredUpdateEventSource *events_;
 #endif
 #ifdef USE_ESP_IDF
-  esphome::web_server_idf::AsyncEventSource *events_;
+  // The client the iteration is for, the other clients run their own
+  esphome::web_server_idf::AsyncEventSourceResponse *events_;
 #endif
 };
 
@@ -142,8 +142,13 @@ void DeferredUpdateEventSource::process_deferred_queue_() {
 
 void DeferredUpdateEventSource::loop() {
   process_deferred_queue_();
-  if (!this->entities_iterator_.completed())
+  // Send initial entity states while the client queue takes them, within a time budget per loop iteration. A full
+  // queue defers the event and pauses the iteration until it drained.
+  const uint32_t start = millis();
+  while (!this->entities_iterator_.completed() && this->deferred_queue_.empty() &&
+         millis() - start < INITIAL_STATES_BUDGET_MS) {
     this->entities_iterator_.advance();
+  }
 }
 
 void DeferredUpdateEventSource::deferrable_send_state(void *source, const char *event_type,
@@ -314,27 +319,64 @@ void WebServer::dump_config() {
 }
 float WebServer::get_setup_priority() const { return setup_priority::WIFI - 1.0f; }
 
-#ifdef USE_WEBSERVER_LOCAL
-void WebServer::handle_index_request(AsyncWebServerRequest *request) {
+#if USE_WEBSERVER_VERSION >= 2 || defined(USE_WEBSERVER_CSS_INCLUDE) || defined(USE_WEBSERVER_JS_INCLUDE)
+// The index has a fixed URL, browsers have to revalidate it but get a 304 as long as the firmware did not change
+static const char *const CACHE_CONTROL_INDEX = "no-cache";
+#if USE_WEBSERVER_VERSION >= 2
+// The generated index links /0.css and /0.js with their content hash, so a changed include comes with a new URL
+static const char *const CACHE_CONTROL_INCLUDE = "max-age=31536000, immutable";
+#else
+static const char *const CACHE_CONTROL_INCLUDE = "no-cache";
+#endif
+
+static bool etag_matches(AsyncWebServerRequest *request, const char *etag) {
+#ifdef USE_ESP_IDF
+  auto if_none_match = request->get_header("If-None-Match");
+  return if_none_match.has_value() && *if_none_match == etag;
+#else
+  const AsyncWebHeader *if_none_match = request->getHeader("If-None-Match");
+  return if_none_match != nullptr && if_none_match->value() == etag;
+#endif
+}
+
+void WebServer::send_static_(AsyncWebServerRequest *request, const char *content_type, const uint8_t *data,
+                             size_t size, const char *etag, const char *cache_control, bool gzip) {
+  AsyncWebServerResponse *response;
+  if (etag_matches(request, etag)) {
+    response = request->beginResponse(304, "");
+  } else {
+    // Sent straight from flash, the content is never copied to RAM
 #ifndef USE_ESP8266
-  AsyncWebServerResponse *response = request->beginResponse(200, "text/html", INDEX_GZ, sizeof(INDEX_GZ));
+    response = request->beginResponse(200, content_type, data, size);
 #else
-  AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", INDEX_GZ, sizeof(INDEX_GZ));
+    response = request->beginResponse_P(200, content_type, data, size);
 #endif
-  response->addHeader("Content-Encoding", "gzip");
+    if (gzip)
+      response->addHeader("Content-Encoding", "gzip");
+  }
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", cache_control);
   request->send(response);
 }
+#endif
+
+#ifdef USE_WEBSERVER_LOCAL
+void WebServer::handle_index_request(AsyncWebServerRequest *request) {
+  this->send_static_(request, "text/html", INDEX_GZ, sizeof(INDEX_GZ), ESPHOME_WEBSERVER_INDEX_GZ_ETAG,
+                     CACHE_CONTROL_INDEX, true);
+}
 #elif USE_WEBSERVER_VERSION >= 2
 void WebServer::handle_index_request(AsyncWebServerRequest *request) {
-#ifndef USE_ESP8266
-  AsyncWebServerResponse *response =
-      request->beginResponse(200, "text/html", ESPHOME_WEBSERVER_INDEX_HTML, ESPHOME_WEBSERVER_INDEX_HTML_SIZE);
-#else
-  AsyncWebServerResponse *response =
-      request->beginResponse_P(200, "text/html", ESPHOME_WEBSERVER_INDEX_HTML, ESPHOME_WEBSERVER_INDEX_HTML_SIZE);
-#endif
   // No gzip header here because the HTML file is so small
-  request->send(response);
+  this->send_static_(request, "text/html", ESPHOME_WEBSERVER_INDEX_HTML, ESPHOME_WEBSERVER_INDEX_HTML_SIZE,
+                     ESPHOME_WEBSERVER_INDEX_HTML_ETAG, CACHE_CONTROL_INDEX, false);
+}
+#endif
+
+#ifdef USE_LOGGER_PERSISTENT_LOG
+void WebServer::handle_previous_log_request(AsyncWebServerRequest *request) {
+  const char *previous_log = logger::global_logger->get_persistent_log().get_previous_log();
+  request->send(200, "text/plain", previous_log != nullptr ? previous_log : "");
 }
 #endif
 
@@ -351,29 +393,15 @@ void WebServer::handle_pna_cors_request(AsyncWebServerRequest *request) {
 
 #ifdef USE_WEBSERVER_CSS_INCLUDE
 void WebServer::handle_css_request(AsyncWebServerRequest *request) {
-#ifndef USE_ESP8266
-  AsyncWebServerResponse *response =
-      request->beginResponse(200, "text/css", ESPHOME_WEBSERVER_CSS_INCLUDE, ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE);
-#else
-  AsyncWebServerResponse *response =
-      request->beginResponse_P(200, "text/css", ESPHOME_WEBSERVER_CSS_INCLUDE, ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE);
-#endif
-  response->addHeader("Content-Encoding", "gzip");
-  request->send(response);
+  this->send_static_(request, "text/css", ESPHOME_WEBSERVER_CSS_INCLUDE, ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE,
+                     ESPHOME_WEBSERVER_CSS_INCLUDE_ETAG, CACHE_CONTROL_INCLUDE, true);
 }
 #endif
 
 #ifdef USE_WEBSERVER_JS_INCLUDE
 void WebServer::handle_js_request(AsyncWebServerRequest *request) {
-#ifndef USE_ESP8266
-  AsyncWebServerResponse *response =
-      request->beginResponse(200, "text/javascript", ESPHOME_WEBSERVER_JS_INCLUDE, ESPHOME_WEBSERVER_JS_INCLUDE_SIZE);
-#else
-  AsyncWebServerResponse *response =
-      request->beginResponse_P(200, "text/javascript", ESPHOME_WEBSERVER_JS_INCLUDE, ESPHOME_WEBSERVER_JS_INCLUDE_SIZE);
-#endif
-  response->addHeader("Content-Encoding", "gzip");
-  request->send(response);
+  this->send_static_(request, "text/javascript", ESPHOME_WEBSERVER_JS_INCLUDE, ESPHOME_WEBSERVER_JS_INCLUDE_SIZE,
+                     ESPHOME_WEBSERVER_JS_INCLUDE_ETAG, CACHE_CONTROL_INCLUDE, true);
 }
 #endif
 
@@ -409,7 +437,7 @@ void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (sensor::Sensor *obj : App.get_sensors()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -427,6 +455,21 @@ std::string WebServer::sensor_all_json_generator(WebServer *web_server, void *so
   return web_server->sensor_json((sensor::Sensor *) (source), ((sensor::Sensor *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail start_config) {
+  if (start_config == DETAIL_STATE) {
+    // Sent on every sensor update, skip building a JsonDocument
+    json::JsonObjectWriter writer;
+    writer.add("id", "sensor-" + obj->get_object_id());
+    writer.add("value", value);
+    if (std::isnan(value)) {
+      writer.add("state", "NA");
+    } else {
+      std::string state = value_accuracy_to_string(value, obj->get_accuracy_decimals());
+      if (!obj->get_unit_of_measurement().empty())
+        state += " " + obj->get_unit_of_measurement();
+      writer.add("state", state);
+    }
+    return writer.release();
+  }
   return json::build_json([this, obj, value, start_config](JsonObject root) {
     std::string state;
     if (std::isnan(value)) {
@@ -454,7 +497,7 @@ void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::s
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (text_sensor::TextSensor *obj : App.get_text_sensors()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -475,6 +518,13 @@ std::string WebServer::text_sensor_all_json_generator(WebServer *web_server, voi
 }
 std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std::string &value,
                                         JsonDetail start_config) {
+  if (start_config == DETAIL_STATE) {
+    json::JsonObjectWriter writer;
+    writer.add("id", "text_sensor-" + obj->get_object_id());
+    writer.add("value", value);
+    writer.add("state", value);
+    return writer.release();
+  }
   return json::build_json([this, obj, value, start_config](JsonObject root) {
     set_json_icon_state_value(root, obj, "text_sensor-" + obj->get_object_id(), value, value, start_config);
     if (start_config == DETAIL_ALL) {
@@ -492,7 +542,7 @@ void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
 }
 void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (switch_::Switch *obj : App.get_switches()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -522,6 +572,13 @@ std::string WebServer::switch_all_json_generator(WebServer *web_server, void *so
   return web_server->switch_json((switch_::Switch *) (source), ((switch_::Switch *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail start_config) {
+  if (start_config == DETAIL_STATE) {
+    json::JsonObjectWriter writer;
+    writer.add("id", "switch-" + obj->get_object_id());
+    writer.add("value", value);
+    writer.add("state", value ? "ON" : "OFF");
+    return writer.release();
+  }
   return json::build_json([this, obj, value, start_config](JsonObject root) {
     set_json_icon_state_value(root, obj, "switch-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
     if (start_config == DETAIL_ALL) {
@@ -535,7 +592,7 @@ std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail
 #ifdef USE_BUTTON
 void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (button::Button *obj : App.get_buttons()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -576,7 +633,7 @@ void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj) {
 }
 void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (binary_sensor::BinarySensor *obj : App.get_binary_sensors()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -596,6 +653,13 @@ std::string WebServer::binary_sensor_all_json_generator(WebServer *web_server, v
                                         ((binary_sensor::BinarySensor *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool value, JsonDetail start_config) {
+  if (start_config == DETAIL_STATE) {
+    json::JsonObjectWriter writer;
+    writer.add("id", "binary_sensor-" + obj->get_object_id());
+    writer.add("value", value);
+    writer.add("state", value ? "ON" : "OFF");
+    return writer.release();
+  }
   return json::build_json([this, obj, value, start_config](JsonObject root) {
     set_json_icon_state_value(root, obj, "binary_sensor-" + obj->get_object_id(), value ? "ON" : "OFF", value,
                               start_config);
@@ -614,7 +678,7 @@ void WebServer::on_fan_update(fan::Fan *obj) {
 }
 void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (fan::Fan *obj : App.get_fans()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -695,7 +759,7 @@ void WebServer::on_light_update(light::LightState *obj) {
 }
 void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (light::LightState *obj : App.get_lights()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -786,20 +850,27 @@ std::string WebServer::light_all_json_generator(WebServer *web_server, void *sou
   return web_server->light_json((light::LightState *) (source), DETAIL_ALL);
 }
 std::string WebServer::light_json(light::LightState *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "light-" + obj->get_object_id(), start_config);
-    root["state"] = obj->remote_values.is_on() ? "ON" : "OFF";
-
-    light::LightJSONSchema::dump_json(*obj, root);
-    if (start_config == DETAIL_ALL) {
+  // Sent on every light update, so the state is written directly, the same way MQTT does
+  json::JsonObjectWriter writer(192);
+  if (start_config == DETAIL_ALL) {
+    // The entity info and the effect list only go out with the first message, build them the usual way
+    writer.add_members(json::build_json([this, obj](JsonObject root) {
+      set_json_id(root, obj, "light-" + obj->get_object_id(), DETAIL_ALL);
       JsonArray opt = root["effects"].to<JsonArray>();
       opt.add("None");
       for (auto const &option : obj->get_effects()) {
         opt.add(option->get_name());
       }
       this->add_sorting_info_(root, obj);
-    }
-  });
+    }));
+  } else {
+    writer.add("id", "light-" + obj->get_object_id());
+  }
+  // The light schema only adds the state for lights with a known color mode
+  if (!(obj->remote_values.get_color_mode() & light::ColorCapability::ON_OFF))
+    writer.add("state", obj->remote_values.is_on() ? "ON" : "OFF");
+  light::LightJSONSchema::dump_json(*obj, writer);
+  return writer.release();
 }
 #endif
 
@@ -811,7 +882,7 @@ void WebServer::on_cover_update(cover::Cover *obj) {
 }
 void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (cover::Cover *obj : App.get_covers()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -892,7 +963,7 @@ void WebServer::on_number_update(number::Number *obj, float state) {
 }
 void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_numbers()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -927,6 +998,21 @@ std::string WebServer::number_all_json_generator(WebServer *web_server, void *so
   return web_server->number_json((number::Number *) (source), ((number::Number *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::number_json(number::Number *obj, float value, JsonDetail start_config) {
+  if (start_config == DETAIL_STATE) {
+    json::JsonObjectWriter writer;
+    writer.add("id", "number-" + obj->get_object_id());
+    if (std::isnan(value)) {
+      writer.add("value", "\"NaN\"");
+      writer.add("state", "NA");
+    } else {
+      std::string value_str = value_accuracy_to_string(value, step_to_accuracy_decimals(obj->traits.get_step()));
+      writer.add("value", value_str);
+      if (!obj->traits.get_unit_of_measurement().empty())
+        value_str += " " + obj->traits.get_unit_of_measurement();
+      writer.add("state", value_str);
+    }
+    return writer.release();
+  }
   return json::build_json([this, obj, value, start_config](JsonObject root) {
     set_json_id(root, obj, "number-" + obj->get_object_id(), start_config);
     if (start_config == DETAIL_ALL) {
@@ -963,7 +1049,7 @@ void WebServer::on_date_update(datetime::DateEntity *obj) {
 }
 void WebServer::handle_date_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_dates()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -1022,7 +1108,7 @@ void WebServer::on_time_update(datetime::TimeEntity *obj) {
 }
 void WebServer::handle_time_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_times()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -1080,7 +1166,7 @@ void WebServer::on_datetime_update(datetime::DateTimeEntity *obj) {
 }
 void WebServer::handle_datetime_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_datetimes()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
     if (request->method() == HTTP_GET && match.method_empty()) {
       auto detail = get_request_detail(request);
@@ -1139,7 +1225,7 @@ void WebServer::on_text_update(text::Text *obj, const std::string &state) {
 }
 void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_texts()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1200,7 +1286,7 @@ void WebServer::on_select_update(select::Select *obj, const std::string &state,
 }
 void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_selects()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1259,7 +1345,7 @@ void WebServer::on_climate_update(climate::Climate *obj) {
 }
 void WebServer::handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (auto *obj : App.get_climates()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1322,15 +1408,18 @@ std::string WebServer::climate_all_json_generator(WebServer *web_server, void *s
   return web_server->climate_json((climate::Climate *) (source), DETAIL_ALL);
 }
 std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_config) {
-  // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
-  return json::build_json([this, obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "climate-" + obj->get_object_id(), start_config);
-    const auto traits = obj->get_traits();
-    int8_t target_accuracy = traits.get_target_temperature_accuracy_decimals();
-    int8_t current_accuracy = traits.get_current_temperature_accuracy_decimals();
-    char buf[16];
-
-    if (start_config == DETAIL_ALL) {
+  const auto traits = obj->get_traits();
+  int8_t target_accuracy = traits.get_target_temperature_accuracy_decimals();
+  int8_t current_accuracy = traits.get_current_temperature_accuracy_decimals();
+  char buf[16];
+
+  // Sent on every climate update, so the state is written directly
+  json::JsonObjectWriter writer(256);
+  if (start_config == DETAIL_ALL) {
+    // The entity info and the supported modes only go out with the first message, build them the usual way
+    // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks) false positive with ArduinoJson
+    writer.add_members(json::build_json([this, obj, &traits, &buf](JsonObject root) {
+      set_json_id(root, obj, "climate-" + obj->get_object_id(), DETAIL_ALL);
       JsonArray opt = root["modes"].to<JsonArray>();
       for (climate::ClimateMode m : traits.get_supported_modes())
         opt.add(PSTR_LOCAL(climate::climate_mode_to_string(m)));
@@ -1361,54 +1450,57 @@ std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_conf
           opt.add(custom_preset);
       }
       this->add_sorting_info_(root, obj);
-    }
+    }));
+    // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
+  } else {
+    writer.add("id", "climate-" + obj->get_object_id());
+  }
 
-    bool has_state = false;
-    root["mode"] = PSTR_LOCAL(climate_mode_to_string(obj->mode));
-    root["max_temp"] = value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy);
-    root["min_temp"] = value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy);
-    root["step"] = traits.get_visual_target_temperature_step();
-    if (traits.get_supports_action()) {
-      root["action"] = PSTR_LOCAL(climate_action_to_string(obj->action));
-      root["state"] = root["action"];
-      has_state = true;
-    }
-    if (traits.get_supports_fan_modes() && obj->fan_mode.has_value()) {
-      root["fan_mode"] = PSTR_LOCAL(climate_fan_mode_to_string(obj->fan_mode.value()));
-    }
-    if (!traits.get_supported_custom_fan_modes().empty() && obj->custom_fan_mode.has_value()) {
-      root["custom_fan_mode"] = obj->custom_fan_mode.value().c_str();
-    }
-    if (traits.get_supports_presets() && obj->preset.has_value()) {
-      root["preset"] = PSTR_LOCAL(climate_preset_to_string(obj->preset.value()));
-    }
-    if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
-      root["custom_preset"] = obj->custom_preset.value().c_str();
-    }
-    if (traits.get_supports_swing_modes()) {
-      root["swing_mode"] = PSTR_LOCAL(climate_swing_mode_to_string(obj->swing_mode));
-    }
-    if (traits.get_supports_current_temperature()) {
-      if (!std::isnan(obj->current_temperature)) {
-        root["current_temperature"] = value_accuracy_to_string(obj->current_temperature, current_accuracy);
-      } else {
-        root["current_temperature"] = "NA";
-      }
-    }
-    if (traits.get_supports_two_point_target_temperature()) {
-      root["target_temperature_low"] = value_accuracy_to_string(obj->target_temperature_low, target_accuracy);
-      root["target_temperature_high"] = value_accuracy_to_string(obj->target_temperature_high, target_accuracy);
-      if (!has_state) {
-        root["state"] = value_accuracy_to_string((obj->target_temperature_high + obj->target_temperature_low) / 2.0f,
-                                                 target_accuracy);
-      }
+  writer.add("mode", PSTR_LOCAL(climate_mode_to_string(obj->mode)));
+  writer.add("max_temp", value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy));
+  writer.add("min_temp", value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy));
+  writer.add("step", traits.get_visual_target_temperature_step());
+  if (traits.get_supports_action()) {
+    const char *action = PSTR_LOCAL(climate_action_to_string(obj->action));
+    writer.add("action", action);
+    writer.add("state", action);
+  }
+  if (traits.get_supports_fan_modes() && obj->fan_mode.has_value()) {
+    writer.add("fan_mode", PSTR_LOCAL(climate_fan_mode_to_string(obj->fan_mode.value())));
+  }
+  if (!traits.get_supported_custom_fan_modes().empty() && obj->custom_fan_mode.has_value()) {
+    writer.add("custom_fan_mode", obj->custom_fan_mode.value());
+  }
+  if (traits.get_supports_presets() && obj->preset.has_value()) {
+    writer.add("preset", PSTR_LOCAL(climate_preset_to_string(obj->preset.value())));
+  }
+  if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
+    writer.add("custom_preset", obj->custom_preset.value());
+  }
+  if (traits.get_supports_swing_modes()) {
+    writer.add("swing_mode", PSTR_LOCAL(climate_swing_mode_to_string(obj->swing_mode)));
+  }
+  if (traits.get_supports_current_temperature()) {
+    if (!std::isnan(obj->current_temperature)) {
+      writer.add("current_temperature", value_accuracy_to_string(obj->current_temperature, current_accuracy));
     } else {
-      root["target_temperature"] = value_accuracy_to_string(obj->target_temperature, target_accuracy);
-      if (!has_state)
-        root["state"] = root["target_temperature"];
+      writer.add("current_temperature", "NA");
     }
-  });
-  // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
+  }
+  if (traits.get_supports_two_point_target_temperature()) {
+    writer.add("target_temperature_low", value_accuracy_to_string(obj->target_temperature_low, target_accuracy));
+    writer.add("target_temperature_high", value_accuracy_to_string(obj->target_temperature_high, target_accuracy));
+    if (!traits.get_supports_action()) {
+      writer.add("state", value_accuracy_to_string((obj->target_temperature_high + obj->target_temperature_low) / 2.0f,
+                                                   target_accuracy));
+    }
+  } else {
+    std::string target_temperature = value_accuracy_to_string(obj->target_temperature, target_accuracy);
+    writer.add("target_temperature", target_temperature);
+    if (!traits.get_supports_action())
+      writer.add("state", target_temperature);
+  }
+  return writer.release();
 }
 #endif
 
@@ -1420,7 +1512,7 @@ void WebServer::on_lock_update(lock::Lock *obj) {
 }
 void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (lock::Lock *obj : App.get_locks()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1468,7 +1560,7 @@ void WebServer::on_valve_update(valve::Valve *obj) {
 }
 void WebServer::handle_valve_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (valve::Valve *obj : App.get_valves()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1540,7 +1632,7 @@ void WebServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlP
 }
 void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (alarm_control_panel::AlarmControlPanel *obj : App.get_alarm_control_panels()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1607,7 +1699,7 @@ void WebServer::on_event(event::Event *obj, const std::string &event_type) {
 
 void WebServer::handle_event_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (event::Event *obj : App.get_events()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1658,7 +1750,7 @@ void WebServer::on_update(update::UpdateEntity *obj) {
 }
 void WebServer::handle_update_request(AsyncWebServerRequest *request, const UrlMatch &match) {
   for (update::UpdateEntity *obj : App.get_updates()) {
-    if (!match.id_equals(obj->get_object_id()))
+    if (!match.id_equals(obj->get_object_id_ref()))
       continue;
 
     if (request->method() == HTTP_GET && match.method_empty()) {
@@ -1734,6 +1826,11 @@ bool WebServer::canHandle(AsyncWebServerRequest *request) const {
     return true;
 #endif
 
+#ifdef USE_LOGGER_PERSISTENT_LOG
+  if (url == "/previous_log")
+    return this->expose_log_ && method == HTTP_GET;
+#endif
+
 #ifdef USE_WEBSERVER_JS_INCLUDE
   if (url == "/0.js")
     return true;
@@ -1870,6 +1967,13 @@ void WebServer::handleRequest(AsyncWebServerRequest *request) {
   }
 #endif
 
+#ifdef USE_LOGGER_PERSISTENT_LOG
+  if (url == "/previous_log") {
+    this->handle_previous_log_request(request);
+    return;
+  }
+#endif
+
 #ifdef USE_WEBSERVER_JS_INCLUDE
   if (url == "/0.js") {
     this->handle_js_request(request);
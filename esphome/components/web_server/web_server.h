@@ -18,16 +18,23 @@
 #if USE_WEBSERVER_VERSION >= 2
 extern const uint8_t ESPHOME_WEBSERVER_INDEX_HTML[] PROGMEM;
 extern const size_t ESPHOME_WEBSERVER_INDEX_HTML_SIZE;
+extern const char ESPHOME_WEBSERVER_INDEX_HTML_ETAG[];
+#endif
+
+#ifdef USE_WEBSERVER_LOCAL
+extern const char ESPHOME_WEBSERVER_INDEX_GZ_ETAG[];
 #endif
 
 #ifdef USE_WEBSERVER_CSS_INCLUDE
 extern const uint8_t ESPHOME_WEBSERVER_CSS_INCLUDE[] PROGMEM;
 extern const size_t ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE;
+extern const char ESPHOME_WEBSERVER_CSS_INCLUDE_ETAG[];
 #endif
 
 #ifdef USE_WEBSERVER_JS_INCLUDE
 extern const uint8_t ESPHOME_WEBSERVER_JS_INCLUDE[] PROGMEM;
 extern const size_t ESPHOME_WEBSERVER_JS_INCLUDE_SIZE;
+extern const char ESPHOME_WEBSERVER_JS_INCLUDE_ETAG[];
 #endif
 
 namespace esphome {
@@ -51,6 +58,9 @@ struct UrlMatch {
   bool id_equals(const std::string &str) const {
     return id && id_len == str.length() && memcmp(id, str.c_str(), id_len) == 0;
   }
+  bool id_equals(const StringRef &str) const {
+    return id && id_len == str.size() && memcmp(id, str.c_str(), id_len) == 0;
+  }
 
   bool method_equals(const char *str) const {
     return method && method_len == strlen(str) && memcmp(method, str, method_len) == 0;
@@ -123,6 +133,8 @@ class DeferredUpdateEventSource : public AsyncEventSource {
   WebServer *web_server_;
   uint16_t consecutive_send_failures_{0};
   static constexpr uint16_t MAX_CONSECUTIVE_SEND_FAILURES = 2500;  // ~20 seconds at 125Hz loop rate
+  // Time the initial state iteration of a client may take per loop iteration
+  static constexpr uint32_t INITIAL_STATES_BUDGET_MS = 5;
 
   // helper for allowing only unique entries in the queue
   void deq_push_back_with_dedup_(void *source, message_generator_t *message_generator);
@@ -214,6 +226,14 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
    * @param expose_log.
    */
   void set_expose_log(bool expose_log) { this->expose_log_ = expose_log; }
+#ifdef USE_ESP_IDF
+  /// Minimum time in ms between two state events of the same entity (0 = no limit).
+  void set_state_min_interval(uint32_t min_interval) { this->events_.set_min_interval(min_interval); }
+  /// Collect state events for this many ms and send them in one write per client (0 = send immediately).
+  void set_state_coalesce_interval(uint32_t interval) { this->events_.set_coalesce_interval(interval); }
+  uint32_t get_state_events_sent() const { return this->events_.get_events_sent(); }
+  uint32_t get_state_events_suppressed() const { return this->events_.get_events_suppressed(); }
+#endif
 
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
@@ -247,6 +267,11 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   void handle_pna_cors_request(AsyncWebServerRequest *request);
 #endif
 
+#ifdef USE_LOGGER_PERSISTENT_LOG
+  /// Handle a request for the log recorded before the last reset under '/previous_log'.
+  void handle_previous_log_request(AsyncWebServerRequest *request);
+#endif
+
 #ifdef USE_SENSOR
   void on_sensor_update(sensor::Sensor *obj, float state) override;
   /// Handle a sensor request under '/sensor/<id>'.
@@ -498,6 +523,11 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
 
  protected:
   void add_sorting_info_(JsonObject &root, EntityBase *entity);
+#if USE_WEBSERVER_VERSION >= 2 || defined(USE_WEBSERVER_CSS_INCLUDE) || defined(USE_WEBSERVER_JS_INCLUDE)
+  /// Send an asset embedded in flash, or 304 Not Modified when the client already has this ETag.
+  void send_static_(AsyncWebServerRequest *request, const char *content_type, const uint8_t *data, size_t size,
+                    const char *etag, const char *cache_control, bool gzip);
+#endif
   web_server_base::WebServerBase *base_;
 #ifdef USE_ARDUINO
   DeferredUpdateEventSourceList events_;
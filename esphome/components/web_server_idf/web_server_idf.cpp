@@ -11,6 +11,9 @@
 #include "esp_tls_crypto.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#ifdef USE_WEBSERVER_IDF_WORKER_TASKS
+#include <freertos/queue.h>
+#endif
 
 #include "utils.h"
 #include "web_server_idf.h"
@@ -28,6 +31,10 @@
 namespace esphome {
 namespace web_server_idf {
 
+#ifndef HTTPD_304
+#define HTTPD_304 "304 Not Modified"
+#endif
+
 #ifndef HTTPD_409
 #define HTTPD_409 "409 Conflict"
 #endif
@@ -60,6 +67,9 @@ void AsyncWebServer::begin() {
   httpd_config_t config = HTTPD_DEFAULT_CONFIG();
   config.server_port = this->port_;
   config.uri_match_fn = [](const char * /*unused*/, const char * /*unused*/, size_t /*unused*/) { return true; };
+#ifdef USE_WEBSERVER_IDF_WORKER_TASKS
+  this->start_workers_(config);
+#endif
   if (httpd_start(&this->server_, &config) == ESP_OK) {
     const httpd_uri_t handler_get = {
         .uri = "",
@@ -87,8 +97,54 @@ void AsyncWebServer::begin() {
   }
 }
 
+#ifdef USE_WEBSERVER_IDF_WORKER_TASKS
+void AsyncWebServer::start_workers_(const httpd_config_t &config) {
+  if (this->worker_queue_ != nullptr)
+    return;  // workers survive end()/begin(), requests only reference the server through user_ctx
+  this->worker_queue_ = xQueueCreate(USE_WEBSERVER_IDF_WORKER_TASKS, sizeof(httpd_req_t *));
+  for (int i = 0; i < USE_WEBSERVER_IDF_WORKER_TASKS; i++) {
+    xTaskCreate(AsyncWebServer::worker_task, "httpd_worker", config.stack_size, this, config.task_priority, nullptr);
+  }
+}
+
+bool AsyncWebServer::queue_to_worker_(httpd_req_t *r) {
+  // Only the httpd task adds to the queue, so the free slot can't be taken before the send below
+  if (uxQueueSpacesAvailable(this->worker_queue_) == 0)
+    return false;
+  httpd_req_t *async_req;
+  if (httpd_req_async_handler_begin(r, &async_req) != ESP_OK)
+    return false;
+  xQueueSend(this->worker_queue_, &async_req, 0);
+  return true;
+}
+
+void AsyncWebServer::worker_task(void *arg) {
+  auto *server = static_cast<AsyncWebServer *>(arg);
+  while (true) {
+    httpd_req_t *r;
+    if (xQueueReceive(server->worker_queue_, &r, portMAX_DELAY) != pdTRUE)
+      continue;
+    if (AsyncWebServer::handle_post_(r) != ESP_OK) {
+      // Same as returning an error from a handler on the httpd task
+      httpd_sess_trigger_close(r->handle, httpd_req_to_sockfd(r));
+    }
+    httpd_req_async_handler_complete(r);
+  }
+}
+#endif
+
 esp_err_t AsyncWebServer::request_post_handler(httpd_req_t *r) {
   ESP_LOGVV(TAG, "Enter AsyncWebServer::request_post_handler. uri=%s", r->uri);
+#ifdef USE_WEBSERVER_IDF_WORKER_TASKS
+  // Reading the body and running the handler can take long (OTA uploads), let a worker do that so the httpd task
+  // keeps serving state polling and event streams. Falls back to handling it here when all workers are busy.
+  if (static_cast<AsyncWebServer *>(r->user_ctx)->queue_to_worker_(r))
+    return ESP_OK;
+#endif
+  return AsyncWebServer::handle_post_(r);
+}
+
+esp_err_t AsyncWebServer::handle_post_(httpd_req_t *r) {
   auto content_type = request_get_header(r, "Content-Type");
 
   if (!request_has_header(r, "Content-Length")) {
@@ -186,6 +242,8 @@ std::string AsyncWebServerRequest::url() const {
 std::string AsyncWebServerRequest::host() const { return this->get_header("Host").value(); }
 
 void AsyncWebServerRequest::send(AsyncWebServerResponse *response) {
+  if (response->finish_chunked())
+    return;
   httpd_resp_send(*this, response->get_content_data(), response->get_content_size());
 }
 
@@ -206,6 +264,7 @@ void AsyncWebServerRequest::redirect(const std::string &url) {
 
 void AsyncWebServerRequest::init_response_(AsyncWebServerResponse *rsp, int code, const char *content_type) {
   httpd_resp_set_status(*this, code == 200   ? HTTPD_200
+                               : code == 304 ? HTTPD_304
                                : code == 404 ? HTTPD_404
                                : code == 409 ? HTTPD_409
                                              : to_string(code).c_str());
@@ -290,6 +349,23 @@ void AsyncWebServerResponse::addHeader(const char *name, const char *value) {
 
 void AsyncResponseStream::print(float value) { this->print(to_string(value)); }
 
+void AsyncResponseStream::send_chunk_if_full_() {
+  if (this->chunk_size_ == 0 || this->content_.size() < this->chunk_size_)
+    return;
+  httpd_resp_send_chunk(*this->req_, this->content_.data(), this->content_.size());
+  this->content_.clear();
+}
+
+bool AsyncResponseStream::finish_chunked() {
+  if (this->chunk_size_ == 0)
+    return false;
+  if (!this->content_.empty())
+    httpd_resp_send_chunk(*this->req_, this->content_.data(), this->content_.size());
+  // An empty chunk ends the response
+  httpd_resp_send_chunk(*this->req_, nullptr, 0);
+  return true;
+}
+
 void AsyncResponseStream::printf(const char *fmt, ...) {
   va_list args;
 
@@ -340,6 +416,8 @@ void AsyncEventSource::loop() {
       ++it;
     }
   }
+  if (this->min_interval_ != 0)
+    this->send_due_states_();
 }
 
 void AsyncEventSource::try_send_nodefer(const char *message, const char *event, uint32_t id, uint32_t reconnect) {
@@ -352,6 +430,44 @@ void AsyncEventSource::try_send_nodefer(const char *message, const char *event,
 
 void AsyncEventSource::deferrable_send_state(void *source, const char *event_type,
                                              message_generator_t *message_generator) {
+  if (this->min_interval_ != 0 && strcmp(event_type, "state") == 0 && this->hold_back_state_(source, message_generator))
+    return;
+  this->send_state_to_sessions_(source, event_type, message_generator);
+}
+
+bool AsyncEventSource::hold_back_state_(void *source, message_generator_t *message_generator) {
+  const uint32_t now = millis();
+  auto it = std::find_if(this->rate_limited_.begin(), this->rate_limited_.end(),
+                         [source](const RateLimitedSource &entry) { return entry.source == source; });
+  if (it == this->rate_limited_.end()) {
+    this->rate_limited_.push_back({source, message_generator, now, false});
+    return false;
+  }
+  if (now - it->last_sent >= this->min_interval_ && !it->pending) {
+    it->last_sent = now;
+    return false;
+  }
+  // Too soon, loop() sends the latest state once the interval is over
+  if (it->pending)
+    this->events_suppressed_++;
+  it->message_generator = message_generator;
+  it->pending = true;
+  return true;
+}
+
+void AsyncEventSource::send_due_states_() {
+  const uint32_t now = millis();
+  for (auto &entry : this->rate_limited_) {
+    if (entry.pending && now - entry.last_sent >= this->min_interval_) {
+      entry.pending = false;
+      entry.last_sent = now;
+      this->send_state_to_sessions_(entry.source, "state", entry.message_generator);
+    }
+  }
+}
+
+void AsyncEventSource::send_state_to_sessions_(void *source, const char *event_type,
+                                               message_generator_t *message_generator) {
   for (auto *ses : this->sessions_) {
     if (ses->fd_.load() != 0) {  // Skip dead sessions
       ses->deferrable_send_state(source, event_type, message_generator);
@@ -362,7 +478,7 @@ void AsyncEventSource::deferrable_send_state(void *source, const char *event_typ
 AsyncEventSourceResponse::AsyncEventSourceResponse(const AsyncWebServerRequest *request,
                                                    esphome::web_server_idf::AsyncEventSource *server,
                                                    esphome::web_server::WebServer *ws)
-    : server_(server), web_server_(ws), entities_iterator_(new esphome::web_server::ListEntitiesIterator(ws, server)) {
+    : server_(server), web_server_(ws), entities_iterator_(new esphome::web_server::ListEntitiesIterator(ws, this)) {
   httpd_req_t *req = *request;
 
   httpd_resp_set_status(req, HTTPD_200);
@@ -427,7 +543,9 @@ void AsyncEventSourceResponse::deq_push_back_with_dedup_(void *source, message_g
                            [&item](const DeferredEvent &test) -> bool { return test == item; });
 
   if (iter != this->deferred_queue_.end()) {
+    // The newer state replaces the one that was never sent
     (*iter) = item;
+    this->server_->events_suppressed_++;
   } else {
     this->deferred_queue_.push_back(item);
   }
@@ -440,6 +558,7 @@ void AsyncEventSourceResponse::process_deferred_queue_() {
     if (this->try_send_nodefer(message.c_str(), "state")) {
       // O(n) but memory efficiency is more important than speed here which is why std::vector was chosen
       deferred_queue_.erase(deferred_queue_.begin());
+      this->server_->events_sent_++;
     } else {
       break;
     }
@@ -473,9 +592,35 @@ void AsyncEventSourceResponse::process_buffer_() {
 
 void AsyncEventSourceResponse::loop() {
   process_buffer_();
-  process_deferred_queue_();
+  if (this->server_->coalesce_interval_ == 0) {
+    process_deferred_queue_();
+  } else if (millis() - this->last_flush_ >= this->server_->coalesce_interval_) {
+    this->send_coalesced_();
+  }
   if (!this->entities_iterator_->completed())
+    this->send_initial_states_();
+}
+
+void AsyncEventSourceResponse::send_initial_states_() {
+  process_buffer_();
+  if (!event_buffer_.empty() || !deferred_queue_.empty())
+    return;  // tcp send buffer still full, the socket sets the pace
+
+  // As many entities as fit in one chunk and the time budget, so a large node doesn't stall the loop for a new client
+  const uint32_t start = millis();
+  this->begin_chunk_();
+  const size_t empty_size = event_buffer_.size();
+  this->appending_initial_states_ = true;
+  while (!this->entities_iterator_->completed() && event_buffer_.size() < MAX_COALESCED_CHUNK_SIZE &&
+         millis() - start < INITIAL_STATES_BUDGET_MS) {
     this->entities_iterator_->advance();
+  }
+  this->appending_initial_states_ = false;
+  if (event_buffer_.size() == empty_size) {
+    event_buffer_.resize(0);
+    return;
+  }
+  this->finish_chunk_();
 }
 
 bool AsyncEventSourceResponse::try_send_nodefer(const char *message, const char *event, uint32_t id,
@@ -490,12 +635,21 @@ bool AsyncEventSourceResponse::try_send_nodefer(const char *message, const char
     return false;
   }
 
-  // 8 spaces are standing in for the hexidecimal chunk length to print later
-  const char chunk_len_header[] = "        " CRLF_STR;
-  const int chunk_len_header_len = sizeof(chunk_len_header) - 1;
+  this->begin_chunk_();
+  this->append_event_(message, event, id, reconnect);
+  this->finish_chunk_();
 
-  event_buffer_.append(chunk_len_header);
+  return true;
+}
+
+// 8 spaces are standing in for the hexidecimal chunk length to print later
+static const char CHUNK_LEN_HEADER[] = "        " CRLF_STR;
+static const int CHUNK_LEN_HEADER_LEN = sizeof(CHUNK_LEN_HEADER) - 1;
+
+void AsyncEventSourceResponse::begin_chunk_() { event_buffer_.append(CHUNK_LEN_HEADER); }
 
+void AsyncEventSourceResponse::append_event_(const char *message, const char *event, uint32_t id,
+                                             uint32_t reconnect) {
   if (reconnect) {
     event_buffer_.append("retry: ", sizeof("retry: ") - 1);
     event_buffer_.append(to_string(reconnect));
@@ -520,23 +674,44 @@ bool AsyncEventSourceResponse::try_send_nodefer(const char *message, const char
     event_buffer_.append(CRLF_STR, CRLF_LEN);
   }
 
-  if (event_buffer_.empty()) {
-    return true;
-  }
-
+  // A blank line ends the event
   event_buffer_.append(CRLF_STR, CRLF_LEN);
+}
+
+void AsyncEventSourceResponse::finish_chunk_() {
   event_buffer_.append(CRLF_STR, CRLF_LEN);
 
   // chunk length header itself and the final chunk terminating CRLF are not counted as part of the chunk
-  int chunk_len = event_buffer_.size() - CRLF_LEN - chunk_len_header_len;
+  int chunk_len = event_buffer_.size() - CRLF_LEN - CHUNK_LEN_HEADER_LEN;
   char chunk_len_str[9];
   snprintf(chunk_len_str, 9, "%08x", chunk_len);
   std::memcpy(&event_buffer_[0], chunk_len_str, 8);
 
   event_bytes_sent_ = 0;
   process_buffer_();
+}
+
+void AsyncEventSourceResponse::send_coalesced_() {
+  if (this->deferred_queue_.empty() || this->fd_.load() == 0)
+    return;
+  process_buffer_();
+  if (!event_buffer_.empty())
+    return;  // tcp send buffer still full, try again in the next loop
 
-  return true;
+  // All pending states go out in one chunk, so one socket write instead of one per entity
+  this->begin_chunk_();
+  size_t count = 0;
+  for (const auto &de : this->deferred_queue_) {
+    std::string message = de.message_generator_(web_server_, de.source_);
+    this->append_event_(message.c_str(), "state", 0, 0);
+    count++;
+    if (event_buffer_.size() >= MAX_COALESCED_CHUNK_SIZE)
+      break;
+  }
+  this->deferred_queue_.erase(this->deferred_queue_.begin(), this->deferred_queue_.begin() + count);
+  this->server_->events_sent_ += count;
+  this->last_flush_ = millis();
+  this->finish_chunk_();
 }
 
 void AsyncEventSourceResponse::deferrable_send_state(void *source, const char *event_type,
@@ -557,6 +732,19 @@ void AsyncEventSourceResponse::deferrable_send_state(void *source, const char *e
     ESP_LOGE(TAG, "Can't defer non-state event");
   }
 
+  if (this->appending_initial_states_) {
+    std::string message = message_generator(web_server_, source);
+    this->append_event_(message.c_str(), "state", 0, 0);
+    this->server_->events_sent_++;
+    return;
+  }
+
+  if (this->server_->coalesce_interval_ != 0 && 0 == strcmp(event_type, "state")) {
+    // Collected here and sent together from loop()
+    deq_push_back_with_dedup_(source, message_generator);
+    return;
+  }
+
   process_buffer_();
   process_deferred_queue_();
 
@@ -566,7 +754,9 @@ void AsyncEventSourceResponse::deferrable_send_state(void *source, const char *e
     deq_push_back_with_dedup_(source, message_generator);
   } else {
     std::string message = message_generator(web_server_, source);
-    if (!this->try_send_nodefer(message.c_str(), "state")) {
+    if (this->try_send_nodefer(message.c_str(), "state")) {
+      this->server_->events_sent_++;
+    } else {
       deq_push_back_with_dedup_(source, message_generator);
     }
   }
@@ -587,6 +777,19 @@ esp_err_t AsyncWebServer::handle_multipart_upload_(httpd_req_t *r, const char *c
     return ESP_FAIL;
   }
 
+#ifdef USE_WEBSERVER_IDF_WORKER_TASKS
+  // Upload handlers (OTA) keep state for a single upload, reject a second one running on another worker
+  if (this->upload_active_.exchange(true)) {
+    ESP_LOGW(TAG, "Upload already in progress");
+    httpd_resp_send_err(r, HTTPD_409, nullptr);
+    return ESP_OK;
+  }
+  struct UploadGuard {
+    std::atomic<bool> &active;
+    ~UploadGuard() { active = false; }
+  } upload_guard{this->upload_active_};
+#endif
+
   AsyncWebServerRequest req(r);
   AsyncWebHandler *handler = nullptr;
   for (auto *h : this->handlers_) {
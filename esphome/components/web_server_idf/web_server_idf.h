@@ -3,6 +3,10 @@
 
 #include "esphome/core/defines.h"
 #include <esp_http_server.h>
+#ifdef USE_WEBSERVER_IDF_WORKER_TASKS
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#endif
 
 #include <atomic>
 #include <functional>
@@ -49,6 +53,8 @@ class AsyncWebServerResponse {
 
   virtual const char *get_content_data() const = 0;
   virtual size_t get_content_size() const = 0;
+  /// Complete a response that was already partly sent as chunks, returns false if nothing was sent yet.
+  virtual bool finish_chunked() { return false; }
 
  protected:
   const AsyncWebServerRequest *req_;
@@ -81,13 +87,30 @@ class AsyncResponseStream : public AsyncWebServerResponse {
   const char *get_content_data() const override { return this->content_.c_str(); };
   size_t get_content_size() const override { return this->content_.size(); };
 
-  void print(const char *str) { this->content_.append(str); }
-  void print(const std::string &str) { this->content_.append(str); }
+  void print(const char *str) {
+    this->content_.append(str);
+    this->send_chunk_if_full_();
+  }
+  void print(const std::string &str) {
+    this->content_.append(str);
+    this->send_chunk_if_full_();
+  }
   void print(float value);
   void printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
 
+  /// Send the body in chunks of about chunk_size bytes while it is printed instead of buffering all of it.
+  /// Headers must be added before the first print.
+  void set_chunk_size(size_t chunk_size) {
+    this->chunk_size_ = chunk_size;
+    this->content_.reserve(chunk_size);
+  }
+  bool finish_chunked() override;
+
  protected:
+  void send_chunk_if_full_();
+
   std::string content_;
+  size_t chunk_size_{0};
 };
 
 class AsyncWebServerResponseProgmem : public AsyncWebServerResponse {
@@ -203,9 +226,19 @@ class AsyncWebServer {
   httpd_handle_t server_{};
   static esp_err_t request_handler(httpd_req_t *r);
   static esp_err_t request_post_handler(httpd_req_t *r);
+  static esp_err_t handle_post_(httpd_req_t *r);
   esp_err_t request_handler_(AsyncWebServerRequest *request) const;
 #ifdef USE_WEBSERVER_OTA
   esp_err_t handle_multipart_upload_(httpd_req_t *r, const char *content_type);
+#endif
+#ifdef USE_WEBSERVER_IDF_WORKER_TASKS
+  /// Create the worker tasks that handle POST requests outside of the httpd task.
+  void start_workers_(const httpd_config_t &config);
+  /// Hand a request over to a free worker, false if all of them are busy.
+  bool queue_to_worker_(httpd_req_t *r);
+  static void worker_task(void *arg);
+  QueueHandle_t worker_queue_{nullptr};
+  std::atomic<bool> upload_active_{false};
 #endif
   std::vector<AsyncWebHandler *> handlers_;
   std::function<void(AsyncWebServerRequest *request)> on_not_found_{};
@@ -263,6 +296,8 @@ class AsyncEventSourceResponse {
   bool try_send_nodefer(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
   void deferrable_send_state(void *source, const char *event_type, message_generator_t *message_generator);
   void loop();
+  /// Clients of this response, like the client count of an event source: 1 until the connection closes
+  size_t count() const { return this->fd_.load() != 0 ? 1 : 0; }
 
  protected:
   AsyncEventSourceResponse(const AsyncWebServerRequest *request, esphome::web_server_idf::AsyncEventSource *server,
@@ -271,6 +306,18 @@ class AsyncEventSourceResponse {
   void deq_push_back_with_dedup_(void *source, message_generator_t *message_generator);
   void process_deferred_queue_();
   void process_buffer_();
+  // Build one HTTP chunk holding any number of events
+  void begin_chunk_();
+  void append_event_(const char *message, const char *event, uint32_t id, uint32_t reconnect);
+  void finish_chunk_();
+  // Send the whole deferred queue as one chunk when coalescing states
+  void send_coalesced_();
+  // Send the next part of the initial entity states as one chunk, once the socket took the previous one
+  void send_initial_states_();
+
+  static constexpr size_t MAX_COALESCED_CHUNK_SIZE = 2048;
+  // Time the initial state iteration of a client may take per loop iteration
+  static constexpr uint32_t INITIAL_STATES_BUDGET_MS = 5;
 
   static void destroy(void *p);
   AsyncEventSource *server_;
@@ -281,6 +328,9 @@ class AsyncEventSourceResponse {
   std::unique_ptr<esphome::web_server::ListEntitiesIterator> entities_iterator_;
   std::string event_buffer_{""};
   size_t event_bytes_sent_;
+  uint32_t last_flush_{0};
+  // Set while send_initial_states_() runs the iterator, its events are appended to the open chunk
+  bool appending_initial_states_{false};
 };
 
 using AsyncEventSourceClient = AsyncEventSourceResponse;
@@ -309,11 +359,37 @@ class AsyncEventSource : public AsyncWebHandler {
 
   size_t count() const { return this->sessions_.size(); }
 
+  /// Minimum time between state events of one entity, updates in between are merged into the next event.
+  void set_min_interval(uint32_t min_interval) { this->min_interval_ = min_interval; }
+  /// Collect state events for this long and send them to each client together.
+  void set_coalesce_interval(uint32_t coalesce_interval) { this->coalesce_interval_ = coalesce_interval; }
+  /// State events written to clients since boot.
+  uint32_t get_events_sent() const { return this->events_sent_; }
+  /// State events replaced by a newer state of the same entity before they were sent, since boot.
+  uint32_t get_events_suppressed() const { return this->events_suppressed_; }
+
  protected:
+  struct RateLimitedSource {
+    void *source;
+    message_generator_t *message_generator;
+    uint32_t last_sent;
+    bool pending;
+  };
+
+  // Returns true if the state must wait for the source's minimum interval
+  bool hold_back_state_(void *source, message_generator_t *message_generator);
+  void send_due_states_();
+  void send_state_to_sessions_(void *source, const char *event_type, message_generator_t *message_generator);
+
   std::string url_;
   std::set<AsyncEventSourceResponse *> sessions_;
   connect_handler_t on_connect_{};
   esphome::web_server::WebServer *web_server_;
+  std::vector<RateLimitedSource> rate_limited_;
+  uint32_t min_interval_{0};
+  uint32_t coalesce_interval_{0};
+  uint32_t events_sent_{0};
+  uint32_t events_suppressed_{0};
 };
 #endif  // USE_WEBSERVER
 
@@ -290,6 +290,23 @@ def _validate(config):
 
 CONF_OUTPUT_POWER = "output_power"
 CONF_PASSIVE_SCAN = "passive_scan"
+CONF_ROAMING = "roaming"
+CONF_RSSI_IMPROVEMENT = "rssi_improvement"
+CONF_RSSI_THRESHOLD = "rssi_threshold"
+CONF_SCAN_INTERVAL = "scan_interval"
+
+ROAMING_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_RSSI_THRESHOLD, default=-75): cv.int_range(
+            min=-100, max=-30
+        ),
+        cv.Optional(
+            CONF_SCAN_INTERVAL, default="1min"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_RSSI_IMPROVEMENT, default=8): cv.int_range(min=1, max=40),
+    }
+)
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -325,6 +342,7 @@ CONFIG_SCHEMA = cv.All(
                 cv.boolean, cv.only_with_esp_idf
             ),
             cv.Optional(CONF_PASSIVE_SCAN, default=False): cv.boolean,
+            cv.Optional(CONF_ROAMING): ROAMING_SCHEMA,
             cv.Optional("enable_mdns"): cv.invalid(
                 "This option has been removed. Please use the [disabled] option under the "
                 "new mdns component instead."
@@ -434,7 +452,18 @@ async def to_code(config):
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
     cg.add(var.set_power_save_mode(config[CONF_POWER_SAVE_MODE]))
     cg.add(var.set_fast_connect(config[CONF_FAST_CONNECT]))
+    if config[CONF_FAST_CONNECT] and CORE.is_esp32 and CORE.using_esp_idf:
+        # Request the last lease again instead of a new DHCP discovery
+        add_idf_sdkconfig_option("CONFIG_LWIP_DHCP_RESTORE_LAST_IP", True)
     cg.add(var.set_passive_scan(config[CONF_PASSIVE_SCAN]))
+    if roaming := config.get(CONF_ROAMING):
+        cg.add(
+            var.set_roaming(
+                roaming[CONF_RSSI_THRESHOLD],
+                roaming[CONF_SCAN_INTERVAL],
+                roaming[CONF_RSSI_IMPROVEMENT],
+            )
+        )
     if CONF_OUTPUT_POWER in config:
         cg.add(var.set_output_power(config[CONF_OUTPUT_POWER]))
 
@@ -63,6 +63,7 @@ void WiFiComponent::start() {
                 "  Local MAC: %s",
                 get_mac_address_pretty().c_str());
   this->last_connected_ = millis();
+  this->connect_start_ = this->last_connected_;
 
   uint32_t hash = this->has_sta() ? fnv1_hash(App.get_compilation_time()) : 88491487UL;
 
@@ -92,8 +93,9 @@ void WiFiComponent::start() {
     }
 
     if (this->fast_connect_) {
-      this->selected_ap_ = this->sta_[0];
       this->load_fast_connect_settings_();
+      this->fast_connect_attempt_ = 0;
+      this->select_fast_connect_ap_();
       this->start_connecting(this->selected_ap_, false);
     } else {
       this->start_scanning();
@@ -140,7 +142,12 @@ void WiFiComponent::loop() {
       case WIFI_COMPONENT_STATE_COOLDOWN: {
         this->status_set_warning("waiting to reconnect");
         if (millis() - this->action_started_ > 5000) {
-          if (this->fast_connect_ || this->retry_hidden_) {
+          if (this->fast_connect_) {
+            // Starts the next round with the most recent access point
+            this->fast_connect_attempt_ = 0;
+            this->select_fast_connect_ap_();
+            this->start_connecting(this->selected_ap_, false);
+          } else if (this->retry_hidden_) {
             this->start_connecting(this->sta_[0], false);
           } else {
             this->start_scanning();
@@ -163,11 +170,15 @@ void WiFiComponent::loop() {
       case WIFI_COMPONENT_STATE_STA_CONNECTED: {
         if (!this->is_connected()) {
           ESP_LOGW(TAG, "Connection lost; reconnecting");
+          this->connect_start_ = millis();
+          this->roaming_scanning_ = false;
           this->state_ = WIFI_COMPONENT_STATE_STA_CONNECTING;
           this->retry_connect();
         } else {
           this->status_clear_warning();
           this->last_connected_ = now;
+          if (this->roaming_)
+            this->check_roaming_(now);
         }
         break;
       }
@@ -612,6 +623,14 @@ void WiFiComponent::check_scanning_finished() {
 void WiFiComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "WiFi:");
   this->print_connect_params_();
+  if (this->roaming_) {
+    ESP_LOGCONFIG(TAG,
+                  "  Roaming:\n"
+                  "    RSSI Threshold: %d dB\n"
+                  "    RSSI Improvement: %u dB\n"
+                  "    Scan Interval: %" PRIu32 "ms",
+                  this->roaming_rssi_threshold_, this->roaming_rssi_improvement_, this->roaming_scan_interval_);
+  }
 }
 
 void WiFiComponent::check_connecting_finished() {
@@ -627,7 +646,13 @@ void WiFiComponent::check_connecting_finished() {
     // We won't retry hidden networks unless a reconnect fails more than three times again
     this->retry_hidden_ = false;
 
-    ESP_LOGI(TAG, "Connected");
+    const uint32_t now = millis();
+    if (this->has_connected_) {
+      ESP_LOGI(TAG, "Connected in %" PRIu32 "ms", now - this->connect_start_);
+    } else {
+      ESP_LOGI(TAG, "Connected in %" PRIu32 "ms, %" PRIu32 "ms after boot", now - this->connect_start_, now);
+      this->has_connected_ = true;
+    }
     this->print_connect_params_();
 
     if (this->has_ap()) {
@@ -721,6 +746,13 @@ void WiFiComponent::retry_connect() {
     this->start_connecting(this->selected_ap_, true);
     return;
   }
+  if (this->fast_connect_ && this->fast_connect_attempt_ + 1 < this->fast_connect_candidates_()) {
+    // Tries the next access point right away, the cooldown only follows a round through all of them
+    this->fast_connect_attempt_++;
+    this->select_fast_connect_ap_();
+    this->start_connecting(this->selected_ap_, false);
+    return;
+  }
 
   this->state_ = WIFI_COMPONENT_STATE_COOLDOWN;
   this->action_started_ = millis();
@@ -756,30 +788,125 @@ bool WiFiComponent::is_esp32_improv_active_() {
 #endif
 }
 
-void WiFiComponent::load_fast_connect_settings_() {
-  SavedWifiFastConnectSettings fast_connect_save{};
+void WiFiComponent::check_roaming_(uint32_t now) {
+  if (this->roaming_scanning_) {
+    if (this->scan_done_) {
+      this->scan_done_ = false;
+      this->roaming_scanning_ = false;
+      this->roam_to_better_ap_();
+    } else if (now - this->roaming_last_scan_ > 30000) {
+      ESP_LOGW(TAG, "Roaming scan timeout");
+      this->roaming_scanning_ = false;
+    }
+    return;
+  }
+
+  if (now - this->roaming_last_scan_ < this->roaming_scan_interval_)
+    return;
+  const int8_t rssi = this->wifi_rssi();
+  if (rssi >= this->roaming_rssi_threshold_)
+    return;
+  this->roaming_last_scan_ = now;
+  // Passive, so the connection is only left for listening on the other channels
+  if (this->wifi_scan_start_(true)) {
+    ESP_LOGD(TAG, "Signal %d dB below roaming threshold, scanning", rssi);
+    this->roaming_scanning_ = true;
+    this->roaming_scan_count_++;
+  }
+}
+
+void WiFiComponent::roam_to_better_ap_() {
+  const int8_t rssi = this->wifi_rssi();
+  const bssid_t current = this->wifi_bssid();
+  const std::string ssid = this->wifi_ssid();
+  const WiFiScanResult *best = nullptr;
+  for (const auto &res : this->scan_result_) {
+    if (res.get_ssid() != ssid || res.get_bssid() == current)
+      continue;
+    if (best == nullptr || res.get_rssi() > best->get_rssi())
+      best = &res;
+  }
+  if (best == nullptr || best->get_rssi() < rssi + this->roaming_rssi_improvement_) {
+    ESP_LOGD(TAG, "No access point stronger than %d dB found", rssi);
+    return;
+  }
 
-  if (this->fast_connect_pref_.load(&fast_connect_save)) {
-    bssid_t bssid{};
-    std::copy(fast_connect_save.bssid, fast_connect_save.bssid + 6, bssid.begin());
-    this->selected_ap_.set_bssid(bssid);
-    this->selected_ap_.set_channel(fast_connect_save.channel);
+  auto bssid = best->get_bssid();
+  ESP_LOGI(TAG, "Roaming to " LOG_SECRET("%02X:%02X:%02X:%02X:%02X:%02X") " with %d dB, currently %d dB", bssid[0],
+           bssid[1], bssid[2], bssid[3], bssid[4], bssid[5], best->get_rssi(), rssi);
+  this->roaming_handover_count_++;
+  this->selected_ap_.set_bssid(bssid);
+  this->selected_ap_.set_channel(best->get_channel());
+  this->connect_start_ = millis();
+  this->start_connecting(this->selected_ap_, false);
+}
 
+void WiFiComponent::load_fast_connect_settings_() {
+  if (this->fast_connect_pref_.load(&this->fast_connect_cache_)) {
     ESP_LOGD(TAG, "Loaded fast_connect settings");
+  } else {
+    for (auto &cached : this->fast_connect_cache_.aps)
+      cached.network = -1;
+  }
+  for (auto &cached : this->fast_connect_cache_.aps) {
+    if (cached.network >= static_cast<int>(this->sta_.size()))
+      cached.network = -1;
   }
 }
 
-void WiFiComponent::save_fast_connect_settings_() {
-  bssid_t bssid = wifi_bssid();
-  uint8_t channel = get_wifi_channel();
+uint8_t WiFiComponent::fast_connect_candidates_() const {
+  uint8_t count = this->sta_.size();
+  for (const auto &cached : this->fast_connect_cache_.aps) {
+    if (cached.network >= 0)
+      count++;
+  }
+  return count;
+}
 
-  if (bssid != this->selected_ap_.get_bssid() || channel != this->selected_ap_.get_channel()) {
-    SavedWifiFastConnectSettings fast_connect_save{};
+void WiFiComponent::select_fast_connect_ap_() {
+  // The cached access points come first, then the configured networks without a cached BSSID
+  uint8_t candidate = this->fast_connect_attempt_ % this->fast_connect_candidates_();
+  for (const auto &cached : this->fast_connect_cache_.aps) {
+    if (cached.network < 0)
+      continue;
+    if (candidate == 0) {
+      bssid_t bssid{};
+      std::copy(cached.bssid, cached.bssid + 6, bssid.begin());
+      this->selected_ap_ = this->sta_[cached.network];
+      this->selected_ap_.set_bssid(bssid);
+      this->selected_ap_.set_channel(cached.channel);
+      this->fast_connect_network_ = cached.network;
+      return;
+    }
+    candidate--;
+  }
+  this->selected_ap_ = this->sta_[candidate];
+  this->fast_connect_network_ = candidate;
+}
 
-    memcpy(fast_connect_save.bssid, bssid.data(), 6);
-    fast_connect_save.channel = channel;
+void WiFiComponent::save_fast_connect_settings_() {
+  if (this->fast_connect_network_ < 0)
+    return;
 
-    this->fast_connect_pref_.save(&fast_connect_save);
+  // The connected access point moves to the front, the others keep their order
+  SavedWifiFastConnectSettings fast_connect_save{};
+  SavedWifiFastConnectAP &current = fast_connect_save.aps[0];
+  bssid_t bssid = wifi_bssid();
+  memcpy(current.bssid, bssid.data(), 6);
+  current.channel = get_wifi_channel();
+  current.network = this->fast_connect_network_;
+  uint8_t count = 1;
+  for (const auto &cached : this->fast_connect_cache_.aps) {
+    if (count < FAST_CONNECT_CACHE_SIZE && cached.network >= 0 && memcmp(cached.bssid, current.bssid, 6) != 0)
+      fast_connect_save.aps[count++] = cached;
+  }
+  for (; count < FAST_CONNECT_CACHE_SIZE; count++)
+    fast_connect_save.aps[count].network = -1;
+  this->fast_connect_attempt_ = 0;
+
+  if (memcmp(&fast_connect_save, &this->fast_connect_cache_, sizeof(fast_connect_save)) != 0) {
+    this->fast_connect_cache_ = fast_connect_save;
+    this->fast_connect_pref_.save(&this->fast_connect_cache_);
 
     ESP_LOGD(TAG, "Saved fast_connect settings");
   }
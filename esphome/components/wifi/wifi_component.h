@@ -57,9 +57,18 @@ struct SavedWifiSettings {
   char password[65];
 } PACKED;  // NOLINT
 
-struct SavedWifiFastConnectSettings {
+static constexpr uint8_t FAST_CONNECT_CACHE_SIZE = 3;
+
+struct SavedWifiFastConnectAP {
   uint8_t bssid[6];
   uint8_t channel;
+  /// Index of the network in the configured ones, -1 if the entry is unused
+  int8_t network;
+} PACKED;  // NOLINT
+
+/// Access points of the last successful connections, the most recent first
+struct SavedWifiFastConnectSettings {
+  SavedWifiFastConnectAP aps[FAST_CONNECT_CACHE_SIZE];
 } PACKED;  // NOLINT
 
 enum WiFiComponentState : uint8_t {
@@ -232,6 +241,16 @@ class WiFiComponent : public Component {
   void check_scanning_finished();
   void start_connecting(const WiFiAP &ap, bool two);
   void set_fast_connect(bool fast_connect);
+  /// Scans in the background while the signal is below rssi_threshold and moves to an access point of the same
+  /// network that is at least rssi_improvement dB stronger
+  void set_roaming(int8_t rssi_threshold, uint32_t scan_interval, uint8_t rssi_improvement) {
+    this->roaming_ = true;
+    this->roaming_rssi_threshold_ = rssi_threshold;
+    this->roaming_scan_interval_ = scan_interval;
+    this->roaming_rssi_improvement_ = rssi_improvement;
+  }
+  uint32_t get_roaming_scan_count() const { return this->roaming_scan_count_; }
+  uint32_t get_roaming_handover_count() const { return this->roaming_handover_count_; }
   void set_ap_timeout(uint32_t ap_timeout) { ap_timeout_ = ap_timeout; }
 
   void check_connecting_finished();
@@ -355,6 +374,13 @@ class WiFiComponent : public Component {
 
   void load_fast_connect_settings_();
   void save_fast_connect_settings_();
+  /// Number of cached access points plus configured networks that fast_connect tries in turn
+  uint8_t fast_connect_candidates_() const;
+  /// Sets selected_ap_ to the candidate of fast_connect_attempt_
+  void select_fast_connect_ap_();
+  /// Starts and evaluates the background scans of roaming while connected
+  void check_roaming_(uint32_t now);
+  void roam_to_better_ap_();
 
 #ifdef USE_ESP8266
   static void wifi_event_callback(System_Event_t *event);
@@ -389,17 +415,28 @@ class WiFiComponent : public Component {
   optional<float> output_power_;
   ESPPreferenceObject pref_;
   ESPPreferenceObject fast_connect_pref_;
+  SavedWifiFastConnectSettings fast_connect_cache_{};
 
   // Group all 32-bit integers together
   uint32_t action_started_;
   uint32_t last_connected_{0};
   uint32_t reboot_timeout_{};
   uint32_t ap_timeout_{};
+  // start of the current attempts to connect, for the time until connected
+  uint32_t connect_start_{0};
+  uint32_t roaming_scan_interval_{0};
+  uint32_t roaming_last_scan_{0};
+  uint32_t roaming_scan_count_{0};
+  uint32_t roaming_handover_count_{0};
 
   // Group all 8-bit values together
   WiFiComponentState state_{WIFI_COMPONENT_STATE_OFF};
   WiFiPowerSaveMode power_save_{WIFI_POWER_SAVE_NONE};
   uint8_t num_retried_{0};
+  uint8_t fast_connect_attempt_{0};
+  int8_t fast_connect_network_{-1};
+  int8_t roaming_rssi_threshold_{0};
+  uint8_t roaming_rssi_improvement_{0};
 #if USE_NETWORK_IPV6
   uint8_t num_ipv6_addresses_{0};
 #endif /* USE_NETWORK_IPV6 */
@@ -414,6 +451,9 @@ class WiFiComponent : public Component {
   bool ap_setup_{false};
   bool passive_scan_{false};
   bool has_saved_wifi_settings_{false};
+  bool has_connected_{false};
+  bool roaming_{false};
+  bool roaming_scanning_{false};
 #ifdef USE_WIFI_11KV_SUPPORT
   bool btm_{false};
   bool rrm_{false};
@@ -1,11 +1,28 @@
 import esphome.codegen as cg
 from esphome.components import sensor
 import esphome.config_validation as cv
-from esphome.const import DEVICE_CLASS_TIMESTAMP, ENTITY_CATEGORY_DIAGNOSTIC
+from esphome.const import (
+    DEVICE_CLASS_DATA_RATE,
+    DEVICE_CLASS_TIMESTAMP,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+)
 
 from . import CONF_WIREGUARD_ID, Wireguard
 
 CONF_LATEST_HANDSHAKE = "latest_handshake"
+CONF_RX_RATE = "rx_rate"
+CONF_TX_RATE = "tx_rate"
+
+UNIT_BYTES_PER_SECOND = "B/s"
+
+_RATE_SCHEMA = sensor.sensor_schema(
+    unit_of_measurement=UNIT_BYTES_PER_SECOND,
+    accuracy_decimals=0,
+    device_class=DEVICE_CLASS_DATA_RATE,
+    state_class=STATE_CLASS_MEASUREMENT,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+)
 
 DEPENDENCIES = ["wireguard"]
 
@@ -15,6 +32,8 @@ CONFIG_SCHEMA = {
         device_class=DEVICE_CLASS_TIMESTAMP,
         entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
     ),
+    cv.Optional(CONF_TX_RATE): _RATE_SCHEMA,
+    cv.Optional(CONF_RX_RATE): _RATE_SCHEMA,
 }
 
 
@@ -24,3 +43,11 @@ async def to_code(config):
     if latest_handshake_config := config.get(CONF_LATEST_HANDSHAKE):
         sens = await sensor.new_sensor(latest_handshake_config)
         cg.add(parent.set_handshake_sensor(sens))
+
+    if tx_rate_config := config.get(CONF_TX_RATE):
+        sens = await sensor.new_sensor(tx_rate_config)
+        cg.add(parent.set_tx_rate_sensor(sens))
+
+    if rx_rate_config := config.get(CONF_RX_RATE):
+        sens = await sensor.new_sensor(rx_rate_config)
+        cg.add(parent.set_rx_rate_sensor(sens))
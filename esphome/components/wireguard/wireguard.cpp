@@ -13,6 +13,10 @@
 #include <esp_wireguard.h>
 #include <esp_wireguard_err.h>
 
+#ifdef USE_SENSOR
+#include <lwip/netif.h>
+#endif
+
 namespace esphome {
 namespace wireguard {
 
@@ -27,6 +31,27 @@ static const char *const TAG = "wireguard";
 static const char *const LOGMSG_ONLINE = "online";
 static const char *const LOGMSG_OFFLINE = "offline";
 
+#ifdef USE_SENSOR
+// Plain IP bytes through the tunnel. Only the lwIP thread writes them, the reads in update() don't need a lock.
+static uint32_t tunnel_tx_bytes = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static uint32_t tunnel_rx_bytes = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+// Handlers of the WireGuard netif that the counting hooks pass the packets on to
+static netif_output_fn tunnel_output = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static netif_input_fn tunnel_input = nullptr;    // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+// Outgoing packets, before they are encrypted
+static err_t count_tunnel_output(struct netif *netif, struct pbuf *p, const ip4_addr_t *ipaddr) {
+  tunnel_tx_bytes += p->tot_len;
+  return tunnel_output(netif, p, ipaddr);
+}
+
+// Incoming packets, after they were decrypted
+static err_t count_tunnel_input(struct pbuf *p, struct netif *inp) {
+  tunnel_rx_bytes += p->tot_len;
+  return tunnel_input(p, inp);
+}
+#endif
+
 void Wireguard::setup() {
   ESP_LOGCONFIG(TAG, "Running setup");
 
@@ -129,6 +154,7 @@ void Wireguard::update() {
   if (this->handshake_sensor_ != nullptr && lhs_updated) {
     this->handshake_sensor_->publish_state((double) this->latest_saved_handshake_);
   }
+  this->publish_rates_();
 #endif
 }
 
@@ -195,6 +221,8 @@ void Wireguard::set_enabled_sensor(binary_sensor::BinarySensor *sensor) { this->
 
 #ifdef USE_SENSOR
 void Wireguard::set_handshake_sensor(sensor::Sensor *sensor) { this->handshake_sensor_ = sensor; }
+void Wireguard::set_tx_rate_sensor(sensor::Sensor *sensor) { this->tx_rate_sensor_ = sensor; }
+void Wireguard::set_rx_rate_sensor(sensor::Sensor *sensor) { this->rx_rate_sensor_ = sensor; }
 #endif
 
 #ifdef USE_TEXT_SENSOR
@@ -260,6 +288,9 @@ void Wireguard::start_connection_() {
 
   if (this->wg_connected_ == ESP_OK) {
     ESP_LOGI(TAG, "Connection started");
+#ifdef USE_SENSOR
+    this->count_traffic_();
+#endif
   } else if (this->wg_connected_ == ESP_ERR_RETRY) {
     ESP_LOGD(TAG, "Waiting for endpoint IP address to be available");
     return;
@@ -295,6 +326,39 @@ void Wireguard::stop_connection_() {
   }
 }
 
+#ifdef USE_SENSOR
+void Wireguard::count_traffic_() {
+  if (this->tx_rate_sensor_ == nullptr && this->rx_rate_sensor_ == nullptr)
+    return;
+  LwIPLock lock;
+  // A new netif is created on every connect, hook it each time
+  struct netif *netif = this->wg_ctx_.netif;
+  if (netif == nullptr || netif->output == count_tunnel_output)
+    return;
+  tunnel_output = netif->output;
+  netif->output = count_tunnel_output;
+  tunnel_input = netif->input;
+  netif->input = count_tunnel_input;
+}
+
+void Wireguard::publish_rates_() {
+  const uint32_t now = millis();
+  const uint32_t tx_bytes = tunnel_tx_bytes;
+  const uint32_t rx_bytes = tunnel_rx_bytes;
+  const uint32_t elapsed = now - this->last_rate_update_;
+  // The first update only takes the starting point
+  if (this->last_rate_update_ != 0 && elapsed > 0) {
+    if (this->tx_rate_sensor_ != nullptr)
+      this->tx_rate_sensor_->publish_state((tx_bytes - this->last_tx_bytes_) * 1000.0f / elapsed);
+    if (this->rx_rate_sensor_ != nullptr)
+      this->rx_rate_sensor_->publish_state((rx_bytes - this->last_rx_bytes_) * 1000.0f / elapsed);
+  }
+  this->last_tx_bytes_ = tx_bytes;
+  this->last_rx_bytes_ = rx_bytes;
+  this->last_rate_update_ = now;
+}
+#endif
+
 std::string mask_key(const std::string &key) { return (key.substr(0, 5) + "[...]="); }
 
 }  // namespace wireguard
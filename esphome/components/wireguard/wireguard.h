@@ -58,6 +58,8 @@ class Wireguard : public PollingComponent {
 
 #ifdef USE_SENSOR
   void set_handshake_sensor(sensor::Sensor *sensor);
+  void set_tx_rate_sensor(sensor::Sensor *sensor);
+  void set_rx_rate_sensor(sensor::Sensor *sensor);
 #endif
 
 #ifdef USE_TEXT_SENSOR
@@ -105,6 +107,13 @@ class Wireguard : public PollingComponent {
 
 #ifdef USE_SENSOR
   sensor::Sensor *handshake_sensor_ = nullptr;
+  sensor::Sensor *tx_rate_sensor_ = nullptr;
+  sensor::Sensor *rx_rate_sensor_ = nullptr;
+
+  /// Byte counters and time at the previous update, for the rates
+  uint32_t last_tx_bytes_ = 0;
+  uint32_t last_rx_bytes_ = 0;
+  uint32_t last_rate_update_ = 0;
 #endif
 
 #ifdef USE_TEXT_SENSOR
@@ -136,6 +145,12 @@ class Wireguard : public PollingComponent {
 
   void start_connection_();
   void stop_connection_();
+
+#ifdef USE_SENSOR
+  /// Count the packets going through the tunnel netif, for the rate sensors
+  void count_traffic_();
+  void publish_rates_();
+#endif
 };
 
 // These are used for possibly long DNS resolution to temporarily suspend the watchdog
@@ -0,0 +1,71 @@
+import esphome.codegen as cg
+from esphome.components.esp32 import get_esp32_variant
+from esphome.components.esp32.const import (
+    VARIANT_ESP32C2,
+    VARIANT_ESP32C3,
+    VARIANT_ESP32C5,
+    VARIANT_ESP32C6,
+    VARIANT_ESP32H2,
+    VARIANT_ESP32S2,
+)
+import esphome.config_validation as cv
+from esphome.const import CONF_COMPONENTS, CONF_ID, CONF_PRIORITY
+
+CODEOWNERS = ["@esphome/core"]
+DEPENDENCIES = ["esp32"]
+MULTI_CONF = True
+
+CONF_CORE = "core"
+CONF_STACK_SIZE = "stack_size"
+
+# Variants with a single CPU core only have core 0
+SINGLE_CORE_VARIANTS = (
+    VARIANT_ESP32C2,
+    VARIANT_ESP32C3,
+    VARIANT_ESP32C5,
+    VARIANT_ESP32C6,
+    VARIANT_ESP32H2,
+    VARIANT_ESP32S2,
+)
+
+worker_task_ns = cg.esphome_ns.namespace("worker_task")
+WorkerTask = worker_task_ns.class_("WorkerTask", cg.Component)
+
+
+def _validate_core(config):
+    if config[CONF_CORE] != 0 and get_esp32_variant() in SINGLE_CORE_VARIANTS:
+        raise cv.Invalid(
+            f"{get_esp32_variant()} has a single core, use core: 0", path=[CONF_CORE]
+        )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    cv.only_on_esp32,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(WorkerTask),
+            cv.Required(CONF_COMPONENTS): cv.All(
+                cv.ensure_list(cv.use_id(cg.Component)), cv.Length(min=1)
+            ),
+            cv.Optional(CONF_CORE, default=1): cv.int_range(min=0, max=1),
+            cv.Optional(CONF_PRIORITY, default=1): cv.int_range(min=1, max=20),
+            cv.Optional(CONF_STACK_SIZE, default=4096): cv.int_range(
+                min=2048, max=65536
+            ),
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    _validate_core,
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    cg.add_define("USE_WORKER_TASK")
+    await cg.register_component(var, config)
+    cg.add(var.set_core(config[CONF_CORE]))
+    cg.add(var.set_priority(config[CONF_PRIORITY]))
+    cg.add(var.set_stack_size(config[CONF_STACK_SIZE]))
+    for component_id in config[CONF_COMPONENTS]:
+        component = await cg.get_variable(component_id)
+        cg.add(var.add_component(component))
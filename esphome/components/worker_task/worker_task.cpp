@@ -0,0 +1,102 @@
+#include "worker_task.h"
+
+#ifdef USE_ESP32
+
+#include "esphome/core/application.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace worker_task {
+
+static const char *const TAG = "worker_task";
+
+void WorkerTask::setup() { this->main_task_handle_ = xTaskGetCurrentTaskHandle(); }
+
+void WorkerTask::loop() {
+  if (this->task_handle_ == nullptr) {
+    // Wait until every component finished setup() before taking over their loop()
+    if (!App.is_setup_complete())
+      return;
+    this->start_task_();
+    return;
+  }
+
+  MainLoopCall *call;
+  while ((call = this->main_loop_calls_.pop()) != nullptr) {
+    call->callback();
+    this->main_loop_call_pool_.release(call);
+  }
+
+  uint16_t dropped = this->main_loop_calls_.get_and_reset_dropped_count();
+  if (dropped > 0) {
+    ESP_LOGW(TAG, "Dropped %u main loop calls, queue full", dropped);
+  }
+}
+
+void WorkerTask::start_task_() {
+  for (auto *component : this->components_)
+    App.detach_component_loop(component);
+
+  BaseType_t res = xTaskCreatePinnedToCore(WorkerTask::task_func_, "worker", this->stack_size_, this, this->priority_,
+                                           &this->task_handle_, this->core_);
+  if (res != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create task");
+    this->task_handle_ = nullptr;
+    this->mark_failed();
+    return;
+  }
+  ESP_LOGD(TAG, "Running %u components on core %u", (unsigned) this->components_.size(), this->core_);
+}
+
+void WorkerTask::task_func_(void *arg) {
+  auto *self = static_cast<WorkerTask *>(arg);
+  while (true) {
+    for (auto *component : self->components_) {
+      // enable_loop() requests of detached components never reach the main loop's list
+      component->apply_pending_enable_loop();
+      if (!component->is_failed())
+        component->call();
+    }
+    // Give lower priority tasks (including the idle task and its watchdog) a chance to run
+    vTaskDelay(1);
+  }
+}
+
+bool WorkerTask::run_in_main_loop(std::function<void()> &&callback) {
+  if (xTaskGetCurrentTaskHandle() == this->main_task_handle_) {
+    callback();
+    return true;
+  }
+
+  MainLoopCall *call = this->main_loop_call_pool_.allocate();
+  if (call == nullptr) {
+    this->main_loop_calls_.increment_dropped_count();
+    return false;
+  }
+  call->callback = std::move(callback);
+  if (!this->main_loop_calls_.push(call)) {
+    this->main_loop_call_pool_.release(call);
+    return false;
+  }
+#ifdef USE_EVENT_DRIVEN_LOOP
+  App.wake_loop_threadsafe();
+#endif
+  return true;
+}
+
+void WorkerTask::dump_config() {
+  ESP_LOGCONFIG(TAG,
+                "Worker Task:\n"
+                "  Core: %u\n"
+                "  Priority: %u\n"
+                "  Stack Size: %" PRIu32,
+                this->core_, this->priority_, this->stack_size_);
+  for (auto *component : this->components_) {
+    ESP_LOGCONFIG(TAG, "  Component: %s", component->get_component_source());
+  }
+}
+
+}  // namespace worker_task
+}  // namespace esphome
+
+#endif  // USE_ESP32
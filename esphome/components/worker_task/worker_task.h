@@ -0,0 +1,81 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_ESP32
+
+#include <functional>
+#include <vector>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include "esphome/core/component.h"
+#include "esphome/core/event_pool.h"
+#include "esphome/core/lock_free_queue.h"
+
+namespace esphome {
+namespace worker_task {
+
+/// A callback queued by the worker task to run on the main loop.
+struct MainLoopCall {
+  std::function<void()> callback;
+
+  void release() { this->callback = nullptr; }
+};
+
+/** Runs the loop() of selected components on a dedicated FreeRTOS task pinned to a CPU core.
+ *
+ * The components are set up on the main loop as usual. Once setup() of all components has finished they are
+ * removed from the main loop and driven exclusively by the worker task.
+ *
+ * Entity state must stay single-threaded, so code running on the worker must not call publish_state() directly.
+ * It hands the work to the main loop with run_in_main_loop(), which is wait-free and allocation-free in steady
+ * state. Scheduler calls (set_timeout(), defer(), ...) are thread-safe, but their callbacks run on the main loop
+ * while loop() may be running on the worker, so state they share with loop() needs its own synchronization.
+ * enable_loop() and disable_loop() may be called on the worker; the main loop applies them to its list of looping
+ * components.
+ */
+class WorkerTask : public Component {
+ public:
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void add_component(Component *component) { this->components_.push_back(component); }
+  void set_core(uint8_t core) { this->core_ = core; }
+  void set_priority(uint8_t priority) { this->priority_ = priority; }
+  void set_stack_size(uint32_t stack_size) { this->stack_size_ = stack_size; }
+
+  /** Run a callback on the main loop.
+   *
+   * Called on the main loop it runs immediately. Called from any other task it is queued and runs during the
+   * next WorkerTask::loop(). Only the worker task may queue callbacks (single producer).
+   *
+   * @return false if the queue is full and the callback was dropped.
+   */
+  bool run_in_main_loop(std::function<void()> &&callback);
+
+ protected:
+  static constexpr uint8_t MAX_MAIN_LOOP_CALLS = 16;
+
+  static void task_func_(void *arg);
+  void start_task_();
+
+  std::vector<Component *> components_;
+  TaskHandle_t task_handle_{nullptr};
+  TaskHandle_t main_task_handle_{nullptr};
+  uint32_t stack_size_{4096};
+  uint8_t core_{1};
+  uint8_t priority_{1};
+
+  // Callbacks produced on the worker task and consumed by the main loop
+  LockFreeQueue<MainLoopCall, MAX_MAIN_LOOP_CALLS> main_loop_calls_;
+  EventPool<MainLoopCall, MAX_MAIN_LOOP_CALLS> main_loop_call_pool_;
+};
+
+}  // namespace worker_task
+}  // namespace esphome
+
+#endif  // USE_ESP32
@@ -7,6 +7,8 @@
 
 #ifdef USE_ESP32
 
+#include "mbedtls/ccm.h"
+
 namespace esphome {
 namespace xiaomi_ble {
 
@@ -71,6 +73,30 @@ bool parse_xiaomi_value(uint16_t value_type, const uint8_t *data, uint8_t value_
 bool parse_xiaomi_message(const std::vector<uint8_t> &message, XiaomiParseResult &result);
 optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::ServiceData &service_data);
 bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, const uint64_t &address);
+
+/** AES-CCM context keyed once with a device's bindkey and reused for every packet.
+ *
+ * mbedTLS expands the key in set_key() instead of on every advertisement, and uses the hardware AES
+ * accelerator when the SoC has one.
+ */
+class XiaomiDecryptor {
+ public:
+  XiaomiDecryptor() { mbedtls_ccm_init(&this->ctx_); }
+  ~XiaomiDecryptor() { mbedtls_ccm_free(&this->ctx_); }
+  XiaomiDecryptor(const XiaomiDecryptor &) = delete;
+  XiaomiDecryptor &operator=(const XiaomiDecryptor &) = delete;
+
+  bool set_key(const uint8_t *bindkey);
+  /// Decrypt the payload of \p raw in place and clear its encrypted flag, returns false if it doesn't authenticate.
+  bool decrypt(std::vector<uint8_t> &raw, uint64_t address);
+
+  const uint8_t *get_key() const { return this->key_; }
+
+ protected:
+  mbedtls_ccm_context ctx_;
+  uint8_t key_[16]{};
+  bool keyed_{false};
+};
 bool report_xiaomi_results(const optional<XiaomiParseResult> &result, const std::string &address);
 
 class XiaomiListener : public esp32_ble_tracker::ESPBTDeviceListener {
@@ -24,6 +24,7 @@ class XiaomiCGD1 : public Component, public esp32_ble_tracker::ESPBTDeviceListen
  protected:
   uint64_t address_;
   uint8_t bindkey_[16];
+  xiaomi_ble::XiaomiDecryptor decryptor_;
   sensor::Sensor *temperature_{nullptr};
   sensor::Sensor *humidity_{nullptr};
   sensor::Sensor *battery_level_{nullptr};
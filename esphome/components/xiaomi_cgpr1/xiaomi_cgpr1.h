@@ -28,6 +28,7 @@ class XiaomiCGPR1 : public Component,
  protected:
   uint64_t address_;
   uint8_t bindkey_[16];
+  xiaomi_ble::XiaomiDecryptor decryptor_;
   sensor::Sensor *idle_time_{nullptr};
   sensor::Sensor *battery_level_{nullptr};
   sensor::Sensor *illuminance_{nullptr};
@@ -29,6 +29,7 @@ class XiaomiMJYD02YLA : public Component,
  protected:
   uint64_t address_;
   uint8_t bindkey_[16];
+  xiaomi_ble::XiaomiDecryptor decryptor_;
   sensor::Sensor *idle_time_{nullptr};
   sensor::Sensor *battery_level_{nullptr};
   sensor::Sensor *illuminance_{nullptr};
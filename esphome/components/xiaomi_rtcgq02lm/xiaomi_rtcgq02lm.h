@@ -40,6 +40,7 @@ class XiaomiRTCGQ02LM : public Component, public esp32_ble_tracker::ESPBTDeviceL
  protected:
   uint64_t address_;
   uint8_t bindkey_[16];
+  xiaomi_ble::XiaomiDecryptor decryptor_;
 
 #ifdef USE_BINARY_SENSOR
   uint16_t motion_timeout_;
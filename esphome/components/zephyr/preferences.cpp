@@ -18,8 +18,11 @@ class ZephyrPreferenceBackend : public ESPPreferenceBackend {
   ZephyrPreferenceBackend(uint32_t type, std::vector<uint8_t> &&data) : data(std::move(data)) { this->type_ = type; }
 
   bool save(const uint8_t *data, size_t len) override {
+    if (len == this->data.size() && std::memcmp(this->data.data(), data, len) == 0)
+      return true;
     this->data.resize(len);
     std::memcpy(this->data.data(), data, len);
+    this->dirty = true;
     ESP_LOGVV(TAG, "save key: %u, len: %d", this->type_, len);
     return true;
   }
@@ -38,6 +41,8 @@ class ZephyrPreferenceBackend : public ESPPreferenceBackend {
   std::string get_key() const { return str_sprintf(ESPHOME_SETTINGS_KEY "/%" PRIx32, this->type_); }
 
   std::vector<uint8_t> data;
+  /// Changed since the last sync, only these are written to flash
+  bool dirty{false};
 
  protected:
   uint32_t type_ = 0;
@@ -90,13 +95,26 @@ class ZephyrPreferences : public ESPPreferences {
   }
 
   bool sync() override {
-    ESP_LOGD(TAG, "Save settings");
-    int err = settings_save();
-    if (err) {
-      ESP_LOGE(TAG, "Cannot save settings, err: %d", err);
-      return false;
+    // Write only what changed, in one pass per sync, so the flash isn't touched when nothing did
+    bool success = true;
+    size_t written = 0;
+    for (auto *backend : this->backends_) {
+      if (!backend->dirty)
+        continue;
+      auto name = backend->get_key();
+      int err = backend->data.empty() ? settings_delete(name.c_str())
+                                      : settings_save_one(name.c_str(), backend->data.data(), backend->data.size());
+      if (err) {
+        ESP_LOGE(TAG, "Cannot save setting %s, err: %d", name.c_str(), err);
+        success = false;
+        continue;
+      }
+      backend->dirty = false;
+      written++;
     }
-    return true;
+    if (written > 0)
+      ESP_LOGD(TAG, "Saved %u settings", written);
+    return success;
   }
 
   bool reset() override {
@@ -104,6 +122,7 @@ class ZephyrPreferences : public ESPPreferences {
     for (auto *backend : this->backends_) {
       // save empty delete data
       backend->data.clear();
+      backend->dirty = true;
     }
     sync();
     return true;
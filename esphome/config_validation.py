@@ -39,6 +39,7 @@ from esphome.const import (
     CONF_ICON,
     CONF_ID,
     CONF_INTERNAL,
+    CONF_LOOP_TIER,
     CONF_MINUTE,
     CONF_MONTH,
     CONF_NAME,
@@ -50,6 +51,7 @@ from esphome.const import (
     CONF_REF,
     CONF_RETAIN,
     CONF_SECOND,
+    CONF_SETUP_ASYNC,
     CONF_SETUP_PRIORITY,
     CONF_STATE_TOPIC,
     CONF_SUBSCRIBE_QOS,
@@ -1965,7 +1967,15 @@ ENTITY_BASE_SCHEMA = Schema(
 
 ENTITY_BASE_SCHEMA.add_extra(_entity_base_validator)
 
-COMPONENT_SCHEMA = Schema({Optional(CONF_SETUP_PRIORITY): float_})
+LOOP_TIERS = ("realtime", "normal", "background")
+
+COMPONENT_SCHEMA = Schema(
+    {
+        Optional(CONF_SETUP_PRIORITY): float_,
+        Optional(CONF_SETUP_ASYNC): boolean,
+        Optional(CONF_LOOP_TIER): one_of(*LOOP_TIERS, lower=True),
+    }
+)
 
 
 def polling_component_schema(default_update_interval):
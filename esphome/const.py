@@ -136,6 +136,7 @@ CONF_AWAY_COMMAND_TOPIC = "away_command_topic"
 CONF_AWAY_CONFIG = "away_config"
 CONF_AWAY_STATE_TOPIC = "away_state_topic"
 CONF_BACKGROUND_COLOR = "background_color"
+CONF_BACKGROUND_LOOP_BUDGET = "background_loop_budget"
 CONF_BACKLIGHT_PIN = "backlight_pin"
 CONF_BASELINE = "baseline"
 CONF_BATTERY_LEVEL = "battery_level"
@@ -339,6 +340,7 @@ CONF_ESPHOME = "esphome"
 CONF_ETHANOL = "ethanol"
 CONF_ETHERNET = "ethernet"
 CONF_EVENT = "event"
+CONF_EVENT_DRIVEN_LOOP = "event_driven_loop"
 CONF_EVENT_TYPE = "event_type"
 CONF_EVENT_TYPES = "event_types"
 CONF_EXPIRE_AFTER = "expire_after"
@@ -527,6 +529,8 @@ CONF_LOG_TOPIC = "log_topic"
 CONF_LOGGER = "logger"
 CONF_LOGS = "logs"
 CONF_LONGITUDE = "longitude"
+CONF_LOOP_ARENA_SIZE = "loop_arena_size"
+CONF_LOOP_TIER = "loop_tier"
 CONF_LOOP_TIME = "loop_time"
 CONF_LOW = "low"
 CONF_LOW_VOLTAGE_REFERENCE = "low_voltage_reference"
@@ -549,6 +553,7 @@ CONF_MAX_RANGE = "max_range"
 CONF_MAX_REFRESH_RATE = "max_refresh_rate"
 CONF_MAX_SPEED = "max_speed"
 CONF_MAX_TEMPERATURE = "max_temperature"
+CONF_MAX_UPDATES_PER_LOOP = "max_updates_per_loop"
 CONF_MAX_VALUE = "max_value"
 CONF_MAX_VOLTAGE = "max_voltage"
 CONF_MDNS = "mdns"
@@ -841,6 +846,8 @@ CONF_SAMSUNG = "samsung"
 CONF_SATELLITES = "satellites"
 CONF_SCAN = "scan"
 CONF_SCAN_RESULTS = "scan_results"
+CONF_SCHEDULER_DEFER_RING_SIZE = "scheduler_defer_ring_size"
+CONF_SCHEDULER_POOL_SIZE = "scheduler_pool_size"
 CONF_SCL = "scl"
 CONF_SCL_PIN = "scl_pin"
 CONF_SDA = "sda"
@@ -865,6 +872,7 @@ CONF_SERVICE_UUID = "service_uuid"
 CONF_SERVICES = "services"
 CONF_SET_ACTION = "set_action"
 CONF_SET_POINT_MINIMUM_DIFFERENTIAL = "set_point_minimum_differential"
+CONF_SETUP_ASYNC = "setup_async"
 CONF_SETUP_MODE = "setup_mode"
 CONF_SETUP_PRIORITY = "setup_priority"
 CONF_SHOW_LINES = "show_lines"
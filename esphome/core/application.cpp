@@ -2,11 +2,18 @@
 #include "esphome/core/log.h"
 #include "esphome/core/version.h"
 #include "esphome/core/hal.h"
+#include "esphome/core/loop_arena.h"
 #include <algorithm>
 #include <ranges>
 #ifdef USE_RUNTIME_STATS
 #include "esphome/components/runtime_stats/runtime_stats.h"
 #endif
+#ifdef USE_RUNTIME_STATS_TRACE
+#include "esphome/components/runtime_stats/trace_buffer.h"
+#endif
+#ifdef USE_BOOT_PROFILER
+#include "esphome/components/boot_profiler/boot_profiler.h"
+#endif
 
 #ifdef USE_STATUS_LED
 #include "esphome/components/status_led/status_led.h"
@@ -26,14 +33,32 @@
 #else
 // True BSD sockets (e.g., host platform)
 #include <sys/select.h>
+#ifdef USE_EVENT_DRIVEN_LOOP
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
 #endif
 #endif
 #endif
 
+#if defined(USE_EVENT_DRIVEN_LOOP) && defined(USE_ZEPHYR)
+#include <zephyr/kernel.h>
+
+// Given to end the wait of the main loop early, the kernel idles the CPU while the loop waits on it
+K_SEM_DEFINE(wake_loop_sem, 0, 1);  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "app";
 
+void Application::entity_registry_full_(size_t capacity) {
+  ESP_LOGE(TAG, "Entity registry full (%u entries), entity not registered!", (unsigned) capacity);
+}
+
 void Application::register_component_(Component *comp) {
   if (comp == nullptr) {
     ESP_LOGW(TAG, "Tried to register null component!");
@@ -50,6 +75,12 @@ void Application::register_component_(Component *comp) {
 }
 void Application::setup() {
   ESP_LOGI(TAG, "Running through setup()");
+#ifdef USE_WORKER_TASK
+  this->loop_task_ = xTaskGetCurrentTaskHandle();
+#endif
+#ifdef USE_EVENT_DRIVEN_LOOP
+  this->setup_wake_loop_();
+#endif
   ESP_LOGV(TAG, "Sorting components by setup priority");
   std::stable_sort(this->components_.begin(), this->components_.end(), [](const Component *a, const Component *b) {
     return a->get_actual_setup_priority() > b->get_actual_setup_priority();
@@ -61,14 +92,21 @@ void Application::setup() {
   for (uint32_t i = 0; i < this->components_.size(); i++) {
     Component *component = this->components_[i];
 
-    // Update loop_component_start_time_ before calling each component during setup
-    this->loop_component_start_time_ = millis();
-    component->call();
+#ifdef USE_SETUP_ASYNC
+    // Async components may already have been set up while an earlier component was blocking
+    if ((component->get_component_state() & COMPONENT_STATE_MASK) == COMPONENT_STATE_CONSTRUCTION)
+      this->setup_component_(component);
+#else
+    this->setup_component_(component);
+#endif
     this->scheduler.process_to_add();
     this->feed_wdt();
     if (component->can_proceed())
       continue;
 
+#ifdef USE_BOOT_PROFILER
+    uint32_t wait_start = millis();
+#endif
     std::stable_sort(this->components_.begin(), this->components_.begin() + i + 1,
                      [](Component *a, Component *b) { return a->get_loop_priority() > b->get_loop_priority(); });
 
@@ -88,48 +126,103 @@ void Application::setup() {
         this->feed_wdt();
       }
 
+#ifdef USE_SETUP_ASYNC
+      // Bring up later async components in parallel with the blocking one instead of after it.
+      // The first call() runs their setup(), the following ones their loop().
+      for (uint32_t j = i + 1; j < this->components_.size(); j++) {
+        Component *async_component = this->components_[j];
+        if (!async_component->is_setup_async())
+          continue;
+        if ((async_component->get_component_state() & COMPONENT_STATE_MASK) == COMPONENT_STATE_CONSTRUCTION) {
+          this->setup_component_(async_component);
+        } else {
+          this->loop_component_start_time_ = millis();
+          async_component->call();
+        }
+        new_app_state |= async_component->get_component_state();
+        this->app_state_ |= new_app_state;
+        this->feed_wdt();
+      }
+#endif
+
       this->after_loop_tasks_();
       this->app_state_ = new_app_state;
       yield();
     } while (!component->can_proceed());
+#ifdef USE_BOOT_PROFILER
+    if (global_boot_profiler != nullptr)
+      global_boot_profiler->record_wait(component, millis() - wait_start);
+#endif
   }
 
   ESP_LOGI(TAG, "setup() finished successfully!");
+  this->setup_complete_ = true;
+#ifdef USE_BOOT_PROFILER
+  if (global_boot_profiler != nullptr)
+    global_boot_profiler->record_setup_complete(millis());
+#endif
 
   // Clear setup priority overrides to free memory
   clear_setup_priority_overrides();
 
   this->schedule_dump_config();
 }
+void Application::setup_component_(Component *component) {
+  // Update loop_component_start_time_ before calling each component during setup
+  this->loop_component_start_time_ = millis();
+#ifdef USE_DEBUG_HEAP_TRACKING
+  auto heap_start = global_heap_tracker.begin();
+#endif
+#ifdef USE_RUNTIME_STATS_TRACE
+  runtime_stats::TraceScope trace_scope(component->get_component_source(), runtime_stats::TraceCategory::SETUP);
+#endif
+#if defined(USE_RUNTIME_STATS) || defined(USE_BOOT_PROFILER)
+  uint32_t setup_start_us = micros();
+  component->call();
+  uint32_t setup_us = micros() - setup_start_us;
+#ifdef USE_RUNTIME_STATS
+  if (global_runtime_stats != nullptr) {
+    global_runtime_stats->record_component_time(component, ComponentTimingSource::SETUP,
+                                                millis() - this->loop_component_start_time_, setup_us,
+                                                this->loop_component_start_time_);
+  }
+#endif
+#ifdef USE_BOOT_PROFILER
+  if (global_boot_profiler != nullptr)
+    global_boot_profiler->record_setup(component, this->loop_component_start_time_, setup_us);
+#endif
+#else
+  component->call();
+#endif
+#ifdef USE_DEBUG_HEAP_TRACKING
+  global_heap_tracker.record(component, heap_start);
+#endif
+}
 void Application::loop() {
   uint8_t new_app_state = 0;
 
   // Get the initial loop time at the start
   uint32_t last_op_end_time = millis();
+#ifdef USE_DEBUG_LOOP_STATS
+  global_loop_stats.begin_iteration(last_op_end_time);
+#endif
 
   this->before_loop_tasks_(last_op_end_time);
 
+#ifdef USE_LOOP_TIERS
+  this->loop_tiers_(last_op_end_time, new_app_state);
+#else
   for (this->current_loop_index_ = 0; this->current_loop_index_ < this->looping_components_active_end_;
        this->current_loop_index_++) {
-    Component *component = this->looping_components_[this->current_loop_index_];
-
-    // Update the cached time before each component runs
-    this->loop_component_start_time_ = last_op_end_time;
-
-    {
-      this->set_current_component(component);
-      WarnIfComponentBlockingGuard guard{component, last_op_end_time};
-      component->call();
-      // Use the finish method to get the current time as the end time
-      last_op_end_time = guard.finish();
-    }
-    new_app_state |= component->get_component_state();
-    this->app_state_ |= new_app_state;
-    this->feed_wdt(last_op_end_time);
+    this->loop_component_(this->looping_components_[this->current_loop_index_], last_op_end_time, new_app_state);
   }
+#endif
 
   this->after_loop_tasks_();
   this->app_state_ = new_app_state;
+#ifdef USE_DEBUG_LOOP_STATS
+  global_loop_stats.end_iteration(last_op_end_time, this->loop_interval_);
+#endif
 
 #ifdef USE_RUNTIME_STATS
   // Process any pending runtime stats printing after all components have run
@@ -145,16 +238,33 @@ void Application::loop() {
     // Even if we overran the loop interval, we still need to select()
     // to know if any sockets have data ready
     this->yield_with_select_(0);
+#ifdef USE_EVENT_DRIVEN_LOOP
+  } else if (this->wake_requested_) {
+    // Work was handed to us while the components ran, don't go to sleep
+    this->yield_with_select_(0);
+#endif
   } else {
     uint32_t delay_time = this->loop_interval_ - elapsed;
+#ifdef USE_EVENT_DRIVEN_LOOP
+    // Sleep until the next scheduler deadline instead of the next loop interval. Socket activity
+    // and wake_loop_threadsafe() end the wait early. Components with an active loop() still run
+    // every loop interval, only an idle loop sleeps longer.
+    uint32_t max_sleep = this->looping_components_active_end_ == 0 ? EVENT_DRIVEN_LOOP_MAX_SLEEP_MS : delay_time;
+    uint32_t next_schedule = this->scheduler.next_schedule_in(last_op_end_time).value_or(max_sleep);
+    delay_time = std::min(std::max(next_schedule, delay_time / 2), max_sleep);
+#else
     uint32_t next_schedule = this->scheduler.next_schedule_in(last_op_end_time).value_or(delay_time);
     // next_schedule is max 0.5*delay_time
     // otherwise interval=0 schedules result in constant looping with almost no sleep
     next_schedule = std::max(next_schedule, delay_time / 2);
     delay_time = std::min(next_schedule, delay_time);
+#endif
 
     this->yield_with_select_(delay_time);
   }
+#ifdef USE_EVENT_DRIVEN_LOOP
+  this->consume_wake_loop_();
+#endif
   this->last_loop_ = last_op_end_time;
 
   if (this->dump_config_at_ < this->components_.size()) {
@@ -259,6 +369,57 @@ void Application::teardown_components(uint32_t timeout_ms) {
   }
 }
 
+inline void ESPHOME_ALWAYS_INLINE Application::loop_component_(Component *component, uint32_t &last_op_end_time,
+                                                               uint8_t &new_app_state) {
+  // Update the cached time before each component runs
+  this->loop_component_start_time_ = last_op_end_time;
+
+  {
+    this->set_current_component(component);
+    WarnIfComponentBlockingGuard guard{component, last_op_end_time};
+    component->call();
+    // Use the finish method to get the current time as the end time
+    last_op_end_time = guard.finish();
+  }
+  new_app_state |= component->get_component_state();
+  this->app_state_ |= new_app_state;
+  this->feed_wdt(last_op_end_time);
+}
+
+#ifdef USE_LOOP_TIERS
+void HOT Application::loop_tiers_(uint32_t &last_op_end_time, uint8_t &new_app_state) {
+  // The active section is ordered by tier, so realtime and normal components form a prefix that always runs.
+  // Same reentrancy rules as the flat loop: disable_component_loop_() adjusts current_loop_index_
+  for (this->current_loop_index_ = 0; this->current_loop_index_ < this->looping_components_active_end_;
+       this->current_loop_index_++) {
+    Component *component = this->looping_components_[this->current_loop_index_];
+    if (component->get_actual_loop_tier() == LoopTier::BACKGROUND)
+      break;
+    this->loop_component_(component, last_op_end_time, new_app_state);
+  }
+
+  // The rest are background components, served round-robin starting where the previous iteration ran out of budget
+  const uint16_t begin = this->current_loop_index_;
+  const uint16_t count = this->looping_components_active_end_ - begin;
+  if (this->background_loop_index_ < begin || this->background_loop_index_ >= this->looping_components_active_end_)
+    this->background_loop_index_ = begin;
+  this->current_loop_index_ = this->background_loop_index_;
+  const uint32_t start = last_op_end_time;
+
+  for (uint16_t visited = 0; visited < count && begin < this->looping_components_active_end_; visited++) {
+    // Always run at least one component so the tier can't starve
+    if (visited != 0 && last_op_end_time - start >= this->background_loop_budget_)
+      break;
+    this->loop_component_(this->looping_components_[this->current_loop_index_], last_op_end_time, new_app_state);
+    // disable_component_loop_() may have moved current_loop_index_ back by one (wrapping to UINT16_MAX at 0)
+    this->current_loop_index_++;
+    if (this->current_loop_index_ >= this->looping_components_active_end_)
+      this->current_loop_index_ = begin;
+  }
+  this->background_loop_index_ = this->current_loop_index_;
+}
+#endif
+
 void Application::calculate_looping_components_() {
   // Count total components that need looping
   size_t total_looping = 0;
@@ -279,9 +440,22 @@ void Application::calculate_looping_components_() {
         (obj->get_component_state() & COMPONENT_STATE_MASK) != COMPONENT_STATE_LOOP_DONE) {
       this->looping_components_.push_back(obj);
     }
+#ifdef USE_LOOP_TIERS
+    // Cache the tier in the component state so loop() doesn't need a virtual call per component
+    if (obj->has_overridden_loop())
+      obj->set_loop_tier(obj->get_actual_loop_tier());
+#endif
   }
 
   this->looping_components_active_end_ = this->looping_components_.size();
+#ifdef USE_LOOP_TIERS
+  // Order the active section by tier, keeping the loop priority order within each tier
+  std::stable_sort(this->looping_components_.begin(),
+                   this->looping_components_.begin() + this->looping_components_active_end_,
+                   [](const Component *a, const Component *b) {
+                     return a->get_actual_loop_tier() < b->get_actual_loop_tier();
+                   });
+#endif
 
   // Then add any components that are already LOOP_DONE to the inactive section
   // This handles components that called disable_loop() during initialization
@@ -302,6 +476,22 @@ void Application::disable_component_loop_(Component *component) {
     if (this->looping_components_[i] == component) {
       // Move last active component to this position
       this->looping_components_active_end_--;
+#ifdef USE_LOOP_TIERS
+      // Shift the rest of the active section down instead, so it stays ordered by tier
+      if (i != this->looping_components_active_end_) {
+        auto it = this->looping_components_.begin();
+        std::rotate(it + i, it + i + 1, it + this->looping_components_active_end_ + 1);
+
+        if (this->in_loop_ && i < this->current_loop_index_) {
+          // The running component moved down by one as well, step back so the next one isn't skipped
+          this->current_loop_index_--;
+        } else if (this->in_loop_ && i == this->current_loop_index_) {
+          this->current_loop_index_--;
+          this->loop_component_start_time_ = millis();
+        }
+      }
+      return;
+#endif
       if (i != this->looping_components_active_end_) {
         std::swap(this->looping_components_[i], this->looping_components_[this->looping_components_active_end_]);
 
@@ -322,11 +512,35 @@ void Application::disable_component_loop_(Component *component) {
   }
 }
 
+void Application::detach_component_loop(Component *component) {
+  // Reuse the reentrant disable path to move it out of the active section, then drop it entirely
+  // so neither enable_loop() nor pending ISR enables can bring it back
+  this->disable_component_loop_(component);
+  auto inactive_begin = this->looping_components_.begin() + this->looping_components_active_end_;
+  auto it = std::find(inactive_begin, this->looping_components_.end(), component);
+  if (it != this->looping_components_.end())
+    this->looping_components_.erase(it);
+}
+
 void Application::activate_looping_component_(uint16_t index) {
   // Helper to move component from inactive to active section
   if (index != this->looping_components_active_end_) {
     std::swap(this->looping_components_[index], this->looping_components_[this->looping_components_active_end_]);
   }
+#ifdef USE_LOOP_TIERS
+  // Keep the active section ordered by tier: move the component behind the last active one of its tier
+  auto it = this->looping_components_.begin();
+  const LoopTier tier = this->looping_components_[this->looping_components_active_end_]->get_actual_loop_tier();
+  uint16_t pos = this->looping_components_active_end_;
+  while (pos > 0 && this->looping_components_[pos - 1]->get_actual_loop_tier() > tier)
+    pos--;
+  if (pos != this->looping_components_active_end_) {
+    std::rotate(it + pos, it + this->looping_components_active_end_, it + this->looping_components_active_end_ + 1);
+    // Components from pos on moved up by one, follow the one that is currently running
+    if (this->in_loop_ && pos <= this->current_loop_index_)
+      this->current_loop_index_++;
+  }
+#endif
   this->looping_components_active_end_++;
 }
 
@@ -401,6 +615,9 @@ void Application::enable_pending_loops_() {
 }
 
 void Application::before_loop_tasks_(uint32_t loop_start_time) {
+#ifdef ESPHOME_MAX_UPDATES_PER_LOOP
+  PollingComponent::reset_updates_per_loop();
+#endif
   // Process scheduled tasks
   this->scheduler.call(loop_start_time);
 
@@ -428,9 +645,63 @@ void Application::before_loop_tasks_(uint32_t loop_start_time) {
 void Application::after_loop_tasks_() {
   // Clear the in_loop_ flag to indicate we're done processing components
   this->in_loop_ = false;
+  // Everything formatted into the loop arena during this iteration is released at once
+  global_loop_arena.reset();
 }
 
-#ifdef USE_SOCKET_SELECT_SUPPORT
+#ifdef USE_SOCKET_EPOLL
+bool Application::register_socket_fd(int fd) {
+  // WARNING: This function is NOT thread-safe and must only be called from the main loop
+  if (fd < 0)
+    return false;
+
+  if (this->epoll_fd_ < 0) {
+    this->epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (this->epoll_fd_ < 0) {
+      ESP_LOGE(TAG, "epoll_create1() failed with errno %d", errno);
+      return false;
+    }
+  }
+
+  struct epoll_event event {};
+  event.events = EPOLLIN;
+  event.data.fd = fd;
+  if (epoll_ctl(this->epoll_fd_, EPOLL_CTL_ADD, fd, &event) != 0) {
+    ESP_LOGE(TAG, "Cannot monitor socket fd %d: epoll_ctl() failed with errno %d", fd, errno);
+    return false;
+  }
+
+  this->socket_fds_.push_back(fd);
+  if (this->epoll_events_.size() < this->socket_fds_.size())
+    this->epoll_events_.resize(this->socket_fds_.size());
+  if (static_cast<size_t>(fd) >= this->ready_fds_.size())
+    this->ready_fds_.resize(fd + 1);
+  return true;
+}
+
+void Application::unregister_socket_fd(int fd) {
+  // WARNING: This function is NOT thread-safe and must only be called from the main loop
+  if (fd < 0)
+    return;
+
+  auto it = std::find(this->socket_fds_.begin(), this->socket_fds_.end(), fd);
+  if (it == this->socket_fds_.end())
+    return;
+  std::swap(*it, this->socket_fds_.back());
+  this->socket_fds_.pop_back();
+  // The fd is still open here, sockets unregister before they close
+  epoll_ctl(this->epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+  // epoll_events_ isn't shrunk, a stale event of the last wait only clears the flag of its fd once more
+  this->ready_fds_[fd] = 0;
+}
+
+bool Application::is_socket_ready(int fd) const {
+  // Only meaningful after epoll_wait() ran in the main loop
+  if (fd < 0 || static_cast<size_t>(fd) >= this->ready_fds_.size())
+    return false;
+  return this->ready_fds_[fd] != 0;
+}
+#elif defined(USE_SOCKET_SELECT_SUPPORT)
 bool Application::register_socket_fd(int fd) {
   // WARNING: This function is NOT thread-safe and must only be called from the main loop
   // It modifies socket_fds_ and related variables without locking
@@ -494,7 +765,33 @@ bool Application::is_socket_ready(int fd) const {
 void Application::yield_with_select_(uint32_t delay_ms) {
   // Delay while monitoring sockets. When delay_ms is 0, always yield() to ensure other tasks run
   // since select() with 0 timeout only polls without yielding.
-#ifdef USE_SOCKET_SELECT_SUPPORT
+#ifdef USE_SOCKET_EPOLL
+  if (!this->socket_fds_.empty()) {
+    // Only the fds reported by the previous wait are marked, so clearing costs O(ready)
+    for (int i = 0; i < this->epoll_ready_count_; i++)
+      this->ready_fds_[this->epoll_events_[i].data.fd] = 0;
+
+    int ret = epoll_wait(this->epoll_fd_, this->epoll_events_.data(), static_cast<int>(this->epoll_events_.size()),
+                         static_cast<int>(delay_ms));
+    if (ret < 0) {
+      if (errno != EINTR) {
+        ESP_LOGW(TAG, "epoll_wait() failed with errno %d", errno);
+        delay(delay_ms);
+      }
+      ret = 0;
+    }
+    this->epoll_ready_count_ = ret;
+    for (int i = 0; i < ret; i++)
+      this->ready_fds_[this->epoll_events_[i].data.fd] = 1;
+
+    // When delay_ms is 0, we need to yield since epoll_wait(0) doesn't yield
+    if (delay_ms == 0) {
+      yield();
+    }
+  } else {
+    delay(delay_ms);
+  }
+#elif defined(USE_SOCKET_SELECT_SUPPORT)
   if (!this->socket_fds_.empty()) {
     // Update fd_set if socket list has changed
     if (this->socket_fds_changed_) {
@@ -536,8 +833,23 @@ void Application::yield_with_select_(uint32_t delay_ms) {
       yield();
     }
   } else {
+#if defined(USE_EVENT_DRIVEN_LOOP) && (defined(USE_ESP32) || defined(USE_LIBRETINY))
+    // No sockets registered, wait for a task notification so wake_loop_*() can end the delay early
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(delay_ms));
+#else
     // No sockets registered, use regular delay
     delay(delay_ms);
+#endif
+  }
+#elif defined(USE_EVENT_DRIVEN_LOOP) && (defined(USE_ESP32) || defined(USE_LIBRETINY))
+  // No select support, wait for a task notification so wake_loop_*() can end the delay early
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(delay_ms));
+#elif defined(USE_EVENT_DRIVEN_LOOP) && defined(USE_ZEPHYR)
+  // Wait on the wake semaphore so wake_loop_*() can end the delay early
+  if (delay_ms == 0) {
+    yield();
+  } else {
+    k_sem_take(&wake_loop_sem, K_MSEC(delay_ms));
   }
 #else
   // No select support, use regular delay
@@ -545,6 +857,91 @@ void Application::yield_with_select_(uint32_t delay_ms) {
 #endif
 }
 
+#ifdef USE_EVENT_DRIVEN_LOOP
+#if defined(USE_SOCKET_IMPL_LWIP_SOCKETS) || (defined(USE_ESP32) && defined(USE_SOCKET_IMPL_BSD_SOCKETS))
+#define ESPHOME_WAKE_SOCKET_CALL(func) lwip_##func
+#else
+#define ESPHOME_WAKE_SOCKET_CALL(func) ::func
+#endif
+
+void Application::setup_wake_loop_() {
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+  this->main_task_ = xTaskGetCurrentTaskHandle();
+#endif
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  // A UDP socket connected to itself: sending a byte makes it readable, which ends a pending select()
+  int fd = ESPHOME_WAKE_SOCKET_CALL(socket)(AF_INET, SOCK_DGRAM, 0);
+  if (fd < 0) {
+    ESP_LOGW(TAG, "Could not create wake socket, errno %d", errno);
+    return;
+  }
+  struct sockaddr_in addr {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = 0;
+  socklen_t addr_len = sizeof(addr);
+  if (ESPHOME_WAKE_SOCKET_CALL(bind)(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0 ||
+      ESPHOME_WAKE_SOCKET_CALL(getsockname)(fd, reinterpret_cast<struct sockaddr *>(&addr), &addr_len) != 0 ||
+      ESPHOME_WAKE_SOCKET_CALL(connect)(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0 ||
+      ESPHOME_WAKE_SOCKET_CALL(fcntl)(fd, F_SETFL, O_NONBLOCK) != 0 || !this->register_socket_fd(fd)) {
+    ESP_LOGW(TAG, "Could not set up wake socket, errno %d", errno);
+    ESPHOME_WAKE_SOCKET_CALL(close)(fd);
+    return;
+  }
+  this->wake_socket_fd_ = fd;
+#endif
+}
+
+void Application::consume_wake_loop_() {
+  this->wake_requested_ = false;
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  if (this->wake_socket_fd_ >= 0 && this->is_socket_ready(this->wake_socket_fd_)) {
+    uint8_t buf[16];
+    while (ESPHOME_WAKE_SOCKET_CALL(recv)(this->wake_socket_fd_, buf, sizeof(buf), 0) > 0) {
+    }
+  }
+#endif
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+  // Clear notifications that arrived while the loop was busy
+  ulTaskNotifyTake(pdTRUE, 0);
+#elif defined(USE_ZEPHYR)
+  k_sem_reset(&wake_loop_sem);
+#endif
+}
+
+void Application::wake_loop_threadsafe() {
+  this->wake_requested_ = true;
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  if (this->wake_socket_fd_ >= 0) {
+    const uint8_t byte = 0;
+    ESPHOME_WAKE_SOCKET_CALL(send)(this->wake_socket_fd_, &byte, 1, 0);
+  }
+#endif
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+  if (this->main_task_ != nullptr)
+    xTaskNotifyGive(this->main_task_);
+#elif defined(USE_ZEPHYR)
+  k_sem_give(&wake_loop_sem);
+#endif
+}
+
+void IRAM_ATTR Application::wake_loop_isr() {
+  this->wake_requested_ = true;
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+  if (this->main_task_ != nullptr) {
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(this->main_task_, &higher_priority_task_woken);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+  }
+#elif defined(USE_ZEPHYR)
+  // Safe from an ISR, the kernel reschedules when the interrupt returns
+  k_sem_give(&wake_loop_sem);
+#endif
+}
+
+#undef ESPHOME_WAKE_SOCKET_CALL
+#endif /* USE_EVENT_DRIVEN_LOOP */
+
 Application App;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 }  // namespace esphome
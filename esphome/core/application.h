@@ -19,8 +19,27 @@
 #endif
 
 #ifdef USE_SOCKET_SELECT_SUPPORT
+#if defined(USE_HOST) && defined(__linux__)
+// epoll waits in O(ready) and has no FD_SETSIZE limit, which matters for host devices with many clients
+#define USE_SOCKET_EPOLL
+#include <sys/epoll.h>
+#else
 #include <sys/select.h>
 #endif
+#endif
+
+#ifdef USE_EVENT_DRIVEN_LOOP
+#if defined(USE_ESP32)
+#include <freertos/task.h>
+#elif defined(USE_LIBRETINY)
+#include <task.h>
+#endif
+#endif
+
+#ifdef USE_WORKER_TASK
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
 
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
@@ -88,12 +107,91 @@
 
 namespace esphome {
 
+#ifdef USE_EVENT_DRIVEN_LOOP
+/// Longest time the event-driven main loop sleeps while no component has loop() enabled.
+static constexpr uint32_t EVENT_DRIVEN_LOOP_MAX_SLEEP_MS = 1000;
+#endif
+
 // Teardown timeout constant (in milliseconds)
 // For reboots, it's more important to shut down quickly than disconnect cleanly
 // since we're not entering deep sleep. The only consequence of not shutting down
 // cleanly is a warning in the log.
 static const uint32_t TEARDOWN_TIMEOUT_REBOOT_MS = 1000;  // 1 second for quick reboot
 
+/** Container holding the registered entities of one type.
+ *
+ * Codegen knows how many entities of each type it registers and defines ESPHOME_ENTITY_<TYPE>_COUNT, which turns
+ * the registry into a fixed size StaticVector that needs no heap. Without a count (-1) it is a std::vector, so
+ * entities can still be registered at runtime.
+ */
+template<typename T, int COUNT>
+using EntityRegistry =
+    typename std::conditional<(COUNT < 0), std::vector<T *>, StaticVector<T *, (COUNT < 0 ? 0 : COUNT)>>::type;
+
+#ifndef ESPHOME_ENTITY_BINARY_SENSOR_COUNT
+#define ESPHOME_ENTITY_BINARY_SENSOR_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_SWITCH_COUNT
+#define ESPHOME_ENTITY_SWITCH_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_BUTTON_COUNT
+#define ESPHOME_ENTITY_BUTTON_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_EVENT_COUNT
+#define ESPHOME_ENTITY_EVENT_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_SENSOR_COUNT
+#define ESPHOME_ENTITY_SENSOR_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_TEXT_SENSOR_COUNT
+#define ESPHOME_ENTITY_TEXT_SENSOR_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_FAN_COUNT
+#define ESPHOME_ENTITY_FAN_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_COVER_COUNT
+#define ESPHOME_ENTITY_COVER_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_CLIMATE_COUNT
+#define ESPHOME_ENTITY_CLIMATE_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_LIGHT_COUNT
+#define ESPHOME_ENTITY_LIGHT_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_NUMBER_COUNT
+#define ESPHOME_ENTITY_NUMBER_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_DATE_COUNT
+#define ESPHOME_ENTITY_DATE_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_TIME_COUNT
+#define ESPHOME_ENTITY_TIME_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_DATETIME_COUNT
+#define ESPHOME_ENTITY_DATETIME_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_SELECT_COUNT
+#define ESPHOME_ENTITY_SELECT_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_TEXT_COUNT
+#define ESPHOME_ENTITY_TEXT_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_LOCK_COUNT
+#define ESPHOME_ENTITY_LOCK_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_VALVE_COUNT
+#define ESPHOME_ENTITY_VALVE_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_MEDIA_PLAYER_COUNT
+#define ESPHOME_ENTITY_MEDIA_PLAYER_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_ALARM_CONTROL_PANEL_COUNT
+#define ESPHOME_ENTITY_ALARM_CONTROL_PANEL_COUNT -1
+#endif
+#ifndef ESPHOME_ENTITY_UPDATE_COUNT
+#define ESPHOME_ENTITY_UPDATE_COUNT -1
+#endif
+
 class Application {
  public:
   void pre_setup(const std::string &name, const std::string &friendly_name, const char *comment,
@@ -127,94 +225,97 @@ class Application {
 
 #ifdef USE_BINARY_SENSOR
   void register_binary_sensor(binary_sensor::BinarySensor *binary_sensor) {
-    this->binary_sensors_.push_back(binary_sensor);
+    register_entity_(this->binary_sensors_, binary_sensor);
   }
 #endif
 
 #ifdef USE_SENSOR
-  void register_sensor(sensor::Sensor *sensor) { this->sensors_.push_back(sensor); }
+  void register_sensor(sensor::Sensor *sensor) { register_entity_(this->sensors_, sensor); }
 #endif
 
 #ifdef USE_SWITCH
-  void register_switch(switch_::Switch *a_switch) { this->switches_.push_back(a_switch); }
+  void register_switch(switch_::Switch *a_switch) { register_entity_(this->switches_, a_switch); }
 #endif
 
 #ifdef USE_BUTTON
-  void register_button(button::Button *button) { this->buttons_.push_back(button); }
+  void register_button(button::Button *button) { register_entity_(this->buttons_, button); }
 #endif
 
 #ifdef USE_TEXT_SENSOR
-  void register_text_sensor(text_sensor::TextSensor *sensor) { this->text_sensors_.push_back(sensor); }
+  void register_text_sensor(text_sensor::TextSensor *sensor) { register_entity_(this->text_sensors_, sensor); }
 #endif
 
 #ifdef USE_FAN
-  void register_fan(fan::Fan *state) { this->fans_.push_back(state); }
+  void register_fan(fan::Fan *state) { register_entity_(this->fans_, state); }
 #endif
 
 #ifdef USE_COVER
-  void register_cover(cover::Cover *cover) { this->covers_.push_back(cover); }
+  void register_cover(cover::Cover *cover) { register_entity_(this->covers_, cover); }
 #endif
 
 #ifdef USE_CLIMATE
-  void register_climate(climate::Climate *climate) { this->climates_.push_back(climate); }
+  void register_climate(climate::Climate *climate) { register_entity_(this->climates_, climate); }
 #endif
 
 #ifdef USE_LIGHT
-  void register_light(light::LightState *light) { this->lights_.push_back(light); }
+  void register_light(light::LightState *light) { register_entity_(this->lights_, light); }
 #endif
 
 #ifdef USE_NUMBER
-  void register_number(number::Number *number) { this->numbers_.push_back(number); }
+  void register_number(number::Number *number) { register_entity_(this->numbers_, number); }
 #endif
 
 #ifdef USE_DATETIME_DATE
-  void register_date(datetime::DateEntity *date) { this->dates_.push_back(date); }
+  void register_date(datetime::DateEntity *date) { register_entity_(this->dates_, date); }
 #endif
 
 #ifdef USE_DATETIME_TIME
-  void register_time(datetime::TimeEntity *time) { this->times_.push_back(time); }
+  void register_time(datetime::TimeEntity *time) { register_entity_(this->times_, time); }
 #endif
 
 #ifdef USE_DATETIME_DATETIME
-  void register_datetime(datetime::DateTimeEntity *datetime) { this->datetimes_.push_back(datetime); }
+  void register_datetime(datetime::DateTimeEntity *datetime) { register_entity_(this->datetimes_, datetime); }
 #endif
 
 #ifdef USE_TEXT
-  void register_text(text::Text *text) { this->texts_.push_back(text); }
+  void register_text(text::Text *text) { register_entity_(this->texts_, text); }
 #endif
 
 #ifdef USE_SELECT
-  void register_select(select::Select *select) { this->selects_.push_back(select); }
+  void register_select(select::Select *select) { register_entity_(this->selects_, select); }
 #endif
 
 #ifdef USE_LOCK
-  void register_lock(lock::Lock *a_lock) { this->locks_.push_back(a_lock); }
+  void register_lock(lock::Lock *a_lock) { register_entity_(this->locks_, a_lock); }
 #endif
 
 #ifdef USE_VALVE
-  void register_valve(valve::Valve *valve) { this->valves_.push_back(valve); }
+  void register_valve(valve::Valve *valve) { register_entity_(this->valves_, valve); }
 #endif
 
 #ifdef USE_MEDIA_PLAYER
-  void register_media_player(media_player::MediaPlayer *media_player) { this->media_players_.push_back(media_player); }
+  void register_media_player(media_player::MediaPlayer *media_player) {
+    register_entity_(this->media_players_, media_player);
+  }
 #endif
 
 #ifdef USE_ALARM_CONTROL_PANEL
   void register_alarm_control_panel(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel) {
-    this->alarm_control_panels_.push_back(a_alarm_control_panel);
+    register_entity_(this->alarm_control_panels_, a_alarm_control_panel);
   }
 #endif
 
 #ifdef USE_EVENT
-  void register_event(event::Event *event) { this->events_.push_back(event); }
+  void register_event(event::Event *event) { register_entity_(this->events_, event); }
 #endif
 
 #ifdef USE_UPDATE
-  void register_update(update::UpdateEntity *update) { this->updates_.push_back(update); }
+  void register_update(update::UpdateEntity *update) { register_entity_(this->updates_, update); }
 #endif
 
   /// Reserve space for components to avoid memory fragmentation
   void reserve_components(size_t count) { this->components_.reserve(count); }
+  size_t get_component_count() const { return this->components_.size(); }
 
 #ifdef USE_BINARY_SENSOR
   void reserve_binary_sensor(size_t count) { this->binary_sensors_.reserve(count); }
@@ -348,8 +449,37 @@ class Application {
 
   uint32_t get_loop_interval() const { return static_cast<uint32_t>(this->loop_interval_); }
 
+#ifdef USE_LOOP_TIERS
+  /** Set how long background tier components may run per loop iteration.
+   *
+   * Background components are called round-robin until the budget is used up, at least one of them runs
+   * in every iteration. Realtime and normal components are not limited.
+   *
+   * @param budget The budget in milliseconds. Defaults to 5 milliseconds.
+   */
+  void set_background_loop_budget(uint32_t budget) {
+    this->background_loop_budget_ = std::min(budget, static_cast<uint32_t>(std::numeric_limits<uint16_t>::max()));
+  }
+  uint32_t get_background_loop_budget() const { return this->background_loop_budget_; }
+#endif
+
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
+  /// Whether setup() of all components has finished and the main loop is running.
+  bool is_setup_complete() const { return this->setup_complete_; }
+
+  /** Permanently remove a component from the main loop so another task can drive its loop().
+   *
+   * After this, enable_loop()/disable_loop() only change the component's own state; the main
+   * loop never calls it again. Must be called from the main loop task.
+   */
+  void detach_component_loop(Component *component);
+
+#ifdef USE_WORKER_TASK
+  /// Whether the caller runs on the main loop task. Only the main loop may change which components loop.
+  bool in_loop_task() const { return this->loop_task_ == nullptr || xTaskGetCurrentTaskHandle() == this->loop_task_; }
+#endif
+
   void feed_wdt(uint32_t time = 0);
 
   void reboot();
@@ -358,6 +488,23 @@ class Application {
 
   void run_safe_shutdown_hooks();
 
+#ifdef USE_EVENT_DRIVEN_LOOP
+  /** Wake the main loop from another task so it does not wait for the next scheduler deadline.
+   *
+   * In event-driven mode the main loop sleeps until the next scheduled item is due or a registered
+   * socket becomes readable. Components that receive data from another task call this after queueing it.
+   */
+  void wake_loop_threadsafe();
+
+  /** Wake the main loop from an interrupt handler.
+   *
+   * Only effective while the loop waits without sockets (FreeRTOS task notification, Zephyr semaphore). With sockets
+   * registered, an ISR cannot interrupt select(); the request is served at the latest after
+   * EVENT_DRIVEN_LOOP_MAX_SLEEP_MS.
+   */
+  void wake_loop_isr();
+#endif
+
   void run_powerdown_hooks();
 
   /** Teardown all components with a timeout.
@@ -394,92 +541,101 @@ class Application {
   const std::vector<Area *> &get_areas() { return this->areas_; }
 #endif
 #ifdef USE_BINARY_SENSOR
-  const std::vector<binary_sensor::BinarySensor *> &get_binary_sensors() { return this->binary_sensors_; }
+  const EntityRegistry<binary_sensor::BinarySensor, ESPHOME_ENTITY_BINARY_SENSOR_COUNT> &get_binary_sensors() {
+    return this->binary_sensors_;
+  }
   GET_ENTITY_METHOD(binary_sensor::BinarySensor, binary_sensor, binary_sensors)
 #endif
 #ifdef USE_SWITCH
-  const std::vector<switch_::Switch *> &get_switches() { return this->switches_; }
+  const EntityRegistry<switch_::Switch, ESPHOME_ENTITY_SWITCH_COUNT> &get_switches() { return this->switches_; }
   GET_ENTITY_METHOD(switch_::Switch, switch, switches)
 #endif
 #ifdef USE_BUTTON
-  const std::vector<button::Button *> &get_buttons() { return this->buttons_; }
+  const EntityRegistry<button::Button, ESPHOME_ENTITY_BUTTON_COUNT> &get_buttons() { return this->buttons_; }
   GET_ENTITY_METHOD(button::Button, button, buttons)
 #endif
 #ifdef USE_SENSOR
-  const std::vector<sensor::Sensor *> &get_sensors() { return this->sensors_; }
+  const EntityRegistry<sensor::Sensor, ESPHOME_ENTITY_SENSOR_COUNT> &get_sensors() { return this->sensors_; }
   GET_ENTITY_METHOD(sensor::Sensor, sensor, sensors)
 #endif
 #ifdef USE_TEXT_SENSOR
-  const std::vector<text_sensor::TextSensor *> &get_text_sensors() { return this->text_sensors_; }
+  const EntityRegistry<text_sensor::TextSensor, ESPHOME_ENTITY_TEXT_SENSOR_COUNT> &get_text_sensors() {
+    return this->text_sensors_;
+  }
   GET_ENTITY_METHOD(text_sensor::TextSensor, text_sensor, text_sensors)
 #endif
 #ifdef USE_FAN
-  const std::vector<fan::Fan *> &get_fans() { return this->fans_; }
+  const EntityRegistry<fan::Fan, ESPHOME_ENTITY_FAN_COUNT> &get_fans() { return this->fans_; }
   GET_ENTITY_METHOD(fan::Fan, fan, fans)
 #endif
 #ifdef USE_COVER
-  const std::vector<cover::Cover *> &get_covers() { return this->covers_; }
+  const EntityRegistry<cover::Cover, ESPHOME_ENTITY_COVER_COUNT> &get_covers() { return this->covers_; }
   GET_ENTITY_METHOD(cover::Cover, cover, covers)
 #endif
 #ifdef USE_LIGHT
-  const std::vector<light::LightState *> &get_lights() { return this->lights_; }
+  const EntityRegistry<light::LightState, ESPHOME_ENTITY_LIGHT_COUNT> &get_lights() { return this->lights_; }
   GET_ENTITY_METHOD(light::LightState, light, lights)
 #endif
 #ifdef USE_CLIMATE
-  const std::vector<climate::Climate *> &get_climates() { return this->climates_; }
+  const EntityRegistry<climate::Climate, ESPHOME_ENTITY_CLIMATE_COUNT> &get_climates() { return this->climates_; }
   GET_ENTITY_METHOD(climate::Climate, climate, climates)
 #endif
 #ifdef USE_NUMBER
-  const std::vector<number::Number *> &get_numbers() { return this->numbers_; }
+  const EntityRegistry<number::Number, ESPHOME_ENTITY_NUMBER_COUNT> &get_numbers() { return this->numbers_; }
   GET_ENTITY_METHOD(number::Number, number, numbers)
 #endif
 #ifdef USE_DATETIME_DATE
-  const std::vector<datetime::DateEntity *> &get_dates() { return this->dates_; }
+  const EntityRegistry<datetime::DateEntity, ESPHOME_ENTITY_DATE_COUNT> &get_dates() { return this->dates_; }
   GET_ENTITY_METHOD(datetime::DateEntity, date, dates)
 #endif
 #ifdef USE_DATETIME_TIME
-  const std::vector<datetime::TimeEntity *> &get_times() { return this->times_; }
+  const EntityRegistry<datetime::TimeEntity, ESPHOME_ENTITY_TIME_COUNT> &get_times() { return this->times_; }
   GET_ENTITY_METHOD(datetime::TimeEntity, time, times)
 #endif
 #ifdef USE_DATETIME_DATETIME
-  const std::vector<datetime::DateTimeEntity *> &get_datetimes() { return this->datetimes_; }
+  const EntityRegistry<datetime::DateTimeEntity, ESPHOME_ENTITY_DATETIME_COUNT> &get_datetimes() {
+    return this->datetimes_;
+  }
   GET_ENTITY_METHOD(datetime::DateTimeEntity, datetime, datetimes)
 #endif
 #ifdef USE_TEXT
-  const std::vector<text::Text *> &get_texts() { return this->texts_; }
+  const EntityRegistry<text::Text, ESPHOME_ENTITY_TEXT_COUNT> &get_texts() { return this->texts_; }
   GET_ENTITY_METHOD(text::Text, text, texts)
 #endif
 #ifdef USE_SELECT
-  const std::vector<select::Select *> &get_selects() { return this->selects_; }
+  const EntityRegistry<select::Select, ESPHOME_ENTITY_SELECT_COUNT> &get_selects() { return this->selects_; }
   GET_ENTITY_METHOD(select::Select, select, selects)
 #endif
 #ifdef USE_LOCK
-  const std::vector<lock::Lock *> &get_locks() { return this->locks_; }
+  const EntityRegistry<lock::Lock, ESPHOME_ENTITY_LOCK_COUNT> &get_locks() { return this->locks_; }
   GET_ENTITY_METHOD(lock::Lock, lock, locks)
 #endif
 #ifdef USE_VALVE
-  const std::vector<valve::Valve *> &get_valves() { return this->valves_; }
+  const EntityRegistry<valve::Valve, ESPHOME_ENTITY_VALVE_COUNT> &get_valves() { return this->valves_; }
   GET_ENTITY_METHOD(valve::Valve, valve, valves)
 #endif
 #ifdef USE_MEDIA_PLAYER
-  const std::vector<media_player::MediaPlayer *> &get_media_players() { return this->media_players_; }
+  const EntityRegistry<media_player::MediaPlayer, ESPHOME_ENTITY_MEDIA_PLAYER_COUNT> &get_media_players() {
+    return this->media_players_;
+  }
   GET_ENTITY_METHOD(media_player::MediaPlayer, media_player, media_players)
 #endif
 
 #ifdef USE_ALARM_CONTROL_PANEL
-  const std::vector<alarm_control_panel::AlarmControlPanel *> &get_alarm_control_panels() {
+  const EntityRegistry<alarm_control_panel::AlarmControlPanel, ESPHOME_ENTITY_ALARM_CONTROL_PANEL_COUNT> &
+  get_alarm_control_panels() {
     return this->alarm_control_panels_;
   }
   GET_ENTITY_METHOD(alarm_control_panel::AlarmControlPanel, alarm_control_panel, alarm_control_panels)
 #endif
 
 #ifdef USE_EVENT
-  const std::vector<event::Event *> &get_events() { return this->events_; }
+  const EntityRegistry<event::Event, ESPHOME_ENTITY_EVENT_COUNT> &get_events() { return this->events_; }
   GET_ENTITY_METHOD(event::Event, event, events)
 #endif
 
 #ifdef USE_UPDATE
-  const std::vector<update::UpdateEntity *> &get_updates() { return this->updates_; }
+  const EntityRegistry<update::UpdateEntity, ESPHOME_ENTITY_UPDATE_COUNT> &get_updates() { return this->updates_; }
   GET_ENTITY_METHOD(update::UpdateEntity, update, updates)
 #endif
 
@@ -487,9 +643,9 @@ class Application {
 
   /// Register/unregister a socket file descriptor to be monitored for read events.
 #ifdef USE_SOCKET_SELECT_SUPPORT
-  /// These functions update the fd_set used by select() in the main loop.
+  /// These functions update the fd_set used by select() in the main loop, or the epoll set on Linux hosts.
   /// WARNING: These functions are NOT thread-safe. They must only be called from the main loop.
-  /// NOTE: File descriptors >= FD_SETSIZE (typically 10 on ESP) will be rejected with an error.
+  /// NOTE: With select(), file descriptors >= FD_SETSIZE (typically 10 on ESP) will be rejected with an error.
   /// @return true if registration was successful, false if fd exceeds limits
   bool register_socket_fd(int fd);
   void unregister_socket_fd(int fd);
@@ -503,6 +659,16 @@ class Application {
 
   void register_component_(Component *comp);
 
+  // Codegen sizes each fixed registry to the exact entity count, so a full registry means the counts are wrong
+  template<typename T, size_t N> static void register_entity_(StaticVector<T *, N> &registry, T *entity) {
+    if (!registry.push_back(entity))
+      entity_registry_full_(N);
+  }
+  template<typename T> static void register_entity_(std::vector<T *> &registry, T *entity) {
+    registry.push_back(entity);
+  }
+  static void entity_registry_full_(size_t capacity);
+
   void calculate_looping_components_();
 
   // These methods are called by Component::disable_loop() and Component::enable_loop()
@@ -514,12 +680,26 @@ class Application {
   void activate_looping_component_(uint16_t index);
   void before_loop_tasks_(uint32_t loop_start_time);
   void after_loop_tasks_();
+  // Run setup() of a single component, recording its timing for runtime_stats and boot_profiler
+  void setup_component_(Component *component);
+  inline void loop_component_(Component *component, uint32_t &last_op_end_time, uint8_t &new_app_state);
+#ifdef USE_LOOP_TIERS
+  // Run realtime and normal components, then background ones round-robin until background_loop_budget_ is used up
+  void loop_tiers_(uint32_t &last_op_end_time, uint8_t &new_app_state);
+#endif
 
   void feed_wdt_arch_();
 
   /// Perform a delay while also monitoring socket file descriptors for readiness
   void yield_with_select_(uint32_t delay_ms);
 
+#ifdef USE_EVENT_DRIVEN_LOOP
+  /// Create the loopback socket (or capture the task handle) used to wake the main loop early
+  void setup_wake_loop_();
+  /// Drain pending wakeups after the loop woke up
+  void consume_wake_loop_();
+#endif
+
   // === Member variables ordered by size to minimize padding ===
 
   // Pointer-sized members first
@@ -558,72 +738,78 @@ class Application {
   std::vector<Area *> areas_{};
 #endif
 #ifdef USE_BINARY_SENSOR
-  std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
+  EntityRegistry<binary_sensor::BinarySensor, ESPHOME_ENTITY_BINARY_SENSOR_COUNT> binary_sensors_{};
 #endif
 #ifdef USE_SWITCH
-  std::vector<switch_::Switch *> switches_{};
+  EntityRegistry<switch_::Switch, ESPHOME_ENTITY_SWITCH_COUNT> switches_{};
 #endif
 #ifdef USE_BUTTON
-  std::vector<button::Button *> buttons_{};
+  EntityRegistry<button::Button, ESPHOME_ENTITY_BUTTON_COUNT> buttons_{};
 #endif
 #ifdef USE_EVENT
-  std::vector<event::Event *> events_{};
+  EntityRegistry<event::Event, ESPHOME_ENTITY_EVENT_COUNT> events_{};
 #endif
 #ifdef USE_SENSOR
-  std::vector<sensor::Sensor *> sensors_{};
+  EntityRegistry<sensor::Sensor, ESPHOME_ENTITY_SENSOR_COUNT> sensors_{};
 #endif
 #ifdef USE_TEXT_SENSOR
-  std::vector<text_sensor::TextSensor *> text_sensors_{};
+  EntityRegistry<text_sensor::TextSensor, ESPHOME_ENTITY_TEXT_SENSOR_COUNT> text_sensors_{};
 #endif
 #ifdef USE_FAN
-  std::vector<fan::Fan *> fans_{};
+  EntityRegistry<fan::Fan, ESPHOME_ENTITY_FAN_COUNT> fans_{};
 #endif
 #ifdef USE_COVER
-  std::vector<cover::Cover *> covers_{};
+  EntityRegistry<cover::Cover, ESPHOME_ENTITY_COVER_COUNT> covers_{};
 #endif
 #ifdef USE_CLIMATE
-  std::vector<climate::Climate *> climates_{};
+  EntityRegistry<climate::Climate, ESPHOME_ENTITY_CLIMATE_COUNT> climates_{};
 #endif
 #ifdef USE_LIGHT
-  std::vector<light::LightState *> lights_{};
+  EntityRegistry<light::LightState, ESPHOME_ENTITY_LIGHT_COUNT> lights_{};
 #endif
 #ifdef USE_NUMBER
-  std::vector<number::Number *> numbers_{};
+  EntityRegistry<number::Number, ESPHOME_ENTITY_NUMBER_COUNT> numbers_{};
 #endif
 #ifdef USE_DATETIME_DATE
-  std::vector<datetime::DateEntity *> dates_{};
+  EntityRegistry<datetime::DateEntity, ESPHOME_ENTITY_DATE_COUNT> dates_{};
 #endif
 #ifdef USE_DATETIME_TIME
-  std::vector<datetime::TimeEntity *> times_{};
+  EntityRegistry<datetime::TimeEntity, ESPHOME_ENTITY_TIME_COUNT> times_{};
 #endif
 #ifdef USE_DATETIME_DATETIME
-  std::vector<datetime::DateTimeEntity *> datetimes_{};
+  EntityRegistry<datetime::DateTimeEntity, ESPHOME_ENTITY_DATETIME_COUNT> datetimes_{};
 #endif
 #ifdef USE_SELECT
-  std::vector<select::Select *> selects_{};
+  EntityRegistry<select::Select, ESPHOME_ENTITY_SELECT_COUNT> selects_{};
 #endif
 #ifdef USE_TEXT
-  std::vector<text::Text *> texts_{};
+  EntityRegistry<text::Text, ESPHOME_ENTITY_TEXT_COUNT> texts_{};
 #endif
 #ifdef USE_LOCK
-  std::vector<lock::Lock *> locks_{};
+  EntityRegistry<lock::Lock, ESPHOME_ENTITY_LOCK_COUNT> locks_{};
 #endif
 #ifdef USE_VALVE
-  std::vector<valve::Valve *> valves_{};
+  EntityRegistry<valve::Valve, ESPHOME_ENTITY_VALVE_COUNT> valves_{};
 #endif
 #ifdef USE_MEDIA_PLAYER
-  std::vector<media_player::MediaPlayer *> media_players_{};
+  EntityRegistry<media_player::MediaPlayer, ESPHOME_ENTITY_MEDIA_PLAYER_COUNT> media_players_{};
 #endif
 #ifdef USE_ALARM_CONTROL_PANEL
-  std::vector<alarm_control_panel::AlarmControlPanel *> alarm_control_panels_{};
+  EntityRegistry<alarm_control_panel::AlarmControlPanel, ESPHOME_ENTITY_ALARM_CONTROL_PANEL_COUNT>
+      alarm_control_panels_{};
 #endif
 #ifdef USE_UPDATE
-  std::vector<update::UpdateEntity *> updates_{};
+  EntityRegistry<update::UpdateEntity, ESPHOME_ENTITY_UPDATE_COUNT> updates_{};
 #endif
 
 #ifdef USE_SOCKET_SELECT_SUPPORT
   std::vector<int> socket_fds_;  // Vector of all monitored socket file descriptors
 #endif
+#ifdef USE_SOCKET_EPOLL
+  std::vector<struct epoll_event> epoll_events_;  // Filled by epoll_wait(), one slot per monitored fd
+  std::vector<uint8_t> ready_fds_;                // Indexed by fd, set for the fds the last epoll_wait() reported
+  int epoll_ready_count_{0};                      // Entries of epoll_events_ from the last epoll_wait()
+#endif
 
   // String members
   std::string name_;
@@ -633,22 +819,44 @@ class Application {
   uint32_t last_loop_{0};
   uint32_t loop_component_start_time_{0};
 
-#ifdef USE_SOCKET_SELECT_SUPPORT
+#ifdef USE_SOCKET_EPOLL
+  int epoll_fd_{-1};  // Created with the first registered socket
+#elif defined(USE_SOCKET_SELECT_SUPPORT)
   int max_fd_{-1};  // Highest file descriptor number for select()
 #endif
 
+#ifdef USE_EVENT_DRIVEN_LOOP
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  int wake_socket_fd_{-1};  // Loopback UDP socket used to interrupt select()
+#endif
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+  TaskHandle_t main_task_{nullptr};  // Loop task, notified to end a socket-less wait early
+#endif
+#endif
+#ifdef USE_WORKER_TASK
+  TaskHandle_t loop_task_{nullptr};  // Task that runs Application::loop()
+#endif
+
   // 2-byte members (grouped together for alignment)
   uint16_t loop_interval_{16};  // Loop interval in ms (max 65535ms = 65.5 seconds)
   uint16_t looping_components_active_end_{0};
   uint16_t current_loop_index_{0};  // For safe reentrant modifications during iteration
+#ifdef USE_LOOP_TIERS
+  uint16_t background_loop_budget_{5};  // Background tier budget per loop iteration in ms
+  uint16_t background_loop_index_{0};   // Where the next background round-robin pass starts
+#endif
 
   // 1-byte members (grouped together to minimize padding)
   uint8_t app_state_{0};
   bool name_add_mac_suffix_;
   bool in_loop_{false};
+  bool setup_complete_{false};
   volatile bool has_pending_enable_loop_requests_{false};
+#ifdef USE_EVENT_DRIVEN_LOOP
+  volatile bool wake_requested_{false};
+#endif
 
-#ifdef USE_SOCKET_SELECT_SUPPORT
+#if defined(USE_SOCKET_SELECT_SUPPORT) && !defined(USE_SOCKET_EPOLL)
   bool socket_fds_changed_{false};  // Flag to rebuild base_read_fds_ when socket_fds_ changes
 
   // Variable-sized members at end
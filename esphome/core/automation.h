@@ -170,10 +170,34 @@ template<typename... Ts> class ActionList;
 
 template<typename... Ts> class Action {
  public:
+  /** Play this action and the ones following it.
+   *
+   * Most actions only implement play() and finish right away. For a chain of those this loops over the chain instead
+   * of recursing through play_next_() and a virtual play_complex() call per action. Actions that finish later (delay,
+   * wait_until, ...) override play_complex() and continue the chain with play_next_() once they are done.
+   *
+   * Overrides must not call this implementation, it marks the action as one that only implements play().
+   */
   virtual void play_complex(Ts... x) {
-    this->num_running_++;
-    this->play(x...);
-    this->play_next_(x...);
+    // Only reached for actions that don't override play_complex()
+    this->plain_ = true;
+    Action<Ts...> *action = this;
+    while (true) {
+      action->num_running_++;
+      action->play(x...);
+      // Stopped while playing, don't continue the chain
+      if (action->num_running_ == 0)
+        return;
+      action->num_running_--;
+      action = action->next_;
+      if (action == nullptr)
+        return;
+      if (!action->plain_) {
+        // Not known to be plain yet, or it finishes later and continues the chain itself
+        action->play_complex(x...);
+        return;
+      }
+    }
   }
   virtual void stop_complex() {
     if (num_running_) {
@@ -228,6 +252,9 @@ template<typename... Ts> class Action {
 
   Action<Ts...> *next_{nullptr};
 
+  /// Set once the default play_complex() ran for this action, so the chain can play it inline.
+  bool plain_{false};
+
   /// The number of instances of this sequence in the list of actions
   /// that is currently being executed.
   int num_running_{0};
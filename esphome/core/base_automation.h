@@ -156,9 +156,11 @@ template<typename... Ts> class DelayAction : public Action<Ts...>, public Compon
   TEMPLATABLE_VALUE(uint32_t, delay)
 
   void play_complex(Ts... x) override {
-    auto f = std::bind(&DelayAction<Ts...>::play_next_, this, x...);
     this->num_running_++;
-    this->set_timeout("delay", this->delay_.value(x...), f);
+    // The named timeout replaces a pending one, so one slot for the arguments is enough, and a callback that only
+    // captures this fits in std::function without a heap allocation
+    this->var_ = std::make_tuple(x...);
+    this->set_timeout("delay", this->delay_.value(x...), [this]() { this->play_next_tuple_(this->var_); });
   }
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
@@ -166,6 +168,9 @@ template<typename... Ts> class DelayAction : public Action<Ts...>, public Compon
   }
 
   void stop() override { this->cancel_timeout("delay"); }
+
+ protected:
+  std::tuple<Ts...> var_{};
 };
 
 template<typename... Ts> class LambdaAction : public Action<Ts...> {
@@ -325,22 +330,30 @@ template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Co
     this->var_ = std::make_tuple(x...);
 
     if (this->timeout_value_.has_value()) {
-      auto f = std::bind(&WaitUntilAction<Ts...>::play_next_, this, x...);
-      this->set_timeout("timeout", this->timeout_value_.value(x...), f);
+      this->set_timeout("timeout", this->timeout_value_.value(x...), [this]() {
+        this->disable_loop();
+        this->play_next_tuple_(this->var_);
+      });
     }
 
+    // Only poll the condition while waiting
+    this->enable_loop();
     this->loop();
   }
 
   void loop() override {
-    if (this->num_running_ == 0)
+    if (this->num_running_ == 0) {
+      // Nothing to wait for, play_complex() enables the loop again
+      this->disable_loop();
       return;
+    }
 
     if (!this->condition_->check_tuple(this->var_)) {
       return;
     }
 
     this->cancel_timeout("timeout");
+    this->disable_loop();
 
     this->play_next_tuple_(this->var_);
   }
@@ -350,7 +363,10 @@ template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Co
   void play(Ts... x) override { /* ignore - see play_complex */
   }
 
-  void stop() override { this->cancel_timeout("timeout"); }
+  void stop() override {
+    this->cancel_timeout("timeout");
+    this->disable_loop();
+  }
 
  protected:
   Condition<Ts...> *condition_;
@@ -12,6 +12,9 @@
 #ifdef USE_RUNTIME_STATS
 #include "esphome/components/runtime_stats/runtime_stats.h"
 #endif
+#ifdef USE_RUNTIME_STATS_TRACE
+#include "esphome/components/runtime_stats/trace_buffer.h"
+#endif
 
 namespace esphome {
 
@@ -39,6 +42,16 @@ std::unique_ptr<std::vector<std::pair<const Component *, const char *>>> compone
 // Setup priority overrides - freed after setup completes
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 std::unique_ptr<std::vector<std::pair<const Component *, float>>> setup_priority_overrides;
+// Polling group of the polling components that have one, like the bus of a sensor
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::unique_ptr<std::vector<std::pair<const Component *, const void *>>> polling_groups;
+// Number of pollers given a place in each polling group so far
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::unique_ptr<std::vector<std::pair<const void *, uint16_t>>> polling_group_sizes;
+#ifdef ESPHOME_MAX_UPDATES_PER_LOOP
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+uint8_t updates_this_loop = 0;
+#endif
 }  // namespace
 
 namespace setup_priority {
@@ -71,6 +84,15 @@ const uint8_t STATUS_LED_MASK = 0x18;
 const uint8_t STATUS_LED_OK = 0x00;
 const uint8_t STATUS_LED_WARNING = 0x08;  // Bit 3
 const uint8_t STATUS_LED_ERROR = 0x10;    // Bit 4
+#ifdef USE_LOOP_TIERS
+// Loop tier override uses bits 5-6, stored as tier + 1 so that 0 means no override
+static const uint8_t COMPONENT_LOOP_TIER_MASK = 0x60;
+static const uint8_t COMPONENT_LOOP_TIER_SHIFT = 5;
+#endif
+#ifdef USE_SETUP_ASYNC
+// Setup async flag uses bit 7
+static const uint8_t COMPONENT_SETUP_ASYNC = 0x80;
+#endif
 
 const uint16_t WARN_IF_BLOCKING_OVER_MS = 50U;       ///< Initial blocking time allowed without warning
 const uint16_t WARN_IF_BLOCKING_INCREMENT_MS = 10U;  ///< How long the blocking time must be larger to warn again
@@ -79,6 +101,31 @@ uint32_t global_state = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-v
 
 float Component::get_loop_priority() const { return 0.0f; }
 
+#ifdef USE_LOOP_TIERS
+LoopTier Component::get_loop_tier() const { return LoopTier::NORMAL; }
+LoopTier Component::get_actual_loop_tier() const {
+  uint8_t tier = (this->component_state_ & COMPONENT_LOOP_TIER_MASK) >> COMPONENT_LOOP_TIER_SHIFT;
+  if (tier == 0)
+    return this->get_loop_tier();
+  return static_cast<LoopTier>(tier - 1);
+}
+void Component::set_loop_tier(LoopTier tier) {
+  this->component_state_ &= ~COMPONENT_LOOP_TIER_MASK;
+  this->component_state_ |= (static_cast<uint8_t>(tier) + 1) << COMPONENT_LOOP_TIER_SHIFT;
+}
+#endif
+
+#ifdef USE_SETUP_ASYNC
+bool Component::is_setup_async() const { return this->component_state_ & COMPONENT_SETUP_ASYNC; }
+void Component::set_setup_async(bool setup_async) {
+  if (setup_async) {
+    this->component_state_ |= COMPONENT_SETUP_ASYNC;
+  } else {
+    this->component_state_ &= ~COMPONENT_SETUP_ASYNC;
+  }
+}
+#endif
+
 float Component::get_setup_priority() const { return setup_priority::DATA; }
 
 void Component::setup() {}
@@ -145,7 +192,14 @@ void Component::call_dump_config() {
   }
 }
 
-uint8_t Component::get_component_state() const { return this->component_state_; }
+uint8_t Component::get_component_state() const {
+#ifdef USE_LOOP_TIERS
+  // The cached loop tier is internal, callers compare the state and status bits only
+  return this->component_state_ & ~COMPONENT_LOOP_TIER_MASK;
+#else
+  return this->component_state_;
+#endif
+}
 void Component::call() {
   uint8_t state = this->component_state_ & COMPONENT_STATE_MASK;
   switch (state) {
@@ -199,17 +253,39 @@ void Component::mark_failed() {
   this->component_state_ |= COMPONENT_STATE_FAILED;
   this->status_set_error();
   // Also remove from loop since failed components shouldn't loop
-  App.disable_component_loop_(this);
+  this->remove_from_loop_();
 }
 void Component::disable_loop() {
   if ((this->component_state_ & COMPONENT_STATE_MASK) != COMPONENT_STATE_LOOP_DONE) {
     ESP_LOGVV(TAG, "%s loop disabled", this->get_component_source());
     this->component_state_ &= ~COMPONENT_STATE_MASK;
     this->component_state_ |= COMPONENT_STATE_LOOP_DONE;
-    App.disable_component_loop_(this);
+    this->remove_from_loop_();
   }
 }
+void Component::remove_from_loop_() {
+#ifdef USE_WORKER_TASK
+  if (!App.in_loop_task()) {
+    // The new state already stops loop(), the main loop removes the component from its list. Not deferred through
+    // the component itself: the scheduler skips callbacks of failed components.
+    App.scheduler.set_timeout(nullptr, static_cast<const char *>(nullptr), 0, [this]() {
+      uint8_t state = this->component_state_ & COMPONENT_STATE_MASK;
+      if (state == COMPONENT_STATE_LOOP_DONE || state == COMPONENT_STATE_FAILED)
+        App.disable_component_loop_(this);
+    });
+    return;
+  }
+#endif
+  App.disable_component_loop_(this);
+}
 void Component::enable_loop() {
+#ifdef USE_WORKER_TASK
+  if (!App.in_loop_task()) {
+    // Picked up by the main loop, or by the worker task for the components it drives
+    this->enable_loop_soon_any_context();
+    return;
+  }
+#endif
   if ((this->component_state_ & COMPONENT_STATE_MASK) == COMPONENT_STATE_LOOP_DONE) {
     ESP_LOGVV(TAG, "%s loop enabled", this->get_component_source());
     this->component_state_ &= ~COMPONENT_STATE_MASK;
@@ -217,6 +293,21 @@ void Component::enable_loop() {
     App.enable_component_loop_(this);
   }
 }
+#ifdef USE_WORKER_TASK
+void Component::apply_pending_enable_loop() {
+  if (!this->pending_enable_loop_)
+    return;
+  uint8_t state = this->component_state_ & COMPONENT_STATE_MASK;
+  if (state == COMPONENT_STATE_LOOP_DONE) {
+    this->component_state_ &= ~COMPONENT_STATE_MASK;
+    this->component_state_ |= COMPONENT_STATE_LOOP;
+  } else if (state != COMPONENT_STATE_LOOP) {
+    // Not set up yet, try again next time
+    return;
+  }
+  this->pending_enable_loop_ = false;
+}
+#endif
 void IRAM_ATTR HOT Component::enable_loop_soon_any_context() {
   // This method is thread and ISR-safe because:
   // 1. Only performs simple assignments to volatile variables (atomic on all platforms)
@@ -229,6 +320,20 @@ void IRAM_ATTR HOT Component::enable_loop_soon_any_context() {
   // 8. Race condition with main loop is handled by clearing flag before processing
   this->pending_enable_loop_ = true;
   App.has_pending_enable_loop_requests_ = true;
+#ifdef USE_EVENT_DRIVEN_LOOP
+  // The event-driven loop may be asleep until the next deadline, wake it so the enable is processed now
+#if defined(USE_ESP32)
+  if (xPortInIsrContext()) {
+    App.wake_loop_isr();
+  } else {
+    App.wake_loop_threadsafe();
+  }
+#elif defined(USE_HOST)
+  App.wake_loop_threadsafe();
+#else
+  App.wake_loop_isr();
+#endif
+#endif
 }
 void Component::reset_to_construction_state() {
   if ((this->component_state_ & COMPONENT_STATE_MASK) == COMPONENT_STATE_FAILED) {
@@ -382,28 +487,122 @@ void PollingComponent::call_setup() {
 
 void PollingComponent::start_poller() {
   // Register interval.
-  this->set_interval("update", this->get_update_interval(), [this]() { this->update(); });
+  const uint32_t interval = this->get_update_interval();
+  if (interval == 0 || interval == SCHEDULER_DONT_RUN) {
+    this->set_interval("update", interval, [this]() { this->run_update_(); });
+    return;
+  }
+  App.scheduler.set_interval(this, "update", interval, this->first_update_delay_(interval),
+                             [this]() { this->run_update_(); });
 }
 
 void PollingComponent::stop_poller() {
   // Clear the interval to suspend component
   this->cancel_interval("update");
+#ifdef ESPHOME_MAX_UPDATES_PER_LOOP
+  this->cancel_timeout("update");
+#endif
+}
+
+void PollingComponent::set_polling_group(const void *group) {
+  if (!polling_groups) {
+    polling_groups = std::make_unique<std::vector<std::pair<const Component *, const void *>>>();
+  }
+  polling_groups->emplace_back(this, group);
 }
 
+uint32_t PollingComponent::first_update_delay_(uint32_t interval) const {
+  const void *group = nullptr;
+  if (polling_groups) {
+    for (const auto &pair : *polling_groups) {
+      if (pair.first == this) {
+        group = pair.second;
+        break;
+      }
+    }
+  }
+  if (!polling_group_sizes) {
+    polling_group_sizes = std::make_unique<std::vector<std::pair<const void *, uint16_t>>>();
+  }
+  size_t index = 0;
+  while (index < polling_group_sizes->size() && (*polling_group_sizes)[index].first != group)
+    index++;
+  if (index == polling_group_sizes->size())
+    polling_group_sizes->emplace_back(group, 0);
+  const uint16_t position = (*polling_group_sizes)[index].second++;
+
+  // Steps of the golden ratio keep any number of places evenly spread without knowing how many there will be.
+  // Each group starts at a different point, so the updates of different buses interleave.
+  float place = position * 0.618034f + index * 0.414214f;
+  place -= floorf(place);
+  // Places count from millis() 0, so components that start polling later don't bunch up with the ones started now
+  const uint32_t target = static_cast<uint32_t>(place * interval) % interval;
+  const uint32_t now = millis() % interval;
+  return target >= now ? target - now : target + (interval - now);
+}
+
+void PollingComponent::run_update_() {
+#ifdef ESPHOME_MAX_UPDATES_PER_LOOP
+  if (updates_this_loop >= ESPHOME_MAX_UPDATES_PER_LOOP) {
+    // Deferred calls run first in the next loop iteration, before the updates that become due then
+    this->defer("update", [this]() { this->run_update_(); });
+    return;
+  }
+  updates_this_loop++;
+#endif
+  this->update();
+}
+
+#ifdef ESPHOME_MAX_UPDATES_PER_LOOP
+void PollingComponent::reset_updates_per_loop() { updates_this_loop = 0; }
+#endif
+
 uint32_t PollingComponent::get_update_interval() const { return this->update_interval_; }
 void PollingComponent::set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
 
-WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component, uint32_t start_time)
-    : started_(start_time), component_(component) {}
+#ifdef USE_RUNTIME_STATS
+WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component, uint32_t start_time,
+                                                           ComponentTimingSource source)
+    : started_(start_time), started_us_(micros()), component_(component), source_(source) {
+#ifdef USE_RUNTIME_STATS_TRACE
+  this->started_cycles_ = arch_get_cpu_cycle_count();
+#endif
+#ifdef USE_DEBUG_HEAP_TRACKING
+  this->heap_start_ = global_heap_tracker.begin();
+#endif
+}
+#else
+WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component, uint32_t start_time,
+                                                           ComponentTimingSource source)
+    : started_(start_time), component_(component) {
+#ifdef USE_DEBUG_HEAP_TRACKING
+  this->heap_start_ = global_heap_tracker.begin();
+#endif
+}
+#endif
 uint32_t WarnIfComponentBlockingGuard::finish() {
+#ifdef USE_DEBUG_HEAP_TRACKING
+  global_heap_tracker.record(this->component_, this->heap_start_);
+#endif
   uint32_t curr_time = millis();
 
   uint32_t blocking_time = curr_time - this->started_;
+#ifdef USE_DEBUG_LOOP_STATS
+  global_loop_stats.record_component(this->component_, blocking_time);
+#endif
 
 #ifdef USE_RUNTIME_STATS
   // Record component runtime stats
   if (global_runtime_stats != nullptr) {
-    global_runtime_stats->record_component_time(this->component_, blocking_time, curr_time);
+    global_runtime_stats->record_component_time(this->component_, this->source_, blocking_time,
+                                                micros() - this->started_us_, curr_time);
+  }
+#endif
+#ifdef USE_RUNTIME_STATS_TRACE
+  if (global_trace_buffer != nullptr && this->component_ != nullptr) {
+    auto category = this->source_ == ComponentTimingSource::SCHEDULER ? runtime_stats::TraceCategory::SCHEDULER
+                                                                      : runtime_stats::TraceCategory::LOOP;
+    global_trace_buffer->record(this->component_->get_component_source(), category, this->started_cycles_);
   }
 #endif
   bool should_warn;
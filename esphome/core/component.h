@@ -5,7 +5,14 @@
 #include <functional>
 #include <string>
 
+#include "esphome/core/defines.h"
 #include "esphome/core/optional.h"
+#ifdef USE_DEBUG_HEAP_TRACKING
+#include "esphome/components/debug/heap_tracker.h"
+#endif
+#ifdef USE_DEBUG_LOOP_STATS
+#include "esphome/components/debug/loop_stats.h"
+#endif
 
 namespace esphome {
 
@@ -66,6 +73,19 @@ extern const uint8_t STATUS_LED_ERROR;
 
 enum class RetryResult { DONE, RETRY };
 
+#ifdef USE_LOOP_TIERS
+/** Scheduling tiers for Component::loop(), see Application::loop().
+ *
+ * Realtime components run first in every loop iteration, followed by normal ones. Background components
+ * share a time budget per iteration and are served round-robin, so they can't delay the other tiers.
+ */
+enum class LoopTier : uint8_t {
+  REALTIME = 0,
+  NORMAL = 1,
+  BACKGROUND = 2,
+};
+#endif
+
 extern const uint16_t WARN_IF_BLOCKING_OVER_MS;
 
 class Component {
@@ -106,6 +126,31 @@ class Component {
    */
   virtual float get_loop_priority() const;
 
+#ifdef USE_LOOP_TIERS
+  /** Loop tier of this component.
+   *
+   * Defaults to LoopTier::NORMAL. Components that must be serviced with low latency return LoopTier::REALTIME.
+   *
+   * @return The loop tier of this component
+   */
+  virtual LoopTier get_loop_tier() const;
+
+  LoopTier get_actual_loop_tier() const;
+
+  void set_loop_tier(LoopTier tier);
+#endif
+
+#ifdef USE_SETUP_ASYNC
+  /** Whether this component may be set up out of priority order.
+   *
+   * Async components don't depend on the components set up after a blocking one (e.g. wifi), so
+   * Application::setup() sets them up and loops them while it waits for the blocking can_proceed().
+   */
+  bool is_setup_async() const;
+
+  void set_setup_async(bool setup_async);
+#endif
+
   void call();
 
   virtual void on_shutdown() {}
@@ -192,6 +237,12 @@ class Component {
    */
   void enable_loop_soon_any_context();
 
+#ifdef USE_WORKER_TASK
+  /// Applies a pending enable_loop_soon_any_context() request. For components detached from the main loop, whose
+  /// requests are served by the task that drives them.
+  void apply_pending_enable_loop();
+#endif
+
   bool is_failed() const;
 
   bool is_ready() const;
@@ -236,6 +287,9 @@ class Component {
   virtual void call_setup();
   virtual void call_dump_config();
 
+  /// Removes the component from the loop of the application once its state no longer loops.
+  void remove_from_loop_();
+
   /** Set an interval function with a unique name. Empty name means no cancelling possible.
    *
    * This will call f every interval ms. Can be cancelled via CancelInterval().
@@ -405,10 +459,11 @@ class Component {
   const char *component_source_{nullptr};
   uint16_t warn_if_blocking_over_{WARN_IF_BLOCKING_OVER_MS};  ///< Warn if blocked for this many ms (max 65.5s)
   /// State of this component - each bit has a purpose:
-  /// Bits 0-1: Component state (0x00=CONSTRUCTION, 0x01=SETUP, 0x02=LOOP, 0x03=FAILED)
-  /// Bit 2: STATUS_LED_WARNING
-  /// Bit 3: STATUS_LED_ERROR
-  /// Bits 4-7: Unused - reserved for future expansion (50% of the bits are free)
+  /// Bits 0-2: Component state (0x00=CONSTRUCTION, 0x01=SETUP, 0x02=LOOP, 0x03=FAILED, 0x04=LOOP_DONE)
+  /// Bit 3: STATUS_LED_WARNING
+  /// Bit 4: STATUS_LED_ERROR
+  /// Bits 5-6: Loop tier + 1, 0 if not set (only with USE_LOOP_TIERS)
+  /// Bit 7: Setup async flag (only with USE_SETUP_ASYNC)
   uint8_t component_state_{0x00};
   volatile bool pending_enable_loop_{false};  ///< ISR-safe flag for enable_loop_soon_any_context
 };
@@ -454,13 +509,40 @@ class PollingComponent : public Component {
   // Stop the poller, used for component.suspend
   void stop_poller();
 
+  /** Spread the updates of this component apart from the others in the same group.
+   *
+   * Updates of all polling components are spread over their update interval. Components sharing a group, like the
+   * devices on one I2C or SPI bus, are also spread among themselves, so they don't wait for the bus one after another.
+   *
+   * @param group Identifies the group, usually the bus.
+   */
+  void set_polling_group(const void *group);
+
+#ifdef ESPHOME_MAX_UPDATES_PER_LOOP
+  /// Called at the start of each loop iteration to allow ESPHOME_MAX_UPDATES_PER_LOOP more updates
+  static void reset_updates_per_loop();
+#endif
+
  protected:
+  /// Run update(), or in the next loop iteration if this one started the maximum number of updates already
+  void run_update_();
+  /// Delay until the first update, so the updates fall on this component's place in the interval
+  uint32_t first_update_delay_(uint32_t interval) const;
+
   uint32_t update_interval_;
 };
 
+/// What a WarnIfComponentBlockingGuard is timing, used to separate runtime statistics.
+enum class ComponentTimingSource : uint8_t {
+  LOOP,       ///< Component::loop() called from Application::loop()
+  SCHEDULER,  ///< Timeout/interval callback run by the Scheduler
+  SETUP,      ///< Component::setup() called from Application::setup()
+};
+
 class WarnIfComponentBlockingGuard {
  public:
-  WarnIfComponentBlockingGuard(Component *component, uint32_t start_time);
+  WarnIfComponentBlockingGuard(Component *component, uint32_t start_time,
+                               ComponentTimingSource source = ComponentTimingSource::LOOP);
 
   // Finish the timing operation and return the current time
   uint32_t finish();
@@ -469,7 +551,19 @@ class WarnIfComponentBlockingGuard {
 
  protected:
   uint32_t started_;
+#ifdef USE_RUNTIME_STATS
+  uint32_t started_us_;
+#endif
   Component *component_;
+#ifdef USE_RUNTIME_STATS
+  ComponentTimingSource source_;
+#endif
+#ifdef USE_RUNTIME_STATS_TRACE
+  uint32_t started_cycles_;
+#endif
+#ifdef USE_DEBUG_HEAP_TRACKING
+  debug::HeapTracker::Snapshot heap_start_;
+#endif
 };
 
 // Function to clear setup priority overrides after all components are set up
@@ -17,17 +17,21 @@ void ComponentIterator::begin(bool include_internal) {
   this->include_internal_ = include_internal;
 }
 
-template<typename PlatformItem>
-void ComponentIterator::process_platform_item_(const std::vector<PlatformItem *> &items,
+template<typename Container, typename PlatformItem>
+bool ComponentIterator::process_platform_item_(const Container &items,
                                                bool (ComponentIterator::*on_item)(PlatformItem *)) {
   if (this->at_ >= items.size()) {
     this->advance_platform_();
-  } else {
-    PlatformItem *item = items[this->at_];
-    if ((item->is_internal() && !this->include_internal_) || (this->*on_item)(item)) {
-      this->at_++;
-    }
+    return true;
+  }
+  PlatformItem *item = items[this->at_];
+  if (item->is_internal() && !this->include_internal_) {
+    this->at_++;
+    return true;
   }
+  if ((this->*on_item)(item))
+    this->at_++;
+  return false;
 }
 
 void ComponentIterator::advance_platform_() {
@@ -36,164 +40,151 @@ void ComponentIterator::advance_platform_() {
 }
 
 void ComponentIterator::advance() {
+  // Empty platforms and skipped internal entities don't use up a call, every call reaches an entity or the end
+  while (this->advance_step_()) {
+  }
+}
+
+bool ComponentIterator::advance_step_() {
   switch (this->state_) {
     case IteratorState::NONE:
       // not started
-      return;
+      return false;
     case IteratorState::BEGIN:
       if (this->on_begin()) {
         advance_platform_();
       }
-      break;
+      return false;
 
 #ifdef USE_BINARY_SENSOR
     case IteratorState::BINARY_SENSOR:
-      this->process_platform_item_(App.get_binary_sensors(), &ComponentIterator::on_binary_sensor);
-      break;
+      return this->process_platform_item_(App.get_binary_sensors(), &ComponentIterator::on_binary_sensor);
 #endif
 
 #ifdef USE_COVER
     case IteratorState::COVER:
-      this->process_platform_item_(App.get_covers(), &ComponentIterator::on_cover);
-      break;
+      return this->process_platform_item_(App.get_covers(), &ComponentIterator::on_cover);
 #endif
 
 #ifdef USE_FAN
     case IteratorState::FAN:
-      this->process_platform_item_(App.get_fans(), &ComponentIterator::on_fan);
-      break;
+      return this->process_platform_item_(App.get_fans(), &ComponentIterator::on_fan);
 #endif
 
 #ifdef USE_LIGHT
     case IteratorState::LIGHT:
-      this->process_platform_item_(App.get_lights(), &ComponentIterator::on_light);
-      break;
+      return this->process_platform_item_(App.get_lights(), &ComponentIterator::on_light);
 #endif
 
 #ifdef USE_SENSOR
     case IteratorState::SENSOR:
-      this->process_platform_item_(App.get_sensors(), &ComponentIterator::on_sensor);
-      break;
+      return this->process_platform_item_(App.get_sensors(), &ComponentIterator::on_sensor);
 #endif
 
 #ifdef USE_SWITCH
     case IteratorState::SWITCH:
-      this->process_platform_item_(App.get_switches(), &ComponentIterator::on_switch);
-      break;
+      return this->process_platform_item_(App.get_switches(), &ComponentIterator::on_switch);
 #endif
 
 #ifdef USE_BUTTON
     case IteratorState::BUTTON:
-      this->process_platform_item_(App.get_buttons(), &ComponentIterator::on_button);
-      break;
+      return this->process_platform_item_(App.get_buttons(), &ComponentIterator::on_button);
 #endif
 
 #ifdef USE_TEXT_SENSOR
     case IteratorState::TEXT_SENSOR:
-      this->process_platform_item_(App.get_text_sensors(), &ComponentIterator::on_text_sensor);
-      break;
+      return this->process_platform_item_(App.get_text_sensors(), &ComponentIterator::on_text_sensor);
 #endif
 
 #ifdef USE_API_SERVICES
     case IteratorState::SERVICE:
-      this->process_platform_item_(api::global_api_server->get_user_services(), &ComponentIterator::on_service);
-      break;
+      return this->process_platform_item_(api::global_api_server->get_user_services(), &ComponentIterator::on_service);
 #endif
 
 #ifdef USE_CAMERA
     case IteratorState::CAMERA: {
       camera::Camera *camera_instance = camera::Camera::instance();
+      advance_platform_();
       if (camera_instance != nullptr && (!camera_instance->is_internal() || this->include_internal_)) {
         this->on_camera(camera_instance);
+        return false;
       }
-      advance_platform_();
-    } break;
+      return true;
+    }
 #endif
 
 #ifdef USE_CLIMATE
     case IteratorState::CLIMATE:
-      this->process_platform_item_(App.get_climates(), &ComponentIterator::on_climate);
-      break;
+      return this->process_platform_item_(App.get_climates(), &ComponentIterator::on_climate);
 #endif
 
 #ifdef USE_NUMBER
     case IteratorState::NUMBER:
-      this->process_platform_item_(App.get_numbers(), &ComponentIterator::on_number);
-      break;
+      return this->process_platform_item_(App.get_numbers(), &ComponentIterator::on_number);
 #endif
 
 #ifdef USE_DATETIME_DATE
     case IteratorState::DATETIME_DATE:
-      this->process_platform_item_(App.get_dates(), &ComponentIterator::on_date);
-      break;
+      return this->process_platform_item_(App.get_dates(), &ComponentIterator::on_date);
 #endif
 
 #ifdef USE_DATETIME_TIME
     case IteratorState::DATETIME_TIME:
-      this->process_platform_item_(App.get_times(), &ComponentIterator::on_time);
-      break;
+      return this->process_platform_item_(App.get_times(), &ComponentIterator::on_time);
 #endif
 
 #ifdef USE_DATETIME_DATETIME
     case IteratorState::DATETIME_DATETIME:
-      this->process_platform_item_(App.get_datetimes(), &ComponentIterator::on_datetime);
-      break;
+      return this->process_platform_item_(App.get_datetimes(), &ComponentIterator::on_datetime);
 #endif
 
 #ifdef USE_TEXT
     case IteratorState::TEXT:
-      this->process_platform_item_(App.get_texts(), &ComponentIterator::on_text);
-      break;
+      return this->process_platform_item_(App.get_texts(), &ComponentIterator::on_text);
 #endif
 
 #ifdef USE_SELECT
     case IteratorState::SELECT:
-      this->process_platform_item_(App.get_selects(), &ComponentIterator::on_select);
-      break;
+      return this->process_platform_item_(App.get_selects(), &ComponentIterator::on_select);
 #endif
 
 #ifdef USE_LOCK
     case IteratorState::LOCK:
-      this->process_platform_item_(App.get_locks(), &ComponentIterator::on_lock);
-      break;
+      return this->process_platform_item_(App.get_locks(), &ComponentIterator::on_lock);
 #endif
 
 #ifdef USE_VALVE
     case IteratorState::VALVE:
-      this->process_platform_item_(App.get_valves(), &ComponentIterator::on_valve);
-      break;
+      return this->process_platform_item_(App.get_valves(), &ComponentIterator::on_valve);
 #endif
 
 #ifdef USE_MEDIA_PLAYER
     case IteratorState::MEDIA_PLAYER:
-      this->process_platform_item_(App.get_media_players(), &ComponentIterator::on_media_player);
-      break;
+      return this->process_platform_item_(App.get_media_players(), &ComponentIterator::on_media_player);
 #endif
 
 #ifdef USE_ALARM_CONTROL_PANEL
     case IteratorState::ALARM_CONTROL_PANEL:
-      this->process_platform_item_(App.get_alarm_control_panels(), &ComponentIterator::on_alarm_control_panel);
-      break;
+      return this->process_platform_item_(App.get_alarm_control_panels(), &ComponentIterator::on_alarm_control_panel);
 #endif
 
 #ifdef USE_EVENT
     case IteratorState::EVENT:
-      this->process_platform_item_(App.get_events(), &ComponentIterator::on_event);
-      break;
+      return this->process_platform_item_(App.get_events(), &ComponentIterator::on_event);
 #endif
 
 #ifdef USE_UPDATE
     case IteratorState::UPDATE:
-      this->process_platform_item_(App.get_updates(), &ComponentIterator::on_update);
-      break;
+      return this->process_platform_item_(App.get_updates(), &ComponentIterator::on_update);
 #endif
 
     case IteratorState::MAX:
       if (this->on_end()) {
         this->state_ = IteratorState::NONE;
       }
-      return;
+      return false;
   }
+  return false;
 }
 
 bool ComponentIterator::on_end() { return true; }
@@ -172,10 +172,12 @@ class ComponentIterator {
   uint16_t at_{0};  // Supports up to 65,535 entities per type
   bool include_internal_{false};
 
-  template<typename PlatformItem>
-  void process_platform_item_(const std::vector<PlatformItem *> &items,
-                              bool (ComponentIterator::*on_item)(PlatformItem *));
+  /// Returns true when nothing was sent, because the platform ended or the entity is internal
+  template<typename Container, typename PlatformItem>
+  bool process_platform_item_(const Container &items, bool (ComponentIterator::*on_item)(PlatformItem *));
   void advance_platform_();
+  /// Returns true when the step only skipped and advance() should take the next one
+  bool advance_step_();
 };
 
 }  // namespace esphome
@@ -12,16 +12,20 @@ from esphome.const import (
     CONF_AREA,
     CONF_AREA_ID,
     CONF_AREAS,
+    CONF_BACKGROUND_LOOP_BUDGET,
     CONF_BUILD_PATH,
     CONF_COMMENT,
     CONF_COMPILE_PROCESS_LIMIT,
     CONF_DEBUG_SCHEDULER,
     CONF_DEVICES,
     CONF_ESPHOME,
+    CONF_EVENT_DRIVEN_LOOP,
     CONF_FRIENDLY_NAME,
     CONF_ID,
     CONF_INCLUDES,
     CONF_LIBRARIES,
+    CONF_LOOP_ARENA_SIZE,
+    CONF_MAX_UPDATES_PER_LOOP,
     CONF_MIN_VERSION,
     CONF_NAME,
     CONF_NAME_ADD_MAC_SUFFIX,
@@ -33,6 +37,8 @@ from esphome.const import (
     CONF_PLATFORMIO_OPTIONS,
     CONF_PRIORITY,
     CONF_PROJECT,
+    CONF_SCHEDULER_DEFER_RING_SIZE,
+    CONF_SCHEDULER_POOL_SIZE,
     CONF_TRIGGER_ID,
     CONF_VERSION,
     KEY_CORE,
@@ -230,6 +236,17 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_LIBRARIES, default=[]): cv.ensure_list(cv.string_strict),
             cv.Optional(CONF_NAME_ADD_MAC_SUFFIX, default=False): cv.boolean,
             cv.Optional(CONF_DEBUG_SCHEDULER, default=False): cv.boolean,
+            cv.Optional(CONF_SCHEDULER_POOL_SIZE): cv.int_range(min=1, max=1024),
+            cv.Optional(CONF_SCHEDULER_DEFER_RING_SIZE): cv.one_of(
+                8, 16, 32, 64, 128, int=True
+            ),
+            cv.Optional(CONF_EVENT_DRIVEN_LOOP, default=False): cv.boolean,
+            cv.Optional(CONF_BACKGROUND_LOOP_BUDGET): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(max=cv.TimePeriod(milliseconds=65535)),
+            ),
+            cv.Optional(CONF_LOOP_ARENA_SIZE): cv.int_range(min=64, max=16384),
+            cv.Optional(CONF_MAX_UPDATES_PER_LOOP): cv.int_range(min=1, max=255),
             cv.Optional(CONF_PROJECT): cv.Schema(
                 {
                     cv.Required(CONF_NAME): cv.All(
@@ -423,6 +440,8 @@ async def _add_automations(config):
 async def _add_platform_reserves() -> None:
     for platform_name, count in sorted(CORE.platform_counts.items()):
         cg.add(cg.RawStatement(f"App.reserve_{platform_name}({count});"), prepend=True)
+        # Size the entity registry at compile time, see EntityRegistry
+        cg.add_define(f"ESPHOME_ENTITY_{platform_name.upper()}_COUNT", count)
 
 
 @coroutine_with_priority(100.0)
@@ -474,6 +493,19 @@ async def to_code(config: ConfigType) -> None:
     cg.add_build_flag("-Wno-sign-compare")
     if config[CONF_DEBUG_SCHEDULER]:
         cg.add_define("ESPHOME_DEBUG_SCHEDULER")
+    if (pool_size := config.get(CONF_SCHEDULER_POOL_SIZE)) is not None:
+        cg.add_define("ESPHOME_SCHEDULER_POOL_SIZE", pool_size)
+    if (ring_size := config.get(CONF_SCHEDULER_DEFER_RING_SIZE)) is not None:
+        cg.add_define("ESPHOME_SCHEDULER_DEFER_RING_SIZE", ring_size)
+    if config[CONF_EVENT_DRIVEN_LOOP]:
+        cg.add_define("USE_EVENT_DRIVEN_LOOP")
+    if (budget := config.get(CONF_BACKGROUND_LOOP_BUDGET)) is not None:
+        cg.add_define("USE_LOOP_TIERS")
+        cg.add(cg.App.set_background_loop_budget(budget))
+    if (arena_size := config.get(CONF_LOOP_ARENA_SIZE)) is not None:
+        cg.add_define("ESPHOME_LOOP_ARENA_SIZE", arena_size)
+    if (max_updates := config.get(CONF_MAX_UPDATES_PER_LOOP)) is not None:
+        cg.add_define("ESPHOME_MAX_UPDATES_PER_LOOP", max_updates)
 
     if CORE.using_arduino and not CORE.is_bk72xx:
         CORE.add_job(add_arduino_global_workaround)
@@ -14,6 +14,9 @@
 #define ESPHOME_PROJECT_VERSION_30 "v2"
 #define ESPHOME_VARIANT "ESP32"
 #define ESPHOME_DEBUG_SCHEDULER
+#define ESPHOME_MAX_UPDATES_PER_LOOP 4
+#define ESPHOME_SCHEDULER_POOL_SIZE 32
+#define ESPHOME_SCHEDULER_DEFER_RING_SIZE 16
 
 // Default threading model for static analysis (ESP32 is multi-core with atomics)
 #define ESPHOME_CORES_MULTI_ATOMICS
@@ -25,6 +28,7 @@
 #define USE_ALARM_CONTROL_PANEL
 #define USE_AREAS
 #define USE_BINARY_SENSOR
+#define USE_BOOT_PROFILER
 #define USE_BUTTON
 #define USE_CAMERA
 #define USE_CLIMATE
@@ -36,9 +40,12 @@
 #define USE_DEEP_SLEEP
 #define USE_DEVICES
 #define USE_DISPLAY
+#define USE_DISPLAY_STATS
 #define USE_ENTITY_ICON
+#define USE_ENTITY_STATS
 #define USE_ESP32_IMPROV_STATE_CALLBACK
 #define USE_EVENT
+#define USE_EVENT_DRIVEN_LOOP
 #define USE_FAN
 #define USE_GRAPH
 #define USE_GRAPHICAL_DISPLAY_MENU
@@ -48,6 +55,8 @@
 #define USE_LIGHT
 #define USE_LOCK
 #define USE_LOGGER
+#define USE_LOGGER_RAW_LOGS
+#define USE_LOOP_TIERS
 #define USE_LVGL
 #define USE_LVGL_ANIMIMG
 #define USE_LVGL_ARC
@@ -88,8 +97,12 @@
 #define USE_OUTPUT
 #define USE_POWER_SUPPLY
 #define USE_QR_CODE
+#define ESPHOME_RTC_HISTORY_SENSORS 2
+#define ESPHOME_RTC_HISTORY_SIZE 16
 #define USE_SELECT
 #define USE_SENSOR
+#define USE_SETUP_ASYNC
+#define ESPHOME_SENSOR_INLINE_CALLBACKS 2
 #define USE_STATUS_LED
 #define USE_STATUS_SENSOR
 #define USE_SWITCH
@@ -106,15 +119,20 @@
 #define USE_AUDIO_DAC
 #define USE_AUDIO_FLAC_SUPPORT
 #define USE_AUDIO_MP3_SUPPORT
+#define USE_AUDIO_STATS
 #define USE_API
+#define USE_API_ADAPTIVE_BATCH_DELAY
+#define USE_API_BINARY_LOGS
 #define USE_API_CLIENT_CONNECTED_TRIGGER
 #define USE_API_CLIENT_DISCONNECTED_TRIGGER
 #define USE_API_NOISE
 #define USE_API_PLAINTEXT
 #define USE_API_SERVICES
 #define USE_MD5
+#define USE_MODBUS_TCP
 #define USE_MQTT
 #define USE_NETWORK
+#define USE_NOISE_BENCHMARK
 #define USE_ONLINE_IMAGE_BMP_SUPPORT
 #define USE_ONLINE_IMAGE_PNG_SUPPORT
 #define USE_ONLINE_IMAGE_JPEG_SUPPORT
@@ -137,16 +155,22 @@
 
 // IDF-specific feature flags
 #ifdef USE_ESP_IDF
+#define USE_LOGGER_ASYNC_TX
+#define USE_ESP32_PREFERENCES_JOURNAL
 #define USE_MQTT_IDF_ENQUEUE
+#define USE_WEBSERVER_IDF_WORKER_TASKS 2  // NOLINT
 #endif
 
 // ESP32-specific feature flags
 #ifdef USE_ESP32
 #define USE_ESPHOME_TASK_LOG_BUFFER
+#define USE_LOGGER_PERSISTENT_LOG
+#define ESPHOME_LOGGER_PERSISTENT_LOG_SIZE 2048  // NOLINT
 
 #define USE_BLUETOOTH_PROXY
 #define USE_CAPTIVE_PORTAL
 #define USE_ESP32_BLE
+#define USE_ESP32_BLE_ADAPTIVE_SCAN
 #define USE_ESP32_BLE_CLIENT
 #define USE_ESP32_BLE_DEVICE
 #define USE_ESP32_BLE_SERVER
@@ -159,11 +183,13 @@
 #define USE_SPEAKER
 #define USE_SPI
 #define USE_VOICE_ASSISTANT
+#define USE_VOICE_ASSISTANT_OPUS
 #define USE_WEBSERVER
 #define USE_WEBSERVER_OTA
 #define USE_WEBSERVER_PORT 80  // NOLINT
 #define USE_WEBSERVER_SORTING
 #define USE_WIFI_11KV_SUPPORT
+#define USE_WORKER_TASK
 
 #ifdef USE_ARDUINO
 #define USE_ARDUINO_VERSION_CODE VERSION_CODE(3, 2, 1)
@@ -194,6 +220,7 @@
 #define USE_ARDUINO_VERSION_CODE VERSION_CODE(3, 1, 2)
 #define USE_CAPTIVE_PORTAL
 #define USE_ESP8266_PREFERENCES_FLASH
+#define USE_ESP8266_PREFERENCES_RTC_CACHE
 #define USE_HTTP_REQUEST_ESP8266_HTTPS
 #define USE_I2C
 #define USE_SOCKET_IMPL_LWIP_TCP
@@ -45,18 +45,17 @@ void EntityBase::set_icon(const char *icon) {
 }
 
 // Entity Object ID
-std::string EntityBase::get_object_id() const {
+std::string EntityBase::get_object_id() const { return this->get_object_id_ref().str(); }
+StringRef EntityBase::get_object_id_ref() const {
   // Check if `App.get_friendly_name()` is constant or dynamic.
   if (!this->flags_.has_own_name && App.is_name_add_mac_suffix_enabled()) {
-    // `App.get_friendly_name()` is dynamic.
-    return str_sanitize(str_snake_case(App.get_friendly_name()));
-  } else {
-    // `App.get_friendly_name()` is constant.
-    if (this->object_id_c_str_ == nullptr) {
-      return "";
-    }
-    return this->object_id_c_str_;
+    // `App.get_friendly_name()` is dynamic: the MAC suffix is only known at runtime, but it is added in
+    // `App.pre_setup()` before any entity exists, so the sanitized name can be computed once and shared.
+    static const std::string DYNAMIC_OBJECT_ID = str_sanitize(str_snake_case(App.get_friendly_name()));
+    return StringRef(DYNAMIC_OBJECT_ID);
   }
+  // `App.get_friendly_name()` is constant.
+  return StringRef::from_maybe_nullptr(this->object_id_c_str_);
 }
 void EntityBase::set_object_id(const char *object_id) {
   this->object_id_c_str_ = object_id;
@@ -64,7 +63,10 @@ void EntityBase::set_object_id(const char *object_id) {
 }
 
 // Calculate Object ID Hash from Entity Name
-void EntityBase::calc_object_id_() { this->object_id_hash_ = fnv1_hash(this->get_object_id()); }
+void EntityBase::calc_object_id_() {
+  StringRef object_id = this->get_object_id_ref();
+  this->object_id_hash_ = fnv1_hash(object_id.c_str());
+}
 
 uint32_t EntityBase::get_object_id_hash() { return this->object_id_hash_; }
 
@@ -18,6 +18,19 @@ enum EntityCategory : uint8_t {
   ENTITY_CATEGORY_DIAGNOSTIC = 2,
 };
 
+#ifdef USE_ENTITY_STATS
+/// Counters of the state traffic of one entity, kept when the entity_stats component is used
+struct EntityStats {
+  uint32_t publishes{0};   ///< States sent to the frontends
+  uint32_t raw_inputs{0};  ///< Values given to the filters, only counted for entities that have filters
+  uint32_t api_bytes{0};   ///< Bytes of encoded API state messages, including the frame overhead
+  uint32_t mqtt_bytes{0};  ///< Bytes of MQTT topics and payloads
+
+  /// Values the filters dropped instead of passing them on
+  uint32_t suppressed() const { return this->raw_inputs > this->publishes ? this->raw_inputs - this->publishes : 0; }
+};
+#endif
+
 // The generic Entity base class that provides an interface common to all Entities.
 class EntityBase {
  public:
@@ -30,6 +43,8 @@ class EntityBase {
 
   // Get the sanitized name of this Entity as an ID.
   std::string get_object_id() const;
+  /// Get the object ID without copying it, the referenced string lives as long as the entity.
+  StringRef get_object_id_ref() const;
   void set_object_id(const char *object_id);
 
   // Get the unique Object ID of this Entity
@@ -80,6 +95,15 @@ class EntityBase {
   // Set has_state - for components that need to manually set this
   void set_has_state(bool state) { this->flags_.has_state = state; }
 
+  // Get/set the low 16 bits of the API state epoch of the last state change, lets reconnecting clients
+  // receive only the entities that changed since their last snapshot
+  uint16_t get_state_generation() const { return this->state_generation_; }
+  void set_state_generation(uint16_t generation) { this->state_generation_ = generation; }
+
+#ifdef USE_ENTITY_STATS
+  EntityStats &get_stats() const { return this->stats_; }
+#endif
+
  protected:
   /// The hash_base() function has been deprecated. It is kept in this
   /// class for now, to prevent external components from not compiling.
@@ -105,6 +129,12 @@ class EntityBase {
     uint8_t entity_category : 2;  // Supports up to 4 categories
     uint8_t reserved : 2;         // Reserved for future use
   } flags_{};
+  // Fits into the padding after flags_
+  uint16_t state_generation_{0};
+#ifdef USE_ENTITY_STATS
+  // Mutable so transports that only hold a const pointer to the entity can count their traffic
+  mutable EntityStats stats_;
+#endif
 };
 
 class EntityBase_DeviceClass {  // NOLINT(readability-identifier-naming)
@@ -20,6 +20,11 @@ namespace esphome {
 
 static const char *const TAG = "helpers";
 
+static const uint8_t CRC8_8C_LE_LUT_L[] = {0x00, 0x5e, 0xbc, 0xe2, 0x61, 0x3f, 0xdd, 0x83,
+                                           0xc2, 0x9c, 0x7e, 0x20, 0xa3, 0xfd, 0x1f, 0x41};
+static const uint8_t CRC8_8C_LE_LUT_H[] = {0x00, 0x9d, 0x23, 0xbe, 0x46, 0xdb, 0x65, 0xf8,
+                                           0x8c, 0x11, 0xaf, 0x32, 0xca, 0x57, 0xe9, 0x74};
+
 static const uint16_t CRC16_A001_LE_LUT_L[] = {0x0000, 0xc0c1, 0xc181, 0x0140, 0xc301, 0x03c0, 0x0280, 0xc241,
                                                0xc601, 0x06c0, 0x0780, 0xc741, 0x0500, 0xc5c1, 0xc481, 0x0440};
 static const uint16_t CRC16_A001_LE_LUT_H[] = {0x0000, 0xcc01, 0xd801, 0x1400, 0xf001, 0x3c00, 0x2800, 0xe401,
@@ -45,14 +50,8 @@ uint8_t crc8(const uint8_t *data, uint8_t len) {
   uint8_t crc = 0;
 
   while ((len--) != 0u) {
-    uint8_t inbyte = *data++;
-    for (uint8_t i = 8; i != 0u; i--) {
-      bool mix = (crc ^ inbyte) & 0x01;
-      crc >>= 1;
-      if (mix)
-        crc ^= 0x8C;
-      inbyte >>= 1;
-    }
+    uint8_t combo = crc ^ *data++;
+    crc = CRC8_8C_LE_LUT_L[combo & 0x0F] ^ CRC8_8C_LE_LUT_H[combo >> 4];
   }
   return crc;
 }
@@ -337,14 +336,21 @@ ParseOnOffState parse_on_off(const char *str, const char *on, const char *off) {
 }
 
 std::string value_accuracy_to_string(float value, int8_t accuracy_decimals) {
+  char tmp[32];  // should be enough, but we should maybe improve this at some point.
+  size_t len = value_accuracy_to_buf(tmp, sizeof(tmp), value, accuracy_decimals);
+  return std::string(tmp, len);
+}
+
+size_t value_accuracy_to_buf(char *buf, size_t buf_size, float value, int8_t accuracy_decimals) {
   if (accuracy_decimals < 0) {
     auto multiplier = powf(10.0f, accuracy_decimals);
     value = roundf(value * multiplier) / multiplier;
     accuracy_decimals = 0;
   }
-  char tmp[32];  // should be enough, but we should maybe improve this at some point.
-  snprintf(tmp, sizeof(tmp), "%.*f", accuracy_decimals, value);
-  return std::string(tmp);
+  int len = snprintf(buf, buf_size, "%.*f", accuracy_decimals, value);
+  if (len < 0)
+    return 0;
+  return std::min(static_cast<size_t>(len), buf_size - 1);
 }
 
 int8_t step_to_accuracy_decimals(float step) {
@@ -608,6 +614,14 @@ bool mac_address_is_valid(const uint8_t *mac) {
   return !(is_all_zeros || is_all_ones);
 }
 
+void ram_allocator_report(const char *name, size_t size, bool success, bool external) {
+  if (!success) {
+    ESP_LOGW(TAG, "'%s': could not allocate %zu bytes", name, size);
+    return;
+  }
+  ESP_LOGD(TAG, "'%s': %zu bytes in %s RAM", name, size, external ? "external" : "internal");
+}
+
 void IRAM_ATTR HOT delay_microseconds_safe(uint32_t us) {
   // avoids CPU locks that could trigger WDT or affect WiFi/BT stability
   uint32_t start = micros();
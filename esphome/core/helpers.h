@@ -107,6 +107,15 @@ uint16_t crc16be(const uint8_t *data, uint16_t len, uint16_t crc = 0, uint16_t p
 
 /// Calculate a FNV-1 hash of \p str.
 uint32_t fnv1_hash(const std::string &str);
+/// Calculate a FNV-1 hash of the null-terminated \p str, at compile time for literals in a constexpr context.
+constexpr uint32_t fnv1_hash(const char *str) {
+  uint32_t hash = 2166136261UL;
+  for (; *str != '\0'; str++) {
+    hash *= 16777619UL;
+    hash ^= *str;
+  }
+  return hash;
+}
 
 /// Return a random 32-bit unsigned integer.
 uint32_t random_uint32();
@@ -510,6 +519,8 @@ ParseOnOffState parse_on_off(const char *str, const char *on = nullptr, const ch
 
 /// Create a string from a value and an accuracy in decimals.
 std::string value_accuracy_to_string(float value, int8_t accuracy_decimals);
+/// Format a value with an accuracy in decimals into \p buf, returns the length written (without terminator).
+size_t value_accuracy_to_buf(char *buf, size_t buf_size, float value, int8_t accuracy_decimals);
 
 /// Derive accuracy in decimals from an increment step.
 int8_t step_to_accuracy_decimals(float step);
@@ -575,6 +586,89 @@ template<typename... Ts> class CallbackManager<void(Ts...)> {
   std::vector<std::function<void(Ts...)>> callbacks_;
 };
 
+template<size_t N, typename... X> class StaticCallbackManager;
+
+/** Helper class to allow having multiple subscribers to a callback, with inline storage for the first \p N.
+ *
+ * Behaves like CallbackManager, but the first N callbacks are stored inside the object itself, so registering
+ * them does not grow a heap-allocated vector. Any callbacks beyond N spill over into a vector, so registering
+ * more subscribers than expected is still safe.
+ *
+ * @tparam N The number of callbacks stored inline.
+ * @tparam Ts The arguments for the callbacks, wrapped in void().
+ */
+template<size_t N, typename... Ts> class StaticCallbackManager<N, void(Ts...)> {
+  static_assert(N > 0 && N <= 255, "StaticCallbackManager inline capacity must be between 1 and 255");
+
+ public:
+  /// Add a callback to the list.
+  void add(std::function<void(Ts...)> &&callback) {
+    if (this->inline_count_ < N) {
+      this->inline_callbacks_[this->inline_count_++] = std::move(callback);
+    } else {
+      this->overflow_callbacks_.push_back(std::move(callback));
+    }
+  }
+
+  /// Call all callbacks in this manager.
+  void call(Ts... args) {
+    for (uint8_t i = 0; i < this->inline_count_; i++)
+      this->inline_callbacks_[i](args...);
+    for (auto &cb : this->overflow_callbacks_)
+      cb(args...);
+  }
+  size_t size() const { return this->inline_count_ + this->overflow_callbacks_.size(); }
+
+  /// Call all callbacks in this manager.
+  void operator()(Ts... args) { call(args...); }
+
+ protected:
+  std::array<std::function<void(Ts...)>, N> inline_callbacks_{};
+  std::vector<std::function<void(Ts...)>> overflow_callbacks_;
+  uint8_t inline_count_{0};
+};
+
+/** Vector-like container with a fixed capacity, stored inline in a std::array.
+ *
+ * Used for containers whose final size is known at compile time, so they cost no heap and can live in .bss.
+ * Elements pushed beyond the capacity are dropped and push_back() returns false, which callers must handle.
+ *
+ * @tparam T The element type.
+ * @tparam N The capacity.
+ */
+template<typename T, size_t N> class StaticVector {
+ public:
+  using value_type = T;
+  using iterator = typename std::array<T, N>::iterator;
+  using const_iterator = typename std::array<T, N>::const_iterator;
+
+  /// Append an element, returns false if the vector is full.
+  [[nodiscard]] bool push_back(const T &value) {
+    if (this->count_ >= N)
+      return false;
+    this->data_[this->count_++] = value;
+    return true;
+  }
+  /// No-op, the storage is already allocated. Kept for drop-in compatibility with std::vector.
+  void reserve(size_t /*count*/) {}
+
+  size_t size() const { return this->count_; }
+  bool empty() const { return this->count_ == 0; }
+  static constexpr size_t capacity() { return N; }
+
+  T &operator[](size_t i) { return this->data_[i]; }
+  const T &operator[](size_t i) const { return this->data_[i]; }
+
+  iterator begin() { return this->data_.begin(); }
+  iterator end() { return this->data_.begin() + this->count_; }
+  const_iterator begin() const { return this->data_.begin(); }
+  const_iterator end() const { return this->data_.begin() + this->count_; }
+
+ protected:
+  std::array<T, N> data_{};
+  size_t count_{0};
+};
+
 /// Helper class to deduplicate items in a series of values.
 template<typename T> class Deduplicator {
  public:
@@ -751,6 +845,9 @@ void delay_microseconds_safe(uint32_t us);
 /// @name Memory management
 ///@{
 
+/// Log where a named RAMAllocator placed a buffer, or that it couldn't.
+void ram_allocator_report(const char *name, size_t size, bool success, bool external);
+
 /** An STL allocator that uses SPI or internal RAM.
  * Returns `nullptr` in case no memory is available.
  *
@@ -758,6 +855,10 @@ void delay_microseconds_safe(uint32_t us);
  * - perform external allocation falling back to main memory if SPI RAM is full or unavailable
  * - perform external allocation only
  * - perform internal allocation only
+ * - perform internal allocation falling back to SPI RAM, for small buffers that are accessed often
+ *
+ * Big buffers that are accessed rarely should keep the default, so internal RAM stays available for DMA and hot
+ * buffers. An allocator given a name logs where each of its allocations was placed.
  */
 template<class T> class RAMAllocator {
  public:
@@ -768,33 +869,44 @@ template<class T> class RAMAllocator {
     ALLOC_EXTERNAL = 1 << 0,  // Perform external allocation only.
     ALLOC_INTERNAL = 1 << 1,  // Perform internal allocation only.
     ALLOW_FAILURE = 1 << 2,   // Does nothing. Kept for compatibility.
+    PREFER_INTERNAL = 1 << 3,  // Try internal memory first, used with both or neither of the flags above.
   };
 
   RAMAllocator() = default;
-  RAMAllocator(uint8_t flags) {
+  RAMAllocator(uint8_t flags, const char *name = nullptr) : name_(name) {
     // default is both external and internal
-    flags &= ALLOC_INTERNAL | ALLOC_EXTERNAL;
-    if (flags != 0)
-      this->flags_ = flags;
+    flags &= ALLOC_INTERNAL | ALLOC_EXTERNAL | PREFER_INTERNAL;
+    if ((flags & (ALLOC_INTERNAL | ALLOC_EXTERNAL)) == 0)
+      flags |= ALLOC_INTERNAL | ALLOC_EXTERNAL;
+    this->flags_ = flags;
   }
-  template<class U> constexpr RAMAllocator(const RAMAllocator<U> &other) : flags_{other.flags_} {}
+  template<class U>
+  constexpr RAMAllocator(const RAMAllocator<U> &other) : flags_{other.flags_}, name_{other.name_} {}
 
   T *allocate(size_t n) { return this->allocate(n, sizeof(T)); }
 
   T *allocate(size_t n, size_t manual_size) {
     size_t size = n * manual_size;
     T *ptr = nullptr;
+    bool external = false;
 #ifdef USE_ESP32
-    if (this->flags_ & Flags::ALLOC_EXTERNAL) {
+    bool internal_first = this->flags_ & Flags::PREFER_INTERNAL;
+    if (internal_first && this->flags_ & Flags::ALLOC_INTERNAL) {
+      ptr = static_cast<T *>(heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+    }
+    if (ptr == nullptr && this->flags_ & Flags::ALLOC_EXTERNAL) {
       ptr = static_cast<T *>(heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+      external = ptr != nullptr;
     }
-    if (ptr == nullptr && this->flags_ & Flags::ALLOC_INTERNAL) {
+    if (ptr == nullptr && !internal_first && this->flags_ & Flags::ALLOC_INTERNAL) {
       ptr = static_cast<T *>(heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
     }
 #else
     // Ignore ALLOC_EXTERNAL/ALLOC_INTERNAL flags if external allocation is not supported
     ptr = static_cast<T *>(malloc(size));  // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
 #endif
+    if (this->name_ != nullptr)
+      ram_allocator_report(this->name_, size, ptr != nullptr, external);
     return ptr;
   }
 
@@ -803,17 +915,25 @@ template<class T> class RAMAllocator {
   T *reallocate(T *p, size_t n, size_t manual_size) {
     size_t size = n * manual_size;
     T *ptr = nullptr;
+    bool external = false;
 #ifdef USE_ESP32
-    if (this->flags_ & Flags::ALLOC_EXTERNAL) {
+    bool internal_first = this->flags_ & Flags::PREFER_INTERNAL;
+    if (internal_first && this->flags_ & Flags::ALLOC_INTERNAL) {
+      ptr = static_cast<T *>(heap_caps_realloc(p, size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+    }
+    if (ptr == nullptr && this->flags_ & Flags::ALLOC_EXTERNAL) {
       ptr = static_cast<T *>(heap_caps_realloc(p, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+      external = ptr != nullptr;
     }
-    if (ptr == nullptr && this->flags_ & Flags::ALLOC_INTERNAL) {
+    if (ptr == nullptr && !internal_first && this->flags_ & Flags::ALLOC_INTERNAL) {
       ptr = static_cast<T *>(heap_caps_realloc(p, size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
     }
 #else
     // Ignore ALLOC_EXTERNAL/ALLOC_INTERNAL flags if external allocation is not supported
     ptr = static_cast<T *>(realloc(p, size));  // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
 #endif
+    if (this->name_ != nullptr)
+      ram_allocator_report(this->name_, size, ptr != nullptr, external);
     return ptr;
   }
 
@@ -860,7 +980,10 @@ template<class T> class RAMAllocator {
   }
 
  private:
+  template<class U> friend class RAMAllocator;
+
   uint8_t flags_{ALLOC_INTERNAL | ALLOC_EXTERNAL};
+  const char *name_{nullptr};
 };
 
 template<class T> using ExternalRAMAllocator = RAMAllocator<T>;
@@ -0,0 +1,76 @@
+#include "esphome/core/loop_arena.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace esphome {
+
+LoopArena global_loop_arena;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void *LoopArena::allocate(size_t size, size_t alignment) {
+  size_t start = (this->used_ + alignment - 1) & ~(alignment - 1);
+  if (start + size <= sizeof(this->buffer_)) {
+    this->used_ = start + size;
+    return this->buffer_ + start;
+  }
+
+  // Buffer exhausted, hand out a heap block that is freed on the next reset()
+  auto *block = static_cast<Overflow *>(malloc(sizeof(Overflow) + size));  // NOLINT(cppcoreguidelines-no-malloc)
+  if (block == nullptr)
+    return nullptr;
+  block->next = this->overflow_;
+  this->overflow_ = block;
+  this->overflow_count_++;
+  return block + 1;
+}
+
+void LoopArena::reset() {
+  if (this->used_ > this->high_water_)
+    this->high_water_ = this->used_;
+  this->used_ = 0;
+  while (this->overflow_ != nullptr) {
+    Overflow *next = this->overflow_->next;
+    free(this->overflow_);  // NOLINT(cppcoreguidelines-no-malloc)
+    this->overflow_ = next;
+  }
+}
+
+StringRef arena_strdup(const char *str, size_t len) {
+  char *buf = static_cast<char *>(global_loop_arena.allocate(len + 1, 1));
+  if (buf == nullptr)
+    return StringRef();
+  memcpy(buf, str, len);
+  buf[len] = '\0';
+  return StringRef(buf, len);
+}
+
+StringRef arena_str_concat(const StringRef &a, const StringRef &b) {
+  size_t len = a.size() + b.size();
+  char *buf = static_cast<char *>(global_loop_arena.allocate(len + 1, 1));
+  if (buf == nullptr)
+    return StringRef();
+  memcpy(buf, a.c_str(), a.size());
+  memcpy(buf + a.size(), b.c_str(), b.size());
+  buf[len] = '\0';
+  return StringRef(buf, len);
+}
+
+StringRef arena_sprintf(const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  int len = vsnprintf(nullptr, 0, fmt, args);
+  va_end(args);
+  if (len < 0)
+    return StringRef();
+
+  char *buf = static_cast<char *>(global_loop_arena.allocate(len + 1, 1));
+  if (buf == nullptr)
+    return StringRef();
+  va_start(args, fmt);
+  vsnprintf(buf, len + 1, fmt, args);
+  va_end(args);
+  return StringRef(buf, len);
+}
+
+}  // namespace esphome
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "esphome/core/defines.h"
+#include "esphome/core/string_ref.h"
+
+#ifndef ESPHOME_LOOP_ARENA_SIZE
+#define ESPHOME_LOOP_ARENA_SIZE 256  // NOLINT
+#endif
+
+namespace esphome {
+
+/** Bump allocator for transient data that only has to live until the end of the current loop iteration.
+ *
+ * Allocations are carved from a static buffer and released all at once when Application::loop() finishes,
+ * so formatting a log line or a payload does not churn and fragment the global heap. When the buffer is
+ * exhausted, allocations fall back to heap blocks that are freed at the same reset; the overflow count
+ * tells whether ESPHOME_LOOP_ARENA_SIZE should be raised.
+ *
+ * @warning The arena is not thread-safe and must only be used from the main loop. Never keep a pointer into
+ *          the arena beyond the current loop iteration, e.g. by capturing it in a defer() or set_timeout().
+ */
+class LoopArena {
+ public:
+  /// Allocate size bytes with the given alignment, returns nullptr only if the heap is exhausted as well.
+  void *allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+  /// Release all allocations, called by Application at the end of every loop iteration.
+  void reset();
+
+  size_t get_used() const { return this->used_; }
+  size_t get_high_water() const { return this->high_water_; }
+  uint32_t get_overflow_count() const { return this->overflow_count_; }
+
+ protected:
+  /// Header of a heap block used when the buffer is exhausted
+  struct alignas(std::max_align_t) Overflow {
+    Overflow *next;
+  };
+
+  alignas(std::max_align_t) uint8_t buffer_[ESPHOME_LOOP_ARENA_SIZE];
+  size_t used_{0};
+  size_t high_water_{0};
+  Overflow *overflow_{nullptr};
+  uint32_t overflow_count_{0};
+};
+
+extern LoopArena global_loop_arena;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// Copy a string into the loop arena. The result is null-terminated and valid until the end of the loop iteration.
+StringRef arena_strdup(const char *str, size_t len);
+inline StringRef arena_strdup(const char *str) { return arena_strdup(str, strlen(str)); }
+
+/// Concatenate two strings in the loop arena, e.g. a topic prefix and a suffix.
+StringRef arena_str_concat(const StringRef &a, const StringRef &b);
+
+/// printf-like formatting into the loop arena. The result is valid until the end of the loop iteration.
+StringRef __attribute__((format(printf, 1, 2))) arena_sprintf(const char *fmt, ...);
+
+}  // namespace esphome
@@ -46,6 +46,24 @@ class ESPPreferences {
    */
   virtual bool sync() = 0;
 
+  /**
+   * Start committing pending writes without blocking the main loop for the whole commit.
+   *
+   * Call poll_sync() from the main loop until it returns true. Backends that can't commit in the background
+   * commit right away. sync() may still be called at any time and waits for a commit in progress.
+   */
+  virtual void begin_sync() { this->sync_result_ = this->sync(); }
+
+  /**
+   * Continue a commit started with begin_sync().
+   *
+   * @return true once the commit has finished, get_sync_result() then holds its result.
+   */
+  virtual bool poll_sync() { return true; }
+
+  /// Result of the last commit started with begin_sync().
+  bool get_sync_result() const { return this->sync_result_; }
+
   /**
    * Forget all unsaved changes and re-initialize the permanent preferences storage.
    * Usually followed by a restart which moves the system to "factory" conditions
@@ -63,6 +81,9 @@ class ESPPreferences {
   ESPPreferenceObject make_preference(uint32_t type) {
     return this->make_preference(sizeof(T), type);
   }
+
+ protected:
+  bool sync_result_{true};
 };
 
 extern ESPPreferences *global_preferences;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -24,7 +24,7 @@ std::unique_ptr<RingBuffer> RingBuffer::create(size_t len) {
 
   rb->size_ = len;
 
-  RAMAllocator<uint8_t> allocator;
+  RAMAllocator<uint8_t> allocator(RAMAllocator<uint8_t>::NONE, "ring buffer");
   rb->storage_ = allocator.allocate(rb->size_);
   if (rb->storage_ == nullptr) {
     return nullptr;
@@ -69,6 +69,13 @@ size_t RingBuffer::read(void *data, size_t len, TickType_t ticks_to_wait) {
   return bytes_read;
 }
 
+uint8_t *RingBuffer::acquire_read(size_t &len, size_t max_len, TickType_t ticks_to_wait) {
+  len = 0;
+  return (uint8_t *) xRingbufferReceiveUpTo(this->handle_, &len, ticks_to_wait, max_len);
+}
+
+void RingBuffer::release_read(uint8_t *data) { vRingbufferReturnItem(this->handle_, data); }
+
 size_t RingBuffer::write(const void *data, size_t len) {
   size_t free = this->free();
   if (free < len) {
@@ -27,6 +27,27 @@ class RingBuffer {
    */
   size_t read(void *data, size_t len, TickType_t ticks_to_wait = 0);
 
+  /**
+   * @brief Gives direct access to the oldest bytes in the ring buffer instead of copying them out.
+   *
+   * The acquired bytes are contiguous, so fewer than `max_len` bytes are returned if the data wraps around the end
+   * of the storage. They may be modified in place and stay in the ring buffer until passed to `release_read`. Only
+   * one region can be acquired at a time.
+   *
+   * @param len Set to the number of bytes acquired
+   * @param max_len Maximum number of bytes to acquire
+   * @param ticks_to_wait Maximum number of FreeRTOS ticks to wait for data (default: 0)
+   * @return Pointer to the acquired bytes, or nullptr if no data is available
+   */
+  uint8_t *acquire_read(size_t &len, size_t max_len, TickType_t ticks_to_wait = 0);
+
+  /**
+   * @brief Discards the bytes returned by `acquire_read` from the ring buffer.
+   *
+   * @param data Pointer returned by `acquire_read`
+   */
+  void release_read(uint8_t *data);
+
   /**
    * @brief Writes to the ring buffer, overwriting oldest data if necessary.
    *
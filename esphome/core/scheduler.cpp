@@ -61,9 +61,19 @@ static void validate_static_string(const char *name) {
 // iterating over them from the loop task is fine; but iterating from any other context requires the lock to be held to
 // avoid the main thread modifying the list while it is being accessed.
 
+#ifdef ESPHOME_SCHEDULER_POOL_SIZE
+Scheduler::Scheduler() {
+  // Reserve all container capacity up front so neither the pool nor the heap
+  // needs to grow (and reallocate) once the node reaches steady state
+  this->item_pool_.reserve(ESPHOME_SCHEDULER_POOL_SIZE);
+  this->items_.reserve(ESPHOME_SCHEDULER_POOL_SIZE);
+}
+#endif
+
 // Common implementation for both timeout and interval
 void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type type, bool is_static_string,
-                                      const void *name_ptr, uint32_t delay, std::function<void()> func) {
+                                      const void *name_ptr, uint32_t delay, std::function<void()> func,
+                                      uint32_t first_delay) {
   // Get the name as const char*
   const char *name_cstr = this->get_name_cstr_(is_static_string, name_ptr);
 
@@ -74,8 +84,22 @@ void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type
     return;
   }
 
+#ifdef ESPHOME_SCHEDULER_DEFER_RING
+  uint32_t defer_ticket = 0;
+  if (delay == 0 && type == SchedulerItem::TIMEOUT) {
+    defer_ticket = this->defer_ticket_.fetch_add(1, std::memory_order_relaxed);
+    // Unnamed defers have nothing to cancel, so they can skip the lock and the item allocation
+    if (name_cstr == nullptr) {
+      if (this->defer_ring_.push(defer_ticket, component, std::move(func)))
+        return;
+      // Ring full, fall back to the locked defer queue rather than dropping the callback
+      this->defer_ring_overflows_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+#endif /* ESPHOME_SCHEDULER_DEFER_RING */
+
   // Create and populate the scheduler item
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->get_item_();
   item->component = component;
   item->set_name(name_cstr, !is_static_string);
   item->type = type;
@@ -87,6 +111,9 @@ void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type
   // Single-core platforms don't need thread-safe defer handling
   if (delay == 0 && type == SchedulerItem::TIMEOUT) {
     // Put in defer queue for guaranteed FIFO execution
+#ifdef ESPHOME_SCHEDULER_DEFER_RING
+    item->next_execution_ = defer_ticket;
+#endif
     LockGuard guard{this->lock_};
     this->cancel_item_locked_(component, name_cstr, type);
     this->defer_queue_.push_back(std::move(item));
@@ -100,9 +127,13 @@ void HOT Scheduler::set_timer_common_(Component *component, SchedulerItem::Type
   // Type-specific setup
   if (type == SchedulerItem::INTERVAL) {
     item->interval = delay;
-    // Calculate random offset (0 to interval/2)
-    uint32_t offset = (delay != 0) ? (random_uint32() % delay) / 2 : 0;
-    item->next_execution_ = now + offset;
+    if (first_delay != RANDOM_FIRST_DELAY) {
+      item->next_execution_ = now + first_delay;
+    } else {
+      // Calculate random offset (0 to interval/2)
+      uint32_t offset = (delay != 0) ? (random_uint32() % delay) / 2 : 0;
+      item->next_execution_ = now + offset;
+    }
   } else {
     item->interval = 0;
     item->next_execution_ = now + delay;
@@ -157,6 +188,10 @@ void HOT Scheduler::set_interval(Component *component, const char *name, uint32_
                                  std::function<void()> func) {
   this->set_timer_common_(component, SchedulerItem::INTERVAL, true, name, interval, std::move(func));
 }
+void HOT Scheduler::set_interval(Component *component, const char *name, uint32_t interval, uint32_t first_delay,
+                                 std::function<void()> func) {
+  this->set_timer_common_(component, SchedulerItem::INTERVAL, true, name, interval, std::move(func), first_delay);
+}
 bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
   return this->cancel_item_(component, false, &name, SchedulerItem::INTERVAL);
 }
@@ -247,6 +282,9 @@ void HOT Scheduler::call(uint32_t now) {
   // Note: Items cancelled via cancel_item_locked_() are marked with remove=true but still
   // processed here. They are removed from the queue normally via pop_front() but skipped
   // during execution by should_skip_item_(). This is intentional - no memory leak occurs.
+#ifdef ESPHOME_SCHEDULER_DEFER_RING
+  this->process_defer_ring_(now);
+#else
   while (!this->defer_queue_.empty()) {
     // The outer check is done without a lock for performance. If the queue
     // appears non-empty, we lock and process an item. We don't need to check
@@ -263,7 +301,13 @@ void HOT Scheduler::call(uint32_t now) {
     if (!this->should_skip_item_(item.get())) {
       this->execute_item_(item.get(), now);
     }
+
+#ifdef ESPHOME_SCHEDULER_POOL_SIZE
+    LockGuard lock(this->lock_);
+    this->recycle_item_(std::move(item));
+#endif
   }
+#endif /* ESPHOME_SCHEDULER_DEFER_RING */
 #endif /* not ESPHOME_CORES_SINGLE */
 
   // Convert the fresh timestamp from main loop to 64-bit for scheduler operations
@@ -285,6 +329,16 @@ void HOT Scheduler::call(uint32_t now) {
     ESP_LOGD(TAG, "Items: count=%zu, now=%" PRIu64 " (%" PRIu16 ", %" PRIu32 ")", this->items_.size(), now_64,
              this->millis_major_, this->last_millis_);
 #endif /* else ESPHOME_CORES_MULTI_ATOMICS */
+#ifdef ESPHOME_SCHEDULER_POOL_SIZE
+    ESP_LOGD(TAG, "Pool: in_use=%" PRIu16 ", high_water=%" PRIu16 ", free=%" PRIu16 "/%u, allocs=%" PRIu32
+                  ", reuses=%" PRIu32,
+             this->items_in_use_, this->items_high_water_, this->get_pool_free(), ESPHOME_SCHEDULER_POOL_SIZE,
+             this->pool_allocations_, this->pool_reuses_);
+#endif /* ESPHOME_SCHEDULER_POOL_SIZE */
+#ifdef ESPHOME_SCHEDULER_DEFER_RING
+    ESP_LOGD(TAG, "Defer ring: high_water=%u/%u, overflows=%" PRIu32, this->defer_ring_high_water_,
+             ESPHOME_SCHEDULER_DEFER_RING_SIZE, this->defer_ring_overflows_.load(std::memory_order_relaxed));
+#endif /* ESPHOME_SCHEDULER_DEFER_RING */
     // Cleanup before debug output
     this->cleanup_();
     while (!this->items_.empty()) {
@@ -328,6 +382,8 @@ void HOT Scheduler::call(uint32_t now) {
     for (auto &item : this->items_) {
       if (!item->remove) {
         valid_items.push_back(std::move(item));
+      } else {
+        this->recycle_item_(std::move(item));
       }
     }
 
@@ -380,6 +436,7 @@ void HOT Scheduler::call(uint32_t now) {
       if (item->remove) {
         // We were removed/cancelled in the function call, stop
         this->to_remove_--;
+        this->recycle_item_(std::move(item));
         continue;
       }
 
@@ -388,6 +445,8 @@ void HOT Scheduler::call(uint32_t now) {
         // Add new item directly to to_add_
         // since we have the lock held
         this->to_add_.push_back(std::move(item));
+      } else {
+        this->recycle_item_(std::move(item));
       }
     }
   }
@@ -398,6 +457,7 @@ void HOT Scheduler::process_to_add() {
   LockGuard guard{this->lock_};
   for (auto &it : this->to_add_) {
     if (it->remove) {
+      this->recycle_item_(std::move(it));
       continue;
     }
 
@@ -437,17 +497,147 @@ size_t HOT Scheduler::cleanup_() {
 }
 void HOT Scheduler::pop_raw_() {
   std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+  // The popped slot may already have been moved out by the caller, recycle_item_ ignores nullptr
+  this->recycle_item_(std::move(this->items_.back()));
   this->items_.pop_back();
 }
 
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::get_item_() {
+#ifdef ESPHOME_SCHEDULER_POOL_SIZE
+  // The pool is shared with the loop task, which recycles items while holding the lock
+  LockGuard guard{this->lock_};
+  std::unique_ptr<SchedulerItem> item;
+  if (!this->item_pool_.empty()) {
+    item = std::move(this->item_pool_.back());
+    this->item_pool_.pop_back();
+    this->pool_reuses_++;
+  } else {
+    item = make_unique<SchedulerItem>();
+    this->pool_allocations_++;
+  }
+  this->items_in_use_++;
+  if (this->items_in_use_ > this->items_high_water_)
+    this->items_high_water_ = this->items_in_use_;
+  return item;
+#else
+  return make_unique<SchedulerItem>();
+#endif
+}
+
+void HOT Scheduler::recycle_item_(std::unique_ptr<SchedulerItem> item) {
+  if (!item)
+    return;
+#ifdef ESPHOME_SCHEDULER_POOL_SIZE
+  this->items_in_use_--;
+  if (this->item_pool_.size() < ESPHOME_SCHEDULER_POOL_SIZE) {
+    item->reset();
+    this->item_pool_.push_back(std::move(item));
+  }
+  // Otherwise the pool is full and the item is freed when it goes out of scope
+#endif
+}
+
 // Helper to execute a scheduler item
 void HOT Scheduler::execute_item_(SchedulerItem *item, uint32_t now) {
-  App.set_current_component(item->component);
-  WarnIfComponentBlockingGuard guard{item->component, now};
-  item->callback();
+  this->execute_callback_(item->component, item->callback, now);
+}
+
+void HOT Scheduler::execute_callback_(Component *component, std::function<void()> &callback, uint32_t now) {
+  App.set_current_component(component);
+  WarnIfComponentBlockingGuard guard{component, now, ComponentTimingSource::SCHEDULER};
+  callback();
   guard.finish();
 }
 
+#ifdef ESPHOME_SCHEDULER_DEFER_RING
+void HOT Scheduler::process_defer_ring_(uint32_t now) {
+  uint32_t pending = this->defer_ring_.size();
+  if (pending > this->defer_ring_high_water_)
+    this->defer_ring_high_water_ = pending;
+
+  while (true) {
+    // Check the ring before the queue: seeing a ring entry guarantees that every defer_queue_ entry submitted
+    // before it by the same thread is visible as well.
+    DeferRing::Slot *slot = this->defer_ring_.front();
+    std::unique_ptr<SchedulerItem> item;
+    // The unlocked empty() check is only a hint, only this thread removes items from the queue
+    if (!this->defer_queue_.empty()) {
+      LockGuard lock(this->lock_);
+      // Look at the ring again while holding the lock, an entry that was submitted before the queue front
+      // may have been published in the meantime
+      if (slot == nullptr)
+        slot = this->defer_ring_.front();
+      auto &front = this->defer_queue_.front();
+      if (slot == nullptr || static_cast<int32_t>(static_cast<uint32_t>(front->next_execution_) - slot->ticket) < 0) {
+        item = std::move(front);
+        this->defer_queue_.pop_front();
+      }
+    }
+
+    if (item) {
+      // Execute callback without holding lock to prevent deadlocks
+      // if the callback tries to call defer() again
+      if (!this->should_skip_item_(item.get()))
+        this->execute_item_(item.get(), now);
+      LockGuard lock(this->lock_);
+      this->recycle_item_(std::move(item));
+    } else if (slot != nullptr) {
+      if (slot->component == nullptr || !slot->component->is_failed())
+        this->execute_callback_(slot->component, slot->callback, now);
+      this->defer_ring_.pop();
+    } else {
+      break;
+    }
+  }
+}
+
+bool HOT Scheduler::DeferRing::push(uint32_t ticket, Component *component, std::function<void()> &&callback) {
+  uint32_t pos = this->enqueue_pos_.load(std::memory_order_relaxed);
+  Slot *slot;
+  while (true) {
+    slot = &this->slots_[pos % ESPHOME_SCHEDULER_DEFER_RING_SIZE];
+    uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+    int32_t diff = static_cast<int32_t>(sequence - pos);
+    if (diff == 0) {
+      // Slot is free for this position, try to claim it
+      if (this->enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        break;
+      // Lost the race, pos now holds the current position
+    } else if (diff < 0) {
+      // The slot still holds an entry from the previous lap, the ring is full
+      return false;
+    } else {
+      // Another producer claimed this position, start over from the current one
+      pos = this->enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  slot->ticket = ticket;
+  slot->component = component;
+  slot->callback = std::move(callback);
+  // Publish the filled slot to the consumer
+  slot->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+Scheduler::DeferRing::Slot *Scheduler::DeferRing::front() {
+  uint32_t pos = this->dequeue_pos_.load(std::memory_order_relaxed);
+  Slot *slot = &this->slots_[pos % ESPHOME_SCHEDULER_DEFER_RING_SIZE];
+  if (slot->sequence.load(std::memory_order_acquire) != pos + 1)
+    return nullptr;
+  return slot;
+}
+
+void HOT Scheduler::DeferRing::pop() {
+  uint32_t pos = this->dequeue_pos_.load(std::memory_order_relaxed);
+  Slot *slot = &this->slots_[pos % ESPHOME_SCHEDULER_DEFER_RING_SIZE];
+  // Release the captures now instead of when the slot is reused
+  slot->callback = nullptr;
+  // Hand the slot back to producers for the next lap
+  slot->sequence.store(pos + ESPHOME_SCHEDULER_DEFER_RING_SIZE, std::memory_order_release);
+  this->dequeue_pos_.store(pos + 1, std::memory_order_relaxed);
+}
+#endif /* ESPHOME_SCHEDULER_DEFER_RING */
+
 // Common implementation for cancel operations
 bool HOT Scheduler::cancel_item_(Component *component, bool is_static_string, const void *name_ptr,
                                  SchedulerItem::Type type) {
@@ -6,6 +6,7 @@
 #include <cstring>
 #include <deque>
 #ifdef ESPHOME_CORES_MULTI_ATOMICS
+#include <array>
 #include <atomic>
 #endif
 
@@ -16,8 +17,17 @@ namespace esphome {
 
 class Component;
 
+// The lock-free defer ring needs atomics, multi-core platforms without them keep using the locked defer queue
+#if defined(ESPHOME_SCHEDULER_DEFER_RING_SIZE) && defined(ESPHOME_CORES_MULTI_ATOMICS)
+#define ESPHOME_SCHEDULER_DEFER_RING
+#endif
+
 class Scheduler {
  public:
+#ifdef ESPHOME_SCHEDULER_POOL_SIZE
+  Scheduler();
+#endif
+
   // Public API - accepts std::string for backward compatibility
   void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> func);
 
@@ -50,6 +60,15 @@ class Scheduler {
    */
   void set_interval(Component *component, const char *name, uint32_t interval, std::function<void()> func);
 
+  /** Set an interval with a const char* name that first runs after first_delay.
+   *
+   * Other intervals first run after a random part of the first half of the interval. This one lets the caller
+   * place the runs, like PollingComponent does to spread updates over the interval. The name has the same lifetime
+   * requirements as above.
+   */
+  void set_interval(Component *component, const char *name, uint32_t interval, uint32_t first_delay,
+                    std::function<void()> func);
+
   bool cancel_interval(Component *component, const std::string &name);
   bool cancel_interval(Component *component, const char *name);
   void set_retry(Component *component, const std::string &name, uint32_t initial_wait_time, uint8_t max_attempts,
@@ -69,6 +88,26 @@ class Scheduler {
 
   void process_to_add();
 
+#ifdef ESPHOME_SCHEDULER_POOL_SIZE
+  /// Number of scheduler items currently in use (heap, pending additions and defer queue).
+  uint16_t get_items_in_use() const { return this->items_in_use_; }
+  /// Highest number of scheduler items that were in use at the same time since boot.
+  uint16_t get_items_high_water() const { return this->items_high_water_; }
+  /// Number of recycled items waiting in the pool.
+  uint16_t get_pool_free() const { return this->item_pool_.size(); }
+  /// Number of items that had to be allocated from the heap since boot.
+  uint32_t get_pool_allocations() const { return this->pool_allocations_; }
+  /// Number of items that were served from the pool without a heap allocation since boot.
+  uint32_t get_pool_reuses() const { return this->pool_reuses_; }
+#endif
+
+#ifdef ESPHOME_SCHEDULER_DEFER_RING
+  /// Number of unnamed defer() calls that found the lock-free ring full and used the locked defer queue instead.
+  uint32_t get_defer_ring_overflows() const { return this->defer_ring_overflows_.load(std::memory_order_relaxed); }
+  /// Highest number of entries that were waiting in the lock-free defer ring at the same time since boot.
+  uint8_t get_defer_ring_high_water() const { return this->defer_ring_high_water_; }
+#endif
+
  protected:
   struct SchedulerItem {
     // Ordered by size to minimize padding
@@ -106,6 +145,18 @@ class Scheduler {
       }
     }
 
+    // Reset the item to its freshly constructed state so it can be recycled.
+    // Releases the callback captures and any dynamically allocated name.
+    void reset() {
+      this->set_name(nullptr);
+      this->callback = nullptr;
+      this->component = nullptr;
+      this->interval = 0;
+      this->next_execution_ = 0;
+      this->type = TIMEOUT;
+      this->remove = false;
+    }
+
     // Delete copy operations to prevent accidental copies
     SchedulerItem(const SchedulerItem &) = delete;
     SchedulerItem &operator=(const SchedulerItem &) = delete;
@@ -145,9 +196,56 @@ class Scheduler {
     const char *get_source() const { return component ? component->get_component_source() : "unknown"; }
   };
 
+#ifdef ESPHOME_SCHEDULER_DEFER_RING
+  /** Bounded multi-producer single-consumer ring for unnamed defer() calls.
+   *
+   * Slots are pre-allocated and hold the callback by value, so pushing never takes the lock or allocates a
+   * SchedulerItem. Each slot carries a sequence number that tells producers when it is free and the consumer
+   * when it is filled (bounded MPMC queue design by Dmitry Vyukov, reduced to a single consumer).
+   */
+  class DeferRing {
+   public:
+    struct Slot {
+      std::atomic<uint32_t> sequence{0};
+      uint32_t ticket{0};
+      Component *component{nullptr};
+      std::function<void()> callback;
+    };
+
+    DeferRing() {
+      for (uint32_t i = 0; i < ESPHOME_SCHEDULER_DEFER_RING_SIZE; i++)
+        this->slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    // Safe to call from any thread. Returns false if the ring is full.
+    bool push(uint32_t ticket, Component *component, std::function<void()> &&callback);
+    // Oldest filled slot or nullptr. Only the loop task may call this.
+    Slot *front();
+    // Release the slot returned by front(). Only the loop task may call this.
+    void pop();
+    // Number of filled slots, approximate while producers are running
+    uint32_t size() const {
+      return this->enqueue_pos_.load(std::memory_order_relaxed) - this->dequeue_pos_.load(std::memory_order_relaxed);
+    }
+
+   protected:
+    // The positions wrap around at 2^32, a power of two size keeps the slot index continuous across the wrap
+    static_assert((ESPHOME_SCHEDULER_DEFER_RING_SIZE & (ESPHOME_SCHEDULER_DEFER_RING_SIZE - 1)) == 0,
+                  "ESPHOME_SCHEDULER_DEFER_RING_SIZE must be a power of two");
+
+    std::array<Slot, ESPHOME_SCHEDULER_DEFER_RING_SIZE> slots_;
+    std::atomic<uint32_t> enqueue_pos_{0};
+    // Only written by the consumer, atomic so size() can be read from other threads
+    std::atomic<uint32_t> dequeue_pos_{0};
+  };
+#endif /* ESPHOME_SCHEDULER_DEFER_RING */
+
+  // Intervals set with this first delay start after a random offset
+  static constexpr uint32_t RANDOM_FIRST_DELAY = 0xFFFFFFFF;
+
   // Common implementation for both timeout and interval
   void set_timer_common_(Component *component, SchedulerItem::Type type, bool is_static_string, const void *name_ptr,
-                         uint32_t delay, std::function<void()> func);
+                         uint32_t delay, std::function<void()> func, uint32_t first_delay = RANDOM_FIRST_DELAY);
 
   uint64_t millis_64_(uint32_t now);
   // Cleanup logically deleted items from the scheduler
@@ -156,6 +254,12 @@ class Scheduler {
   size_t cleanup_();
   void pop_raw_();
 
+  // Obtain a fresh item, reusing one from the pool when available
+  std::unique_ptr<SchedulerItem> get_item_();
+  // Return an item that is no longer referenced by any container to the pool (or free it)
+  // IMPORTANT: This method must be called with the lock held.
+  void recycle_item_(std::unique_ptr<SchedulerItem> item);
+
  private:
   // Helper to cancel items by name - must be called with lock held
   bool cancel_item_locked_(Component *component, const char *name, SchedulerItem::Type type);
@@ -191,6 +295,11 @@ class Scheduler {
 
   // Helper to execute a scheduler item
   void execute_item_(SchedulerItem *item, uint32_t now);
+  void execute_callback_(Component *component, std::function<void()> &callback, uint32_t now);
+#ifdef ESPHOME_SCHEDULER_DEFER_RING
+  // Run everything in defer_ring_ and defer_queue_ in submission order
+  void process_defer_ring_(uint32_t now);
+#endif
 
   // Helper to check if item should be skipped
   bool should_skip_item_(const SchedulerItem *item) const {
@@ -204,8 +313,27 @@ class Scheduler {
   // Single-core platforms don't need the defer queue and save 40 bytes of RAM
   std::deque<std::unique_ptr<SchedulerItem>> defer_queue_;  // FIFO queue for defer() calls
 #endif                                                      /* ESPHOME_CORES_SINGLE */
+#ifdef ESPHOME_SCHEDULER_DEFER_RING
+  // Unnamed defers go through the ring, named ones (which must cancel atomically) through defer_queue_.
+  // Every defer takes a ticket so call() can merge both queues back into submission order. Items in
+  // defer_queue_ keep their ticket in next_execution_, which deferred items don't otherwise use.
+  DeferRing defer_ring_;
+  std::atomic<uint32_t> defer_ticket_{0};
+  std::atomic<uint32_t> defer_ring_overflows_{0};
+  uint8_t defer_ring_high_water_{0};
+#endif
   uint32_t to_remove_{0};
 
+#ifdef ESPHOME_SCHEDULER_POOL_SIZE
+  // Recycled items ready for reuse. Capacity is reserved once at construction so that
+  // steady-state operation performs no heap allocations for SchedulerItem objects.
+  std::vector<std::unique_ptr<SchedulerItem>> item_pool_;
+  uint32_t pool_allocations_{0};
+  uint32_t pool_reuses_{0};
+  uint16_t items_in_use_{0};
+  uint16_t items_high_water_{0};
+#endif
+
 #ifdef ESPHOME_CORES_MULTI_ATOMICS
   /*
    * Multi-threaded platforms with atomic support: last_millis_ needs atomic for lock-free updates
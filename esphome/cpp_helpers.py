@@ -1,7 +1,9 @@
 import logging
 
 from esphome.const import (
+    CONF_LOOP_TIER,
     CONF_SAFE_MODE,
+    CONF_SETUP_ASYNC,
     CONF_SETUP_PRIORITY,
     CONF_TYPE_ID,
     CONF_UPDATE_INTERVAL,
@@ -9,8 +11,8 @@ from esphome.const import (
 )
 from esphome.core import CORE, ID, coroutine
 from esphome.coroutine import FakeAwaitable
-from esphome.cpp_generator import add, get_variable
-from esphome.cpp_types import App
+from esphome.cpp_generator import add, add_define, get_variable
+from esphome.cpp_types import App, LoopTier
 from esphome.types import ConfigFragmentType, ConfigType
 from esphome.util import Registry, RegistryEntry
 
@@ -50,8 +52,14 @@ async def register_component(var, config):
     CORE.component_ids.remove(id_)
     if CONF_SETUP_PRIORITY in config:
         add(var.set_setup_priority(config[CONF_SETUP_PRIORITY]))
+    if config.get(CONF_SETUP_ASYNC):
+        add_define("USE_SETUP_ASYNC")
+        add(var.set_setup_async(True))
     if CONF_UPDATE_INTERVAL in config:
         add(var.set_update_interval(config[CONF_UPDATE_INTERVAL]))
+    if CONF_LOOP_TIER in config:
+        add_define("USE_LOOP_TIERS")
+        add(var.set_loop_tier(getattr(LoopTier, config[CONF_LOOP_TIER].upper())))
 
     # Set component source by inspecting the stack and getting the callee module
     # https://stackoverflow.com/a/1095621
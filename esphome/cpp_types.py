@@ -41,5 +41,6 @@ InternalGPIOPin = esphome_ns.class_("InternalGPIOPin", GPIOPin)
 gpio_ns = esphome_ns.namespace("gpio")
 gpio_Flags = gpio_ns.enum("Flags", is_class=True)
 EntityCategory = esphome_ns.enum("EntityCategory")
+LoopTier = esphome_ns.enum("LoopTier", is_class=True)
 Parented = esphome_ns.class_("Parented")
 ESPTime = esphome_ns.struct("ESPTime")
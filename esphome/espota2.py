@@ -36,6 +36,7 @@ RESPONSE_ERROR_ESP8266_NOT_ENOUGH_SPACE = 0x88
 RESPONSE_ERROR_ESP32_NOT_ENOUGH_SPACE = 0x89
 RESPONSE_ERROR_NO_UPDATE_PARTITION = 0x8A
 RESPONSE_ERROR_MD5_MISMATCH = 0x8B
+RESPONSE_ERROR_DECOMPRESS = 0x8D
 RESPONSE_ERROR_UNKNOWN = 0xFF
 
 OTA_VERSION_1_0 = 1
@@ -48,6 +49,9 @@ FEATURE_SUPPORTS_COMPRESSION = 0x01
 
 UPLOAD_BLOCK_SIZE = 8192
 UPLOAD_BUFFER_SIZE = UPLOAD_BLOCK_SIZE * 8
+# Blocks sent before waiting for the chunk OK of the oldest one, so the device
+# always has data to receive while it acknowledges and writes the previous block
+UPLOAD_ACK_WINDOW = 4
 
 _LOGGER = logging.getLogger(__name__)
 
@@ -171,6 +175,10 @@ def check_error(data, expect):
             "Error: Application MD5 code mismatch. Please try again "
             "or flash over USB with a good quality cable."
         )
+    if dat == RESPONSE_ERROR_DECOMPRESS:
+        raise OTAError(
+            "Error: The ESP failed to decompress the update. Please try again."
+        )
     if dat == RESPONSE_ERROR_UNKNOWN:
         raise OTAError("Unknown error from ESP")
     if not isinstance(expect, (list, tuple)):
@@ -277,6 +285,7 @@ def perform_ota(
     start_time = time.perf_counter()
 
     offset = 0
+    unacknowledged = 0
     progress = ProgressBar()
     while True:
         chunk = upload_contents[offset : offset + UPLOAD_BLOCK_SIZE]
@@ -287,7 +296,13 @@ def perform_ota(
         try:
             sock.sendall(chunk)
             if version >= OTA_VERSION_2_0:
-                receive_exactly(sock, 1, "chunk OK", RESPONSE_CHUNK_OK)
+                unacknowledged += 1
+                # Collect the remaining acknowledgements after the last block
+                while unacknowledged >= UPLOAD_ACK_WINDOW or (
+                    unacknowledged and offset == upload_size
+                ):
+                    receive_exactly(sock, 1, "chunk OK", RESPONSE_CHUNK_OK)
+                    unacknowledged -= 1
         except OSError as err:
             sys.stderr.write("\n")
             raise OTAError(f"Error sending data: {err}") from err
@@ -299,7 +314,11 @@ def perform_ota(
     sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
     duration = time.perf_counter() - start_time
 
-    _LOGGER.info("Upload took %.2f seconds, waiting for result...", duration)
+    _LOGGER.info(
+        "Upload took %.2f seconds (%.1f kB/s), waiting for result...",
+        duration,
+        upload_size / duration / 1000,
+    )
 
     receive_exactly(sock, 1, "receive OK", RESPONSE_RECEIVE_OK)
     receive_exactly(sock, 1, "Update end", RESPONSE_UPDATE_END_OK)
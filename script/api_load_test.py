@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+"""Load test the native API of a host-mode device with many entities and clients.
+
+Builds a host-mode device with --entities template sensors that update every
+--interval milliseconds, runs it, connects --clients API clients that subscribe
+to states and prints state update latency percentiles, the update rate of each
+connection and the CPU time the device used. Use it to compare APIConnection
+batching changes, for example by running it with a few --batch-delay values.
+
+Each sensor reports the device's millis() when it was read. The latency of an
+update is measured against the fastest update seen during the run, so it shows
+how long updates sit in the device and the client queues beyond the best case
+(mostly the batch delay), not the absolute one-way delay.
+
+Example:
+    script/api_load_test.py --entities 2000 --interval 1000 --clients 4
+"""
+
+from __future__ import annotations
+
+import argparse
+import asyncio
+import json
+import os
+from pathlib import Path
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+
+from aioesphomeapi import APIClient, SensorState
+
+import esphome.config
+from esphome.core import CORE
+from esphome.platformio_api import get_idedata
+
+DEVICE_NAME = "api-load-test"
+
+
+def build_config(args: argparse.Namespace, port: int) -> str:
+    lines = [
+        "esphome:",
+        f"  name: {DEVICE_NAME}",
+        "host:",
+        "logger:",
+        "  level: WARN",
+        "api:",
+        f"  port: {port}",
+        f"  batch_delay: {args.batch_delay}ms",
+        "sensor:",
+    ]
+    for i in range(args.entities):
+        lines += [
+            "  - platform: template",
+            f'    name: "Load {i}"',
+            "    lambda: return millis();",
+            f"    update_interval: {args.interval}ms",
+        ]
+    return "\n".join(lines) + "\n"
+
+
+def compile_device(config_path: Path) -> Path:
+    subprocess.run(["esphome", "compile", str(config_path)], check=True)
+    CORE.reset()
+    CORE.config_path = str(config_path)
+    config = esphome.config.read_config(
+        {"command": "compile", "config": str(config_path)}
+    )
+    if config is None:
+        raise RuntimeError(f"Failed to read config from {config_path}")
+    return Path(get_idedata(config).firmware_elf_path)
+
+
+def unused_port() -> int:
+    with socket.socket(socket.AF_INET, socket.SOCK_STREAM) as sock:
+        sock.bind(("127.0.0.1", 0))
+        return sock.getsockname()[1]
+
+
+def cpu_seconds(pid: int) -> float | None:
+    """User plus system CPU time of a process, from /proc (Linux only)."""
+    try:
+        stat = Path(f"/proc/{pid}/stat").read_text()
+    except OSError:
+        return None
+    # The command name can contain spaces, the fields after it can't
+    fields = stat.rsplit(")", 1)[1].split()
+    return (int(fields[11]) + int(fields[12])) / os.sysconf("SC_CLK_TCK")
+
+
+def percentile(values: list[float], pct: float) -> float:
+    return values[min(len(values) - 1, int(len(values) * pct / 100))]
+
+
+class LoadClient:
+    def __init__(self, index: int, port: int) -> None:
+        self.client = APIClient(
+            "127.0.0.1", port, "", client_info=f"api-load-test {index}"
+        )
+        self.recording = False
+        self.updates = 0
+        # (client monotonic ms, device millis) of each update while recording
+        self.samples: list[tuple[float, float]] = []
+
+    async def start(self) -> None:
+        await self.client.connect(login=True)
+        await self.client.list_entities_services()
+        self.client.subscribe_states(self._on_state)
+
+    def _on_state(self, state: object) -> None:
+        if not self.recording or not isinstance(state, SensorState):
+            return
+        self.updates += 1
+        self.samples.append((time.monotonic() * 1000, state.state))
+
+
+async def wait_for_port(port: int, timeout: float = 30.0) -> None:
+    end = time.monotonic() + timeout
+    while True:
+        try:
+            _, writer = await asyncio.open_connection("127.0.0.1", port)
+        except OSError:
+            if time.monotonic() > end:
+                raise
+            await asyncio.sleep(0.2)
+            continue
+        writer.close()
+        await writer.wait_closed()
+        return
+
+
+async def run(args: argparse.Namespace, binary: Path, port: int) -> dict:
+    device = subprocess.Popen(
+        [str(binary)], stdout=subprocess.DEVNULL, stderr=subprocess.STDOUT
+    )
+    try:
+        await wait_for_port(port)
+        clients = [LoadClient(i, port) for i in range(args.clients)]
+        await asyncio.gather(*(client.start() for client in clients))
+        # Skip the initial state dump every client gets on subscribe
+        await asyncio.sleep(args.warmup)
+        cpu_start = cpu_seconds(device.pid)
+        for client in clients:
+            client.recording = True
+        start = time.monotonic()
+        await asyncio.sleep(args.duration)
+        for client in clients:
+            client.recording = False
+        elapsed = time.monotonic() - start
+        cpu_end = cpu_seconds(device.pid)
+        for client in clients:
+            await client.client.disconnect()
+    finally:
+        device.terminate()
+        device.wait()
+
+    samples = [sample for client in clients for sample in client.samples]
+    if not samples:
+        raise RuntimeError("No state updates received")
+    offset = min(received - sent for received, sent in samples)
+    latencies = sorted(received - sent - offset for received, sent in samples)
+    result = {
+        "entities": args.entities,
+        "interval_ms": args.interval,
+        "batch_delay_ms": args.batch_delay,
+        "clients": args.clients,
+        "duration_s": round(elapsed, 2),
+        "expected_rate": round(args.entities * 1000 / args.interval, 1),
+        "rate_per_client": [round(c.updates / elapsed, 1) for c in clients],
+        "latency_ms": {
+            f"p{pct}": round(percentile(latencies, pct), 1) for pct in (50, 90, 99)
+        }
+        | {"max": round(latencies[-1], 1)},
+    }
+    if cpu_start is not None and cpu_end is not None:
+        result["device_cpu_pct"] = round((cpu_end - cpu_start) / elapsed * 100, 1)
+    return result
+
+
+def print_result(result: dict) -> None:
+    print(
+        f"Entities: {result['entities']} every {result['interval_ms']} ms, "
+        f"batch delay {result['batch_delay_ms']} ms"
+    )
+    print(f"Expected: {result['expected_rate']} updates/s per client")
+    for i, rate in enumerate(result["rate_per_client"]):
+        print(f"Client {i}: {rate} updates/s")
+    latency = result["latency_ms"]
+    print(
+        f"Latency:  p50 {latency['p50']} ms, p90 {latency['p90']} ms, "
+        f"p99 {latency['p99']} ms, max {latency['max']} ms"
+    )
+    if "device_cpu_pct" in result:
+        print(f"Device CPU: {result['device_cpu_pct']} %")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--entities", type=int, default=1000, help="Sensors")
+    parser.add_argument(
+        "--interval", type=int, default=1000, help="Sensor update interval in ms"
+    )
+    parser.add_argument("--clients", type=int, default=2, help="API clients")
+    parser.add_argument(
+        "--batch-delay", type=int, default=100, help="API batch_delay in ms"
+    )
+    parser.add_argument("--duration", type=float, default=20.0, help="Seconds")
+    parser.add_argument(
+        "--warmup", type=float, default=3.0, help="Seconds to wait before measuring"
+    )
+    parser.add_argument("--json", type=Path, help="Also write the results here")
+    parser.add_argument(
+        "--build-dir",
+        type=Path,
+        help="Directory for the generated config and build, kept between runs",
+    )
+    args = parser.parse_args()
+
+    port = unused_port()
+    build_dir = args.build_dir or Path(tempfile.mkdtemp(prefix="api-load-test-"))
+    build_dir.mkdir(parents=True, exist_ok=True)
+    config_path = build_dir / f"{DEVICE_NAME}.yaml"
+    config_path.write_text(build_config(args, port), encoding="utf-8")
+    binary = compile_device(config_path)
+
+    result = asyncio.run(run(args, binary, port))
+    print_result(result)
+    if args.json:
+        args.json.write_text(json.dumps(result, indent=2) + "\n", encoding="utf-8")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -6,14 +6,33 @@ from enum import IntEnum
 import os
 from pathlib import Path
 import re
-from subprocess import call
+from subprocess import call, check_call
 import sys
+import tempfile
 from typing import Any
 
-import aioesphomeapi.api_options_pb2 as pb
 import google.protobuf.descriptor_pb2 as descriptor
 
 
+def load_api_options() -> Any:
+    """Compile the api_options.proto of this tree and import it.
+
+    The copy in aioesphomeapi lags behind, options added here would be missing.
+    """
+    api_dir = Path(__file__).resolve().parent.parent.parent / "esphome/components/api"
+    out_dir = tempfile.mkdtemp()
+    check_call(
+        ["protoc", f"--python_out={out_dir}", "-I", str(api_dir), "api_options.proto"]
+    )
+    sys.path.insert(0, out_dir)
+    import api_options_pb2  # pylint: disable=import-outside-toplevel
+
+    return api_options_pb2
+
+
+pb = load_api_options()
+
+
 class WireType(IntEnum):
     """Protocol Buffer wire types as defined in the protobuf spec.
 
@@ -29,9 +48,6 @@ class WireType(IntEnum):
     FIXED32 = 5  # fixed32, sfixed32, float
 
 
-# Generate with
-# protoc --python_out=script/api_protobuf -I esphome/components/api/ api_options.proto
-
 
 """Python 3 script to automatically generate C++ classes for ESPHome's native API.
 
@@ -224,6 +240,22 @@ class TypeInfo(ABC):
 
     encode_func = None
 
+    # ProtoWriteBuffer::*_unchecked helper used by fixed_layout messages and the
+    # worst-case encoded size of the value (without the tag byte)
+    unchecked_encode_func: str | None = None
+    max_value_size: int | None = None
+
+    @property
+    def unchecked_encode_content(self) -> str:
+        return (
+            f"pos = ProtoWriteBuffer::{self.unchecked_encode_func}<{self.number}>"
+            f"(pos, this->{self.field_name});"
+        )
+
+    def get_max_encoded_size(self) -> int:
+        """Worst-case size of this field on the wire, used for fixed_layout messages."""
+        return self.calculate_field_id_size() + self.max_value_size
+
     @property
     def dump_content(self) -> str:
         o = f'out.append("  {self.name}: ");\n'
@@ -392,6 +424,8 @@ class FloatType(TypeInfo):
     default_value = "0.0f"
     decode_32bit = "value.as_float()"
     encode_func = "encode_float"
+    unchecked_encode_func = "encode_float_unchecked"
+    max_value_size = 4
     wire_type = WireType.FIXED32  # Uses wire type 5
 
     def dump(self, name: str) -> str:
@@ -436,6 +470,8 @@ class UInt64Type(TypeInfo):
     default_value = "0"
     decode_varint = "value.as_uint64()"
     encode_func = "encode_uint64"
+    unchecked_encode_func = "encode_uint64_unchecked"
+    max_value_size = 10
     wire_type = WireType.VARINT  # Uses wire type 0
 
     def dump(self, name: str) -> str:
@@ -500,6 +536,8 @@ class Fixed32Type(TypeInfo):
     default_value = "0"
     decode_32bit = "value.as_fixed32()"
     encode_func = "encode_fixed32"
+    unchecked_encode_func = "encode_fixed32_unchecked"
+    max_value_size = 4
     wire_type = WireType.FIXED32  # Uses wire type 5
 
     def dump(self, name: str) -> str:
@@ -524,6 +562,8 @@ class BoolType(TypeInfo):
     default_value = "false"
     decode_varint = "value.as_bool()"
     encode_func = "encode_bool"
+    unchecked_encode_func = "encode_bool_unchecked"
+    max_value_size = 1
     wire_type = WireType.VARINT  # Uses wire type 0
 
     def dump(self, name: str) -> str:
@@ -774,6 +814,20 @@ class FixedArrayBytesType(TypeInfo):
     def encode_content(self) -> str:
         return f"buffer.encode_bytes({self.number}, this->{self.field_name}, this->{self.field_name}_len);"
 
+    unchecked_encode_func = "encode_bytes_unchecked"
+
+    @property
+    def max_value_size(self) -> int:
+        # Length varint plus a completely filled array
+        return (1 if self.array_size < 128 else 2) + self.array_size
+
+    @property
+    def unchecked_encode_content(self) -> str:
+        return (
+            f"pos = ProtoWriteBuffer::{self.unchecked_encode_func}<{self.number}>"
+            f"(pos, this->{self.field_name}, this->{self.field_name}_len);"
+        )
+
     def dump(self, name: str) -> str:
         o = f"out.append(format_hex_pretty({name}, {name}_len));"
         return o
@@ -811,6 +865,8 @@ class UInt32Type(TypeInfo):
     default_value = "0"
     decode_varint = "value.as_uint32()"
     encode_func = "encode_uint32"
+    unchecked_encode_func = "encode_uint32_unchecked"
+    max_value_size = 5
     wire_type = WireType.VARINT  # Uses wire type 0
 
     def dump(self, name: str) -> str:
@@ -846,6 +902,16 @@ class EnumType(TypeInfo):
     def encode_content(self) -> str:
         return f"buffer.{self.encode_func}({self.number}, static_cast<uint32_t>(this->{self.field_name}));"
 
+    unchecked_encode_func = "encode_uint32_unchecked"
+    max_value_size = 5
+
+    @property
+    def unchecked_encode_content(self) -> str:
+        return (
+            f"pos = ProtoWriteBuffer::{self.unchecked_encode_func}<{self.number}>"
+            f"(pos, static_cast<uint32_t>(this->{self.field_name}));"
+        )
+
     def dump(self, name: str) -> str:
         o = f"out.append(proto_enum_to_string<{self.cpp_type}>({name}));"
         return o
@@ -913,6 +979,8 @@ class SInt32Type(TypeInfo):
     default_value = "0"
     decode_varint = "value.as_sint32()"
     encode_func = "encode_sint32"
+    unchecked_encode_func = "encode_sint32_unchecked"
+    max_value_size = 5
     wire_type = WireType.VARINT  # Uses wire type 0
 
     def dump(self, name: str) -> str:
@@ -1055,6 +1123,11 @@ class FixedArrayRepeatedType(TypeInfo):
 class RepeatedTypeInfo(TypeInfo):
     def __init__(self, field: descriptor.FieldDescriptorProto) -> None:
         super().__init__(field)
+        # Encode-only fields can point at a container owned by the entity
+        # instead of holding a copy of every element
+        self._container_pointer: str | None = get_field_opt(
+            field, pb.container_pointer
+        )
         # For repeated fields, we need to get the base type info
         # but we can't call create_field_type_info as it would cause recursion
         # So we extract just the type creation logic
@@ -1070,8 +1143,18 @@ class RepeatedTypeInfo(TypeInfo):
 
     @property
     def cpp_type(self) -> str:
+        if self._container_pointer:
+            return f"const {self._container_pointer} *"
         return f"std::vector<{self._ti.cpp_type}>"
 
+    @property
+    def container_pointer(self) -> str | None:
+        return self._container_pointer
+
+    def _container(self, name: str) -> str:
+        """Expression for the container to iterate over."""
+        return f"*{name}" if self._container_pointer else name
+
     @property
     def reference_type(self) -> str:
         return f"{self.cpp_type} &"
@@ -1134,9 +1217,16 @@ class RepeatedTypeInfo(TypeInfo):
 
     @property
     def encode_content(self) -> str:
-        o = f"for (auto {'' if self._ti_is_bool else '&'}it : this->{self.field_name}) {{\n"
+        container = self._container(f"this->{self.field_name}")
+        o = f"for (auto {'' if self._ti_is_bool else '&'}it : {container}) {{\n"
         if isinstance(self._ti, EnumType):
             o += f"  buffer.{self._ti.encode_func}({self.number}, static_cast<uint32_t>(it), true);\n"
+        elif (
+            isinstance(self._ti, MessageType)
+            and self._ti.cpp_type in FIXED_LAYOUT_MESSAGES
+        ):
+            # Single pass: the one-byte length is backfilled after encoding
+            o += f"  buffer.encode_fixed_layout_message({self.number}, it);\n"
         else:
             o += f"  buffer.{self._ti.encode_func}({self.number}, it, true);\n"
         o += "}"
@@ -1144,7 +1234,8 @@ class RepeatedTypeInfo(TypeInfo):
 
     @property
     def dump_content(self) -> str:
-        o = f"for (const auto {'' if self._ti_is_bool else '&'}it : this->{self.field_name}) {{\n"
+        container = self._container(f"this->{self.field_name}")
+        o = f"for (const auto {'' if self._ti_is_bool else '&'}it : {container}) {{\n"
         o += f'  out.append("  {self.name}: ");\n'
         o += indent(self._ti.dump("it")) + "\n"
         o += '  out.append("\\n");\n'
@@ -1164,7 +1255,8 @@ class RepeatedTypeInfo(TypeInfo):
             return o
 
         # For other repeated types, use the underlying type's size calculation with force=True
-        o = f"if (!{name}.empty()) {{\n"
+        member = "->" if self._container_pointer else "."
+        o = f"if (!{name}{member}empty()) {{\n"
 
         # Check if this is a fixed-size type by seeing if it has a fixed byte count
         num_bytes = self._ti.get_fixed_size_bytes()
@@ -1173,10 +1265,11 @@ class RepeatedTypeInfo(TypeInfo):
             field_id_size = self._ti.calculate_field_id_size()
             # Pre-calculate the total bytes per element
             bytes_per_element = field_id_size + num_bytes
-            o += f"  total_size += {name}.size() * {bytes_per_element};\n"
+            o += f"  total_size += {name}{member}size() * {bytes_per_element};\n"
         else:
             # Other types need the actual value
-            o += f"  for (const auto {'' if self._ti_is_bool else '&'}it : {name}) {{\n"
+            container = self._container(name)
+            o += f"  for (const auto {'' if self._ti_is_bool else '&'}it : {container}) {{\n"
             o += f"    {self._ti.get_size_calculation('it', True)}\n"
             o += "  }\n"
         o += "}"
@@ -1440,6 +1533,11 @@ def build_message_type(
     # Get message ID if it's a service message
     message_id: int | None = get_opt(desc, pb.id)
 
+    # fixed_layout messages encode through a raw cursor into a buffer region
+    # sized for the worst case, see ProtoWriteBuffer::begin_unchecked()
+    fixed_layout = desc.name in FIXED_LAYOUT_MESSAGES
+    max_encoded_size = 0
+
     # Get source direction to determine if we need decode/encode methods
     source = message_source_map[desc.name]
     needs_decode = source in (SOURCE_BOTH, SOURCE_CLIENT)
@@ -1495,6 +1593,15 @@ def build_message_type(
 
         ti = create_field_type_info(field, needs_decode, needs_encode)
 
+        # Pointed-to containers are only read, so they cannot be decoded into
+        if needs_decode and getattr(ti, "container_pointer", None):
+            raise ValueError(
+                f"Message '{desc.name}' uses container_pointer on field "
+                f"'{field.name}' but has source={SOURCE_NAMES[source]}. "
+                f"Container pointers are only supported for SOURCE_SERVER "
+                f"(encode-only) messages."
+            )
+
         # Skip field declarations for fields that are in the base class
         # but include their encode/decode logic
         if field.name not in common_field_names:
@@ -1517,7 +1624,25 @@ def build_message_type(
             if field.options.HasExtension(pb.field_ifdef):
                 field_ifdef = field.options.Extensions[pb.field_ifdef]
 
-            encode.extend(wrap_with_ifdef(ti.encode_content, field_ifdef))
+            if fixed_layout:
+                if ti.unchecked_encode_func is None or ti.repeated:
+                    raise ValueError(
+                        f"Message '{desc.name}' is fixed_layout but field "
+                        f"'{field.name}' has no unchecked encoder"
+                    )
+                if ti.calculate_field_id_size() != 1:
+                    raise ValueError(
+                        f"Message '{desc.name}' is fixed_layout but field "
+                        f"'{field.name}' needs a multi-byte tag"
+                    )
+                # Fields behind an ifdef are always counted so the bound holds
+                # for every build
+                max_encoded_size += ti.get_max_encoded_size()
+                encode.extend(
+                    wrap_with_ifdef(ti.unchecked_encode_content, field_ifdef)
+                )
+            else:
+                encode.extend(wrap_with_ifdef(ti.encode_content, field_ifdef))
             size_calc.extend(
                 wrap_with_ifdef(
                     ti.get_size_calculation(f"this->{ti.field_name}"), field_ifdef
@@ -1601,6 +1726,19 @@ def build_message_type(
         prot = "bool decode_64bit(uint32_t field_id, Proto64Bit value) override;"
         protected_content.insert(0, prot)
 
+    if fixed_layout and needs_encode and encode:
+        # Length prefix of nested fixed_layout messages must fit in a single byte
+        if max_encoded_size >= 128:
+            raise ValueError(
+                f"Message '{desc.name}' is fixed_layout but may encode to "
+                f"{max_encoded_size} bytes (limit 127)"
+            )
+        public_content.append(
+            f"static constexpr uint8_t MAX_ENCODED_SIZE = {max_encoded_size};"
+        )
+        encode.insert(0, "uint8_t *pos = buffer.begin_unchecked(MAX_ENCODED_SIZE);")
+        encode.append("buffer.end_unchecked(pos);")
+
     # Only generate encode method if this message needs encoding and has fields
     if needs_encode and encode:
         o = f"void {desc.name}::encode(ProtoWriteBuffer buffer) const {{"
@@ -1690,6 +1828,9 @@ SOURCE_NAMES = {
 
 RECEIVE_CASES: dict[int, tuple[str, str | None]] = {}
 
+# Names of messages with the fixed_layout option, filled in by main()
+FIXED_LAYOUT_MESSAGES: set[str] = set()
+
 ifdefs: dict[str, str] = {}
 
 
@@ -1965,6 +2106,8 @@ def main() -> None:
 
 #include "proto.h"
 
+#include <set>
+
 namespace esphome {
 namespace api {
 
@@ -2047,6 +2190,10 @@ static inline void append_quoted_string(std::string &out, const StringRef &ref)
 
     mt = file.message_type
 
+    FIXED_LAYOUT_MESSAGES.update(
+        m.name for m in mt if get_opt(m, pb.fixed_layout, False)
+    )
+
     # Collect messages by base class
     base_class_groups = collect_messages_by_base_class(mt)
 
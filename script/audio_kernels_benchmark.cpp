@@ -0,0 +1,109 @@
+// Compares the int16 audio kernels in esphome/components/audio/audio.h with the per-sample loops the mixer and
+// microphone source used before, in samples per microsecond. Built and run by script/audio_kernels_benchmark.
+
+#include "esphome/components/audio/audio.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace esphome::audio;
+
+static void reference_scale(const int16_t *in, int16_t *out, int16_t factor, size_t samples) {
+  for (size_t i = 0; i < samples; i++)
+    out[i] = (int16_t) (((int32_t) in[i] * (int32_t) factor) >> 15);
+}
+
+// The mixer's channel mapping loop, which every layout went through
+static void reference_mix(const int16_t *a, uint8_t a_channels, const int16_t *b, uint8_t b_channels, int16_t *out,
+                          uint8_t out_channels, size_t frames) {
+  for (size_t f = 0; f < frames; f++) {
+    for (uint8_t c = 0; c < out_channels; c++) {
+      int32_t sum = (int32_t) a[f * a_channels + std::min<uint8_t>(c, a_channels - 1)] +
+                    b[f * b_channels + std::min<uint8_t>(c, b_channels - 1)];
+      out[f * out_channels + c] = (int16_t) std::clamp<int32_t>(sum, INT16_MIN, INT16_MAX);
+    }
+  }
+}
+
+// The mixer's copy_frames loop for differing channel counts
+static void reference_copy(const int16_t *in, uint8_t in_channels, int16_t *out, uint8_t out_channels, size_t frames) {
+  for (size_t f = 0; f < frames; f++) {
+    for (uint8_t c = 0; c < out_channels; c++)
+      out[f * out_channels + c] = in[f * in_channels + std::min<uint8_t>(c, in_channels - 1)];
+  }
+}
+
+static void reference_q31_to_q15(const uint8_t *in, int16_t *out, int32_t gain, size_t samples) {
+  for (size_t i = 0; i < samples; i++) {
+    int32_t sample = unpack_audio_sample_to_q31(&in[4 * i], 4) >> 6;
+    sample = std::clamp<int32_t>(sample * gain, -(1 << 25), (1 << 25) - 1) * (1 << 6);
+    pack_q31_as_audio_sample(sample, reinterpret_cast<uint8_t *>(&out[i]), 2);
+  }
+}
+
+static double samples_per_us(size_t samples, int rounds, const std::function<void()> &run) {
+  using clock = std::chrono::steady_clock;
+  auto start = clock::now();
+  for (int r = 0; r < rounds; r++)
+    run();
+  double us = std::chrono::duration<double, std::micro>(clock::now() - start).count();
+  return samples * (double) rounds / us;
+}
+
+static bool report(const char *name, size_t samples, int rounds, const std::function<void()> &reference,
+                   const std::function<void()> &kernel, const std::vector<int16_t> &reference_out,
+                   const std::vector<int16_t> &kernel_out) {
+  reference();
+  kernel();
+  if (reference_out != kernel_out) {
+    printf("%-16s output differs from the reference\n", name);
+    return false;
+  }
+  double before = samples_per_us(samples, rounds, reference);
+  double after = samples_per_us(samples, rounds, kernel);
+  printf("%-16s %8.1f -> %8.1f samples/us (%.2fx)\n", name, before, after, after / before);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  const size_t samples = argc > 1 ? atoi(argv[1]) : 4096;
+  const int rounds = argc > 2 ? atoi(argv[2]) : 2000;
+
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> dist(INT16_MIN, INT16_MAX);
+  std::vector<int16_t> a(samples * 2), b(samples * 2), expected(samples * 2), actual(samples * 2);
+  for (size_t i = 0; i < a.size(); i++) {
+    a[i] = dist(rng);
+    b[i] = dist(rng);
+  }
+  std::vector<uint8_t> q31(samples * 4);
+  for (auto &byte : q31)
+    byte = rng();
+
+  // Channel counts come from the stream info at runtime in the mixer, keep the compiler from specializing on them
+  volatile uint8_t mono = 1;
+  volatile uint8_t stereo = 2;
+
+  bool ok = true;
+  // -6 dB, a typical ducking step
+  ok &= report(
+      "scale", samples, rounds, [&] { reference_scale(a.data(), expected.data(), 16423, samples); },
+      [&] { scale_audio_samples(a.data(), actual.data(), 16423, samples); }, expected, actual);
+  ok &= report(
+      "mix stereo", samples * 2, rounds,
+      [&] { reference_mix(a.data(), stereo, b.data(), stereo, expected.data(), stereo, samples); },
+      [&] { add_audio_samples(a.data(), b.data(), actual.data(), samples * 2); }, expected, actual);
+  ok &= report(
+      "mono to stereo", samples * 2, rounds, [&] { reference_copy(a.data(), mono, expected.data(), stereo, samples); },
+      [&] { mono_to_stereo_samples(a.data(), actual.data(), samples); }, expected, actual);
+  ok &= report(
+      "q31 to q15 x4", samples, rounds, [&] { reference_q31_to_q15(q31.data(), expected.data(), 4, samples); },
+      [&] { q31_to_q15_audio_samples(q31.data(), actual.data(), 4, samples); }, expected, actual);
+  return ok ? 0 : 1;
+}
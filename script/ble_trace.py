@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""Capture and analyze BLE advertisement traces from a bluetooth_proxy node.
+
+capture subscribes to the raw advertisements a bluetooth_proxy forwards over the
+native API and writes them to a trace file. stats replays a trace and prints
+advertisements per second, distinct addresses, payload sizes and how many
+advertisements the bluetooth_proxy advertisement_dedup option would suppress
+with the given window and rssi_threshold.
+
+Trace format: the magic b"ESPBLE01", then one record per advertisement:
+uint32 milliseconds since the start of the capture, uint64 address, int8 RSSI,
+uint8 address type, uint8 data length (all little endian) and the data
+(advertisement followed by scan response).
+
+Example:
+    script/ble_trace.py capture 192.168.1.50 --seconds 60 trace.bin
+    script/ble_trace.py stats trace.bin --window 10 --rssi-threshold 5
+"""
+
+import argparse
+import asyncio
+from collections import Counter
+from pathlib import Path
+import struct
+import sys
+import time
+import zlib
+
+MAGIC = b"ESPBLE01"
+RECORD = struct.Struct("<IQbBB")
+
+
+def read_trace(path: Path):
+    data = path.read_bytes()
+    if not data.startswith(MAGIC):
+        raise ValueError(f"{path} is not a BLE trace")
+    pos = len(MAGIC)
+    while pos + RECORD.size <= len(data):
+        offset, address, rssi, address_type, length = RECORD.unpack_from(data, pos)
+        pos += RECORD.size
+        yield offset, address, rssi, address_type, data[pos : pos + length]
+        pos += length
+
+
+async def capture(args: argparse.Namespace) -> int:
+    from aioesphomeapi import APIClient
+
+    cli = APIClient(
+        args.host, args.port, args.password, noise_psk=args.noise_psk or None
+    )
+    await cli.connect(login=True)
+    count = 0
+    start = time.monotonic()
+    with open(args.output, "wb") as out:
+        out.write(MAGIC)
+
+        def on_advertisements(advertisements) -> None:
+            nonlocal count
+            offset = int((time.monotonic() - start) * 1000)
+            for adv in advertisements:
+                data = bytes(adv.data)
+                out.write(
+                    RECORD.pack(
+                        offset, adv.address, adv.rssi, adv.address_type, len(data)
+                    )
+                )
+                out.write(data)
+                count += 1
+
+        unsubscribe = cli.subscribe_bluetooth_le_raw_advertisements(on_advertisements)
+        if asyncio.iscoroutine(unsubscribe):
+            unsubscribe = await unsubscribe
+        try:
+            await asyncio.sleep(args.seconds)
+        finally:
+            unsubscribe()
+            await cli.disconnect()
+    print(f"Captured {count} advertisements in {args.seconds} s to {args.output}")
+    return 0
+
+
+def stats(args: argparse.Namespace) -> int:
+    records = list(read_trace(args.trace))
+    if not records:
+        print("Trace is empty")
+        return 1
+
+    duration = max(records[-1][0] - records[0][0], 1) / 1000
+    addresses = Counter(record[1] for record in records)
+    sizes = [len(record[4]) for record in records]
+
+    # Same rule as the bluetooth_proxy advertisement_dedup option
+    window_ms = args.window * 1000
+    forwarded: dict[int, tuple[int, int, int]] = {}
+    suppressed = 0
+    for offset, address, rssi, address_type, data in records:
+        payload_hash = zlib.crc32(bytes([address_type]) + data)
+        last = forwarded.get(address)
+        if (
+            last is not None
+            and last[0] == payload_hash
+            and offset - last[1] < window_ms
+            and (args.rssi_threshold == 0 or abs(rssi - last[2]) < args.rssi_threshold)
+        ):
+            suppressed += 1
+            continue
+        forwarded[address] = (payload_hash, offset, rssi)
+
+    print(f"Advertisements:      {len(records)} in {duration:.1f} s")
+    print(f"Per second:          {len(records) / duration:.1f}")
+    print(f"Distinct addresses:  {len(addresses)}")
+    print(f"Payload bytes:       avg {sum(sizes) / len(sizes):.1f}, max {max(sizes)}")
+    print(
+        f"Dedup would drop:    {suppressed} ({100 * suppressed / len(records):.1f}%)"
+        f" with window {args.window} s, rssi_threshold {args.rssi_threshold}"
+    )
+    print("Busiest addresses:")
+    for address, count in addresses.most_common(args.top):
+        print(f"  {address:012X}  {count / duration:6.1f}/s")
+    return 0
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    cap = sub.add_parser("capture", help="record advertisements from a device")
+    cap.add_argument("host")
+    cap.add_argument("output", type=Path)
+    cap.add_argument("--port", type=int, default=6053)
+    cap.add_argument("--password", default="")
+    cap.add_argument("--noise-psk", default="")
+    cap.add_argument("--seconds", type=float, default=60)
+
+    st = sub.add_parser("stats", help="analyze a trace")
+    st.add_argument("trace", type=Path)
+    st.add_argument("--window", type=float, default=10)
+    st.add_argument("--rssi-threshold", type=int, default=5)
+    st.add_argument("--top", type=int, default=10)
+
+    args = parser.parse_args()
+    if args.command == "capture":
+        return asyncio.run(capture(args))
+    return stats(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
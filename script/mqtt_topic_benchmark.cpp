@@ -0,0 +1,84 @@
+// Compares MQTT topic dispatch through MQTTTopicTrie with the linear topic_match() scan.
+// Built and run by script/mqtt_topic_benchmark.
+
+#include "esphome/components/mqtt/mqtt_topic_trie.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using esphome::mqtt::MQTTTopicTrie;
+using esphome::mqtt::topic_match;
+
+int main(int argc, char **argv) {
+  const int components = argc > 1 ? atoi(argv[1]) : 150;
+  const int rounds = argc > 2 ? atoi(argv[2]) : 2000;
+
+  // Command topics like a node with many entities has, plus a few wildcard mqtt_subscribe filters
+  std::vector<std::string> filters;
+  for (int i = 0; i < components; i++)
+    filters.push_back("livingroom/switch/relay_" + std::to_string(i) + "/command");
+  filters.emplace_back("homeassistant/status");
+  filters.emplace_back("zigbee2mqtt/+/state");
+  filters.emplace_back("livingroom/debug/#");
+
+  std::vector<std::string> topics;
+  for (int i = 0; i < components; i += 7)
+    topics.push_back("livingroom/switch/relay_" + std::to_string(i) + "/command");
+  topics.emplace_back("homeassistant/status");
+  topics.emplace_back("zigbee2mqtt/kitchen_sensor/state");
+  topics.emplace_back("livingroom/debug/heap/free");
+  topics.emplace_back("unrelated/topic/from/another/node");
+  topics.emplace_back("$SYS/broker/uptime");
+
+  MQTTTopicTrie trie;
+  for (size_t i = 0; i < filters.size(); i++)
+    trie.insert(filters[i].c_str(), i);
+
+  std::vector<uint16_t> linear_ids;
+  std::vector<uint16_t> trie_ids;
+  for (const auto &topic : topics) {
+    linear_ids.clear();
+    for (size_t i = 0; i < filters.size(); i++) {
+      if (topic_match(topic.c_str(), filters[i].c_str()))
+        linear_ids.push_back(i);
+    }
+    trie_ids.clear();
+    trie.match(topic.c_str(), trie_ids);
+    std::sort(trie_ids.begin(), trie_ids.end());
+    if (linear_ids != trie_ids) {
+      printf("Mismatch for topic '%s'\n", topic.c_str());
+      return 1;
+    }
+  }
+
+  using clock = std::chrono::steady_clock;
+  size_t matches = 0;
+  auto start = clock::now();
+  for (int r = 0; r < rounds; r++) {
+    for (const auto &topic : topics) {
+      for (const auto &filter : filters)
+        matches += topic_match(topic.c_str(), filter.c_str());
+    }
+  }
+  double linear_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+  start = clock::now();
+  for (int r = 0; r < rounds; r++) {
+    for (const auto &topic : topics) {
+      trie_ids.clear();
+      trie.match(topic.c_str(), trie_ids);
+      matches += trie_ids.size();
+    }
+  }
+  double trie_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+  const double messages = static_cast<double>(rounds) * topics.size();
+  printf("%zu subscriptions, %zu matches\n", filters.size(), matches / 2);
+  printf("linear: %8.0f ns/message\n", linear_ns / messages);
+  printf("trie:   %8.0f ns/message\n", trie_ns / messages);
+  return 0;
+}
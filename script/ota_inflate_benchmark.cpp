@@ -0,0 +1,75 @@
+// Decompresses a gzip file with ota::GzipInflater, fed in pieces like an OTA upload, and compares the output with
+// the original. Built and run by script/ota_inflate_benchmark.
+
+#include "esphome/components/ota/gzip_inflater.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using esphome::ota::GzipInflater;
+
+static std::vector<uint8_t> read_file(const char *path) {
+  std::ifstream file(path, std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// Returns the seconds it took, or a negative value if the output doesn't match
+static double inflate(const std::vector<uint8_t> &compressed, const std::vector<uint8_t> &expected, size_t piece) {
+  GzipInflater inflater;
+  if (!inflater.init())
+    return -1;
+  std::vector<uint8_t> output;
+  output.reserve(expected.size());
+  inflater.set_sink([&output](uint8_t *data, size_t len) {
+    output.insert(output.end(), data, data + len);
+    return true;
+  });
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t pos = 0; pos < compressed.size(); pos += piece) {
+    const size_t len = std::min(piece, compressed.size() - pos);
+    if (inflater.feed(compressed.data() + pos, len) == GzipInflater::STATUS_ERROR)
+      return -1;
+  }
+  if (inflater.finish() != GzipInflater::STATUS_DONE)
+    return -1;
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  if (output != expected)
+    return -1;
+  return elapsed.count();
+}
+
+int main(int argc, char **argv) {
+  if (argc != 3) {
+    fprintf(stderr, "Usage: %s original compressed\n", argv[0]);
+    return 1;
+  }
+  const std::vector<uint8_t> original = read_file(argv[1]);
+  const std::vector<uint8_t> compressed = read_file(argv[2]);
+  printf("%zu bytes compressed to %zu (%.1f%%)\n", original.size(), compressed.size(),
+         original.empty() ? 100.0 : 100.0 * compressed.size() / original.size());
+
+  // 1024 is the piece size of the esphome OTA platform, the others exercise steps split between pieces
+  for (size_t piece : {1, 7, 1024, 8192}) {
+    const double seconds = inflate(compressed, original, piece);
+    if (seconds < 0) {
+      printf("pieces of %5zu: output mismatch\n", piece);
+      return 1;
+    }
+    printf("pieces of %5zu bytes: %7.1f MB/s of output\n", piece, original.size() / seconds / 1e6);
+  }
+
+  // A damaged stream has to fail, not produce a different image
+  std::vector<uint8_t> damaged = compressed;
+  damaged[damaged.size() / 2] ^= 0x10;
+  if (inflate(damaged, original, 1024) >= 0) {
+    printf("damaged stream not detected\n");
+    return 1;
+  }
+  printf("damaged stream detected\n");
+  return 0;
+}
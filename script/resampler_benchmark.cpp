@@ -0,0 +1,131 @@
+// Measures esphome::audio::PolyphaseResampler for common sample rate conversions: the SNR of a passband tone, how
+// much of a tone above the target Nyquist frequency aliases back, and the throughput in output samples per
+// microsecond. Built and run by script/resampler_benchmark.
+
+#include "esphome/components/audio/audio_polyphase_resampler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using esphome::audio::PolyphaseResampler;
+
+static const double AMPLITUDE = 16000.0;
+
+static std::vector<int16_t> tone(uint32_t sample_rate, double frequency, uint32_t frames, uint8_t channels) {
+  std::vector<int16_t> samples(frames * channels);
+  for (uint32_t i = 0; i < frames; i++) {
+    for (uint8_t c = 0; c < channels; c++)
+      samples[i * channels + c] = (int16_t) std::lround(AMPLITUDE * std::sin(2 * M_PI * frequency * i / sample_rate));
+  }
+  return samples;
+}
+
+// Resamples in chunks like AudioResampler, carrying the unused frames over to the next call
+static std::vector<int16_t> run(PolyphaseResampler &resampler, const std::vector<int16_t> &input, uint8_t channels) {
+  const uint32_t chunk = 1024;
+  std::vector<int16_t> output;
+  std::vector<int16_t> out_chunk(chunk * 4 * channels);
+  std::vector<int16_t> pending;
+  size_t position = 0;
+  while (position < input.size()) {
+    size_t take = std::min<size_t>(chunk * channels, input.size() - position);
+    pending.insert(pending.end(), input.begin() + position, input.begin() + position + take);
+    position += take;
+    auto results = resampler.resample(pending.data(), pending.size() / channels, out_chunk.data(), chunk * 4);
+    output.insert(output.end(), out_chunk.begin(), out_chunk.begin() + results.frames_generated * channels);
+    pending.erase(pending.begin(), pending.begin() + results.frames_used * channels);
+  }
+  return output;
+}
+
+// Fits the output to a sine of the expected frequency (any phase) and returns signal to residual in dB
+static double snr_db(const std::vector<int16_t> &output, uint8_t channels, uint32_t sample_rate, double frequency,
+                     uint32_t skip) {
+  double ss = 0, sc = 0, cc = 0, ys = 0, yc = 0;
+  const size_t frames = output.size() / channels;
+  for (size_t i = skip; i < frames; i++) {
+    double s = std::sin(2 * M_PI * frequency * i / sample_rate), c = std::cos(2 * M_PI * frequency * i / sample_rate);
+    double y = output[i * channels];
+    ss += s * s;
+    sc += s * c;
+    cc += c * c;
+    ys += y * s;
+    yc += y * c;
+  }
+  double det = ss * cc - sc * sc;
+  double a = (ys * cc - yc * sc) / det, b = (yc * ss - ys * sc) / det;
+  double signal = 0, noise = 0;
+  for (size_t i = skip; i < frames; i++) {
+    double angle = 2 * M_PI * frequency * i / sample_rate;
+    double fit = a * std::sin(angle) + b * std::cos(angle);
+    double err = output[i * channels] - fit;
+    signal += fit * fit;
+    noise += err * err;
+  }
+  return 10 * std::log10(signal / std::max(noise, 1e-9));
+}
+
+static double level_db(const std::vector<int16_t> &output, uint8_t channels, uint32_t skip) {
+  double sum = 0;
+  size_t frames = output.size() / channels;
+  for (size_t i = skip; i < frames; i++)
+    sum += (double) output[i * channels] * output[i * channels];
+  double rms = std::sqrt(sum / std::max<size_t>(frames - skip, 1));
+  return 20 * std::log10(std::max(rms, 1e-3) / (AMPLITUDE / std::sqrt(2.0)));
+}
+
+int main(int argc, char **argv) {
+  const uint16_t taps = argc > 1 ? atoi(argv[1]) : 16;
+  const double seconds = argc > 2 ? atof(argv[2]) : 2.0;
+
+  struct Conversion {
+    uint32_t source;
+    uint32_t target;
+    uint8_t channels;
+  };
+  const Conversion conversions[] = {
+      {48000, 16000, 1}, {44100, 48000, 2}, {48000, 44100, 2}, {16000, 48000, 1}, {22050, 48000, 2}, {32000, 16000, 1},
+  };
+
+  printf("%-18s %5s %8s %10s %12s\n", "conversion", "taps", "SNR dB", "alias dB", "samples/us");
+  for (const auto &conversion : conversions) {
+    if (!PolyphaseResampler::is_supported(conversion.source, conversion.target, taps)) {
+      printf("%6u -> %6u    not supported\n", conversion.source, conversion.target);
+      continue;
+    }
+    const uint32_t frames = conversion.source * seconds;
+    const uint32_t skip = conversion.target / 100;  // Ignore the filter's start up
+
+    PolyphaseResampler resampler;
+    resampler.initialize(conversion.source, conversion.target, conversion.channels, taps, 0);
+    auto passband = run(resampler, tone(conversion.source, 1000, frames, conversion.channels), conversion.channels);
+    double snr = snr_db(passband, conversion.channels, conversion.target, 1000, skip);
+
+    double alias = NAN;
+    const uint32_t nyquist = std::min(conversion.source, conversion.target) / 2;
+    if (conversion.target < conversion.source) {
+      // A tone between the target and source Nyquist frequencies must be filtered out, not folded back
+      resampler.initialize(conversion.source, conversion.target, conversion.channels, taps, 0);
+      double frequency = (nyquist + conversion.source / 2.0) / 2;
+      auto stopband =
+          run(resampler, tone(conversion.source, frequency, frames, conversion.channels), conversion.channels);
+      alias = level_db(stopband, conversion.channels, skip);
+    }
+
+    resampler.initialize(conversion.source, conversion.target, conversion.channels, taps, 0);
+    auto input = tone(conversion.source, 1000, frames, conversion.channels);
+    std::vector<int16_t> output((size_t) (frames * (double) conversion.target / conversion.source + 4) *
+                                conversion.channels);
+    auto start = std::chrono::steady_clock::now();
+    auto results = resampler.resample(input.data(), frames, output.data(), output.size() / conversion.channels);
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%6u -> %6u %2uch %5u %8.1f %10.1f %12.1f\n", conversion.source, conversion.target, conversion.channels,
+           resampler.get_taps(), snr, alias, results.frames_generated * conversion.channels / us);
+  }
+  return 0;
+}
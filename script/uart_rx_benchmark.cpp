@@ -0,0 +1,196 @@
+// Compares parsing a 921600 baud stream read with read() per byte against UARTComponent::read_available() chunks.
+// Built and run by script/uart_rx_benchmark.
+
+#include "esphome/components/uart/uart_component.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace esphome {
+// The benchmark only needs the parts of the core that UARTComponent calls
+uint32_t millis() { return 0; }
+void yield() {}
+void esp_log_printf_(int level, const char *tag, int line, const char *format, ...) {}
+}  // namespace esphome
+
+using esphome::uart::UARTComponent;
+
+static const uint32_t BAUD_RATE = 921600;
+static const uint32_t LOOP_INTERVAL_MS = 16;
+static const size_t RX_BUFFER_SIZE = 2048;
+
+// Receives into a ring buffer like the ESP8266 software serial does
+class RingUART : public UARTComponent {
+ public:
+  void receive(const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+      this->ring_[this->in_] = data[i];
+      this->in_ = (this->in_ + 1) % RX_BUFFER_SIZE;
+    }
+  }
+
+  void write_array(const uint8_t *data, size_t len) override {}
+  bool peek_byte(uint8_t *data) override {
+    if (this->available() == 0)
+      return false;
+    *data = this->ring_[this->out_];
+    return true;
+  }
+  bool read_array(uint8_t *data, size_t len) override {
+    if (!this->check_read_timeout_(len))
+      return false;
+    const size_t first = std::min(len, RX_BUFFER_SIZE - this->out_);
+    memcpy(data, &this->ring_[this->out_], first);
+    memcpy(data + first, this->ring_, len - first);
+    this->out_ = (this->out_ + len) % RX_BUFFER_SIZE;
+    return true;
+  }
+  int available() override { return (this->in_ + RX_BUFFER_SIZE - this->out_) % RX_BUFFER_SIZE; }
+  void flush() override {}
+
+ protected:
+  void check_logger_conflict() override {}
+
+  uint8_t ring_[RX_BUFFER_SIZE];
+  size_t in_{0};
+  size_t out_{0};
+};
+
+// Finds frames ending in 0x55 0xCC like the ld2450 target reports
+struct RadarParser {
+  void feed(uint8_t c) {
+    this->buf[this->pos++] = c;
+    if (this->pos >= 2 && this->buf[this->pos - 2] == 0x55 && this->buf[this->pos - 1] == 0xCC) {
+      this->frames++;
+      this->pos = 0;
+    } else if (this->pos == sizeof(this->buf)) {
+      this->pos = 0;
+    }
+  }
+  uint8_t buf[41];
+  size_t pos{0};
+  uint32_t frames{0};
+};
+
+// Collects telegrams from '/' to the line after '!' like dsmr does
+struct TelegramParser {
+  void feed(uint8_t c) {
+    if (c == '/') {
+      this->len = 0;
+      this->header = true;
+      this->footer = false;
+    }
+    if (!this->header || this->len == sizeof(this->buf))
+      return;
+    this->buf[this->len++] = c;
+    if (c == '!') {
+      this->footer = true;
+    } else if (this->footer && c == '\n') {
+      this->telegrams++;
+      this->header = false;
+    }
+  }
+  char buf[1500];
+  size_t len{0};
+  bool header{false};
+  bool footer{false};
+  uint32_t telegrams{0};
+};
+
+static std::vector<uint8_t> radar_stream() {
+  std::vector<uint8_t> frame = {0xAA, 0xFF, 0x03, 0x00};
+  for (int i = 0; i < 24; i++)
+    frame.push_back(uint8_t(i * 37));
+  frame.push_back(0x55);
+  frame.push_back(0xCC);
+  return frame;
+}
+
+static std::vector<uint8_t> telegram_stream() {
+  std::string telegram = "/ISK5\\2M550T-1012\r\n\r\n1-3:0.2.8(50)\r\n0-0:1.0.0(200408063501S)\r\n";
+  for (int i = 0; i < 30; i++)
+    telegram += "1-0:" + std::to_string(i) + ".7.0(00.123*kW)\r\n";
+  telegram += "!7A3E\r\n";
+  return std::vector<uint8_t>(telegram.begin(), telegram.end());
+}
+
+template<typename Parser, typename Read> static void run(const char *name, const std::vector<uint8_t> &pattern,
+                                                          int seconds, Read read) {
+  const size_t per_loop = BAUD_RATE / 10 * LOOP_INTERVAL_MS / 1000;
+  const size_t loops = size_t(seconds) * 1000 / LOOP_INTERVAL_MS;
+  std::vector<uint8_t> chunk(per_loop);
+  size_t pattern_pos = 0;
+
+  RingUART uart;
+  Parser parser;
+  double us = 0;
+  for (size_t loop = 0; loop < loops; loop++) {
+    for (auto &c : chunk) {
+      c = pattern[pattern_pos];
+      pattern_pos = (pattern_pos + 1) % pattern.size();
+    }
+    uart.receive(chunk.data(), chunk.size());
+    auto start = std::chrono::steady_clock::now();
+    read(uart, parser);
+    us += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  }
+  const double bytes = double(per_loop) * loops;
+  printf("%-22s %10.3f ns/byte %8.3f %% of a core\n", name, us * 1000 / bytes, us / (seconds * 1e4));
+}
+
+template<typename Parser> static void per_byte(RingUART &uart, Parser &parser) {
+  uint8_t c;
+  while (uart.available()) {
+    if (uart.read_byte(&c))
+      parser.feed(c);
+  }
+}
+
+template<typename Parser> static void chunked(RingUART &uart, Parser &parser) {
+  uint8_t buf[64];
+  size_t len;
+  while ((len = uart.read_available(buf, sizeof(buf))) > 0) {
+    for (size_t i = 0; i < len; i++)
+      parser.feed(buf[i]);
+  }
+}
+
+template<typename Parser>
+static uint32_t count(const std::vector<uint8_t> &pattern, void (*read)(RingUART &, Parser &)) {
+  RingUART uart;
+  Parser parser;
+  for (int i = 0; i < 20; i++) {
+    uart.receive(pattern.data(), pattern.size());
+    read(uart, parser);
+  }
+  if constexpr (std::is_same_v<Parser, RadarParser>) {
+    return parser.frames;
+  } else {
+    return parser.telegrams;
+  }
+}
+
+int main(int argc, char **argv) {
+  const int seconds = argc > 1 ? atoi(argv[1]) : 60;
+  const auto radar = radar_stream();
+  const auto telegram = telegram_stream();
+
+  if (count<RadarParser>(radar, per_byte) != count<RadarParser>(radar, chunked) ||
+      count<TelegramParser>(telegram, per_byte) != count<TelegramParser>(telegram, chunked)) {
+    printf("Chunked reads parse a different stream\n");
+    return 1;
+  }
+
+  printf("%d s of a %u baud stream, read every %u ms:\n", seconds, BAUD_RATE, LOOP_INTERVAL_MS);
+  run<RadarParser>("ld2450 read()", radar, seconds, per_byte<RadarParser>);
+  run<RadarParser>("ld2450 read_available", radar, seconds, chunked<RadarParser>);
+  run<TelegramParser>("dsmr read()", telegram, seconds, per_byte<TelegramParser>);
+  run<TelegramParser>("dsmr read_available", telegram, seconds, chunked<TelegramParser>);
+  return 0;
+}
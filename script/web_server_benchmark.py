@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Measure web_server request throughput with concurrent clients.
+
+Runs GET requests against a device from N clients at the same time and prints
+requests per second and latencies. With --upload a firmware file is posted to
+/update while the GET clients are running, which shows if state polling keeps
+flowing during an upload (see the web_server worker_tasks option). The device
+installs that firmware, so use the one it is already running.
+
+Example:
+    script/web_server_benchmark.py 192.168.1.50 --path /sensor/uptime --clients 4
+"""
+
+import argparse
+import asyncio
+from pathlib import Path
+import statistics
+import sys
+import time
+import uuid
+
+from tornado.httpclient import AsyncHTTPClient, HTTPClientError
+
+
+async def get_client(
+    client: AsyncHTTPClient, url: str, end: float, latencies: list[float]
+) -> int:
+    errors = 0
+    while time.monotonic() < end:
+        start = time.monotonic()
+        try:
+            await client.fetch(url, request_timeout=10)
+        except (HTTPClientError, OSError):
+            errors += 1
+            continue
+        latencies.append(time.monotonic() - start)
+    return errors
+
+
+async def upload(client: AsyncHTTPClient, url: str, firmware: Path) -> float:
+    boundary = uuid.uuid4().hex
+    body = (
+        f"--{boundary}\r\n"
+        f'Content-Disposition: form-data; name="update"; filename="{firmware.name}"\r\n'
+        "Content-Type: application/octet-stream\r\n\r\n"
+    ).encode() + firmware.read_bytes() + f"\r\n--{boundary}--\r\n".encode()
+    start = time.monotonic()
+    await client.fetch(
+        url,
+        method="POST",
+        body=body,
+        headers={"Content-Type": f"multipart/form-data; boundary={boundary}"},
+        request_timeout=300,
+    )
+    return time.monotonic() - start
+
+
+async def run(args: argparse.Namespace) -> int:
+    base = f"http://{args.host}:{args.port}"
+    client = AsyncHTTPClient(max_clients=args.clients + 1)
+    latencies: list[float] = []
+    end = time.monotonic() + args.duration
+
+    tasks = [
+        get_client(client, base + args.path, end, latencies)
+        for _ in range(args.clients)
+    ]
+    upload_task = None
+    if args.upload:
+        upload_task = asyncio.ensure_future(
+            upload(client, base + "/update", args.upload)
+        )
+
+    errors = sum(await asyncio.gather(*tasks))
+    if upload_task is not None:
+        print(f"Upload finished in {await upload_task:.1f} s")
+
+    if not latencies:
+        print("No successful requests", file=sys.stderr)
+        return 1
+    latencies.sort()
+    print(f"Clients:  {args.clients}")
+    print(f"Requests: {len(latencies)} ok, {errors} failed")
+    print(f"Rate:     {len(latencies) / args.duration:.1f} req/s")
+    print(
+        f"Latency:  median {statistics.median(latencies) * 1000:.0f} ms, "
+        f"p95 {latencies[int(len(latencies) * 0.95)] * 1000:.0f} ms, "
+        f"max {latencies[-1] * 1000:.0f} ms"
+    )
+    return 0
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host", help="Device address")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--path", default="/", help="URL path to request")
+    parser.add_argument(
+        "--clients", type=int, default=4, help="Concurrent clients"
+    )
+    parser.add_argument("--duration", type=float, default=10.0, help="Seconds")
+    parser.add_argument(
+        "--upload", type=Path, help="Firmware to post to /update during the run"
+    )
+    return asyncio.run(run(parser.parse_args()))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,23 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import CONF_ID, CONF_SENSOR_ID
+
+DEPENDENCIES = ["api"]
+
+benchmark_component_ns = cg.esphome_ns.namespace("benchmark_component")
+BenchmarkComponent = benchmark_component_ns.class_("BenchmarkComponent", cg.Component)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(BenchmarkComponent),
+        cv.Required(CONF_SENSOR_ID): cv.use_id(sensor.Sensor),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    sens = await cg.get_variable(config[CONF_SENSOR_ID])
+    cg.add(var.set_sensor(sens))
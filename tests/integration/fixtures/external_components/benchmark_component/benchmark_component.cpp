@@ -0,0 +1,233 @@
+#include "benchmark_component.h"
+#include "esphome/components/api/api_connection.h"
+#include "esphome/components/api/api_frame_helper_plaintext.h"
+#include "esphome/components/api/api_pb2.h"
+#include "esphome/components/api/proto.h"
+#include "esphome/components/socket/socket.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstring>
+#include <memory>
+
+namespace esphome {
+namespace benchmark_component {
+
+static const char *const TAG = "benchmark";
+// Separate tag so the logger benchmark lines are easy to tell apart from the results
+static const char *const LOG_TAG = "benchmark.log";
+
+static constexpr uint32_t SCHEDULER_ITEMS = 256;
+static constexpr uint32_t CALLBACK_ITERATIONS = 10000;
+static constexpr uint32_t CALLBACK_COUNT = 4;
+static constexpr uint32_t PROTO_ITERATIONS = 10000;
+static constexpr uint32_t FRAME_ITERATIONS = 5000;
+static constexpr uint32_t SENSOR_ITERATIONS = 5000;
+static constexpr uint32_t LOG_ITERATIONS = 1000;
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+/// In-memory socket that hands everything written to it back on read, so a frame helper can talk to itself.
+class LoopbackSocket : public socket::Socket {
+ public:
+  std::unique_ptr<Socket> accept(struct sockaddr *addr, socklen_t *addrlen) override { return nullptr; }
+  int bind(const struct sockaddr *addr, socklen_t addrlen) override { return 0; }
+  int close() override { return 0; }
+#if defined(USE_SOCKET_IMPL_LWIP_SOCKETS) || defined(USE_SOCKET_IMPL_BSD_SOCKETS)
+  int connect(const struct sockaddr *addr, socklen_t addrlen) override { return 0; }
+#endif
+  int shutdown(int how) override { return 0; }
+  int getpeername(struct sockaddr *addr, socklen_t *addrlen) override { return -1; }
+  std::string getpeername() override { return "loopback"; }
+  int getsockname(struct sockaddr *addr, socklen_t *addrlen) override { return -1; }
+  std::string getsockname() override { return "loopback"; }
+  int getsockopt(int level, int optname, void *optval, socklen_t *optlen) override { return -1; }
+  int setsockopt(int level, int optname, const void *optval, socklen_t optlen) override { return 0; }
+  int listen(int backlog) override { return 0; }
+  ssize_t read(void *buf, size_t len) override {
+    size_t avail = this->data_.size() - this->pos_;
+    if (avail == 0) {
+      errno = EWOULDBLOCK;
+      return -1;
+    }
+    size_t n = std::min(len, avail);
+    std::memcpy(buf, this->data_.data() + this->pos_, n);
+    this->pos_ += n;
+    if (this->pos_ == this->data_.size()) {
+      this->data_.clear();
+      this->pos_ = 0;
+    }
+    return n;
+  }
+#ifdef USE_SOCKET_IMPL_BSD_SOCKETS
+  ssize_t recvfrom(void *buf, size_t len, sockaddr *addr, socklen_t *addr_len) override {
+    return this->read(buf, len);
+  }
+#endif
+  ssize_t readv(const struct iovec *iov, int iovcnt) override {
+    ssize_t total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+      ssize_t n = this->read(iov[i].iov_base, iov[i].iov_len);
+      if (n < 0)
+        return total == 0 ? n : total;
+      total += n;
+      if (static_cast<size_t>(n) < iov[i].iov_len)
+        break;
+    }
+    return total;
+  }
+  ssize_t write(const void *buf, size_t len) override {
+    auto *data = static_cast<const uint8_t *>(buf);
+    this->data_.insert(this->data_.end(), data, data + len);
+    return len;
+  }
+  ssize_t writev(const struct iovec *iov, int iovcnt) override {
+    ssize_t total = 0;
+    for (int i = 0; i < iovcnt; i++)
+      total += this->write(iov[i].iov_base, iov[i].iov_len);
+    return total;
+  }
+  ssize_t sendto(const void *buf, size_t len, int flags, const struct sockaddr *to, socklen_t tolen) override {
+    return this->write(buf, len);
+  }
+  int setblocking(bool blocking) override { return 0; }
+
+ protected:
+  std::vector<uint8_t> data_;
+  size_t pos_{0};
+};
+
+}  // namespace
+
+void BenchmarkComponent::setup() {
+  this->timer_names_.reserve(SCHEDULER_ITEMS);
+  for (uint32_t i = 0; i < SCHEDULER_ITEMS; i++)
+    this->timer_names_.push_back(str_sprintf("bench_%" PRIu32, i));
+  ESP_LOGCONFIG(TAG, "BenchmarkComponent setup");
+}
+
+void BenchmarkComponent::run_benchmarks() {
+  ESP_LOGI(TAG, "Running benchmarks");
+  this->reported_ = 0;
+  this->bench_scheduler_();
+  this->bench_callback_manager_();
+  this->bench_proto_encode_();
+  this->bench_plaintext_frame_();
+  this->bench_sensor_filters_();
+  this->bench_logger_();
+  ESP_LOGI(TAG, "BENCHMARKS DONE count=%" PRIu32, this->reported_);
+}
+
+void BenchmarkComponent::report_(const char *name, uint32_t iterations, Clock::duration elapsed) {
+  if (iterations == 0) {
+    ESP_LOGW(TAG, "Benchmark %s didn't run", name);
+    return;
+  }
+  double ns_per_op = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+  ESP_LOGI(TAG, "BENCHMARK {\"name\":\"%s\",\"iterations\":%" PRIu32 ",\"ns_per_op\":%.1f}", name, iterations,
+           ns_per_op);
+  this->reported_++;
+}
+
+void BenchmarkComponent::bench_scheduler_() {
+  auto start = Clock::now();
+  for (uint32_t i = 0; i < SCHEDULER_ITEMS; i++)
+    App.scheduler.set_timeout(this, this->timer_names_[i].c_str(), 60000, [] {});
+  this->report_("scheduler.set_timeout", SCHEDULER_ITEMS, Clock::now() - start);
+
+  start = Clock::now();
+  for (uint32_t i = 0; i < SCHEDULER_ITEMS; i++)
+    App.scheduler.cancel_timeout(this, this->timer_names_[i].c_str());
+  this->report_("scheduler.cancel_timeout", SCHEDULER_ITEMS, Clock::now() - start);
+
+  // Let a batch of timers come due, then time the single call() that runs them
+  this->executed_ = 0;
+  for (uint32_t i = 0; i < SCHEDULER_ITEMS; i++)
+    App.scheduler.set_timeout(this, this->timer_names_[i].c_str(), 1, [this] { this->executed_++; });
+  delay(5);
+  start = Clock::now();
+  App.scheduler.call(millis());
+  this->report_("scheduler.call", this->executed_, Clock::now() - start);
+}
+
+void BenchmarkComponent::bench_callback_manager_() {
+  CallbackManager<void(float)> callbacks;
+  float sink = 0.0f;
+  for (uint32_t i = 0; i < CALLBACK_COUNT; i++)
+    callbacks.add([&sink](float value) { sink += value; });
+
+  auto start = Clock::now();
+  for (uint32_t i = 0; i < CALLBACK_ITERATIONS; i++)
+    callbacks.call(static_cast<float>(i));
+  this->report_("callback_manager.call", CALLBACK_ITERATIONS, Clock::now() - start);
+  ESP_LOGV(TAG, "Callback sink %f", sink);
+}
+
+void BenchmarkComponent::bench_proto_encode_() {
+  api::SensorStateResponse msg;
+  msg.key = 0x12345678;
+  std::vector<uint8_t> buffer;
+  buffer.reserve(api::SensorStateResponse::MAX_ENCODED_SIZE);
+
+  auto start = Clock::now();
+  for (uint32_t i = 0; i < PROTO_ITERATIONS; i++) {
+    msg.state = static_cast<float>(i);
+    buffer.clear();
+    msg.encode(api::ProtoWriteBuffer{&buffer});
+  }
+  this->report_("proto.encode_sensor_state", PROTO_ITERATIONS, Clock::now() - start);
+}
+
+void BenchmarkComponent::bench_plaintext_frame_() {
+  api::ClientInfo client_info{"benchmark", "loopback"};
+  api::APIPlaintextFrameHelper helper(std::make_unique<LoopbackSocket>(), &client_info);
+  if (helper.init() != api::APIError::OK) {
+    ESP_LOGW(TAG, "Plaintext frame helper init failed");
+    return;
+  }
+
+  api::SensorStateResponse msg;
+  msg.key = 0x12345678;
+  std::vector<uint8_t> buffer;
+  api::ReadPacketBuffer packet;
+  uint32_t done = 0;
+
+  auto start = Clock::now();
+  for (; done < FRAME_ITERATIONS; done++) {
+    msg.state = static_cast<float>(done);
+    buffer.clear();
+    buffer.resize(helper.frame_header_padding());
+    msg.encode(api::ProtoWriteBuffer{&buffer});
+    if (helper.write_protobuf_packet(api::SensorStateResponse::MESSAGE_TYPE, api::ProtoWriteBuffer{&buffer}) !=
+            api::APIError::OK ||
+        helper.read_packet(&packet) != api::APIError::OK) {
+      ESP_LOGW(TAG, "Plaintext frame round trip failed after %" PRIu32 " packets", done);
+      break;
+    }
+  }
+  this->report_("api.plaintext_frame_roundtrip", done, Clock::now() - start);
+}
+
+void BenchmarkComponent::bench_sensor_filters_() {
+  auto start = Clock::now();
+  for (uint32_t i = 0; i < SENSOR_ITERATIONS; i++)
+    this->sensor_->publish_state(static_cast<float>(i % 100));
+  this->report_("sensor.publish_filtered", SENSOR_ITERATIONS, Clock::now() - start);
+}
+
+void BenchmarkComponent::bench_logger_() {
+  auto start = Clock::now();
+  for (uint32_t i = 0; i < LOG_ITERATIONS; i++)
+    ESP_LOGD(LOG_TAG, "Line %" PRIu32 " value=%.3f name=%s", i, i * 0.5f, "benchmark");
+  this->report_("logger.format", LOG_ITERATIONS, Clock::now() - start);
+}
+
+}  // namespace benchmark_component
+}  // namespace esphome
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/component.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace benchmark_component {
+
+/** Times hot core primitives on the host and logs one JSON line per benchmark.
+ *
+ * Each result is logged as `BENCHMARK {"name":...,"iterations":...,"ns_per_op":...}` so the integration test can
+ * collect them, followed by `BENCHMARKS DONE` once every benchmark ran.
+ */
+class BenchmarkComponent : public Component {
+ public:
+  void setup() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void set_sensor(sensor::Sensor *sensor) { this->sensor_ = sensor; }
+
+  void run_benchmarks();
+
+ protected:
+  void bench_scheduler_();
+  void bench_callback_manager_();
+  void bench_proto_encode_();
+  void bench_plaintext_frame_();
+  void bench_sensor_filters_();
+  void bench_logger_();
+
+  void report_(const char *name, uint32_t iterations, std::chrono::steady_clock::duration elapsed);
+
+  sensor::Sensor *sensor_{nullptr};
+  // Scheduler items keep the name pointer, so the names have to outlive them
+  std::vector<std::string> timer_names_;
+  uint32_t executed_{0};
+  uint32_t reported_{0};
+};
+
+}  // namespace benchmark_component
+}  // namespace esphome
@@ -19,6 +19,7 @@ CONF_TEST_REDUNDANT_OPERATIONS = "test_redundant_operations"
 CONF_ISR_COMPONENTS = "isr_components"
 CONF_UPDATE_COMPONENTS = "update_components"
 CONF_DISABLE_LOOP_AFTER = "disable_loop_after"
+CONF_BLOCK_FOR = "block_for"
 
 COMPONENT_CONFIG_SCHEMA = cv.Schema(
     {
@@ -26,8 +27,9 @@ COMPONENT_CONFIG_SCHEMA = cv.Schema(
         cv.Required(CONF_NAME): cv.string,
         cv.Optional(CONF_DISABLE_AFTER, default=0): cv.int_,
         cv.Optional(CONF_TEST_REDUNDANT_OPERATIONS, default=False): cv.boolean,
+        cv.Optional(CONF_BLOCK_FOR, default="0ms"): cv.positive_time_period_milliseconds,
     }
-)
+).extend(cv.COMPONENT_SCHEMA)
 
 ISR_COMPONENT_CONFIG_SCHEMA = cv.Schema(
     {
@@ -105,6 +107,7 @@ async def to_code(config):
                 comp_config[CONF_TEST_REDUNDANT_OPERATIONS]
             )
         )
+        cg.add(var.set_block_for(comp_config[CONF_BLOCK_FOR]))
 
     # Create ISR test components
     for isr_config in config.get(CONF_ISR_COMPONENTS, []):
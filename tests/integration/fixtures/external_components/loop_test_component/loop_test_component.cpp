@@ -9,6 +9,10 @@ void LoopTestComponent::loop() {
   this->loop_count_++;
   ESP_LOGI(TAG, "[%s] Loop count: %d", this->name_.c_str(), this->loop_count_);
 
+  // Simulate a slow component
+  if (this->block_for_ > 0)
+    delay(this->block_for_);
+
   // Test self-disable after specified count
   if (this->disable_after_ > 0 && this->loop_count_ == this->disable_after_) {
     ESP_LOGI(TAG, "[%s] Disabling self after %d loops", this->name_.c_str(), this->disable_after_);
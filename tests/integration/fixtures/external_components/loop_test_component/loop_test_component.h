@@ -16,6 +16,7 @@ class LoopTestComponent : public Component {
   void set_name(const std::string &name) { this->name_ = name; }
   void set_disable_after(int count) { this->disable_after_ = count; }
   void set_test_redundant_operations(bool test) { this->test_redundant_operations_ = test; }
+  void set_block_for(uint32_t block_for) { this->block_for_ = block_for; }
 
   void setup() override;
   void loop() override;
@@ -32,6 +33,7 @@ class LoopTestComponent : public Component {
   std::string name_;
   int loop_count_{0};
   int disable_after_{0};
+  uint32_t block_for_{0};
   bool test_redundant_operations_{false};
 };
 
@@ -0,0 +1,68 @@
+"""Integration test for sharing encoded state messages between API connections."""
+
+from __future__ import annotations
+
+import asyncio
+
+from aioesphomeapi import EntityState, SensorState, TextSensorState
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+CLIENT_COUNT = 3
+UPDATES_PER_CLIENT = 20
+
+
+@pytest.mark.asyncio
+async def test_api_state_fanout(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that every connection receives the current state when encodes are shared."""
+    loop = asyncio.get_running_loop()
+    async with (
+        run_compiled(yaml_config),
+        api_client_connected() as client1,
+        api_client_connected() as client2,
+        api_client_connected() as client3,
+    ):
+        clients = [client1, client2, client3]
+        sensor_values: list[list[float]] = [[] for _ in range(CLIENT_COUNT)]
+        text_values: list[list[str]] = [[] for _ in range(CLIENT_COUNT)]
+        done = [loop.create_future() for _ in range(CLIENT_COUNT)]
+
+        def make_callback(index: int):
+            def on_state(state: EntityState) -> None:
+                if isinstance(state, SensorState) and not state.missing_state:
+                    sensor_values[index].append(state.state)
+                elif isinstance(state, TextSensorState) and not state.missing_state:
+                    text_values[index].append(state.state)
+                if (
+                    len(sensor_values[index]) >= UPDATES_PER_CLIENT
+                    and len(text_values[index]) >= UPDATES_PER_CLIENT
+                    and not done[index].done()
+                ):
+                    done[index].set_result(True)
+
+            return on_state
+
+        for index, client in enumerate(clients):
+            client.subscribe_states(make_callback(index))
+
+        try:
+            await asyncio.wait_for(asyncio.gather(*done), timeout=10.0)
+        except TimeoutError:
+            pytest.fail(
+                f"Not all clients received {UPDATES_PER_CLIENT} updates: "
+                f"sensor={[len(v) for v in sensor_values]}, "
+                f"text={[len(v) for v in text_values]}"
+            )
+
+    for index in range(CLIENT_COUNT):
+        # A stale shared payload would show up as a value going backwards
+        sensors = sensor_values[index]
+        assert sensors == sorted(sensors), f"Client {index} sensor values: {sensors}"
+        texts = [int(value) for value in text_values[index]]
+        assert texts == sorted(texts), f"Client {index} text values: {texts}"
+
@@ -0,0 +1,66 @@
+"""Integration test for the boot profiler report."""
+
+from __future__ import annotations
+
+import asyncio
+import re
+
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_boot_profiler(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that the boot profile is logged once the first API client connects."""
+    loop = asyncio.get_running_loop()
+    report_future: asyncio.Future[re.Match[str]] = loop.create_future()
+    critical_path_future: asyncio.Future[None] = loop.create_future()
+    timeline: list[str] = []
+    report_count = 0
+
+    report_pattern = re.compile(
+        r"Boot profile: setup\(\) finished after (\d+)ms, ready after (\d+)ms"
+    )
+    timeline_pattern = re.compile(r"^\s+\d+ms\s+[\d.]+ms\s+\d+ms\s+(\S+)")
+
+    def on_log_line(line: str) -> None:
+        nonlocal report_count
+        # Strip the log prefix so the timeline columns can be matched
+        message = line.split("]: ", 1)[-1]
+        if match := report_pattern.search(line):
+            report_count += 1
+            if not report_future.done():
+                report_future.set_result(match)
+        elif match := timeline_pattern.match(message):
+            timeline.append(match.group(1))
+        elif "Top 5 components account for" in line and not critical_path_future.done():
+            critical_path_future.set_result(None)
+
+    async with (
+        run_compiled(yaml_config, line_callback=on_log_line),
+        api_client_connected() as client,
+    ):
+        device_info = await client.device_info()
+        assert device_info is not None
+        assert device_info.name == "boot-profiler-test"
+
+        try:
+            match = await asyncio.wait_for(report_future, timeout=5.0)
+            await asyncio.wait_for(critical_path_future, timeout=5.0)
+        except TimeoutError:
+            pytest.fail("Boot profile was not logged after the API client connected")
+
+        setup_ms, ready_ms = int(match.group(1)), int(match.group(2))
+        assert ready_ms >= setup_ms
+
+        # The report is only logged once
+        await asyncio.sleep(0.5)
+        assert report_count == 1
+
+    assert "api" in timeline
+    assert "template.sensor" in timeline
@@ -0,0 +1,99 @@
+"""Micro-benchmarks for core primitives on the host platform.
+
+The device logs one JSON result per benchmark. Set ESPHOME_BENCHMARK_JSON to a
+file path to also write all results there, sorted by name, for comparing runs.
+"""
+
+from __future__ import annotations
+
+import asyncio
+import json
+import os
+from pathlib import Path
+import re
+
+from aioesphomeapi import UserService
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+EXPECTED_BENCHMARKS = {
+    "scheduler.set_timeout",
+    "scheduler.cancel_timeout",
+    "scheduler.call",
+    "callback_manager.call",
+    "proto.encode_sensor_state",
+    "api.plaintext_frame_roundtrip",
+    "sensor.publish_filtered",
+    "logger.format",
+}
+
+RESULT_RE = re.compile(r"BENCHMARK (\{[^}]*\})")
+DONE_RE = re.compile(r"BENCHMARKS DONE count=(\d+)")
+
+
+@pytest.mark.asyncio
+async def test_host_benchmarks(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Run the benchmark suite and check every benchmark reported a result."""
+    external_components_path = str(
+        Path(__file__).parent / "fixtures" / "external_components"
+    )
+    yaml_config = yaml_config.replace(
+        "EXTERNAL_COMPONENT_PATH", external_components_path
+    )
+
+    loop = asyncio.get_running_loop()
+    done_future: asyncio.Future[int] = loop.create_future()
+    results: dict[str, dict[str, float | int | str]] = {}
+
+    def on_log_line(line: str) -> None:
+        if match := RESULT_RE.search(line):
+            result = json.loads(match.group(1))
+            results[result["name"]] = result
+        elif (match := DONE_RE.search(line)) and not done_future.done():
+            done_future.set_result(int(match.group(1)))
+
+    async with (
+        run_compiled(yaml_config, line_callback=on_log_line),
+        api_client_connected() as client,
+    ):
+        device_info = await client.device_info()
+        assert device_info is not None
+        assert device_info.name == "host-benchmarks"
+
+        _, services = await asyncio.wait_for(
+            client.list_entities_services(), timeout=5.0
+        )
+        run_service: UserService | None = next(
+            (s for s in services if s.name == "run_benchmarks"), None
+        )
+        assert run_service is not None, "run_benchmarks service not found"
+
+        client.execute_service(run_service, {})
+
+        try:
+            count = await asyncio.wait_for(done_future, timeout=30.0)
+        except TimeoutError:
+            pytest.fail(f"Benchmarks did not finish, got results for {sorted(results)}")
+
+    assert set(results) == EXPECTED_BENCHMARKS, (
+        f"Missing: {EXPECTED_BENCHMARKS - set(results)}, "
+        f"unexpected: {set(results) - EXPECTED_BENCHMARKS}"
+    )
+    assert count == len(EXPECTED_BENCHMARKS)
+    for name, result in results.items():
+        assert result["iterations"] > 0, f"{name} ran no iterations"
+        assert result["ns_per_op"] > 0, f"{name} reported no time"
+
+    if output := os.environ.get("ESPHOME_BENCHMARK_JSON"):
+        Path(output).write_text(
+            json.dumps(
+                [results[name] for name in sorted(results)], indent=2, sort_keys=True
+            )
+            + "\n",
+            encoding="utf-8",
+        )
@@ -0,0 +1,45 @@
+"""Integration test for the API adaptive_batch_delay setting."""
+
+from __future__ import annotations
+
+import asyncio
+
+from aioesphomeapi import EntityState, SensorState
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_host_mode_adaptive_batch_delay(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that the batch delay shrinks below batch_delay on an idle link."""
+    async with run_compiled(yaml_config), api_client_connected() as client:
+        device_info = await client.device_info()
+        assert device_info is not None
+        assert device_info.name == "host-adaptive-batch-delay"
+
+        values: list[float] = []
+
+        def on_state(state: EntityState) -> None:
+            if isinstance(state, SensorState) and not state.missing_state:
+                values.append(state.state)
+
+        client.subscribe_states(on_state)
+
+        # Let the delay settle towards min_delay, then count updates
+        await asyncio.sleep(0.5)
+        start_count = len(values)
+        await asyncio.sleep(1.5)
+        received = len(values) - start_count
+
+        # The sensor updates every 50ms. With a fixed 100ms batch delay, updates to the
+        # same entity collapse into one per batch (~15 in 1.5s). Once the link is
+        # idle, the adaptive delay drops to 0ms and nearly every update is sent.
+        assert received >= 20, f"Only {received} updates received in 1.5s"
+
+        # Values must still arrive in order
+        assert values == sorted(values)
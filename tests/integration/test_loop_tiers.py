@@ -0,0 +1,77 @@
+"""Integration test for loop tiers and the background loop budget."""
+
+from __future__ import annotations
+
+import asyncio
+from pathlib import Path
+import re
+
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_loop_tiers(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that background components are time-sliced around realtime ones."""
+    external_components_path = str(
+        Path(__file__).parent / "fixtures" / "external_components"
+    )
+    yaml_config = yaml_config.replace(
+        "EXTERNAL_COMPONENT_PATH", external_components_path
+    )
+
+    loop_pattern = re.compile(r"\[(\w+)\] Loop count: (\d+)")
+    # Names of the components in the order their loop() ran
+    loop_order: list[str] = []
+    enough_loops = asyncio.Event()
+
+    def on_log_line(line: str) -> None:
+        match = loop_pattern.search(line)
+        if not match:
+            return
+        loop_order.append(match.group(1))
+        if loop_order.count("realtime") >= 60:
+            enough_loops.set()
+
+    async with (
+        run_compiled(yaml_config, line_callback=on_log_line),
+        api_client_connected() as client,
+    ):
+        device_info = await client.device_info()
+        assert device_info is not None
+        assert device_info.name == "loop-tiers-test"
+
+        try:
+            await asyncio.wait_for(enough_loops.wait(), timeout=10.0)
+        except TimeoutError:
+            pytest.fail(
+                f"Realtime component only ran {loop_order.count('realtime')} times"
+            )
+
+    # Skip everything before the first realtime loop, setup runs all components together
+    first = loop_order.index("realtime")
+    iterations: list[list[str]] = []
+    for name in loop_order[first:]:
+        if name == "realtime":
+            iterations.append([])
+        else:
+            iterations[-1].append(name)
+    # The last iteration may be incomplete
+    iterations = iterations[:-1]
+
+    for background in iterations:
+        assert len(background) == 1, (
+            f"Expected one background component per loop iteration, got {background}"
+        )
+
+    # Round-robin: every background component gets its turn
+    ran = [background[0] for background in iterations]
+    for name in ("background_1", "background_2", "background_3"):
+        assert ran.count(name) >= len(iterations) // 3 - 1, (
+            f"{name} ran {ran.count(name)} times in {len(iterations)} iterations"
+        )
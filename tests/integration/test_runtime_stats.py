@@ -26,6 +26,7 @@ async def test_runtime_stats(
 
     # Track component stats
     component_stats_found = set()
+    latency_stats_found = set()
 
     # Patterns to match - need to handle ANSI color codes and timestamps
     # The log format is: [HH:MM:SS][color codes][I][tag]: message
@@ -34,6 +35,10 @@ async def test_runtime_stats(
     component_pattern = re.compile(
         r"^\[[^\]]+\].*?\s+([\w.]+):\s+count=(\d+),\s+avg=([\d.]+)ms"
     )
+    # Match latency histogram lines (e.g., template.sensor scheduler: p50=16, ...)
+    latency_pattern = re.compile(
+        r"\s([\w.]+) (loop|scheduler): p50=(\d+), p90=(\d+), p99=(\d+), max=(\d+)"
+    )
 
     def check_output(line: str) -> None:
         """Check log output for runtime stats messages."""
@@ -54,6 +59,13 @@ async def test_runtime_stats(
             component_name = match.group(1)
             component_stats_found.add(component_name)
 
+        # Check for latency histogram stats
+        match = latency_pattern.search(line)
+        if match:
+            p50, p90, p99, max_us = (int(match.group(i)) for i in range(3, 7))
+            assert p50 <= p90 <= p99 <= max_us, line
+            latency_stats_found.add((match.group(1), match.group(2)))
+
     async with (
         run_compiled(yaml_config, line_callback=check_output),
         api_client_connected() as client,
@@ -86,3 +98,8 @@ async def test_runtime_stats(
         assert "template.switch" in component_stats_found, (
             f"Expected template.switch stats, found: {component_stats_found}"
         )
+
+        # Template sensors are polled through scheduler intervals
+        assert ("template.sensor", "scheduler") in latency_stats_found, (
+            f"Expected template.sensor scheduler latency, found: {latency_stats_found}"
+        )
@@ -0,0 +1,75 @@
+"""Test the lock-free defer ring with concurrent defers from multiple threads."""
+
+import asyncio
+from pathlib import Path
+import re
+
+from aioesphomeapi import UserService
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_scheduler_defer_ring(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that ring overflow loses and reorders no defers."""
+
+    external_components_path = str(
+        Path(__file__).parent / "fixtures" / "external_components"
+    )
+    yaml_config = yaml_config.replace(
+        "EXTERNAL_COMPONENT_PATH", external_components_path
+    )
+
+    loop = asyncio.get_running_loop()
+    test_complete_future: asyncio.Future[None] = loop.create_future()
+
+    executed_defers: set[int] = set()
+    thread_executions: dict[int, list[int]] = {}
+
+    def on_log_line(line: str) -> None:
+        match = re.search(r"Executed defer (\d+) \(thread (\d+), index (\d+)\)", line)
+        if not match:
+            return
+
+        executed_defers.add(int(match.group(1)))
+        thread_executions.setdefault(int(match.group(2)), []).append(
+            int(match.group(3))
+        )
+
+        if len(executed_defers) == 1000 and not test_complete_future.done():
+            test_complete_future.set_result(None)
+
+    async with (
+        run_compiled(yaml_config, line_callback=on_log_line),
+        api_client_connected() as client,
+    ):
+        device_info = await client.device_info()
+        assert device_info is not None
+        assert device_info.name == "scheduler-defer-ring-test"
+
+        _, services = await asyncio.wait_for(
+            client.list_entities_services(), timeout=5.0
+        )
+        run_stress_test_service: UserService | None = next(
+            (s for s in services if s.name == "run_stress_test"), None
+        )
+        assert run_stress_test_service is not None, "run_stress_test service not found"
+
+        client.execute_service(run_stress_test_service, {})
+
+        try:
+            await asyncio.wait_for(test_complete_future, timeout=5.0)
+        except TimeoutError:
+            pytest.fail(f"Only {len(executed_defers)} of 1000 defers executed")
+
+        assert executed_defers == set(range(1000))
+        # Each thread's defers must run in submission order, whichever queue they went through
+        for thread_id, indices in thread_executions.items():
+            assert indices == list(range(100)), (
+                f"Thread {thread_id} executed indices out of order: {indices[:10]}..."
+            )
@@ -0,0 +1,47 @@
+"""Test that the scheduler item pool recycles items instead of allocating."""
+
+import asyncio
+import re
+
+import pytest
+
+from .types import APIClientConnectedFactory, RunCompiledFunction
+
+
+@pytest.mark.asyncio
+async def test_scheduler_pool(
+    yaml_config: str,
+    run_compiled: RunCompiledFunction,
+    api_client_connected: APIClientConnectedFactory,
+) -> None:
+    """Test that repeated timeouts are served from the pool after warm-up."""
+
+    loop = asyncio.get_running_loop()
+    stats_future: asyncio.Future[tuple[int, int, int]] = loop.create_future()
+
+    stats_pattern = re.compile(
+        r"Pool stats: high_water=(\d+) allocs=(\d+) reuses=(\d+)"
+    )
+
+    def check_output(line: str) -> None:
+        """Check log output for the pool statistics report."""
+        if not stats_future.done() and (match := stats_pattern.search(line)):
+            stats_future.set_result(tuple(int(g) for g in match.groups()))
+
+    async with run_compiled(yaml_config, line_callback=check_output):
+        async with api_client_connected() as client:
+            device_info = await client.device_info()
+            assert device_info is not None
+            assert device_info.name == "scheduler-pool"
+
+            try:
+                high_water, allocs, reuses = await asyncio.wait_for(
+                    stats_future, timeout=10.0
+                )
+            except TimeoutError:
+                pytest.fail("Pool statistics were not reported")
+
+            # Heap allocations are bounded by the peak number of live items,
+            # everything after warm-up must come from the pool
+            assert allocs <= high_water
+            assert reuses > allocs